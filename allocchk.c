@@ -0,0 +1,62 @@
+/*
+ *  allocchk.c: count memory allocation calls made by units
+ *
+ *  This file is built as a shared object by 'make check' and loaded
+ *  with LD_PRELOAD.  It replaces malloc(), calloc(), realloc() and
+ *  free() with versions that count the calls, and prints the count
+ *  to stderr when the program exits.  The check compares the counts
+ *  for short and long runs of the same queries to verify that the
+ *  query path allocates no memory once it has warmed up.
+ *
+ *  It relies on the GNU C library, and the check is skipped on other
+ *  systems.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void __libc_free(void *pointer);
+
+static long alloccount = 0;
+
+void *
+malloc(size_t size)
+{
+  alloccount++;
+  return __libc_malloc(size);
+}
+
+
+void *
+calloc(size_t count, size_t size)
+{
+  alloccount++;
+  return __libc_calloc(count, size);
+}
+
+
+void *
+realloc(void *pointer, size_t size)
+{
+  alloccount++;
+  return __libc_realloc(pointer, size);
+}
+
+
+void
+free(void *pointer)
+{
+  if (pointer)
+    alloccount++;
+  __libc_free(pointer);
+}
+
+
+static void __attribute__((destructor))
+showcount(void)
+{
+  fprintf(stderr, "allocations: %ld\n", alloccount);
+}
@@ -0,0 +1,724 @@
+/*
+ *  bulk.c: conversion of arrays of numbers for GNU units
+ *  Copyright (C) 2010 Free Software Foundation, Inc
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *  This program was written by Adrian Mariano (adrian@cam.cornell.edu)
+ */
+
+#include "units.h"
+
+#ifdef PTHREADS
+#  include <pthread.h>
+#endif
+
+/*
+   Bulk conversion applies one conversion to many numbers.  The units
+   are parsed and reduced once by bulkprepare(), which decides how the
+   numbers are to be converted:
+
+     BULK_LINEAR      out = scale * in + offset.  Used for conversions
+                      between ordinary units and for nonlinear units
+                      which are defined as affine functions, like tempF
+                      and tempC.
+     BULK_RECIPROCAL  out = scale / in, for reciprocal conversions.
+     BULK_GENERAL     Every number is run through the nonlinear units
+                      separately.  Used for tables and for functions
+                      which are not affine.
+
+   The first two cases are done by simple loops over the arrays which
+   are vectorized with SSE2, AVX2 or AVX-512 when the processor supports
+   them.  The choice is made at run time, so the same binary runs on
+   any x86 processor.  The kernels do not use fused multiply-add, so
+   every version gives exactly the same answers.
+*/
+
+#define BULKCHUNK 4096          /* Numbers converted at once by bulkstream */
+#define FITTOL 1e-10            /* Relative error allowed in affine fit */
+#define FITWIDTH 1048576.0      /* Interval used to find the affine slope */
+
+static double fitpoints[] = {0, 1, -1, 0.5, 10, 100, -40, 1000, 12345.678};
+
+#define FITCOUNT (sizeof(fitpoints)/sizeof(fitpoints[0]))
+
+
+/*
+   Kernels.  Each one converts n numbers from 'in' to 'out', which may
+   be the same array.
+*/
+
+typedef void (*bulkkernel)(const double *in, double *out, long n,
+                           double a, double b);
+
+static void
+linearscalar(const double *in, double *out, long n, double a, double b)
+{
+  long i;
+
+  for(i=0;i<n;i++)
+    out[i] = in[i]*a + b;
+}
+
+
+static void
+reciprocalscalar(const double *in, double *out, long n, double a, double b)
+{
+  long i;
+
+  for(i=0;i<n;i++)
+    out[i] = a / in[i];
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && !defined(NO_SIMD)
+
+#include <immintrin.h>
+
+/* Keep the compiler from contracting the multiply and add into an FMA
+   instruction, which would change the rounding. */
+
+#define SIMDFUNC(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+
+SIMDFUNC("sse2") static void
+linearsse2(const double *in, double *out, long n, double a, double b)
+{
+  __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b);
+  long i;
+
+  for(i=0;i+2<=n;i+=2)
+    _mm_storeu_pd(out+i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(in+i), va), vb));
+  linearscalar(in+i, out+i, n-i, a, b);
+}
+
+
+SIMDFUNC("sse2") static void
+reciprocalsse2(const double *in, double *out, long n, double a, double b)
+{
+  __m128d va = _mm_set1_pd(a);
+  long i;
+
+  for(i=0;i+2<=n;i+=2)
+    _mm_storeu_pd(out+i, _mm_div_pd(va, _mm_loadu_pd(in+i)));
+  reciprocalscalar(in+i, out+i, n-i, a, b);
+}
+
+
+SIMDFUNC("avx2") static void
+linearavx2(const double *in, double *out, long n, double a, double b)
+{
+  __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b);
+  long i;
+
+  for(i=0;i+4<=n;i+=4)
+    _mm256_storeu_pd(out+i,
+               _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(in+i), va), vb));
+  linearscalar(in+i, out+i, n-i, a, b);
+}
+
+
+SIMDFUNC("avx2") static void
+reciprocalavx2(const double *in, double *out, long n, double a, double b)
+{
+  __m256d va = _mm256_set1_pd(a);
+  long i;
+
+  for(i=0;i+4<=n;i+=4)
+    _mm256_storeu_pd(out+i, _mm256_div_pd(va, _mm256_loadu_pd(in+i)));
+  reciprocalscalar(in+i, out+i, n-i, a, b);
+}
+
+
+SIMDFUNC("avx512f") static void
+linearavx512(const double *in, double *out, long n, double a, double b)
+{
+  __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b);
+  long i;
+
+  for(i=0;i+8<=n;i+=8)
+    _mm512_storeu_pd(out+i,
+               _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(in+i), va), vb));
+  linearscalar(in+i, out+i, n-i, a, b);
+}
+
+
+SIMDFUNC("avx512f") static void
+reciprocalavx512(const double *in, double *out, long n, double a, double b)
+{
+  __m512d va = _mm512_set1_pd(a);
+  long i;
+
+  for(i=0;i+8<=n;i+=8)
+    _mm512_storeu_pd(out+i, _mm512_div_pd(va, _mm512_loadu_pd(in+i)));
+  reciprocalscalar(in+i, out+i, n-i, a, b);
+}
+
+#define HAVE_SIMD
+
+#endif /* __GNUC__ && x86 */
+
+
+static bulkkernel linearkernel = 0;
+static bulkkernel reciprocalkernel = 0;
+#ifdef PTHREADS
+static pthread_once_t kernelonce = PTHREAD_ONCE_INIT;
+#endif
+
+/* Choose the fastest kernels this processor can run. */
+
+static void
+choosekernels(void)
+{
+  linearkernel = linearscalar;
+  reciprocalkernel = reciprocalscalar;
+#ifdef HAVE_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")){
+    linearkernel = linearavx512;
+    reciprocalkernel = reciprocalavx512;
+  } else if (__builtin_cpu_supports("avx2")){
+    linearkernel = linearavx2;
+    reciprocalkernel = reciprocalavx2;
+  } else if (__builtin_cpu_supports("sse2")){
+    linearkernel = linearsse2;
+    reciprocalkernel = reciprocalsse2;
+  }
+#endif
+}
+
+
+/*
+   Convert a single number with the general method.  Returns 0 and
+   stores the answer in 'out' on success, or returns an error code.
+*/
+
+static int
+bulkeval(struct bulkconv *conv, double in, double *out)
+{
+  struct unittype value;
+  int err, type;
+
+  unitcopy(&value, &conv->have);
+  value.factor *= in;
+  err = 0;
+  if (conv->havefunc)
+    err = evalfunc(conv->ctx, &value, conv->havefunc, 0);
+  if (!err)
+    err = completereduce(conv->ctx, &value);
+  if (err){
+    freeunit(&value);
+    return err;
+  }
+  if (conv->wantfunc){
+    err = evalfunc(conv->ctx, &value, conv->wantfunc, 1);
+    if (!err)
+      err = divunit(&value, &conv->want);
+    if (!err)
+      err = unit2num(&value);
+    *out = value.factor;
+  } else {
+    type = conversiontype(conv->ctx->db, &value, &conv->want);
+    if (type<0)
+      err = E_NOTCONFORMABLE;
+    else if (type)
+      *out = 1 / (value.factor * conv->want.factor);
+    else
+      *out = value.factor / conv->want.factor;
+  }
+  freeunit(&value);
+  return err;
+}
+
+
+/*
+   Parse and reduce one side of a bulk conversion.  If 'str' names a
+   nonlinear unit then it is stored in 'fun' and 'theunit' is set to
+   the dimensions of its argument.
+*/
+
+static int
+bulkunit(struct unitscontext *ctx, char *str, struct unittype *theunit, 
+         struct func **fun)
+{
+  int err;
+
+  *fun = isfunction(ctx, str);
+  if (*fun){
+    if ((*fun)->table || !(*fun)->forward.dimen){
+      initializeunit(theunit);
+      return 0;
+    }
+    str = (*fun)->forward.dimen;
+  }
+  err = parseunit(ctx, theunit, str, 0, 0);
+  if (!err)
+    err = completereduce(ctx, theunit);
+  return err;
+}
+
+
+/*
+   Whether a function is affine is decided from its definition, without
+   evaluating it.  Each part of the definition is put in a class by the
+   way it uses the parameter, following the grammar in parse.y:
+   AFF_CONSTANT if it does not use the parameter, AFF_AFFINE if it is
+   a constant times the parameter plus a constant, and AFF_NONLINEAR
+   for anything else, including anything that is not understood.  A
+   unit function used in a definition is followed into its own
+   definition.  Tables are never affine, because numbers outside a
+   table must fail.
+*/
+
+#define AFF_CONSTANT 0
+#define AFF_AFFINE 1
+#define AFF_NONLINEAR 2
+
+#define AFFMAXDEPTH 8           /* Deepest nesting of functions followed */
+#define AFFENDWORD "+-*/|\t\n^ ()"     /* Characters ending a word, */
+                                       /*    as in yylex() */
+
+struct affscan {
+  struct unitscontext *ctx;
+  char *pos;                    /* Next character of the definition */
+  char *param;
+  int depth;
+};
+
+static int affinefunc(struct unitscontext *ctx, struct func *func, 
+                      int inverse, int depth);
+static int affexpr(struct affscan *scan);
+
+
+static void
+affskip(struct affscan *scan)
+{
+  scan->pos += strspn(scan->pos, WHITE);
+}
+
+
+/* Classifies the parenthesized argument at scan->pos */
+
+static int
+affarg(struct affscan *scan)
+{
+  int class;
+
+  affskip(scan);
+  if (*scan->pos!='(')
+    return AFF_NONLINEAR;
+  scan->pos++;
+  class = affexpr(scan);
+  affskip(scan);
+  if (*scan->pos!=')')
+    return AFF_NONLINEAR;
+  scan->pos++;
+  return class;
+}
+
+
+/* Classifies a number, a unit name, the parameter, a function of a
+   parenthesized argument or a parenthesized expression */
+
+static int
+affatom(struct affscan *scan)
+{
+  struct func *func;
+  char *word, *end;
+  int len, inverse, class;
+
+  affskip(scan);
+  if (*scan->pos=='(')
+    return affarg(scan);
+  if (strchr(".0123456789", *scan->pos)){
+    strtod(scan->pos, &end);
+    while (end!=scan->pos){             /* Numbers joined by '|' */
+      scan->pos = end;
+      affskip(scan);
+      if (*scan->pos!='|')
+        return AFF_CONSTANT;
+      scan->pos++;
+      affskip(scan);
+      strtod(scan->pos, &end);
+    }
+    return AFF_NONLINEAR;
+  }
+  inverse = *scan->pos=='~';
+  if (inverse){
+    scan->pos++;
+    affskip(scan);
+  }
+  word = scan->pos;
+  len = strcspn(word, AFFENDWORD);
+  if (!len)
+    return AFF_NONLINEAR;
+  scan->pos += len;
+  if (!inverse && len==strlen(scan->param) && 
+      !strncmp(word, scan->param, len))
+    return AFF_AFFINE;
+  if ((func = fnlookup(scan->ctx->db, word, len))){
+    class = affarg(scan);
+    if (class==AFF_AFFINE && 
+        !affinefunc(scan->ctx, func, inverse, scan->depth+1))
+      class = AFF_NONLINEAR;
+    return class;
+  }
+  if (inverse)
+    return AFF_NONLINEAR;
+
+  /* A word followed by an argument is taken for one of the functions
+     built into the parser, such as sqrt, which are not affine */
+
+  affskip(scan);
+  if (*scan->pos=='(')
+    return affarg(scan)==AFF_CONSTANT ? AFF_CONSTANT : AFF_NONLINEAR;
+  return AFF_CONSTANT;                  /* A unit */
+}
+
+
+/* Classifies an atom raised to powers */
+
+static int
+affpower(struct affscan *scan)
+{
+  int class;
+
+  class = affatom(scan);
+  for(;;){
+    affskip(scan);
+    if (*scan->pos=='^')
+      scan->pos++;
+    else if (scan->pos[0]=='*' && scan->pos[1]=='*')
+      scan->pos += 2;
+    else
+      return class;
+    affskip(scan);
+    if (*scan->pos=='-')
+      scan->pos++;
+    if (affatom(scan)!=AFF_CONSTANT || class!=AFF_CONSTANT)
+      class = AFF_NONLINEAR;
+  }
+}
+
+
+/* Classifies a product.  Everything after a division is taken to be
+   in the divisor, which is right or makes the answer AFF_NONLINEAR. */
+
+static int
+affterm(struct affscan *scan)
+{
+  int class, factor, divided;
+
+  class = AFF_CONSTANT;
+  divided = 0;
+  for(;;){
+    affskip(scan);
+    if (!*scan->pos || *scan->pos==')' || *scan->pos=='+' ||
+        (*scan->pos=='-' && scan->ctx->minusminus))
+      return class;
+    if (*scan->pos=='-' || (*scan->pos=='*' && scan->pos[1]!='*')){
+      scan->pos++;
+      continue;
+    }
+    if (*scan->pos=='/' || (!strncmp(scan->pos, "per", 3) && 
+                            strcspn(scan->pos, AFFENDWORD)==3)){
+      scan->pos += *scan->pos=='/' ? 1 : 3;
+      divided = 1;
+      continue;
+    }
+    factor = affpower(scan);
+    if (factor==AFF_NONLINEAR || (divided && factor!=AFF_CONSTANT) ||
+        (factor==AFF_AFFINE && class==AFF_AFFINE))
+      return AFF_NONLINEAR;
+    if (factor==AFF_AFFINE)
+      class = AFF_AFFINE;
+  }
+}
+
+
+/* Classifies a sum */
+
+static int
+affexpr(struct affscan *scan)
+{
+  int class, term;
+
+  class = AFF_CONSTANT;
+  affskip(scan);
+  if (*scan->pos=='/'){                 /* A reciprocal */
+    scan->pos++;
+    return affterm(scan)==AFF_CONSTANT ? AFF_CONSTANT : AFF_NONLINEAR;
+  }
+  for(;;){
+    affskip(scan);
+    if (*scan->pos=='-')                /* Unary minus */
+      scan->pos++;
+    term = affterm(scan);
+    if (term>class)
+      class = term;
+    if (class==AFF_NONLINEAR)
+      return class;
+    affskip(scan);
+    if (*scan->pos!='+' && *scan->pos!='-')
+      return class;
+    scan->pos++;
+  }
+}
+
+
+/* Returns 1 if 'func', or its inverse if 'inverse' is set, is defined
+   as an affine function of its parameter */
+
+static int
+affinefunc(struct unitscontext *ctx, struct func *func, int inverse, 
+           int depth)
+{
+  struct functype *thefunc;
+  struct affscan scan;
+  int class;
+
+  thefunc = inverse ? &func->inverse : &func->forward;
+  if (func->table || !thefunc->def || depth>AFFMAXDEPTH)
+    return 0;
+  scan.ctx = ctx;
+  scan.pos = thefunc->def;
+  scan.param = thefunc->param;
+  scan.depth = depth;
+  class = affexpr(&scan);
+  affskip(&scan);
+  return class!=AFF_NONLINEAR && !*scan.pos;
+}
+
+
+/*
+   Try to describe a conversion involving nonlinear units as an affine
+   function out = scale * in + offset.  The definitions of the units
+   must be affine (see affinefunc()).  The scale and offset are found
+   by evaluating the conversion, and a few more points are checked so
+   that rounding does not make the fit worse than the general method.
+   Returns 0 if the fit succeeds.
+*/
+
+static int
+fitaffine(struct bulkconv *conv)
+{
+  double y0, y1, y, scale;
+  int i;
+
+  if ((conv->havefunc && !affinefunc(conv->ctx, conv->havefunc, 0, 0)) ||
+      (conv->wantfunc && !affinefunc(conv->ctx, conv->wantfunc, 1, 0)))
+    return 1;
+  /* The slope is measured over a wide interval to avoid cancellation */
+  if (bulkeval(conv, 0, &y0) || bulkeval(conv, FITWIDTH, &y1))
+    return 1;
+  scale = (y1 - y0) / FITWIDTH;
+  for(i=0;i<FITCOUNT;i++){
+    if (bulkeval(conv, fitpoints[i], &y))
+      return 1;
+    /* Written so that infinities and NaN fail the test */
+    if (!(fabs(y - scale*fitpoints[i] - y0) <=
+          FITTOL*(fabs(y)+fabs(y0)+fabs(scale*fitpoints[i]))))
+      return 1;
+  }
+  conv->scale = scale;
+  conv->offset = y0;
+  return 0;
+}
+
+
+/*
+   Prepare to convert numbers in the units 'havestr' into the units
+   'wantstr'.  Either one may be a nonlinear unit, in which case the
+   numbers are its arguments (for 'havestr') or the answers are its
+   arguments (for 'wantstr').  Returns 0 on success or an error code,
+   which is E_NOTCONFORMABLE if the units do not match.  Call
+   bulkfree() when done with a prepared conversion.  A BULK_GENERAL
+   conversion keeps using 'ctx', so bulkapply() must not be called for
+   it while another thread is using the same context.
+*/
+
+int
+bulkprepare(struct unitscontext *ctx, struct bulkconv *conv, 
+            char *havestr, char *wantstr)
+{
+  int err, type;
+  double y;
+
+#ifdef PTHREADS
+  pthread_once(&kernelonce, choosekernels);
+#else
+  if (!linearkernel)
+    choosekernels();
+#endif
+  initializeunit(&conv->have);
+  initializeunit(&conv->want);
+  conv->ctx = ctx;
+  conv->scale = 1;
+  conv->offset = 0;
+  if ((err = bulkunit(ctx, havestr, &conv->have, &conv->havefunc)) ||
+      (err = bulkunit(ctx, wantstr, &conv->want, &conv->wantfunc))){
+    bulkfree(conv);
+    return err;
+  }
+  if (conv->havefunc || conv->wantfunc){
+    if (!fitaffine(conv)){
+      conv->type = BULK_LINEAR;
+      return 0;
+    }
+    conv->type = BULK_GENERAL;
+    /* Report mismatched dimensions now instead of for every number */
+    err = bulkeval(conv, 1, &y);
+    if (err==E_NOTCONFORMABLE || err==E_BADFUNCARG || err==E_NOTANUMBER){
+      bulkfree(conv);
+      return E_NOTCONFORMABLE;
+    }
+    return 0;
+  }
+  type = conversiontype(conv->ctx->db, &conv->have, &conv->want);
+  if (type<0){
+    bulkfree(conv);
+    return E_NOTCONFORMABLE;
+  }
+  if (type){
+    conv->type = BULK_RECIPROCAL;
+    conv->scale = 1 / (conv->have.factor * conv->want.factor);
+  } else {
+    conv->type = BULK_LINEAR;
+    conv->scale = conv->have.factor / conv->want.factor;
+  }
+  return 0;
+}
+
+
+/*
+   Convert the n numbers in 'in' and store the answers in 'out', which
+   may be the same array as 'in'.  Numbers which cannot be converted
+   give NaN.  Returns the number of failed conversions.
+*/
+
+long
+bulkapply(struct bulkconv *conv, const double *in, double *out, long n)
+{
+  long i, failed;
+
+  if (conv->type==BULK_LINEAR){
+    linearkernel(in, out, n, conv->scale, conv->offset);
+    return 0;
+  }
+  if (conv->type==BULK_RECIPROCAL){
+    reciprocalkernel(in, out, n, conv->scale, 0);
+    return 0;
+  }
+  failed = 0;
+  for(i=0;i<n;i++)
+    if (bulkeval(conv, in[i], out+i)){
+      out[i] = NAN;
+      failed++;
+    }
+  return failed;
+}
+
+
+void
+bulkfree(struct bulkconv *conv)
+{
+  freeunit(&conv->have);
+  freeunit(&conv->want);
+}
+
+
+/*
+   Convert n numbers from 'havestr' to 'wantstr' in one call.  Returns
+   0 on success, an error code if the conversion cannot be prepared, or
+   E_NOTINDOMAIN if some of the numbers could not be converted.
+*/
+
+int
+bulkconvert(struct unitscontext *ctx, char *havestr, char *wantstr,
+            const double *in, double *out, long n)
+{
+  struct bulkconv conv;
+  int err;
+
+  if ((err = bulkprepare(ctx, &conv, havestr, wantstr)))
+    return err;
+  err = bulkapply(&conv, in, out, n) ? E_NOTINDOMAIN : 0;
+  bulkfree(&conv);
+  return err;
+}
+
+
+/* Print the answers for one chunk of numbers read by bulkstream() */
+
+static void
+bulkoutput(struct unitshandle *conv, double *values, char *bad, int count)
+{
+  int i;
+
+  units_apply(conv, values, values, count);
+  for(i=0;i<count;i++){
+    if (bad[i])
+      puts("ERROR\tnot a number");
+    else if (isnan(values[i]))
+      puts("ERROR\tconversion failed");
+    else {
+      printf(numformat, values[i]);
+      putchar('\n');
+    }
+  }
+}
+
+
+/*
+   Read numbers, one per line, from stdin and write each one converted
+   from 'havestr' to 'wantstr' to stdout.  Lines which do not hold a
+   number, or numbers which cannot be converted, produce a line
+   starting with ERROR.  Returns an exit status for the program.
+*/
+
+int
+bulkstream(struct unitscontext *ctx, char *havestr, char *wantstr)
+{
+  struct unitshandle *conv;
+  double values[BULKCHUNK];
+  char bad[BULKCHUNK];
+  char *line = 0, *end;
+  int linesize = 0, count;
+
+  if (!(conv = units_prepare(ctx, havestr, wantstr))){
+    fprintf(stderr, "%s: %s\n", progname, units_error(ctx));
+    return 1;
+  }
+  setvbuf(stdout, 0, _IOFBF, BATCHBUFSIZE);
+  count = 0;
+  while (fgetslong(&line, &linesize, stdin, 0)){
+    values[count] = strtod(line, &end);
+    bad[count] = end==line || end[strspn(end, WHITE)];
+    if (bad[count])
+      values[count] = 1;      /* Anything will do; the answer is ignored */
+    if (++count==BULKCHUNK){
+      bulkoutput(conv, values, bad, count);
+      count = 0;
+    }
+  }
+  bulkoutput(conv, values, bad, count);
+  free(line);
+  units_free(conv);
+  if (fflush(stdout)){
+    perror(progname);
+    return 1;
+  }
+  return 0;
+}
@@ -27,29 +27,25 @@
 #define YYLEX_PARAM comm
 
 #define COMM ((struct commtype *)comm)
+#define CTX (COMM->ctx)
+#define ERR (COMM->err)
 
 #include "units.h"
 
 int yylex();
 void yyerror(char *);
 
-static int err;  /* value used by parser to store return values */
+#define CHECK if (ERR) { COMM->errorcode=ERR; YYABORT; }
 
-#define CHECK if (err) { COMM->errorcode=err; YYABORT; }
 
 
-#define MEMSIZE 100
-struct unittype *memtable[MEMSIZE];
-int nextunit=0;
-int maxunit=0;
-
 struct commtype {
+   struct unitscontext *ctx;
    int location;
    char *data;
    struct unittype *result;
    int errorcode;
-   char *paramname;
-   struct unittype *paramvalue;
+   int err;                     /* value used by parser to store return values */
 };
 
 struct function { 
@@ -63,24 +59,23 @@ struct function {
 #define ANGLEOUT 2
 
 struct unittype *
-getnewunit()
+getnewunit(struct unitscontext *ctx)
 {
-  if (nextunit>=MEMSIZE) 
-    return 0;
-  memtable[nextunit] = (struct unittype *) 
-    mymalloc(sizeof(struct unittype),"(getnewunit)");
-  if (!memtable[nextunit])
-    return 0;
-  initializeunit(memtable[nextunit]);
-  return memtable[nextunit++];
+  struct unittype *unit;
+
+  /* Units are taken from the arena, and released by parseunit() */
+  unit = (struct unittype *) arenaalloc(ctx, sizeof(struct unittype));
+  if (unit)
+    initializeunit(unit);
+  return unit;
 }
  
 
 struct unittype *
-makenumunit(double num,int *myerr)
+makenumunit(struct unitscontext *ctx, double num,int *myerr)
 {
   struct unittype *ret;
-  ret=getnewunit();
+  ret=getnewunit(ctx);
   if (!ret){
     *myerr = E_PARSEMEM;
     return 0;  
@@ -99,18 +94,18 @@ logb2(double x)
 
 
 int
-funcunit(struct unittype *theunit, struct function *fun)
+funcunit(struct unitscontext *ctx, struct unittype *theunit, 
+         struct function *fun)
 {
   struct unittype angleunit;
+  int err;
 
   if (fun->type==ANGLEIN){
     err=unit2num(theunit);
     if (err==E_NOTANUMBER){
-      initializeunit(&angleunit);
-      angleunit.denominator[0] = dupstr("radian");
-      angleunit.denominator[1] = 0;
-      err = multunit(theunit, &angleunit);
-      freeunit(&angleunit);
+      err = unitvalue(ctx, &angleunit, "radian");
+      if (!err)
+        err = divunit(theunit, &angleunit);
       if (!err)
 	err = unit2num(theunit);
     }
@@ -127,8 +122,9 @@ funcunit(struct unittype *theunit, struct function *fun)
   if (errno)
     return E_FUNC;
   if (fun->type==ANGLEOUT) {
-    theunit->numerator[0] = dupstr("radian");
-    theunit->numerator[1] = 0;
+    if ((err = unitvalue(ctx, &angleunit, "radian")))
+      return err;
+    return multunit(theunit, &angleunit);
   }
   return 0;
 }
@@ -181,7 +177,7 @@ funcunit(struct unittype *theunit, struct function *fun)
 
 
 %%
- input: EOL          { COMM->result = makenumunit(1,&err); CHECK; YYACCEPT; }
+ input: EOL          { COMM->result = makenumunit(CTX,1,&ERR); CHECK; YYACCEPT; }
       | unitexpr EOL { COMM->result = $1; YYACCEPT; }
       | error        { YYABORT; }
       ;
@@ -193,12 +189,12 @@ funcunit(struct unittype *theunit, struct function *fun)
  expr: list                         { $$ = $1; }
      | MULTMINUS list %prec UNARY   { $$ = $2; $$->factor *= -1; }
      | MINUS list %prec UNARY       { $$ = $2; $$->factor *= -1; }
-     | expr ADD expr                { err = addunit($1,$3); CHECK; $$=$1;}
-     | expr MINUS expr              { $3->factor *= -1; err = addunit($1,$3); 
+     | expr ADD expr                { ERR = addunit($1,$3); CHECK; $$=$1;}
+     | expr MINUS expr              { $3->factor *= -1; ERR = addunit($1,$3); 
                                          CHECK; $$=$1;}
-     | expr DIVIDE expr             { err = divunit($1, $3); CHECK; $$=$1;}
-     | expr MULTIPLY expr           { err = multunit($1,$3); CHECK; $$=$1;}
-     | expr MULTSTAR expr           { err = multunit($1,$3); CHECK; $$=$1;}
+     | expr DIVIDE expr             { ERR = divunit($1, $3); CHECK; $$=$1;}
+     | expr MULTIPLY expr           { ERR = multunit($1,$3); CHECK; $$=$1;}
+     | expr MULTSTAR expr           { ERR = multunit($1,$3); CHECK; $$=$1;}
      ; 
 
  numexpr:  REAL                     { $$ = $1;         }
@@ -211,24 +207,24 @@ funcunit(struct unittype *theunit, struct function *fun)
  /* list is a list of units, possibly raised to powers, to be multiplied
     together. */
 
- list:  numexpr                    { $$ = makenumunit($1,&err); CHECK;}
+ list:  numexpr                    { $$ = makenumunit(CTX,$1,&ERR); CHECK;}
       | UNIT                       { $$ = $1; }
-      | list EXPONENT list         { err = unitpower($1,$3); CHECK; $$=$1;}
-      | list MULTMINUS list        { err = multunit($1,$3); CHECK; $$=$1;}
-      | list list %prec MULTIPLY   { err = multunit($1,$2); CHECK; $$=$1;}
+      | list EXPONENT list         { ERR = unitpower($1,$3); CHECK; $$=$1;}
+      | list MULTMINUS list        { ERR = multunit($1,$3); CHECK; $$=$1;}
+      | list list %prec MULTIPLY   { ERR = multunit($1,$2); CHECK; $$=$1;}
       | pexpr                      { $$=$1; }
-      | SQRT pexpr                 { err = rootunit($2,2); CHECK; $$=$2;}
-      | CUBEROOT pexpr             { err = rootunit($2,3); CHECK; $$=$2;}
-      | RFUNC pexpr                { err = funcunit($2,$1); CHECK; $$=$2;}
-      | UFUNC pexpr                { err = evalfunc($2,$1,0); CHECK; $$=$2;}
-      | FUNCINV UFUNC pexpr        { err = evalfunc($3,$2,1); CHECK; $$=$3;}
+      | SQRT pexpr                 { ERR = rootunit($2,2); CHECK; $$=$2;}
+      | CUBEROOT pexpr             { ERR = rootunit($2,3); CHECK; $$=$2;}
+      | RFUNC pexpr                { ERR = funcunit(CTX,$2,$1); CHECK; $$=$2;}
+      | UFUNC pexpr                { ERR = evalfunc(CTX,$2,$1,0); CHECK; $$=$2;}
+      | FUNCINV UFUNC pexpr        { ERR = evalfunc(CTX,$3,$2,1); CHECK; $$=$3;}
       | list EXPONENT MULTMINUS list %prec EXPONENT  
                                    { $4->factor *= -1;
-				   err = unitpower($1,$4); CHECK; $$=$1;}
+				   ERR = unitpower($1,$4); CHECK; $$=$1;}
       | list EXPONENT MINUS list %prec EXPONENT  
                                    { $4->factor *= -1;
-				   err = unitpower($1,$4); CHECK; $$=$1;}
-      | SCANERROR                  { err = E_PARSEMEM; CHECK; }        
+				   ERR = unitpower($1,$4); CHECK; $$=$1;}
+      | SCANERROR                  { YYABORT; }  /* errorcode set by yylex */        
    ;
 
 
@@ -260,36 +256,68 @@ struct function
                       {"asin", asin,  ANGLEOUT},
                       {0, 0, 0}};
 
-struct {
-  char op;
-  int value;
-} optable[] = { {'*', MULTIPLY},
-                {'/', DIVIDE},
-                {'|', NUMDIV},
-                {'+', ADD},
-                {'(', '('},
-                {')', ')'},
-                {'^', EXPONENT},
-                {'~', FUNCINV},
-                {0, 0}};
+/*
+   Words that the lexer treats specially, in a table indexed by the
+   KEYHASH() of each word.  The hash is perfect for these words: each
+   has a slot of its own, so a word is classified by comparing it with
+   the one entry in its slot.  A new keyword that collides with an
+   existing one needs a different hash.
+*/
+
+#define KEYHASHSIZE 32
+#define KEYHASH(str,len) (((unsigned char)(str)[0] + 2*(unsigned char)(str)[1]\
+                           + (unsigned char)(str)[(len)-1]) & (KEYHASHSIZE-1))
 
 struct {
   char *name;
+  int length;
   int value;
-} strtable[] = { {"sqrt", SQRT},
-                 {"cuberoot", CUBEROOT},
-                 {"per" , DIVIDE},
-                 {0, 0}};
+  struct function *dfunc;       /* Function for RFUNC */
+} keytable[KEYHASHSIZE] = { 
+                 /*  0 */ {0, 0, 0, 0},
+                 /*  1 */ {"cuberoot", 8, CUBEROOT, 0},
+                 /*  2 */ {0, 0, 0, 0},
+                 /*  3 */ {0, 0, 0, 0},
+                 /*  4 */ {"tan", 3, RFUNC, realfunctions+2},
+                 /*  5 */ {"exp", 3, RFUNC, realfunctions+6},
+                 /*  6 */ {0, 0, 0, 0},
+                 /*  7 */ {0, 0, 0, 0},
+                 /*  8 */ {0, 0, 0, 0},
+                 /*  9 */ {"sqrt", 4, SQRT, 0},
+                 /* 10 */ {0, 0, 0, 0},
+                 /* 11 */ {0, 0, 0, 0},
+                 /* 12 */ {"per", 3, DIVIDE, 0},
+                 /* 13 */ {0, 0, 0, 0},
+                 /* 14 */ {0, 0, 0, 0},
+                 /* 15 */ {0, 0, 0, 0},
+                 /* 16 */ {0, 0, 0, 0},
+                 /* 17 */ {"log", 3, RFUNC, realfunctions+4},
+                 /* 18 */ {0, 0, 0, 0},
+                 /* 19 */ {"sin", 3, RFUNC, realfunctions+0},
+                 /* 20 */ {"cos", 3, RFUNC, realfunctions+1},
+                 /* 21 */ {"asin", 4, RFUNC, realfunctions+9},
+                 /* 22 */ {"ln", 2, RFUNC, realfunctions+3},
+                 /* 23 */ {"atan", 4, RFUNC, realfunctions+8},
+                 /* 24 */ {0, 0, 0, 0},
+                 /* 25 */ {0, 0, 0, 0},
+                 /* 26 */ {"acos", 4, RFUNC, realfunctions+7},
+                 /* 27 */ {0, 0, 0, 0},
+                 /* 28 */ {"log2", 4, RFUNC, realfunctions+5},
+                 /* 29 */ {0, 0, 0, 0},
+                 /* 30 */ {0, 0, 0, 0},
+                 /* 31 */ {0, 0, 0, 0}};
 
 int yylex(YYSTYPE *lvalp, struct commtype *comm)
 {
-  int length, count;
+  struct unitscontext *ctx;
+  int length, count, err;
   struct unittype *output;
-  char *inptr;
+  char *inptr, *name;
 
   char *nonunitchars = "+-*/|\t\n^ ()";
   
   if (comm->location==-1) return 0;
+  ctx = comm->ctx;
   inptr = comm->data + comm->location;   /* Point to start of data */
 
   /* Skip white space */
@@ -300,38 +328,30 @@ int yylex(YYSTYPE *lvalp, struct commtype *comm)
     return EOL;  /* Return failure if string has ended */
   }  
 
-  /* Check for **, an exponent operator.  */
-
-  if (0==strncmp("**",inptr,2)){
-    comm->location += 2;
-    return EXPONENT;
-  }
-
-  /* Check for '-' and '*' which get special handling */
- 
-  if (*inptr=='-'){
-    comm->location++;
-    if (minusminus)
-      return MINUS;
-    return MULTMINUS;
-  }      
-
-
-  if (*inptr=='*'){
-    comm->location++;
-    if (oldstar)
-      return MULTIPLY;
-    return MULTSTAR;
-  }      
-
-
-  /* Look for single character ops */
-
-  for(count=0; optable[count].op; count++){
-    if (*inptr==optable[count].op) {
-       comm->location++;
-       return optable[count].value;
-    }
+  /* Look for operators.  '-' and '*' get special handling. */
+
+  switch(*inptr){
+    case '*':
+      if (inptr[1]=='*'){      /* ** is an exponent operator */
+        comm->location += 2;
+        return EXPONENT;
+      }
+      comm->location++;
+      if (ctx->oldstar)
+        return MULTIPLY;
+      return MULTSTAR;
+    case '-':
+      comm->location++;
+      if (ctx->minusminus)
+        return MINUS;
+      return MULTMINUS;
+    case '/': comm->location++; return DIVIDE;
+    case '|': comm->location++; return NUMDIV;
+    case '+': comm->location++; return ADD;
+    case '(': comm->location++; return '(';
+    case ')': comm->location++; return ')';
+    case '^': comm->location++; return EXPONENT;
+    case '~': comm->location++; return FUNCINV;
   }
 
   /* Look for numbers */
@@ -353,35 +373,30 @@ int yylex(YYSTYPE *lvalp, struct commtype *comm)
      return 0;
   }
 
-  /* Look for string operators */
+  /* Look for string operators and real function names */
 
-  for(count=0;strtable[count].name;count++){
-     if (length==strlen(strtable[count].name) && 
-	 0==strncmp(strtable[count].name,inptr,length)){
-       comm->location += length;
-       return strtable[count].value;
-     }
-  }
-  
-  /* Look for real function names */
-
-  for(count=0;realfunctions[count].name;count++){
-     if (length==strlen(realfunctions[count].name) && 
-	 0==strncmp(realfunctions[count].name,inptr,length)){
-       lvalp->dfunc = realfunctions+count;
-       comm->location += length;
-       return RFUNC;
-     }
+  if (length>1){
+    count = KEYHASH(inptr, length);
+    if (length==keytable[count].length &&
+        0==strncmp(keytable[count].name,inptr,length)){
+      comm->location += length;
+      if (keytable[count].value==RFUNC)
+        lvalp->dfunc = keytable[count].dfunc;
+      return keytable[count].value;
+    }
   }
 
   /* Look for function parameter */
 
-  if (function_parameter && length==strlen(function_parameter) && 
-      0==strncmp(function_parameter, inptr, length)){
-      output = getnewunit();
-      if (!output)
+  if (ctx->function_parameter && 
+      length==strlen(ctx->function_parameter) && 
+      0==strncmp(ctx->function_parameter, inptr, length)){
+      output = getnewunit(ctx);
+      if (!output){
+        comm->errorcode = E_PARSEMEM;
 	return SCANERROR;
-      unitcopy(output, parameter_value);
+      }
+      unitcopy(output, ctx->parameter_value);
       lvalp->utype = output;
       comm->location += length;
       return UNIT;
@@ -389,7 +404,7 @@ int yylex(YYSTYPE *lvalp, struct commtype *comm)
 
   /* Look for user defined function */
 
-  lvalp->ufunc = fnlookup(inptr,length);
+  lvalp->ufunc = fnlookup(ctx->db, inptr, length);
   if (lvalp->ufunc){
     comm->location += length;
     return UFUNC;
@@ -403,14 +418,18 @@ int yylex(YYSTYPE *lvalp, struct commtype *comm)
      length--;
   } else count=1;
 
-  output = getnewunit();
-  if (!output)
+  output = getnewunit(ctx);
+  name = arenastr(ctx, inptr, length);
+  if (!output || !name){
+    comm->errorcode = E_PARSEMEM;
+    return SCANERROR;
+  }
+  err = unitvalue(ctx, output, name);
+  if (!err)
+    err = expunit(output, count);
+  if (err){
+    comm->errorcode = err;
     return SCANERROR;
-  output->numerator[count]=0;
-  for(;count;count--){
-    output->numerator[count-1] = mymalloc(length+1,"(yylex)");
-    strncpy(output->numerator[count-1], inptr, length);
-    output->numerator[count-1][length]=0;
   }
   lvalp->utype=output;
   return UNIT;
@@ -419,30 +438,37 @@ int yylex(YYSTYPE *lvalp, struct commtype *comm)
 
 void yyerror(char *s){}
 
-void
-freelist(int startunit)
-{
-  if (nextunit>maxunit) 
-    maxunit = nextunit;
-  while(nextunit>startunit){
-    freeunit(memtable[--nextunit]);
-    free(memtable[nextunit]);
-  }
-}
+/* Limit on the nesting of parseunit() calls, which is reached by
+   recursive function definitions */
 
+#define MAXPARSEDEPTH 200
 
 int
-parseunit(struct unittype *output, char *input,char **errstr,int *errloc)
+parseunit(struct unitscontext *ctx, struct unittype *output, char *input,
+          char **errstr, int *errloc)
 {
   struct commtype comm;
-  int startunit;
+  struct arenamark mark;
+  int failed;
 
-  startunit = nextunit;
   initializeunit(output);
+  if (ctx->parsedepth >= MAXPARSEDEPTH){
+    if (errstr)
+      *errstr = errormsg[E_PARSEMEM];
+    if (errloc)
+      *errloc = 0;
+    return E_PARSEMEM;
+  }
+  arenamark(ctx, &mark);
+  comm.ctx = ctx;
   comm.location = 0;
   comm.data = input;
   comm.errorcode = E_PARSE;    /* Assume parse error */
-  if (yyparse(&comm)){
+  comm.err = 0;
+  ctx->parsedepth++;
+  failed = yyparse(&comm);
+  ctx->parsedepth--;
+  if (failed){
     if (comm.location==-1) 
       comm.location = strlen(input);
     if (errstr){
@@ -453,14 +479,13 @@ parseunit(struct unittype *output, char *input,char **errstr,int *errloc)
     }
     if (errloc)
       *errloc = comm.location;
-    freelist(startunit);
+    arenarelease(ctx, &mark);
     return comm.errorcode;
   } else {
     if (errstr)
       *errstr = 0;
     multunit(output,comm.result);
-    freeunit(comm.result);
-    freelist(startunit);
+    arenarelease(ctx, &mark);
     return 0;
   }
 }
@@ -0,0 +1,404 @@
+/*
+ *  server.c: conversion server for GNU units
+ *  Copyright (C) 2010 Free Software Foundation, Inc
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *  This program was written by Adrian Mariano (adrian@cam.cornell.edu)
+ */
+
+#include "units.h"
+
+/*
+   The server loads the units database once and then answers conversion
+   requests from clients connected to a Unix domain socket.
+
+   Each request is a single line of the form
+
+        have <tab> want
+
+   where 'want' may be omitted to ask for the reduced form of 'have'.
+   Every request receives exactly one response line, in the format
+   written by formatresult(), and responses on a connection are sent in
+   the order of the requests.
+
+   One thread runs an epoll loop which accepts connections and waits for
+   input.  A connection with input is handed to a pool of worker threads
+   which read the available requests, convert them and write the
+   responses.  Connections are registered with EPOLLONESHOT, so at most
+   one thread handles a connection at any time; the worker rearms the
+   connection when it is done with it.
+
+   The sockets of the connections do not block.  Responses that the
+   client is not ready to receive stay in the output buffer of the
+   connection, which then waits with EPOLLOUT instead of EPOLLIN until
+   they have all been written, so a slow client never holds a worker
+   and no more of its requests are read until it catches up.
+
+   Each worker converts with a context of its own which shares the
+   units database, so the workers convert at the same time.
+*/
+
+#if defined(PTHREADS) && defined(EPOLL)
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/epoll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+
+#define MAXEVENTS 64            /* Events fetched per epoll_wait() call */
+#define MAXREQUEST 65536        /* Longest request line accepted */
+#define READSIZE 4096           /* Bytes read from a connection at once */
+
+struct connection {
+  int fd;
+  char *inbuf;                  /* Request data not yet processed */
+  int inlen;
+  int insize;
+  char *outbuf;                 /* Response data not yet written */
+  int outsize;
+  int closing;                  /* Close once the output is written */
+  char *linebuf;                /* One formatted response line */
+  int linesize;
+  struct convresult result;
+  struct connection *nextjob;   /* Link in the job queue */
+};
+
+static int epollfd;
+static int listenfd;
+static volatile sig_atomic_t stopserver = 0;
+
+/* Queue of connections waiting for a worker */
+
+static struct connection *firstjob = 0, *lastjob = 0;
+static pthread_mutex_t joblock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobready = PTHREAD_COND_INITIALIZER;
+
+
+static void
+addjob(struct connection *conn)
+{
+  pthread_mutex_lock(&joblock);
+  conn->nextjob = 0;
+  if (lastjob)
+    lastjob->nextjob = conn;
+  else
+    firstjob = conn;
+  lastjob = conn;
+  pthread_cond_signal(&jobready);
+  pthread_mutex_unlock(&joblock);
+}
+
+
+static struct connection *
+getjob()
+{
+  struct connection *conn;
+
+  pthread_mutex_lock(&joblock);
+  while (!firstjob)
+    pthread_cond_wait(&jobready, &joblock);
+  conn = firstjob;
+  firstjob = conn->nextjob;
+  if (!firstjob)
+    lastjob = 0;
+  pthread_mutex_unlock(&joblock);
+  return conn;
+}
+
+
+static void
+closeconnection(struct connection *conn)
+{
+  close(conn->fd);        /* Also removes the descriptor from epoll */
+  free(conn->inbuf);
+  free(conn->outbuf);
+  free(conn->linebuf);
+  free(conn->result.text);
+  free(conn);
+}
+
+
+/*
+   Write as much of the output of a connection as the socket accepts,
+   keeping the rest in the output buffer.  Returns 0 if all of it was
+   written, 1 if some is left and -1 on error.
+*/
+
+static int
+flushoutput(struct connection *conn)
+{
+  int len, count;
+
+  len = strlen(conn->outbuf);
+  while (len>0){
+    count = write(conn->fd, conn->outbuf, len);
+    if (count<0 && errno==EINTR)
+      continue;
+    if (count<0 && (errno==EAGAIN || errno==EWOULDBLOCK))
+      return 1;
+    if (count<=0)
+      return -1;
+    len -= count;
+    memmove(conn->outbuf, conn->outbuf + count, len + 1);
+  }
+  return 0;
+}
+
+
+/*
+   Write the output left on a connection, or if there is none then read
+   the pending input and answer each complete request line.  When the
+   client stops sending, a last request without a newline is answered
+   too, and the connection is closed once the answers are written.
+   Returns the epoll events that the connection should wait for next,
+   or 0 if it should be closed, as it is if there is not enough memory
+   to serve it.
+*/
+
+static int
+serveconnection(struct unitscontext *ctx, struct connection *conn)
+{
+  char *line, *end, *want;
+  int count, left;
+
+  if (tryappendstring(&conn->outbuf, &conn->outsize, ""))
+    goto nomemory;
+  if (*conn->outbuf){
+    left = flushoutput(conn);
+    if (left<0 || (!left && conn->closing))
+      return 0;
+    if (left)
+      return EPOLLOUT;
+  }
+  if (conn->inlen + READSIZE + 1 > conn->insize
+      && reservebuffer(&conn->inbuf, &conn->insize,
+                       2*(conn->inlen + READSIZE + 1)))
+    goto nomemory;
+  do {
+    count = read(conn->fd, conn->inbuf + conn->inlen, READSIZE);
+  } while (count<0 && errno==EINTR);
+  if (count<0 && (errno==EAGAIN || errno==EWOULDBLOCK))
+    return EPOLLIN;
+  if (count<0 || (!count && !conn->inlen))
+    return 0;
+  if (count)
+    conn->inlen += count;
+  else {                        /* End of input ends the last request */
+    conn->inbuf[conn->inlen++] = '\n';
+    conn->closing = 1;
+  }
+  conn->inbuf[conn->inlen] = 0;
+
+  line = conn->inbuf;
+  while ((end = strchr(line, '\n'))){
+    *end = 0;
+    if (end>line && end[-1]=='\r')
+      end[-1] = 0;
+    if ((want = strchr(line, '\t')))
+      *want++ = 0;
+    convertunits(ctx, line, want, &conn->result);
+    formatresult(&conn->linebuf, &conn->linesize, &conn->result);
+    if (tryappendstring(&conn->outbuf, &conn->outsize, conn->linebuf))
+      goto nomemory;
+    line = end + 1;
+  }
+  conn->inlen -= line - conn->inbuf;
+  memmove(conn->inbuf, line, conn->inlen);
+  if (conn->inlen > MAXREQUEST){
+    if (tryappendstring(&conn->outbuf, &conn->outsize,
+                        "ERROR\trequest too long\n"))
+      goto nomemory;
+    conn->closing = 1;
+  }
+  left = flushoutput(conn);
+  if (left<0 || (!left && conn->closing))
+    return 0;
+  return left ? EPOLLOUT : EPOLLIN;
+
+ nomemory:
+  fprintf(stderr, "%s: memory allocation error (serveconnection)\n",
+          progname);
+  return 0;
+}
+
+
+/* Thread that answers requests.  'arg' is the context it converts with. */
+
+static void *
+worker(void *arg)
+{
+  struct connection *conn;
+  struct epoll_event event;
+  int events;
+
+  for(;;){
+    conn = getjob();
+    if (!(events = serveconnection((struct unitscontext *) arg, conn))){
+      closeconnection(conn);
+      continue;
+    }
+    event.events = events | EPOLLONESHOT;
+    event.data.ptr = conn;
+    if (epoll_ctl(epollfd, EPOLL_CTL_MOD, conn->fd, &event))
+      closeconnection(conn);
+  }
+  return 0;
+}
+
+
+static void
+acceptconnections()
+{
+  struct connection *conn;
+  struct epoll_event event;
+  int fd;
+
+  for(;;){
+    fd = accept(listenfd, 0, 0);
+    if (fd<0)
+      return;                   /* EAGAIN: no more pending connections */
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    conn = (struct connection *) malloc(sizeof(struct connection));
+    if (!conn){
+      fprintf(stderr, "%s: memory allocation error (acceptconnections)\n",
+              progname);
+      close(fd);
+      continue;
+    }
+    memset(conn, 0, sizeof(struct connection));
+    conn->fd = fd;
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.ptr = conn;
+    if (epoll_ctl(epollfd, EPOLL_CTL_ADD, fd, &event))
+      closeconnection(conn);
+  }
+}
+
+
+static void
+stophandler(int sig)
+{
+  stopserver = 1;
+}
+
+
+/*
+   Run the conversion server on the Unix domain socket 'socketname'
+   using 'threads' worker threads (or one per processor if 'threads' is
+   zero or negative).  The workers use clones of 'ctx'.  Returns when
+   the server is interrupted by SIGINT or SIGTERM, or if it fails to
+   start.  The return value is an exit status for the program.
+*/
+
+int
+runserver(struct unitscontext *ctx, char *socketname, int threads)
+{
+  struct sockaddr_un addr;
+  struct stat statbuf;
+  struct epoll_event events[MAXEVENTS], event;
+  struct unitscontext *workerctx;
+  sigset_t blocked, saved;
+  pthread_t thread;
+  int i, count;
+
+  if (threads<=0){
+    threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads<=0)
+      threads = 1;
+  }
+  if (strlen(socketname) >= sizeof(addr.sun_path)){
+    fprintf(stderr, "%s: socket name '%s' is too long\n", progname, socketname);
+    return 1;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socketname);
+  if (!lstat(socketname, &statbuf)){
+    if (!S_ISSOCK(statbuf.st_mode)){
+      fprintf(stderr, "%s: '%s' is in use and is not a socket\n",
+              progname, socketname);
+      return 1;
+    }
+    unlink(socketname);     /* Remove a socket left by an earlier server */
+  }
+  listenfd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenfd<0 || bind(listenfd, (struct sockaddr *)&addr, sizeof(addr))
+      || listen(listenfd, SOMAXCONN)){
+    fprintf(stderr, "%s: unable to listen on socket '%s'.  ",
+            progname, socketname);
+    perror(0);
+    return 1;
+  }
+  fcntl(listenfd, F_SETFL, fcntl(listenfd, F_GETFL) | O_NONBLOCK);
+  fcntl(listenfd, F_SETFD, FD_CLOEXEC);
+  epollfd = epoll_create(MAXEVENTS);
+  event.events = EPOLLIN;
+  event.data.ptr = 0;           /* Marks the listening socket */
+  if (epollfd<0 || epoll_ctl(epollfd, EPOLL_CTL_ADD, listenfd, &event)){
+    fprintf(stderr, "%s: unable to start server.  ", progname);
+    perror(0);
+    unlink(socketname);
+    return 1;
+  }
+
+  /* Signals are handled by this thread only, so that they interrupt
+     epoll_wait() below. */
+
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGINT, stophandler);
+  signal(SIGTERM, stophandler);
+  sigemptyset(&blocked);
+  sigaddset(&blocked, SIGINT);
+  sigaddset(&blocked, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &blocked, &saved);
+  for(i=0;i<threads;i++)
+    if (!(workerctx = units_clone(ctx)) ||
+        pthread_create(&thread, 0, worker, workerctx)){
+      fprintf(stderr, "%s: unable to create worker thread\n", progname);
+      unlink(socketname);
+      return 1;
+    }
+  pthread_sigmask(SIG_SETMASK, &saved, 0);
+
+  while (!stopserver){
+    count = epoll_wait(epollfd, events, MAXEVENTS, -1);
+    for(i=0;i<count;i++)
+      if (events[i].data.ptr)
+        addjob((struct connection *)events[i].data.ptr);
+      else
+        acceptconnections();
+  }
+  unlink(socketname);
+  return 0;
+}
+
+#else /* !(PTHREADS && EPOLL) */
+
+int
+runserver(struct unitscontext *ctx, char *socketname, int threads)
+{
+  fprintf(stderr, "%s: server mode is not supported on this system\n",
+          progname);
+  return 1;
+}
+
+#endif
@@ -25,7 +25,21 @@
  */
 
 #include<stdio.h>
+#include<stdarg.h>
 #include<signal.h>
+#include<limits.h>
+
+#ifdef MMAP
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+#ifdef PTHREADS
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
 
 #ifdef READLINE
 #  include <readline/readline.h>
@@ -47,6 +61,7 @@
 #endif
 
 #define HOMEUNITSFILE ".units.dat"   /* Units file in home directory */
+#define DBENV "UNITSDB"         /* Environment variable naming database */
 #define PRIMITIVECHAR '!'	/* Character that marks irreducible units */
 #define COMMENTCHAR '#'         /* Comments marked by this character */
 #define COMMANDCHAR '!'         /* Unit database commands marked with this */
@@ -54,7 +69,6 @@
 #define SEARCHCOMMAND "search"  /* Command to request text search of units */
 #define UNITMATCH "?"           /* Command to request conformable units */
 #define DEFAULTPAGER "more"     /* Default pager program */
-#define DEFAULTLOCALE "en_US"   /* Default locale */
 #define MAXINCLUDE 5            /* Max depth of include files */
 #define MAXFILES 25             /* Max number of units files on command line */
 #define NODIM "!dimensionless"  /* Marks dimensionless primitive units, such */
@@ -74,20 +88,28 @@ int minusminus = 1;             /* Does '-' character give subtraction */
 int oldstar = 0;                /* Does '*' have higher precedence than '/' */
 int oneline = 0;                /* Suppresses the second line of output */
 char *unitsfiles[MAXFILES+1];   /* Null terminated list of units file names */
+char *dbcompile = 0;            /* Compiled database to write, "" for the */
+                                /* default name (--compile-db option) */
+char *serversocket = 0;         /* Socket name for server mode (--server) */
+char *batchfile = 0;            /* Input for batch mode, "" for stdin */
+int numthreads = 0;             /* Worker threads, 0 for one per processor */
+int bulkmode = 0;               /* Convert numbers read from stdin (--bulk) */
+int suggest = 0;                /* Suggest unit names in batch and server */
+                                /* modes (--suggest) */
+int precompute = 0;             /* Reduce all units after reading them */
+                                /* (--precompute) */
 char *progname="units";         /* Used in error messages */
 char *queryhave = "You have: "; /* Prompt text for units to convert from */
 char *querywant = "You want: "; /* Prompt text for units to convert to */
 char *deftext="\tDefinition: "; /* Output text when printing definition */
+struct unitsdata database;      /* Units read by the program */
+struct unitscontext *mainctx;   /* Context for the conversions done here */
 
-#define  HASHSIZE 101           /* Straight from K&R */
 #define  HASHNUMBER 31
 
-#define  PREFIXTABSIZE 128
-#define  prefixhash(str) (*(str) & 127)    /* "hash" value for prefixes */
-
 char *errormsg[]={"Successful completion", 
                   "Parse error",           
-                  "Product overflow",      
+                  "Product overflow",
                   "Unit reduction error (bad unit definition)",
                   "Illegal sum or difference of non-conformable units",
                   "Unit not dimensionless",
@@ -103,70 +125,60 @@ char *errormsg[]={"Successful completion",
 		  "Argument wrong dimension or bad nonlinear unit definition",
                   "Unable to open units file",
 		  "Units file contains errors",
-		  "Memory allocation error"
+		  "Memory allocation error",
+		  "Conformability error",
+		  "Too many primitive units"
                   };
 
-char *irreducible=0;            /* Name of last irreducible unit */
-
-
-/* Hash table for unit definitions. */
-
-struct unitlist {
-   char *name;			/* unit name */
-   char *value;			/* unit value */
-   int linenumber;              /* line in units data file where defined */
-   char *file;                  /* file where defined */ 
-   struct unitlist *next;	/* next item in list */
-} *utab[HASHSIZE];
-
-
-/* Table for prefix definitions. */
+/* 
+   Makes the buffer at least 'size' bytes long.  Returns 0 on success,
+   or E_MEMORY if there is not enough memory, in which case the buffer
+   is unchanged.
+*/
 
-struct prefixlist {
-   int len;			/* length of name string */
-   char *name;			/* prefix name */
-   char *value;			/* prefix value */
-   int linenumber;              /* line in units data file where defined */
-   char *file;                  /* file where defined */ 
-   struct prefixlist *last;	/* last item in list--only set in first item */
-   struct prefixlist *next;   	/* next item in list */
-} *ptab[PREFIXTABSIZE];
+int
+reservebuffer(char **buf, int *bufsize, int size)
+{
+  char *newbuf;
 
+  if (size <= *bufsize)
+    return 0;
+  if (!*buf || !*bufsize)
+    newbuf = malloc(size);
+  else
+    newbuf = realloc(*buf, size);
+  if (!newbuf)
+    return E_MEMORY;
+  *buf = newbuf;
+  *bufsize = size;
+  return 0;
+}
 
-/* Functions are stored in a linked list */
 
-struct func *firstfunc = 0;    /* Base of linked list of functions */
-struct func *lastfunc = 0;     /* Last entry in linked list of functions */
+/* Doubles the buffer, or makes it BUFGROW bytes if it is empty, and
+   leaves the new pointer in buf and the new buffer size in bufsize.
+   Returns E_MEMORY if there is no memory, in which case the buffer is
+   unchanged. */
 
-/* 
-   Used for passing parameters to the parser when we are in the process
-   of parsing a unit function.  If function_parameter is non-nil, then 
-   whenever the text in function_parameter appears in a unit expression
-   it is replaced by the unit value stored in parameter_value.
-*/
+#define BUFGROW 10
 
-char *function_parameter = 0; 
-struct unittype *parameter_value = 0;
+int
+trygrowbuffer(char **buf, int *bufsize)
+{
+  int usemalloc;
 
-char *NULLUNIT = "";  /* Used for units that are canceled during reduction */
+  usemalloc = !*buf || !*bufsize;
+  return reservebuffer(buf, bufsize, 
+             *bufsize + (usemalloc || *bufsize<BUFGROW ? BUFGROW : *bufsize));
+}
 
-/* Increases the buffer by BUFGROW bytes and leaves the new pointer in buf
-   and the new buffer size in bufsize. */
 
-#define BUFGROW 10
+/* Like trygrowbuffer(), but exits if there is no memory. */
 
 void
 growbuffer(char **buf, int *bufsize)
 {
-  int usemalloc;
-
-  usemalloc = !*buf || !*bufsize;
-  *bufsize += BUFGROW;
-  if (usemalloc)
-    *buf = malloc(*bufsize);
-  else
-    *buf = realloc(*buf,*bufsize);
-  if (!*buf){
+  if (trygrowbuffer(buf, bufsize)){
     fprintf(stderr, "%s: memory allocation error (growbuffer)\n",progname);  
     exit(3); 
   }
@@ -181,20 +193,25 @@ growbuffer(char **buf, int *bufsize)
 char *
 fgetscont(char *buf, int size, FILE *file, int *count)
 {
+  int len;
+
   if (!fgets(buf,size,file))
     return 0;
   (*count)++;
-  while(strlen(buf)>=2 && 0==strcmp(buf+strlen(buf)-2,"\\\n")){
+  len = strlen(buf);
+  while(len>=2 && buf[len-2]=='\\' && buf[len-1]=='\n'){
     (*count)++;
-    buf[strlen(buf)-2] = 0; /* delete trailing \n and \ char */
-    if (strlen(buf)>=size-1) /* return if the buffer is full */
+    len -= 2;
+    buf[len] = 0;          /* delete trailing \n and \ char */
+    if (len>=size-1)       /* return if the buffer is full */
       return buf;
-    if (!fgets(buf+strlen(buf), size - strlen(buf), file))
+    if (!fgets(buf+len, size-len, file))
       return buf;  /* already read some data so return success */
+    len += strlen(buf+len);
   }
-  if (buf[strlen(buf)-1] == '\\') {   /* If last char of buffer is \ then   */
-    ungetc('\\', file);               /* we don't know if it is followed by */
-    buf[strlen(buf)-1] = 0;           /* a \n, so put it back and try again */
+  if (buf[len-1] == '\\') {   /* If last char of buffer is \ then   */
+    ungetc('\\', file);       /* we don't know if it is followed by */
+    buf[len-1] = 0;           /* a \n, so put it back and try again */
   }
   return buf;
 }
@@ -209,16 +226,18 @@ fgetscont(char *buf, int size, FILE *file, int *count)
 char *
 fgetslong(char **buf, int *bufsize, FILE *file, int *count)
 {
-  int dummy;
+  int dummy, len;
   if (!count)
     count = &dummy;
   if (!*bufsize) growbuffer(buf,bufsize);
   if (!fgetscont(*buf, *bufsize, file, count))
     return 0;
-  while ((*buf)[strlen(*buf)-1] != '\n' && !feof(file)){
+  len = strlen(*buf);
+  while ((*buf)[len-1] != '\n' && !feof(file)){
     growbuffer(buf, bufsize);
-    fgetscont(*buf+strlen(*buf), *bufsize-strlen(*buf), file, count);
+    fgetscont(*buf+len, *bufsize-len, file, count);
     (*count)--;
+    len += strlen(*buf+len);
   }  
   return *buf;
 }
@@ -239,6 +258,98 @@ mymalloc(int bytes,char *mesg)
 }
 
 
+/*
+   Arena for the memory used while a unit expression is parsed.  Memory
+   is taken from large blocks by bumping a pointer, and it is all given
+   back at once by arenarelease().  Blocks are kept for reuse, so once
+   the arena has grown to the size needed by a query, processing more
+   queries allocates nothing.  Releases must be made in the reverse
+   order of the matching calls to arenamark(), as when parseunit() is
+   reentered.  Each context has an arena of its own.
+*/
+
+#define ARENABLOCK 16384        /* Usual size of an arena block */
+#define ARENAALIGN 16           /* Alignment of memory from arenaalloc() */
+
+struct arenablock {
+   struct arenablock *next;
+   int size;                    /* Bytes available in the block */
+   int used;
+};
+
+#define BLOCKHEADER \
+   ((sizeof(struct arenablock) + ARENAALIGN - 1) & ~(ARENAALIGN - 1))
+
+/* Returns 'bytes' bytes from the arena of 'ctx', or null if there is
+   no memory. */
+
+void *
+arenaalloc(struct unitscontext *ctx, int bytes)
+{
+   struct arenablock *block, *cur;
+   char *pointer;
+   int size;
+
+   bytes = (bytes + ARENAALIGN - 1) & ~(ARENAALIGN - 1);
+   while (!(cur = ctx->curblock) || cur->used + bytes > cur->size){
+     block = cur ? cur->next : ctx->firstblock;
+     if (!block || block->size < bytes){    /* Insert a new block here */
+       size = bytes > ARENABLOCK ? bytes : ARENABLOCK;
+       block = (struct arenablock *) malloc(BLOCKHEADER + size);
+       if (!block)
+         return 0;
+       block->size = size;
+       block->next = cur ? cur->next : ctx->firstblock;
+       if (cur)
+         cur->next = block;
+       else
+         ctx->firstblock = block;
+     }
+     block->used = 0;
+     ctx->curblock = block;
+   }
+   pointer = (char *) cur + BLOCKHEADER + cur->used;
+   cur->used += bytes;
+   return pointer;
+}
+
+
+/* Copy a string into the arena.  Returns null if there is no memory. */
+
+char *
+arenastr(struct unitscontext *ctx, char *str, int len)
+{
+   char *copy;
+
+   if (!(copy = arenaalloc(ctx, len + 1)))
+     return 0;
+   memcpy(copy, str, len);
+   copy[len] = 0;
+   return copy;
+}
+
+
+/* Remember the state of the arena so it can be restored later */
+
+void
+arenamark(struct unitscontext *ctx, struct arenamark *mark)
+{
+   mark->block = ctx->curblock;
+   mark->used = ctx->curblock ? ctx->curblock->used : 0;
+}
+
+
+/* Release everything allocated from the arena since 'mark' was set */
+
+void
+arenarelease(struct unitscontext *ctx, struct arenamark *mark)
+{
+   ctx->curblock = mark->block;
+   if (ctx->curblock)
+     ctx->curblock->used = mark->used;
+}
+
+
 /* Duplicates a string */
 
 char *
@@ -252,16 +363,45 @@ dupstr(char *str)
 }
 
 
-/* hashing algorithm for units */
+/* Duplicates a string, or returns null if there is no memory */
+
+static char *
+trydupstr(char *str)
+{
+   char *ret;
+
+   if ((ret = malloc(strlen(str) + 1)))
+     strcpy(ret, str);
+   return ret;
+}
+
+
+/*
+   Unit definitions.  The units are kept in one array, in the order
+   they are defined, so that the programs which look at all of them
+   read consecutive memory.  A hash table finds them by name.  It uses
+   open addressing with linear probing in a table whose size is a power
+   of two.  Each slot holds the full hash of the name of its unit, so
+   names are compared only when the hashes match, and the index of the
+   unit in the array, which stays valid when the array grows.  The
+   table is doubled when it becomes more than UTABMAXLOAD full.
+*/
+
+#define UTABINIT 1024           /* Initial number of slots */
+#define UTABMAXLOAD 0.5         /* Largest fraction of slots in use */
+#define UNITSINIT 512           /* Initial size of the array of units */
+
+
+/* FNV-1a hash of a unit name */
 
 unsigned
 uhash(const char *str)
 {
    unsigned hashval;
 
-   for (hashval = 0; *str; str++)
-      hashval = *str + HASHNUMBER * hashval;
-   return (hashval % HASHSIZE);
+   for (hashval = 2166136261U; *str; str++)
+      hashval = (hashval ^ (unsigned char) *str) * 16777619U;
+   return hashval;
 }
 
 
@@ -269,59 +409,337 @@ uhash(const char *str)
    if the unit isn't found in the table. */
 
 struct unitlist *
-ulookup(const char *str)
+ulookup(struct unitsdata *db, const char *str)
 {
-   struct unitlist *uptr;
-
-   for (uptr = utab[uhash(str)]; uptr; uptr = uptr->next)
-      if (strcmp(str, uptr->name) == 0)
-	 return uptr;
+   struct unitslot *slot;
+   unsigned hashval, i;
+
+   if (!db->utabsize)
+      return NULL;
+   hashval = uhash(str);
+   for (i = hashval & (db->utabsize-1); (slot = db->utab+i)->unit; 
+        i = (i+1) & (db->utabsize-1))
+      if (slot->hash == hashval && 
+          strcmp(str, db->units[slot->unit-1].name) == 0)
+	 return db->units + slot->unit-1;
    return NULL;
 }
 
-/* Lookup a prefix in the prefix table.  Finds the first prefix that
-   matches the beginning of the input string.  Returns NULL if no
-   prefixes match. */
 
-struct prefixlist *
-plookup(const char *str)
+/* Put unit number 'unit' into the slot where ulookup() will find it */
+
+static void
+uplace(struct unitsdata *db, unsigned unit, unsigned hashval)
 {
-   struct prefixlist *prefix;
+   unsigned i, mask;
+
+   mask = db->utabsize-1;
+   for (i = hashval & mask; db->utab[i].unit; i = (i+1) & mask);
+   db->utab[i].hash = hashval;
+   db->utab[i].unit = unit;
+}
+
+
+/* Add a copy of 'unit' to the end of the array of units and to the
+   units table.  The unit must not be in the table already.  Returns 0,
+   or E_MEMORY if the array or the table cannot grow. */
 
-   for (prefix = ptab[prefixhash(str)]; prefix; prefix = prefix->next) {
-      if (!strncmp(str, prefix->name, prefix->len))
-	 return prefix;
+int
+uinsert(struct unitsdata *db, struct unitlist *unit)
+{
+   struct unitslot *oldtab;
+   struct unitlist *newunits;
+   unsigned oldsize, i;
+
+   if (db->unitcount == db->unitsize){
+      i = db->unitsize ? 2*db->unitsize : UNITSINIT;
+      newunits = (struct unitlist *) 
+         realloc(db->units, i*sizeof(struct unitlist));
+      if (!newunits)
+         return E_MEMORY;
+      db->units = newunits;
+      db->unitsize = i;
    }
-   return NULL;
+   if (db->unitcount+1 > UTABMAXLOAD*db->utabsize){
+      oldtab = db->utab;
+      oldsize = db->utabsize;
+      i = oldsize ? 2*oldsize : UTABINIT;
+      db->utab = (struct unitslot *) malloc(i*sizeof(struct unitslot));
+      if (!db->utab){
+         db->utab = oldtab;
+         return E_MEMORY;
+      }
+      db->utabsize = i;
+      memset(db->utab, 0, db->utabsize*sizeof(struct unitslot));
+      for (i = 0; i < oldsize; i++)
+         if (oldtab[i].unit)
+            uplace(db, oldtab[i].unit, oldtab[i].hash);
+      free(oldtab);
+   }
+   db->units[db->unitcount++] = *unit;
+   uplace(db, db->unitcount, uhash(unit->name));
+   return 0;
+}
+
+
+/* Print the load factor of the units table and the number of slots
+   that ulookup() examines to find each unit. */
+
+void
+ustats(struct unitsdata *db, FILE *out)
+{
+   unsigned i, probes, maxprobes, totalprobes, utabsize, utabcount;
+
+   utabsize = db->utabsize;
+   utabcount = db->unitcount;
+   maxprobes = totalprobes = 0;
+   for (i = 0; i < utabsize; i++)
+      if (db->utab[i].unit){
+         probes = ((i - db->utab[i].hash) & (utabsize-1)) + 1;
+         totalprobes += probes;
+         if (probes > maxprobes)
+            maxprobes = probes;
+      }
+   fprintf(out, 
+      "Units table: %u units in %u slots, load factor %.2f, "
+      "probe length %.2f average, %u longest\n",
+      utabcount, utabsize, utabsize ? (double) utabcount/utabsize : 0.0,
+      utabcount ? (double) totalprobes/utabcount : 0.0, maxprobes);
+}
+
+/*
+   Trie of prefix names.  Each node holds the character that leads to
+   it from its parent, the index of its first child and of its next
+   sibling, and the prefix whose name ends at the node, if there is
+   one.  The nodes are kept in one array and node 0 is the root.  The
+   prefixes are kept in another array in the order defined.
+*/
+
+#define PTRIEGROW 256           /* Nodes added when the trie is full */
+#define PREFIXGROW 64           /* Prefixes added when the array is full */
+
+struct prefixnode {
+   unsigned char ch;
+   int child;                   /* First child, or 0 if none */
+   int sibling;                 /* Next sibling, or 0 if none */
+   int prefix;                  /* 1 + index of the prefix, or 0 if none */
+};
+
+
+/* Returns the child of 'node' reached by 'ch', or 0 if there is none */
+
+static int
+pchild(struct prefixnode *ptrie, int node, unsigned char ch)
+{
+   for (node = ptrie[node].child; node; node = ptrie[node].sibling)
+      if (ptrie[node].ch == ch)
+         return node;
+   return 0;
+}
+
+
+/* Add a copy of 'prefix' to the end of the array of prefixes and to
+   the trie.  There must not already be a prefix with the same name.
+   Returns 0, or E_MEMORY if the array or the trie cannot grow. */
+
+int
+addprefix(struct unitsdata *db, struct prefixlist *prefix)
+{
+   struct prefixnode *ptrie, *newtrie;
+   struct prefixlist *newprefixes;
+   unsigned char *str;
+   int node, next;
+
+   if (db->prefixcount == db->prefixsize){
+      newprefixes = (struct prefixlist *) realloc(db->prefixes,
+                  (db->prefixsize+PREFIXGROW)*sizeof(struct prefixlist));
+      if (!newprefixes)
+         return E_MEMORY;
+      db->prefixes = newprefixes;
+      db->prefixsize += PREFIXGROW;
+   }
+
+   if (!db->ptriecount){
+      if (!db->ptrie){
+         db->ptrie = (struct prefixnode *) malloc(PTRIEGROW*sizeof(*ptrie));
+         if (!db->ptrie)
+            return E_MEMORY;
+         db->ptriesize = PTRIEGROW;
+      }
+      memset(db->ptrie, 0, sizeof(*ptrie));
+      db->ptriecount = 1;
+   }
+   ptrie = db->ptrie;
+   node = 0;
+   for (str = (unsigned char *) prefix->name; *str; str++, node = next)
+      if (!(next = pchild(ptrie, node, *str))){
+         if (db->ptriecount == db->ptriesize){
+            newtrie = (struct prefixnode *) realloc(ptrie, 
+                          (db->ptriesize+PTRIEGROW)*sizeof(*ptrie));
+            if (!newtrie)
+               return E_MEMORY;
+            db->ptrie = ptrie = newtrie;
+            db->ptriesize += PTRIEGROW;
+         }
+         next = db->ptriecount++;
+         ptrie[next].ch = *str;
+         ptrie[next].child = 0;
+         ptrie[next].prefix = 0;
+         ptrie[next].sibling = ptrie[node].child;
+         ptrie[node].child = next;
+      }
+   db->prefixes[db->prefixcount++] = *prefix;
+   ptrie[node].prefix = db->prefixcount;
+   return 0;
+}
+
+
+/* Empty the prefix table */
+
+void
+clearprefixes(struct unitsdata *db)
+{
+   db->ptriecount = 0;
+   db->prefixcount = 0;
+}
+
+
+/* Lookup a prefix in the prefix table.  Finds the longest prefix that
+   matches the beginning of the input string in a single pass over it.
+   Returns NULL if no prefixes match. */
+
+struct prefixlist *
+plookup(struct unitsdata *db, const char *str)
+{
+   int node, prefix;
+
+   prefix = 0;
+   if (!db->ptriecount)
+      return NULL;
+   for (node = 0; 
+        *str && (node = pchild(db->ptrie, node, (unsigned char) *str)); 
+        str++)
+      if (db->ptrie[node].prefix)
+         prefix = db->ptrie[node].prefix;
+   return prefix ? db->prefixes + prefix-1 : NULL;
+}
+
+/*
+   Hash table of functions and tables.  It works like the units table
+   (see ulookup()), but the slots also hold the length of each name so
+   that the lexer can look up a token that is not null terminated.  The
+   functions are also kept in a linked list in the order they were
+   defined, starting at firstfunc.
+*/
+
+#define FTABINIT 256            /* Initial number of slots */
+#define FTABMAXLOAD 0.5         /* Largest fraction of slots in use */
+
+struct funcslot {
+   unsigned hash;               /* fnhash() of the function name */
+   int length;                  /* Length of the function name */
+   struct func *func;           /* null if the slot is empty */
+};
+
+
+/* FNV-1a hash of the first 'length' characters of 'str' */
+
+static unsigned
+fnhash(const char *str, int length)
+{
+   unsigned hashval;
+
+   for (hashval = 2166136261U; length--; str++)
+      hashval = (hashval ^ (unsigned char) *str) * 16777619U;
+   return hashval;
 }
 
-/* Look up function in the function linked list */
+
+/* Look up function in the function table */
 
 struct func *
-fnlookup(const char *str, int length)
+fnlookup(struct unitsdata *db, const char *str, int length)
 { 
-  struct func *funcptr;
+  struct funcslot *slot;
+  unsigned hashval, i, mask;
 
-  for(funcptr=firstfunc;funcptr;funcptr = funcptr->next)
-    if (length==strlen(funcptr->name) && 
-	0==strncmp(funcptr->name,str,length))
-      return funcptr;
+  if (!db->ftabsize)
+    return 0;
+  hashval = fnhash(str, length);
+  mask = db->ftabsize-1;
+  for(i = hashval & mask; (slot = db->ftab+i)->func; i = (i+1) & mask)
+    if (slot->hash==hashval && slot->length==length && 
+	0==strncmp(slot->func->name,str,length))
+      return slot->func;
   return 0;
 }
 
-/* Insert a new function into the linked list of functions */
 
-void
-addfunction(struct func *newfunc)
+/* Put a function into the slot where fnlookup() will find it */
+
+static void
+fnplace(struct unitsdata *db, struct func *func, unsigned hashval, int length)
 {
-  if (!lastfunc){
-    firstfunc = newfunc;
-    lastfunc = firstfunc;
-  } else {
-    lastfunc->next = newfunc;
-    lastfunc = newfunc;
+  unsigned i, mask;
+
+  mask = db->ftabsize-1;
+  for(i = hashval & mask; db->ftab[i].func; i = (i+1) & mask);
+  db->ftab[i].hash = hashval;
+  db->ftab[i].length = length;
+  db->ftab[i].func = func;
+}
+
+
+/* Insert a new function into the function table and at the end of the
+   linked list of functions.  There must not already be a function with
+   the same name.  Returns 0, or E_MEMORY if the table cannot grow. */
+
+int
+addfunction(struct unitsdata *db, struct func *newfunc)
+{
+  struct funcslot *oldtab;
+  unsigned oldsize, i;
+  int length;
+
+  if (db->ftabcount+1 > FTABMAXLOAD*db->ftabsize){
+    oldtab = db->ftab;
+    oldsize = db->ftabsize;
+    i = oldsize ? 2*oldsize : FTABINIT;
+    db->ftab = (struct funcslot *) malloc(i*sizeof(struct funcslot));
+    if (!db->ftab){
+      db->ftab = oldtab;
+      return E_MEMORY;
+    }
+    db->ftabsize = i;
+    memset(db->ftab, 0, db->ftabsize*sizeof(struct funcslot));
+    for(i=0;i<oldsize;i++)
+      if (oldtab[i].func)
+        fnplace(db, oldtab[i].func, oldtab[i].hash, oldtab[i].length);
+    free(oldtab);
   }
+  length = strlen(newfunc->name);
+  fnplace(db, newfunc, fnhash(newfunc->name, length), length);
+  db->ftabcount++;
+
+  if (!db->lastfunc)
+    db->firstfunc = newfunc;
+  else
+    db->lastfunc->next = newfunc;
+  db->lastfunc = newfunc;
   newfunc->next = 0;
+  return 0;
+}
+
+
+/* Empty the function table */
+
+void
+clearfunctions(struct unitsdata *db)
+{
+  if (db->ftabsize)
+    memset(db->ftab, 0, db->ftabsize*sizeof(struct funcslot));
+  db->ftabcount = 0;
+  db->firstfunc = db->lastfunc = 0;
 }
 
 /* Remove leading and trailing white space from the input */
@@ -338,6 +756,24 @@ removepadding(char *in)
 }
 
 
+/* Returns the next word of the string at *str, ending it with a null,
+   and moves *str past it.  At the end of the string returns an empty
+   word.  Unlike strtok() it keeps no state between calls, so several
+   threads may read units files at once. */
+
+char *
+nextword(char **str)
+{
+  char *word;
+
+  word = *str + strspn(*str, WHITE);
+  *str = word + strcspn(word, WHITE);
+  if (**str)
+    *(*str)++ = 0;
+  return word;
+}
+
+
 /* 
    Checks whether the input string is a function name, possibly
    surrounded by white space.  Returns the function structure if one
@@ -345,10 +781,10 @@ removepadding(char *in)
 */
 
 struct func *
-isfunction(char *str)
+isfunction(struct unitscontext *ctx, char *str)
 {
   str = removepadding(str);
-  return fnlookup(str,strlen(str));
+  return fnlookup(ctx->db, str, strlen(str));
 }
 
 /* Print out error message encountered while reading the units file. */
@@ -362,84 +798,742 @@ readerror(FILE *errfile, int linenum, const char *filename)
 }
 
 
-/* 
-   Read in units data.  
+/*
+   Reads all of 'file' into a new buffer, which is null terminated, and
+   sets 'len' to its length.  Returns null if there is not enough
+   memory.
+*/
+
+static char *
+readwhole(FILE *file, int *len)
+{
+   char *text, *newtext;
+   int size, count;
+
+   size = 65536;
+   *len = 0;
+   if (!(text = malloc(size)))
+      return 0;
+   while ((count = fread(text+*len, 1, size-*len-1, file)) > 0){
+      *len += count;
+      if (*len == size-1){
+         if (!(newtext = realloc(text, 2*size))){
+            free(text);
+            return 0;
+         }
+         text = newtext;
+         size *= 2;
+      }
+   }
+   text[*len] = 0;
+   return text;
+}
+
+
+#ifdef MMAP
+/*
+   Maps all of 'file' into memory and sets 'len' to its length.  The
+   mapping is private, so readunits() can null terminate the lines in
+   place without changing the file, and only the pages it writes are
+   copied.  Returns null if the file cannot be mapped or if it does not
+   end with a newline, which leaves no room for the last null.
+*/
+
+static char *
+mapwhole(FILE *file, int *len)
+{
+   struct stat filestat;
+   char *text;
+
+   if (fstat(fileno(file), &filestat) || !S_ISREG(filestat.st_mode)
+       || filestat.st_size < 1 || filestat.st_size > INT_MAX)
+      return 0;
+   text = mmap(0, filestat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+               fileno(file), 0);
+   if (text == MAP_FAILED)
+      return 0;
+   if (text[filestat.st_size-1] != '\n'){
+      munmap(text, filestat.st_size);
+      return 0;
+   }
+   *len = filestat.st_size;
+   return text;
+}
+#endif
 
-   file - Filename to load
-   errfile - File to receive messages about errors in the units database.  
-             Set it to 0 to suppress errors. 
-   unitcount, prefixcount, funccount - Return statistics to the caller.  
-                                       Must initialize to zero before calling.
-   depth - Used to prevent recursive includes.  Call with it set to zero.
 
+/* Frees memory recorded with keepblock() */
 
-   The global variable progname is used in error messages.  
+static void
+releaseblock(void *data, size_t maplen)
+{
+#ifdef MMAP
+   if (maplen){
+      munmap(data, maplen);
+      return;
+   }
+#endif
+   free(data);
+}
+
+
+/*
+   Records that the tables of 'db' point into 'data', which was mapped
+   with mmap() if 'maplen' is not zero and allocated with malloc()
+   otherwise, so that freedatabase() frees it.  Returns 0, or E_MEMORY
+   if there is not enough memory to record it, in which case 'data' is
+   freed at once.
 */
 
 int
-readunits(char *file, FILE *errfile, 
-          int *unitcount, int *prefixcount, int *funccount, int depth)
+keepblock(struct unitsdata *db, void *data, size_t maplen)
 {
-   struct prefixlist *pfxptr;
-   struct unitlist *uptr;
-   FILE *unitfile;
-   char *line, *lineptr, *unitdef, *unitname, *permfile;
-   int len, linenum, linebufsize, goterr;
-   unsigned hashval, pval;
-   int locunitcount, locprefixcount, locfunccount;
-   struct func *funcentry;
-   int wronglocale = 0;   /* If set then we are currently reading data */
-   int inlocale = 0;      /* for the wrong locale so we should skip it */
-   locunitcount = 0;
-   locprefixcount = 0;
-   locfunccount  = 0;
-   linenum = 0;
-   linebufsize = 0;
-   goterr = 0;
+   struct dbblock *block;
 
-   growbuffer(&line,&linebufsize);
+   if (!(block = (struct dbblock *) malloc(sizeof(struct dbblock)))){
+      releaseblock(data, maplen);
+      return E_MEMORY;
+   }
+   block->data = data;
+   block->maplen = maplen;
+   block->next = db->blocks;
+   db->blocks = block;
+   return 0;
+}
 
-   permfile = dupstr(file);                 /* This is a permanent copy to 
-                                               reference in the database.
-                                               It is never freed. */
-   unitfile = fopen(file, "rt");
-   if (!unitfile) 
-     return E_FILE;
-   while (!feof(unitfile)) {
-      if (!fgetslong(&line, &linebufsize, unitfile, &linenum)) 
-        break;
-      if (*line == COMMANDCHAR) {         /* Process units.dat commands    */
-        unitname = strtok(line+1, WHITE);
-	if (!strcmp(unitname,"locale")){ 
-	  unitname = strtok(0, WHITE); 
-	  if (!*unitname) {
-	    if (errfile)
-	      fprintf(errfile, 
-		      "%s: no locale specified on line %d of '%s'\n",
-		      progname, linenum, file);
-	    goterr=1;
-	  } else if (inlocale){
-	    if (errfile)
-	      fprintf(errfile,
-		      "%s: nested locales not allowed, line %d of '%s'\n",
-		      progname, linenum, file);
-	    goterr=1;
-	  } else {
-	    inlocale = 1;
-	    if (strcmp(unitname,mylocale))  /* locales don't match           */
-	      wronglocale = 1;
-	  }
-	  continue;
-	} 
-	else if (!strcmp(unitname, "endlocale")){
-	  if (!inlocale){
-	    if (errfile)
-	      fprintf(errfile, 
-		      "%s: unmatched !endlocale on line %d of '%s'\n",
-		      progname, linenum, file);
-	    goterr=1;
-	  }
-	  wronglocale = 0;
+
+/*
+   Returns the next line of 'text', which readunits() reads whole, and
+   sets 'next' to the line after it.  The text ends at 'last'.  Lines
+   ending with a backslash are joined to the following line, as by
+   fgetscont(), and the line is null terminated in place.  Adds the
+   number of lines read to 'count'.  Returns null at the end of the
+   text.  The newlines are found with memchr(), which is much faster
+   than reading the text a character at a time.
+*/
+
+static char *
+nextrecord(char **next, char *last, int *count)
+{
+   char *start, *from, *to, *end;
+   int len;
+
+   start = from = to = *next;
+   if (start >= last)
+      return 0;
+   for(;;){
+      (*count)++;
+      if (!(end = memchr(from, '\n', last-from)))
+         end = last;
+      len = end - from;
+      if (end<last && len && from[len-1]=='\\'){  /* Continued on next line */
+         if (to != from)
+            memmove(to, from, len-1);
+         to += len-1;
+         from = end+1;
+         continue;
+      }
+      if (to != from)
+         memmove(to, from, len);
+      to += len;
+      *next = end<last ? end+1 : end;
+      *to = 0;
+      return start;
+   }
+}
+
+
+/* Returns the value of a unit, which readunits() leaves untrimmed in
+   a database read lazily until it is first wanted. */
+
+char *
+unitdef(struct unitlist *uptr)
+{
+   if (!uptr->value){
+      uptr->value = removepadding(uptr->source);
+      uptr->source = 0;
+   }
+   return uptr->value;
+}
+
+
+/*
+   Reads the points of a table from 'text'.  On success sets the table
+   and its length in 'func' and returns 0.  Otherwise returns E_BADFILE
+   after writing a message to 'errfile', if it is not null, or E_MEMORY.
+*/
+
+int
+readtable(struct func *func, char *text, FILE *errfile)
+{
+   struct pair *tab, *newtab;
+   int tablealloc, tabpt;
+   char *start, *end;
+
+   tab = (struct pair *)malloc(sizeof(struct pair)*20);
+   if (!tab)
+     return E_MEMORY;
+   tablealloc=20;
+   tabpt = 0;
+   start = text;
+   while (1) {
+     if (tabpt>=tablealloc){
+       tablealloc+=20;
+       newtab = (struct pair *)realloc(tab,sizeof(struct pair)*tablealloc);
+       if (!newtab){
+         free(tab);
+         return E_MEMORY;
+       }
+       tab = newtab;
+     }
+     tab[tabpt].location = strtod(start,&end);
+     if (start==end)
+       break;
+     if (tabpt>0 && tab[tabpt].location<=tab[tabpt-1].location){
+       if (errfile)
+         fprintf(errfile,"%s: points don't increase (%.8g to %.8g) in units file '%s' line %d\n",
+               progname, tab[tabpt-1].location, tab[tabpt].location,
+               func->file, func->linenumber);
+       free(tab);
+       return E_BADFILE;
+     }
+     start=end+strspn(end," \t");
+     tab[tabpt].value = strtod(start,&end);
+     if (start==end){
+       if (errfile)
+         fprintf(errfile,"%s: missing value after %.8g in units file '%s' line %d\n",
+               progname, tab[tabpt].location, func->file, func->linenumber);
+       free(tab);
+       return E_BADFILE;
+     }
+     tabpt++;
+     start=end+strspn(end," \t,");
+   }
+   func->tablelen = tabpt;
+   func->table = tab;
+   return 0;
+}
+
+
+/*
+   Units files are read in two passes.  The first pass splits the text
+   of each file into chunks of whole lines and parses the lines of
+   each chunk into a list of records, making the table entries for
+   them.  The chunks do not depend on each other or on the tables, so
+   they are parsed by several threads at once (see parsechunks()).
+   The second pass goes through the records of each file in order in
+   one thread.  It carries out the commands, skips the lines for other
+   locales, reports redefinitions and adds the entries to the tables,
+   so the tables and the messages are the same as when the lines are
+   read one by one.
+*/
+
+#define LOADCHUNK 65536         /* Least size of a chunk of a units file */
+
+#define LOAD_COMMAND 0          /* Line starting with COMMANDCHAR */
+#define LOAD_ERROR 1            /* Line with an error */
+#define LOAD_PREFIX 2
+#define LOAD_TABLE 3
+#define LOAD_FUNCTION 4
+#define LOAD_UNIT 5
+
+#define LINE_BADLINE 1          /* Errors found by parseline(), reported */
+#define LINE_DIGIT 2            /*    by lineerror() */
+#define LINE_TABLEDIGIT 3
+#define LINE_ENDDIGIT 4
+#define LINE_TABLEEND 5
+#define LINE_FUNCEND 6
+#define LINE_DIMENEND 7
+
+struct loadline {
+  int type;
+  int linenum;
+  char *text;           /* The command, or the name being defined */
+  union {               /* The new entry, copied into the tables by */
+    struct prefixlist prefix;   /*    the second pass */
+    struct unitlist unit;
+    struct func *func;
+  } entry;
+  int error;            /* Error to report unless the name is redefined */
+};
+
+struct loadchunk {
+  char *start, *last;   /* Text of the chunk, ending with a whole line */
+  int linenum;          /* Number of the line before the chunk */
+  char *permfile;       /* Name of the file kept in the tables */
+  struct loadline *lines;
+  int count, size;
+  int nomemory;         /* Set if the chunk could not all be parsed */
+};
+
+struct loadfile {
+  int err;              /* E_FILE or E_MEMORY if the file was not read */
+  int openerr;          /* Value of errno if the file could not be opened */
+  int builtin;          /* Set for the database built into units */
+  struct loadchunk *chunks;
+  int chunkcount;
+};
+
+struct loadjob {
+  struct loadchunk **chunks;
+  int count;
+  int next;             /* Next chunk to be parsed by a thread */
+  int lazy;
+#ifdef PTHREADS
+  pthread_mutex_t lock;
+#endif
+};
+
+
+/* Adds a record to the end of 'chunk' and returns it for the caller to
+   fill in its entry.  Returns null if there is not enough memory. */
+
+static struct loadline *
+addline(struct loadchunk *chunk, int type, int linenum, char *text,
+        int error)
+{
+  struct loadline *newlines, *record;
+
+  if (chunk->count==chunk->size){
+    newlines = (struct loadline *)
+      realloc(chunk->lines, (2*chunk->size+64)*sizeof(struct loadline));
+    if (!newlines)
+      return 0;
+    chunk->lines = newlines;
+    chunk->size = 2*chunk->size+64;
+  }
+  record = chunk->lines + chunk->count++;
+  record->type = type;
+  record->linenum = linenum;
+  record->text = text;
+  record->entry.func = 0;
+  record->error = error;
+  return record;
+}
+
+
+/* Adds a record for a line with an error to 'chunk'.  Returns 0, or
+   E_MEMORY if there is not enough memory. */
+
+static int
+badline(struct loadchunk *chunk, int linenum, char *name, int error)
+{
+  return addline(chunk, LOAD_ERROR, linenum, name, error) ? 0 : E_MEMORY;
+}
+
+
+/* Writes the message for a line with an error found by parseline() */
+
+static void
+lineerror(FILE *errfile, struct loadline *record, char *file)
+{
+  if (!errfile)
+    return;
+  switch(record->error){
+    case LINE_BADLINE:
+      readerror(errfile, record->linenum, file);
+      break;
+    case LINE_DIGIT:
+      fprintf(errfile,
+         "%s: unit '%s' on line %d of '%s' ignored.  It starts with a digit\n",
+         progname, record->text, record->linenum, file);
+      break;
+    case LINE_TABLEDIGIT:
+      fprintf(errfile,
+         "%s: unit '%s' on line %d ignored.  It starts with a digit\n",
+         progname, record->text, record->linenum);
+      break;
+    case LINE_ENDDIGIT:
+      fprintf(errfile,
+         "%s: unit '%s' on line %d of '%s' ignored.  It ends with a nonzero digit\n",
+         progname, record->text, record->linenum, file);
+      break;
+    case LINE_TABLEEND:
+      fprintf(errfile,"%s: missing ']' in units file '%s' line %d\n",
+              progname, file, record->linenum);
+      break;
+    case LINE_FUNCEND:
+      fprintf(errfile,
+              "%s: bad function definition of '%s' in '%s' line %d\n",
+              progname, record->text, file, record->linenum);
+      break;
+    case LINE_DIMENEND:
+      fprintf(errfile,
+              "%s: expecting ']' in definition of '%s' in '%s' line %d\n",
+              progname, record->text, file, record->linenum);
+      break;
+  }
+}
+
+
+/*
+   Parses line 'linenum' of a units file for the first pass and adds a
+   record for it to 'chunk'.  Anything that depends on the lines before
+   it, or on the tables, is left for the second pass.  Returns 0, or
+   E_MEMORY if there is not enough memory.
+*/
+
+static int
+parseline(struct loadchunk *chunk, char *line, int linenum, int lazy)
+{
+   struct loadline *record;
+   struct prefixlist *pfxptr;
+   struct unitlist *uptr;
+   struct func *funcentry;
+   char *lineptr, *unitname, *unitdef, *start, *end, *inv;
+   int len;
+
+   if (*line == COMMANDCHAR)          /* Carried out in the second pass */
+     return addline(chunk, LOAD_COMMAND, linenum, line, 0) ? 0 : E_MEMORY;
+   if ((lineptr = strchr(line,COMMENTCHAR)))
+     *lineptr = 0;
+   unitname = line + strspn(line, WHITE);
+   if (!*unitname)
+     return 0;
+   unitdef = unitname + strcspn(unitname, WHITE);
+   if (*unitdef)
+     *unitdef++ = 0;
+   if (lazy)                  /* Units are trimmed by unitdef() */
+     unitdef += strspn(unitdef, WHITE);
+   else
+     unitdef = removepadding(unitdef);
+   if (!*unitdef)
+     return badline(chunk, linenum, 0, LINE_BADLINE);
+
+   len = strlen(unitname);
+
+   if (unitname[len - 1] == '-') {	/* it's a prefix definition */
+     unitname[len - 1] = 0;
+     if (strchr("0123456789.", unitname[0]))
+       return badline(chunk, linenum, unitname, LINE_DIGIT);
+     if (!(record = addline(chunk, LOAD_PREFIX, linenum, unitname, 0)))
+       return E_MEMORY;
+     pfxptr = &record->entry.prefix;
+     pfxptr->name = unitname;
+     pfxptr->len = len - 1;
+     pfxptr->value = removepadding(unitdef);
+     pfxptr->linenumber = linenum;
+     pfxptr->file = chunk->permfile;
+     return 0;
+   } else if (strchr(unitname,'[')){ /* table definition  */
+     start = strchr(unitname,'[');
+     end = strchr(unitname,']');
+     *start++=0;
+     if (strchr("0123456789.", unitname[0]))
+       return badline(chunk, linenum, unitname, LINE_TABLEDIGIT);
+     if (!end || strlen(end)>1)
+       return badline(chunk, linenum, unitname, LINE_TABLEEND);
+     *end=0;
+     funcentry = (struct func *)malloc(sizeof(struct func));
+     if (!funcentry)
+       return E_MEMORY;
+     funcentry->name = unitname;
+     funcentry->tableunit = start;
+     funcentry->linenumber = linenum;
+     funcentry->file = chunk->permfile;
+     funcentry->table = 0;
+     funcentry->tablelen = 0;
+     funcentry->tabledef = unitdef;   /* Points are read in the second */
+                                      /* pass */
+     if (!(record = addline(chunk, LOAD_TABLE, linenum, unitname, 0))){
+       free(funcentry);
+       return E_MEMORY;
+     }
+     record->entry.func = funcentry;
+     return 0;
+   } else if (strchr(unitname,'(')){ /* function definition */
+     start = strchr(unitname,'(');
+     end = strchr(unitname,')');
+     *start++ = 0;
+     if (strchr("0123456789.", unitname[0]))
+       return badline(chunk, linenum, unitname, LINE_DIGIT);
+     if (!end || strlen(end)>1)
+       return badline(chunk, linenum, unitname, LINE_FUNCEND);
+     *end=0;
+     funcentry = (struct func*)malloc(sizeof(struct func));
+     if (!funcentry)
+       return E_MEMORY;
+     funcentry->forward.dimen = 0;
+     funcentry->inverse.dimen = 0;
+     if (*unitdef=='['){  /* found dimension spec [input;inverse input] */
+       unitdef++;
+       inv = strchr(unitdef,';');
+       end = strchr(unitdef,']');
+       if (inv)
+         *inv++=0;
+       if (!end || (inv && (end-inv<0))){
+         free(funcentry);
+         return addline(chunk, LOAD_FUNCTION, linenum, unitname,
+                        LINE_DIMENEND) ? 0 : E_MEMORY;
+       }
+       *end=0;
+       funcentry->forward.dimen = removepadding(unitdef);
+       if (inv)
+         funcentry->inverse.dimen = removepadding(inv);
+       unitdef = end+1;
+     }
+     inv = strchr(unitdef,';');
+     if (inv)
+       *inv++ = 0;
+     funcentry->name = unitname;
+     funcentry->forward.param = start;
+     funcentry->table = 0;
+     funcentry->tabledef = 0;
+     funcentry->forward.def = removepadding(unitdef);
+     if (inv){
+       funcentry->inverse.def = removepadding(inv);
+       funcentry->inverse.param = unitname;
+     }
+     else
+       funcentry->inverse.def = 0;
+     funcentry->linenumber = linenum;
+     funcentry->file = chunk->permfile;
+     if (!(record = addline(chunk, LOAD_FUNCTION, linenum, unitname, 0))){
+       free(funcentry);
+       return E_MEMORY;
+     }
+     record->entry.func = funcentry;
+     return 0;
+   } else {	/* it is a unit definition */
+
+     /* Units that end in [2-9] can never be accessed */
+
+     if (strchr("23456789", unitname[len-1]))
+       return badline(chunk, linenum, unitname, LINE_ENDDIGIT);
+     if (strchr("0123456789.", unitname[0]))
+       return badline(chunk, linenum, unitname, LINE_DIGIT);
+     if (!(record = addline(chunk, LOAD_UNIT, linenum, unitname, 0)))
+       return E_MEMORY;
+     uptr = &record->entry.unit;
+     uptr->name = unitname;
+     uptr->source = 0;
+     uptr->reduced = 0;
+     if (!lazy)
+       uptr->value = unitdef;
+     else if (strchr(unitdef, PRIMITIVECHAR))   /* addsymbol() needs it */
+       uptr->value = removepadding(unitdef);
+     else {
+       uptr->value = 0;
+       uptr->source = unitdef;
+     }
+     uptr->linenumber = linenum;
+     uptr->file = chunk->permfile;
+     return 0;
+   }
+}
+
+
+/* Parses the chunks of 'job' until there are none left.  It is run
+   by each of the threads started by parsechunks(). */
+
+static void *
+parseworker(void *arg)
+{
+  struct loadjob *job = (struct loadjob *) arg;
+  struct loadchunk *chunk;
+  char *text, *line;
+  int i, linenum;
+
+  for(;;){
+#ifdef PTHREADS
+    pthread_mutex_lock(&job->lock);
+#endif
+    i = job->next++;
+#ifdef PTHREADS
+    pthread_mutex_unlock(&job->lock);
+#endif
+    if (i>=job->count)
+      break;
+    chunk = job->chunks[i];
+    text = chunk->start;
+    linenum = chunk->linenum;
+    while ((line = nextrecord(&text, chunk->last, &linenum)))
+      if (parseline(chunk, line, linenum, job->lazy)){
+        chunk->nomemory = 1;
+        break;
+      }
+  }
+  return 0;
+}
+
+
+/* Parses the chunks of 'job', sharing them among 'threads' threads, or
+   one per processor if 'threads' is zero. */
+
+static void
+parsechunks(struct loadjob *job, int threads)
+{
+#ifdef PTHREADS
+  pthread_t *tid = 0;
+  int i, started;
+
+  if (threads<=0){
+    threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads<=0)
+      threads = 1;
+  }
+  if (threads>job->count)
+    threads = job->count;
+  pthread_mutex_init(&job->lock, 0);
+  started = 1;
+  if (threads>1 && (tid = (pthread_t *) malloc(threads*sizeof(pthread_t))))
+    for(;started<threads;started++)
+      if (pthread_create(tid+started, 0, parseworker, job))
+        break;
+  parseworker(job);
+  if (started>1){
+    for(i=1;i<started;i++)
+      pthread_join(tid[i], 0);
+    free(tid);
+  }
+  pthread_mutex_destroy(&job->lock);
+#else
+  parseworker(job);
+#endif
+}
+
+
+/*
+   Reads the file named 'file' into memory for the first pass and
+   divides it into chunks of at least LOADCHUNK bytes, or into a single
+   chunk if it is smaller.  A chunk only ends after a newline that does
+   not continue the line.  Sets load->err to E_FILE if the file cannot
+   be opened or to E_MEMORY if there is not enough memory.
+*/
+
+static void
+splitfile(struct unitsdata *db, struct loadfile *load, char *file)
+{
+  FILE *unitfile;
+  struct loadchunk *chunk;
+  char *text, *last, *end, *permfile;
+  int textlen, count, linenum, i;
+  size_t maplen;
+
+  memset(load, 0, sizeof(*load));
+  unitfile = fopen(file, "rt");
+  if (!unitfile){
+    load->err = E_FILE;
+    load->openerr = errno;
+    return;
+  }
+  text = 0;
+  maplen = 0;
+#ifdef MMAP
+  if ((text = mapwhole(unitfile, &textlen)))
+    maplen = textlen;
+#endif
+  if (!text)
+    text = readwhole(unitfile, &textlen);
+  fclose(unitfile);
+  if (!text || keepblock(db, text, maplen)){   /* Kept with the database */
+    load->err = E_MEMORY;
+    return;
+  }
+  permfile = trydupstr(file);              /* This is a permanent copy to
+                                              reference in the database */
+  if (!permfile || keepblock(db, permfile, 0)){
+    load->err = E_MEMORY;
+    return;
+  }
+  count = textlen/LOADCHUNK;
+  if (!count)
+    count = 1;
+  load->chunks = (struct loadchunk *) malloc(count*sizeof(struct loadchunk));
+  if (!load->chunks){
+    load->err = E_MEMORY;
+    return;
+  }
+  memset(load->chunks, 0, count*sizeof(struct loadchunk));
+  last = text + textlen;
+  linenum = 0;
+  for(i=0;i<count && text<last;i++){
+    chunk = load->chunks + i;
+    chunk->start = text;
+    chunk->linenum = linenum;
+    chunk->permfile = permfile;
+    end = i==count-1 ? last : chunk->start + textlen/count;
+    while (end<last && (end = memchr(end, '\n', last-end)) && end[-1]=='\\')
+      end++;
+    chunk->last = end && end<last ? end+1 : last;
+    for(;text<chunk->last && (text = memchr(text, '\n', chunk->last-text));
+        text++)
+      linenum++;
+    text = chunk->last;
+    load->chunkcount++;
+  }
+}
+
+
+/*
+   Adds the records made by the first pass for the file 'file' to the
+   tables in 'db', in order.  The arguments and the return value are
+   the same as for readunits().
+*/
+
+static int
+addfile(struct unitsdata *db, struct loadfile *load, char *file,
+        FILE *errfile, int *unitcount, int *prefixcount, int *funccount,
+        int depth)
+{
+   struct prefixlist *oldprefix;
+   struct unitlist *uptr;
+   struct func *funcentry;
+   struct loadline *record;
+   char *unitname, *command;
+   int linenum, goterr, i, j, tableerr;
+   int locunitcount, locprefixcount, locfunccount;
+   int wronglocale = 0;   /* If set then we are currently reading data */
+   int inlocale = 0;      /* for the wrong locale so we should skip it */
+   locunitcount = 0;
+   locprefixcount = 0;
+   locfunccount  = 0;
+   goterr = 0;
+
+   for(i=0;i<load->chunkcount;i++)
+     if (load->chunks[i].nomemory)
+       goto nomemory;
+   if (dbnotefile(db, file))
+     goto nomemory;
+   for(i=0;i<load->chunkcount;i++)
+    for(j=0;j<load->chunks[i].count;j++){
+      record = load->chunks[i].lines + j;
+      linenum = record->linenum;
+      if (record->type == LOAD_COMMAND) {  /* Process units.dat commands */
+        command = record->text+1;
+        unitname = nextword(&command);
+	if (!strcmp(unitname,"locale")){
+	  unitname = nextword(&command);
+	  if (!*unitname) {
+	    if (errfile)
+	      fprintf(errfile,
+		      "%s: no locale specified on line %d of '%s'\n",
+		      progname, linenum, file);
+	    goterr=1;
+	  } else if (inlocale){
+	    if (errfile)
+	      fprintf(errfile,
+		      "%s: nested locales not allowed, line %d of '%s'\n",
+		      progname, linenum, file);
+	    goterr=1;
+	  } else {
+	    inlocale = 1;
+	    if (dbnotelocale(db, unitname))
+	      goto nomemory;
+	    if (strcmp(unitname,mylocale))  /* locales don't match           */
+	      wronglocale = 1;
+	  }
+	  continue;
+	}
+	else if (!strcmp(unitname, "endlocale")){
+	  if (!inlocale){
+	    if (errfile)
+	      fprintf(errfile,
+		      "%s: unmatched !endlocale on line %d of '%s'\n",
+		      progname, linenum, file);
+	    goterr=1;
+	  }
+	  wronglocale = 0;
 	  inlocale = 0;
 	  continue;
 	}
@@ -448,15 +1542,22 @@ readunits(char *file, FILE *errfile,
         if (!strcmp(unitname, "include")){
           if (depth>MAXINCLUDE){
 	    if (errfile)
-	      fprintf(errfile, 
+	      fprintf(errfile,
 		      "%s: max include depth of %d exceeded in file '%s' line %d\n",
 		      progname, MAXINCLUDE, file, linenum);
 	    goterr=1;
 	  } else {
 	    int readerr;
 	    char *includefile;
-	    unitname = strtok(0, WHITE); 
-	    includefile = mymalloc(strlen(file)+strlen(unitname)+1, "(readunits)");
+	    unitname = nextword(&command);
+	    if (!*unitname){
+	      readerror(errfile,linenum,file);
+	      goterr=1;
+	      continue;
+	    }
+	    includefile = malloc(strlen(file)+strlen(unitname)+1);
+	    if (!includefile)
+	      goto nomemory;
             if (strchr(unitname, '/') || strchr(unitname, '\\'))
 	      strcpy(includefile,unitname);
 	    else {
@@ -469,15 +1570,17 @@ readunits(char *file, FILE *errfile,
 		pathend++;
 	      strcpy(pathend, unitname);
 	    }
-	    readerr = readunits(includefile, errfile, unitcount, prefixcount, 
-				funccount, depth+1);
-	    if (readerr == E_MEMORY) 
+	    readerr = readunits(db, includefile, errfile, unitcount,
+				prefixcount, funccount, depth+1);
+	    if (readerr == E_MEMORY || readerr == E_PRIMITIVES){
+	      free(includefile);
 	      return readerr;
+	    }
 	    if (readerr == E_FILE) {
 	      if (errfile)
 		fprintf(errfile, "%s: unable to open included file '%s' at line %d of file '%s\n", progname, includefile, linenum, file);
 	    }
-	    
+
 	    if (readerr)
 	      goterr = 1;
 	    free(includefile);
@@ -487,303 +1590,277 @@ readunits(char *file, FILE *errfile,
 	  goterr=1;
 	}
 	continue;
-      }	
-      if (wronglocale)
-	continue;
-      if ((lineptr = strchr(line,COMMENTCHAR)))
-         *lineptr = 0;
-      unitname = strtok(line, WHITE);
-      if (!unitname || !*unitname) 
-	continue;
-      unitdef = strtok(NULL, "\n");
-      if (!unitdef){
-        readerror(errfile,linenum,file);
-	goterr=1;
-        continue;
       }
-      unitdef = removepadding(unitdef);
-      if (!*unitdef){ 
-        readerror(errfile,linenum,file);
-	goterr=1;
-        continue;
+      if (wronglocale){
+        if (record->type==LOAD_TABLE || record->type==LOAD_FUNCTION)
+          free(record->entry.func);
+	continue;
       }
-      
-      len = strlen(unitname);      
-
-      if (unitname[len - 1] == '-') {	/* it's a prefix definition */
-         unitname[len - 1] = 0;
-	 if (strchr("0123456789.", unitname[0])){
-	   if (errfile)
-	     fprintf(errfile,
-	     "%s: unit '%s' on line %d of '%s' ignored.  It starts with a digit\n", 
-	     progname, unitname, linenum, file);
-  	     goterr=1;
-	     continue;
-	 }
-	 if ((pfxptr = plookup(unitname))) {  /* already there: redefinition */
- 	    goterr=1;
-            if (errfile) {
-	      if (!strcmp(pfxptr->name, unitname))
-		fprintf(errfile,
+      unitname = record->text;
+      switch(record->type){
+        case LOAD_ERROR:
+          lineerror(errfile, record, file);
+          goterr=1;
+          break;
+        case LOAD_PREFIX:
+	  if ((oldprefix = plookup(db, unitname)) &&
+              !strcmp(oldprefix->name, unitname)) {  /* redefinition */
+            goterr=1;
+            if (errfile)
+	      fprintf(errfile,
    	        "%s: redefinition of prefix '%s-' on line %d of '%s' ignored.\n",
 		       progname, unitname, linenum, file);
-	      else
-	         fprintf(errfile, "%s: prefix '%s-' on line %d of '%s' is hidden by earlier definition of '%s-'.\n",
-		       progname, unitname, linenum, file, pfxptr->name);
-            }
-	    continue;
-	 } 
+	    break;
+	  }
+	  /* Install prefix name/len/value in table.  plookup() finds the
+             longest matching prefix, so prefixes may be in any order. */
 
-         /* Make new prefix table entry */
-         
-         pfxptr = (struct prefixlist *) mymalloc(sizeof(*pfxptr),"(readunits)");
-	 pfxptr->name = dupstr(unitname);
-	 pfxptr->len = len - 1;
-	 pfxptr->value = dupstr(unitdef);
-         pfxptr->linenumber = linenum;
-	 pfxptr->file = permfile;
-	 /*
-	    Install prefix name/len/value in list
-	    Order is FIFO, so a prefix that is a substring of another
-	    prefix must follow the longer prefix in the units file
-	    (e.g, 'k' must come after 'kilo') or it will not be found
-	    by plookup().
-	  */
-
-	 pfxptr->next = NULL;
-	 pval = prefixhash(pfxptr->name);
-	 if (ptab[pval] == NULL)
-	    ptab[pval] = pfxptr;
-	 else
-	    ptab[pval]->last->next = pfxptr;
-	 ptab[pval]->last = pfxptr;
-	 locprefixcount++;
-      } else if (strchr(unitname,'[')){ /* table definition  */
-	char *start, *end;
-	int tablealloc, tabpt;
-        struct pair *tab;
-	int tableerr;
-
-	tableerr=0;
-	start  = strchr(unitname,'[');
-	end = strchr(unitname,']');
-	*start++=0;
-	if (strchr("0123456789.", unitname[0])){
-	  if (errfile)
-	    fprintf(errfile,
-            "%s: unit '%s' on line %d ignored.  It starts with a digit\n", 
-		     progname, unitname, linenum);
-	  goterr=1;
-	  continue;
-	}
-	if (!end || strlen(end)>1){
-	  if (errfile)
- 	    fprintf(errfile,"%s: missing ']' in units file '%s' line %d\n",
-		    progname,file,linenum);
-	  goterr=1;
-	  continue;
-	} 
-        if (fnlookup(unitname,strlen(unitname))){
-	  if (errfile)
-	    fprintf(errfile,
+	  if (addprefix(db, &record->entry.prefix))
+	    goto nomemory;
+	  locprefixcount++;
+          break;
+        case LOAD_TABLE:
+          funcentry = record->entry.func;
+          if (fnlookup(db, unitname, strlen(unitname))){
+	    if (errfile)
+	      fprintf(errfile,
 		  "%s: redefinition of unit '%s' on line %d of file '%s' ignored\n",
 		  progname, unitname, linenum, file);
-	  goterr=1;
-	  continue;
-	}
-	*end=0;
-	funcentry = (struct func *)mymalloc(sizeof(struct func),"(readunits)");
-	funcentry->name = dupstr(unitname);
-	funcentry->tableunit = dupstr(start);
-        tab = (struct pair *)mymalloc(sizeof(struct pair)*20, "(readunits)");
-        tablealloc=20;
-        tabpt = 0;
-	start = unitdef;
-	while (1) {
-	  if (tabpt>=tablealloc){
-	    tablealloc+=20;
-	    tab = (struct pair *)realloc(tab,sizeof(struct pair)*tablealloc);
-	    if (!tab){
-	      if (errfile)
-	        fprintf(errfile, "%s: memory allocation error (readunits)\n",
-		        progname);  
-	      return E_MEMORY;
-	    }
-	  }
-	  tab[tabpt].location = strtod(start,&end);
-	  if (start==end)
+	    goterr=1;
+            free(funcentry);
 	    break;
-	  if (tabpt>0 && tab[tabpt].location<=tab[tabpt-1].location){
+	  }
+          /* The points are read even when db->lazy is set, so that a
+             table with bad points is never defined */
+
+          tableerr = readtable(funcentry, funcentry->tabledef, errfile);
+          if (!tableerr)
+            tableerr = keepblock(db, funcentry->table, 0);
+          if (tableerr==E_MEMORY){
+            free(funcentry);
+	    goto nomemory;
+          }
+          funcentry->tabledef = 0;
+	  if (tableerr){
+	    free(funcentry);
+	    goterr=1;
+	  } else {
+	    locfunccount++;
+	    if (keepblock(db, funcentry, 0) || addfunction(db, funcentry))
+	      goto nomemory;
+	  }
+          break;
+        case LOAD_FUNCTION:
+          funcentry = record->entry.func;
+	  if (fnlookup(db, unitname, strlen(unitname))){
 	    if (errfile)
-  	      fprintf(errfile,"%s: points don't increase (%.8g to %.8g) in units file '%s' line %d\n",
-		    progname, tab[tabpt-1].location, tab[tabpt].location,
-		    file, linenum);
-	    tableerr=1;
+	      fprintf(errfile,
+		   "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
+		   progname, unitname, linenum, file);
+	    goterr=1;
+            free(funcentry);
 	    break;
 	  }
-	  start=end+strspn(end," \t");
-	  tab[tabpt].value = strtod(start,&end);
-	  if (start==end){
+          if (record->error){
+            lineerror(errfile, record, file);
+            goterr=1;
+            free(funcentry);
+            break;
+          }
+          locfunccount++;
+	  if (keepblock(db, funcentry, 0) || addfunction(db, funcentry))
+	    goto nomemory;
+          break;
+        case LOAD_UNIT:
+	  if (ulookup(db, unitname)) {
 	    if (errfile)
-	      fprintf(errfile,"%s: missing value after %.8g in units file '%s' line %d\n",
-		    progname, tab[tabpt].location, file, linenum);
-	    tableerr=1;
+	      fprintf(errfile,
+		    "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
+		    progname, unitname, linenum, file);
+	    goterr=1;
 	    break;
 	  }
-	  tabpt++;
-	  start=end+strspn(end," \t,");
-	}
-	if (tableerr){
-	  free(tab);
-	  free(funcentry->name);
-	  free(funcentry->tableunit);
-	  free(funcentry);
-	  goterr=1;
-	} else {
-	  funcentry->tablelen = tabpt;
-	  funcentry->table = tab;
-          funcentry->linenumber = linenum;
-	  funcentry->file = permfile;
-	  locfunccount++;
-	  addfunction(funcentry);
-	}
-      } else if (strchr(unitname,'(')){ /* function definition */
-         char *start, *end, *inv;
 
-         start = strchr(unitname,'(');
-         end = strchr(unitname,')');
-         *start++ = 0;
+	  /* install unit name/value pair in table */
 
-	 if (strchr("0123456789.", unitname[0])){
-	   if (errfile)
-	     fprintf(errfile,
-	     "%s: unit '%s' on line %d of '%s' ignored.  It starts with a digit\n", 
-		   progname, unitname, linenum, file);
-	   goterr=1;
-	   continue;
-	 }
+	  uptr = &record->entry.unit;
+	  if (toomanyprimitives(db, uptr->name, uptr->value)){
+	    if (errfile)
+	      fprintf(errfile,
+		 "%s: primitive unit '%s' on line %d of '%s' is one too many.  At most %d primitive units are allowed\n",
+		 progname, unitname, linenum, file, MAXDIMS);
+	    return E_PRIMITIVES;
+	  }
+	  if (uinsert(db, uptr) ||
+	      addunitsymbol(db, uptr->name, uptr->value)==NOSYMBOL)
+	    goto nomemory;
+	  locunitcount++;
+          break;
+      }
+   }
+   if (unitcount)
+     *unitcount+=locunitcount;
+   if (prefixcount)
+     *prefixcount+=locprefixcount;
+   if (funccount)
+     *funccount+=locfunccount;
+   if (goterr)
+     return E_BADFILE;
+   else return 0;
 
-         if (!end || strlen(end)>1){
-	   if (errfile)
-	     fprintf(errfile,
-		   "%s: bad function definition of '%s' in '%s' line %d\n",
-		   progname,unitname,file,linenum);
-	   goterr=1;
-	   continue;
-	 }
-	 if (fnlookup(unitname,strlen(unitname))){
-	   if (errfile)
-	     fprintf(errfile,
-		   "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
-		   progname, unitname, linenum, file);
-	   goterr=1;
-	   continue;
-	 }
- 	 funcentry = (struct func*)mymalloc(sizeof(struct func),"(readunits)");
-         *end=0;
-	 funcentry->forward.dimen = 0;
-	 funcentry->inverse.dimen = 0;
-         if (*unitdef=='['){  /* found dimension spec [input;inverse input] */
-           unitdef++;
-	   inv = strchr(unitdef,';');
-	   end = strchr(unitdef,']');
-           if (inv)
-	     *inv++=0;
-	   if (!end || (inv && (end-inv<0))){
-	     free(funcentry);
-	     if (errfile)
-	       fprintf(errfile,
-   	         "%s: expecting ']' in definition of '%s' in '%s' line %d\n",
-		 progname, unitname, file, linenum);
-	     goterr=1;
-	     continue;
-	   }
-	   *end=0;
-	   unitdef = removepadding(unitdef);
-	   funcentry->forward.dimen=dupstr(unitdef);
-	   if (inv){
-	     inv = removepadding(inv);
-	     funcentry->inverse.dimen = dupstr(inv);
-	   }
-	   unitdef = end+1;
-	 }
-         inv = strchr(unitdef,';');
-         if (inv)
-           *inv++ = 0;
-         funcentry->name = dupstr(unitname);
-         funcentry->forward.param = dupstr(start);
-         funcentry->table = 0;
-         funcentry->forward.def = dupstr(removepadding(unitdef));
-	 if (inv){
-	   funcentry->inverse.def = dupstr(removepadding(inv));
-	   funcentry->inverse.param = dupstr(unitname);
-         } 
-	 else 
-	   funcentry->inverse.def = 0;
-         locfunccount++;
-	 funcentry->linenumber = linenum;
-	 funcentry->file = permfile;
-	 addfunction(funcentry);
-      } else {	/* it is a unit definition */
-
-  	 /* Units that end in [2-9] can never be accessed */
-
- 	 if (strchr("23456789", unitname[strlen(unitname)-1])){
-	   if (errfile)
-	     fprintf(errfile,
-             "%s: unit '%s' on line %d of '%s' ignored.  It ends with a nonzero digit\n",
-             progname, unitname, linenum, file);
-   	   goterr=1;
-	   continue;
-	 }
+ nomemory:
+   if (errfile)
+     fprintf(errfile, "%s: memory allocation error (readunits)\n", progname);
+   return E_MEMORY;
+}
 
-	 if (strchr("0123456789.", unitname[0])){
-	   if (errfile)
-	     fprintf(errfile,
-		     "%s: unit '%s' on line %d of '%s' ignored.  It starts with a digit\n", 
-		     progname, unitname, linenum, file);
-	   goterr=1;
-	   continue;
-	 }
 
-         /* Is it a redefinition? */
+/*
+   Reads the null terminated list of units files 'files', parsing them
+   all at once (see parsechunks()) and then adding them to the tables in
+   'db' in order.  Stops at the first file that cannot be opened and
+   sets 'badfile', if it is not null, to its name, and errno to the
+   reason.  The other arguments are the same as for readunits().
+*/
 
-	 if (ulookup(unitname)) {
-	   if (errfile)
-	     fprintf(errfile,
-		    "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
-		    progname, unitname, linenum, file);
-	   goterr=1;
-	   continue;
-	 }
+static int
+readfiles(struct unitsdata *db, char **files, FILE *errfile,
+          int *unitcount, int *prefixcount, int *funccount, int depth,
+          char **badfile)
+{
+   struct loadfile *load;
+   struct loadjob job;
+   int count, i, j, err, readerr, memerr;
+
+   for(count=0;files[count];count++);
+   load = (struct loadfile *) malloc((count+1)*sizeof(struct loadfile));
+   if (!load)
+     goto nomemory;
+   job.count = 0;
+   for(i=0;i<count;i++){
+     if (builtindb() && !strcmp(files[i], BUILTINFILE)){
+       memset(load+i, 0, sizeof(struct loadfile));
+       load[i].builtin = 1;             /* Nothing to parse */
+     } else
+       splitfile(db, load+i, files[i]);
+     job.count += load[i].chunkcount;
+   }
+   job.chunks = (struct loadchunk **)
+     malloc((job.count+1)*sizeof(struct loadchunk *));
+   memerr = !job.chunks;
+   err = 0;
+   if (job.chunks){
+     job.count = 0;
+     for(i=0;i<count;i++)
+       for(j=0;j<load[i].chunkcount;j++)
+         job.chunks[job.count++] = load[i].chunks+j;
+     job.next = 0;
+     job.lazy = db->lazy;
+     parsechunks(&job, db->threads);
+     free(job.chunks);
+   }
+
+   for(i=0;i<count && !memerr && err!=E_FILE && err!=E_MEMORY
+          && err!=E_PRIMITIVES;i++){
+     if (load[i].err==E_FILE){
+       if (badfile)
+         *badfile = files[i];
+       errno = load[i].openerr;         /* For perror() */
+       readerr = E_FILE;
+     } else if (load[i].err==E_MEMORY){
+       memerr = 1;
+       break;
+     } else if (load[i].builtin)
+       readerr = loadbuiltin(db, errfile, unitcount, prefixcount, funccount);
+     else
+       readerr = addfile(db, load+i, files[i], errfile, unitcount,
+                         prefixcount, funccount, depth);
+     if (readerr)
+       err = readerr;
+   }
+   for(i=0;i<count;i++){
+     for(j=0;j<load[i].chunkcount;j++)
+       free(load[i].chunks[j].lines);
+     free(load[i].chunks);
+   }
+   free(load);
+   if (memerr)
+     goto nomemory;
+   return err;
+
+ nomemory:
+   if (errfile)
+     fprintf(errfile, "%s: memory allocation error (readunits)\n", progname);
+   return E_MEMORY;
+}
+
+
+/*
+   Read in units data.
+
+   file - Filename to load
+   errfile - File to receive messages about errors in the units database.
+             Set it to 0 to suppress errors.
+   unitcount, prefixcount, funccount - Return statistics to the caller.
+                                       Must initialize to zero before calling.
+   depth - Used to prevent recursive includes.  Call with it set to zero.
+
+   The units are added to the tables in 'db'.  Returns 0 on success,
+   E_FILE if the file cannot be opened, E_BADFILE if it contains errors,
+   E_PRIMITIVES if it defines more than MAXDIMS primitive units, when it
+   stops at the first one too many, and E_MEMORY if there is not enough
+   memory to hold the units.  The tables must not be used by any context
+   while units are read.
+
+   The file is mapped into memory, or read into it where it cannot be
+   mapped, and kept there.  The names and definitions in the tables
+   point into it instead of being copied.  If db->lazy is set, the
+   values of units are only trimmed by unitdef() when they are first
+   wanted, so such a database must only be used by one thread.  The
+   points of tables are always read here, so a table with bad points
+   is reported to 'errfile' and not defined whether or not db->lazy is
+   set.
+
+   The lines of a large file are parsed by db->threads threads, or
+   one per processor if it is zero (see readfiles()).
+
+   If units was built with a units database in it, the file named
+   BUILTINFILE is that database (see loadbuiltin()).
+
+   The global variable progname is used in error messages.
+*/
+
+int
+readunits(struct unitsdata *db, char *file, FILE *errfile,
+          int *unitcount, int *prefixcount, int *funccount, int depth)
+{
+   char *files[2];
 
-         /* make new units table entry */
+   files[0] = file;
+   files[1] = 0;
+   return readfiles(db, files, errfile, unitcount, prefixcount, funccount,
+                    depth, 0);
+}
 
-         uptr = (struct unitlist *) mymalloc(sizeof(*uptr),"(readunits)");
-	 uptr->name = dupstr(unitname);
-	 uptr->value = dupstr(unitdef);
-         uptr->linenumber = linenum;
-	 uptr->file = permfile;
 
-	 /* install unit name/value pair in list */
+/*
+   Reads the null terminated list of units files 'files' as readunits()
+   does, but parses all of the files at once.  The units are added to
+   the tables in the order of the files, so the first definition of a
+   name is kept and the messages are the same as when the files are
+   read one by one.  Returns E_FILE if a file cannot be opened, after
+   adding the files before it, and sets 'badfile', if it is not null,
+   to its name.  Otherwise returns E_BADFILE if any of the files
+   contains errors.
+*/
 
-	 hashval = uhash(uptr->name);
-	 uptr->next = utab[hashval];
-	 utab[hashval] = uptr;
-	 locunitcount++;
-      }
-   }
-   fclose(unitfile);
-   free(line);
-   if (unitcount)
-     *unitcount+=locunitcount;
-   if (prefixcount)
-     *prefixcount+=locprefixcount;
-   if (funccount)
-     *funccount+=locfunccount;
-   if (goterr)
-     return E_BADFILE;
-   else return 0;
+int
+readunitfiles(struct unitsdata *db, char **files, FILE *errfile,
+              int *unitcount, int *prefixcount, int *funccount,
+              char **badfile)
+{
+   return readfiles(db, files, errfile, unitcount, prefixcount, funccount,
+                    0, badfile);
 }
 
 /* Initialize a unit to be equal to 1. */
@@ -792,127 +1869,313 @@ void
 initializeunit(struct unittype *theunit)
 {
    theunit->factor = 1.0;
-   theunit->numerator[0] = theunit->denominator[0] = NULL;
+   memset(theunit->power, 0, sizeof(theunit->power));
 }
 
 
-/* Free a unit: frees all the strings used in the unit structure.
-   Does not free the unit structure itself.  */
+/* Free a unit.  Units hold no allocated storage, so this does nothing,
+   but it is kept so that callers need not know that. */
 
 void
 freeunit(struct unittype *theunit)
 {
-   char **ptr;
+}
+
+
+/*
+   Symbol tables.  The database has a symbol table holding the name of
+   every unit, which records whether the unit is primitive or
+   dimensionless, and its position in the power vector if it is
+   primitive.  Each context has another symbol table which caches the
+   values of the units that it has used (see unitvalue()).
+*/
 
-   for(ptr = theunit->numerator; *ptr; ptr++)
-     if (*ptr != NULLUNIT) free(*ptr);
-   for(ptr = theunit->denominator; *ptr; ptr++)
-     if (*ptr != NULLUNIT) free(*ptr);
+#define SYMHASHINIT 4096        /* Initial size of symbol hash table */
 
-   /* protect against repeated calls to freeunit() */
+static unsigned
+symhashval(struct symtable *table, const char *name)
+{
+   unsigned hashval;
 
-   theunit->numerator[0] = 0;  
-   theunit->denominator[0] = 0;
+   for (hashval = 0; *name; name++)
+      hashval = *name + HASHNUMBER * hashval;
+   return hashval & (table->hashsize-1);
 }
 
 
+/* Returns the symbol number of 'name', or NOSYMBOL if it is not in the
+   symbol table. */
 
-/* Print out a unit  */
+unsigned
+findsymbol(struct symtable *table, char *name)
+{
+   unsigned sym;
+
+   if (!table->hashsize)
+     return NOSYMBOL;
+   for(sym=table->hash[symhashval(table, name)];sym!=NOSYMBOL;
+       sym=table->symbols[sym].next)
+     if (!strcmp(table->symbols[sym].name, name))
+       return sym;
+   return NOSYMBOL;
+}
 
-void
-showunit(struct unittype *theunit)
+
+/*
+   Adds 'name' to the symbol table if it is not there already and
+   returns its symbol number, or NOSYMBOL if there is not enough memory.
+   If 'def' is not null then it is the definition of the unit, which
+   sets the flags of the symbol.  The name is not copied, so it must
+   not be freed.
+*/
+
+unsigned
+addsymbol(struct symtable *table, char *name, char *def)
 {
-   char **ptr;
-   int printedslash;
-   int counter = 1;
-
-   printf(numformat, theunit->factor);
-
-   for (ptr = theunit->numerator; *ptr; ptr++) {
-      if (ptr > theunit->numerator && **ptr &&
-	  !strcmp(*ptr, *(ptr - 1)))
-	 counter++;
-      else {
-	 if (counter > 1)
-	    printf("%s%d", powerstring, counter);
-	 if (**ptr)
-	    printf(" %s", *ptr);
-	 counter = 1;
-      }
+   struct symbol *symbols, *sp;
+   unsigned sym, i, hashval, *hash, hashsize, size;
+
+   sym = findsymbol(table, name);
+   if (sym==NOSYMBOL){
+     if (table->count >= table->hashsize/2){   /* Keep the chains short */
+       hashsize = table->hashsize ? 2*table->hashsize : SYMHASHINIT;
+       hash = (unsigned *) malloc(hashsize*sizeof(unsigned));
+       if (!hash)
+         return NOSYMBOL;
+       free(table->hash);
+       table->hash = hash;
+       table->hashsize = hashsize;
+       for(i=0;i<hashsize;i++)
+         hash[i] = NOSYMBOL;
+       for(i=0;i<table->count;i++){
+         hashval = symhashval(table, table->symbols[i].name);
+         table->symbols[i].next = hash[hashval];
+         hash[hashval] = i;
+       }
+     }
+     if (table->count==table->size){
+       size = table->size ? 2*table->size : SYMHASHINIT/2;
+       symbols = (struct symbol *) realloc(table->symbols, 
+                                           size*sizeof(struct symbol));
+       if (!symbols)
+         return NOSYMBOL;
+       table->symbols = symbols;
+       table->size = size;
+     }
+     sym = table->count++;
+     sp = table->symbols + sym;
+     memset(sp, 0, sizeof(struct symbol));
+     sp->name = name;
+     sp->dim = -1;
+     hashval = symhashval(table, name);
+     sp->next = table->hash[hashval];
+     table->hash[hashval] = sym;
    }
-   if (counter > 1)
-      printf("%s%d", powerstring, counter);
-   counter = 1;
-   printedslash = 0;
-   for (ptr = theunit->denominator; *ptr; ptr++) {
-      if (ptr > theunit->denominator && **ptr &&
-	  !strcmp(*ptr, *(ptr - 1)))
-	 counter++;
-      else {
-	 if (counter > 1)
-	    printf("%s%d", powerstring, counter);
-	 if (**ptr) {
-	    if (!printedslash)
-	       printf(" /");
-	    printedslash = 1;
-	    printf(" %s", *ptr);
-	 }
-	 counter = 1;
-      }
+   if (def){
+     sp = table->symbols + sym;
+     if (strchr(def, PRIMITIVECHAR))
+       sp->flags |= SYM_PRIMITIVE;
+     if (!strcmp(def, NODIM))
+       sp->flags |= SYM_DIMLESS;
    }
-   if (counter > 1)
-      printf("%s%d", powerstring, counter);
+   return sym;
 }
 
 
-/* qsort comparison function */
+/* Adds the unit 'name' defined as 'def' to the symbols of 'db' with
+   addsymbol(), and numbers it if it is a primitive unit. */
 
-int
-compare(const void *item1, const void *item2)
+unsigned
+addunitsymbol(struct unitsdata *db, char *name, char *def)
 {
-   return strcmp(*(char **) item1, *(char **) item2);
+   struct symbol *sp;
+   unsigned sym;
+
+   sym = addsymbol(&db->syms, name, def);
+   if (sym!=NOSYMBOL){
+     sp = db->syms.symbols + sym;
+     if (sp->flags & SYM_PRIMITIVE)
+       sp->dim = primitiveindex(db, name, sp->flags);
+   }
+   return sym;
 }
 
-/* Sort numerator and denominator of a unit so we can compare different
-   units */
+
+/* Frees a symbol table with its cached values and the names that
+   belong to it. */
 
 void
-sortunit(struct unittype *theunit)
+freesymbols(struct symtable *table)
 {
-   char **ptr;
-   int count;
+   unsigned i;
+   int mode;
+
+   for(i=0;i<table->count;i++){
+     for(mode=0;mode<4;mode++)
+       free(table->symbols[i].value[mode]);
+     if (table->symbols[i].flags & SYM_OWNNAME)
+       free(table->symbols[i].name);
+   }
+   free(table->symbols);
+   free(table->hash);
+   memset(table, 0, sizeof(struct symtable));
+}
+
+
+/*
+   Returns the index of the primitive unit 'name' of 'db' in the power
+   vector of struct unittype, assigning a new index if it is needed.
+   Returns -1 if there are too many primitive units.  The indexes are
+   assigned only while the database is loaded, so the list of primitive
+   units never changes while units are converted.
+*/
+
+int
+primitiveindex(struct unitsdata *db, char *name, unsigned flags)
+{
+   int j;
+
+   for(j=0;j<db->primitivecount;j++)
+     if (!strcmp(db->primitivename[j], name))
+       return j;
+   if (db->primitivecount==MAXDIMS)
+     return -1;
+   db->primitivename[db->primitivecount] = name;
+   db->primitiveflags[db->primitivecount] = flags;
+   for(j=db->primitivecount;
+       j>0 && strcmp(db->primitivename[db->primitiveorder[j-1]], name)>0;j--)
+     db->primitiveorder[j] = db->primitiveorder[j-1];
+   db->primitiveorder[j] = db->primitivecount;
+   return db->primitivecount++;
+}
+
+
+/* Returns nonzero if 'def' makes 'name' a primitive unit and there is
+   no room left in 'db' to number another one. */
+
+int
+toomanyprimitives(struct unitsdata *db, char *name, char *def)
+{
+   int j;
+
+   if (db->primitivecount<MAXDIMS || !def || !strchr(def, PRIMITIVECHAR))
+     return 0;
+   for(j=0;j<db->primitivecount;j++)
+     if (!strcmp(db->primitivename[j], name))
+       return 0;
+   return 1;
+}
+
+
+/* Append a string to a buffer that is grown with trygrowbuffer().
+   Returns E_MEMORY if there is not enough memory, in which case the
+   buffer holds what it held before. */
+
+int
+tryappendstring(char **buf, int *bufsize, char *str)
+{
+  int len;
 
-   for (count = 0, ptr = theunit->numerator; *ptr; ptr++, count++);
-   qsort(theunit->numerator, count, sizeof(char *), compare);
-   for (count = 0, ptr = theunit->denominator; *ptr; ptr++, count++);
-   qsort(theunit->denominator, count, sizeof(char *), compare);
+  len = *bufsize ? strlen(*buf) : 0;
+  while (len + strlen(str) + 1 > *bufsize)
+    if (trygrowbuffer(buf, bufsize))
+      return E_MEMORY;
+  strcpy(*buf + len, str);
+  return 0;
 }
 
 
-/* Cancels duplicate units that appear in the numerator and
-   denominator.  The input unit must be sorted. */
+/* Like tryappendstring(), but exits if there is no memory. */
 
 void
-cancelunit(struct unittype *theunit)
-{
-   char **den, **num;
-   int comp;
-
-   den = theunit->denominator;
-   num = theunit->numerator;
-
-   while (*num && *den) { 
-      comp = strcmp(*den, *num);
-      if (!comp) { /* units match, so cancel them */
-         if (*den!=NULLUNIT) free(*den);
-         if (*num!=NULLUNIT) free(*num);  
-	 *den++ = NULLUNIT;
-	 *num++ = NULLUNIT;
-      } else if (comp < 0) /* Move up whichever pointer is alphabetically */
-	 den++;            /* behind to look for future matches */
-      else
-	 num++;
+appendstring(char **buf, int *bufsize, char *str)
+{
+  if (tryappendstring(buf, bufsize, str)){
+    fprintf(stderr, "%s: memory allocation error (appendstring)\n",progname);
+    exit(3);
+  }
+}
+
+
+/* Append a number printed with numformat to a buffer that is grown
+   with growbuffer() */
+
+void
+appendnumber(char **buf, int *bufsize, double num)
+{
+  int len, count;
+
+  if (!*bufsize){
+    growbuffer(buf, bufsize);
+    **buf = 0;
+  }
+  len = strlen(*buf);
+  for(;;){
+    count = snprintf(*buf + len, *bufsize - len, numformat, num);
+    if (count >= 0 && count < *bufsize - len)
+      return;
+    growbuffer(buf, bufsize);
+  }
+}
+
+
+/* 
+   Write a unit of 'db' into a buffer that is grown with growbuffer().
+   Returns the buffer.
+*/
+
+char *
+unitstring(struct unitsdata *db, char **buf, int *bufsize, 
+           struct unittype *theunit)
+{
+   int i, prim, printedslash;
+   char powerbuf[20];
+
+   appendstring(buf, bufsize, "");
+   **buf = 0;
+   appendnumber(buf, bufsize, theunit->factor);
+
+   for (i=0;i<db->primitivecount;i++) {
+      prim = db->primitiveorder[i];
+      if (theunit->power[prim] > 0) {
+	 appendstring(buf, bufsize, " ");
+	 appendstring(buf, bufsize, db->primitivename[prim]);
+	 if (theunit->power[prim] > 1) {
+	    sprintf(powerbuf, "%d", theunit->power[prim]);
+	    appendstring(buf, bufsize, powerstring);
+	    appendstring(buf, bufsize, powerbuf);
+	 }
+      }
+   }
+   printedslash = 0;
+   for (i=0;i<db->primitivecount;i++) {
+      prim = db->primitiveorder[i];
+      if (theunit->power[prim] < 0) {
+	 if (!printedslash)
+	    appendstring(buf, bufsize, " /");
+	 printedslash = 1;
+	 appendstring(buf, bufsize, " ");
+	 appendstring(buf, bufsize, db->primitivename[prim]);
+	 if (theunit->power[prim] < -1) {
+	    sprintf(powerbuf, "%d", -theunit->power[prim]);
+	    appendstring(buf, bufsize, powerstring);
+	    appendstring(buf, bufsize, powerbuf);
+	 }
+      }
    }
+   return *buf;
+}
+
+
+/* Print out a unit  */
+
+void
+showunit(struct unittype *theunit)
+{
+   static char *buf = 0;
+   static int bufsize = 0;
+
+   fputs(unitstring(mainctx->db, &buf, &bufsize, theunit), stdout);
 }
 
 
@@ -924,16 +2187,16 @@ cancelunit(struct unittype *theunit)
    if the specified unit does not appear in the units table.
 
    Sometimes the returned pointer will be a pointer to the special
-   buffer created to hold the data.  This buffer grows as needed during 
-   program execution.  
+   buffer in the context created to hold the data.  This buffer grows
+   as needed during program execution.  
 
    Note that if you pass the output of lookupunit() back into the function
    again you will get correct results, but the data you passed in may get
    clobbered if it happened to be the internal buffer.  
-*/
 
-static int bufsize=0;
-static char *buffer;  /* buffer for lookupunit answers with prefixes */
+   If there is not enough memory then a null pointer is returned and
+   ctx->error is set to E_MEMORY.
+*/
 
 
 /* 
@@ -944,393 +2207,751 @@ static char *buffer;  /* buffer for lookupunit answers with prefixes */
   
 
 char *
-lookupunit(char *unit,int prefixok)
+lookupunit(struct unitscontext *ctx, char *unit, int prefixok)
 {
-   char *copy;
+   char *copy, *result;
    struct prefixlist *pfxptr;
    struct unitlist *uptr;
-
-   if ((uptr = ulookup(unit)))
-      return uptr->value;
-
-   if (strlen(unit)>2 && unit[strlen(unit) - 1] == 's') {
-      copy = dupstr(unit);
-      copy[strlen(copy) - 1] = 0;
-      if (lookupunit(copy,prefixok)){
-         while(strlen(copy)+1 > bufsize) {
-            growbuffer(&buffer, &bufsize);
-         }
-         strcpy(buffer, copy);  /* Note: returning looked up result seems   */
-	 free(copy);		/*   better but it causes problems when it  */
-         return buffer;		/*   contains PRIMITIVECHAR.                */
+   struct arenamark mark;
+   int len;
+
+   if ((uptr = ulookup(ctx->db, unit)))
+      return unitdef(uptr);
+
+   /* Copies of the unit name are made in the arena */
+
+   arenamark(ctx, &mark);
+   result = 0;
+   len = strlen(unit);
+   if (len>2 && unit[len - 1] == 's') {
+      if (!(copy = arenastr(ctx, unit, --len)))
+        goto nomemory;
+      if (lookupunit(ctx,copy,prefixok))
+        result = copy;          /* Note: returning looked up result seems   */
+				/*   better but it causes problems when it  */
+				/*   contains PRIMITIVECHAR.                */
+      if (!result && len>2 && copy[len - 1] == 'e') {
+	 copy[--len] = 0;
+	 if (lookupunit(ctx,copy,prefixok))
+           result = copy;
       }
-      if (strlen(copy)>2 && copy[strlen(copy) - 1] == 'e') {
-	 copy[strlen(copy) - 1] = 0;
-	 if (lookupunit(copy,prefixok)){
-	    while (strlen(copy)+1 > bufsize) {
-	       growbuffer(&buffer,&bufsize);
-	    }
-            strcpy(buffer,copy);
-	    free(copy);
-            return buffer;
-	 }
+      if (!result && len>2 && copy[len - 1] == 'i') {
+	 copy[len - 1] = 'y';
+	 if (lookupunit(ctx,copy,prefixok))
+           result = copy;
       }
-      if (strlen(copy)>2 && copy[strlen(copy) - 1] == 'i') {
-	 copy[strlen(copy) - 1] = 'y';
-	 if (lookupunit(copy,prefixok)){
-	    while (strlen(copy)+1 > bufsize) {
-	       growbuffer(&buffer,&bufsize);
-	    }
-            strcpy(buffer,copy);
-	    free(copy);
-            return buffer;
-	 }
+      if (result){
+         if (reservebuffer(&ctx->lookupbuf, &ctx->lookupbufsize, 
+                           strlen(result)+1))
+           goto nomemory;
+         strcpy(ctx->lookupbuf, result);
       }
-      free(copy);
    }
-   if (prefixok && (pfxptr = plookup(unit))) {
-      copy=unit;
-      copy += pfxptr->len;
-      if (!strlen(copy) || lookupunit(copy,0)) {
-         char *tempbuf;
-         while (strlen(pfxptr->value)+strlen(copy)+2 > bufsize){
-            growbuffer(&buffer, &bufsize);
-         }
-         tempbuf = dupstr(copy);   /* copy might point into buffer */
-	 strcpy(buffer, pfxptr->value);
-	 strcat(buffer, " ");
-	 strcat(buffer, tempbuf);
-         free(tempbuf);
-	 return buffer;
+   if (!result && prefixok && (pfxptr = plookup(ctx->db, unit))) {
+      copy = unit + pfxptr->len;
+      if (!strlen(copy) || lookupunit(ctx,copy,0)) {
+         /* copy might point into the buffer */
+         if (!(copy = arenastr(ctx, copy, strlen(copy))) ||
+             reservebuffer(&ctx->lookupbuf, &ctx->lookupbufsize,
+                           strlen(pfxptr->value)+strlen(copy)+2))
+           goto nomemory;
+	 strcpy(ctx->lookupbuf, pfxptr->value);
+	 strcat(ctx->lookupbuf, " ");
+	 strcat(ctx->lookupbuf, copy);
+	 result = ctx->lookupbuf;
       }
    }
+   arenarelease(ctx, &mark);
+   return result ? ctx->lookupbuf : 0;
+
+ nomemory:
+   arenarelease(ctx, &mark);
+   ctx->error = E_MEMORY;
    return 0;
 }
 
-/* 
-   Returns 1 if the input consists entirely of whitespace characters
-   and returns 0 otherwise. 
+/*
+   Suggestions of names for units that are not known.  The names of the
+   units and functions are kept in a BK-tree, in which the children of
+   a node are at different edit distances from it.  The names within
+   distance d of a string s that is at distance e from a node can only
+   be under the children at distances from e-d to e+d, so a search for
+   close names visits a small part of the tree.  The tree is built by
+   suggestindex() once the units are loaded and is not changed after
+   that, so suggestunits() may be used by many contexts at once.
+
+   Names made only of punctuation, such as '"' and '%', are left out
+   of the tree, since they are close to any other punctuation, and a
+   name is only suggested if it keeps at least one character of the
+   text looked for.
+*/
+
+#define SUGGESTMAXLEN 64        /* Longest name that is suggested */
+#define SUGGESTPUNCT "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+#define MAXSUGGEST 3            /* Most names that are suggested */
+#define BKTREEGROW 1024         /* Nodes added when the tree is full */
+
+
+/* Returns the number of characters that must be inserted, deleted or
+   changed to turn 'a' into 'b'.  'b' must have at most SUGGESTMAXLEN
+   characters. */
+
+static int
+editdistance(const char *a, const char *b)
+{
+   int row[SUGGESTMAXLEN+1];
+   int len, i, diag, above;
+
+   len = strlen(b);
+   for(i=0;i<=len;i++)
+      row[i] = i;
+   for(;*a;a++){
+      diag = row[0]++;
+      for(i=1;i<=len;i++){
+         above = row[i];
+         row[i] = diag + (*a != b[i-1]);
+         if (row[i] > above+1)
+            row[i] = above+1;
+         if (row[i] > row[i-1]+1)
+            row[i] = row[i-1]+1;
+         diag = above;
+      }
+   }
+   return row[len];
+}
+
+
+/*
+   Returns 1 if 'name', defined as 'def' unless that is null, is
+   itself a prefix followed by a unit, such as "kilogram", or is
+   defined as a single word made of its own prefix and a unit, such as
+   "kilohm" for "kiloohm".  No prefix is suggested in front of such a
+   name.  Only units of at least three characters count, as for the
+   names that suggestunits() removes a prefix from, so that "ft" is
+   not taken for a prefix and "t".
 */
 
+static int
+prefixedname(struct unitsdata *db, char *name, char *def)
+{
+   struct prefixnode *ptrie;
+   char word[SUGGESTMAXLEN+1];
+   int node, i, len;
+
+   if (!db->ptriecount)
+      return 0;
+   len = 0;
+   if (def){
+      def += strspn(def, WHITE);
+      len = strcspn(def, WHITE);
+      if (def[len+strspn(def+len, WHITE)] || len > SUGGESTMAXLEN)
+         len = 0;
+   }
+   ptrie = db->ptrie;
+   for(i=0,node=0;
+       name[i] && (node = pchild(ptrie, node, (unsigned char) name[i]));
+       i++)
+      if (ptrie[node].prefix){
+         if (strlen(name+i+1)>=3 && ulookup(db, name+i+1))
+            return 1;
+         if (len-i-1>=3 && !strncmp(def, name, i+1)){
+            memcpy(word, def+i+1, len-i-1);
+            word[len-i-1] = 0;
+            if (ulookup(db, word))
+               return 1;
+         }
+      }
+   return 0;
+}
+
+
+/* Adds a name, defined as 'def' if it is a unit, to the BK-tree.
+   Returns 0, or E_MEMORY if the tree cannot grow. */
+
+static int
+bkinsert(struct unitsdata *db, char *name, char *def)
+{
+   struct bknode *newtree;
+   int node, child, dist, newnode;
+
+   if (strlen(name) > SUGGESTMAXLEN || !name[strspn(name, SUGGESTPUNCT)])
+      return 0;
+   if (db->bktreecount == db->bktreesize){
+      newtree = (struct bknode *) realloc(db->bktree, 
+                    (db->bktreesize+BKTREEGROW)*sizeof(struct bknode));
+      if (!newtree)
+         return E_MEMORY;
+      db->bktree = newtree;
+      db->bktreesize += BKTREEGROW;
+   }
+   newnode = db->bktreecount;
+   db->bktree[newnode].name = name;
+   db->bktree[newnode].distance = 0;
+   db->bktree[newnode].prefixed = prefixedname(db, name, def);
+   db->bktree[newnode].child = db->bktree[newnode].sibling = 0;
+   if (newnode){
+      node = 0;
+      for(;;){
+         dist = editdistance(name, db->bktree[node].name);
+         if (!dist)
+            return 0;           /* A function with the name of a unit */
+         for(child = db->bktree[node].child; 
+             child && db->bktree[child].distance != dist;
+             child = db->bktree[child].sibling);
+         if (!child)
+            break;
+         node = child;
+      }
+      db->bktree[newnode].distance = dist;
+      db->bktree[newnode].sibling = db->bktree[node].child;
+      db->bktree[node].child = newnode;
+   }
+   db->bktreecount++;
+   return 0;
+}
+
+
+/* Builds the BK-tree of the names of the units and functions in 'db'.
+   Returns 0, or E_MEMORY if there is not enough memory. */
+
 int
-isblankstr(char *str)
+suggestindex(struct unitsdata *db)
 {
-  while(*str) if (!strchr(WHITE,*str++)) return 0;
-  return 1;
+   struct func *funcptr;
+   int i;
+
+   db->bktreecount = 0;
+   for(i=0;i<db->unitcount;i++)
+      if (bkinsert(db, db->units[i].name, db->units[i].value ? 
+                   db->units[i].value : db->units[i].source))
+         return E_MEMORY;
+   for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next)
+      if (bkinsert(db, funcptr->name, 0))
+         return E_MEMORY;
+   return 0;
+}
+
+
+/* The state of a search for suggestions.  The names found so far are
+   kept in 'found', best first: closest, then found without adding a
+   prefix or plural ending, then in alphabetical order. */
+
+struct suggestion {
+   int distance;
+   int parts;                   /* 1 if a prefix or ending was added */
+   char text[2*SUGGESTMAXLEN+4];
+};
+
+struct suggestsearch {
+   struct unitsdata *db;
+   char *name;                  /* The unknown unit */
+   char *query;                 /* The part of it being looked for */
+   char *prefix;                /* Added to each name found */
+   char *ending;
+   int maxdist;
+   struct suggestion found[MAXSUGGEST];
+   int count;
+};
+
+
+static int
+suggestbefore(int distance, int parts, char *text, struct suggestion *other)
+{
+   if (distance != other->distance)
+      return distance < other->distance;
+   if (parts != other->parts)
+      return parts < other->parts;
+   return strcmp(text, other->text) < 0;
+}
+
+
+static void
+addsuggestion(struct suggestsearch *search, char *name, int distance)
+{
+   char text[2*SUGGESTMAXLEN+4];
+   int parts, i;
+
+   if (strlen(search->prefix) + strlen(name) + strlen(search->ending) 
+       >= sizeof(text))
+      return;
+   strcpy(text, search->prefix);
+   strcat(text, name);
+   strcat(text, search->ending);
+   if (!strcmp(text, search->name))
+      return;
+   parts = *search->prefix || *search->ending;
+   for(i=0;i<search->count;i++)
+      if (!strcmp(search->found[i].text, text)){
+         if (!suggestbefore(distance, parts, text, search->found+i))
+            return;
+         for(search->count--;i<search->count;i++)
+            search->found[i] = search->found[i+1];
+         break;
+      }
+   for(i=search->count;
+       i>0 && suggestbefore(distance, parts, text, search->found+i-1);i--)
+      if (i<MAXSUGGEST)
+         search->found[i] = search->found[i-1];
+   if (i>=MAXSUGGEST)
+      return;
+   search->found[i].distance = distance;
+   search->found[i].parts = parts;
+   strcpy(search->found[i].text, text);
+   if (search->count<MAXSUGGEST)
+      search->count++;
+}
+
+
+static void
+bksearch(struct suggestsearch *search, int node)
+{
+   struct bknode *tree = search->db->bktree;
+   int dist, child;
+
+   dist = editdistance(search->query, tree[node].name);
+   if (dist <= search->maxdist && dist < strlen(search->query)
+       && !(*search->prefix && (tree[node].prefixed || 
+            !strncmp(tree[node].name, search->prefix, strlen(search->prefix)))))
+      addsuggestion(search, tree[node].name, dist);
+   for(child=tree[node].child;child;child=tree[child].sibling)
+      if (abs(tree[child].distance - dist) <= search->maxdist)
+         bksearch(search, child);
+}
+
+
+/* Looks for names close to 'query', which is 'name' without 'prefix' at
+   the start and without 'ending' at the end.  A prefix is not put in
+   front of a name that already has one, or that begins with the same
+   text, as "ffurlong" would for "furlongz". */
+
+static void
+trysuggest(struct suggestsearch *search, char *query, char *prefix, 
+           char *ending)
+{
+   int len;
+
+   len = strlen(query);
+   search->query = query;
+   search->prefix = prefix;
+   search->ending = ending;
+   search->maxdist = len<=4 ? 1 : 2;
+   bksearch(search, 0);
 }
 
 
-/* Points entries of product[] to the strings stored in tomove[].  
-   Leaves tomove pointing to a list of NULLUNITS.  */
+/*
+   Finds names of units or functions that are close to 'name', which is
+   not a known unit, either as it is or after removing a prefix or a
+   plural ending.  If any are found, appends a message such as "did you
+   mean 'meter' or 'metre'?" to 'buf', which is grown with
+   trygrowbuffer().  Returns the number of names suggested, or -1 if
+   there is not enough memory to grow 'buf'.  No other memory is
+   allocated.
+*/
 
 int
-moveproduct(char *product[], char *tomove[])
+suggestunits(struct unitscontext *ctx, char *name, char **buf, int *bufsize)
 {
-   char **dest, **src;
+   struct suggestsearch search;
+   struct prefixnode *ptrie;
+   char stem[SUGGESTMAXLEN+1];
+   int len, node, i;
+
+   len = strlen(name);
+   search.db = ctx->db;
+   search.name = name;
+   search.count = 0;
+   if (!ctx->db->bktreecount || !len || len > SUGGESTMAXLEN)
+      return 0;
+   trysuggest(&search, name, "", "");
 
-   dest=product;
-   for(src = tomove; *src; src++){
-     if (*src == NULLUNIT) continue;
-     for(; *dest && *dest != NULLUNIT; dest++);
-     if (dest - product >= MAXSUBUNITS - 1) {
-       return E_PRODOVERFLOW;
-     }
-     if (!*dest)
-        *(dest + 1) = 0;
-     *dest = *src;
-     *src=NULLUNIT;
+   /* Plural forms, as accepted by lookupunit() */
+
+   if (len>2 && name[len-1]=='s'){
+      strcpy(stem, name);
+      stem[len-1] = 0;
+      trysuggest(&search, stem, "", "s");
+      if (len>3 && name[len-2]=='e'){
+         stem[len-2] = 0;
+         trysuggest(&search, stem, "", "es");
+      }
    }
-   return 0;
+
+   /* Every prefix that the name begins with */
+
+   ptrie = ctx->db->ptrie;
+   if (ctx->db->ptriecount)
+      for(i=0,node=0;
+          name[i] && (node = pchild(ptrie, node, (unsigned char) name[i]));
+          i++)
+         if (ptrie[node].prefix && strlen(name+i+1)>=3)
+            trysuggest(&search, name+i+1, 
+                       ctx->db->prefixes[ptrie[node].prefix-1].name, "");
+
+   for(i=0;i<search.count;i++)
+      if (tryappendstring(buf, bufsize, i==0 ? "did you mean '" :
+                                    i==search.count-1 ? "' or '" : "', '")
+          || tryappendstring(buf, bufsize, search.found[i].text))
+         return -1;
+   if (search.count && tryappendstring(buf, bufsize, "'?"))
+      return -1;
+   return search.count;
 }
 
+
 /* 
-   Make a copy of a product list.  Note that no error checking is done
-   for overflowing the product list because it is assumed that the
-   source list doesn't overflow, so the destination list shouldn't
-   overflow either.  (This assumption could be false if the
-   destination is not actually at the start of a product buffer.) 
+   Returns 1 if the input consists entirely of whitespace characters
+   and returns 0 otherwise. 
 */
 
-void
-copyproduct(char **dest, char **source)
+int
+isblankstr(char *str)
 {
-   for(;*source;source++,dest++) {
-     if (*source==NULLUNIT)
-       *dest = NULLUNIT;
-     else
-       *dest=dupstr(*source);
-   }
-   *dest=0;
+  while(*str) if (!strchr(WHITE,*str++)) return 0;
+  return 1;
 }
 
+
 /* Make a copy of a unit */ 
 
 void
 unitcopy(struct unittype *dest, struct unittype *source)
 {
-  dest->factor = source->factor;
-  copyproduct(dest->numerator, source->numerator);
-  copyproduct(dest->denominator, source->denominator);
+  *dest = *source;
+}
+
+
+/* 
+   Exponents are kept between -INT_MAX and INT_MAX so that inverting a
+   unit cannot overflow.  Returns nonzero if a+b is outside that range.
+*/
+
+static int
+poweroverflow(int a, int b)
+{
+  if (b>0)
+    return a > INT_MAX-b;
+  else
+    return a < -INT_MAX-b;
 }
 
 
-/* Multiply left by right.  In the process, all of the units are
-   deleted from right (but it is not freed) */
+/* Multiply left by right.  Right is not changed.  Returns E_PRODOVERFLOW
+   if an exponent would overflow, leaving left unchanged. */
 
 int 
 multunit(struct unittype *left, struct unittype *right)
 {
-  int myerr;
+  int i;
+
+  for(i=0;i<MAXDIMS;i++)
+    if (poweroverflow(left->power[i], right->power[i]))
+      return E_PRODOVERFLOW;
   left->factor *= right->factor;
-  myerr = moveproduct(left->numerator, right->numerator);
-  if (!myerr)
-    myerr = moveproduct(left->denominator, right->denominator);
-  return myerr;
+  for(i=0;i<MAXDIMS;i++)
+    left->power[i] += right->power[i];
+  return 0;
 }
 
 int 
 divunit(struct unittype *left, struct unittype *right)
 {
-  int myerr;
+  int i;
+
+  for(i=0;i<MAXDIMS;i++)
+    if (poweroverflow(left->power[i], -right->power[i]))
+      return E_PRODOVERFLOW;
   left->factor /= right->factor;
-  myerr = moveproduct(left->numerator, right->denominator);
-  if (!myerr)
-    myerr = moveproduct(left->denominator, right->numerator);
-  return myerr;
+  for(i=0;i<MAXDIMS;i++)
+    left->power[i] -= right->power[i];
+  return 0;
 }
 
 
 /*
-   reduces a product of symbolic units to primitive units.
-   The three low bits are used to return flags:
+   Makes a new context for converting units with the database 'db'.
+   Returns null if there is not enough memory.  Several contexts may
+   share one database.
+*/
 
-   bit 0 set if reductions were performed without error.
-   bit 1 set if no reductions are performed.
-   bit 2 set if an unknown unit is discovered.
+struct unitscontext *
+newcontext(struct unitsdata *db)
+{
+   struct unitscontext *ctx;
+
+   ctx = (struct unitscontext *) malloc(sizeof(struct unitscontext));
+   if (!ctx)
+     return 0;
+   memset(ctx, 0, sizeof(struct unitscontext));
+   ctx->db = db;
+   ctx->minusminus = 1;
+   return ctx;
+}
 
-   Return values from multiple calls will be ORed together later.
- */
 
-#define DIDREDUCTION (1<<0)
-#define NOREDUCTION  (1<<1)
-#define ERROR        (1<<2)
+/* Frees a context.  The database is not freed. */
+
+void
+freecontext(struct unitscontext *ctx)
+{
+   struct arenablock *block, *next;
+
+   for(block=ctx->firstblock;block;block=next){
+     next = block->next;
+     free(block);
+   }
+   freesymbols(&ctx->cache);
+   free(ctx->irreducible);
+   free(ctx->lookupbuf);
+   free(ctx->errortext);
+   free(ctx);
+}
+
+
+/* Frees everything that the tables of 'db' hold and leaves it empty.
+   No context may be using it. */
+
+void
+freedatabase(struct unitsdata *db)
+{
+   struct dbblock *block, *next;
+
+   free(db->units);
+   free(db->utab);
+   free(db->prefixes);
+   free(db->ptrie);
+   free(db->ftab);
+   freesymbols(&db->syms);
+   free(db->bktree);
+   free(db->conformlist);
+   free(db->dimgroups);
+   free(db->dimhash);
+   free(db->searchlist);
+   free(db->searchwidth);
+   free(db->searchtext);
+   free(db->searchowner);
+   free(db->searchsuffix);
+   free(db->completelist);
+   dbfreenotes(db);
+   for(block=db->blocks;block;block=next){
+     next = block->next;
+     releaseblock(block->data, block->maplen);
+     free(block);
+   }
+   memset(db, 0, sizeof(struct unitsdata));
+}
+
+
+/* Forget the values of units cached in a context */
+
+void
+clearunitcache(struct unitscontext *ctx)
+{
+   freesymbols(&ctx->cache);
+}
+
+
+/*
+   Sets 'theunit' to the value of the unit 'name' in primitive units by
+   following its definition down to the primitive units.  Returns 0 on
+   success, E_UNKNOWNUNIT (and sets ctx->irreducible) if a unit is not
+   defined, E_REDUCE if a definition is bad or circular, or E_MEMORY.
+*/
+
+#define MAXREDUCEDEPTH 100      /* Longest chain of definitions followed */
 
 int
-reduceproduct(struct unittype *theunit, int flip)
+unitvalue(struct unitscontext *ctx, struct unittype *theunit, char *name)
 {
+   struct symtable *syms;
+   struct unittype *value;
+   struct unitlist *uptr;
+   char *def, *saveparam, *copy;
+   struct arenamark mark;
+   unsigned sym, dbsym, flags;
+   int err, prim, mode;
+
+   /* The value of a definition depends on minusminus and oldstar, so a
+      value is cached for each combination of them. */
+
+   mode = (ctx->minusminus!=0) + 2*(ctx->oldstar!=0);
+   if (ctx->db->reducedmode==mode+1 && (uptr = ulookup(ctx->db, name))
+       && uptr->reduced){
+     *theunit = *uptr->reduced;
+     return 0;
+   }
+   sym = findsymbol(&ctx->cache, name);
+   if (sym!=NOSYMBOL && ctx->cache.symbols[sym].value[mode]){
+     *theunit = *ctx->cache.symbols[sym].value[mode];
+     return 0;
+   }
 
-   char *toadd;
-   char **product;
-   int didsomething = NOREDUCTION;
-   struct unittype newunit;
-   int ret;
-
-   if (flip)
-      product = theunit->denominator;
-   else
-      product = theunit->numerator;
-
-   for (; *product; product++) {
-      for (;;) {
-	 if (!strlen(*product))
-	    break;
-	 toadd = lookupunit(*product,1);
-	 if (!toadd) {
-            if (!irreducible)
-	      irreducible = dupstr(*product);
-	    return ERROR;
-         }
-	 if (strchr(toadd, PRIMITIVECHAR))
-	    break;
-	 didsomething = DIDREDUCTION;
-	 if (*product != NULLUNIT) {
-	    free(*product);
-	    *product = NULLUNIT;
-	 }
-         if (parseunit(&newunit, toadd, 0, 0))
-	    return ERROR;
-         if (flip) ret=divunit(theunit,&newunit);
-         else ret=multunit(theunit,&newunit);
-         freeunit(&newunit);
-         if (ret) 
-            return ERROR;
+   initializeunit(theunit);
+   syms = &ctx->db->syms;
+   dbsym = findsymbol(syms, name);
+   if (dbsym!=NOSYMBOL && (syms->symbols[dbsym].flags & SYM_PRIMITIVE)) {
+      if ((prim = syms->symbols[dbsym].dim) < 0)
+        return E_PRODOVERFLOW;
+      theunit->power[prim] = 1;
+   } else {
+      ctx->error = 0;
+      if (!(def = lookupunit(ctx,name,1))) {
+         if (ctx->error)
+           return ctx->error;
+         if (reservebuffer(&ctx->irreducible, &ctx->irreduciblesize,
+                           strlen(name)+1))
+           return E_MEMORY;
+         strcpy(ctx->irreducible, name);
+         return E_UNKNOWNUNIT;
       }
+      if (ctx->reducedepth >= MAXREDUCEDEPTH)
+        return E_REDUCE;
+      arenamark(ctx, &mark);
+      def = arenastr(ctx, def, strlen(def)); /* lookupunit() reuses its */
+      if (!def)                              /* buffer */
+        return E_MEMORY;
+      saveparam = ctx->function_parameter;   /* Definitions have no */
+      ctx->function_parameter = 0;           /* parameter */
+      ctx->reducedepth++;
+      err = parseunit(ctx, theunit, def, 0, 0);
+      ctx->reducedepth--;
+      ctx->function_parameter = saveparam;
+      arenarelease(ctx, &mark);
+      if (err==E_UNKNOWNUNIT || err==E_PRODOVERFLOW || err==E_MEMORY)
+        return err;
+      if (err)
+        return E_REDUCE;
    }
-   return didsomething;
-}
 
+   /* Cache the value.  Names with prefixes or plurals are copied. */
 
-/*
-   Reduces numerator and denominator of the specified unit.
-   Returns 0 on success, or 1 on unknown unit error.
- */
-
-int
-reduceunit(struct unittype *theunit)
-{
-   int ret;
-
-   if (irreducible)
-     free(irreducible);
-   irreducible=0;
-   ret = DIDREDUCTION;
-
-   /* Keep calling reduceprodut until it doesn't do anything */
-
-   while (ret & DIDREDUCTION) {
-      ret = reduceproduct(theunit, 0);
-      if (!(ret & ERROR))
-	ret |= reduceproduct(theunit, 1);
-      if (ret & ERROR){
-         if (irreducible) 
-	   return E_UNKNOWNUNIT;
-         else
-	   return E_REDUCE;
-      }
+   if (sym==NOSYMBOL){
+     flags = 0;
+     if (dbsym!=NOSYMBOL)
+       copy = syms->symbols[dbsym].name;
+     else if ((copy = trydupstr(name)))
+       flags = SYM_OWNNAME;
+     else
+       return 0;
+     if ((sym = addsymbol(&ctx->cache, copy, 0))==NOSYMBOL){
+       if (flags)
+         free(copy);
+       return 0;
+     }
+     ctx->cache.symbols[sym].flags = flags;
+   }
+   if ((value = (struct unittype *) malloc(sizeof(struct unittype)))){
+     *value = *theunit;
+     ctx->cache.symbols[sym].value[mode] = value;
    }
    return 0;
 }
 
-/* 
-   Returns one if the argument unit is defined in the data file as a   
-  dimensionless unit.  This is determined by comparing its definition to
-  the string NODIM.  
+
+/*
+   Reduces every unit in 'db' to primitive units, as unitvalue() does for
+   a context with 'minusminus' and 'oldstar', and keeps the values with
+   the units.  Then unitvalue() only has to look them up, in any context
+   with those settings.  Each definition is parsed once: unitvalue()
+   reduces the units that a definition uses before the definition
+   itself and remembers them, so the units are reduced in the order of
+   their dependencies.  Units that cannot be reduced are left for
+   unitvalue() to report.  Returns 0, or E_MEMORY if there is not
+   enough memory.  The database must not be in use by any context.
 */
 
 int
-ignore_dimless(char *name)
+reduceall(struct unitsdata *db, int minusminus, int oldstar)
 {
-  struct unitlist *ul;
-  if (!name) 
-    return 0;
-  ul = ulookup(name);
-  if (ul && !strcmp(ul->value, NODIM))
-    return 1;
-  return 0;
-}
+   struct unitscontext *ctx;
+   struct unittype *values;
+   unsigned i;
+   int err;
 
-int 
-ignore_nothing(char *name)
-{
-  return 0;
+   if (!(ctx = newcontext(db)))
+     return E_MEMORY;
+   ctx->minusminus = minusminus;
+   ctx->oldstar = oldstar;
+   values = (struct unittype *)
+     malloc((db->unitcount+1)*sizeof(struct unittype));
+   if (!values || keepblock(db, values, 0)){
+     freecontext(ctx);
+     return E_MEMORY;
+   }
+   db->reducedmode = 0;
+   for(i=0;i<db->unitcount;i++){
+     err = unitvalue(ctx, values+i, db->units[i].name);
+     if (err==E_MEMORY){
+       freecontext(ctx);
+       return E_MEMORY;
+     }
+     db->units[i].reduced = err ? 0 : values+i;
+   }
+   db->reducedmode = 1 + (minusminus!=0) + 2*(oldstar!=0);
+   freecontext(ctx);
+   return 0;
 }
 
 
+/* Return zero if units are compatible, nonzero otherwise. */
+
 int
-ignore_primitive(char *name)
+compareunits(struct unittype *first, struct unittype *second)
 {
-  struct unitlist *ul;
-  if (!name) 
-    return 0;
-  ul = ulookup(name);
-  if (ul && strchr(ul->value, PRIMITIVECHAR))
-    return 1;
-  return 0;
-}
-
-
-/* 
-   Compare two product lists, return zero if they match and one if
-   they do not match.  They may contain embedded NULLUNITs which are
-   ignored in the comparison. Units defined as NODIM are also ignored
-   in the comparison.
-*/
+   int i;
 
-int
-compareproducts(char **one, char **two, int (*isdimless)(char *name))
-{
-   int oneblank, twoblank;
-   while (*one || *two) {
-      oneblank = (*one==NULLUNIT) || isdimless(*one);    
-      twoblank = (*two==NULLUNIT) || isdimless(*two);    
-      if (!*one && !twoblank)
-	 return 1;
-      if (!*two && !oneblank)
-	 return 1;
-      if (oneblank)
-	 one++;
-      else if (twoblank)
-	 two++;
-      else if (strcmp(*one, *two))
-	 return 1;
-      else
-	 one++, two++;
-   }
+   for(i=0;i<MAXDIMS;i++)
+      if (first->power[i] != second->power[i])
+         return 1;
    return 0;
 }
 
 
-/* Return zero if units are compatible, nonzero otherwise.  The units
-   must be reduced, sorted and canceled for this to work.  */
+/* Like compareunits(), but the dimensionless primitive units of 'db'
+   are ignored. */
 
 int
-compareunits(struct unittype *first, struct unittype *second, 
-	     int (*isdimless)(char *name))
+comparedims(struct unitsdata *db, struct unittype *first, 
+            struct unittype *second)
 {
-   return
-      compareproducts(first->numerator, second->numerator, isdimless) ||
-      compareproducts(first->denominator, second->denominator, isdimless);
+   int i;
+
+   for(i=0;i<db->primitivecount;i++)
+      if (first->power[i] != second->power[i] && 
+          !(db->primitiveflags[i] & SYM_DIMLESS))
+         return 1;
+   return 0;
 }
 
 
-/* Reduce a unit as much as possible */
+/* Reduce a unit as much as possible.  Units are always kept reduced, so
+   there is nothing to do. */
 
 int
-completereduce(struct unittype *unit)
+completereduce(struct unitscontext *ctx, struct unittype *unit)
 {
-   int err;
-
-   if ((err=reduceunit(unit)))
-     return err;
-   sortunit(unit);
-   cancelunit(unit);
    return 0;
 }
 
 
-/* Raise theunit to the specified power.  This function does not fill
-   in NULLUNIT gaps, which could be considered a deficiency. */
+/* Raise theunit to the specified nonnegative power.  Returns
+   E_PRODOVERFLOW if an exponent would overflow. */
 
 int
 expunit(struct unittype *theunit, int  power)
 {
-  char **numptr, **denptr;
-  double thefactor;
-  int i, uind, denlen, numlen;
+  int i;
 
   if (power==0){
-    freeunit(theunit);
     initializeunit(theunit);
     return 0;
   }
-  numlen=0;
-  for(numptr=theunit->numerator;*numptr;numptr++) numlen++;
-  denlen=0;
-  for(denptr=theunit->denominator;*denptr;denptr++) denlen++;
-  thefactor=theunit->factor;
-  for(i=1;i<power;i++){
-    theunit->factor *= thefactor;
-    for(uind=0;uind<numlen;uind++){
-      if (theunit->numerator[uind]!=NULLUNIT){
-	if (numptr-theunit->numerator>MAXSUBUNITS-1) {
-           *numptr=*denptr=0;
-           return E_PRODOVERFLOW;
-	}
-        *numptr++=dupstr(theunit->numerator[uind]);
-      }
-    }
-    for(uind=0;uind<denlen;uind++){
-      if (theunit->denominator[uind]!=NULLUNIT){
-        *denptr++=dupstr(theunit->denominator[uind]);
-        if (denptr-theunit->denominator>MAXSUBUNITS-1) {
-          *numptr=*denptr=0;
-          return E_PRODOVERFLOW;
-	}
-      }   
-    }
-  }
-  *numptr=0;
-  *denptr=0;
+  for(i=0;i<MAXDIMS;i++)
+    if (abs(theunit->power[i]) > INT_MAX/power)
+      return E_PRODOVERFLOW;
+  theunit->factor = pow(theunit->factor, power);
+  for(i=0;i<MAXDIMS;i++)
+    theunit->power[i] *= power;
   return 0;
 }
 
@@ -1339,85 +2960,33 @@ int
 unit2num(struct unittype *input)
 {
   struct unittype one;
-  int err;
 
   initializeunit(&one);
-  if ((err=completereduce(input)))
-    return err;
-  if (compareunits(input,&one,ignore_nothing))
+  if (compareunits(input,&one))
     return E_NOTANUMBER;
-  freeunit(input);
   return 0;
 }
 
-/*
-void showunitdetail(struct unittype *foo)
-{
-  char **ptr;
-
-  printf("%.17g ", foo->factor);
-
-  for(ptr=foo->numerator;*ptr;ptr++)
-    if (*ptr==NULLUNIT) printf("NULL ");
-    else printf("`%s' ", *ptr);
-  printf(" / ");
-  for(ptr=foo->denominator;*ptr;ptr++)
-    if (*ptr==NULLUNIT) printf("NULL ");
-    else printf("`%s' ", *ptr);
-  putchar('\n');
-}
-*/
-
 
 /* 
-   The unitroot function takes the nth root of an input unit which has
-   been completely reduced.  Returns 1 if the unit is not a power of n. 
-   Input data can contain NULLUNITs.  
+   Take the nth root of a unit.  Returns E_NOTROOT if the unit is not a
+   power of n.
 */
 
-int 
-subunitroot(int n,char *in[], char *out[])
-{
-  char **ptr,**current;
-  int count;
-
-  for(current = in;*current && *current==NULLUNIT;current++);
-  count = 0;
-  for(ptr=in;*ptr;ptr++){
-    if (*ptr==NULLUNIT) continue;
-    if (count==n) {
-      *(out++)=dupstr(*current);
-      current = ptr;
-      count=0;
-    }
-    if (!strcmp(*current,*ptr)) count++;
-    else return E_NOTROOT;
-  }
-  if (count==n) *(out++)=dupstr(*current);
-  else if (count!=0) return E_NOTROOT;
-  *out = 0;
-  return 0;
-}
-
 int 
 rootunit(struct unittype *inunit,int n)
 {
-   struct unittype outunit;
-   int err; 
+   int i;
 
-   initializeunit(&outunit);
-   if ((err=completereduce(inunit)))
-     return err;
    /* Even numbered root with negative number would be complex */
    if ((n & 1)==0 && inunit->factor<0) return E_NOTROOT;
-   outunit.factor = pow(inunit->factor,1.0/(double)n);
-   if ((err = subunitroot(n, inunit->numerator, outunit.numerator)))
-     return err;
-   if ((err = subunitroot(n, inunit->denominator, outunit.denominator)))
-     return err;
-   freeunit(inunit);
-   initializeunit(inunit);
-   return multunit(inunit,&outunit);
+   for(i=0;i<MAXDIMS;i++)
+     if (inunit->power[i] % n)
+       return E_NOTROOT;
+   inunit->factor = pow(inunit->factor,1.0/(double)n);
+   for(i=0;i<MAXDIMS;i++)
+     inunit->power[i] /= n;
+   return 0;
 }
 
 
@@ -1426,20 +2995,11 @@ rootunit(struct unittype *inunit,int n)
 void
 invertunit(struct unittype *theunit)
 {
-  char **ptr, *swap;
-  int numlen, length, ind;
+  int i;
 
   theunit->factor = 1.0/theunit->factor;  
-  length=numlen=0;
-  for(ptr=theunit->denominator;*ptr;ptr++,length++);
-  for(ptr=theunit->numerator;*ptr;ptr++,numlen++);
-  if (numlen>length)
-    length=numlen;
-  for(ind=0;ind<=length;ind++){
-    swap = theunit->numerator[ind];
-    theunit->numerator[ind] = theunit->denominator[ind];
-    theunit->denominator[ind] = swap;
-  }
+  for(i=0;i<MAXDIMS;i++)
+    theunit->power[i] = -theunit->power[i];
 }
 
 /* Raise a unit to a power */
@@ -1454,12 +3014,15 @@ unitpower(struct unittype *base, struct unittype *exponent)
     return errcode;
   expnum = exponent->factor;
   if (floor(expnum)==expnum){ /* integer case */
+    if (fabs(expnum) > INT_MAX)
+      return E_PRODOVERFLOW;
     errcode = expunit(base,abs((int)expnum));
     if (errcode)
       return errcode;
     if (expnum<0)
       invertunit(base);
-  } else if (floor(1.0/expnum)==1.0/expnum) { /* root */
+  } else if (floor(1.0/expnum)==1.0/expnum
+             && fabs(1.0/expnum) <= INT_MAX) { /* root */
      expnum = 1/expnum;
      errcode = rootunit(base,abs((int)expnum));
      if (errcode)
@@ -1483,13 +3046,7 @@ unitpower(struct unittype *base, struct unittype *exponent)
 int
 addunit(struct unittype *unita, struct unittype *unitb)
 {
-  int err;
-
-  if ((err=completereduce(unita)))
-    return err;
-  if ((err=completereduce(unitb)))
-    return err;
-  if (compareunits(unita,unitb,ignore_nothing))
+  if (compareunits(unita,unitb))
     return E_BADSUM;
   unita->factor += unitb->factor;
   freeunit(unitb);
@@ -1510,7 +3067,8 @@ linearinterp(double  a, double b, double aval, double bval, double c)
 /* evaluate a user function */
 
 int
-evalfunc(struct unittype *theunit, struct func *infunc, int inverse)
+evalfunc(struct unitscontext *ctx, struct unittype *theunit, 
+         struct func *infunc, int inverse)
 {
    struct unittype result;
    struct functype *thefunc;
@@ -1521,7 +3079,7 @@ evalfunc(struct unittype *theunit, struct func *infunc, int inverse)
    char *save_function;
 
    if (infunc->table) {  /* Tables are short, so use dumb search algorithm */
-     err = parseunit(&result, infunc->tableunit, 0, 0);
+     err = parseunit(ctx, &result, infunc->tableunit, 0, 0);
      if (err)
        return E_BADTABLE;
      if (inverse){
@@ -1583,34 +3141,33 @@ evalfunc(struct unittype *theunit, struct func *infunc, int inverse)
      }
      else
        thefunc=&(infunc->forward);
-     err = completereduce(theunit);
+     err = completereduce(ctx, theunit);
      if (err)
        return err;
      if (thefunc->dimen){
-       err = parseunit(&result, thefunc->dimen, 0, 0);
+       err = parseunit(ctx, &result, thefunc->dimen, 0, 0);
        if (err)
 	 return E_BADTABLE;
-       err = completereduce(&result);
+       err = completereduce(ctx, &result);
        if (err)
 	 return E_BADTABLE;
-       if (compareunits(&result, theunit, ignore_nothing))
+       if (compareunits(&result, theunit))
 	 return E_BADFUNCARG;
      }
-     save_value = parameter_value;
-     save_function = function_parameter;
-     parameter_value = theunit;
-     function_parameter = thefunc->param;
-     err = parseunit(&result, thefunc->def, 0,0);
-     function_parameter = save_function;
-     parameter_value = save_value;
-     if (err==E_PARSEMEM) return err;
+     save_value = ctx->parameter_value;
+     save_function = ctx->function_parameter;
+     ctx->parameter_value = theunit;
+     ctx->function_parameter = thefunc->param;
+     err = parseunit(ctx, &result, thefunc->def, 0,0);
+     ctx->function_parameter = save_function;
+     ctx->parameter_value = save_value;
+     if (err==E_PARSEMEM || err==E_MEMORY) return err;
      if (err)
        return E_FUNARGDEF;
    }
    freeunit(theunit);
    initializeunit(theunit);
-   multunit(theunit, &result);
-   return 0;
+   return multunit(theunit, &result);
 }
 
 
@@ -1625,11 +3182,11 @@ showdefinition(char *unitstr, struct unittype *theunit)
 {
   unitstr = removepadding(unitstr);
   printf("%s",deftext);
-  unitstr = lookupunit(unitstr,1);
+  unitstr = lookupunit(mainctx,unitstr,1);
   while(unitstr && strspn(unitstr,"0123456789.") != strlen(unitstr) && 
 	!strchr(unitstr,PRIMITIVECHAR)) {
     printf("%s = ",unitstr);
-    unitstr=lookupunit(unitstr,1);
+    unitstr=lookupunit(mainctx,unitstr,1);
   } 
   showunit(theunit);
   putchar('\n');
@@ -1669,9 +3226,9 @@ showfunc(char *havestr, struct unittype *have, struct func *fun)
    int err;
    char *dimen;
 
-   err = evalfunc(have, fun, 1);
+   err = evalfunc(mainctx, have, fun, 1);
    if (!err)
-     err = completereduce(have);
+     err = completereduce(mainctx, have);
    if (err) {
      if (err==E_BADFUNCARG){
        printf("conformability error");
@@ -1695,8 +3252,8 @@ showfunc(char *havestr, struct unittype *have, struct func *fun)
 	 if (verbose==2) printf("\n\t%s = ",dimen);
 	 else if (verbose==1) printf("\n\t");
 	 else putchar('\n');
-	 parseunit(&want, dimen, 0, 0);
-	 completereduce(&want);
+	 parseunit(mainctx, &want, dimen, 0, 0);
+	 completereduce(mainctx, &want);
 	 showunit(&want);
 	 putchar('\n');
 	 }
@@ -1718,6 +3275,40 @@ showfunc(char *havestr, struct unittype *have, struct func *fun)
 }
 
 
+/* Makes 'inv' the reciprocal of 'theunit'. */
+
+void
+reciprocalunit(struct unittype *inv, struct unittype *theunit)
+{
+   *inv = *theunit;
+   invertunit(inv);
+}
+
+
+/* 
+   Decide how 'have' converts to 'want', which are units of 'db'.  Both
+   units must be completely reduced.  Returns 0 for an ordinary
+   conversion, 1 for a reciprocal conversion and -1 if the units are not
+   conformable.
+*/
+
+int
+conversiontype(struct unitsdata *db, struct unittype *have, 
+               struct unittype *want)
+{
+   struct unittype invhave;
+
+   if (!comparedims(db, have, want))
+     return 0;
+   if (strictconvert)
+     return -1;
+   reciprocalunit(&invhave, have);
+   if (comparedims(db, &invhave, want))
+     return -1;
+   return 1;
+}
+
+
 /* Show the conversion factors or print the conformability error message */
 
 int
@@ -1728,20 +3319,11 @@ showanswer(char *havestr,struct unittype *have,
    int doingrec;  /* reciprocal conversion? */
    char *sep = NULL, *right = NULL, *left = NULL;
 
-   doingrec=0;
    havestr = removepadding(havestr);
    wantstr = removepadding(wantstr);
-   if (compareunits(have, want, ignore_dimless)) {
-        char **src,**dest;
-
-        invhave.factor=1/have->factor;
-        for(src=have->numerator,dest=invhave.denominator;*src;src++,dest++)
-           *dest=*src;
-        *dest=0;
-        for(src=have->denominator,dest=invhave.numerator;*src;src++,dest++)
-           *dest=*src;
-        *dest=0;
-        if (strictconvert || compareunits(&invhave, want, ignore_dimless)){
+   doingrec = conversiontype(mainctx->db, have, want);
+   if (doingrec) {
+        if (doingrec<0){
 	  printf("conformability error\n");
 	  if (verbose==2) 
 	    printf("\t%s = ",havestr);
@@ -1761,8 +3343,8 @@ showanswer(char *havestr,struct unittype *have,
 	if (verbose>0)
 	  putchar('\t');
         printf("reciprocal conversion\n");
+        reciprocalunit(&invhave, have);
         have=&invhave;
-        doingrec=1;
    } 
    if (verbose==2) {
      if (strchr("0123456789.",wantstr[0]))
@@ -1808,8 +3390,270 @@ showanswer(char *havestr,struct unittype *have,
 }
 
 
+/* 
+   Process a unit for convertunits().  Returns 0 on success.  On failure
+   the error message is left in the result and 1 is returned.
+*/
+
+int
+convprocess(struct unitscontext *ctx, struct unittype *theunit, char *unitstr, 
+	    struct convresult *result)
+{
+  char *errmsg;
+  int err, len;
+
+  if ((err=parseunit(ctx, theunit, unitstr, &errmsg, 0)))
+    appendstring(&result->text, &result->textsize, errmsg);
+  else if ((err=completereduce(ctx, theunit)))
+    appendstring(&result->text, &result->textsize, errormsg[err]);
+  if (!err)
+    return 0;
+  if (err==E_UNKNOWNUNIT && ctx->irreducible){
+    appendstring(&result->text, &result->textsize, " '");
+    appendstring(&result->text, &result->textsize, ctx->irreducible);
+    appendstring(&result->text, &result->textsize, "'");
+    if (ctx->suggest){
+      len = strlen(result->text);
+      appendstring(&result->text, &result->textsize, "; ");
+      if (!suggestunits(ctx, ctx->irreducible, 
+                        &result->text, &result->textsize))
+        result->text[len] = 0;
+    }
+  }
+  result->type = CONV_ERROR;
+  return 1;
+}
+
+
+/*
+   Convert 'havestr' to 'wantstr' without printing anything.  This
+   computes the same answers as showanswer() and showfunc(), or the
+   reduced form of 'havestr' if 'wantstr' is null or blank, and stores
+   them in 'result'.  The text buffer in the result is reused, so the
+   same result structure can be passed to many calls.  Returns 0 on
+   success and 1 if the result is an error.
+*/
+
+int
+convertunits(struct unitscontext *ctx, char *havestr, char *wantstr, 
+             struct convresult *result)
+{
+  struct unittype have, want;
+  struct func *funcval;
+  int err, type;
+  char *dimen;
+
+  appendstring(&result->text, &result->textsize, "");
+  *result->text = 0;
+  result->factor = result->inverse = 0;
+  result->type = CONV_VALUE;
+
+  if ((funcval = isfunction(ctx, havestr))){
+    if (funcval->table){
+      appendstring(&result->text, &result->textsize, 
+                   "interpolated table ");
+      appendstring(&result->text, &result->textsize, funcval->name);
+    } else {
+      appendstring(&result->text, &result->textsize, funcval->name);
+      appendstring(&result->text, &result->textsize, "(");
+      appendstring(&result->text, &result->textsize, funcval->forward.param);
+      appendstring(&result->text, &result->textsize, ") = ");
+      appendstring(&result->text, &result->textsize, funcval->forward.def);
+    }
+    return 0;
+  }
+  if (convprocess(ctx, &have, havestr, result)){
+    freeunit(&have);
+    return 1;
+  }
+  if (!wantstr || isblankstr(wantstr)){
+    unitstring(ctx->db, &result->text, &result->textsize, &have);
+    freeunit(&have);
+    return 0;
+  }
+  if ((funcval = isfunction(ctx, wantstr))){
+    err = evalfunc(ctx, &have, funcval, 1);
+    if (!err)
+      err = completereduce(ctx, &have);
+    if (!err)
+      unitstring(ctx->db, &result->text, &result->textsize, &have);
+    else {
+      result->type = CONV_ERROR;
+      if (err==E_BADFUNCARG){
+        appendstring(&result->text, &result->textsize, "conformability error");
+        if (funcval->table)
+          dimen = funcval->tableunit;
+        else 
+          dimen = funcval->inverse.dimen;
+        if (dimen){
+          appendstring(&result->text, &result->textsize, 
+                       ": conversion requires dimensions of '");
+          appendstring(&result->text, &result->textsize, *dimen ? dimen : "1");
+          appendstring(&result->text, &result->textsize, "'");
+        }
+      } else if (err==E_NOTINDOMAIN){
+        appendstring(&result->text, &result->textsize, "Value '");
+        appendstring(&result->text, &result->textsize, removepadding(havestr));
+        appendstring(&result->text, &result->textsize, 
+                     "' is not in the table's range");
+      } else
+        appendstring(&result->text, &result->textsize, 
+                     "Function evaluation error (bad function definition)");
+    }
+    freeunit(&have);
+    return err!=0;
+  }
+  if (convprocess(ctx, &want, wantstr, result)){
+    freeunit(&have);
+    freeunit(&want);
+    return 1;
+  }
+  type = conversiontype(ctx->db, &have, &want);
+  if (type<0){
+    result->type = CONV_ERROR;
+    appendstring(&result->text, &result->textsize, "conformability error");
+  } else {
+    if (type){
+      result->type = CONV_RECIPROCAL;
+      have.factor = 1/have.factor;
+    } else
+      result->type = CONV_ANSWER;
+    result->factor = have.factor / want.factor;
+    result->inverse = want.factor / have.factor;
+  }
+  freeunit(&have);
+  freeunit(&want);
+  return type<0;
+}
+
+
+/*
+   Format a conversion result as a single line of text, terminated by a
+   newline, for machine consumption.  The line is one of
+
+        OK <tab> factor <tab> inverse factor
+        RECIPROCAL <tab> factor <tab> inverse factor
+        VALUE <tab> reduced unit or definition
+        ERROR <tab> message
+
+   The line is written into a buffer that is grown with growbuffer().
+*/
+
+char *
+formatresult(char **buf, int *bufsize, struct convresult *result)
+{
+  appendstring(buf, bufsize, "");
+  **buf = 0;
+  switch(result->type){
+    case CONV_ANSWER:
+    case CONV_RECIPROCAL:
+      appendstring(buf, bufsize, 
+                   result->type==CONV_ANSWER ? "OK\t" : "RECIPROCAL\t");
+      appendnumber(buf, bufsize, result->factor);
+      appendstring(buf, bufsize, "\t");
+      appendnumber(buf, bufsize, result->inverse);
+      break;
+    case CONV_VALUE:
+      appendstring(buf, bufsize, "VALUE\t");
+      appendstring(buf, bufsize, result->text);
+      break;
+    default:
+      appendstring(buf, bufsize, "ERROR\t");
+      appendstring(buf, bufsize, result->text);
+  }
+  appendstring(buf, bufsize, "\n");
+  return *buf;
+}
+
+
+/*
+   Batch mode: read lines of the form 'have<tab>want' from the named
+   file (or from stdin if the name is empty or '-') and write one line
+   in the format of formatresult() for each of them.  Errors are
+   reported in the output and do not stop processing.  Returns an exit
+   status for the program.
+*/
+
+int
+batchconvert(struct unitscontext *ctx, char *filename)
+{
+  FILE *infile;
+  struct convresult result;
+  char *line = 0, *output = 0, *want;
+  int linesize = 0, outputsize = 0, len;
+
+  if (!*filename || !strcmp(filename, "-"))
+    infile = stdin;
+  else if (!(infile = fopen(filename, "rt"))){
+    fprintf(stderr, "%s: unable to open batch input '%s'.  ",
+            progname, filename);
+    perror(0);
+    return 1;
+  }
+  setvbuf(stdout, 0, _IOFBF, BATCHBUFSIZE);
+  result.text = 0;
+  result.textsize = 0;
+  while (fgetslong(&line, &linesize, infile, 0)){
+    len = strlen(line);
+    if (len && line[len-1]=='\n')
+      line[--len] = 0;
+    if (len && line[len-1]=='\r')
+      line[--len] = 0;
+    if ((want = strchr(line, '\t')))
+      *want++ = 0;
+    convertunits(ctx, line, want, &result);
+    fputs(formatresult(&output, &outputsize, &result), stdout);
+  }
+  if (infile != stdin)
+    fclose(infile);
+  free(line);
+  free(output);
+  free(result.text);
+  if (fflush(stdout)){
+    perror(progname);
+    return 1;
+  }
+  return 0;
+}
+
+
+/* Output of the check of one unit, prefix or function.  The checks
+   run in parallel, so each one writes its messages here and they are
+   printed in order once all of the checks are done. */
+
+struct checkout {
+  char *text;
+  int size;
+};
+
+
+/* Appends a message in the style of printf() to 'out' */
+
+void
+checkprintf(struct checkout *out, char *format, ...)
+{
+  va_list args;
+  int len, count;
+
+  len = out->size ? strlen(out->text) : 0;
+  for(;;){
+    va_start(args, format);
+    count = vsnprintf(out->text + len, out->size - len, format, args);
+    va_end(args);
+    if (count>=0 && len + count < out->size)
+      return;
+    out->size = count>=0 ? len + count + 1 : 2*out->size + 80;
+    out->text = realloc(out->text, out->size);
+    if (!out->text){
+      fprintf(stderr, "%s: memory allocation error (checkprintf)\n",progname);
+      exit(3);
+    }
+  }
+}
+
+
 /* Checks that the function definition has a valid inverse 
-   Prints a message to stdout if function has bad definition or
+   Writes a message to 'out' if function has bad definition or
    invalid inverse. 
 */
 
@@ -1818,204 +3662,534 @@ showanswer(char *havestr,struct unittype *have,
                                 0 ))
 
 void
-checkfunc(struct func *infunc, int verbose)
+checkfunc(struct unitscontext *ctx, struct checkout *out, struct func *infunc,
+          int verbose)
 {
   struct unittype theunit, saveunit;
   int err, i;
   double direction;
 
   if (verbose)
-    printf("doing function '%s'\n", infunc->name);
+    checkprintf(out, "doing function '%s'\n", infunc->name);
   if (infunc->table){         /* Check for monotonicity which is needed for */
     if (infunc->tablelen<=1){ /* unique inverses */
-      printf("Table '%s' has only one data point\n", infunc->name);
+      checkprintf(out, "Table '%s' has only one data point\n", infunc->name);
       return;
     }
     direction = SIGN(infunc->table[1].value -  infunc->table[0].value);
     for(i=2;i<infunc->tablelen;i++)
       if (SIGN(infunc->table[i].value-infunc->table[i-1].value) != direction){
-	printf("Table '%s' lacks unique inverse around entry %.8g\n",
+	checkprintf(out, "Table '%s' lacks unique inverse around entry %.8g\n",
 	       infunc->name, infunc->table[i].location);
 	return;
       }
     return;
   }
   if (infunc->forward.dimen){
-    err = parseunit(&theunit, infunc->forward.dimen, 0, 0);
+    err = parseunit(ctx, &theunit, infunc->forward.dimen, 0, 0);
     if (err){
-      printf("Function '%s' has invalid type '%s'\n", 
+      checkprintf(out, "Function '%s' has invalid type '%s'\n", 
 	     infunc->name, infunc->forward.dimen);
       return;
     }
   } else initializeunit(&theunit);
   theunit.factor *= 7;   /* Arbitrary choice where we evaluate inverse */
   unitcopy(&saveunit, &theunit);
-  err = evalfunc(&theunit, infunc, 0);
+  err = evalfunc(ctx, &theunit, infunc, 0);
   if (err) {
-    printf("Error in definition %s(%s) as '%s'\n",
+    checkprintf(out, "Error in definition %s(%s) as '%s'\n",
 	   infunc->name, infunc->forward.param, infunc->forward.def);
     freeunit(&theunit);
     freeunit(&saveunit);
     return;
   }
   if (!(infunc->inverse.def)){
-    printf("Warning: no inverse for function '%s'\n", infunc->name);
+    checkprintf(out, "Warning: no inverse for function '%s'\n", infunc->name);
     freeunit(&theunit);
     freeunit(&saveunit);
     return;
   }
-  err = evalfunc(&theunit, infunc, 1);
+  err = evalfunc(ctx, &theunit, infunc, 1);
   if (err){
-    printf("Error in inverse ~%s(%s) as '%s'\n",
+    checkprintf(out, "Error in inverse ~%s(%s) as '%s'\n",
 	   infunc->name,infunc->inverse.param, infunc->inverse.def);
     freeunit(&theunit);
     freeunit(&saveunit);
     return;
   }
-  divunit(&theunit, &saveunit);
-  if (unit2num(&theunit) || fabs(theunit.factor-1)>1e-12)
-    printf("Inverse is not the inverse for function '%s'\n", infunc->name);
+  if (divunit(&theunit, &saveunit) || unit2num(&theunit) || fabs(theunit.factor-1)>1e-12)
+    checkprintf(out, "Inverse is not the inverse for function '%s'\n",
+                infunc->name);
   freeunit(&theunit);
 }
 
 
-/* 
-   Check that all units and prefixes are reducible to primitive units and that
-   function definitions are valid and have correct inverses.  A message is
-   printed for every unit that does not reduce to primitive units.
-
+/* Checks that the unit reduces to primitive units, and that it reduces
+   to the same thing whichever meaning '-' has. */
+
+void
+checkunit(struct unitscontext *ctx, struct checkout *out,
+          struct unitlist *uptr, int verbose)
+{
+  struct unittype have,second;
+
+  if (verbose)
+    checkprintf(out, "doing '%s'\n",uptr->name);
+  if (parseunit(ctx, &have, uptr->name,0,0) || completereduce(ctx, &have)){
+    if (isfunction(ctx, uptr->name)) 
+      checkprintf(out, "Unit '%s' hidden by function '%s'\n",
+                  uptr->name, uptr->name);
+    else
+      checkprintf(out, "'%s' defined as '%s' irreducible\n",
+                  uptr->name, uptr->value);
+  } else {
+    ctx->minusminus = !ctx->minusminus;
+    parseunit(ctx, &second, uptr->name, 0, 0);
+    completereduce(ctx, &second);
+    if (compareunits(&have, &second)){
+      checkprintf(out, "'%s': replace '-' with '+-' for subtraction or '*' to multiply\n", uptr->name);
+    }
+    freeunit(&second);
+    ctx->minusminus = !ctx->minusminus;
+  }
+  freeunit(&have);
+}
+
+
+/* Checks that the prefix reduces to primitive units and that its
+   definition has no '/' outside of parentheses. */
+
+void
+checkprefix(struct unitscontext *ctx, struct checkout *out,
+            struct prefixlist *pptr, int verbose)
+{
+  struct unittype have;
+  int plevel;
+  char *ch;
+
+  if (verbose)
+    checkprintf(out, "doing '%s'\n",pptr->name);
+  if (parseunit(ctx, &have, pptr->name,0,0) || completereduce(ctx, &have))
+    checkprintf(out, "'%s-' defined as '%s' irreducible\n",
+                pptr->name, pptr->value);
+  else { 
+    plevel = 0;    /* check for bad '/' character in prefix */
+    for(ch=pptr->value;*ch;ch++){
+      if (*ch==')') plevel--;
+      else if (*ch=='(') plevel++;
+      else if (plevel==0 && *ch=='/'){
+        checkprintf(out,
+          "'%s-' defined as '%s' contains a bad '/'. (Add parentheses.)\n",
+          pptr->name, pptr->value);
+        break;
+      }
+    }	    
+  }  
+  freeunit(&have);
+}
+
+
+/* The checks to be done by checkunits(): first the functions, then the
+   units, then the prefixes.  Each thread takes the next check from
+   'next' until all are done. */
+
+struct checklist {
+  struct func **funcs;
+  struct unitlist *units;
+  struct prefixlist *prefixes;
+  int funccount, unitcount, prefixcount;
+  struct checkout *out;        /* Output of each check, in the same order */
+  int verbose;
+  int next;
+#ifdef PTHREADS
+  pthread_mutex_t lock;
+#endif
+};
+
+struct checkthread {
+  struct checklist *list;
+  struct unitscontext *ctx;
+};
+
+
+void *
+checkworker(void *arg)
+{
+  struct checkthread *thread = (struct checkthread *) arg;
+  struct checklist *list = thread->list;
+  int i, total;
+
+  total = list->funccount + list->unitcount + list->prefixcount;
+  for(;;){
+#ifdef PTHREADS
+    pthread_mutex_lock(&list->lock);
+#endif
+    i = list->next++;
+#ifdef PTHREADS
+    pthread_mutex_unlock(&list->lock);
+#endif
+    if (i>=total)
+      break;
+    if (i<list->funccount)
+      checkfunc(thread->ctx, list->out+i, list->funcs[i], list->verbose);
+    else if (i-list->funccount < list->unitcount)
+      checkunit(thread->ctx, list->out+i, 
+                list->units + i-list->funccount, list->verbose);
+    else
+      checkprefix(thread->ctx, list->out+i,
+                  list->prefixes + i-list->funccount-list->unitcount,
+                  list->verbose);
+  }
+  return 0;
+}
+
+
+/* 
+   Check that all units and prefixes are reducible to primitive units and that
+   function definitions are valid and have correct inverses.  A message is
+   printed for every unit that does not reduce to primitive units.
+
+   The checks are shared among 'threads' threads, or one per processor
+   if 'threads' is zero, each with a context of its own.  The messages
+   are printed in the same order as when the checks are done one by one.
+*/
+
+void 
+checkunits(int verbosecheck, int threads)
+{
+  struct unitsdata *db;
+  struct checklist list;
+  struct checkthread *thread;
+  struct func *funcptr;
+  int i, total, started;
+#ifdef PTHREADS
+  pthread_t *tid;
+#endif
+
+  db = mainctx->db;
+  ustats(db, stdout);
+
+  list.funccount = 0;
+  for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next)
+    list.funccount++;
+  list.units = db->units;
+  list.unitcount = db->unitcount;
+  list.prefixes = db->prefixes;
+  list.prefixcount = db->prefixcount;
+  total = list.funccount + list.unitcount + list.prefixcount;
+  list.funcs = (struct func **) 
+    mymalloc((list.funccount+1)*sizeof(struct func *), "(checkunits)");
+  list.out = (struct checkout *)
+    mymalloc((total+1)*sizeof(struct checkout), "(checkunits)");
+  memset(list.out, 0, (total+1)*sizeof(struct checkout));
+  for(i=0,funcptr=db->firstfunc;funcptr;funcptr=funcptr->next)
+    list.funcs[i++] = funcptr;
+  list.verbose = verbosecheck;
+  list.next = 0;
+
+#ifdef PTHREADS
+  if (threads<=0){
+    threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads<=0)
+      threads = 1;
+  }
+  if (threads>total)
+    threads = total ? total : 1;
+#else
+  threads = 1;
+#endif
+  thread = (struct checkthread *)
+    mymalloc(threads*sizeof(struct checkthread), "(checkunits)");
+
+  /* The main context does the checks in the calling thread, and the
+     other threads each get a clone */
+
+  thread[0].list = &list;
+  thread[0].ctx = mainctx;
+  started = 1;
+#ifdef PTHREADS
+  pthread_mutex_init(&list.lock, 0);
+  tid = (pthread_t *) mymalloc(threads*sizeof(pthread_t), "(checkunits)");
+  for(;started<threads;started++){
+    thread[started].list = &list;
+    if (!(thread[started].ctx = units_clone(mainctx)))
+      break;
+    if (pthread_create(tid+started, 0, checkworker, thread+started)){
+      freecontext(thread[started].ctx);
+      break;
+    }
+  }
+#endif
+  checkworker(thread);
+#ifdef PTHREADS
+  for(i=1;i<started;i++){
+    pthread_join(tid[i], 0);
+    freecontext(thread[i].ctx);
+  }
+  pthread_mutex_destroy(&list.lock);
+  free(tid);
+#endif
+
+  for(i=0;i<total;i++)
+    if (list.out[i].text){
+      fputs(list.out[i].text, stdout);
+      free(list.out[i].text);
+    }
+  free(list.out);
+  free(list.funcs);
+  free(thread);
+}
+
+
+struct namedef { 
+  char *name;
+  char *def;
+};
+
+
+int 
+compnd(const void *a, const void *b)
+{
+  return strcmp(((struct namedef *)a)->name, ((struct namedef *)b)->name);
+}
+
+
+/*
+   Index of the units and functions by their dimensions, used to list
+   the units conformable with a unit.  It is built by conformindex()
+   the first time such a list is wanted.  Every unit and function is
+   reduced once, and those with the same dimensions, not counting the
+   dimensionless primitive units, are put in a group.  The members of
+   each group are kept together in conformlist, sorted by name, so the
+   list for a unit is found with one lookup in dimhash.  The index is
+   kept in the database (see struct unitsdata) and freed with it.
 */
 
+struct dimgroup {
+  int power[MAXDIMS];           /* Dimensions, with 0 for dimensionless */
+                                /* primitive units */
+  int first;                    /* Members are conformlist[first] to */
+  int count;                    /*    conformlist[first+count-1] */
+  int maxnamelen;               /* Widest member name */
+};
 
-void 
-checkunits(int verbosecheck)
+
+
+/* Sets 'power' to the dimensions of 'theunit' that count when units of
+   'db' are compared with comparedims() */
+
+void
+dimsignature(struct unitsdata *db, struct unittype *theunit, int *power)
 {
-  struct unittype have,second,one;
-  struct unitlist *uptr;
-  struct prefixlist *pptr;
-  struct func *funcptr;
   int i;
 
-  initializeunit(&one);
+  for(i=0;i<MAXDIMS;i++)
+    power[i] = !(db->primitiveflags[i] & SYM_DIMLESS) ? theunit->power[i] : 0;
+}
 
-  /* Check all functions for valid definition and correct inverse */
-  
-  for(funcptr=firstfunc;funcptr;funcptr=funcptr->next)
-    checkfunc(funcptr, verbosecheck);
-
-  /* Now check all units for validity */
-
-  for(i=0;i<HASHSIZE;i++)
-    for (uptr = utab[i]; uptr; uptr = uptr->next){
-      if (verbosecheck)
-        printf("doing '%s'\n",uptr->name);
-      if (parseunit(&have, uptr->name,0,0) 
-	  || completereduce(&have) 
-	  || compareunits(&have,&one, ignore_primitive)){
-	if (isfunction(uptr->name)) 
-	  printf("Unit '%s' hidden by function '%s'\n", uptr->name, uptr->name);
-	else
-	  printf("'%s' defined as '%s' irreducible\n",uptr->name, uptr->value);
-      } else {
-        minusminus = !minusminus;
-        parseunit(&second, uptr->name, 0, 0);
-        completereduce(&second);
-        if (compareunits(&have, &second, ignore_nothing)){
-	  printf("'%s': replace '-' with '+-' for subtraction or '*' to multiply\n", uptr->name);
-	}
-	freeunit(&second);
-        minusminus=!minusminus;
-      }
 
-      freeunit(&have);
-    }
+unsigned
+dimhashval(int *power)
+{
+  unsigned hashval = 2166136261u;
+  int i;
 
-  /* Check prefixes */ 
-
-  for(i=0;i<PREFIXTABSIZE;i++)
-    for(pptr = ptab[i]; pptr; pptr = pptr->next){
-      if (verbosecheck)
-        printf("doing '%s'\n",pptr->name);
-      if (parseunit(&have, pptr->name,0,0) 
-	  || completereduce(&have) || compareunits(&have,&one,ignore_primitive))
-	printf("'%s-' defined as '%s' irreducible\n",pptr->name, pptr->value);
-      else { 
-	int plevel;    /* check for bad '/' character in prefix */
-	char *ch;
-	plevel = 0;
-	for(ch=pptr->value;*ch;ch++){
-	  if (*ch==')') plevel--;
-	  else if (*ch=='(') plevel++;
-	  else if (plevel==0 && *ch=='/'){
-	    printf(
-              "'%s-' defined as '%s' contains a bad '/'. (Add parentheses.)\n",
-	      pptr->name, pptr->value);
-	    break;
-	  }
-	}	    
-      }  
-      freeunit(&have);
+  for(i=0;i<MAXDIMS;i++)
+    hashval = (hashval ^ (unsigned) power[i]) * 16777619u;
+  return hashval;
+}
+
+
+/* Returns the group of 'db' with dimensions 'power', or -1 if there is
+   none */
+
+int
+finddimgroup(struct unitsdata *db, int *power)
+{
+  unsigned i;
+
+  if (!db->dimhashsize)
+    return -1;
+  for(i=dimhashval(power) & (db->dimhashsize-1);db->dimhash[i]>=0;
+      i=(i+1) & (db->dimhashsize-1))
+    if (!memcmp(db->dimgroups[db->dimhash[i]].power, power, 
+                sizeof(int)*MAXDIMS))
+      return db->dimhash[i];
+  return -1;
+}
+
+
+/* Puts dimgroups[group] into the dimhash of 'db' */
+
+void
+placedimgroup(struct unitsdata *db, int group)
+{
+  unsigned i;
+
+  for(i=dimhashval(db->dimgroups[group].power) & (db->dimhashsize-1);
+      db->dimhash[i]>=0;i=(i+1) & (db->dimhashsize-1));
+  db->dimhash[i] = group;
+}
+
+
+/* Returns the group with dimensions 'power', adding it if needed, or
+   -1 if there is not enough memory to add it */
+
+int
+adddimgroup(struct unitsdata *db, int *power)
+{
+  struct dimgroup *newgroups;
+  int *newhash;
+  unsigned newsize;
+  int group;
+
+  if ((group = finddimgroup(db, power)) >= 0)
+    return group;
+  if (2*(db->dimgroupcount+1) > db->dimhashsize){
+    newsize = db->dimhashsize ? 2*db->dimhashsize : 256;
+    newhash = (int *) malloc(newsize*sizeof(int));
+    newgroups = newhash ? (struct dimgroup *) 
+      realloc(db->dimgroups, newsize/2*sizeof(struct dimgroup)) : 0;
+    if (!newgroups){
+      free(newhash);
+      return -1;
     }
+    free(db->dimhash);          /* Rebuilt from dimgroups below */
+    db->dimhash = newhash;
+    db->dimgroups = newgroups;
+    db->dimhashsize = newsize;
+    memset(db->dimhash, -1, db->dimhashsize*sizeof(int));
+    for(group=0;group<db->dimgroupcount;group++)
+      placedimgroup(db, group);
+  }
+  group = db->dimgroupcount++;
+  memcpy(db->dimgroups[group].power, power, sizeof(int)*MAXDIMS);
+  db->dimgroups[group].count = 0;
+  db->dimgroups[group].maxnamelen = 0;
+  placedimgroup(db, group);
+  return group;
 }
 
 
-struct namedef { 
-  char *name;
-  char *def;
+/* A unit or function waiting to be put in conformlist */
+
+struct conformentry {
+  struct namedef unit;
+  int group;
 };
-    
-#define CONFORMABLE 1
-#define TEXTMATCH 2
 
-void 
-addtolist(struct unittype *have, char *searchstring, char *rname, char *name, char *def, 
-	       struct namedef **list, int *listsize, int *maxnamelen, 
-	       int *count, int searchtype)
+
+/* Reduces 'name', which the unit 'rname' is reduced from, in 'ctx' and
+   adds 'rname' to the entries for conformindex().  Returns 0, or
+   E_MEMORY if there is not enough memory. */
+
+int
+addconformable(struct unitscontext *ctx, struct conformentry **entries, 
+               int *count, int *size, char *rname, char *name, char *def)
 {
+  struct unitsdata *db;
+  struct conformentry *entry, *newentries;
   struct unittype want;
-  int len = 0;
-  int keepit = 0;
+  int power[MAXDIMS];
+  int len, group;
 
-  if (!name) 
-    return;
-  if (searchtype==CONFORMABLE){
-    initializeunit(&want);
-    parseunit(&want, name,0,0);
-    completereduce(&want);
-    keepit = !compareunits(have,&want,ignore_dimless);
-  } else if (searchtype == TEXTMATCH) {
-    keepit = (strstr(rname,searchstring) != NULL);
-  }
-  if (keepit){
-    if (*count==*listsize){
-      *listsize += 100;
-      *list = (struct namedef *) 
-	realloc(*list,*listsize*sizeof(struct namedef));
-      if (!*list){
-	fprintf(stderr, "%s: memory allocation error (addtolist)\n",
-		progname);  
-	exit(3);
-      }
-    }
-    (*list)[*count].name = rname;
-    if (strchr(def, PRIMITIVECHAR))
-      (*list)[*count].def = "<primitive unit>";
-    else
-      (*list)[*count].def = def;
-    (*count)++;
-    len = strlen(name);
-    if (len>*maxnamelen)
-	  *maxnamelen = len;
+  if (!name)
+    return 0;
+  db = ctx->db;
+  initializeunit(&want);
+  parseunit(ctx, &want, name,0,0);
+  completereduce(ctx, &want);
+  dimsignature(db, &want, power);
+  freeunit(&want);
+  if (*count==*size){
+    newentries = (struct conformentry *) 
+      realloc(*entries, (*size ? 2 * *size : 1024)*sizeof(struct conformentry));
+    if (!newentries)
+      return E_MEMORY;
+    *entries = newentries;
+    *size = *size ? 2 * *size : 1024;
   }
-  if (searchtype == CONFORMABLE)
-    freeunit(&want);
+  if ((group = adddimgroup(db, power)) < 0)
+    return E_MEMORY;
+  entry = *entries + (*count)++;
+  entry->unit.name = rname;
+  if (strchr(def, PRIMITIVECHAR))
+    entry->unit.def = "<primitive unit>";
+  else
+    entry->unit.def = def;
+  entry->group = group;
+  db->dimgroups[group].count++;
+  len = strlen(name);
+  if (len>db->dimgroups[group].maxnamelen)
+    db->dimgroups[group].maxnamelen = len;
+  return 0;
 }
 
 
-int 
-compnd(const void *a, const void *b)
+/* Builds the index of the units of ctx->db by dimensions if it has not
+   been built.  Returns 0, or E_MEMORY if there is not enough memory, in
+   which case the index is left empty. */
+
+int
+conformindex(struct unitscontext *ctx)
 {
-  return strcmp(((struct namedef *)a)->name, ((struct namedef *)b)->name);
+  struct unitsdata *db;
+  struct conformentry *entries;
+  struct unitlist *uptr;
+  struct func *funcptr;
+  int count, size, i, *next, err;
+
+  db = ctx->db;
+  if (db->conformlist)
+    return 0;
+  entries = 0;
+  count = size = 0;
+  err = 0;
+  for(i=0,uptr=db->units;i<db->unitcount && !err;i++,uptr++)
+    err = addconformable(ctx, &entries, &count, &size, uptr->name, 
+                         uptr->name, uptr->value);
+  for(funcptr=db->firstfunc;funcptr && !err;funcptr=funcptr->next){
+    if (funcptr->table) 
+      err = addconformable(ctx, &entries, &count, &size, funcptr->name, 
+                           funcptr->tableunit, "<piecewise linear>");
+    else
+      err = addconformable(ctx, &entries, &count, &size, funcptr->name, 
+                           funcptr->inverse.dimen, "<nonlinear>");
+  }
+
+  /* Give each group a slice of conformlist and sort the slices */
+
+  next = 0;
+  if (!err){
+    db->conformlist = (struct namedef *) 
+      malloc((count+1)*sizeof(struct namedef));
+    next = (int *) malloc((db->dimgroupcount+1)*sizeof(int));
+  }
+  if (!db->conformlist || !next){
+    free(db->conformlist);
+    free(next);
+    free(entries);
+    free(db->dimgroups);
+    free(db->dimhash);
+    db->conformlist = 0;
+    db->dimgroups = 0;
+    db->dimhash = 0;
+    db->dimgroupcount = 0;
+    db->dimhashsize = 0;
+    return E_MEMORY;
+  }
+  for(i=0,size=0;i<db->dimgroupcount;i++){
+    db->dimgroups[i].first = next[i] = size;
+    size += db->dimgroups[i].count;
+  }
+  for(i=0;i<count;i++)
+    db->conformlist[next[entries[i].group]++] = entries[i].unit;
+  for(i=0;i<db->dimgroupcount;i++)
+    qsort(db->conformlist+db->dimgroups[i].first, db->dimgroups[i].count, 
+          sizeof(struct namedef), compnd);
+  free(next);
+  free(entries);
+  return 0;
 }
 
 
@@ -2029,51 +4203,13 @@ screensize()
 }
 
 
-/* 
-   If have is non-NULL then search through all units and print the ones
-   which are conformable with have.  Otherwise search through all the 
-   units for ones whose names contain the second argument as a substring.
-*/
+/* Prints the units in 'list', through the pager if there are many */
 
-void 
-tryallunits(struct unittype *have, char *searchstring)
+void
+showunitlist(struct namedef *list, int count, int maxnamelen)
 {
-  struct unitlist *uptr;
-  struct namedef *list;
-  int listsize, maxnamelen, count;
-  struct func *funcptr;
-  int i, j, searchtype;
   FILE *outfile;
-
-  list = (struct namedef *) mymalloc( 100 * sizeof(struct namedef), 
-				       "(tryallunits)");
-  listsize = 100;
-  maxnamelen = 0;
-  count = 0;
-
-  if (have)
-    searchtype = CONFORMABLE;
-  else {
-    if (!searchstring)
-      searchstring="";
-    searchtype = TEXTMATCH;
-  }
-
-  for(i=0;i<HASHSIZE;i++)
-    for (uptr = utab[i]; uptr; uptr = uptr->next)
-      addtolist(have, searchstring, uptr->name, uptr->name, uptr->value, 
-                &list, &listsize, &maxnamelen, &count, searchtype);
-  for(funcptr=firstfunc;funcptr;funcptr=funcptr->next){
-    if (funcptr->table) 
-      addtolist(have, searchstring, funcptr->name, funcptr->tableunit, 
-                "<piecewise linear>", &list, &listsize, &maxnamelen, &count, 
-                searchtype);
-    else
-      addtolist(have, searchstring, funcptr->name, funcptr->inverse.dimen, 
-                "<nonlinear>", &list, &listsize, &maxnamelen, &count, 
-                searchtype);
-  }
-  qsort(list, count, sizeof(struct namedef), compnd);
+  int i, j;
 
   outfile = 0;
   if (count==0)
@@ -2100,6 +4236,229 @@ tryallunits(struct unittype *have, char *searchstring)
 }
 
 
+/*
+   Index of the names of the units and functions for the search
+   command, built by searchindex() the first time it is used and kept
+   in the database.  searchlist holds the names in sorted order.
+   searchtext holds the same names separated by nulls, and searchsuffix
+   points to every suffix of every name in searchtext, sorted.  The
+   names that contain a string are the ones with a suffix beginning
+   with it, and those suffixes are next to each other in searchsuffix.
+*/
+
+struct searchentry {
+  struct namedef unit;
+  int width;                    /* Length used to align the list */
+};
+
+
+int
+compsuffix(const void *a, const void *b)
+{
+  return strcmp(*(char **)a, *(char **)b);
+}
+
+
+int
+compint(const void *a, const void *b)
+{
+  return *(int *)a - *(int *)b;
+}
+
+
+/* Adds the unit 'rname' to the entries for searchindex().  'name' is the
+   text whose length aligns the list.  Nothing is added when it is null.*/
+
+void
+addsearchname(struct searchentry **entries, int *count, int *size,
+              char *rname, char *name, char *def)
+{
+  struct searchentry *entry;
+
+  if (!name)
+    return;
+  if (*count==*size){
+    *size = *size ? 2 * *size : 1024;
+    *entries = (struct searchentry *) 
+      realloc(*entries, *size*sizeof(struct searchentry));
+    if (!*entries){
+      fprintf(stderr, "%s: memory allocation error (addsearchname)\n",
+              progname);  
+      exit(3);
+    }
+  }
+  entry = *entries + (*count)++;
+  entry->unit.name = rname;
+  if (strchr(def, PRIMITIVECHAR))
+    entry->unit.def = "<primitive unit>";
+  else
+    entry->unit.def = def;
+  entry->width = strlen(name);
+}
+
+
+/* Builds the index of the names in 'db' if it has not been built */
+
+void
+searchindex(struct unitsdata *db)
+{
+  struct searchentry *entries;
+  struct unitlist *uptr;
+  struct func *funcptr;
+  int count, size, i, len;
+  char *ch;
+
+  if (db->searchlist)
+    return;
+  entries = 0;
+  count = size = 0;
+  for(i=0,uptr=db->units;i<db->unitcount;i++,uptr++)
+    addsearchname(&entries, &count, &size, uptr->name, uptr->name, 
+                    uptr->value);
+  for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next){
+    if (funcptr->table) 
+      addsearchname(&entries, &count, &size, funcptr->name, 
+                    funcptr->tableunit, "<piecewise linear>");
+    else
+      addsearchname(&entries, &count, &size, funcptr->name, 
+                    funcptr->inverse.dimen, "<nonlinear>");
+  }
+  qsort(entries, count, sizeof(struct searchentry), compnd);
+
+  db->searchcount = count;
+  db->searchlist = (struct namedef *) 
+    mymalloc((count+1)*sizeof(struct namedef), "(searchindex)");
+  db->searchwidth = (int *) mymalloc((count+1)*sizeof(int), "(searchindex)");
+  db->searchmaxwidth = 0;
+  size = 0;
+  for(i=0;i<count;i++){
+    db->searchlist[i] = entries[i].unit;
+    db->searchwidth[i] = entries[i].width;
+    if (db->searchwidth[i]>db->searchmaxwidth)
+      db->searchmaxwidth = db->searchwidth[i];
+    size += strlen(db->searchlist[i].name) + 1;
+  }
+  free(entries);
+
+  db->searchtext = (char *) mymalloc(size+1, "(searchindex)");
+  db->searchowner = (int *) mymalloc((size+1)*sizeof(int), "(searchindex)");
+  db->searchsuffix = (char **) 
+    mymalloc((size+1)*sizeof(char *), "(searchindex)");
+  ch = db->searchtext;
+  db->suffixcount = 0;
+  for(i=0;i<count;i++){
+    len = strlen(db->searchlist[i].name);
+    strcpy(ch, db->searchlist[i].name);
+    for(size=0;size<=len;size++){
+      db->searchowner[ch-db->searchtext+size] = i;
+      if (size<len)
+        db->searchsuffix[db->suffixcount++] = ch+size;
+    }
+    ch += len+1;
+  }
+  qsort(db->searchsuffix, db->suffixcount, sizeof(char *), compsuffix);
+}
+
+
+/* Returns the index of the first suffix in db->searchsuffix that is not
+   less than the first 'len' characters of 'str', or if 'after' is set
+   the first one that does not begin with them and is greater. */
+
+int
+findsuffix(struct unitsdata *db, char *str, int len, int after)
+{
+  int low, high, mid, cmp;
+
+  low = 0;
+  high = db->suffixcount;
+  while (low<high){
+    mid = (low+high)/2;
+    cmp = strncmp(db->searchsuffix[mid], str, len);
+    if (cmp<0 || (after && cmp==0))
+      low = mid+1;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+
+/* Prints the units of 'db' whose names contain 'searchstring' */
+
+void
+searchunits(struct unitsdata *db, char *searchstring)
+{
+  struct namedef *list;
+  int *found;
+  int first, last, count, maxnamelen, len, i, name;
+
+  searchindex(db);
+  if (!*searchstring){
+    showunitlist(db->searchlist, db->searchcount, db->searchmaxwidth);
+    return;
+  }
+  len = strlen(searchstring);
+  first = findsuffix(db, searchstring, len, 0);
+  last = findsuffix(db, searchstring, len, 1);
+
+  /* A name may contain the string more than once, so the names found
+     are sorted and each is listed once */
+
+  found = (int *) mymalloc((last-first+1)*sizeof(int), "(searchunits)");
+  for(i=first;i<last;i++)
+    found[i-first] = db->searchowner[db->searchsuffix[i]-db->searchtext];
+  qsort(found, last-first, sizeof(int), compint);
+  list = (struct namedef *) 
+    mymalloc((last-first+1)*sizeof(struct namedef), "(searchunits)");
+  maxnamelen = 0;
+  count = 0;
+  for(i=0;i<last-first;i++){
+    name = found[i];
+    if (count && found[i-1]==name)
+      continue;
+    list[count++] = db->searchlist[name];
+    if (db->searchwidth[name]>maxnamelen)
+      maxnamelen = db->searchwidth[name];
+  }
+  showunitlist(list, count, maxnamelen);
+  free(list);
+  free(found);
+}
+
+
+/* 
+   If have is non-NULL then print the units which are conformable with
+   have, which are found with conformindex().  Otherwise print the
+   units whose names contain the second argument as a substring, which
+   are found with searchindex().
+*/
+
+void 
+tryallunits(struct unitscontext *ctx, struct unittype *have, 
+            char *searchstring)
+{
+  struct unitsdata *db;
+  int power[MAXDIMS];
+  int i;
+
+  db = ctx->db;
+  if (have){
+    if (conformindex(ctx)){
+      fprintf(stderr, "%s: memory allocation error (conformindex)\n",
+              progname);
+      return;
+    }
+    dimsignature(db, have, power);
+    if ((i = finddimgroup(db, power)) < 0)
+      showunitlist(0, 0, 0);
+    else
+      showunitlist(db->conformlist + db->dimgroups[i].first, 
+                   db->dimgroups[i].count, db->dimgroups[i].maxnamelen);
+  } else 
+    searchunits(db, searchstring ? searchstring : "");
+}
+
+
 /* print usage message */
 
 void 
@@ -2110,6 +4469,7 @@ usage()
 \n\
     -h, --help          print this help and exit\n\
     -c, --check         check that all units reduce to primitive units\n\
+        --compile-db[=file]  write a compiled units database and exit\n\
         --check-verbose like --check, but lists units as they are checked\n\
         --verbose-check   so you can find units that cause endless loops\n\
     -e, --exponential   exponential format output\n\
@@ -2122,6 +4482,16 @@ usage()
     -q, --quiet         supress prompting\n\
         --silent        same as --quiet\n\
     -s, --strict        suppress reciprocal unit conversion (e.g. Hz<->s)\n\
+        --batch[=file]  convert tab separated unit pairs read from file\n\
+                        or standard input, one result per line\n\
+        --server socket serve conversions on a Unix domain socket\n\
+        --threads n     use n worker threads for --server, --check and\n\
+                        reading units files\n\
+        --bulk          convert numbers read from standard input, one per\n\
+                        line, between the two units given as arguments\n\
+        --suggest       suggest names for unknown units with --batch or\n\
+                        --server\n\
+        --precompute    reduce every unit to primitive units at startup\n\
     -v, --verbose       print slightly more verbose output\n\
         --compact       suppress printing of tab, '*', and '/' character\n\
     -1, --one-line      suppress the second line of output\n\
@@ -2143,12 +4513,13 @@ helpmsg()
 void
 printversion()
 {
-  printf("GNU Units version %s\n%s, units database in %s\n\
+  printf("GNU Units version %s\n%s, units database %s%s\n\
 Copyright (C) 2006 Free Software Foundation, Inc.\n\
 GNU Units comes with ABSOLUTELY NO WARRANTY.\n\
 You may redistribute copies of GNU Units\n\
 under the terms of the GNU General Public License.\n\n", 
-	 VERSION, RVERSTR,UNITSFILE);
+	 VERSION, RVERSTR, builtindb() ? "built in" : "in ",
+         builtindb() ? "" : UNITSFILE);
 }
 
 
@@ -2178,84 +4549,138 @@ getuser(char **buffer, int *bufsize, char *query)
   }
 }
 
-/* Note:  What should this do?  
+/*
+   Names for completeunits(): the units, functions and prefixes in one
+   sorted array, built by completeindex() the first time a name is
+   completed and kept in the database.  The names that begin with some
+   text are next to each other and are found with a binary search.
+*/
+
+struct completename {
+  char *name;
+  int isunit;                   /* Set if the name can follow a prefix */
+};
+
+int
+compcomplete(const void *a, const void *b)
+{
+  return strcmp(((struct completename *)a)->name, 
+                ((struct completename *)b)->name);
+}
+
+
+/* Builds the list of names in 'db' for completeunits() */
+
+void
+completeindex(struct unitsdata *db)
+{
+  struct completename *list;
+  struct func *funcptr;
+  int i, count;
+
+  count = db->unitcount + db->prefixcount;
+  for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next)
+    count++;
+  list = (struct completename *) 
+    mymalloc((count+1)*sizeof(struct completename), "(completeindex)");
+  count = 0;
+  for(i=0;i<db->unitcount;i++){
+    list[count].name = db->units[i].name;
+    list[count++].isunit = 1;
+  }
+  for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next){
+    list[count].name = funcptr->name;
+    list[count++].isunit = 0;
+  }
+  for(i=0;i<db->prefixcount;i++){
+    list[count].name = db->prefixes[i].name;
+    list[count++].isunit = 0;
+  }
+  qsort(list, count, sizeof(struct completename), compcomplete);
+
+  /* A name may be both a unit and a function or prefix */
+
+  db->completecount = 0;
+  for(i=0;i<count;i++)
+    if (db->completecount && 
+        !strcmp(list[i].name, list[db->completecount-1].name))
+      list[db->completecount-1].isunit |= list[i].isunit;
+    else
+      list[db->completecount++] = list[i];
+  db->completelist = list;
+}
+
+
+/* Returns the index of the first name in db->completelist that is not
+   less than 'text', which is the first name beginning with it if any do */
 
-   Complete either to the end of a prefix or complete to the 
-   end of a unit.  Or if there is a full prefix plus part of a unit, 
-   and if that prefix is longer than one character
-   then complete that compound.  Don't complete a prefix fragment into
-   prefix plus anything.  
+int
+findcompletion(struct unitsdata *db, char *text)
+{
+  int low, high, mid;
+
+  low = 0;
+  high = db->completecount;
+  while (low<high){
+    mid = (low+high)/2;
+    if (strcmp(db->completelist[mid].name, text) < 0)
+      low = mid+1;
+    else
+      high = mid;
+  }
+  return low;
+}
 
-   Seems to be working right now...but one problem.  Completing a blank
-   entry always gets the cent sign.  Why is that?  My code seems to be
-   working ok....
 
-   One thing still needs to be done:  it won't complete a fragment into
-   a whole prefix.  It should be possible to type "myr<tab>" and
-   get "myria" for example.  
+/* 
+   Completes a unit name for readline.  The text is completed to the
+   name of a unit, function or prefix.  If it begins with a prefix
+   longer than one character, it is also completed to that prefix
+   followed by the name of a unit.
 */
    
 char *
 completeunits(char *text, int state)
 {
-  static struct prefixlist *curprefix;
-  static struct unitlist *curunit;
-  static int uhash;
-  static int checkfunctions;
-  static struct func *nextfunc;
-  char *output,*thistry;
-  
+  static struct prefixlist *prefix;
+  static int next, compound;
+  struct unitsdata *db;
+  struct completename *entry;
+  char *fragment, *output;
+  int len;
+
+  db = mainctx->db;
   if (!state){     /* state = 0 means this is the first call, so initialize */
-    checkfunctions=1;
-    nextfunc=firstfunc;
-    uhash = 0;
-    curprefix=0;
-    curunit=utab[uhash];
-  }
-  output = 0;
-  if (!nextfunc)
-    checkfunctions = 0;
-  while (!output){
-    if (checkfunctions){
-      if (nextfunc){
-	if (strlen(text)<=strlen(nextfunc->name) &&
-	    !strncmp(text,nextfunc->name,strlen(text))){
-	  output = dupstr(nextfunc->name);
-	}
-	nextfunc = nextfunc->next;
-	continue;
-      } else checkfunctions = 0;
-    }
-    while (!curunit && uhash<HASHSIZE-1){
-      uhash++;
-      curunit = utab[uhash];
-    }
-    if (!curunit) return 0;
-    thistry = text;
-    if (curprefix)
-       thistry+=curprefix->len;
-    if (strlen(thistry)<=strlen(curunit->name) && 
-           !strncmp(curunit->name,thistry,strlen(thistry))){
-       output = (char *)mymalloc(1 + strlen(curunit->name)
-                        + (curprefix ? curprefix->len:0),"(completeunits)");
-       strcpy(output,curprefix?curprefix->name:"");
-       strcat(output,curunit->name);
-    }
-    curunit = curunit->next;
-    while (!curunit && uhash<HASHSIZE-1){
-      uhash++;
-      curunit = utab[uhash];
-    }
-    if (!curunit && !curprefix){
-      if ((curprefix = plookup(text))){
-        if (strlen(curprefix->name)>1 && strlen(curprefix->name)<strlen(text)){
-          uhash = 0;
-          curunit = utab[uhash];
-        } else curprefix=0;
+    if (!db->completelist)
+      completeindex(db);
+    prefix = plookup(db, text);
+    if (prefix && !(prefix->len>1 && prefix->len<strlen(text)))
+      prefix = 0;
+    compound = 0;
+    next = findcompletion(db, text);
+  }
+  for(;;){
+    fragment = compound ? text + prefix->len : text;
+    len = strlen(fragment);
+    if (next<db->completecount && 
+        !strncmp(db->completelist[next].name, fragment, len)){
+      entry = db->completelist + next++;
+      if (!compound)
+        return dupstr(entry->name);
+      if (entry->isunit){
+        output = (char *) mymalloc(prefix->len + strlen(entry->name) + 1,
+                                   "(completeunits)");
+        strcpy(output, prefix->name);
+        strcat(output, entry->name);
+        return output;
       }
+    } else if (compound || !prefix)
+      return 0;
+    else {
+      compound = 1;
+      next = findcompletion(db, text + prefix->len);
     }
-  }    
-  return output;
+  }
 }
 
 #else /* We aren't using READLINE */
@@ -2280,6 +4705,8 @@ findunitsfile()
 {
   FILE *testfile;
   char *file = UNITSFILE;
+  if (builtindb())
+    return BUILTINFILE;
   testfile = fopen(file, "rt");
   if (!testfile) {
     char *direc, *env;
@@ -2341,6 +4768,12 @@ personalunitsfile()
 
 char *shortoptions = "Vvqechstf:o:mp1";
 
+#define COMPILEDBOPT 256        /* Return values for long only options */
+#define SERVEROPT 257
+#define THREADSOPT 258
+#define BATCHOPT 259
+#define BULKOPT 260
+
 struct option longoptions[] = {
   {"version", no_argument, 0, 'V'},
   {"quiet", no_argument, &quiet, 1},
@@ -2361,6 +4794,13 @@ struct option longoptions[] = {
   {"one-line", no_argument, &oneline, 1},
   {"oldstar", no_argument, &oldstar, 1},
   {"newstar", no_argument, &oldstar, 0},
+  {"compile-db", optional_argument, 0, COMPILEDBOPT},
+  {"server", required_argument, 0, SERVEROPT},
+  {"batch", optional_argument, 0, BATCHOPT},
+  {"threads", required_argument, 0, THREADSOPT},
+  {"bulk", no_argument, 0, BULKOPT},
+  {"suggest", no_argument, &suggest, 1},
+  {"precompute", no_argument, &precompute, 1},
   {0,0,0,0} };
 
 /* Process the args.  Returns 1 if interactive mode is desired, and 0
@@ -2428,6 +4868,24 @@ processargs(int argc, char **argv, char **from, char **to)
 	 case 'V':
  	    printversion();
 	    exit(3);
+         case COMPILEDBOPT:
+            dbcompile = optarg ? optarg : "";
+            break;
+         case SERVEROPT:
+            serversocket = optarg;
+            quiet = 1;
+            break;
+         case THREADSOPT:
+            numthreads = atoi(optarg);
+            break;
+         case BATCHOPT:
+            batchfile = optarg ? optarg : "";
+            quiet = 1;
+            break;
+         case BULKOPT:
+            bulkmode = 1;
+            quiet = 1;
+            break;
          case 0: break;  /* This is reached if a long option is 
                             processed with no return value set. */
          case '?':
@@ -2444,6 +4902,21 @@ processargs(int argc, char **argv, char **from, char **to)
        fprintf(stderr, "Too many arguments (arguments are not allowed with -c).\n");
        helpmsg();
      }
+   } else if (dbcompile || serversocket || batchfile) {
+     if (optind != argc){
+       fprintf(stderr, "Too many arguments (arguments are not allowed with %s).\n",
+               dbcompile ? "--compile-db" : 
+               serversocket ? "--server" : "--batch");
+       helpmsg();
+     }
+   } else if (bulkmode) {
+     if (optind != argc - 2){
+       fprintf(stderr, "Two units are required with --bulk.\n");
+       helpmsg();
+     }
+     *from = argv[optind];
+     *to = argv[optind+1];
+     return 0;
    } else {
      if (optind == argc - 2) {
         quiet=1;
@@ -2482,36 +4955,40 @@ processargs(int argc, char **argv, char **from, char **to)
 int 
 processunit(struct unittype *theunit, char *unitstr, char *prompt, int pointer)
 {
+  static char *suggestbuf = 0;
+  static int suggestbufsize = 0;
   char *errmsg;
   int errloc,err;
 
-  if ((err=parseunit(theunit, unitstr, &errmsg, &errloc))){
-    if (pointer){
-      if (err!=E_UNKNOWNUNIT || !irreducible){
-	if (!quiet) {
-          while(*prompt++) putchar(' ');
-	}
-	if (errloc>0)  
-	  while(--errloc) putchar(' ');
-	printf("^\n");
+  if ((err=parseunit(mainctx, theunit, unitstr, &errmsg, &errloc))){
+    if ((err==E_UNKNOWNUNIT && mainctx->irreducible) || err==E_REDUCE)
+      ;                  /* The error is in a unit, not in the input */
+    else if (pointer){
+      if (!quiet) {
+        while(*prompt++) putchar(' ');
       }
+      if (errloc>0)  
+        while(--errloc) putchar(' ');
+      printf("^\n");
     }
     else
       printf("Error in '%s': ", unitstr);
     printf("%s",errmsg);
-    if (err==E_UNKNOWNUNIT && irreducible)
-      printf(" '%s'", irreducible);
+    if (err==E_UNKNOWNUNIT && mainctx->irreducible){
+      printf(" '%s'", mainctx->irreducible);
+      if (mainctx->suggest && 
+          (mainctx->db->bktreecount || !suggestindex(mainctx->db))){
+        appendstring(&suggestbuf, &suggestbufsize, "");
+        *suggestbuf = 0;
+        if (suggestunits(mainctx, mainctx->irreducible, 
+                         &suggestbuf, &suggestbufsize))
+          printf("; %s", suggestbuf);
+      }
+    }
     putchar('\n');
 
     return 1;
   }
-  if ((err=completereduce(theunit))){
-    printf("%s",errormsg[err]);
-    if (err==E_UNKNOWNUNIT)
-      printf(" '%s'", irreducible);
-    putchar('\n');
-    return 1;
-  }
   return 0;
 }
 
@@ -2534,7 +5011,7 @@ ishelpquery(char *str, struct unittype *have)
   
   str=removepadding(str);
   if (have && !strcmp(str, UNITMATCH)){
-    tryallunits(have,0);
+    tryallunits(mainctx,have,0);
     return 1;
   }
   if (!strncmp(SEARCHCOMMAND,str,strlen(SEARCHCOMMAND))){
@@ -2548,7 +5025,7 @@ Type 'search text' to see a list of all unit names \n\
 containing 'text' as a substring\n\n");
       return 1;
     }
-    tryallunits(0,str);
+    tryallunits(mainctx,0,str);
     return 1;
   }
   if (!strncmp(HELPCOMMAND,str,strlen(HELPCOMMAND))){
@@ -2588,15 +5065,16 @@ Typing 'search text' will show units whose names contain 'text'.\n\n",
              UNITMATCH);
       return 1;
     }
-    if ((function = isfunction(str))){
+    if ((function = isfunction(mainctx, str))){
       file = function->file;
       unitline = function->linenumber;
     }
-    else if ((unit = ulookup(str))){
+    else if ((unit = ulookup(mainctx->db, str))){
       unitline = unit->linenumber;
       file = unit->file;
     }
-    else if ((prefix = plookup(str)) && strlen(str)==prefix->len){
+    else if ((prefix = plookup(mainctx->db, str)) && 
+             strlen(str)==prefix->len){
       unitline = prefix->linenumber;
       file = prefix->file;
     }
@@ -2625,7 +5103,8 @@ main(int argc, char **argv)
    int wantstrsize=0;   /* Only used if READLINE is undefined */
    int interactive;
    int readerr;
-   char **unitfileptr;
+   char *badfile;
+   char *dbfile;
    int unitcount=0, prefixcount=0, funccount=0;   /* for counting units */
 
 #ifdef READLINE
@@ -2660,29 +5139,86 @@ main(int argc, char **argv)
    if (!mylocale)
      mylocale = DEFAULTLOCALE;
 
-   for(unitfileptr=unitsfiles;*unitfileptr;unitfileptr++){      
-     readerr = readunits(*unitfileptr, stderr, &unitcount, &prefixcount, 
-			 &funccount, 0);
+   /* Use the compiled database if it is up to date, otherwise fall
+      back to reading the units files. */
+
+   dbfile = getenv(DBENV);
+   if (!dbfile)
+     dbfile = dbfilename(unitsfiles);
+
+   readerr = E_FILE;
+   if (!dbcompile)
+     readerr = loaddb(&database, dbfile, unitsfiles, 
+                      &unitcount, &prefixcount, &funccount);
+   if (readerr==E_MEMORY){
+     fprintf(stderr, "%s: memory allocation error (loaddb)\n", progname);
+     exit(3);
+   }
+   /* A single conversion only needs a few definitions, so they are read
+      lazily.  Other modes look at all of the units, or use threads. */
+
+   database.lazy = !interactive && !unitcheck && !dbcompile && !serversocket
+                   && !precompute;
+   database.threads = numthreads;
+   if (readerr){
+     readerr = readunitfiles(&database, unitsfiles, stderr, &unitcount, 
+                             &prefixcount, &funccount, &badfile);
      if (readerr==E_MEMORY) 
        exit(3);
+     if (readerr==E_PRIMITIVES)
+       exit(1);
      if (readerr==E_FILE){
        fprintf(stderr, "%s: unable to open units file '%s'.  ",
-	       progname, *unitfileptr);
+               progname, badfile);
        perror(0);
        exit(1);
      }
    }
 
+   if (dbcompile) {
+      if (*dbcompile)
+        dbfile = dbcompile;
+      if (compiledb(&database, dbfile, unitsfiles))
+        exit(1);
+      exit(0);
+   }
+
+   if (precompute && reduceall(&database, minusminus, oldstar)){
+     fprintf(stderr, "%s: memory allocation error (reduceall)\n", progname);
+     exit(3);
+   }
+
+   if (!(mainctx = newcontext(&database))){
+     fprintf(stderr, "%s: memory allocation error (main)\n", progname);
+     exit(3);
+   }
+   mainctx->minusminus = minusminus;
+   mainctx->oldstar = oldstar;
+   mainctx->suggest = !unitcheck && (suggest || (!batchfile && !serversocket));
+   if (suggest && suggestindex(&database)){
+     fprintf(stderr, "%s: memory allocation error (suggestindex)\n", progname);
+     exit(3);
+   }
+
    if (!quiet)
      printf("%d units, %d prefixes, %d nonlinear units\n\n", unitcount, prefixcount,
      funccount);
    if (unitcheck) {
-      checkunits(unitcheck==2 || verbose==2);
+      checkunits(unitcheck==2 || verbose==2, numthreads);
       exit(0);
    }
 
+   if (serversocket)
+      exit(runserver(mainctx, serversocket, numthreads));
+
+   if (batchfile)
+      exit(batchconvert(mainctx, batchfile));
+
+   if (bulkmode)
+      exit(bulkstream(mainctx, havestr, wantstr));
+
    if (!interactive) {
-      if ((funcval = isfunction(havestr))){
+      if ((funcval = isfunction(mainctx, havestr))){
 	showfuncdefinition(funcval);
   	exit(0);
       }
@@ -2692,7 +5228,7 @@ main(int argc, char **argv)
          showdefinition(havestr,&have);
          exit(0);
       }
-      if ((funcval = isfunction(wantstr))){
+      if ((funcval = isfunction(mainctx, wantstr))){
          if (showfunc(havestr, &have, funcval))
 	   exit(1);
 	 else
@@ -2712,9 +5248,9 @@ main(int argc, char **argv)
 	 do {
             getuser(&havestr,&havestrsize,queryhave);
 	 } while (isblankstr(havestr) || ishelpquery(havestr,0) ||
-		  (isfunction(havestr)==0 
+		  (isfunction(mainctx, havestr)==0 
 		  && processunit(&have, havestr, queryhave, POINT)));
-         if ((funcval = isfunction(havestr))){
+         if ((funcval = isfunction(mainctx, havestr))){
 	   showfuncdefinition(funcval);
 	   continue;
 	 }
@@ -2728,11 +5264,11 @@ main(int argc, char **argv)
 	       printf("%s%s\n",queryhave, havestr);
 	     }
 	   } while (repeat);
-	 } while (isfunction(wantstr)==0
+	 } while (isfunction(mainctx, wantstr)==0
 		  && processunit(&want, wantstr, querywant, POINT));
          if (isblankstr(wantstr))
            showdefinition(havestr,&have);
-         else if ((funcval = isfunction(wantstr)))
+         else if ((funcval = isfunction(mainctx, wantstr)))
            showfunc(havestr, &have, funcval);
 	 else {
            showanswer(havestr,&have,wantstr, &want);
@@ -2746,16 +5282,15 @@ main(int argc, char **argv)
 
 /* NOTES:
 
-mymalloc, growbuffer and tryallunits are the only places with print
-statements that should (?) be removed to make a library.  How can
-error reporting in these functions (memory allocation errors) be
-handled cleanly for a library implementation?  
+The conversion engine reports memory allocation errors with E_MEMORY
+and E_PARSEMEM, and so do the units_* functions of unitsapi.c, which
+use trygrowbuffer and tryappendstring.  mymalloc, growbuffer and the
+functions that use them (appendstring, fgetslong, tryallunits) still
+exit, so a library should avoid them or replace them.
 
 method of reporting the definition of a function or table:
   Is it ok as is?  Report inverses?
 
-functions allocated in linked list: could be bad if lots of functions
-
 completion that recognizes built in functions (?)
 
 Way to report the reduced form of the two operands of a sum when
@@ -19,6 +19,7 @@
  *  This program was written by Adrian Mariano (adrian@cam.cornell.edu)
  */
 
+#include <stdio.h>
 #include <math.h>
 #include <errno.h>
 
@@ -83,28 +84,54 @@ double strtod();
 #define E_FILE 16
 #define E_BADFILE 17
 #define E_MEMORY 18
+#define E_NOTCONFORMABLE 19
+#define E_PRIMITIVES 20
 
 #define WHITE " \t\n"
+#define DEFAULTLOCALE "en_US"   /* Default locale */
 
 extern char *errormsg[];
 
 /* 
-   Data type used to store a single unit being operated on. 
+   Data type used to store a single unit being operated on.  
 
-   The numerator and denominator arrays contain lists of units
-   (strings) which are terminated by a null pointer.  The special
-   string NULLUNIT is used to mark blank units that occur in the
-   middle of the list.  
+   Units are always kept completely reduced: a unit is a numerical
+   factor times a product of powers of the primitive units, which are
+   the units defined with '!' in the units data file.  The powers are
+   stored in a vector indexed by the primitive unit numbers assigned by
+   primitiveindex(), so the dimensions of any unit take a fixed amount
+   of space no matter how complicated the unit is.  The powers of the
+   numbers that the database does not use are zero.
 */
 
-extern char *NULLUNIT;
-
-#define MAXSUBUNITS 100		/* Size of internal unit reduction buffer */
+#define MAXDIMS 32              /* Most primitive units that can be used */
 
 struct unittype {
-   char *numerator[MAXSUBUNITS];
-   char *denominator[MAXSUBUNITS];
    double factor;
+   int power[MAXDIMS];          /* Exponent of each primitive unit */
+};
+
+/* Symbol tables of unit names */
+
+#define NOSYMBOL ((unsigned) -1)
+#define SYM_PRIMITIVE 1         /* Unit is defined with '!' */
+#define SYM_DIMLESS 2           /* Unit is defined as '!dimensionless' */
+#define SYM_OWNNAME 4           /* Name belongs to the table */
+
+struct symbol {
+   char *name;
+   unsigned flags;
+   int dim;                     /* Index in power vector, or -1 */
+   unsigned next;               /* Next symbol in hash chain */
+   struct unittype *value[4];   /* Cached values (see unitvalue()) */
+};
+
+struct symtable {
+   struct symbol *symbols;
+   unsigned count;
+   unsigned size;
+   unsigned *hash;              /* Heads of the hash chains */
+   unsigned hashsize;
 };
 
 
@@ -128,12 +155,160 @@ struct func {
   struct func *next;
   int linenumber;
   char *file;                  /* file where defined */ 
+  char *tabledef;              /* Table points not read yet (see addfile()) */
+};
+
+/* Unit definitions, kept in one array in the order defined and found
+   with a hash table (see ulookup()). */
+
+struct unitlist {
+   char *name;			/* unit name */
+   char *value;			/* unit value */
+   int linenumber;              /* line in units data file where defined */
+   char *file;                  /* file where defined */ 
+   char *source;                /* Untrimmed value, if value has not been */
+                                /*    set yet (see unitdef()) */
+   struct unittype *reduced;    /* Value in primitive units, if found by */
+                                /*    reduceall() */
+};
+
+struct unitslot {
+   unsigned hash;               /* uhash() of the unit name */
+   unsigned unit;               /* 1 + index of the unit in the array of */
+                                /*    units, or 0 if the slot is empty */
+};
+
+/* Prefix definitions, kept in one array in the order defined and found
+   with a trie (see plookup()). */
+
+struct prefixlist {
+   int len;			/* length of name string */
+   char *name;			/* prefix name */
+   char *value;			/* prefix value */
+   int linenumber;              /* line in units data file where defined */
+   char *file;                  /* file where defined */ 
 };
 
-extern struct unittype *parameter_value;
-extern char *function_parameter;
-extern int minusminus;
-extern int oldstar;
+/* BK-tree of unit and function names (see suggestunits()) */
+
+struct bknode {
+   char *name;
+   int distance;                /* Edit distance from the parent */
+   int prefixed;                /* Set if the name begins with a prefix */
+                                /*    (see prefixedname()) */
+   int child;                   /* First child, or 0 if none */
+   int sibling;                 /* Next sibling, or 0 if none */
+};
+
+/*
+   A units database: the tables built by readunits() or loaddb().  It
+   is written only while it is being loaded.  After that it is never
+   changed, so any number of contexts, in any number of threads, may
+   share it.  The exceptions are a database read lazily, which finishes
+   reading definitions as they are used and must only be used by one
+   thread, and the indexes that the interactive commands build the
+   first time they are wanted (see conformindex()).
+*/
+
+/* Memory that a database points into which nothing else owns, such as
+   the text of the units files (see keepblock()) */
+
+struct dbblock {
+   void *data;
+   size_t maplen;               /* Length if mapped with mmap(), else 0 */
+   struct dbblock *next;
+};
+
+struct unitsdata {
+   struct unitlist *units;      /* Units in the order defined */
+   unsigned unitcount;
+   unsigned unitsize;
+   struct unitslot *utab;       /* Unit names (see ulookup()) */
+   unsigned utabsize;           /* Number of slots, a power of two */
+   struct prefixlist *prefixes; /* Prefixes in the order defined */
+   int prefixcount;
+   int prefixsize;
+   struct prefixnode *ptrie;    /* Prefix names (see plookup()) */
+   int ptriesize;
+   int ptriecount;
+   struct funcslot *ftab;       /* Function names (see fnlookup()) */
+   unsigned ftabsize;
+   unsigned ftabcount;
+   struct func *firstfunc;      /* Functions in the order defined */
+   struct func *lastfunc;
+   struct symtable syms;        /* Unit names, with primitive units marked */
+   char *primitivename[MAXDIMS];   /* Names of the primitive units, */
+   unsigned primitiveflags[MAXDIMS];  /*    numbered by primitiveindex() */
+   int primitiveorder[MAXDIMS]; /* Primitive units sorted by name */
+   int primitivecount;
+   struct dbrecord *dbfiles;    /* Files and locales read, for */
+   struct dbrecord *dblocales;  /*    compiledb() */
+   struct dbblock *blocks;      /* Freed by freedatabase() */
+   struct bknode *bktree;       /* Names for suggestunits(), built by */
+   int bktreecount;             /*    suggestindex() after loading */
+   int bktreesize;
+   struct namedef *conformlist; /* Units sorted by dimensions, built */
+   struct dimgroup *dimgroups;  /*    by conformindex() when first */
+   int dimgroupcount;           /*    wanted */
+   int *dimhash;
+   unsigned dimhashsize;
+   struct namedef *searchlist;  /* Names for the search command, */
+   int *searchwidth;            /*    built by searchindex() when */
+   int searchcount;             /*    first wanted */
+   int searchmaxwidth;
+   char *searchtext;
+   int *searchowner;
+   char **searchsuffix;
+   int suffixcount;
+   struct completename *completelist;  /* Names for completeunits(), */
+   int completecount;           /*    built by completeindex() */
+   int lazy;                    /* Read definitions when first used */
+                                /*    (see readunits()) */
+   int threads;                 /* Threads used by readunits(), 0 for */
+                                /*    one per processor */
+   int reducedmode;             /* 1 + the mode (see unitvalue()) of the */
+                                /*    reduced values of the units, or 0 */
+};
+
+/*
+   A context holds everything that changes while units are converted.
+   A context must only be used by one thread at a time, but contexts
+   sharing a database may be used concurrently.
+*/
+
+struct unitscontext {
+   struct unitsdata *db;
+   int minusminus;              /* Does '-' character give subtraction */
+   int oldstar;                 /* Does '*' have higher precedence than '/' */
+   int suggest;                 /* Suggest names for unknown units */
+
+   /* Used for passing parameters to the parser when we are in the
+      process of parsing a unit function.  If function_parameter is
+      non-nil, then whenever the text in function_parameter appears in
+      a unit expression it is replaced by the unit value stored in
+      parameter_value. */
+
+   char *function_parameter;
+   struct unittype *parameter_value;
+
+   struct arenablock *firstblock;   /* Arena (see arenaalloc()) */
+   struct arenablock *curblock;
+   struct symtable cache;       /* Values of units (see unitvalue()) */
+   char *irreducible;           /* Name of last irreducible unit */
+   int irreduciblesize;
+   char *lookupbuf;             /* Answers from lookupunit() */
+   int lookupbufsize;
+   int parsedepth;              /* Nesting of parseunit() calls */
+   int reducedepth;             /* Nesting of unitvalue() calls */
+
+   int error;                   /* Code of the last error (unitsapi.c) */
+   char *errortext;             /* Message for the last error */
+   int errorsize;
+};
+
+extern char *progname;
+extern char *mylocale;
+extern char *numformat;
 
 void *mymalloc(int bytes,char *mesg);
 void initializeunit(struct unittype *theunit);
@@ -147,9 +322,159 @@ int addunit(struct unittype *unita, struct unittype *unitb);
 int rootunit(struct unittype *inunit,int n);
 int unitpower(struct unittype *base, struct unittype *exponent);
 char *dupstr(char *str);
+
+struct arenamark {
+  struct arenablock *block;
+  int used;
+};
+
+void *arenaalloc(struct unitscontext *ctx, int bytes);
+char *arenastr(struct unitscontext *ctx, char *str, int len);
+void arenamark(struct unitscontext *ctx, struct arenamark *mark);
+void arenarelease(struct unitscontext *ctx, struct arenamark *mark);
 int unit2num(struct unittype *input);
-struct func *fnlookup(const char *str, int length);
-int evalfunc(struct unittype *theunit, struct func *infunc, int inverse);
+struct func *fnlookup(struct unitsdata *db, const char *str, int length);
+int evalfunc(struct unitscontext *ctx, struct unittype *theunit, 
+             struct func *infunc, int inverse);
+
+int parseunit(struct unitscontext *ctx, struct unittype *output, char *input,
+              char **errstr, int *errloc);
+unsigned findsymbol(struct symtable *table, char *name);
+unsigned addsymbol(struct symtable *table, char *name, char *def);
+void freesymbols(struct symtable *table);
+int primitiveindex(struct unitsdata *db, char *name, unsigned flags);
+int toomanyprimitives(struct unitsdata *db, char *name, char *def);
+unsigned addunitsymbol(struct unitsdata *db, char *name, char *def);
+char *lookupunit(struct unitscontext *ctx, char *unit, int prefixok);
+int suggestindex(struct unitsdata *db);
+int suggestunits(struct unitscontext *ctx, char *name, char **buf, 
+                 int *bufsize);
+int unitvalue(struct unitscontext *ctx, struct unittype *theunit, char *name);
+void clearunitcache(struct unitscontext *ctx);
+int reduceall(struct unitsdata *db, int minusminus, int oldstar);
+int completereduce(struct unitscontext *ctx, struct unittype *unit);
+int compareunits(struct unittype *first, struct unittype *second);
+int comparedims(struct unitsdata *db, struct unittype *first, 
+                struct unittype *second);
+int conversiontype(struct unitsdata *db, struct unittype *have, 
+                   struct unittype *want);
+struct func *isfunction(struct unitscontext *ctx, char *str);
+struct unitscontext *newcontext(struct unitsdata *db);
+void freecontext(struct unitscontext *ctx);
+int keepblock(struct unitsdata *db, void *data, size_t maplen);
+void freedatabase(struct unitsdata *db);
+
+int reservebuffer(char **buf, int *bufsize, int size);
+int trygrowbuffer(char **buf, int *bufsize);
+void growbuffer(char **buf, int *bufsize);
+char *fgetslong(char **buf, int *bufsize, FILE *file, int *count);
+unsigned uhash(const char *str);
+struct unitlist *ulookup(struct unitsdata *db, const char *str);
+int uinsert(struct unitsdata *db, struct unitlist *unit);
+void ustats(struct unitsdata *db, FILE *out);
+int addfunction(struct unitsdata *db, struct func *newfunc);
+void clearfunctions(struct unitsdata *db);
+int addprefix(struct unitsdata *db, struct prefixlist *prefix);
+struct prefixlist *plookup(struct unitsdata *db, const char *str);
+void clearprefixes(struct unitsdata *db);
+int readunits(struct unitsdata *db, char *file, FILE *errfile, 
+              int *unitcount, int *prefixcount, int *funccount, int depth);
+int readunitfiles(struct unitsdata *db, char **files, FILE *errfile,
+                  int *unitcount, int *prefixcount, int *funccount,
+                  char **badfile);
+char *unitdef(struct unitlist *uptr);
+int readtable(struct func *func, char *text, FILE *errfile);
+
+/* Result of a conversion done by convertunits() */
+
+#define CONV_ANSWER 0           /* Conversion factors */
+#define CONV_RECIPROCAL 1       /* Conversion factors for the reciprocal */
+#define CONV_VALUE 2            /* Text holds a reduced unit or definition */
+#define CONV_ERROR 3            /* Text holds an error message */
+
+struct convresult {
+  int type;
+  double factor;                /* have / want */
+  double inverse;               /* want / have */
+  char *text;                   /* Buffer grown with growbuffer() */
+  int textsize;
+};
+
+int tryappendstring(char **buf, int *bufsize, char *str);
+void appendstring(char **buf, int *bufsize, char *str);
+void appendnumber(char **buf, int *bufsize, double num);
+char *unitstring(struct unitsdata *db, char **buf, int *bufsize, 
+                 struct unittype *theunit);
+int convertunits(struct unitscontext *ctx, char *havestr, char *wantstr, 
+                 struct convresult *result);
+char *formatresult(char **buf, int *bufsize, struct convresult *result);
+int batchconvert(struct unitscontext *ctx, char *filename);
+
+#define BATCHBUFSIZE 65536      /* Output buffer size in batch mode */
+
+/* Bulk conversion of arrays of numbers (bulk.c) */
+
+#define BULK_LINEAR 0           /* out = scale * in + offset */
+#define BULK_RECIPROCAL 1       /* out = scale / in */
+#define BULK_GENERAL 2          /* Each value is evaluated separately */
+
+struct bulkconv {
+  int type;
+  double scale;
+  double offset;
+  struct unitscontext *ctx;     /* Used only by BULK_GENERAL */
+  struct func *havefunc;
+  struct func *wantfunc;
+  struct unittype have;
+  struct unittype want;
+};
+
+int bulkprepare(struct unitscontext *ctx, struct bulkconv *conv, 
+                char *havestr, char *wantstr);
+long bulkapply(struct bulkconv *conv, const double *in, double *out, long n);
+void bulkfree(struct bulkconv *conv);
+int bulkconvert(struct unitscontext *ctx, char *havestr, char *wantstr, 
+                const double *in, double *out, long n);
+int bulkstream(struct unitscontext *ctx, char *havestr, char *wantstr);
+
+/* Interface for programs that call units directly (unitsapi.c) */
+
+struct unitshandle {
+  double factor;                /* out = factor * in + offset, or */
+  double offset;                /*   out = factor / in if reciprocal */
+  int reciprocal;
+  int nonlinear;                /* Numbers are converted one at a time */
+  struct bulkconv conv;
+};
+
+struct unitscontext *units_open(char **files);
+struct unitscontext *units_clone(struct unitscontext *ctx);
+void units_close(struct unitscontext *ctx);
+struct unitshandle *units_prepare(struct unitscontext *ctx, 
+                                  char *have, char *want);
+long units_apply(struct unitshandle *handle, 
+                 const double *in, double *out, long n);
+void units_free(struct unitshandle *handle);
+int units_errno(struct unitscontext *ctx);
+char *units_error(struct unitscontext *ctx);
+
+/* Conversion server (server.c) */
+
+int runserver(struct unitscontext *ctx, char *socketname, int threads);
+
+/* Compiled units database (unitsdb.c) */
+
+#define BUILTINFILE "<built-in>"  /* Units file name for the database */
+                                  /*    built into units (loadbuiltin()) */
 
-int parseunit(struct unittype *output, char *input,char **errstr,int *errloc);
+int dbnotefile(struct unitsdata *db, char *file);
+int dbnotelocale(struct unitsdata *db, char *locale);
+void dbfreenotes(struct unitsdata *db);
+char *dbfilename(char **files);
+int compiledb(struct unitsdata *db, char *dbfile, char **files);
+int loaddb(struct unitsdata *db, char *dbfile, char **files,
+           int *unitcount, int *prefixcount, int *funccount);
+int builtindb();
+int loadbuiltin(struct unitsdata *db, FILE *errfile,
+                int *unitcount, int *prefixcount, int *funccount);
 
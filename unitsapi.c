@@ -0,0 +1,250 @@
+/*
+ *  unitsapi.c: interface for programs that call GNU units directly
+ *  Copyright (C) 2010 Free Software Foundation, Inc
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *  This program was written by Adrian Mariano (adrian@cam.cornell.edu)
+ */
+
+#include "units.h"
+
+#ifdef PTHREADS
+#  include <pthread.h>
+#endif
+
+/*
+   A program that converts many numbers between the same two units
+   opens a context with units_open(), prepares the conversion once with
+   units_prepare() and then converts arrays of numbers with
+   units_apply() as often as it likes:
+
+        struct unitscontext *ctx;
+        struct unitshandle *conv;
+
+        ctx = units_open(files);
+        conv = units_prepare(ctx, "tempF", "tempC");
+        if (!conv)
+          fprintf(stderr, "%s\n", units_error(ctx));
+        units_apply(conv, in, out, n);
+        ...
+        units_free(conv);
+        units_close(ctx);
+
+   Preparing parses and reduces both units.  A prepared handle holds
+   everything units_apply() needs, so when the conversion is linear,
+   affine or reciprocal, units_apply() touches nothing but the handle
+   and may be called from many threads at once.
+
+   A context must only be used by one thread at a time.  A program that
+   converts in several threads gives each thread a context of its own
+   made with units_clone(), which shares the units read by the original
+   context instead of reading them again:
+
+        ctx = units_open(files);
+        for each thread
+          threadctx[i] = units_clone(ctx);
+
+   A handle for a conversion that is not affine uses the context it was
+   prepared with, so units_apply() for it must be called only by the
+   thread that owns that context.
+
+   The units read by units_open() are shared by all of the clones and
+   are never freed, unless units_open() fails, when it frees them with
+   freedatabase().  Each database numbers its own primitive units, and
+   the units files are read without any global state (the commands in
+   them are split with nextword(), not strtok()), so several threads may
+   call units_open() at the same time.
+*/
+
+
+/* Sets the locale from the environment unless the program has set it. */
+
+static void
+initlocale(void)
+{
+  if (!mylocale && !(mylocale = getenv("LOCALE")))
+    mylocale = DEFAULTLOCALE;
+}
+
+#ifdef PTHREADS
+static pthread_once_t localeonce = PTHREAD_ONCE_INIT;
+#endif
+
+
+/*
+   Opens a context with a new database read from 'files', a null
+   terminated list of units files.  Returns null if a file cannot be
+   read or if there is not enough memory.
+*/
+
+struct unitscontext *
+units_open(char **files)
+{
+  struct unitsdata *db;
+  struct unitscontext *ctx;
+  int unitcount=0, prefixcount=0, funccount=0, err;
+
+#ifdef PTHREADS
+  pthread_once(&localeonce, initlocale);
+#else
+  initlocale();
+#endif
+  db = (struct unitsdata *) malloc(sizeof(*db));
+  if (!db)
+    return 0;
+  memset(db, 0, sizeof(*db));
+  err = 0;
+  if (files)
+    err = readunitfiles(db, files, 0, &unitcount, &prefixcount, &funccount, 0);
+  if (err==E_FILE || err==E_MEMORY || err==E_PRIMITIVES || suggestindex(db) 
+      || !(ctx = newcontext(db))){
+    freedatabase(db);
+    free(db);
+    return 0;
+  }
+  return ctx;
+}
+
+
+/*
+   Opens another context using the same units as 'ctx'.  Returns null
+   if there is not enough memory.
+*/
+
+struct unitscontext *
+units_clone(struct unitscontext *ctx)
+{
+  struct unitscontext *clone;
+
+  if ((clone = newcontext(ctx->db))){
+    clone->minusminus = ctx->minusminus;
+    clone->oldstar = ctx->oldstar;
+    clone->suggest = ctx->suggest;
+  }
+  return clone;
+}
+
+
+void
+units_close(struct unitscontext *ctx)
+{
+  freecontext(ctx);
+}
+
+
+/* Describes the error in 'ctx' in ctx->errortext.  Returns E_MEMORY if
+   there is not enough memory for the description. */
+
+static int
+seterrortext(struct unitscontext *ctx)
+{
+  int count;
+
+  if (reservebuffer(&ctx->errortext, &ctx->errorsize, 1))
+    return E_MEMORY;
+  *ctx->errortext = 0;
+  if (tryappendstring(&ctx->errortext, &ctx->errorsize, errormsg[ctx->error]))
+    return E_MEMORY;
+  if (ctx->error==E_UNKNOWNUNIT && ctx->irreducible){
+    if (tryappendstring(&ctx->errortext, &ctx->errorsize, " '")
+        || tryappendstring(&ctx->errortext, &ctx->errorsize, ctx->irreducible)
+        || tryappendstring(&ctx->errortext, &ctx->errorsize, "'"))
+      return E_MEMORY;
+    if (ctx->suggest){
+      if (tryappendstring(&ctx->errortext, &ctx->errorsize, "; "))
+        return E_MEMORY;
+      count = suggestunits(ctx, ctx->irreducible, 
+                           &ctx->errortext, &ctx->errorsize);
+      if (count<0)
+        return E_MEMORY;
+      if (!count)
+        ctx->errortext[strlen(ctx->errortext)-2] = 0;
+    }
+  }
+  return 0;
+}
+
+
+/*
+   Prepares to convert numbers in the units 'have' into the units
+   'want'.  Either one may be a nonlinear unit, as for bulkprepare().
+   Returns a handle for units_apply(), or null if the conversion is not
+   possible, in which case units_error() describes the problem.
+*/
+
+struct unitshandle *
+units_prepare(struct unitscontext *ctx, char *have, char *want)
+{
+  struct unitshandle *handle;
+
+  handle = (struct unitshandle *) malloc(sizeof(*handle));
+  if (!handle)
+    ctx->error = E_MEMORY;
+  else
+    ctx->error = bulkprepare(ctx, &handle->conv, have, want);
+  if (ctx->error){
+    if (seterrortext(ctx))
+      ctx->error = E_MEMORY;
+    free(handle);
+    return 0;
+  }
+  handle->reciprocal = handle->conv.type==BULK_RECIPROCAL;
+  handle->nonlinear = handle->conv.type==BULK_GENERAL;
+  handle->factor = handle->conv.scale;
+  handle->offset = handle->conv.offset;
+  return handle;
+}
+
+
+/*
+   Converts the n numbers in 'in' and stores the answers in 'out',
+   which may be the same array.  Numbers that cannot be converted give
+   NaN.  Returns the number of them.
+*/
+
+long
+units_apply(struct unitshandle *handle, const double *in, double *out, long n)
+{
+  return bulkapply(&handle->conv, in, out, n);
+}
+
+
+void
+units_free(struct unitshandle *handle)
+{
+  bulkfree(&handle->conv);
+  free(handle);
+}
+
+
+/* Returns the code of the last error in 'ctx', or 0 if there was none */
+
+int
+units_errno(struct unitscontext *ctx)
+{
+  return ctx->error;
+}
+
+
+/* Returns a message describing the last error in 'ctx' */
+
+char *
+units_error(struct unitscontext *ctx)
+{
+  if (!ctx->error || ctx->error==E_MEMORY)
+    return errormsg[ctx->error];
+  return ctx->errortext;
+}
@@ -0,0 +1,886 @@
+/*
+ *  unitsdb.c: compiled units databases for GNU units
+ *  Copyright (C) 2010 Free Software Foundation, Inc
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ *  This program was written by Adrian Mariano (adrian@cam.cornell.edu)
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#  include <io.h>
+#  define NO_MMAP
+#else
+#  include <unistd.h>
+#endif
+
+#ifndef NO_MMAP
+#  include <sys/mman.h>
+#endif
+
+#ifndef O_BINARY
+#  define O_BINARY 0
+#endif
+
+#include "units.h"
+
+/*
+   A compiled database is an image of the unit, prefix and function
+   tables as they stand after readunits() has read the units files.
+   All references inside the image are byte offsets, so the image can
+   be mapped at any address and used in place: names, definitions and
+   table points are never copied out of it.
+
+   The image holds one variant of the tables for each locale named by
+   a !locale command, plus a default variant that is used for all other
+   locales.  It also records the size and modification time of every
+   file that was read, including !include files, so that an image that
+   is older than its sources can be detected and ignored.
+
+   The image is written in the native byte order and is not meant to
+   be moved between machines.
+
+   The image may also be written as C source and compiled into units
+   (see writesource()).  Such a program has the default units file built
+   in: findunitsfile() returns BUILTINFILE, which readunits() loads from
+   the image with loadbuiltin() instead of opening a file.
+*/
+
+#define DBMAGIC "GNUunits"
+#define DBVERSION 1
+#define DBBYTEORDER 0x01020304
+#define DBNONE (-1)             /* String offset that represents NULL */
+#define DBALIGN 8               /* Alignment of each section of the image */
+#define DBSUFFIX ".db"          /* Appended to units file name for image */
+#define DBSOURCE ".h"           /* Image is written as C source for a */
+                                /*    database name ending in this */
+
+struct dbheader {
+  char magic[8];
+  int version;
+  int byteorder;
+  int doublesize;
+  int size;                     /* Size of the complete image */
+  int strings;                  /* Offset of the string pool */
+  int stringsize;               /* Size of the string pool */
+  int topcount;                 /* Number of units files given to units */
+  int filecount;                /* Number of files read, with includes */
+  int files;                    /* Offset of struct dbfile array */
+  int variantcount;
+  int variants;                 /* Offset of struct dbvariant array */
+};
+
+struct dbfile {
+  int name;                     /* String offset of the file name */
+  int toplevel;                 /* Position in the units file list or -1 */
+  long size;                    /* Size and modification time when */
+  long mtime;                   /*   the image was compiled */
+};
+
+struct dbvariant {
+  int locale;                   /* Locale name, DBNONE for the default */
+  int unitcount, units;         /* Counts and array offsets */
+  int prefixcount, prefixes;
+  int funccount, funcs;
+};
+
+struct dbentry {                /* Used for both units and prefixes */
+  int name;
+  int value;
+  int linenumber;
+  int file;                     /* Index in the file array */
+};
+
+struct dbfunc {
+  int name;
+  int param, def, dimen;
+  int invparam, invdef, invdimen;
+  int tableunit;
+  int table;                    /* Offset of struct pair array */
+  int tablelen;
+  int linenumber;
+  int file;
+};
+
+#ifdef BUILTINDB
+#  include "unitsimage.h"       /* Defines builtinimage (see writesource()) */
+#endif
+
+
+/*
+   Files and locales encountered by readunits(), kept in the dbfiles
+   and dblocales lists of the database.  These are only used when
+   compiling a database.
+*/
+
+struct dbrecord {
+  char *name;
+  struct dbrecord *next;
+};
+
+
+/* Adds name to the end of list unless it is already present.  Returns
+   the position of name in the list, or -1 if there is not enough
+   memory. */
+
+static int
+addrecord(struct dbrecord **list, char *name)
+{
+  struct dbrecord *rec;
+  int index;
+
+  for(index=0; *list; list = &(*list)->next, index++)
+    if (!strcmp((*list)->name, name))
+      return index;
+  rec = (struct dbrecord *) malloc(sizeof(struct dbrecord));
+  if (!rec)
+    return -1;
+  if (!(rec->name = malloc(strlen(name)+1))){
+    free(rec);
+    return -1;
+  }
+  strcpy(rec->name, name);
+  rec->next = 0;
+  *list = rec;
+  return index;
+}
+
+/* Note a units file or locale read into 'db'.  These return E_MEMORY
+   if there is not enough memory. */
+
+int
+dbnotefile(struct unitsdata *db, char *file)
+{
+  return addrecord(&db->dbfiles, file) < 0 ? E_MEMORY : 0;
+}
+
+int
+dbnotelocale(struct unitsdata *db, char *locale)
+{
+  return addrecord(&db->dblocales, locale) < 0 ? E_MEMORY : 0;
+}
+
+/* Frees the lists of files and locales */
+
+void
+dbfreenotes(struct unitsdata *db)
+{
+  struct dbrecord *rec, *next;
+
+  for(rec=db->dbfiles;rec;rec=next){
+    next = rec->next;
+    free(rec->name);
+    free(rec);
+  }
+  for(rec=db->dblocales;rec;rec=next){
+    next = rec->next;
+    free(rec->name);
+    free(rec);
+  }
+  db->dbfiles = db->dblocales = 0;
+}
+
+
+/* Returns the default name of the compiled database for a list of
+   units files, or null if there is none. */
+
+char *
+dbfilename(char **files)
+{
+  char *name;
+
+  if (!files[0] || !strcmp(files[0], BUILTINFILE))
+    return 0;
+  name = mymalloc(strlen(files[0])+strlen(DBSUFFIX)+1,"(dbfilename)");
+  strcpy(name, files[0]);
+  strcat(name, DBSUFFIX);
+  return name;
+}
+
+
+/* Growable buffer used to assemble the image */
+
+struct dbbuffer {
+  char *data;
+  int len;
+  int size;
+  int nomemory;                 /* Set if the buffer could not grow */
+};
+
+/* Appends len bytes to the buffer, first padding the buffer to a
+   multiple of DBALIGN if align is set.  If data is null then zeros
+   are appended.  Returns the offset of the new data.  If the buffer
+   cannot grow then nothing more is appended to it, nomemory is set and
+   0 is returned. */
+
+static int
+dbappend(struct dbbuffer *buf, const void *data, int len, int align)
+{
+  char *newdata;
+  int offset;
+
+  if (buf->nomemory)
+    return 0;
+  offset = buf->len;
+  if (align)
+    offset = (offset + DBALIGN - 1) / DBALIGN * DBALIGN;
+  if (offset + len > buf->size){
+    newdata = realloc(buf->data, 2*(offset + len) + 1024);
+    if (!newdata){
+      buf->nomemory = 1;
+      return 0;
+    }
+    buf->data = newdata;
+    buf->size = 2*(offset + len) + 1024;
+  }
+  memset(buf->data + buf->len, 0, offset - buf->len);
+  if (data)
+    memcpy(buf->data + offset, data, len);
+  else
+    memset(buf->data + offset, 0, len);
+  buf->len = offset + len;
+  return offset;
+}
+
+static int
+dbstring(struct dbbuffer *pool, const char *str)
+{
+  if (!str)
+    return DBNONE;
+  return dbappend(pool, str, strlen(str)+1, 0);
+}
+
+
+/*
+   Append the current contents of the unit, prefix and function tables to
+   the image as a new variant.  The hash chains are written in order so
+   that loaddb() can rebuild them exactly.
+*/
+
+static void
+addvariant(struct unitsdata *db, struct dbbuffer *image, 
+           struct dbbuffer *pool, struct dbvariant *var)
+{
+  struct unitlist *uptr;
+  struct prefixlist *pptr;
+  struct func *funcptr;
+  struct dbentry entry;
+  struct dbfunc fentry;
+  int i, offset;
+
+  var->unitcount = 0;
+  var->units = dbappend(image, 0, 0, 1);
+  for(uptr=db->units;uptr<db->units+db->unitcount;uptr++){
+    entry.name = dbstring(pool, uptr->name);
+    entry.value = dbstring(pool, uptr->value);
+    entry.linenumber = uptr->linenumber;
+    if ((entry.file = addrecord(&db->dbfiles, uptr->file)) < 0)
+      image->nomemory = 1;
+    dbappend(image, &entry, sizeof(entry), 0);
+    var->unitcount++;
+  }
+
+  var->prefixcount = 0;
+  var->prefixes = dbappend(image, 0, 0, 1);
+  for(pptr=db->prefixes;pptr<db->prefixes+db->prefixcount;pptr++){
+    entry.name = dbstring(pool, pptr->name);
+    entry.value = dbstring(pool, pptr->value);
+    entry.linenumber = pptr->linenumber;
+    if ((entry.file = addrecord(&db->dbfiles, pptr->file)) < 0)
+      image->nomemory = 1;
+    dbappend(image, &entry, sizeof(entry), 0);
+    var->prefixcount++;
+  }
+
+  /* Only the fields which readunits() fills in for each kind of
+     function are written.  The others may be uninitialized. */
+
+  var->funccount = 0;
+  var->funcs = dbappend(image, 0, 0, 1);
+  for(funcptr=db->firstfunc;funcptr;funcptr=funcptr->next){
+    memset(&fentry, 0, sizeof(fentry));
+    fentry.name = dbstring(pool, funcptr->name);
+    fentry.param = fentry.def = fentry.dimen = DBNONE;
+    fentry.invparam = fentry.invdef = fentry.invdimen = DBNONE;
+    fentry.tableunit = DBNONE;
+    if (funcptr->table){
+      fentry.tableunit = dbstring(pool, funcptr->tableunit);
+      fentry.tablelen = funcptr->tablelen;
+    } else {
+      fentry.param = dbstring(pool, funcptr->forward.param);
+      fentry.def = dbstring(pool, funcptr->forward.def);
+      fentry.dimen = dbstring(pool, funcptr->forward.dimen);
+      fentry.invdef = dbstring(pool, funcptr->inverse.def);
+      fentry.invdimen = dbstring(pool, funcptr->inverse.dimen);
+      if (funcptr->inverse.def)
+        fentry.invparam = dbstring(pool, funcptr->inverse.param);
+    }
+    fentry.linenumber = funcptr->linenumber;
+    if ((fentry.file = addrecord(&db->dbfiles, funcptr->file)) < 0)
+      image->nomemory = 1;
+    dbappend(image, &fentry, sizeof(fentry), 0);
+    var->funccount++;
+  }
+  for(i=0,funcptr=db->firstfunc;funcptr;funcptr=funcptr->next,i++)
+    if (funcptr->table){
+      offset = dbappend(image, funcptr->table,
+                        funcptr->tablelen*sizeof(struct pair), 1);
+      if (!image->nomemory)
+        ((struct dbfunc *)(image->data + var->funcs))[i].table = offset;
+    }
+}
+
+
+/* Empties the unit, prefix and function tables.  The memory is not
+   reclaimed: this is only used by compiledb(), after which the program
+   exits. */
+
+static void
+cleartables(struct unitsdata *db)
+{
+  unsigned sym;
+
+  if (db->utabsize)
+    memset(db->utab, 0, db->utabsize*sizeof(struct unitslot));
+  db->unitcount = 0;
+  clearprefixes(db);
+  clearfunctions(db);
+  for(sym=0;sym<db->syms.count;sym++)   /* Set again as the units are */
+    db->syms.symbols[sym].flags = 0;    /* reloaded */
+}
+
+
+/* Writes the image in 'data' to 'out' as C source defining builtinimage.
+   The image follows a double so that its tables of points are aligned.
+   Returns nonzero if the source could not be written. */
+
+static int
+writesource(FILE *out, unsigned char *data, int len)
+{
+  int i;
+
+  fprintf(out, "/* Units database written by %s --compile-db.  "
+          "Do not edit. */\n\n", progname);
+  fprintf(out, "static const struct {\n  double align;\n"
+          "  unsigned char data[%d];\n} builtinimage = { 0, {\n", len);
+  for(i=0;i<len;i++)
+    fprintf(out, i==len-1 ? "%d\n" : i%20==19 ? "%d,\n" : "%d,", data[i]);
+  fprintf(out, "}};\n");
+  return ferror(out);
+}
+
+
+/*
+   Compile the units files listed in the null terminated list files into
+   a database image and write it to dbfile.  If dbfile ends in DBSOURCE
+   then the image is written as C source for building into units.  The
+   files are read once for the default variant and once for each locale
+   that they mention.  On return the tables hold an arbitrary variant.
+   Returns zero on success or an error code after printing a message to
+   stderr.
+*/
+
+int
+compiledb(struct unitsdata *db, char *dbfile, char **files)
+{
+  struct dbbuffer image, pool;
+  struct dbheader header;
+  struct dbvariant *variants, *newvariants;
+  struct dbrecord *loc, *rec;
+  struct dbfile fentry;
+  struct stat statbuf;
+  char *savelocale, **fileptr;
+  int varcount, varalloc, unitcount, prefixcount, funccount, i, readerr;
+  FILE *out;
+
+  image.data = pool.data = 0;
+  image.len = image.size = pool.len = pool.size = 0;
+  image.nomemory = pool.nomemory = 0;
+  dbappend(&image, 0, sizeof(header), 1);
+  varcount = 0;
+  varalloc = 4;
+  variants = (struct dbvariant *) malloc(varalloc*sizeof(struct dbvariant));
+  if (!variants)
+    goto nomemory;
+  savelocale = mylocale;
+
+  /* The default variant comes first.  Reading it fills in the list of
+     locales, which may grow further as the locale variants are read. */
+
+  loc = 0;
+  do {
+    cleartables(db);
+    mylocale = loc ? loc->name : "";
+    unitcount = prefixcount = funccount = 0;
+    for(fileptr=files;*fileptr;fileptr++){
+      readerr = readunits(db, *fileptr, 0, &unitcount, &prefixcount,
+                          &funccount, 0);
+      if (readerr==E_MEMORY || readerr==E_FILE || readerr==E_PRIMITIVES){
+        fprintf(stderr, "%s: unable to read units file '%s' for database\n",
+                progname, *fileptr);
+        mylocale = savelocale;
+        return readerr;
+      }
+    }
+    if (varcount==varalloc){
+      newvariants = (struct dbvariant *)
+        realloc(variants, 2*varalloc*sizeof(struct dbvariant));
+      if (!newvariants){
+        mylocale = savelocale;
+        goto nomemory;
+      }
+      variants = newvariants;
+      varalloc *= 2;
+    }
+    variants[varcount].locale = loc ? dbstring(&pool, loc->name) : DBNONE;
+    addvariant(db, &image, &pool, variants+varcount);
+    varcount++;
+    loc = loc ? loc->next : db->dblocales;
+  } while (loc);
+  mylocale = savelocale;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, DBMAGIC, sizeof(header.magic));
+  header.version = DBVERSION;
+  header.byteorder = DBBYTEORDER;
+  header.doublesize = sizeof(double);
+  header.variantcount = varcount;
+  header.variants = dbappend(&image, variants,
+                             varcount*sizeof(struct dbvariant), 1);
+  free(variants);
+  variants = 0;
+
+  header.filecount = 0;
+  header.topcount = 0;
+  header.files = dbappend(&image, 0, 0, 1);
+  for(rec=db->dbfiles;rec;rec=rec->next){
+    if (stat(rec->name, &statbuf)){
+      fprintf(stderr, "%s: unable to stat '%s' for database.  ",
+              progname, rec->name);
+      perror(0);
+      return E_FILE;
+    }
+    fentry.name = dbstring(&pool, rec->name);
+    fentry.toplevel = -1;
+    for(i=0;files[i];i++)
+      if (!strcmp(files[i], rec->name)){
+        fentry.toplevel = i;
+        header.topcount++;
+        break;
+      }
+    fentry.size = (long) statbuf.st_size;
+    fentry.mtime = (long) statbuf.st_mtime;
+    dbappend(&image, &fentry, sizeof(fentry), 0);
+    header.filecount++;
+  }
+
+  header.stringsize = pool.len;
+  header.strings = dbappend(&image, pool.data, pool.len, 1);
+  header.size = image.len;
+  if (image.nomemory || pool.nomemory)
+    goto nomemory;
+  memcpy(image.data, &header, sizeof(header));
+  free(pool.data);
+
+  i = strlen(dbfile) - strlen(DBSOURCE);
+  if (i>0 && !strcmp(dbfile+i, DBSOURCE)){
+    out = fopen(dbfile, "w");
+    if (out && writesource(out, (unsigned char *)image.data, image.len)){
+      fclose(out);
+      out = 0;
+    }
+  } else {
+    out = fopen(dbfile, "wb");
+    if (out && fwrite(image.data, 1, image.len, out)!=image.len){
+      fclose(out);
+      out = 0;
+    }
+  }
+  if (!out || fclose(out)){
+    fprintf(stderr, "%s: unable to write units database '%s'.  ",
+            progname, dbfile);
+    perror(0);
+    free(image.data);
+    return E_FILE;
+  }
+  free(image.data);
+  return 0;
+
+ nomemory:
+  fprintf(stderr, "%s: memory allocation error (compiledb)\n", progname);
+  free(variants);
+  free(image.data);
+  free(pool.data);
+  return E_MEMORY;
+}
+
+
+/* Returns 1 if the image is consistent and up to date with respect to
+   the units files named in files, and 0 otherwise.  If files is null
+   then only the consistency of the image is checked. */
+
+static int
+checkimage(char *image, int size, char **files)
+{
+  struct dbheader *header;
+  struct dbfile *file;
+  struct dbvariant *var;
+  struct dbfunc *func;
+  struct stat statbuf;
+  char *name;
+  int i, j, topcount;
+
+  header = (struct dbheader *)image;
+  if (size < sizeof(struct dbheader)
+      || memcmp(header->magic, DBMAGIC, sizeof(header->magic))
+      || header->version != DBVERSION
+      || header->byteorder != DBBYTEORDER
+      || header->doublesize != sizeof(double)
+      || header->size != size
+      || header->strings < 0 || header->stringsize <= 0
+      || header->strings + header->stringsize > size
+      || image[header->strings + header->stringsize - 1]
+      || header->files < 0 || header->filecount < 0
+      || header->files + header->filecount*sizeof(struct dbfile) > size
+      || header->variants < 0 || header->variantcount < 0
+      || header->variants + header->variantcount*sizeof(struct dbvariant)
+           > size)
+    return 0;
+  for(i=0;i<header->variantcount;i++){
+    var = (struct dbvariant *)(image + header->variants) + i;
+    if (var->units < 0 || var->prefixes < 0 || var->funcs < 0
+        || var->units + var->unitcount*sizeof(struct dbentry) > size
+        || var->prefixes + var->prefixcount*sizeof(struct dbentry) > size
+        || var->funcs + var->funccount*sizeof(struct dbfunc) > size)
+      return 0;
+    for(j=0;j<var->funccount;j++){
+      func = (struct dbfunc *)(image + var->funcs) + j;
+      if (func->tableunit != DBNONE
+          && (func->table <= 0 || func->table % DBALIGN
+              || func->tablelen < 0
+              || func->table + func->tablelen*sizeof(struct pair) > size))
+        return 0;
+    }
+  }
+
+  /* The image must have been built from the same list of files and
+     none of them may have changed since. */
+
+  if (!files)
+    return 1;
+  for(topcount=0;files[topcount];topcount++);
+  if (topcount != header->topcount)
+    return 0;
+  for(i=0;i<header->filecount;i++){
+    file = (struct dbfile *)(image + header->files) + i;
+    if (file->name < 0 || file->name >= header->stringsize)
+      return 0;
+    name = image + header->strings + file->name;
+    if (file->toplevel >= topcount
+        || (file->toplevel >= 0 && strcmp(name, files[file->toplevel])))
+      return 0;
+    if (stat(name, &statbuf)
+        || (long)statbuf.st_size != file->size
+        || (long)statbuf.st_mtime != file->mtime)
+      return 0;
+  }
+  return 1;
+}
+
+
+/* Returns the string at offset in the pool or null for DBNONE.  Bad
+   offsets are mapped to the empty string at the end of the pool. */
+
+static char *
+dbstr(struct dbheader *header, int offset)
+{
+  char *pool;
+
+  if (offset == DBNONE)
+    return 0;
+  pool = (char *)header + header->strings;
+  if (offset < 0 || offset >= header->stringsize)
+    return pool + header->stringsize - 1;
+  return pool + offset;
+}
+
+
+/*
+   Add the variant of the image at header for the current locale to
+   the tables.  A name that is already defined keeps its definition and
+   the new one is reported on errfile, unless it is null, as readunits()
+   does.  The counts are incremented as readunits() does.  Returns zero,
+   E_BADFILE if any names were already defined or if the image has no
+   variant for the locale, E_PRIMITIVES if it would number too many
+   primitive units, or E_MEMORY if the tables cannot grow.
+*/
+
+static int
+loadimage(struct unitsdata *db, struct dbheader *header, FILE *errfile,
+          int *unitcount, int *prefixcount, int *funccount)
+{
+  struct dbvariant *var, *defvar;
+  struct dbentry *entry;
+  struct dbfunc *fentry;
+  struct unitlist unit;
+  struct prefixlist prefix, *oldprefix;
+  struct func *funcs;
+  char *image, **filenames, *locale;
+  int i, goterr, count;
+
+  image = (char *)header;
+
+  /* Choose the variant for the current locale */
+
+  var = defvar = 0;
+  for(i=0;i<header->variantcount;i++){
+    var = (struct dbvariant *)(image + header->variants) + i;
+    locale = dbstr(header, var->locale);
+    if (!locale)
+      defvar = var;
+    else if (!strcmp(locale, mylocale))
+      break;
+  }
+  if (i==header->variantcount)
+    var = defvar;
+  if (!var)
+    return E_BADFILE;
+
+  filenames = (char **) malloc((header->filecount+1)*sizeof(char *));
+  if (!filenames || keepblock(db, filenames, 0))
+    return E_MEMORY;
+  for(i=0;i<header->filecount;i++)
+    filenames[i] = dbstr(header,
+                         ((struct dbfile *)(image+header->files))[i].name);
+  filenames[header->filecount] = "";
+
+  goterr = 0;
+  count = 0;
+  entry = (struct dbentry *)(image + var->units);
+  for(i=0;i<var->unitcount;i++,entry++){    /* uinsert() copies the unit */
+    unit.name = dbstr(header, entry->name);
+    unit.value = dbstr(header, entry->value);
+    unit.source = 0;
+    unit.reduced = 0;
+    unit.linenumber = entry->linenumber;
+    unit.file = filenames[(unsigned)entry->file < header->filecount ?
+                          entry->file : header->filecount];
+    if (ulookup(db, unit.name)){
+      if (errfile)
+        fprintf(errfile,
+                "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
+                progname, unit.name, unit.linenumber, unit.file);
+      goterr = 1;
+      continue;
+    }
+    if (toomanyprimitives(db, unit.name, unit.value)){
+      if (errfile)
+        fprintf(errfile,
+         "%s: primitive unit '%s' on line %d of '%s' is one too many.  At most %d primitive units are allowed\n",
+                progname, unit.name, unit.linenumber, unit.file, MAXDIMS);
+      return E_PRIMITIVES;
+    }
+    if (uinsert(db, &unit) || 
+        addunitsymbol(db, unit.name, unit.value)==NOSYMBOL)
+      return E_MEMORY;
+    count++;
+  }
+  if (unitcount)
+    *unitcount += count;
+
+  count = 0;
+  entry = (struct dbentry *)(image + var->prefixes);
+  for(i=0;i<var->prefixcount;i++,entry++){
+    prefix.name = dbstr(header, entry->name);
+    prefix.len = strlen(prefix.name);
+    prefix.value = dbstr(header, entry->value);
+    prefix.linenumber = entry->linenumber;
+    prefix.file = filenames[(unsigned)entry->file < header->filecount ?
+                            entry->file : header->filecount];
+    if ((oldprefix = plookup(db, prefix.name)) &&
+        !strcmp(oldprefix->name, prefix.name)){
+      if (errfile)
+        fprintf(errfile,
+              "%s: redefinition of prefix '%s-' on line %d of '%s' ignored.\n",
+                progname, prefix.name, prefix.linenumber, prefix.file);
+      goterr = 1;
+      continue;
+    }
+    if (addprefix(db, &prefix))
+      return E_MEMORY;
+    count++;
+  }
+  if (prefixcount)
+    *prefixcount += count;
+
+  count = 0;
+  funcs = (struct func *) malloc((var->funccount+1)*sizeof(struct func));
+  if (!funcs || keepblock(db, funcs, 0))
+    return E_MEMORY;
+  fentry = (struct dbfunc *)(image + var->funcs);
+  for(i=0;i<var->funccount;i++,fentry++){
+    funcs[i].name = dbstr(header, fentry->name);
+    funcs[i].forward.param = dbstr(header, fentry->param);
+    funcs[i].forward.def = dbstr(header, fentry->def);
+    funcs[i].forward.dimen = dbstr(header, fentry->dimen);
+    funcs[i].inverse.param = dbstr(header, fentry->invparam);
+    funcs[i].inverse.def = dbstr(header, fentry->invdef);
+    funcs[i].inverse.dimen = dbstr(header, fentry->invdimen);
+    funcs[i].tableunit = dbstr(header, fentry->tableunit);
+    if (funcs[i].tableunit){
+      funcs[i].table = (struct pair *)(image + fentry->table);
+      funcs[i].tablelen = fentry->tablelen;
+    } else {
+      funcs[i].table = 0;
+      funcs[i].tablelen = 0;
+    }
+    funcs[i].tabledef = 0;
+    funcs[i].linenumber = fentry->linenumber;
+    funcs[i].file = filenames[(unsigned)fentry->file < header->filecount ?
+                              fentry->file : header->filecount];
+    if (fnlookup(db, funcs[i].name, strlen(funcs[i].name))){
+      if (errfile)
+        fprintf(errfile, funcs[i].table ?
+                "%s: redefinition of unit '%s' on line %d of file '%s' ignored\n" :
+                "%s: redefinition of unit '%s' on line %d of '%s' ignored\n",
+                progname, funcs[i].name, funcs[i].linenumber, funcs[i].file);
+      goterr = 1;
+      continue;
+    }
+    if (addfunction(db, funcs+i))
+      return E_MEMORY;
+    count++;
+  }
+  if (funccount)
+    *funccount += count;
+  return goterr ? E_BADFILE : 0;
+}
+
+
+/*
+   Load the unit, prefix and function tables from the compiled database
+   in dbfile, which must have been built from the units files listed in
+   files.  The tables must be empty.  On success the counts are
+   incremented as readunits() does and zero is returned.  If the image
+   is missing, damaged or out of date then E_FILE or E_BADFILE is
+   returned and the caller should read the units files instead.
+   E_MEMORY is returned if the tables cannot grow, and then they are
+   left incomplete.
+
+   The tables point directly into the image, which stays mapped
+   (read only) for the life of the program.
+*/
+
+int
+loaddb(struct unitsdata *db, char *dbfile, char **files,
+       int *unitcount, int *prefixcount, int *funccount)
+{
+  struct stat statbuf;
+  char *image;
+  int fd, size, err;
+#ifdef NO_MMAP
+  int i, offset;
+#endif
+
+  if (!dbfile)
+    return E_FILE;
+  fd = open(dbfile, O_RDONLY | O_BINARY);
+  if (fd<0)
+    return E_FILE;
+  if (fstat(fd, &statbuf) || statbuf.st_size < sizeof(struct dbheader)){
+    close(fd);
+    return E_BADFILE;
+  }
+  size = statbuf.st_size;
+#ifndef NO_MMAP
+  image = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED)
+    return E_FILE;
+#else
+  image = mymalloc(size, "(loaddb)");
+  for(offset=0;offset<size;offset+=i){
+    i = read(fd, image+offset, size-offset);
+    if (i<=0)
+      break;
+  }
+  close(fd);
+  if (offset<size){
+    free(image);
+    return E_FILE;
+  }
+#endif
+  if (!checkimage(image, size, files)
+      || (err = loadimage(db, (struct dbheader *)image, 0,
+                          unitcount, prefixcount, funccount)) == E_BADFILE){
+#ifndef NO_MMAP
+    munmap(image, size);
+#else
+    free(image);
+#endif
+    return E_BADFILE;
+  }
+  return err;
+}
+
+
+/* Returns nonzero if units was built with a units database in it */
+
+int
+builtindb()
+{
+#ifdef BUILTINDB
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+
+/*
+   Adds the units database built into units to the tables, as
+   readunits() would add the units file it was compiled from.  The
+   arguments and return value are the same as for readunits().  The
+   names and definitions point into the image, which is never copied.
+*/
+
+int
+loadbuiltin(struct unitsdata *db, FILE *errfile,
+            int *unitcount, int *prefixcount, int *funccount)
+{
+#ifdef BUILTINDB
+  char *image;
+  int err;
+
+  image = (char *) builtinimage.data;
+  if (!checkimage(image, sizeof(builtinimage.data), 0)){
+    if (errfile)
+      fprintf(errfile, "%s: built in units database is damaged\n", progname);
+    return E_BADFILE;
+  }
+  err = loadimage(db, (struct dbheader *)image, errfile,
+                  unitcount, prefixcount, funccount);
+  if (err==E_MEMORY && errfile)
+    fprintf(errfile, "%s: memory allocation error (loadbuiltin)\n", progname);
+  return err;
+#else
+  errno = ENOENT;
+  return E_FILE;
+#endif
+}
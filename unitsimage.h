@@ -0,0 +1,15773 @@
+/* Units database written by units --compile-db.  Do not edit. */
+
+static const struct {
+  double align;
+  unsigned char data[315305];
+} builtinimage = { 0, {
+71,78,85,117,110,105,116,115,1,0,0,0,4,3,2,1,8,0,0,0,
+169,207,4,0,152,61,2,0,17,146,2,0,1,0,0,0,1,0,0,0,
+128,61,2,0,3,0,0,0,40,61,2,0,0,0,0,0,0,0,0,0,
+3,0,0,0,82,0,0,0,0,0,0,0,5,0,0,0,14,0,0,0,
+83,0,0,0,0,0,0,0,17,0,0,0,19,0,0,0,85,0,0,0,
+0,0,0,0,21,0,0,0,28,0,0,0,86,0,0,0,0,0,0,0,
+30,0,0,0,32,0,0,0,89,0,0,0,0,0,0,0,34,0,0,0,
+40,0,0,0,90,0,0,0,0,0,0,0,42,0,0,0,44,0,0,0,
+94,0,0,0,0,0,0,0,46,0,0,0,53,0,0,0,95,0,0,0,
+0,0,0,0,55,0,0,0,59,0,0,0,96,0,0,0,0,0,0,0,
+66,0,0,0,69,0,0,0,98,0,0,0,0,0,0,0,71,0,0,0,
+79,0,0,0,99,0,0,0,0,0,0,0,82,0,0,0,86,0,0,0,
+106,0,0,0,0,0,0,0,88,0,0,0,93,0,0,0,107,0,0,0,
+0,0,0,0,97,0,0,0,99,0,0,0,114,0,0,0,0,0,0,0,
+101,0,0,0,108,0,0,0,115,0,0,0,0,0,0,0,110,0,0,0,
+117,0,0,0,126,0,0,0,0,0,0,0,132,0,0,0,135,0,0,0,
+129,0,0,0,0,0,0,0,150,0,0,0,160,0,0,0,130,0,0,0,
+0,0,0,0,163,0,0,0,167,0,0,0,138,0,0,0,0,0,0,0,
+169,0,0,0,173,0,0,0,141,0,0,0,0,0,0,0,175,0,0,0,
+179,0,0,0,223,0,0,0,0,0,0,0,181,0,0,0,185,0,0,0,
+224,0,0,0,0,0,0,0,187,0,0,0,194,0,0,0,225,0,0,0,
+0,0,0,0,196,0,0,0,203,0,0,0,226,0,0,0,0,0,0,0,
+205,0,0,0,211,0,0,0,227,0,0,0,0,0,0,0,213,0,0,0,
+220,0,0,0,228,0,0,0,0,0,0,0,222,0,0,0,227,0,0,0,
+229,0,0,0,0,0,0,0,229,0,0,0,239,0,0,0,230,0,0,0,
+0,0,0,0,241,0,0,0,246,0,0,0,231,0,0,0,0,0,0,0,
+248,0,0,0,2,1,0,0,232,0,0,0,0,0,0,0,4,1,0,0,
+8,1,0,0,233,0,0,0,0,0,0,0,10,1,0,0,16,1,0,0,
+234,0,0,0,0,0,0,0,18,1,0,0,24,1,0,0,235,0,0,0,
+0,0,0,0,26,1,0,0,31,1,0,0,236,0,0,0,0,0,0,0,
+33,1,0,0,37,1,0,0,237,0,0,0,0,0,0,0,40,1,0,0,
+47,1,0,0,238,0,0,0,0,0,0,0,50,1,0,0,57,1,0,0,
+239,0,0,0,0,0,0,0,60,1,0,0,69,1,0,0,240,0,0,0,
+0,0,0,0,72,1,0,0,81,1,0,0,241,0,0,0,0,0,0,0,
+84,1,0,0,92,1,0,0,242,0,0,0,0,0,0,0,95,1,0,0,
+103,1,0,0,243,0,0,0,0,0,0,0,106,1,0,0,116,1,0,0,
+244,0,0,0,0,0,0,0,119,1,0,0,128,1,0,0,245,0,0,0,
+0,0,0,0,131,1,0,0,140,1,0,0,246,0,0,0,0,0,0,0,
+143,1,0,0,150,1,0,0,247,0,0,0,0,0,0,0,153,1,0,0,
+160,1,0,0,248,0,0,0,0,0,0,0,163,1,0,0,169,1,0,0,
+249,0,0,0,0,0,0,0,172,1,0,0,178,1,0,0,250,0,0,0,
+0,0,0,0,181,1,0,0,187,1,0,0,251,0,0,0,0,0,0,0,
+190,1,0,0,198,1,0,0,252,0,0,0,0,0,0,0,201,1,0,0,
+208,1,0,0,253,0,0,0,0,0,0,0,211,1,0,0,218,1,0,0,
+254,0,0,0,0,0,0,0,221,1,0,0,229,1,0,0,255,0,0,0,
+0,0,0,0,233,1,0,0,242,1,0,0,0,1,0,0,0,0,0,0,
+247,1,0,0,255,1,0,0,1,1,0,0,0,0,0,0,3,2,0,0,
+16,2,0,0,10,1,0,0,0,0,0,0,20,2,0,0,34,2,0,0,
+11,1,0,0,0,0,0,0,39,2,0,0,56,2,0,0,12,1,0,0,
+0,0,0,0,61,2,0,0,78,2,0,0,13,1,0,0,0,0,0,0,
+83,2,0,0,99,2,0,0,14,1,0,0,0,0,0,0,104,2,0,0,
+120,2,0,0,15,1,0,0,0,0,0,0,125,2,0,0,140,2,0,0,
+16,1,0,0,0,0,0,0,145,2,0,0,160,2,0,0,17,1,0,0,
+0,0,0,0,165,2,0,0,183,2,0,0,18,1,0,0,0,0,0,0,
+198,2,0,0,213,2,0,0,19,1,0,0,0,0,0,0,218,2,0,0,
+235,2,0,0,20,1,0,0,0,0,0,0,240,2,0,0,2,3,0,0,
+21,1,0,0,0,0,0,0,7,3,0,0,25,3,0,0,22,1,0,0,
+0,0,0,0,30,3,0,0,53,3,0,0,23,1,0,0,0,0,0,0,
+58,3,0,0,77,3,0,0,24,1,0,0,0,0,0,0,82,3,0,0,
+100,3,0,0,25,1,0,0,0,0,0,0,105,3,0,0,126,3,0,0,
+26,1,0,0,0,0,0,0,131,3,0,0,150,3,0,0,27,1,0,0,
+0,0,0,0,155,3,0,0,175,3,0,0,28,1,0,0,0,0,0,0,
+180,3,0,0,198,3,0,0,29,1,0,0,0,0,0,0,203,3,0,0,
+214,3,0,0,31,1,0,0,0,0,0,0,220,3,0,0,227,3,0,0,
+32,1,0,0,0,0,0,0,233,3,0,0,245,3,0,0,34,1,0,0,
+0,0,0,0,255,3,0,0,12,4,0,0,35,1,0,0,0,0,0,0,
+22,4,0,0,38,4,0,0,36,1,0,0,0,0,0,0,48,4,0,0,
+64,4,0,0,37,1,0,0,0,0,0,0,74,4,0,0,89,4,0,0,
+38,1,0,0,0,0,0,0,99,4,0,0,114,4,0,0,39,1,0,0,
+0,0,0,0,124,4,0,0,138,4,0,0,40,1,0,0,0,0,0,0,
+148,4,0,0,162,4,0,0,41,1,0,0,0,0,0,0,172,4,0,0,
+189,4,0,0,42,1,0,0,0,0,0,0,203,4,0,0,217,4,0,0,
+43,1,0,0,0,0,0,0,228,4,0,0,244,4,0,0,44,1,0,0,
+0,0,0,0,255,4,0,0,16,5,0,0,45,1,0,0,0,0,0,0,
+27,5,0,0,44,5,0,0,46,1,0,0,0,0,0,0,55,5,0,0,
+77,5,0,0,47,1,0,0,0,0,0,0,88,5,0,0,106,5,0,0,
+48,1,0,0,0,0,0,0,117,5,0,0,134,5,0,0,49,1,0,0,
+0,0,0,0,145,5,0,0,163,5,0,0,50,1,0,0,0,0,0,0,
+174,5,0,0,192,5,0,0,51,1,0,0,0,0,0,0,203,5,0,0,
+222,5,0,0,52,1,0,0,0,0,0,0,233,5,0,0,250,5,0,0,
+53,1,0,0,0,0,0,0,5,6,0,0,14,6,0,0,57,1,0,0,
+0,0,0,0,27,6,0,0,36,6,0,0,58,1,0,0,0,0,0,0,
+51,6,0,0,61,6,0,0,59,1,0,0,0,0,0,0,76,6,0,0,
+89,6,0,0,60,1,0,0,0,0,0,0,104,6,0,0,117,6,0,0,
+61,1,0,0,0,0,0,0,132,6,0,0,144,6,0,0,62,1,0,0,
+0,0,0,0,159,6,0,0,171,6,0,0,63,1,0,0,0,0,0,0,
+186,6,0,0,197,6,0,0,64,1,0,0,0,0,0,0,212,6,0,0,
+223,6,0,0,65,1,0,0,0,0,0,0,238,6,0,0,252,6,0,0,
+66,1,0,0,0,0,0,0,7,7,0,0,18,7,0,0,67,1,0,0,
+0,0,0,0,34,7,0,0,47,7,0,0,71,1,0,0,0,0,0,0,
+56,7,0,0,69,7,0,0,72,1,0,0,0,0,0,0,78,7,0,0,
+92,7,0,0,73,1,0,0,0,0,0,0,102,7,0,0,119,7,0,0,
+74,1,0,0,0,0,0,0,132,7,0,0,149,7,0,0,75,1,0,0,
+0,0,0,0,162,7,0,0,178,7,0,0,76,1,0,0,0,0,0,0,
+190,7,0,0,206,7,0,0,77,1,0,0,0,0,0,0,218,7,0,0,
+233,7,0,0,78,1,0,0,0,0,0,0,244,7,0,0,3,8,0,0,
+79,1,0,0,0,0,0,0,14,8,0,0,32,8,0,0,80,1,0,0,
+0,0,0,0,46,8,0,0,61,8,0,0,81,1,0,0,0,0,0,0,
+72,8,0,0,80,8,0,0,90,1,0,0,0,0,0,0,93,8,0,0,
+102,8,0,0,91,1,0,0,0,0,0,0,116,8,0,0,128,8,0,0,
+92,1,0,0,0,0,0,0,145,8,0,0,157,8,0,0,93,1,0,0,
+0,0,0,0,174,8,0,0,185,8,0,0,94,1,0,0,0,0,0,0,
+201,8,0,0,212,8,0,0,95,1,0,0,0,0,0,0,228,8,0,0,
+238,8,0,0,96,1,0,0,0,0,0,0,253,8,0,0,7,9,0,0,
+97,1,0,0,0,0,0,0,22,9,0,0,35,9,0,0,98,1,0,0,
+0,0,0,0,53,9,0,0,63,9,0,0,99,1,0,0,0,0,0,0,
+78,9,0,0,90,9,0,0,100,1,0,0,0,0,0,0,107,9,0,0,
+120,9,0,0,101,1,0,0,0,0,0,0,138,9,0,0,151,9,0,0,
+102,1,0,0,0,0,0,0,169,9,0,0,187,9,0,0,103,1,0,0,
+0,0,0,0,210,9,0,0,224,9,0,0,104,1,0,0,0,0,0,0,
+243,9,0,0,0,10,0,0,105,1,0,0,0,0,0,0,18,10,0,0,
+34,10,0,0,106,1,0,0,0,0,0,0,55,10,0,0,69,10,0,0,
+107,1,0,0,0,0,0,0,88,10,0,0,103,10,0,0,108,1,0,0,
+0,0,0,0,123,10,0,0,136,10,0,0,109,1,0,0,0,0,0,0,
+154,10,0,0,161,10,0,0,125,1,0,0,0,0,0,0,172,10,0,0,
+174,10,0,0,126,1,0,0,0,0,0,0,181,10,0,0,188,10,0,0,
+127,1,0,0,0,0,0,0,194,10,0,0,197,10,0,0,128,1,0,0,
+0,0,0,0,204,10,0,0,210,10,0,0,129,1,0,0,0,0,0,0,
+214,10,0,0,216,10,0,0,130,1,0,0,0,0,0,0,222,10,0,0,
+227,10,0,0,131,1,0,0,0,0,0,0,231,10,0,0,233,10,0,0,
+132,1,0,0,0,0,0,0,238,10,0,0,246,10,0,0,133,1,0,0,
+0,0,0,0,250,10,0,0,252,10,0,0,134,1,0,0,0,0,0,0,
+4,11,0,0,9,11,0,0,135,1,0,0,0,0,0,0,13,11,0,0,
+15,11,0,0,136,1,0,0,0,0,0,0,20,11,0,0,24,11,0,0,
+137,1,0,0,0,0,0,0,28,11,0,0,36,11,0,0,138,1,0,0,
+0,0,0,0,40,11,0,0,42,11,0,0,139,1,0,0,0,0,0,0,
+50,11,0,0,56,11,0,0,140,1,0,0,0,0,0,0,60,11,0,0,
+62,11,0,0,141,1,0,0,0,0,0,0,68,11,0,0,74,11,0,0,
+142,1,0,0,0,0,0,0,78,11,0,0,81,11,0,0,143,1,0,0,
+0,0,0,0,87,11,0,0,93,11,0,0,144,1,0,0,0,0,0,0,
+98,11,0,0,100,11,0,0,145,1,0,0,0,0,0,0,106,11,0,0,
+112,11,0,0,146,1,0,0,0,0,0,0,119,11,0,0,121,11,0,0,
+147,1,0,0,0,0,0,0,127,11,0,0,133,11,0,0,148,1,0,0,
+0,0,0,0,136,11,0,0,139,11,0,0,149,1,0,0,0,0,0,0,
+145,11,0,0,152,11,0,0,157,1,0,0,0,0,0,0,158,11,0,0,
+163,11,0,0,158,1,0,0,0,0,0,0,172,11,0,0,179,11,0,0,
+159,1,0,0,0,0,0,0,188,11,0,0,193,11,0,0,160,1,0,0,
+0,0,0,0,202,11,0,0,210,11,0,0,161,1,0,0,0,0,0,0,
+217,11,0,0,224,11,0,0,162,1,0,0,0,0,0,0,229,11,0,0,
+235,11,0,0,163,1,0,0,0,0,0,0,242,11,0,0,254,11,0,0,
+164,1,0,0,0,0,0,0,8,12,0,0,14,12,0,0,165,1,0,0,
+0,0,0,0,18,12,0,0,24,12,0,0,166,1,0,0,0,0,0,0,
+31,12,0,0,40,12,0,0,167,1,0,0,0,0,0,0,53,12,0,0,
+60,12,0,0,168,1,0,0,0,0,0,0,73,12,0,0,80,12,0,0,
+169,1,0,0,0,0,0,0,88,12,0,0,100,12,0,0,170,1,0,0,
+0,0,0,0,106,12,0,0,117,12,0,0,171,1,0,0,0,0,0,0,
+121,12,0,0,133,12,0,0,172,1,0,0,0,0,0,0,141,12,0,0,
+152,12,0,0,173,1,0,0,0,0,0,0,158,12,0,0,168,12,0,0,
+174,1,0,0,0,0,0,0,174,12,0,0,183,12,0,0,175,1,0,0,
+0,0,0,0,197,12,0,0,210,12,0,0,176,1,0,0,0,0,0,0,
+226,12,0,0,234,12,0,0,177,1,0,0,0,0,0,0,248,12,0,0,
+7,13,0,0,178,1,0,0,0,0,0,0,21,13,0,0,31,13,0,0,
+179,1,0,0,0,0,0,0,49,13,0,0,69,13,0,0,180,1,0,0,
+0,0,0,0,89,13,0,0,94,13,0,0,187,1,0,0,0,0,0,0,
+102,13,0,0,105,13,0,0,188,1,0,0,0,0,0,0,110,13,0,0,
+112,13,0,0,189,1,0,0,0,0,0,0,117,13,0,0,123,13,0,0,
+190,1,0,0,0,0,0,0,131,13,0,0,133,13,0,0,191,1,0,0,
+0,0,0,0,139,13,0,0,149,13,0,0,192,1,0,0,0,0,0,0,
+155,13,0,0,162,13,0,0,193,1,0,0,0,0,0,0,176,13,0,0,
+182,13,0,0,194,1,0,0,0,0,0,0,189,13,0,0,195,13,0,0,
+195,1,0,0,0,0,0,0,208,13,0,0,216,13,0,0,196,1,0,0,
+0,0,0,0,223,13,0,0,227,13,0,0,197,1,0,0,0,0,0,0,
+234,13,0,0,238,13,0,0,198,1,0,0,0,0,0,0,247,13,0,0,
+254,13,0,0,199,1,0,0,0,0,0,0,9,14,0,0,16,14,0,0,
+200,1,0,0,0,0,0,0,26,14,0,0,29,14,0,0,201,1,0,0,
+0,0,0,0,34,14,0,0,38,14,0,0,202,1,0,0,0,0,0,0,
+46,14,0,0,52,14,0,0,203,1,0,0,0,0,0,0,60,14,0,0,
+69,14,0,0,204,1,0,0,0,0,0,0,83,14,0,0,85,14,0,0,
+205,1,0,0,0,0,0,0,91,14,0,0,93,14,0,0,206,1,0,0,
+0,0,0,0,99,14,0,0,103,14,0,0,212,1,0,0,0,0,0,0,
+111,14,0,0,118,14,0,0,213,1,0,0,0,0,0,0,125,14,0,0,
+134,14,0,0,214,1,0,0,0,0,0,0,142,14,0,0,148,14,0,0,
+215,1,0,0,0,0,0,0,166,14,0,0,175,14,0,0,216,1,0,0,
+0,0,0,0,181,14,0,0,187,14,0,0,221,1,0,0,0,0,0,0,
+195,14,0,0,200,14,0,0,223,1,0,0,0,0,0,0,210,14,0,0,
+215,14,0,0,227,1,0,0,0,0,0,0,226,14,0,0,235,14,0,0,
+230,1,0,0,0,0,0,0,246,14,0,0,254,14,0,0,231,1,0,0,
+0,0,0,0,1,15,0,0,9,15,0,0,232,1,0,0,0,0,0,0,
+17,15,0,0,23,15,0,0,233,1,0,0,0,0,0,0,32,15,0,0,
+41,15,0,0,234,1,0,0,0,0,0,0,49,15,0,0,55,15,0,0,
+236,1,0,0,0,0,0,0,65,15,0,0,72,15,0,0,237,1,0,0,
+0,0,0,0,83,15,0,0,88,15,0,0,238,1,0,0,0,0,0,0,
+95,15,0,0,102,15,0,0,239,1,0,0,0,0,0,0,113,15,0,0,
+120,15,0,0,240,1,0,0,0,0,0,0,124,15,0,0,133,15,0,0,
+241,1,0,0,0,0,0,0,140,15,0,0,146,15,0,0,242,1,0,0,
+0,0,0,0,154,15,0,0,158,15,0,0,243,1,0,0,0,0,0,0,
+167,15,0,0,178,15,0,0,244,1,0,0,0,0,0,0,188,15,0,0,
+194,15,0,0,245,1,0,0,0,0,0,0,200,15,0,0,206,15,0,0,
+246,1,0,0,0,0,0,0,215,15,0,0,225,15,0,0,248,1,0,0,
+0,0,0,0,234,15,0,0,246,15,0,0,249,1,0,0,0,0,0,0,
+251,15,0,0,2,16,0,0,250,1,0,0,0,0,0,0,14,16,0,0,
+25,16,0,0,251,1,0,0,0,0,0,0,35,16,0,0,44,16,0,0,
+253,1,0,0,0,0,0,0,59,16,0,0,66,16,0,0,1,2,0,0,
+0,0,0,0,75,16,0,0,78,16,0,0,2,2,0,0,0,0,0,0,
+85,16,0,0,89,16,0,0,3,2,0,0,0,0,0,0,101,16,0,0,
+107,16,0,0,7,2,0,0,0,0,0,0,125,16,0,0,131,16,0,0,
+9,2,0,0,0,0,0,0,139,16,0,0,143,16,0,0,10,2,0,0,
+0,0,0,0,149,16,0,0,153,16,0,0,16,2,0,0,0,0,0,0,
+155,16,0,0,162,16,0,0,17,2,0,0,0,0,0,0,167,16,0,0,
+171,16,0,0,18,2,0,0,0,0,0,0,178,16,0,0,183,16,0,0,
+19,2,0,0,0,0,0,0,190,16,0,0,193,16,0,0,20,2,0,0,
+0,0,0,0,198,16,0,0,202,16,0,0,21,2,0,0,0,0,0,0,
+208,16,0,0,210,16,0,0,22,2,0,0,0,0,0,0,214,16,0,0,
+217,16,0,0,23,2,0,0,0,0,0,0,221,16,0,0,226,16,0,0,
+24,2,0,0,0,0,0,0,232,16,0,0,235,16,0,0,25,2,0,0,
+0,0,0,0,240,16,0,0,249,16,0,0,26,2,0,0,0,0,0,0,
+255,16,0,0,9,17,0,0,27,2,0,0,0,0,0,0,16,17,0,0,
+22,17,0,0,28,2,0,0,0,0,0,0,31,17,0,0,34,17,0,0,
+29,2,0,0,0,0,0,0,43,17,0,0,48,17,0,0,30,2,0,0,
+0,0,0,0,58,17,0,0,64,17,0,0,31,2,0,0,0,0,0,0,
+72,17,0,0,77,17,0,0,33,2,0,0,0,0,0,0,87,17,0,0,
+94,17,0,0,41,2,0,0,0,0,0,0,106,17,0,0,113,17,0,0,
+42,2,0,0,0,0,0,0,126,17,0,0,130,17,0,0,43,2,0,0,
+0,0,0,0,137,17,0,0,144,17,0,0,44,2,0,0,0,0,0,0,
+151,17,0,0,158,17,0,0,45,2,0,0,0,0,0,0,170,17,0,0,
+180,17,0,0,46,2,0,0,0,0,0,0,187,17,0,0,189,17,0,0,
+47,2,0,0,0,0,0,0,196,17,0,0,203,17,0,0,48,2,0,0,
+0,0,0,0,215,17,0,0,225,17,0,0,49,2,0,0,0,0,0,0,
+232,17,0,0,234,17,0,0,50,2,0,0,0,0,0,0,241,17,0,0,
+244,17,0,0,51,2,0,0,0,0,0,0,246,17,0,0,1,18,0,0,
+52,2,0,0,0,0,0,0,12,18,0,0,21,18,0,0,53,2,0,0,
+0,0,0,0,32,18,0,0,41,18,0,0,54,2,0,0,0,0,0,0,
+52,18,0,0,60,18,0,0,55,2,0,0,0,0,0,0,71,18,0,0,
+76,18,0,0,57,2,0,0,0,0,0,0,88,18,0,0,93,18,0,0,
+58,2,0,0,0,0,0,0,100,18,0,0,111,18,0,0,59,2,0,0,
+0,0,0,0,116,18,0,0,120,18,0,0,60,2,0,0,0,0,0,0,
+125,18,0,0,136,18,0,0,61,2,0,0,0,0,0,0,149,18,0,0,
+153,18,0,0,62,2,0,0,0,0,0,0,170,18,0,0,176,18,0,0,
+63,2,0,0,0,0,0,0,180,18,0,0,197,18,0,0,64,2,0,0,
+0,0,0,0,209,18,0,0,226,18,0,0,65,2,0,0,0,0,0,0,
+249,18,0,0,2,19,0,0,66,2,0,0,0,0,0,0,16,19,0,0,
+27,19,0,0,68,2,0,0,0,0,0,0,39,19,0,0,47,19,0,0,
+69,2,0,0,0,0,0,0,59,19,0,0,63,19,0,0,71,2,0,0,
+0,0,0,0,76,19,0,0,89,19,0,0,72,2,0,0,0,0,0,0,
+110,19,0,0,117,19,0,0,89,2,0,0,0,0,0,0,125,19,0,0,
+138,19,0,0,90,2,0,0,0,0,0,0,154,19,0,0,167,19,0,0,
+91,2,0,0,0,0,0,0,187,19,0,0,200,19,0,0,92,2,0,0,
+0,0,0,0,220,19,0,0,233,19,0,0,93,2,0,0,0,0,0,0,
+246,19,0,0,3,20,0,0,94,2,0,0,0,0,0,0,16,20,0,0,
+36,20,0,0,95,2,0,0,0,0,0,0,46,20,0,0,53,20,0,0,
+96,2,0,0,0,0,0,0,63,20,0,0,71,20,0,0,102,2,0,0,
+0,0,0,0,76,20,0,0,78,20,0,0,103,2,0,0,0,0,0,0,
+86,20,0,0,91,20,0,0,104,2,0,0,0,0,0,0,97,20,0,0,
+103,20,0,0,111,2,0,0,0,0,0,0,109,20,0,0,113,20,0,0,
+114,2,0,0,0,0,0,0,118,20,0,0,134,20,0,0,115,2,0,0,
+0,0,0,0,138,20,0,0,142,20,0,0,116,2,0,0,0,0,0,0,
+147,20,0,0,163,20,0,0,117,2,0,0,0,0,0,0,167,20,0,0,
+171,20,0,0,118,2,0,0,0,0,0,0,177,20,0,0,194,20,0,0,
+119,2,0,0,0,0,0,0,198,20,0,0,204,20,0,0,120,2,0,0,
+0,0,0,0,209,20,0,0,219,20,0,0,121,2,0,0,0,0,0,0,
+225,20,0,0,232,20,0,0,122,2,0,0,0,0,0,0,237,20,0,0,
+248,20,0,0,123,2,0,0,0,0,0,0,255,20,0,0,4,21,0,0,
+124,2,0,0,0,0,0,0,11,21,0,0,23,21,0,0,142,2,0,0,
+0,0,0,0,30,21,0,0,53,21,0,0,143,2,0,0,0,0,0,0,
+60,21,0,0,71,21,0,0,147,2,0,0,0,0,0,0,73,21,0,0,
+78,21,0,0,148,2,0,0,0,0,0,0,80,21,0,0,94,21,0,0,
+165,2,0,0,0,0,0,0,103,21,0,0,108,21,0,0,166,2,0,0,
+0,0,0,0,117,21,0,0,132,21,0,0,183,2,0,0,0,0,0,0,
+137,21,0,0,148,21,0,0,184,2,0,0,0,0,0,0,163,21,0,0,
+177,21,0,0,185,2,0,0,0,0,0,0,182,21,0,0,187,21,0,0,
+186,2,0,0,0,0,0,0,198,21,0,0,204,21,0,0,187,2,0,0,
+0,0,0,0,215,21,0,0,227,21,0,0,188,2,0,0,0,0,0,0,
+238,21,0,0,249,21,0,0,191,2,0,0,0,0,0,0,3,22,0,0,
+8,22,0,0,198,2,0,0,0,0,0,0,10,22,0,0,16,22,0,0,
+199,2,0,0,0,0,0,0,18,22,0,0,21,22,0,0,0,3,0,0,
+0,0,0,0,44,22,0,0,46,22,0,0,1,3,0,0,0,0,0,0,
+63,22,0,0,69,22,0,0,2,3,0,0,0,0,0,0,71,22,0,0,
+75,22,0,0,3,3,0,0,0,0,0,0,89,22,0,0,98,22,0,0,
+4,3,0,0,0,0,0,0,108,22,0,0,115,22,0,0,5,3,0,0,
+0,0,0,0,119,22,0,0,121,22,0,0,6,3,0,0,0,0,0,0,
+139,22,0,0,141,22,0,0,7,3,0,0,0,0,0,0,160,22,0,0,
+165,22,0,0,8,3,0,0,0,0,0,0,174,22,0,0,179,22,0,0,
+9,3,0,0,0,0,0,0,184,22,0,0,186,22,0,0,10,3,0,0,
+0,0,0,0,211,22,0,0,224,22,0,0,19,3,0,0,0,0,0,0,
+240,22,0,0,255,22,0,0,23,3,0,0,0,0,0,0,18,23,0,0,
+20,23,0,0,24,3,0,0,0,0,0,0,35,23,0,0,39,23,0,0,
+25,3,0,0,0,0,0,0,54,23,0,0,63,23,0,0,26,3,0,0,
+0,0,0,0,78,23,0,0,87,23,0,0,29,3,0,0,0,0,0,0,
+102,23,0,0,109,23,0,0,31,3,0,0,0,0,0,0,111,23,0,0,
+120,23,0,0,32,3,0,0,0,0,0,0,134,23,0,0,138,23,0,0,
+33,3,0,0,0,0,0,0,147,23,0,0,159,23,0,0,34,3,0,0,
+0,0,0,0,178,23,0,0,180,23,0,0,35,3,0,0,0,0,0,0,
+192,23,0,0,202,23,0,0,36,3,0,0,0,0,0,0,210,23,0,0,
+212,23,0,0,37,3,0,0,0,0,0,0,222,23,0,0,233,23,0,0,
+38,3,0,0,0,0,0,0,243,23,0,0,255,23,0,0,39,3,0,0,
+0,0,0,0,19,24,0,0,29,24,0,0,41,3,0,0,0,0,0,0,
+56,24,0,0,72,24,0,0,44,3,0,0,0,0,0,0,97,24,0,0,
+103,24,0,0,45,3,0,0,0,0,0,0,119,24,0,0,136,24,0,0,
+47,3,0,0,0,0,0,0,153,24,0,0,157,24,0,0,56,3,0,0,
+0,0,0,0,172,24,0,0,176,24,0,0,72,3,0,0,0,0,0,0,
+190,24,0,0,198,24,0,0,89,3,0,0,0,0,0,0,212,24,0,0,
+218,24,0,0,90,3,0,0,0,0,0,0,226,24,0,0,230,24,0,0,
+91,3,0,0,0,0,0,0,240,24,0,0,251,24,0,0,92,3,0,0,
+0,0,0,0,255,24,0,0,2,25,0,0,93,3,0,0,0,0,0,0,
+28,25,0,0,34,25,0,0,94,3,0,0,0,0,0,0,50,25,0,0,
+63,25,0,0,95,3,0,0,0,0,0,0,75,25,0,0,79,25,0,0,
+96,3,0,0,0,0,0,0,85,25,0,0,88,25,0,0,97,3,0,0,
+0,0,0,0,94,25,0,0,99,25,0,0,98,3,0,0,0,0,0,0,
+110,25,0,0,123,25,0,0,99,3,0,0,0,0,0,0,132,25,0,0,
+140,25,0,0,100,3,0,0,0,0,0,0,153,25,0,0,159,25,0,0,
+105,3,0,0,0,0,0,0,185,25,0,0,191,25,0,0,106,3,0,0,
+0,0,0,0,217,25,0,0,223,25,0,0,107,3,0,0,0,0,0,0,
+249,25,0,0,255,25,0,0,108,3,0,0,0,0,0,0,25,26,0,0,
+31,26,0,0,109,3,0,0,0,0,0,0,57,26,0,0,63,26,0,0,
+110,3,0,0,0,0,0,0,89,26,0,0,95,26,0,0,111,3,0,0,
+0,0,0,0,121,26,0,0,127,26,0,0,112,3,0,0,0,0,0,0,
+153,26,0,0,160,26,0,0,113,3,0,0,0,0,0,0,186,26,0,0,
+193,26,0,0,114,3,0,0,0,0,0,0,219,26,0,0,226,26,0,0,
+115,3,0,0,0,0,0,0,252,26,0,0,3,27,0,0,116,3,0,0,
+0,0,0,0,29,27,0,0,36,27,0,0,117,3,0,0,0,0,0,0,
+62,27,0,0,69,27,0,0,118,3,0,0,0,0,0,0,95,27,0,0,
+103,27,0,0,119,3,0,0,0,0,0,0,129,27,0,0,139,27,0,0,
+123,3,0,0,0,0,0,0,158,27,0,0,162,27,0,0,124,3,0,0,
+0,0,0,0,174,27,0,0,180,27,0,0,135,3,0,0,0,0,0,0,
+196,27,0,0,207,27,0,0,143,3,0,0,0,0,0,0,230,27,0,0,
+236,27,0,0,144,3,0,0,0,0,0,0,246,27,0,0,1,28,0,0,
+148,3,0,0,0,0,0,0,15,28,0,0,19,28,0,0,149,3,0,0,
+0,0,0,0,30,28,0,0,41,28,0,0,150,3,0,0,0,0,0,0,
+63,28,0,0,67,28,0,0,151,3,0,0,0,0,0,0,78,28,0,0,
+91,28,0,0,152,3,0,0,0,0,0,0,104,28,0,0,108,28,0,0,
+153,3,0,0,0,0,0,0,121,28,0,0,134,28,0,0,157,3,0,0,
+0,0,0,0,152,28,0,0,156,28,0,0,158,3,0,0,0,0,0,0,
+169,28,0,0,180,28,0,0,159,3,0,0,0,0,0,0,196,28,0,0,
+200,28,0,0,160,3,0,0,0,0,0,0,211,28,0,0,223,28,0,0,
+161,3,0,0,0,0,0,0,239,28,0,0,243,28,0,0,162,3,0,0,
+0,0,0,0,255,28,0,0,8,29,0,0,163,3,0,0,0,0,0,0,
+23,29,0,0,28,29,0,0,164,3,0,0,0,0,0,0,37,29,0,0,
+50,29,0,0,165,3,0,0,0,0,0,0,67,29,0,0,71,29,0,0,
+166,3,0,0,0,0,0,0,84,29,0,0,102,29,0,0,167,3,0,0,
+0,0,0,0,119,29,0,0,127,29,0,0,168,3,0,0,0,0,0,0,
+145,29,0,0,164,29,0,0,173,3,0,0,0,0,0,0,174,29,0,0,
+183,29,0,0,174,3,0,0,0,0,0,0,202,29,0,0,219,29,0,0,
+175,3,0,0,0,0,0,0,229,29,0,0,240,29,0,0,176,3,0,0,
+0,0,0,0,1,30,0,0,19,30,0,0,177,3,0,0,0,0,0,0,
+29,30,0,0,40,30,0,0,178,3,0,0,0,0,0,0,58,30,0,0,
+71,30,0,0,182,3,0,0,0,0,0,0,95,30,0,0,100,30,0,0,
+183,3,0,0,0,0,0,0,113,30,0,0,129,30,0,0,184,3,0,0,
+0,0,0,0,152,30,0,0,157,30,0,0,185,3,0,0,0,0,0,0,
+173,30,0,0,179,30,0,0,186,3,0,0,0,0,0,0,198,30,0,0,
+203,30,0,0,187,3,0,0,0,0,0,0,223,30,0,0,228,30,0,0,
+188,3,0,0,0,0,0,0,247,30,0,0,252,30,0,0,189,3,0,0,
+0,0,0,0,15,31,0,0,20,31,0,0,190,3,0,0,0,0,0,0,
+40,31,0,0,44,31,0,0,196,3,0,0,0,0,0,0,53,31,0,0,
+73,31,0,0,197,3,0,0,0,0,0,0,84,31,0,0,87,31,0,0,
+198,3,0,0,0,0,0,0,107,31,0,0,111,31,0,0,199,3,0,0,
+0,0,0,0,123,31,0,0,128,31,0,0,200,3,0,0,0,0,0,0,
+134,31,0,0,139,31,0,0,201,3,0,0,0,0,0,0,144,31,0,0,
+148,31,0,0,202,3,0,0,0,0,0,0,151,31,0,0,156,31,0,0,
+205,3,0,0,0,0,0,0,164,31,0,0,170,31,0,0,206,3,0,0,
+0,0,0,0,181,31,0,0,187,31,0,0,207,3,0,0,0,0,0,0,
+196,31,0,0,199,31,0,0,208,3,0,0,0,0,0,0,203,31,0,0,
+216,31,0,0,209,3,0,0,0,0,0,0,219,31,0,0,229,31,0,0,
+210,3,0,0,0,0,0,0,242,31,0,0,245,31,0,0,211,3,0,0,
+0,0,0,0,255,31,0,0,11,32,0,0,212,3,0,0,0,0,0,0,
+15,32,0,0,27,32,0,0,213,3,0,0,0,0,0,0,33,32,0,0,
+40,32,0,0,214,3,0,0,0,0,0,0,57,32,0,0,60,32,0,0,
+215,3,0,0,0,0,0,0,67,32,0,0,75,32,0,0,223,3,0,0,
+0,0,0,0,89,32,0,0,95,32,0,0,224,3,0,0,0,0,0,0,
+109,32,0,0,122,32,0,0,227,3,0,0,0,0,0,0,134,32,0,0,
+141,32,0,0,228,3,0,0,0,0,0,0,158,32,0,0,166,32,0,0,
+229,3,0,0,0,0,0,0,185,32,0,0,191,32,0,0,232,3,0,0,
+0,0,0,0,200,32,0,0,206,32,0,0,233,3,0,0,0,0,0,0,
+212,32,0,0,223,32,0,0,234,3,0,0,0,0,0,0,229,32,0,0,
+238,32,0,0,235,3,0,0,0,0,0,0,0,33,0,0,5,33,0,0,
+241,3,0,0,0,0,0,0,19,33,0,0,23,33,0,0,242,3,0,0,
+0,0,0,0,28,33,0,0,32,33,0,0,243,3,0,0,0,0,0,0,
+40,33,0,0,46,33,0,0,244,3,0,0,0,0,0,0,58,33,0,0,
+60,33,0,0,245,3,0,0,0,0,0,0,66,33,0,0,70,33,0,0,
+246,3,0,0,0,0,0,0,77,33,0,0,84,33,0,0,247,3,0,0,
+0,0,0,0,93,33,0,0,96,33,0,0,248,3,0,0,0,0,0,0,
+103,33,0,0,109,33,0,0,249,3,0,0,0,0,0,0,116,33,0,0,
+123,33,0,0,250,3,0,0,0,0,0,0,130,33,0,0,134,33,0,0,
+251,3,0,0,0,0,0,0,143,33,0,0,151,33,0,0,252,3,0,0,
+0,0,0,0,155,33,0,0,161,33,0,0,1,4,0,0,0,0,0,0,
+171,33,0,0,177,33,0,0,2,4,0,0,0,0,0,0,183,33,0,0,
+190,33,0,0,3,4,0,0,0,0,0,0,195,33,0,0,202,33,0,0,
+4,4,0,0,0,0,0,0,209,33,0,0,214,33,0,0,5,4,0,0,
+0,0,0,0,219,33,0,0,224,33,0,0,6,4,0,0,0,0,0,0,
+233,33,0,0,238,33,0,0,7,4,0,0,0,0,0,0,249,33,0,0,
+254,33,0,0,8,4,0,0,0,0,0,0,18,34,0,0,24,34,0,0,
+10,4,0,0,0,0,0,0,48,34,0,0,53,34,0,0,18,4,0,0,
+0,0,0,0,64,34,0,0,74,34,0,0,19,4,0,0,0,0,0,0,
+79,34,0,0,93,34,0,0,20,4,0,0,0,0,0,0,104,34,0,0,
+118,34,0,0,21,4,0,0,0,0,0,0,131,34,0,0,135,34,0,0,
+24,4,0,0,0,0,0,0,149,34,0,0,154,34,0,0,25,4,0,0,
+0,0,0,0,167,34,0,0,174,34,0,0,26,4,0,0,0,0,0,0,
+186,34,0,0,195,34,0,0,31,4,0,0,0,0,0,0,200,34,0,0,
+206,34,0,0,32,4,0,0,0,0,0,0,215,34,0,0,218,34,0,0,
+33,4,0,0,0,0,0,0,227,34,0,0,232,34,0,0,34,4,0,0,
+0,0,0,0,235,34,0,0,238,34,0,0,35,4,0,0,0,0,0,0,
+243,34,0,0,253,34,0,0,36,4,0,0,0,0,0,0,7,35,0,0,
+14,35,0,0,37,4,0,0,0,0,0,0,24,35,0,0,32,35,0,0,
+38,4,0,0,0,0,0,0,54,35,0,0,62,35,0,0,39,4,0,0,
+0,0,0,0,81,35,0,0,88,35,0,0,40,4,0,0,0,0,0,0,
+109,35,0,0,115,35,0,0,41,4,0,0,0,0,0,0,130,35,0,0,
+136,35,0,0,42,4,0,0,0,0,0,0,143,35,0,0,149,35,0,0,
+43,4,0,0,0,0,0,0,167,35,0,0,170,35,0,0,44,4,0,0,
+0,0,0,0,176,35,0,0,184,35,0,0,45,4,0,0,0,0,0,0,
+195,35,0,0,198,35,0,0,46,4,0,0,0,0,0,0,206,35,0,0,
+214,35,0,0,47,4,0,0,0,0,0,0,226,35,0,0,229,35,0,0,
+48,4,0,0,0,0,0,0,237,35,0,0,245,35,0,0,49,4,0,0,
+0,0,0,0,4,36,0,0,7,36,0,0,50,4,0,0,0,0,0,0,
+15,36,0,0,18,36,0,0,51,4,0,0,0,0,0,0,26,36,0,0,
+35,36,0,0,52,4,0,0,0,0,0,0,48,36,0,0,52,36,0,0,
+53,4,0,0,0,0,0,0,62,36,0,0,73,36,0,0,67,4,0,0,
+0,0,0,0,87,36,0,0,95,36,0,0,68,4,0,0,0,0,0,0,
+106,36,0,0,115,36,0,0,69,4,0,0,0,0,0,0,137,36,0,0,
+149,36,0,0,70,4,0,0,0,0,0,0,159,36,0,0,163,36,0,0,
+71,4,0,0,0,0,0,0,175,36,0,0,184,36,0,0,72,4,0,0,
+0,0,0,0,196,36,0,0,206,36,0,0,73,4,0,0,0,0,0,0,
+229,36,0,0,243,36,0,0,74,4,0,0,0,0,0,0,253,36,0,0,
+7,37,0,0,75,4,0,0,0,0,0,0,30,37,0,0,38,37,0,0,
+76,4,0,0,0,0,0,0,57,37,0,0,65,37,0,0,77,4,0,0,
+0,0,0,0,74,37,0,0,86,37,0,0,78,4,0,0,0,0,0,0,
+99,37,0,0,108,37,0,0,79,4,0,0,0,0,0,0,120,37,0,0,
+126,37,0,0,80,4,0,0,0,0,0,0,144,37,0,0,154,37,0,0,
+81,4,0,0,0,0,0,0,171,37,0,0,175,37,0,0,82,4,0,0,
+0,0,0,0,190,37,0,0,200,37,0,0,88,4,0,0,0,0,0,0,
+211,37,0,0,218,37,0,0,89,4,0,0,0,0,0,0,228,37,0,0,
+237,37,0,0,92,4,0,0,0,0,0,0,248,37,0,0,0,38,0,0,
+93,4,0,0,0,0,0,0,10,38,0,0,17,38,0,0,94,4,0,0,
+0,0,0,0,30,38,0,0,38,38,0,0,98,4,0,0,0,0,0,0,
+46,38,0,0,54,38,0,0,100,4,0,0,0,0,0,0,64,38,0,0,
+77,38,0,0,101,4,0,0,0,0,0,0,87,38,0,0,100,38,0,0,
+102,4,0,0,0,0,0,0,110,38,0,0,119,38,0,0,110,4,0,0,
+0,0,0,0,132,38,0,0,144,38,0,0,111,4,0,0,0,0,0,0,
+155,38,0,0,174,38,0,0,118,4,0,0,0,0,0,0,182,38,0,0,
+196,38,0,0,119,4,0,0,0,0,0,0,202,38,0,0,218,38,0,0,
+120,4,0,0,0,0,0,0,225,38,0,0,237,38,0,0,121,4,0,0,
+0,0,0,0,241,38,0,0,250,38,0,0,122,4,0,0,0,0,0,0,
+254,38,0,0,5,39,0,0,124,4,0,0,0,0,0,0,18,39,0,0,
+29,39,0,0,125,4,0,0,0,0,0,0,40,39,0,0,53,39,0,0,
+126,4,0,0,0,0,0,0,64,39,0,0,71,39,0,0,127,4,0,0,
+0,0,0,0,80,39,0,0,86,39,0,0,131,4,0,0,0,0,0,0,
+92,39,0,0,95,39,0,0,132,4,0,0,0,0,0,0,101,39,0,0,
+108,39,0,0,134,4,0,0,0,0,0,0,116,39,0,0,124,39,0,0,
+135,4,0,0,0,0,0,0,131,39,0,0,138,39,0,0,136,4,0,0,
+0,0,0,0,145,39,0,0,149,39,0,0,141,4,0,0,0,0,0,0,
+156,39,0,0,159,39,0,0,142,4,0,0,0,0,0,0,163,39,0,0,
+168,39,0,0,143,4,0,0,0,0,0,0,181,39,0,0,184,39,0,0,
+144,4,0,0,0,0,0,0,189,39,0,0,200,39,0,0,145,4,0,0,
+0,0,0,0,211,39,0,0,223,39,0,0,147,4,0,0,0,0,0,0,
+233,39,0,0,237,39,0,0,150,4,0,0,0,0,0,0,251,39,0,0,
+255,39,0,0,153,4,0,0,0,0,0,0,8,40,0,0,13,40,0,0,
+154,4,0,0,0,0,0,0,27,40,0,0,37,40,0,0,158,4,0,0,
+0,0,0,0,41,40,0,0,45,40,0,0,160,4,0,0,0,0,0,0,
+52,40,0,0,58,40,0,0,161,4,0,0,0,0,0,0,68,40,0,0,
+71,40,0,0,162,4,0,0,0,0,0,0,77,40,0,0,86,40,0,0,
+164,4,0,0,0,0,0,0,96,40,0,0,100,40,0,0,165,4,0,0,
+0,0,0,0,109,40,0,0,117,40,0,0,166,4,0,0,0,0,0,0,
+126,40,0,0,140,40,0,0,174,4,0,0,0,0,0,0,152,40,0,0,
+167,40,0,0,175,4,0,0,0,0,0,0,180,40,0,0,188,40,0,0,
+176,4,0,0,0,0,0,0,201,40,0,0,213,40,0,0,177,4,0,0,
+0,0,0,0,226,40,0,0,233,40,0,0,188,4,0,0,0,0,0,0,
+246,40,0,0,255,40,0,0,189,4,0,0,0,0,0,0,9,41,0,0,
+20,41,0,0,190,4,0,0,0,0,0,0,29,41,0,0,38,41,0,0,
+191,4,0,0,0,0,0,0,49,41,0,0,56,41,0,0,192,4,0,0,
+0,0,0,0,68,41,0,0,77,41,0,0,193,4,0,0,0,0,0,0,
+89,41,0,0,97,41,0,0,194,4,0,0,0,0,0,0,109,41,0,0,
+114,41,0,0,228,4,0,0,0,0,0,0,134,41,0,0,140,41,0,0,
+232,4,0,0,0,0,0,0,160,41,0,0,166,41,0,0,233,4,0,0,
+0,0,0,0,186,41,0,0,191,41,0,0,237,4,0,0,0,0,0,0,
+205,41,0,0,210,41,0,0,18,5,0,0,0,0,0,0,217,41,0,0,
+233,41,0,0,20,5,0,0,0,0,0,0,247,41,0,0,4,42,0,0,
+23,5,0,0,0,0,0,0,22,42,0,0,35,42,0,0,26,5,0,0,
+0,0,0,0,53,42,0,0,65,42,0,0,41,5,0,0,0,0,0,0,
+77,42,0,0,83,42,0,0,52,5,0,0,0,0,0,0,100,42,0,0,
+112,42,0,0,65,5,0,0,0,0,0,0,126,42,0,0,139,42,0,0,
+66,5,0,0,0,0,0,0,156,42,0,0,171,42,0,0,67,5,0,0,
+0,0,0,0,189,42,0,0,204,42,0,0,68,5,0,0,0,0,0,0,
+224,42,0,0,241,42,0,0,79,5,0,0,0,0,0,0,1,43,0,0,
+14,43,0,0,81,5,0,0,0,0,0,0,29,43,0,0,43,43,0,0,
+82,5,0,0,0,0,0,0,56,43,0,0,72,43,0,0,83,5,0,0,
+0,0,0,0,85,43,0,0,99,43,0,0,86,5,0,0,0,0,0,0,
+113,43,0,0,124,43,0,0,88,5,0,0,0,0,0,0,170,43,0,0,
+183,43,0,0,90,5,0,0,0,0,0,0,194,43,0,0,203,43,0,0,
+91,5,0,0,0,0,0,0,216,43,0,0,221,43,0,0,92,5,0,0,
+0,0,0,0,235,43,0,0,242,43,0,0,93,5,0,0,0,0,0,0,
+252,43,0,0,1,44,0,0,97,5,0,0,0,0,0,0,14,44,0,0,
+17,44,0,0,98,5,0,0,0,0,0,0,22,44,0,0,28,44,0,0,
+99,5,0,0,0,0,0,0,38,44,0,0,41,44,0,0,100,5,0,0,
+0,0,0,0,47,44,0,0,55,44,0,0,101,5,0,0,0,0,0,0,
+63,44,0,0,70,44,0,0,106,5,0,0,0,0,0,0,79,44,0,0,
+87,44,0,0,107,5,0,0,0,0,0,0,97,44,0,0,108,44,0,0,
+108,5,0,0,0,0,0,0,119,44,0,0,129,44,0,0,109,5,0,0,
+0,0,0,0,140,44,0,0,150,44,0,0,110,5,0,0,0,0,0,0,
+155,44,0,0,165,44,0,0,111,5,0,0,0,0,0,0,179,44,0,0,
+192,44,0,0,112,5,0,0,0,0,0,0,200,44,0,0,211,44,0,0,
+113,5,0,0,0,0,0,0,219,44,0,0,228,44,0,0,114,5,0,0,
+0,0,0,0,236,44,0,0,247,44,0,0,115,5,0,0,0,0,0,0,
+2,45,0,0,16,45,0,0,116,5,0,0,0,0,0,0,29,45,0,0,
+41,45,0,0,117,5,0,0,0,0,0,0,49,45,0,0,65,45,0,0,
+118,5,0,0,0,0,0,0,73,45,0,0,86,45,0,0,128,5,0,0,
+0,0,0,0,103,45,0,0,114,45,0,0,140,5,0,0,0,0,0,0,
+126,45,0,0,135,45,0,0,141,5,0,0,0,0,0,0,146,45,0,0,
+155,45,0,0,142,5,0,0,0,0,0,0,167,45,0,0,175,45,0,0,
+143,5,0,0,0,0,0,0,190,45,0,0,201,45,0,0,144,5,0,0,
+0,0,0,0,213,45,0,0,223,45,0,0,145,5,0,0,0,0,0,0,
+234,45,0,0,244,45,0,0,146,5,0,0,0,0,0,0,253,45,0,0,
+8,46,0,0,147,5,0,0,0,0,0,0,18,46,0,0,27,46,0,0,
+148,5,0,0,0,0,0,0,38,46,0,0,50,46,0,0,155,5,0,0,
+0,0,0,0,71,46,0,0,81,46,0,0,156,5,0,0,0,0,0,0,
+103,46,0,0,113,46,0,0,157,5,0,0,0,0,0,0,126,46,0,0,
+135,46,0,0,158,5,0,0,0,0,0,0,156,46,0,0,168,46,0,0,
+159,5,0,0,0,0,0,0,189,46,0,0,200,46,0,0,160,5,0,0,
+0,0,0,0,221,46,0,0,232,46,0,0,161,5,0,0,0,0,0,0,
+253,46,0,0,9,47,0,0,162,5,0,0,0,0,0,0,30,47,0,0,
+40,47,0,0,163,5,0,0,0,0,0,0,61,47,0,0,77,47,0,0,
+172,5,0,0,0,0,0,0,89,47,0,0,112,47,0,0,173,5,0,0,
+0,0,0,0,125,47,0,0,143,47,0,0,174,5,0,0,0,0,0,0,
+187,47,0,0,196,47,0,0,176,5,0,0,0,0,0,0,211,47,0,0,
+221,47,0,0,177,5,0,0,0,0,0,0,236,47,0,0,247,47,0,0,
+179,5,0,0,0,0,0,0,255,47,0,0,9,48,0,0,180,5,0,0,
+0,0,0,0,18,48,0,0,26,48,0,0,206,5,0,0,0,0,0,0,
+40,48,0,0,53,48,0,0,208,5,0,0,0,0,0,0,75,48,0,0,
+92,48,0,0,212,5,0,0,0,0,0,0,119,48,0,0,122,48,0,0,
+213,5,0,0,0,0,0,0,139,48,0,0,149,48,0,0,216,5,0,0,
+0,0,0,0,162,48,0,0,170,48,0,0,217,5,0,0,0,0,0,0,
+180,48,0,0,188,48,0,0,220,5,0,0,0,0,0,0,204,48,0,0,
+213,48,0,0,221,5,0,0,0,0,0,0,223,48,0,0,236,48,0,0,
+222,5,0,0,0,0,0,0,247,48,0,0,3,49,0,0,223,5,0,0,
+0,0,0,0,14,49,0,0,26,49,0,0,233,5,0,0,0,0,0,0,
+46,49,0,0,56,49,0,0,234,5,0,0,0,0,0,0,78,49,0,0,
+92,49,0,0,235,5,0,0,0,0,0,0,114,49,0,0,123,49,0,0,
+236,5,0,0,0,0,0,0,143,49,0,0,155,49,0,0,237,5,0,0,
+0,0,0,0,177,49,0,0,188,49,0,0,238,5,0,0,0,0,0,0,
+209,49,0,0,220,49,0,0,239,5,0,0,0,0,0,0,241,49,0,0,
+253,49,0,0,240,5,0,0,0,0,0,0,18,50,0,0,28,50,0,0,
+241,5,0,0,0,0,0,0,47,50,0,0,66,50,0,0,243,5,0,0,
+0,0,0,0,78,50,0,0,88,50,0,0,244,5,0,0,0,0,0,0,
+130,50,0,0,139,50,0,0,245,5,0,0,0,0,0,0,168,50,0,0,
+183,50,0,0,250,5,0,0,0,0,0,0,197,50,0,0,210,50,0,0,
+251,5,0,0,0,0,0,0,223,50,0,0,235,50,0,0,252,5,0,0,
+0,0,0,0,249,50,0,0,8,51,0,0,253,5,0,0,0,0,0,0,
+21,51,0,0,35,51,0,0,254,5,0,0,0,0,0,0,47,51,0,0,
+61,51,0,0,255,5,0,0,0,0,0,0,74,51,0,0,89,51,0,0,
+0,6,0,0,0,0,0,0,102,51,0,0,115,51,0,0,1,6,0,0,
+0,0,0,0,127,51,0,0,141,51,0,0,6,6,0,0,0,0,0,0,
+149,51,0,0,161,51,0,0,7,6,0,0,0,0,0,0,172,51,0,0,
+184,51,0,0,8,6,0,0,0,0,0,0,195,51,0,0,206,51,0,0,
+9,6,0,0,0,0,0,0,217,51,0,0,231,51,0,0,10,6,0,0,
+0,0,0,0,240,51,0,0,253,51,0,0,11,6,0,0,0,0,0,0,
+6,52,0,0,19,52,0,0,12,6,0,0,0,0,0,0,28,52,0,0,
+42,52,0,0,13,6,0,0,0,0,0,0,51,52,0,0,63,52,0,0,
+14,6,0,0,0,0,0,0,71,52,0,0,83,52,0,0,16,6,0,0,
+0,0,0,0,94,52,0,0,105,52,0,0,25,6,0,0,0,0,0,0,
+118,52,0,0,131,52,0,0,26,6,0,0,0,0,0,0,133,52,0,0,
+146,52,0,0,27,6,0,0,0,0,0,0,151,52,0,0,164,52,0,0,
+31,6,0,0,0,0,0,0,175,52,0,0,186,52,0,0,32,6,0,0,
+0,0,0,0,223,52,0,0,238,52,0,0,34,6,0,0,0,0,0,0,
+8,53,0,0,21,53,0,0,35,6,0,0,0,0,0,0,39,53,0,0,
+47,53,0,0,36,6,0,0,0,0,0,0,60,53,0,0,68,53,0,0,
+37,6,0,0,0,0,0,0,76,53,0,0,91,53,0,0,43,6,0,0,
+0,0,0,0,95,53,0,0,109,53,0,0,44,6,0,0,0,0,0,0,
+113,53,0,0,126,53,0,0,45,6,0,0,0,0,0,0,132,53,0,0,
+143,53,0,0,46,6,0,0,0,0,0,0,149,53,0,0,157,53,0,0,
+47,6,0,0,0,0,0,0,168,53,0,0,181,53,0,0,48,6,0,0,
+0,0,0,0,191,53,0,0,203,53,0,0,49,6,0,0,0,0,0,0,
+205,53,0,0,208,53,0,0,70,6,0,0,0,0,0,0,223,53,0,0,
+227,53,0,0,74,6,0,0,0,0,0,0,242,53,0,0,247,53,0,0,
+77,6,0,0,0,0,0,0,255,53,0,0,2,54,0,0,78,6,0,0,
+0,0,0,0,7,54,0,0,12,54,0,0,79,6,0,0,0,0,0,0,
+20,54,0,0,25,54,0,0,80,6,0,0,0,0,0,0,30,54,0,0,
+33,54,0,0,81,6,0,0,0,0,0,0,38,54,0,0,43,54,0,0,
+82,6,0,0,0,0,0,0,48,54,0,0,51,54,0,0,83,6,0,0,
+0,0,0,0,56,54,0,0,61,54,0,0,84,6,0,0,0,0,0,0,
+69,54,0,0,74,54,0,0,88,6,0,0,0,0,0,0,84,54,0,0,
+88,54,0,0,89,6,0,0,0,0,0,0,97,54,0,0,103,54,0,0,
+90,6,0,0,0,0,0,0,107,54,0,0,115,54,0,0,91,6,0,0,
+0,0,0,0,122,54,0,0,134,54,0,0,92,6,0,0,0,0,0,0,
+139,54,0,0,146,54,0,0,93,6,0,0,0,0,0,0,153,54,0,0,
+168,54,0,0,97,6,0,0,0,0,0,0,180,54,0,0,192,54,0,0,
+98,6,0,0,0,0,0,0,207,54,0,0,221,54,0,0,99,6,0,0,
+0,0,0,0,240,54,0,0,254,54,0,0,100,6,0,0,0,0,0,0,
+19,55,0,0,25,55,0,0,101,6,0,0,0,0,0,0,31,55,0,0,
+36,55,0,0,102,6,0,0,0,0,0,0,48,55,0,0,51,55,0,0,
+103,6,0,0,0,0,0,0,57,55,0,0,64,55,0,0,104,6,0,0,
+0,0,0,0,81,55,0,0,89,55,0,0,105,6,0,0,0,0,0,0,
+100,55,0,0,112,55,0,0,106,6,0,0,0,0,0,0,128,55,0,0,
+139,55,0,0,107,6,0,0,0,0,0,0,157,55,0,0,165,55,0,0,
+108,6,0,0,0,0,0,0,172,55,0,0,181,55,0,0,109,6,0,0,
+0,0,0,0,192,55,0,0,202,55,0,0,110,6,0,0,0,0,0,0,
+211,55,0,0,224,55,0,0,112,6,0,0,0,0,0,0,239,55,0,0,
+254,55,0,0,114,6,0,0,0,0,0,0,5,56,0,0,19,56,0,0,
+115,6,0,0,0,0,0,0,40,56,0,0,54,56,0,0,116,6,0,0,
+0,0,0,0,69,56,0,0,82,56,0,0,117,6,0,0,0,0,0,0,
+96,56,0,0,108,56,0,0,119,6,0,0,0,0,0,0,116,56,0,0,
+127,56,0,0,120,6,0,0,0,0,0,0,144,56,0,0,154,56,0,0,
+122,6,0,0,0,0,0,0,162,56,0,0,171,56,0,0,123,6,0,0,
+0,0,0,0,186,56,0,0,193,56,0,0,130,6,0,0,0,0,0,0,
+198,56,0,0,211,56,0,0,133,6,0,0,0,0,0,0,218,56,0,0,
+224,56,0,0,141,6,0,0,0,0,0,0,242,56,0,0,251,56,0,0,
+142,6,0,0,0,0,0,0,1,57,0,0,13,57,0,0,143,6,0,0,
+0,0,0,0,19,57,0,0,27,57,0,0,144,6,0,0,0,0,0,0,
+40,57,0,0,56,57,0,0,145,6,0,0,0,0,0,0,65,57,0,0,
+78,57,0,0,146,6,0,0,0,0,0,0,93,57,0,0,110,57,0,0,
+147,6,0,0,0,0,0,0,125,57,0,0,130,57,0,0,148,6,0,0,
+0,0,0,0,148,57,0,0,154,57,0,0,149,6,0,0,0,0,0,0,
+157,57,0,0,163,57,0,0,150,6,0,0,0,0,0,0,169,57,0,0,
+175,57,0,0,154,6,0,0,0,0,0,0,189,57,0,0,192,57,0,0,
+155,6,0,0,0,0,0,0,198,57,0,0,204,57,0,0,156,6,0,0,
+0,0,0,0,217,57,0,0,223,57,0,0,161,6,0,0,0,0,0,0,
+234,57,0,0,237,57,0,0,162,6,0,0,0,0,0,0,243,57,0,0,
+248,57,0,0,163,6,0,0,0,0,0,0,3,58,0,0,6,58,0,0,
+164,6,0,0,0,0,0,0,11,58,0,0,27,58,0,0,165,6,0,0,
+0,0,0,0,38,58,0,0,42,58,0,0,166,6,0,0,0,0,0,0,
+56,58,0,0,75,58,0,0,167,6,0,0,0,0,0,0,91,58,0,0,
+97,58,0,0,168,6,0,0,0,0,0,0,106,58,0,0,115,58,0,0,
+169,6,0,0,0,0,0,0,123,58,0,0,137,58,0,0,170,6,0,0,
+0,0,0,0,147,58,0,0,166,58,0,0,171,6,0,0,0,0,0,0,
+179,58,0,0,192,58,0,0,172,6,0,0,0,0,0,0,211,58,0,0,
+221,58,0,0,177,6,0,0,0,0,0,0,232,58,0,0,242,58,0,0,
+178,6,0,0,0,0,0,0,1,59,0,0,5,59,0,0,179,6,0,0,
+0,0,0,0,15,59,0,0,27,59,0,0,180,6,0,0,0,0,0,0,
+42,59,0,0,46,59,0,0,181,6,0,0,0,0,0,0,58,59,0,0,
+67,59,0,0,184,6,0,0,0,0,0,0,86,59,0,0,97,59,0,0,
+185,6,0,0,0,0,0,0,118,59,0,0,129,59,0,0,186,6,0,0,
+0,0,0,0,150,59,0,0,160,59,0,0,187,6,0,0,0,0,0,0,
+170,59,0,0,182,59,0,0,191,6,0,0,0,0,0,0,191,59,0,0,
+203,59,0,0,192,6,0,0,0,0,0,0,209,59,0,0,215,59,0,0,
+193,6,0,0,0,0,0,0,227,59,0,0,230,59,0,0,194,6,0,0,
+0,0,0,0,236,59,0,0,250,59,0,0,195,6,0,0,0,0,0,0,
+6,60,0,0,23,60,0,0,196,6,0,0,0,0,0,0,35,60,0,0,
+41,60,0,0,197,6,0,0,0,0,0,0,52,60,0,0,60,60,0,0,
+204,6,0,0,0,0,0,0,70,60,0,0,78,60,0,0,205,6,0,0,
+0,0,0,0,88,60,0,0,95,60,0,0,206,6,0,0,0,0,0,0,
+107,60,0,0,117,60,0,0,207,6,0,0,0,0,0,0,128,60,0,0,
+137,60,0,0,211,6,0,0,0,0,0,0,146,60,0,0,150,60,0,0,
+212,6,0,0,0,0,0,0,157,60,0,0,163,60,0,0,213,6,0,0,
+0,0,0,0,174,60,0,0,179,60,0,0,214,6,0,0,0,0,0,0,
+189,60,0,0,194,60,0,0,215,6,0,0,0,0,0,0,203,60,0,0,
+211,60,0,0,216,6,0,0,0,0,0,0,224,60,0,0,231,60,0,0,
+217,6,0,0,0,0,0,0,243,60,0,0,250,60,0,0,218,6,0,0,
+0,0,0,0,5,61,0,0,18,61,0,0,219,6,0,0,0,0,0,0,
+30,61,0,0,40,61,0,0,220,6,0,0,0,0,0,0,51,61,0,0,
+63,61,0,0,221,6,0,0,0,0,0,0,78,61,0,0,81,61,0,0,
+222,6,0,0,0,0,0,0,87,61,0,0,90,61,0,0,223,6,0,0,
+0,0,0,0,95,61,0,0,100,61,0,0,224,6,0,0,0,0,0,0,
+111,61,0,0,118,61,0,0,225,6,0,0,0,0,0,0,131,61,0,0,
+136,61,0,0,226,6,0,0,0,0,0,0,146,61,0,0,159,61,0,0,
+227,6,0,0,0,0,0,0,173,61,0,0,186,61,0,0,228,6,0,0,
+0,0,0,0,197,61,0,0,205,61,0,0,229,6,0,0,0,0,0,0,
+219,61,0,0,227,61,0,0,230,6,0,0,0,0,0,0,239,61,0,0,
+247,61,0,0,231,6,0,0,0,0,0,0,3,62,0,0,19,62,0,0,
+232,6,0,0,0,0,0,0,31,62,0,0,38,62,0,0,233,6,0,0,
+0,0,0,0,54,62,0,0,58,62,0,0,234,6,0,0,0,0,0,0,
+65,62,0,0,76,62,0,0,235,6,0,0,0,0,0,0,91,62,0,0,
+100,62,0,0,236,6,0,0,0,0,0,0,109,62,0,0,118,62,0,0,
+241,6,0,0,0,0,0,0,131,62,0,0,134,62,0,0,242,6,0,0,
+0,0,0,0,141,62,0,0,146,62,0,0,243,6,0,0,0,0,0,0,
+157,62,0,0,164,62,0,0,244,6,0,0,0,0,0,0,177,62,0,0,
+184,62,0,0,245,6,0,0,0,0,0,0,197,62,0,0,200,62,0,0,
+246,6,0,0,0,0,0,0,205,62,0,0,215,62,0,0,247,6,0,0,
+0,0,0,0,226,62,0,0,235,62,0,0,248,6,0,0,0,0,0,0,
+249,62,0,0,1,63,0,0,249,6,0,0,0,0,0,0,14,63,0,0,
+24,63,0,0,250,6,0,0,0,0,0,0,34,63,0,0,50,63,0,0,
+253,6,0,0,0,0,0,0,60,63,0,0,73,63,0,0,254,6,0,0,
+0,0,0,0,88,63,0,0,100,63,0,0,24,7,0,0,0,0,0,0,
+106,63,0,0,120,63,0,0,25,7,0,0,0,0,0,0,126,63,0,0,
+137,63,0,0,26,7,0,0,0,0,0,0,143,63,0,0,153,63,0,0,
+27,7,0,0,0,0,0,0,159,63,0,0,172,63,0,0,28,7,0,0,
+0,0,0,0,178,63,0,0,188,63,0,0,29,7,0,0,0,0,0,0,
+194,63,0,0,205,63,0,0,30,7,0,0,0,0,0,0,211,63,0,0,
+228,63,0,0,31,7,0,0,0,0,0,0,234,63,0,0,245,63,0,0,
+35,7,0,0,0,0,0,0,254,63,0,0,5,64,0,0,36,7,0,0,
+0,0,0,0,16,64,0,0,21,64,0,0,37,7,0,0,0,0,0,0,
+28,64,0,0,35,64,0,0,38,7,0,0,0,0,0,0,41,64,0,0,
+47,64,0,0,39,7,0,0,0,0,0,0,60,64,0,0,71,64,0,0,
+40,7,0,0,0,0,0,0,78,64,0,0,88,64,0,0,41,7,0,0,
+0,0,0,0,103,64,0,0,113,64,0,0,42,7,0,0,0,0,0,0,
+122,64,0,0,129,64,0,0,43,7,0,0,0,0,0,0,139,64,0,0,
+151,64,0,0,45,7,0,0,0,0,0,0,158,64,0,0,170,64,0,0,
+46,7,0,0,0,0,0,0,177,64,0,0,189,64,0,0,47,7,0,0,
+0,0,0,0,197,64,0,0,210,64,0,0,51,7,0,0,0,0,0,0,
+223,64,0,0,235,64,0,0,52,7,0,0,0,0,0,0,252,64,0,0,
+9,65,0,0,53,7,0,0,0,0,0,0,22,65,0,0,28,65,0,0,
+57,7,0,0,0,0,0,0,35,65,0,0,44,65,0,0,58,7,0,0,
+0,0,0,0,53,65,0,0,62,65,0,0,59,7,0,0,0,0,0,0,
+71,65,0,0,82,65,0,0,60,7,0,0,0,0,0,0,91,65,0,0,
+102,65,0,0,61,7,0,0,0,0,0,0,111,65,0,0,121,65,0,0,
+62,7,0,0,0,0,0,0,130,65,0,0,145,65,0,0,63,7,0,0,
+0,0,0,0,155,65,0,0,167,65,0,0,70,7,0,0,0,0,0,0,
+175,65,0,0,179,65,0,0,71,7,0,0,0,0,0,0,193,65,0,0,
+202,65,0,0,77,7,0,0,0,0,0,0,212,65,0,0,222,65,0,0,
+78,7,0,0,0,0,0,0,232,65,0,0,247,65,0,0,88,7,0,0,
+0,0,0,0,0,66,0,0,10,66,0,0,89,7,0,0,0,0,0,0,
+20,66,0,0,32,66,0,0,90,7,0,0,0,0,0,0,47,66,0,0,
+58,66,0,0,91,7,0,0,0,0,0,0,73,66,0,0,85,66,0,0,
+92,7,0,0,0,0,0,0,99,66,0,0,114,66,0,0,109,7,0,0,
+0,0,0,0,121,66,0,0,126,66,0,0,115,7,0,0,0,0,0,0,
+130,66,0,0,134,66,0,0,116,7,0,0,0,0,0,0,140,66,0,0,
+148,66,0,0,117,7,0,0,0,0,0,0,155,66,0,0,163,66,0,0,
+118,7,0,0,0,0,0,0,172,66,0,0,182,66,0,0,119,7,0,0,
+0,0,0,0,186,66,0,0,190,66,0,0,120,7,0,0,0,0,0,0,
+193,66,0,0,197,66,0,0,121,7,0,0,0,0,0,0,202,66,0,0,
+216,66,0,0,122,7,0,0,0,0,0,0,232,66,0,0,248,66,0,0,
+123,7,0,0,0,0,0,0,2,67,0,0,22,67,0,0,124,7,0,0,
+0,0,0,0,32,67,0,0,41,67,0,0,125,7,0,0,0,0,0,0,
+62,67,0,0,65,67,0,0,141,7,0,0,0,0,0,0,78,67,0,0,
+89,67,0,0,145,7,0,0,0,0,0,0,112,67,0,0,125,67,0,0,
+150,7,0,0,0,0,0,0,149,67,0,0,160,67,0,0,154,7,0,0,
+0,0,0,0,182,67,0,0,193,67,0,0,160,7,0,0,0,0,0,0,
+217,67,0,0,232,67,0,0,164,7,0,0,0,0,0,0,240,67,0,0,
+247,67,0,0,165,7,0,0,0,0,0,0,11,68,0,0,19,68,0,0,
+166,7,0,0,0,0,0,0,39,68,0,0,53,68,0,0,167,7,0,0,
+0,0,0,0,68,68,0,0,82,68,0,0,168,7,0,0,0,0,0,0,
+89,68,0,0,104,68,0,0,169,7,0,0,0,0,0,0,112,68,0,0,
+120,68,0,0,170,7,0,0,0,0,0,0,128,68,0,0,136,68,0,0,
+171,7,0,0,0,0,0,0,147,68,0,0,153,68,0,0,176,7,0,0,
+0,0,0,0,158,68,0,0,164,68,0,0,177,7,0,0,0,0,0,0,
+170,68,0,0,174,68,0,0,178,7,0,0,0,0,0,0,180,68,0,0,
+196,68,0,0,179,7,0,0,0,0,0,0,216,68,0,0,232,68,0,0,
+180,7,0,0,0,0,0,0,240,68,0,0,2,69,0,0,181,7,0,0,
+0,0,0,0,18,69,0,0,26,69,0,0,182,7,0,0,0,0,0,0,
+45,69,0,0,51,69,0,0,183,7,0,0,0,0,0,0,59,69,0,0,
+67,69,0,0,187,7,0,0,0,0,0,0,79,69,0,0,89,69,0,0,
+188,7,0,0,0,0,0,0,100,69,0,0,113,69,0,0,189,7,0,0,
+0,0,0,0,123,69,0,0,130,69,0,0,190,7,0,0,0,0,0,0,
+141,69,0,0,154,69,0,0,191,7,0,0,0,0,0,0,166,69,0,0,
+173,69,0,0,192,7,0,0,0,0,0,0,186,69,0,0,193,69,0,0,
+193,7,0,0,0,0,0,0,204,69,0,0,211,69,0,0,194,7,0,0,
+0,0,0,0,223,69,0,0,231,69,0,0,195,7,0,0,0,0,0,0,
+244,69,0,0,253,69,0,0,196,7,0,0,0,0,0,0,7,70,0,0,
+16,70,0,0,213,7,0,0,0,0,0,0,28,70,0,0,37,70,0,0,
+214,7,0,0,0,0,0,0,48,70,0,0,63,70,0,0,215,7,0,0,
+0,0,0,0,78,70,0,0,88,70,0,0,216,7,0,0,0,0,0,0,
+99,70,0,0,110,70,0,0,217,7,0,0,0,0,0,0,122,70,0,0,
+126,70,0,0,226,7,0,0,0,0,0,0,137,70,0,0,144,70,0,0,
+227,7,0,0,0,0,0,0,155,70,0,0,165,70,0,0,228,7,0,0,
+0,0,0,0,176,70,0,0,181,70,0,0,229,7,0,0,0,0,0,0,
+193,70,0,0,200,70,0,0,230,7,0,0,0,0,0,0,207,70,0,0,
+214,70,0,0,231,7,0,0,0,0,0,0,227,70,0,0,231,70,0,0,
+232,7,0,0,0,0,0,0,244,70,0,0,253,70,0,0,233,7,0,0,
+0,0,0,0,9,71,0,0,14,71,0,0,234,7,0,0,0,0,0,0,
+25,71,0,0,31,71,0,0,235,7,0,0,0,0,0,0,42,71,0,0,
+47,71,0,0,236,7,0,0,0,0,0,0,58,71,0,0,65,71,0,0,
+237,7,0,0,0,0,0,0,74,71,0,0,83,71,0,0,238,7,0,0,
+0,0,0,0,94,71,0,0,99,71,0,0,239,7,0,0,0,0,0,0,
+113,71,0,0,128,71,0,0,240,7,0,0,0,0,0,0,142,71,0,0,
+153,71,0,0,241,7,0,0,0,0,0,0,168,71,0,0,183,71,0,0,
+246,7,0,0,0,0,0,0,195,71,0,0,206,71,0,0,247,7,0,0,
+0,0,0,0,223,71,0,0,235,71,0,0,248,7,0,0,0,0,0,0,
+244,71,0,0,0,72,0,0,249,7,0,0,0,0,0,0,8,72,0,0,
+22,72,0,0,250,7,0,0,0,0,0,0,30,72,0,0,41,72,0,0,
+251,7,0,0,0,0,0,0,53,72,0,0,69,72,0,0,253,7,0,0,
+0,0,0,0,77,72,0,0,86,72,0,0,0,8,0,0,0,0,0,0,
+99,72,0,0,106,72,0,0,1,8,0,0,0,0,0,0,113,72,0,0,
+119,72,0,0,9,8,0,0,0,0,0,0,130,72,0,0,141,72,0,0,
+13,8,0,0,0,0,0,0,152,72,0,0,157,72,0,0,15,8,0,0,
+0,0,0,0,169,72,0,0,174,72,0,0,20,8,0,0,0,0,0,0,
+184,72,0,0,189,72,0,0,21,8,0,0,0,0,0,0,197,72,0,0,
+208,72,0,0,22,8,0,0,0,0,0,0,218,72,0,0,229,72,0,0,
+23,8,0,0,0,0,0,0,239,72,0,0,243,72,0,0,24,8,0,0,
+0,0,0,0,254,72,0,0,3,73,0,0,26,8,0,0,0,0,0,0,
+12,73,0,0,17,73,0,0,28,8,0,0,0,0,0,0,26,73,0,0,
+31,73,0,0,33,8,0,0,0,0,0,0,40,73,0,0,53,73,0,0,
+34,8,0,0,0,0,0,0,69,73,0,0,76,73,0,0,37,8,0,0,
+0,0,0,0,81,73,0,0,86,73,0,0,38,8,0,0,0,0,0,0,
+93,73,0,0,101,73,0,0,39,8,0,0,0,0,0,0,109,73,0,0,
+117,73,0,0,40,8,0,0,0,0,0,0,128,73,0,0,134,73,0,0,
+44,8,0,0,0,0,0,0,140,73,0,0,147,73,0,0,45,8,0,0,
+0,0,0,0,152,73,0,0,158,73,0,0,46,8,0,0,0,0,0,0,
+164,73,0,0,172,73,0,0,47,8,0,0,0,0,0,0,180,73,0,0,
+190,73,0,0,48,8,0,0,0,0,0,0,199,73,0,0,207,73,0,0,
+49,8,0,0,0,0,0,0,214,73,0,0,228,73,0,0,55,8,0,0,
+0,0,0,0,233,73,0,0,238,73,0,0,57,8,0,0,0,0,0,0,
+245,73,0,0,4,74,0,0,59,8,0,0,0,0,0,0,10,74,0,0,
+27,74,0,0,60,8,0,0,0,0,0,0,33,74,0,0,47,74,0,0,
+61,8,0,0,0,0,0,0,54,74,0,0,67,74,0,0,62,8,0,0,
+0,0,0,0,74,74,0,0,81,74,0,0,63,8,0,0,0,0,0,0,
+95,74,0,0,105,74,0,0,64,8,0,0,0,0,0,0,110,74,0,0,
+121,74,0,0,65,8,0,0,0,0,0,0,126,74,0,0,131,74,0,0,
+66,8,0,0,0,0,0,0,138,74,0,0,148,74,0,0,67,8,0,0,
+0,0,0,0,155,74,0,0,161,74,0,0,71,8,0,0,0,0,0,0,
+173,74,0,0,177,74,0,0,87,8,0,0,0,0,0,0,188,74,0,0,
+193,74,0,0,88,8,0,0,0,0,0,0,204,74,0,0,210,74,0,0,
+89,8,0,0,0,0,0,0,221,74,0,0,224,74,0,0,90,8,0,0,
+0,0,0,0,235,74,0,0,239,74,0,0,91,8,0,0,0,0,0,0,
+248,74,0,0,2,75,0,0,92,8,0,0,0,0,0,0,10,75,0,0,
+16,75,0,0,96,8,0,0,0,0,0,0,25,75,0,0,38,75,0,0,
+97,8,0,0,0,0,0,0,49,75,0,0,60,75,0,0,98,8,0,0,
+0,0,0,0,77,75,0,0,83,75,0,0,99,8,0,0,0,0,0,0,
+96,75,0,0,103,75,0,0,100,8,0,0,0,0,0,0,116,75,0,0,
+124,75,0,0,101,8,0,0,0,0,0,0,137,75,0,0,143,75,0,0,
+102,8,0,0,0,0,0,0,154,75,0,0,164,75,0,0,103,8,0,0,
+0,0,0,0,171,75,0,0,183,75,0,0,104,8,0,0,0,0,0,0,
+190,75,0,0,201,75,0,0,114,8,0,0,0,0,0,0,211,75,0,0,
+222,75,0,0,115,8,0,0,0,0,0,0,232,75,0,0,245,75,0,0,
+116,8,0,0,0,0,0,0,0,76,0,0,11,76,0,0,117,8,0,0,
+0,0,0,0,20,76,0,0,31,76,0,0,118,8,0,0,0,0,0,0,
+40,76,0,0,52,76,0,0,119,8,0,0,0,0,0,0,63,76,0,0,
+69,76,0,0,123,8,0,0,0,0,0,0,80,76,0,0,89,76,0,0,
+124,8,0,0,0,0,0,0,100,76,0,0,113,76,0,0,125,8,0,0,
+0,0,0,0,119,76,0,0,130,76,0,0,126,8,0,0,0,0,0,0,
+147,76,0,0,162,76,0,0,127,8,0,0,0,0,0,0,175,76,0,0,
+188,76,0,0,128,8,0,0,0,0,0,0,203,76,0,0,207,76,0,0,
+129,8,0,0,0,0,0,0,220,76,0,0,226,76,0,0,130,8,0,0,
+0,0,0,0,237,76,0,0,243,76,0,0,131,8,0,0,0,0,0,0,
+0,77,0,0,7,77,0,0,132,8,0,0,0,0,0,0,20,77,0,0,
+28,77,0,0,133,8,0,0,0,0,0,0,41,77,0,0,61,77,0,0,
+137,8,0,0,0,0,0,0,67,77,0,0,74,77,0,0,138,8,0,0,
+0,0,0,0,94,77,0,0,102,77,0,0,139,8,0,0,0,0,0,0,
+122,77,0,0,131,77,0,0,140,8,0,0,0,0,0,0,151,77,0,0,
+169,77,0,0,141,8,0,0,0,0,0,0,193,77,0,0,200,77,0,0,
+142,8,0,0,0,0,0,0,218,77,0,0,224,77,0,0,146,8,0,0,
+0,0,0,0,231,77,0,0,240,77,0,0,147,8,0,0,0,0,0,0,
+248,77,0,0,253,77,0,0,148,8,0,0,0,0,0,0,11,78,0,0,
+16,78,0,0,149,8,0,0,0,0,0,0,25,78,0,0,34,78,0,0,
+150,8,0,0,0,0,0,0,47,78,0,0,53,78,0,0,151,8,0,0,
+0,0,0,0,63,78,0,0,68,78,0,0,155,8,0,0,0,0,0,0,
+80,78,0,0,84,78,0,0,156,8,0,0,0,0,0,0,89,78,0,0,
+95,78,0,0,157,8,0,0,0,0,0,0,103,78,0,0,116,78,0,0,
+158,8,0,0,0,0,0,0,121,78,0,0,135,78,0,0,159,8,0,0,
+0,0,0,0,151,78,0,0,159,78,0,0,160,8,0,0,0,0,0,0,
+169,78,0,0,174,78,0,0,161,8,0,0,0,0,0,0,186,78,0,0,
+193,78,0,0,162,8,0,0,0,0,0,0,203,78,0,0,212,78,0,0,
+166,8,0,0,0,0,0,0,219,78,0,0,226,78,0,0,172,8,0,0,
+0,0,0,0,237,78,0,0,254,78,0,0,173,8,0,0,0,0,0,0,
+11,79,0,0,24,79,0,0,174,8,0,0,0,0,0,0,35,79,0,0,
+46,79,0,0,175,8,0,0,0,0,0,0,60,79,0,0,64,79,0,0,
+176,8,0,0,0,0,0,0,77,79,0,0,94,79,0,0,177,8,0,0,
+0,0,0,0,107,79,0,0,125,79,0,0,178,8,0,0,0,0,0,0,
+136,79,0,0,154,79,0,0,179,8,0,0,0,0,0,0,167,79,0,0,
+180,79,0,0,180,8,0,0,0,0,0,0,191,79,0,0,205,79,0,0,
+181,8,0,0,0,0,0,0,219,79,0,0,233,79,0,0,182,8,0,0,
+0,0,0,0,244,79,0,0,6,80,0,0,183,8,0,0,0,0,0,0,
+20,80,0,0,39,80,0,0,184,8,0,0,0,0,0,0,52,80,0,0,
+71,80,0,0,185,8,0,0,0,0,0,0,84,80,0,0,95,80,0,0,
+186,8,0,0,0,0,0,0,111,80,0,0,129,80,0,0,187,8,0,0,
+0,0,0,0,140,80,0,0,159,80,0,0,188,8,0,0,0,0,0,0,
+170,80,0,0,189,80,0,0,189,8,0,0,0,0,0,0,200,80,0,0,
+213,80,0,0,190,8,0,0,0,0,0,0,224,80,0,0,238,80,0,0,
+191,8,0,0,0,0,0,0,249,80,0,0,7,81,0,0,192,8,0,0,
+0,0,0,0,18,81,0,0,29,81,0,0,193,8,0,0,0,0,0,0,
+41,81,0,0,46,81,0,0,194,8,0,0,0,0,0,0,58,81,0,0,
+68,81,0,0,195,8,0,0,0,0,0,0,80,81,0,0,89,81,0,0,
+196,8,0,0,0,0,0,0,104,81,0,0,114,81,0,0,197,8,0,0,
+0,0,0,0,128,81,0,0,134,81,0,0,198,8,0,0,0,0,0,0,
+149,81,0,0,155,81,0,0,199,8,0,0,0,0,0,0,167,81,0,0,
+182,81,0,0,200,8,0,0,0,0,0,0,193,81,0,0,210,81,0,0,
+201,8,0,0,0,0,0,0,222,81,0,0,238,81,0,0,202,8,0,0,
+0,0,0,0,250,81,0,0,8,82,0,0,204,8,0,0,0,0,0,0,
+26,82,0,0,31,82,0,0,205,8,0,0,0,0,0,0,43,82,0,0,
+54,82,0,0,206,8,0,0,0,0,0,0,68,82,0,0,86,82,0,0,
+207,8,0,0,0,0,0,0,100,82,0,0,104,82,0,0,214,8,0,0,
+0,0,0,0,113,82,0,0,122,82,0,0,215,8,0,0,0,0,0,0,
+131,82,0,0,139,82,0,0,216,8,0,0,0,0,0,0,150,82,0,0,
+160,82,0,0,217,8,0,0,0,0,0,0,188,82,0,0,203,82,0,0,
+218,8,0,0,0,0,0,0,219,82,0,0,233,82,0,0,219,8,0,0,
+0,0,0,0,243,82,0,0,254,82,0,0,1,9,0,0,0,0,0,0,
+2,83,0,0,11,83,0,0,48,9,0,0,0,0,0,0,23,83,0,0,
+31,83,0,0,50,9,0,0,0,0,0,0,43,83,0,0,50,83,0,0,
+51,9,0,0,0,0,0,0,63,83,0,0,67,83,0,0,52,9,0,0,
+0,0,0,0,75,83,0,0,79,83,0,0,53,9,0,0,0,0,0,0,
+100,83,0,0,104,83,0,0,54,9,0,0,0,0,0,0,125,83,0,0,
+130,83,0,0,55,9,0,0,0,0,0,0,134,83,0,0,138,83,0,0,
+56,9,0,0,0,0,0,0,157,83,0,0,162,83,0,0,57,9,0,0,
+0,0,0,0,170,83,0,0,175,83,0,0,58,9,0,0,0,0,0,0,
+188,83,0,0,194,83,0,0,59,9,0,0,0,0,0,0,205,83,0,0,
+212,83,0,0,60,9,0,0,0,0,0,0,227,83,0,0,235,83,0,0,
+61,9,0,0,0,0,0,0,248,83,0,0,1,84,0,0,64,9,0,0,
+0,0,0,0,6,84,0,0,10,84,0,0,65,9,0,0,0,0,0,0,
+19,84,0,0,24,84,0,0,66,9,0,0,0,0,0,0,34,84,0,0,
+38,84,0,0,67,9,0,0,0,0,0,0,41,84,0,0,45,84,0,0,
+68,9,0,0,0,0,0,0,54,84,0,0,58,84,0,0,69,9,0,0,
+0,0,0,0,69,84,0,0,73,84,0,0,70,9,0,0,0,0,0,0,
+84,84,0,0,89,84,0,0,71,9,0,0,0,0,0,0,100,84,0,0,
+113,84,0,0,72,9,0,0,0,0,0,0,125,84,0,0,136,84,0,0,
+73,9,0,0,0,0,0,0,149,84,0,0,162,84,0,0,75,9,0,0,
+0,0,0,0,178,84,0,0,190,84,0,0,77,9,0,0,0,0,0,0,
+203,84,0,0,208,84,0,0,78,9,0,0,0,0,0,0,220,84,0,0,
+227,84,0,0,80,9,0,0,0,0,0,0,237,84,0,0,245,84,0,0,
+81,9,0,0,0,0,0,0,252,84,0,0,4,85,0,0,82,9,0,0,
+0,0,0,0,14,85,0,0,19,85,0,0,83,9,0,0,0,0,0,0,
+26,85,0,0,31,85,0,0,84,9,0,0,0,0,0,0,40,85,0,0,
+45,85,0,0,85,9,0,0,0,0,0,0,54,85,0,0,69,85,0,0,
+86,9,0,0,0,0,0,0,79,85,0,0,85,85,0,0,88,9,0,0,
+0,0,0,0,90,85,0,0,104,85,0,0,94,9,0,0,0,0,0,0,
+118,85,0,0,123,85,0,0,95,9,0,0,0,0,0,0,130,85,0,0,
+144,85,0,0,96,9,0,0,0,0,0,0,152,85,0,0,162,85,0,0,
+97,9,0,0,0,0,0,0,175,85,0,0,185,85,0,0,99,9,0,0,
+0,0,0,0,195,85,0,0,206,85,0,0,100,9,0,0,0,0,0,0,
+216,85,0,0,228,85,0,0,102,9,0,0,0,0,0,0,235,85,0,0,
+244,85,0,0,105,9,0,0,0,0,0,0,253,85,0,0,5,86,0,0,
+109,9,0,0,0,0,0,0,12,86,0,0,22,86,0,0,115,9,0,0,
+0,0,0,0,30,86,0,0,32,86,0,0,116,9,0,0,0,0,0,0,
+42,86,0,0,45,86,0,0,117,9,0,0,0,0,0,0,47,86,0,0,
+54,86,0,0,131,9,0,0,0,0,0,0,60,86,0,0,65,86,0,0,
+132,9,0,0,0,0,0,0,71,86,0,0,78,86,0,0,136,9,0,0,
+0,0,0,0,87,86,0,0,94,86,0,0,137,9,0,0,0,0,0,0,
+102,86,0,0,114,86,0,0,138,9,0,0,0,0,0,0,124,86,0,0,
+135,86,0,0,139,9,0,0,0,0,0,0,145,86,0,0,154,86,0,0,
+140,9,0,0,0,0,0,0,164,86,0,0,172,86,0,0,141,9,0,0,
+0,0,0,0,179,86,0,0,183,86,0,0,142,9,0,0,0,0,0,0,
+191,86,0,0,202,86,0,0,143,9,0,0,0,0,0,0,209,86,0,0,
+222,86,0,0,144,9,0,0,0,0,0,0,229,86,0,0,240,86,0,0,
+145,9,0,0,0,0,0,0,253,86,0,0,5,87,0,0,146,9,0,0,
+0,0,0,0,17,87,0,0,25,87,0,0,147,9,0,0,0,0,0,0,
+41,87,0,0,45,87,0,0,153,9,0,0,0,0,0,0,66,87,0,0,
+85,87,0,0,154,9,0,0,0,0,0,0,89,87,0,0,96,87,0,0,
+155,9,0,0,0,0,0,0,100,87,0,0,107,87,0,0,156,9,0,0,
+0,0,0,0,131,87,0,0,140,87,0,0,157,9,0,0,0,0,0,0,
+166,87,0,0,171,87,0,0,158,9,0,0,0,0,0,0,187,87,0,0,
+195,87,0,0,160,9,0,0,0,0,0,0,207,87,0,0,215,87,0,0,
+161,9,0,0,0,0,0,0,228,87,0,0,234,87,0,0,162,9,0,0,
+0,0,0,0,242,87,0,0,249,87,0,0,173,9,0,0,0,0,0,0,
+5,88,0,0,9,88,0,0,175,9,0,0,0,0,0,0,16,88,0,0,
+24,88,0,0,183,9,0,0,0,0,0,0,35,88,0,0,45,88,0,0,
+187,9,0,0,0,0,0,0,54,88,0,0,69,88,0,0,189,9,0,0,
+0,0,0,0,82,88,0,0,97,88,0,0,190,9,0,0,0,0,0,0,
+109,88,0,0,120,88,0,0,191,9,0,0,0,0,0,0,135,88,0,0,
+144,88,0,0,196,9,0,0,0,0,0,0,156,88,0,0,171,88,0,0,
+197,9,0,0,0,0,0,0,183,88,0,0,201,88,0,0,198,9,0,0,
+0,0,0,0,213,88,0,0,229,88,0,0,199,9,0,0,0,0,0,0,
+243,88,0,0,0,89,0,0,200,9,0,0,0,0,0,0,14,89,0,0,
+22,89,0,0,201,9,0,0,0,0,0,0,34,89,0,0,46,89,0,0,
+202,9,0,0,0,0,0,0,65,89,0,0,77,89,0,0,203,9,0,0,
+0,0,0,0,96,89,0,0,103,89,0,0,204,9,0,0,0,0,0,0,
+123,89,0,0,136,89,0,0,205,9,0,0,0,0,0,0,156,89,0,0,
+169,89,0,0,206,9,0,0,0,0,0,0,189,89,0,0,198,89,0,0,
+207,9,0,0,0,0,0,0,211,89,0,0,219,89,0,0,208,9,0,0,
+0,0,0,0,233,89,0,0,241,89,0,0,209,9,0,0,0,0,0,0,
+255,89,0,0,7,90,0,0,210,9,0,0,0,0,0,0,19,90,0,0,
+26,90,0,0,211,9,0,0,0,0,0,0,37,90,0,0,50,90,0,0,
+220,9,0,0,0,0,0,0,89,90,0,0,105,90,0,0,221,9,0,0,
+0,0,0,0,123,90,0,0,139,90,0,0,225,9,0,0,0,0,0,0,
+160,90,0,0,164,90,0,0,226,9,0,0,0,0,0,0,180,90,0,0,
+186,90,0,0,228,9,0,0,0,0,0,0,191,90,0,0,204,90,0,0,
+233,9,0,0,0,0,0,0,231,90,0,0,234,90,0,0,234,9,0,0,
+0,0,0,0,245,90,0,0,6,91,0,0,235,9,0,0,0,0,0,0,
+36,91,0,0,55,91,0,0,236,9,0,0,0,0,0,0,61,91,0,0,
+78,91,0,0,237,9,0,0,0,0,0,0,88,91,0,0,104,91,0,0,
+238,9,0,0,0,0,0,0,114,91,0,0,127,91,0,0,239,9,0,0,
+0,0,0,0,136,91,0,0,148,91,0,0,240,9,0,0,0,0,0,0,
+154,91,0,0,167,91,0,0,241,9,0,0,0,0,0,0,184,91,0,0,
+204,91,0,0,248,9,0,0,0,0,0,0,247,91,0,0,9,92,0,0,
+249,9,0,0,0,0,0,0,31,92,0,0,52,92,0,0,250,9,0,0,
+0,0,0,0,81,92,0,0,100,92,0,0,251,9,0,0,0,0,0,0,
+125,92,0,0,132,92,0,0,252,9,0,0,0,0,0,0,151,92,0,0,
+158,92,0,0,253,9,0,0,0,0,0,0,167,92,0,0,182,92,0,0,
+254,9,0,0,0,0,0,0,195,92,0,0,199,92,0,0,255,9,0,0,
+0,0,0,0,212,92,0,0,216,92,0,0,0,10,0,0,0,0,0,0,
+235,92,0,0,239,92,0,0,6,10,0,0,0,0,0,0,0,93,0,0,
+8,93,0,0,58,10,0,0,0,0,0,0,29,93,0,0,38,93,0,0,
+59,10,0,0,0,0,0,0,48,93,0,0,56,93,0,0,60,10,0,0,
+0,0,0,0,74,93,0,0,83,93,0,0,61,10,0,0,0,0,0,0,
+102,93,0,0,119,93,0,0,62,10,0,0,0,0,0,0,140,93,0,0,
+147,93,0,0,67,10,0,0,0,0,0,0,164,93,0,0,178,93,0,0,
+68,10,0,0,0,0,0,0,191,93,0,0,200,93,0,0,69,10,0,0,
+0,0,0,0,217,93,0,0,221,93,0,0,70,10,0,0,0,0,0,0,
+238,93,0,0,246,93,0,0,72,10,0,0,0,0,0,0,11,94,0,0,
+19,94,0,0,82,10,0,0,0,0,0,0,40,94,0,0,50,94,0,0,
+83,10,0,0,0,0,0,0,58,94,0,0,65,94,0,0,84,10,0,0,
+0,0,0,0,73,94,0,0,78,94,0,0,85,10,0,0,0,0,0,0,
+86,94,0,0,95,94,0,0,86,10,0,0,0,0,0,0,120,94,0,0,
+137,94,0,0,87,10,0,0,0,0,0,0,146,94,0,0,151,94,0,0,
+93,10,0,0,0,0,0,0,153,94,0,0,159,94,0,0,94,10,0,0,
+0,0,0,0,161,94,0,0,166,94,0,0,95,10,0,0,0,0,0,0,
+168,94,0,0,177,94,0,0,97,10,0,0,0,0,0,0,179,94,0,0,
+186,94,0,0,99,10,0,0,0,0,0,0,189,94,0,0,195,94,0,0,
+100,10,0,0,0,0,0,0,198,94,0,0,210,94,0,0,101,10,0,0,
+0,0,0,0,213,94,0,0,219,94,0,0,102,10,0,0,0,0,0,0,
+222,94,0,0,228,94,0,0,103,10,0,0,0,0,0,0,231,94,0,0,
+237,94,0,0,104,10,0,0,0,0,0,0,240,94,0,0,246,94,0,0,
+105,10,0,0,0,0,0,0,249,94,0,0,2,95,0,0,106,10,0,0,
+0,0,0,0,6,95,0,0,18,95,0,0,107,10,0,0,0,0,0,0,
+22,95,0,0,28,95,0,0,108,10,0,0,0,0,0,0,32,95,0,0,
+43,95,0,0,109,10,0,0,0,0,0,0,52,95,0,0,58,95,0,0,
+110,10,0,0,0,0,0,0,63,95,0,0,74,95,0,0,114,10,0,0,
+0,0,0,0,77,95,0,0,83,95,0,0,115,10,0,0,0,0,0,0,
+86,95,0,0,96,95,0,0,116,10,0,0,0,0,0,0,100,95,0,0,
+105,95,0,0,117,10,0,0,0,0,0,0,109,95,0,0,121,95,0,0,
+118,10,0,0,0,0,0,0,125,95,0,0,132,95,0,0,119,10,0,0,
+0,0,0,0,140,95,0,0,145,95,0,0,120,10,0,0,0,0,0,0,
+155,95,0,0,166,95,0,0,128,10,0,0,0,0,0,0,183,95,0,0,
+193,95,0,0,129,10,0,0,0,0,0,0,210,95,0,0,221,95,0,0,
+130,10,0,0,0,0,0,0,237,95,0,0,251,95,0,0,131,10,0,0,
+0,0,0,0,15,96,0,0,22,96,0,0,132,10,0,0,0,0,0,0,
+39,96,0,0,46,96,0,0,133,10,0,0,0,0,0,0,62,96,0,0,
+69,96,0,0,134,10,0,0,0,0,0,0,85,96,0,0,92,96,0,0,
+135,10,0,0,0,0,0,0,108,96,0,0,115,96,0,0,136,10,0,0,
+0,0,0,0,131,96,0,0,146,96,0,0,138,10,0,0,0,0,0,0,
+150,96,0,0,158,96,0,0,147,10,0,0,0,0,0,0,173,96,0,0,
+181,96,0,0,148,10,0,0,0,0,0,0,196,96,0,0,204,96,0,0,
+149,10,0,0,0,0,0,0,219,96,0,0,227,96,0,0,150,10,0,0,
+0,0,0,0,242,96,0,0,250,96,0,0,151,10,0,0,0,0,0,0,
+9,97,0,0,17,97,0,0,152,10,0,0,0,0,0,0,32,97,0,0,
+40,97,0,0,153,10,0,0,0,0,0,0,55,97,0,0,63,97,0,0,
+154,10,0,0,0,0,0,0,77,97,0,0,85,97,0,0,155,10,0,0,
+0,0,0,0,99,97,0,0,107,97,0,0,156,10,0,0,0,0,0,0,
+121,97,0,0,130,97,0,0,157,10,0,0,0,0,0,0,144,97,0,0,
+152,97,0,0,159,10,0,0,0,0,0,0,168,97,0,0,176,97,0,0,
+160,10,0,0,0,0,0,0,191,97,0,0,199,97,0,0,161,10,0,0,
+0,0,0,0,214,97,0,0,222,97,0,0,162,10,0,0,0,0,0,0,
+237,97,0,0,245,97,0,0,163,10,0,0,0,0,0,0,4,98,0,0,
+12,98,0,0,164,10,0,0,0,0,0,0,27,98,0,0,35,98,0,0,
+165,10,0,0,0,0,0,0,50,98,0,0,58,98,0,0,166,10,0,0,
+0,0,0,0,72,98,0,0,80,98,0,0,167,10,0,0,0,0,0,0,
+94,98,0,0,102,98,0,0,168,10,0,0,0,0,0,0,116,98,0,0,
+125,98,0,0,169,10,0,0,0,0,0,0,139,98,0,0,147,98,0,0,
+171,10,0,0,0,0,0,0,162,98,0,0,170,98,0,0,172,10,0,0,
+0,0,0,0,185,98,0,0,193,98,0,0,173,10,0,0,0,0,0,0,
+208,98,0,0,216,98,0,0,174,10,0,0,0,0,0,0,231,98,0,0,
+239,98,0,0,175,10,0,0,0,0,0,0,254,98,0,0,6,99,0,0,
+176,10,0,0,0,0,0,0,21,99,0,0,29,99,0,0,177,10,0,0,
+0,0,0,0,44,99,0,0,52,99,0,0,178,10,0,0,0,0,0,0,
+66,99,0,0,74,99,0,0,179,10,0,0,0,0,0,0,88,99,0,0,
+96,99,0,0,180,10,0,0,0,0,0,0,110,99,0,0,119,99,0,0,
+181,10,0,0,0,0,0,0,133,99,0,0,137,99,0,0,185,10,0,0,
+0,0,0,0,153,99,0,0,168,99,0,0,198,10,0,0,0,0,0,0,
+194,99,0,0,201,99,0,0,199,10,0,0,0,0,0,0,216,99,0,0,
+231,99,0,0,200,10,0,0,0,0,0,0,246,99,0,0,253,99,0,0,
+201,10,0,0,0,0,0,0,12,100,0,0,29,100,0,0,202,10,0,0,
+0,0,0,0,44,100,0,0,53,100,0,0,203,10,0,0,0,0,0,0,
+70,100,0,0,86,100,0,0,204,10,0,0,0,0,0,0,101,100,0,0,
+109,100,0,0,205,10,0,0,0,0,0,0,125,100,0,0,139,100,0,0,
+206,10,0,0,0,0,0,0,165,100,0,0,171,100,0,0,207,10,0,0,
+0,0,0,0,185,100,0,0,199,100,0,0,208,10,0,0,0,0,0,0,
+213,100,0,0,219,100,0,0,209,10,0,0,0,0,0,0,233,100,0,0,
+253,100,0,0,210,10,0,0,0,0,0,0,11,101,0,0,23,101,0,0,
+211,10,0,0,0,0,0,0,43,101,0,0,60,101,0,0,212,10,0,0,
+0,0,0,0,74,101,0,0,83,101,0,0,213,10,0,0,0,0,0,0,
+100,101,0,0,117,101,0,0,214,10,0,0,0,0,0,0,131,101,0,0,
+140,101,0,0,215,10,0,0,0,0,0,0,157,101,0,0,176,101,0,0,
+216,10,0,0,0,0,0,0,190,101,0,0,201,101,0,0,217,10,0,0,
+0,0,0,0,220,101,0,0,237,101,0,0,218,10,0,0,0,0,0,0,
+251,101,0,0,4,102,0,0,219,10,0,0,0,0,0,0,21,102,0,0,
+40,102,0,0,220,10,0,0,0,0,0,0,54,102,0,0,65,102,0,0,
+221,10,0,0,0,0,0,0,84,102,0,0,100,102,0,0,222,10,0,0,
+0,0,0,0,126,102,0,0,134,102,0,0,223,10,0,0,0,0,0,0,
+150,102,0,0,166,102,0,0,224,10,0,0,0,0,0,0,196,102,0,0,
+204,102,0,0,225,10,0,0,0,0,0,0,220,102,0,0,243,102,0,0,
+226,10,0,0,0,0,0,0,3,103,0,0,18,103,0,0,227,10,0,0,
+0,0,0,0,34,103,0,0,49,103,0,0,228,10,0,0,0,0,0,0,
+75,103,0,0,82,103,0,0,229,10,0,0,0,0,0,0,97,103,0,0,
+115,103,0,0,230,10,0,0,0,0,0,0,130,103,0,0,140,103,0,0,
+231,10,0,0,0,0,0,0,158,103,0,0,175,103,0,0,232,10,0,0,
+0,0,0,0,190,103,0,0,199,103,0,0,233,10,0,0,0,0,0,0,
+216,103,0,0,231,103,0,0,234,10,0,0,0,0,0,0,246,103,0,0,
+253,103,0,0,235,10,0,0,0,0,0,0,12,104,0,0,31,104,0,0,
+236,10,0,0,0,0,0,0,57,104,0,0,68,104,0,0,237,10,0,0,
+0,0,0,0,87,104,0,0,104,104,0,0,238,10,0,0,0,0,0,0,
+130,104,0,0,139,104,0,0,239,10,0,0,0,0,0,0,156,104,0,0,
+175,104,0,0,240,10,0,0,0,0,0,0,205,104,0,0,216,104,0,0,
+241,10,0,0,0,0,0,0,235,104,0,0,255,104,0,0,242,10,0,0,
+0,0,0,0,18,105,0,0,35,105,0,0,243,10,0,0,0,0,0,0,
+55,105,0,0,73,105,0,0,244,10,0,0,0,0,0,0,93,105,0,0,
+103,105,0,0,245,10,0,0,0,0,0,0,121,105,0,0,135,105,0,0,
+246,10,0,0,0,0,0,0,150,105,0,0,161,105,0,0,247,10,0,0,
+0,0,0,0,175,105,0,0,191,105,0,0,248,10,0,0,0,0,0,0,
+205,105,0,0,218,105,0,0,249,10,0,0,0,0,0,0,234,105,0,0,
+241,105,0,0,255,10,0,0,0,0,0,0,251,105,0,0,8,106,0,0,
+7,11,0,0,0,0,0,0,19,106,0,0,32,106,0,0,8,11,0,0,
+0,0,0,0,48,106,0,0,59,106,0,0,9,11,0,0,0,0,0,0,
+81,106,0,0,95,106,0,0,15,11,0,0,0,0,0,0,112,106,0,0,
+126,106,0,0,19,11,0,0,0,0,0,0,142,106,0,0,156,106,0,0,
+24,11,0,0,0,0,0,0,165,106,0,0,173,106,0,0,27,11,0,0,
+0,0,0,0,180,106,0,0,197,106,0,0,32,11,0,0,0,0,0,0,
+209,106,0,0,221,106,0,0,36,11,0,0,0,0,0,0,228,106,0,0,
+237,106,0,0,37,11,0,0,0,0,0,0,250,106,0,0,8,107,0,0,
+38,11,0,0,0,0,0,0,17,107,0,0,26,107,0,0,39,11,0,0,
+0,0,0,0,35,107,0,0,50,107,0,0,50,11,0,0,0,0,0,0,
+67,107,0,0,73,107,0,0,51,11,0,0,0,0,0,0,88,107,0,0,
+102,107,0,0,52,11,0,0,0,0,0,0,112,107,0,0,118,107,0,0,
+53,11,0,0,0,0,0,0,132,107,0,0,145,107,0,0,54,11,0,0,
+0,0,0,0,162,107,0,0,178,107,0,0,55,11,0,0,0,0,0,0,
+192,107,0,0,200,107,0,0,56,11,0,0,0,0,0,0,216,107,0,0,
+221,107,0,0,57,11,0,0,0,0,0,0,232,107,0,0,234,107,0,0,
+58,11,0,0,0,0,0,0,241,107,0,0,5,108,0,0,60,11,0,0,
+0,0,0,0,19,108,0,0,30,108,0,0,61,11,0,0,0,0,0,0,
+47,108,0,0,61,108,0,0,62,11,0,0,0,0,0,0,72,108,0,0,
+79,108,0,0,63,11,0,0,0,0,0,0,93,108,0,0,99,108,0,0,
+65,11,0,0,0,0,0,0,108,108,0,0,118,108,0,0,69,11,0,0,
+0,0,0,0,129,108,0,0,139,108,0,0,70,11,0,0,0,0,0,0,
+152,108,0,0,164,108,0,0,71,11,0,0,0,0,0,0,175,108,0,0,
+181,108,0,0,72,11,0,0,0,0,0,0,192,108,0,0,198,108,0,0,
+73,11,0,0,0,0,0,0,211,108,0,0,216,108,0,0,75,11,0,0,
+0,0,0,0,222,108,0,0,232,108,0,0,76,11,0,0,0,0,0,0,
+243,108,0,0,254,108,0,0,77,11,0,0,0,0,0,0,11,109,0,0,
+19,109,0,0,78,11,0,0,0,0,0,0,30,109,0,0,37,109,0,0,
+79,11,0,0,0,0,0,0,48,109,0,0,56,109,0,0,80,11,0,0,
+0,0,0,0,67,109,0,0,77,109,0,0,81,11,0,0,0,0,0,0,
+88,109,0,0,99,109,0,0,82,11,0,0,0,0,0,0,111,109,0,0,
+121,109,0,0,83,11,0,0,0,0,0,0,133,109,0,0,138,109,0,0,
+84,11,0,0,0,0,0,0,150,109,0,0,158,109,0,0,85,11,0,0,
+0,0,0,0,170,109,0,0,180,109,0,0,86,11,0,0,0,0,0,0,
+192,109,0,0,204,109,0,0,87,11,0,0,0,0,0,0,216,109,0,0,
+224,109,0,0,88,11,0,0,0,0,0,0,236,109,0,0,245,109,0,0,
+89,11,0,0,0,0,0,0,1,110,0,0,7,110,0,0,90,11,0,0,
+0,0,0,0,19,110,0,0,32,110,0,0,94,11,0,0,0,0,0,0,
+45,110,0,0,54,110,0,0,95,11,0,0,0,0,0,0,67,110,0,0,
+75,110,0,0,96,11,0,0,0,0,0,0,88,110,0,0,93,110,0,0,
+97,11,0,0,0,0,0,0,106,110,0,0,118,110,0,0,98,11,0,0,
+0,0,0,0,131,110,0,0,139,110,0,0,99,11,0,0,0,0,0,0,
+152,110,0,0,158,110,0,0,100,11,0,0,0,0,0,0,171,110,0,0,
+178,110,0,0,101,11,0,0,0,0,0,0,191,110,0,0,198,110,0,0,
+102,11,0,0,0,0,0,0,212,110,0,0,219,110,0,0,103,11,0,0,
+0,0,0,0,226,110,0,0,235,110,0,0,104,11,0,0,0,0,0,0,
+242,110,0,0,249,110,0,0,105,11,0,0,0,0,0,0,7,111,0,0,
+14,111,0,0,106,11,0,0,0,0,0,0,28,111,0,0,33,111,0,0,
+107,11,0,0,0,0,0,0,47,111,0,0,60,111,0,0,108,11,0,0,
+0,0,0,0,74,111,0,0,80,111,0,0,109,11,0,0,0,0,0,0,
+94,111,0,0,106,111,0,0,110,11,0,0,0,0,0,0,120,111,0,0,
+127,111,0,0,111,11,0,0,0,0,0,0,141,111,0,0,154,111,0,0,
+112,11,0,0,0,0,0,0,168,111,0,0,180,111,0,0,113,11,0,0,
+0,0,0,0,194,111,0,0,206,111,0,0,120,11,0,0,0,0,0,0,
+210,111,0,0,214,111,0,0,122,11,0,0,0,0,0,0,225,111,0,0,
+233,111,0,0,123,11,0,0,0,0,0,0,247,111,0,0,251,111,0,0,
+130,11,0,0,0,0,0,0,3,112,0,0,8,112,0,0,136,11,0,0,
+0,0,0,0,14,112,0,0,16,112,0,0,137,11,0,0,0,0,0,0,
+21,112,0,0,27,112,0,0,143,11,0,0,0,0,0,0,34,112,0,0,
+41,112,0,0,144,11,0,0,0,0,0,0,48,112,0,0,55,112,0,0,
+147,11,0,0,0,0,0,0,62,112,0,0,66,112,0,0,148,11,0,0,
+0,0,0,0,73,112,0,0,77,112,0,0,153,11,0,0,0,0,0,0,
+86,112,0,0,90,112,0,0,155,11,0,0,0,0,0,0,99,112,0,0,
+105,112,0,0,166,11,0,0,0,0,0,0,114,112,0,0,122,112,0,0,
+167,11,0,0,0,0,0,0,128,112,0,0,141,112,0,0,179,11,0,0,
+0,0,0,0,160,112,0,0,171,112,0,0,181,11,0,0,0,0,0,0,
+191,112,0,0,200,112,0,0,191,11,0,0,0,0,0,0,210,112,0,0,
+217,112,0,0,207,11,0,0,0,0,0,0,219,112,0,0,231,112,0,0,
+208,11,0,0,0,0,0,0,255,112,0,0,10,113,0,0,209,11,0,0,
+0,0,0,0,14,113,0,0,25,113,0,0,210,11,0,0,0,0,0,0,
+29,113,0,0,43,113,0,0,211,11,0,0,0,0,0,0,47,113,0,0,
+60,113,0,0,212,11,0,0,0,0,0,0,64,113,0,0,75,113,0,0,
+213,11,0,0,0,0,0,0,100,113,0,0,111,113,0,0,214,11,0,0,
+0,0,0,0,136,113,0,0,149,113,0,0,215,11,0,0,0,0,0,0,
+173,113,0,0,186,113,0,0,216,11,0,0,0,0,0,0,210,113,0,0,
+227,113,0,0,218,11,0,0,0,0,0,0,7,114,0,0,21,114,0,0,
+219,11,0,0,0,0,0,0,51,114,0,0,68,114,0,0,220,11,0,0,
+0,0,0,0,95,114,0,0,104,114,0,0,224,11,0,0,0,0,0,0,
+118,114,0,0,128,114,0,0,231,11,0,0,0,0,0,0,130,114,0,0,
+150,114,0,0,232,11,0,0,0,0,0,0,160,114,0,0,169,114,0,0,
+233,11,0,0,0,0,0,0,183,114,0,0,195,114,0,0,234,11,0,0,
+0,0,0,0,209,114,0,0,220,114,0,0,235,11,0,0,0,0,0,0,
+234,114,0,0,248,114,0,0,236,11,0,0,0,0,0,0,7,115,0,0,
+24,115,0,0,237,11,0,0,0,0,0,0,39,115,0,0,55,115,0,0,
+238,11,0,0,0,0,0,0,70,115,0,0,77,115,0,0,239,11,0,0,
+0,0,0,0,81,115,0,0,94,115,0,0,240,11,0,0,0,0,0,0,
+98,115,0,0,104,115,0,0,241,11,0,0,0,0,0,0,120,115,0,0,
+130,115,0,0,242,11,0,0,0,0,0,0,140,115,0,0,150,115,0,0,
+243,11,0,0,0,0,0,0,159,115,0,0,168,115,0,0,244,11,0,0,
+0,0,0,0,180,115,0,0,187,115,0,0,245,11,0,0,0,0,0,0,
+198,115,0,0,209,115,0,0,246,11,0,0,0,0,0,0,223,115,0,0,
+238,115,0,0,247,11,0,0,0,0,0,0,255,115,0,0,18,116,0,0,
+248,11,0,0,0,0,0,0,34,116,0,0,53,116,0,0,249,11,0,0,
+0,0,0,0,72,116,0,0,84,116,0,0,1,12,0,0,0,0,0,0,
+100,116,0,0,108,116,0,0,3,12,0,0,0,0,0,0,123,116,0,0,
+139,116,0,0,5,12,0,0,0,0,0,0,154,116,0,0,169,116,0,0,
+6,12,0,0,0,0,0,0,184,116,0,0,201,116,0,0,7,12,0,0,
+0,0,0,0,215,116,0,0,231,116,0,0,8,12,0,0,0,0,0,0,
+242,116,0,0,249,116,0,0,9,12,0,0,0,0,0,0,1,117,0,0,
+22,117,0,0,10,12,0,0,0,0,0,0,39,117,0,0,43,117,0,0,
+11,12,0,0,0,0,0,0,49,117,0,0,54,117,0,0,12,12,0,0,
+0,0,0,0,65,117,0,0,77,117,0,0,13,12,0,0,0,0,0,0,
+87,117,0,0,91,117,0,0,15,12,0,0,0,0,0,0,101,117,0,0,
+106,117,0,0,16,12,0,0,0,0,0,0,114,117,0,0,121,117,0,0,
+17,12,0,0,0,0,0,0,135,117,0,0,147,117,0,0,21,12,0,0,
+0,0,0,0,158,117,0,0,169,117,0,0,24,12,0,0,0,0,0,0,
+176,117,0,0,185,117,0,0,25,12,0,0,0,0,0,0,192,117,0,0,
+197,117,0,0,26,12,0,0,0,0,0,0,208,117,0,0,213,117,0,0,
+27,12,0,0,0,0,0,0,223,117,0,0,227,117,0,0,28,12,0,0,
+0,0,0,0,237,117,0,0,241,117,0,0,29,12,0,0,0,0,0,0,
+251,117,0,0,10,118,0,0,31,12,0,0,0,0,0,0,18,118,0,0,
+34,118,0,0,32,12,0,0,0,0,0,0,62,118,0,0,72,118,0,0,
+34,12,0,0,0,0,0,0,99,118,0,0,106,118,0,0,35,12,0,0,
+0,0,0,0,116,118,0,0,120,118,0,0,45,12,0,0,0,0,0,0,
+130,118,0,0,142,118,0,0,46,12,0,0,0,0,0,0,157,118,0,0,
+170,118,0,0,47,12,0,0,0,0,0,0,184,118,0,0,194,118,0,0,
+48,12,0,0,0,0,0,0,210,118,0,0,215,118,0,0,49,12,0,0,
+0,0,0,0,223,118,0,0,233,118,0,0,54,12,0,0,0,0,0,0,
+240,118,0,0,3,119,0,0,65,12,0,0,0,0,0,0,10,119,0,0,
+18,119,0,0,73,12,0,0,0,0,0,0,27,119,0,0,34,119,0,0,
+74,12,0,0,0,0,0,0,42,119,0,0,49,119,0,0,75,12,0,0,
+0,0,0,0,57,119,0,0,65,119,0,0,76,12,0,0,0,0,0,0,
+74,119,0,0,83,119,0,0,77,12,0,0,0,0,0,0,91,119,0,0,
+93,119,0,0,86,12,0,0,0,0,0,0,100,119,0,0,105,119,0,0,
+87,12,0,0,0,0,0,0,117,119,0,0,125,119,0,0,88,12,0,0,
+0,0,0,0,142,119,0,0,156,119,0,0,89,12,0,0,0,0,0,0,
+164,119,0,0,175,119,0,0,90,12,0,0,0,0,0,0,190,119,0,0,
+197,119,0,0,91,12,0,0,0,0,0,0,209,119,0,0,214,119,0,0,
+92,12,0,0,0,0,0,0,230,119,0,0,237,119,0,0,93,12,0,0,
+0,0,0,0,252,119,0,0,4,120,0,0,94,12,0,0,0,0,0,0,
+23,120,0,0,38,120,0,0,95,12,0,0,0,0,0,0,57,120,0,0,
+62,120,0,0,96,12,0,0,0,0,0,0,73,120,0,0,77,120,0,0,
+97,12,0,0,0,0,0,0,86,120,0,0,91,120,0,0,98,12,0,0,
+0,0,0,0,101,120,0,0,107,120,0,0,99,12,0,0,0,0,0,0,
+118,120,0,0,126,120,0,0,100,12,0,0,0,0,0,0,140,120,0,0,
+146,120,0,0,101,12,0,0,0,0,0,0,158,120,0,0,165,120,0,0,
+102,12,0,0,0,0,0,0,179,120,0,0,192,120,0,0,103,12,0,0,
+0,0,0,0,210,120,0,0,224,120,0,0,104,12,0,0,0,0,0,0,
+237,120,0,0,242,120,0,0,105,12,0,0,0,0,0,0,252,120,0,0,
+13,121,0,0,111,12,0,0,0,0,0,0,28,121,0,0,41,121,0,0,
+112,12,0,0,0,0,0,0,56,121,0,0,69,121,0,0,113,12,0,0,
+0,0,0,0,84,121,0,0,98,121,0,0,114,12,0,0,0,0,0,0,
+113,121,0,0,125,121,0,0,115,12,0,0,0,0,0,0,140,121,0,0,
+152,121,0,0,116,12,0,0,0,0,0,0,167,121,0,0,181,121,0,0,
+117,12,0,0,0,0,0,0,195,121,0,0,207,121,0,0,118,12,0,0,
+0,0,0,0,223,121,0,0,233,121,0,0,119,12,0,0,0,0,0,0,
+248,121,0,0,8,122,0,0,120,12,0,0,0,0,0,0,23,122,0,0,
+42,122,0,0,121,12,0,0,0,0,0,0,57,122,0,0,72,122,0,0,
+122,12,0,0,0,0,0,0,87,122,0,0,99,122,0,0,123,12,0,0,
+0,0,0,0,114,122,0,0,126,122,0,0,124,12,0,0,0,0,0,0,
+142,122,0,0,152,122,0,0,125,12,0,0,0,0,0,0,168,122,0,0,
+182,122,0,0,126,12,0,0,0,0,0,0,197,122,0,0,212,122,0,0,
+127,12,0,0,0,0,0,0,227,122,0,0,252,122,0,0,131,12,0,0,
+0,0,0,0,7,123,0,0,26,123,0,0,132,12,0,0,0,0,0,0,
+38,123,0,0,49,123,0,0,133,12,0,0,0,0,0,0,62,123,0,0,
+74,123,0,0,134,12,0,0,0,0,0,0,86,123,0,0,113,123,0,0,
+135,12,0,0,0,0,0,0,124,123,0,0,137,123,0,0,136,12,0,0,
+0,0,0,0,149,123,0,0,163,123,0,0,137,12,0,0,0,0,0,0,
+174,123,0,0,190,123,0,0,138,12,0,0,0,0,0,0,201,123,0,0,
+215,123,0,0,139,12,0,0,0,0,0,0,226,123,0,0,245,123,0,0,
+140,12,0,0,0,0,0,0,0,124,0,0,12,124,0,0,141,12,0,0,
+0,0,0,0,23,124,0,0,38,124,0,0,142,12,0,0,0,0,0,0,
+49,124,0,0,64,124,0,0,143,12,0,0,0,0,0,0,76,124,0,0,
+88,124,0,0,144,12,0,0,0,0,0,0,96,124,0,0,109,124,0,0,
+145,12,0,0,0,0,0,0,119,124,0,0,132,124,0,0,146,12,0,0,
+0,0,0,0,145,124,0,0,159,124,0,0,147,12,0,0,0,0,0,0,
+165,124,0,0,178,124,0,0,148,12,0,0,0,0,0,0,189,124,0,0,
+206,124,0,0,149,12,0,0,0,0,0,0,217,124,0,0,228,124,0,0,
+150,12,0,0,0,0,0,0,239,124,0,0,253,124,0,0,151,12,0,0,
+0,0,0,0,3,125,0,0,18,125,0,0,152,12,0,0,0,0,0,0,
+30,125,0,0,43,125,0,0,153,12,0,0,0,0,0,0,54,125,0,0,
+67,125,0,0,154,12,0,0,0,0,0,0,80,125,0,0,93,125,0,0,
+155,12,0,0,0,0,0,0,104,125,0,0,117,125,0,0,156,12,0,0,
+0,0,0,0,128,125,0,0,139,125,0,0,157,12,0,0,0,0,0,0,
+152,125,0,0,169,125,0,0,158,12,0,0,0,0,0,0,180,125,0,0,
+190,125,0,0,159,12,0,0,0,0,0,0,203,125,0,0,213,125,0,0,
+160,12,0,0,0,0,0,0,224,125,0,0,237,125,0,0,161,12,0,0,
+0,0,0,0,250,125,0,0,9,126,0,0,162,12,0,0,0,0,0,0,
+22,126,0,0,31,126,0,0,163,12,0,0,0,0,0,0,37,126,0,0,
+53,126,0,0,164,12,0,0,0,0,0,0,65,126,0,0,77,126,0,0,
+165,12,0,0,0,0,0,0,88,126,0,0,102,126,0,0,166,12,0,0,
+0,0,0,0,115,126,0,0,129,126,0,0,167,12,0,0,0,0,0,0,
+140,126,0,0,162,126,0,0,168,12,0,0,0,0,0,0,174,126,0,0,
+187,126,0,0,169,12,0,0,0,0,0,0,199,126,0,0,210,126,0,0,
+170,12,0,0,0,0,0,0,221,126,0,0,234,126,0,0,171,12,0,0,
+0,0,0,0,246,126,0,0,3,127,0,0,172,12,0,0,0,0,0,0,
+15,127,0,0,20,127,0,0,173,12,0,0,0,0,0,0,31,127,0,0,
+42,127,0,0,174,12,0,0,0,0,0,0,53,127,0,0,74,127,0,0,
+175,12,0,0,0,0,0,0,85,127,0,0,103,127,0,0,176,12,0,0,
+0,0,0,0,114,127,0,0,126,127,0,0,177,12,0,0,0,0,0,0,
+137,127,0,0,147,127,0,0,178,12,0,0,0,0,0,0,157,127,0,0,
+172,127,0,0,179,12,0,0,0,0,0,0,183,127,0,0,196,127,0,0,
+180,12,0,0,0,0,0,0,208,127,0,0,220,127,0,0,181,12,0,0,
+0,0,0,0,233,127,0,0,250,127,0,0,182,12,0,0,0,0,0,0,
+5,128,0,0,18,128,0,0,183,12,0,0,0,0,0,0,31,128,0,0,
+46,128,0,0,184,12,0,0,0,0,0,0,57,128,0,0,73,128,0,0,
+185,12,0,0,0,0,0,0,85,128,0,0,97,128,0,0,186,12,0,0,
+0,0,0,0,108,128,0,0,121,128,0,0,187,12,0,0,0,0,0,0,
+133,128,0,0,147,128,0,0,188,12,0,0,0,0,0,0,160,128,0,0,
+176,128,0,0,189,12,0,0,0,0,0,0,188,128,0,0,204,128,0,0,
+190,12,0,0,0,0,0,0,215,128,0,0,226,128,0,0,191,12,0,0,
+0,0,0,0,238,128,0,0,248,128,0,0,192,12,0,0,0,0,0,0,
+5,129,0,0,14,129,0,0,193,12,0,0,0,0,0,0,27,129,0,0,
+40,129,0,0,194,12,0,0,0,0,0,0,53,129,0,0,67,129,0,0,
+195,12,0,0,0,0,0,0,79,129,0,0,91,129,0,0,196,12,0,0,
+0,0,0,0,102,129,0,0,111,129,0,0,197,12,0,0,0,0,0,0,
+122,129,0,0,136,129,0,0,198,12,0,0,0,0,0,0,147,129,0,0,
+161,129,0,0,199,12,0,0,0,0,0,0,173,129,0,0,186,129,0,0,
+200,12,0,0,0,0,0,0,198,129,0,0,211,129,0,0,201,12,0,0,
+0,0,0,0,224,129,0,0,238,129,0,0,202,12,0,0,0,0,0,0,
+251,129,0,0,7,130,0,0,203,12,0,0,0,0,0,0,18,130,0,0,
+38,130,0,0,204,12,0,0,0,0,0,0,49,130,0,0,65,130,0,0,
+205,12,0,0,0,0,0,0,78,130,0,0,86,130,0,0,206,12,0,0,
+0,0,0,0,99,130,0,0,112,130,0,0,207,12,0,0,0,0,0,0,
+125,130,0,0,139,130,0,0,208,12,0,0,0,0,0,0,152,130,0,0,
+166,130,0,0,209,12,0,0,0,0,0,0,178,130,0,0,192,130,0,0,
+210,12,0,0,0,0,0,0,203,130,0,0,218,130,0,0,211,12,0,0,
+0,0,0,0,228,130,0,0,240,130,0,0,212,12,0,0,0,0,0,0,
+251,130,0,0,6,131,0,0,213,12,0,0,0,0,0,0,17,131,0,0,
+31,131,0,0,214,12,0,0,0,0,0,0,42,131,0,0,53,131,0,0,
+215,12,0,0,0,0,0,0,65,131,0,0,82,131,0,0,216,12,0,0,
+0,0,0,0,95,131,0,0,110,131,0,0,217,12,0,0,0,0,0,0,
+122,131,0,0,134,131,0,0,218,12,0,0,0,0,0,0,145,131,0,0,
+160,131,0,0,219,12,0,0,0,0,0,0,173,131,0,0,185,131,0,0,
+220,12,0,0,0,0,0,0,195,131,0,0,213,131,0,0,221,12,0,0,
+0,0,0,0,226,131,0,0,241,131,0,0,222,12,0,0,0,0,0,0,
+253,131,0,0,13,132,0,0,223,12,0,0,0,0,0,0,25,132,0,0,
+38,132,0,0,224,12,0,0,0,0,0,0,51,132,0,0,62,132,0,0,
+225,12,0,0,0,0,0,0,74,132,0,0,90,132,0,0,226,12,0,0,
+0,0,0,0,101,132,0,0,119,132,0,0,227,12,0,0,0,0,0,0,
+130,132,0,0,144,132,0,0,228,12,0,0,0,0,0,0,155,132,0,0,
+168,132,0,0,229,12,0,0,0,0,0,0,181,132,0,0,198,132,0,0,
+230,12,0,0,0,0,0,0,209,132,0,0,221,132,0,0,231,12,0,0,
+0,0,0,0,232,132,0,0,248,132,0,0,232,12,0,0,0,0,0,0,
+4,133,0,0,21,133,0,0,233,12,0,0,0,0,0,0,32,133,0,0,
+41,133,0,0,234,12,0,0,0,0,0,0,52,133,0,0,65,133,0,0,
+235,12,0,0,0,0,0,0,71,133,0,0,79,133,0,0,236,12,0,0,
+0,0,0,0,90,133,0,0,109,133,0,0,237,12,0,0,0,0,0,0,
+120,133,0,0,136,133,0,0,238,12,0,0,0,0,0,0,148,133,0,0,
+162,133,0,0,239,12,0,0,0,0,0,0,174,133,0,0,186,133,0,0,
+240,12,0,0,0,0,0,0,197,133,0,0,213,133,0,0,241,12,0,0,
+0,0,0,0,226,133,0,0,236,133,0,0,242,12,0,0,0,0,0,0,
+247,133,0,0,2,134,0,0,243,12,0,0,0,0,0,0,13,134,0,0,
+25,134,0,0,244,12,0,0,0,0,0,0,37,134,0,0,49,134,0,0,
+245,12,0,0,0,0,0,0,61,134,0,0,73,134,0,0,246,12,0,0,
+0,0,0,0,86,134,0,0,103,134,0,0,247,12,0,0,0,0,0,0,
+114,134,0,0,135,134,0,0,248,12,0,0,0,0,0,0,146,134,0,0,
+162,134,0,0,249,12,0,0,0,0,0,0,174,134,0,0,185,134,0,0,
+250,12,0,0,0,0,0,0,196,134,0,0,209,134,0,0,251,12,0,0,
+0,0,0,0,220,134,0,0,236,134,0,0,252,12,0,0,0,0,0,0,
+247,134,0,0,8,135,0,0,253,12,0,0,0,0,0,0,19,135,0,0,
+36,135,0,0,254,12,0,0,0,0,0,0,49,135,0,0,65,135,0,0,
+255,12,0,0,0,0,0,0,78,135,0,0,93,135,0,0,0,13,0,0,
+0,0,0,0,104,135,0,0,117,135,0,0,1,13,0,0,0,0,0,0,
+131,135,0,0,147,135,0,0,2,13,0,0,0,0,0,0,158,135,0,0,
+169,135,0,0,3,13,0,0,0,0,0,0,181,135,0,0,201,135,0,0,
+4,13,0,0,0,0,0,0,212,135,0,0,225,135,0,0,5,13,0,0,
+0,0,0,0,237,135,0,0,254,135,0,0,6,13,0,0,0,0,0,0,
+8,136,0,0,21,136,0,0,7,13,0,0,0,0,0,0,32,136,0,0,
+45,136,0,0,8,13,0,0,0,0,0,0,55,136,0,0,69,136,0,0,
+9,13,0,0,0,0,0,0,80,136,0,0,104,136,0,0,10,13,0,0,
+0,0,0,0,115,136,0,0,129,136,0,0,11,13,0,0,0,0,0,0,
+141,136,0,0,158,136,0,0,12,13,0,0,0,0,0,0,171,136,0,0,
+186,136,0,0,13,13,0,0,0,0,0,0,197,136,0,0,212,136,0,0,
+14,13,0,0,0,0,0,0,225,136,0,0,244,136,0,0,15,13,0,0,
+0,0,0,0,250,136,0,0,6,137,0,0,16,13,0,0,0,0,0,0,
+18,137,0,0,32,137,0,0,17,13,0,0,0,0,0,0,45,137,0,0,
+62,137,0,0,18,13,0,0,0,0,0,0,72,137,0,0,84,137,0,0,
+19,13,0,0,0,0,0,0,96,137,0,0,108,137,0,0,20,13,0,0,
+0,0,0,0,120,137,0,0,130,137,0,0,21,13,0,0,0,0,0,0,
+141,137,0,0,153,137,0,0,22,13,0,0,0,0,0,0,164,137,0,0,
+174,137,0,0,23,13,0,0,0,0,0,0,185,137,0,0,205,137,0,0,
+24,13,0,0,0,0,0,0,216,137,0,0,231,137,0,0,25,13,0,0,
+0,0,0,0,241,137,0,0,255,137,0,0,26,13,0,0,0,0,0,0,
+10,138,0,0,20,138,0,0,27,13,0,0,0,0,0,0,33,138,0,0,
+49,138,0,0,28,13,0,0,0,0,0,0,60,138,0,0,73,138,0,0,
+29,13,0,0,0,0,0,0,86,138,0,0,101,138,0,0,30,13,0,0,
+0,0,0,0,114,138,0,0,118,138,0,0,34,13,0,0,0,0,0,0,
+143,138,0,0,147,138,0,0,35,13,0,0,0,0,0,0,166,138,0,0,
+170,138,0,0,36,13,0,0,0,0,0,0,181,138,0,0,185,138,0,0,
+37,13,0,0,0,0,0,0,197,138,0,0,201,138,0,0,38,13,0,0,
+0,0,0,0,228,138,0,0,232,138,0,0,39,13,0,0,0,0,0,0,
+245,138,0,0,249,138,0,0,40,13,0,0,0,0,0,0,7,139,0,0,
+11,139,0,0,41,13,0,0,0,0,0,0,27,139,0,0,31,139,0,0,
+42,13,0,0,0,0,0,0,45,139,0,0,49,139,0,0,43,13,0,0,
+0,0,0,0,68,139,0,0,72,139,0,0,44,13,0,0,0,0,0,0,
+84,139,0,0,88,139,0,0,45,13,0,0,0,0,0,0,103,139,0,0,
+107,139,0,0,46,13,0,0,0,0,0,0,122,139,0,0,126,139,0,0,
+47,13,0,0,0,0,0,0,138,139,0,0,142,139,0,0,48,13,0,0,
+0,0,0,0,155,139,0,0,159,139,0,0,49,13,0,0,0,0,0,0,
+172,139,0,0,176,139,0,0,50,13,0,0,0,0,0,0,190,139,0,0,
+194,139,0,0,51,13,0,0,0,0,0,0,207,139,0,0,211,139,0,0,
+52,13,0,0,0,0,0,0,228,139,0,0,232,139,0,0,53,13,0,0,
+0,0,0,0,243,139,0,0,247,139,0,0,54,13,0,0,0,0,0,0,
+5,140,0,0,9,140,0,0,55,13,0,0,0,0,0,0,24,140,0,0,
+28,140,0,0,56,13,0,0,0,0,0,0,41,140,0,0,45,140,0,0,
+57,13,0,0,0,0,0,0,58,140,0,0,62,140,0,0,58,13,0,0,
+0,0,0,0,75,140,0,0,79,140,0,0,59,13,0,0,0,0,0,0,
+92,140,0,0,96,140,0,0,60,13,0,0,0,0,0,0,107,140,0,0,
+111,140,0,0,61,13,0,0,0,0,0,0,128,140,0,0,132,140,0,0,
+62,13,0,0,0,0,0,0,142,140,0,0,146,140,0,0,63,13,0,0,
+0,0,0,0,156,140,0,0,160,140,0,0,64,13,0,0,0,0,0,0,
+173,140,0,0,177,140,0,0,65,13,0,0,0,0,0,0,192,140,0,0,
+196,140,0,0,66,13,0,0,0,0,0,0,205,140,0,0,209,140,0,0,
+67,13,0,0,0,0,0,0,225,140,0,0,229,140,0,0,68,13,0,0,
+0,0,0,0,241,140,0,0,245,140,0,0,69,13,0,0,0,0,0,0,
+3,141,0,0,7,141,0,0,70,13,0,0,0,0,0,0,21,141,0,0,
+25,141,0,0,71,13,0,0,0,0,0,0,47,141,0,0,51,141,0,0,
+72,13,0,0,0,0,0,0,64,141,0,0,68,141,0,0,73,13,0,0,
+0,0,0,0,81,141,0,0,85,141,0,0,74,13,0,0,0,0,0,0,
+96,141,0,0,100,141,0,0,75,13,0,0,0,0,0,0,113,141,0,0,
+117,141,0,0,76,13,0,0,0,0,0,0,130,141,0,0,134,141,0,0,
+77,13,0,0,0,0,0,0,139,141,0,0,143,141,0,0,78,13,0,0,
+0,0,0,0,154,141,0,0,158,141,0,0,79,13,0,0,0,0,0,0,
+179,141,0,0,183,141,0,0,80,13,0,0,0,0,0,0,201,141,0,0,
+205,141,0,0,81,13,0,0,0,0,0,0,217,141,0,0,221,141,0,0,
+82,13,0,0,0,0,0,0,231,141,0,0,235,141,0,0,83,13,0,0,
+0,0,0,0,250,141,0,0,254,141,0,0,84,13,0,0,0,0,0,0,
+11,142,0,0,15,142,0,0,85,13,0,0,0,0,0,0,27,142,0,0,
+31,142,0,0,86,13,0,0,0,0,0,0,48,142,0,0,52,142,0,0,
+87,13,0,0,0,0,0,0,65,142,0,0,69,142,0,0,88,13,0,0,
+0,0,0,0,84,142,0,0,88,142,0,0,89,13,0,0,0,0,0,0,
+104,142,0,0,108,142,0,0,90,13,0,0,0,0,0,0,120,142,0,0,
+124,142,0,0,91,13,0,0,0,0,0,0,137,142,0,0,141,142,0,0,
+92,13,0,0,0,0,0,0,155,142,0,0,159,142,0,0,93,13,0,0,
+0,0,0,0,175,142,0,0,179,142,0,0,94,13,0,0,0,0,0,0,
+195,142,0,0,199,142,0,0,95,13,0,0,0,0,0,0,210,142,0,0,
+214,142,0,0,96,13,0,0,0,0,0,0,224,142,0,0,228,142,0,0,
+97,13,0,0,0,0,0,0,237,142,0,0,241,142,0,0,98,13,0,0,
+0,0,0,0,254,142,0,0,2,143,0,0,99,13,0,0,0,0,0,0,
+16,143,0,0,20,143,0,0,100,13,0,0,0,0,0,0,32,143,0,0,
+36,143,0,0,101,13,0,0,0,0,0,0,45,143,0,0,49,143,0,0,
+102,13,0,0,0,0,0,0,63,143,0,0,67,143,0,0,103,13,0,0,
+0,0,0,0,81,143,0,0,85,143,0,0,104,13,0,0,0,0,0,0,
+98,143,0,0,102,143,0,0,105,13,0,0,0,0,0,0,115,143,0,0,
+119,143,0,0,106,13,0,0,0,0,0,0,133,143,0,0,137,143,0,0,
+107,13,0,0,0,0,0,0,149,143,0,0,153,143,0,0,108,13,0,0,
+0,0,0,0,173,143,0,0,177,143,0,0,109,13,0,0,0,0,0,0,
+193,143,0,0,197,143,0,0,110,13,0,0,0,0,0,0,205,143,0,0,
+209,143,0,0,111,13,0,0,0,0,0,0,222,143,0,0,226,143,0,0,
+112,13,0,0,0,0,0,0,240,143,0,0,244,143,0,0,113,13,0,0,
+0,0,0,0,2,144,0,0,6,144,0,0,114,13,0,0,0,0,0,0,
+20,144,0,0,24,144,0,0,115,13,0,0,0,0,0,0,39,144,0,0,
+43,144,0,0,116,13,0,0,0,0,0,0,55,144,0,0,59,144,0,0,
+117,13,0,0,0,0,0,0,70,144,0,0,74,144,0,0,118,13,0,0,
+0,0,0,0,88,144,0,0,92,144,0,0,119,13,0,0,0,0,0,0,
+103,144,0,0,107,144,0,0,120,13,0,0,0,0,0,0,124,144,0,0,
+128,144,0,0,121,13,0,0,0,0,0,0,143,144,0,0,147,144,0,0,
+122,13,0,0,0,0,0,0,159,144,0,0,163,144,0,0,123,13,0,0,
+0,0,0,0,178,144,0,0,182,144,0,0,124,13,0,0,0,0,0,0,
+194,144,0,0,198,144,0,0,125,13,0,0,0,0,0,0,216,144,0,0,
+220,144,0,0,126,13,0,0,0,0,0,0,235,144,0,0,239,144,0,0,
+127,13,0,0,0,0,0,0,255,144,0,0,3,145,0,0,128,13,0,0,
+0,0,0,0,16,145,0,0,20,145,0,0,129,13,0,0,0,0,0,0,
+31,145,0,0,35,145,0,0,130,13,0,0,0,0,0,0,51,145,0,0,
+55,145,0,0,131,13,0,0,0,0,0,0,73,145,0,0,77,145,0,0,
+132,13,0,0,0,0,0,0,91,145,0,0,95,145,0,0,133,13,0,0,
+0,0,0,0,108,145,0,0,112,145,0,0,134,13,0,0,0,0,0,0,
+129,145,0,0,133,145,0,0,135,13,0,0,0,0,0,0,145,145,0,0,
+149,145,0,0,136,13,0,0,0,0,0,0,165,145,0,0,169,145,0,0,
+137,13,0,0,0,0,0,0,186,145,0,0,190,145,0,0,138,13,0,0,
+0,0,0,0,199,145,0,0,203,145,0,0,139,13,0,0,0,0,0,0,
+216,145,0,0,220,145,0,0,140,13,0,0,0,0,0,0,228,145,0,0,
+232,145,0,0,141,13,0,0,0,0,0,0,251,145,0,0,255,145,0,0,
+142,13,0,0,0,0,0,0,15,146,0,0,19,146,0,0,143,13,0,0,
+0,0,0,0,33,146,0,0,37,146,0,0,144,13,0,0,0,0,0,0,
+49,146,0,0,53,146,0,0,145,13,0,0,0,0,0,0,69,146,0,0,
+73,146,0,0,146,13,0,0,0,0,0,0,83,146,0,0,87,146,0,0,
+147,13,0,0,0,0,0,0,98,146,0,0,102,146,0,0,148,13,0,0,
+0,0,0,0,114,146,0,0,118,146,0,0,149,13,0,0,0,0,0,0,
+130,146,0,0,134,146,0,0,150,13,0,0,0,0,0,0,146,146,0,0,
+150,146,0,0,151,13,0,0,0,0,0,0,167,146,0,0,171,146,0,0,
+152,13,0,0,0,0,0,0,192,146,0,0,196,146,0,0,153,13,0,0,
+0,0,0,0,212,146,0,0,216,146,0,0,154,13,0,0,0,0,0,0,
+227,146,0,0,231,146,0,0,155,13,0,0,0,0,0,0,244,146,0,0,
+248,146,0,0,156,13,0,0,0,0,0,0,8,147,0,0,12,147,0,0,
+157,13,0,0,0,0,0,0,29,147,0,0,33,147,0,0,158,13,0,0,
+0,0,0,0,50,147,0,0,54,147,0,0,159,13,0,0,0,0,0,0,
+70,147,0,0,74,147,0,0,160,13,0,0,0,0,0,0,89,147,0,0,
+93,147,0,0,161,13,0,0,0,0,0,0,106,147,0,0,110,147,0,0,
+162,13,0,0,0,0,0,0,126,147,0,0,130,147,0,0,163,13,0,0,
+0,0,0,0,141,147,0,0,145,147,0,0,164,13,0,0,0,0,0,0,
+165,147,0,0,169,147,0,0,165,13,0,0,0,0,0,0,182,147,0,0,
+186,147,0,0,166,13,0,0,0,0,0,0,203,147,0,0,207,147,0,0,
+167,13,0,0,0,0,0,0,220,147,0,0,224,147,0,0,168,13,0,0,
+0,0,0,0,237,147,0,0,241,147,0,0,169,13,0,0,0,0,0,0,
+255,147,0,0,3,148,0,0,170,13,0,0,0,0,0,0,27,148,0,0,
+31,148,0,0,171,13,0,0,0,0,0,0,45,148,0,0,49,148,0,0,
+172,13,0,0,0,0,0,0,66,148,0,0,70,148,0,0,173,13,0,0,
+0,0,0,0,85,148,0,0,89,148,0,0,174,13,0,0,0,0,0,0,
+104,148,0,0,108,148,0,0,175,13,0,0,0,0,0,0,127,148,0,0,
+131,148,0,0,176,13,0,0,0,0,0,0,143,148,0,0,147,148,0,0,
+177,13,0,0,0,0,0,0,161,148,0,0,165,148,0,0,178,13,0,0,
+0,0,0,0,182,148,0,0,186,148,0,0,179,13,0,0,0,0,0,0,
+198,148,0,0,202,148,0,0,180,13,0,0,0,0,0,0,214,148,0,0,
+218,148,0,0,181,13,0,0,0,0,0,0,228,148,0,0,232,148,0,0,
+182,13,0,0,0,0,0,0,244,148,0,0,248,148,0,0,183,13,0,0,
+0,0,0,0,2,149,0,0,6,149,0,0,184,13,0,0,0,0,0,0,
+26,149,0,0,30,149,0,0,185,13,0,0,0,0,0,0,45,149,0,0,
+49,149,0,0,186,13,0,0,0,0,0,0,63,149,0,0,67,149,0,0,
+187,13,0,0,0,0,0,0,77,149,0,0,81,149,0,0,188,13,0,0,
+0,0,0,0,97,149,0,0,101,149,0,0,189,13,0,0,0,0,0,0,
+114,149,0,0,118,149,0,0,190,13,0,0,0,0,0,0,133,149,0,0,
+145,149,0,0,194,13,0,0,0,0,0,0,169,149,0,0,179,149,0,0,
+195,13,0,0,0,0,0,0,201,149,0,0,216,149,0,0,196,13,0,0,
+0,0,0,0,243,149,0,0,1,150,0,0,197,13,0,0,0,0,0,0,
+27,150,0,0,31,150,0,0,200,13,0,0,0,0,0,0,35,150,0,0,
+39,150,0,0,202,13,0,0,0,0,0,0,50,150,0,0,64,150,0,0,
+210,13,0,0,0,0,0,0,87,150,0,0,101,150,0,0,211,13,0,0,
+0,0,0,0,123,150,0,0,134,150,0,0,212,13,0,0,0,0,0,0,
+148,150,0,0,158,150,0,0,213,13,0,0,0,0,0,0,179,150,0,0,
+193,150,0,0,218,13,0,0,0,0,0,0,203,150,0,0,218,150,0,0,
+219,13,0,0,0,0,0,0,226,150,0,0,239,150,0,0,220,13,0,0,
+0,0,0,0,8,151,0,0,24,151,0,0,221,13,0,0,0,0,0,0,
+49,151,0,0,68,151,0,0,222,13,0,0,0,0,0,0,93,151,0,0,
+106,151,0,0,223,13,0,0,0,0,0,0,116,151,0,0,121,151,0,0,
+227,13,0,0,0,0,0,0,134,151,0,0,140,151,0,0,228,13,0,0,
+0,0,0,0,147,151,0,0,154,151,0,0,229,13,0,0,0,0,0,0,
+162,151,0,0,169,151,0,0,230,13,0,0,0,0,0,0,178,151,0,0,
+186,151,0,0,231,13,0,0,0,0,0,0,196,151,0,0,200,151,0,0,
+232,13,0,0,0,0,0,0,209,151,0,0,218,151,0,0,234,13,0,0,
+0,0,0,0,236,151,0,0,245,151,0,0,235,13,0,0,0,0,0,0,
+3,152,0,0,12,152,0,0,236,13,0,0,0,0,0,0,25,152,0,0,
+32,152,0,0,237,13,0,0,0,0,0,0,44,152,0,0,50,152,0,0,
+238,13,0,0,0,0,0,0,61,152,0,0,68,152,0,0,239,13,0,0,
+0,0,0,0,79,152,0,0,85,152,0,0,240,13,0,0,0,0,0,0,
+96,152,0,0,103,152,0,0,241,13,0,0,0,0,0,0,114,152,0,0,
+122,152,0,0,242,13,0,0,0,0,0,0,140,152,0,0,146,152,0,0,
+243,13,0,0,0,0,0,0,154,152,0,0,163,152,0,0,244,13,0,0,
+0,0,0,0,171,152,0,0,180,152,0,0,245,13,0,0,0,0,0,0,
+189,152,0,0,198,152,0,0,246,13,0,0,0,0,0,0,210,152,0,0,
+218,152,0,0,247,13,0,0,0,0,0,0,227,152,0,0,236,152,0,0,
+248,13,0,0,0,0,0,0,245,152,0,0,1,153,0,0,249,13,0,0,
+0,0,0,0,12,153,0,0,24,153,0,0,250,13,0,0,0,0,0,0,
+36,153,0,0,47,153,0,0,251,13,0,0,0,0,0,0,58,153,0,0,
+69,153,0,0,252,13,0,0,0,0,0,0,80,153,0,0,94,153,0,0,
+253,13,0,0,0,0,0,0,105,153,0,0,119,153,0,0,254,13,0,0,
+0,0,0,0,130,153,0,0,143,153,0,0,255,13,0,0,0,0,0,0,
+156,153,0,0,168,153,0,0,0,14,0,0,0,0,0,0,181,153,0,0,
+192,153,0,0,1,14,0,0,0,0,0,0,204,153,0,0,211,153,0,0,
+2,14,0,0,0,0,0,0,227,153,0,0,233,153,0,0,6,14,0,0,
+0,0,0,0,248,153,0,0,254,153,0,0,7,14,0,0,0,0,0,0,
+13,154,0,0,18,154,0,0,13,14,0,0,0,0,0,0,29,154,0,0,
+38,154,0,0,14,14,0,0,0,0,0,0,47,154,0,0,56,154,0,0,
+15,14,0,0,0,0,0,0,65,154,0,0,74,154,0,0,16,14,0,0,
+0,0,0,0,83,154,0,0,93,154,0,0,17,14,0,0,0,0,0,0,
+102,154,0,0,112,154,0,0,19,14,0,0,0,0,0,0,122,154,0,0,
+132,154,0,0,20,14,0,0,0,0,0,0,142,154,0,0,146,154,0,0,
+21,14,0,0,0,0,0,0,156,154,0,0,162,154,0,0,22,14,0,0,
+0,0,0,0,171,154,0,0,176,154,0,0,23,14,0,0,0,0,0,0,
+196,154,0,0,202,154,0,0,28,14,0,0,0,0,0,0,206,154,0,0,
+217,154,0,0,29,14,0,0,0,0,0,0,222,154,0,0,231,154,0,0,
+30,14,0,0,0,0,0,0,254,154,0,0,3,155,0,0,44,14,0,0,
+0,0,0,0,22,155,0,0,32,155,0,0,45,14,0,0,0,0,0,0,
+52,155,0,0,62,155,0,0,47,14,0,0,0,0,0,0,81,155,0,0,
+92,155,0,0,54,14,0,0,0,0,0,0,106,155,0,0,112,155,0,0,
+58,14,0,0,0,0,0,0,118,155,0,0,124,155,0,0,59,14,0,0,
+0,0,0,0,131,155,0,0,135,155,0,0,63,14,0,0,0,0,0,0,
+142,155,0,0,146,155,0,0,64,14,0,0,0,0,0,0,154,155,0,0,
+158,155,0,0,65,14,0,0,0,0,0,0,170,155,0,0,174,155,0,0,
+66,14,0,0,0,0,0,0,181,155,0,0,185,155,0,0,67,14,0,0,
+0,0,0,0,195,155,0,0,199,155,0,0,68,14,0,0,0,0,0,0,
+208,155,0,0,212,155,0,0,69,14,0,0,0,0,0,0,222,155,0,0,
+226,155,0,0,70,14,0,0,0,0,0,0,233,155,0,0,237,155,0,0,
+74,14,0,0,0,0,0,0,253,155,0,0,10,156,0,0,86,14,0,0,
+0,0,0,0,23,156,0,0,36,156,0,0,87,14,0,0,0,0,0,0,
+49,156,0,0,62,156,0,0,88,14,0,0,0,0,0,0,75,156,0,0,
+88,156,0,0,89,14,0,0,0,0,0,0,101,156,0,0,114,156,0,0,
+90,14,0,0,0,0,0,0,127,156,0,0,140,156,0,0,91,14,0,0,
+0,0,0,0,153,156,0,0,166,156,0,0,92,14,0,0,0,0,0,0,
+179,156,0,0,192,156,0,0,93,14,0,0,0,0,0,0,205,156,0,0,
+218,156,0,0,94,14,0,0,0,0,0,0,231,156,0,0,244,156,0,0,
+95,14,0,0,0,0,0,0,1,157,0,0,14,157,0,0,96,14,0,0,
+0,0,0,0,27,157,0,0,40,157,0,0,97,14,0,0,0,0,0,0,
+53,157,0,0,66,157,0,0,98,14,0,0,0,0,0,0,84,157,0,0,
+97,157,0,0,99,14,0,0,0,0,0,0,111,157,0,0,120,157,0,0,
+103,14,0,0,0,0,0,0,134,157,0,0,143,157,0,0,114,14,0,0,
+0,0,0,0,163,157,0,0,168,157,0,0,116,14,0,0,0,0,0,0,
+179,157,0,0,184,157,0,0,117,14,0,0,0,0,0,0,195,157,0,0,
+200,157,0,0,118,14,0,0,0,0,0,0,214,157,0,0,219,157,0,0,
+119,14,0,0,0,0,0,0,232,157,0,0,237,157,0,0,120,14,0,0,
+0,0,0,0,251,157,0,0,0,158,0,0,121,14,0,0,0,0,0,0,
+15,158,0,0,21,158,0,0,122,14,0,0,0,0,0,0,41,158,0,0,
+45,158,0,0,139,14,0,0,0,0,0,0,50,158,0,0,55,158,0,0,
+140,14,0,0,0,0,0,0,60,158,0,0,66,158,0,0,141,14,0,0,
+0,0,0,0,71,158,0,0,78,158,0,0,142,14,0,0,0,0,0,0,
+83,158,0,0,91,158,0,0,143,14,0,0,0,0,0,0,96,158,0,0,
+105,158,0,0,144,14,0,0,0,0,0,0,110,158,0,0,122,158,0,0,
+2,16,0,0,0,0,0,0,133,158,0,0,143,158,0,0,3,16,0,0,
+0,0,0,0,155,158,0,0,161,158,0,0,4,16,0,0,0,0,0,0,
+173,158,0,0,184,158,0,0,5,16,0,0,0,0,0,0,194,158,0,0,
+199,158,0,0,6,16,0,0,0,0,0,0,210,158,0,0,219,158,0,0,
+7,16,0,0,0,0,0,0,230,158,0,0,240,158,0,0,8,16,0,0,
+0,0,0,0,250,158,0,0,255,158,0,0,9,16,0,0,0,0,0,0,
+9,159,0,0,17,159,0,0,10,16,0,0,0,0,0,0,27,159,0,0,
+35,159,0,0,11,16,0,0,0,0,0,0,45,159,0,0,52,159,0,0,
+12,16,0,0,0,0,0,0,60,159,0,0,65,159,0,0,13,16,0,0,
+0,0,0,0,73,159,0,0,82,159,0,0,14,16,0,0,0,0,0,0,
+91,159,0,0,96,159,0,0,15,16,0,0,0,0,0,0,105,159,0,0,
+114,159,0,0,16,16,0,0,0,0,0,0,123,159,0,0,134,159,0,0,
+17,16,0,0,0,0,0,0,143,159,0,0,150,159,0,0,18,16,0,0,
+0,0,0,0,161,159,0,0,170,159,0,0,19,16,0,0,0,0,0,0,
+181,159,0,0,191,159,0,0,20,16,0,0,0,0,0,0,200,159,0,0,
+207,159,0,0,21,16,0,0,0,0,0,0,217,159,0,0,223,159,0,0,
+22,16,0,0,0,0,0,0,233,159,0,0,1,160,0,0,29,16,0,0,
+0,0,0,0,10,160,0,0,23,160,0,0,30,16,0,0,0,0,0,0,
+33,160,0,0,48,160,0,0,32,16,0,0,0,0,0,0,58,160,0,0,
+68,160,0,0,33,16,0,0,0,0,0,0,78,160,0,0,90,160,0,0,
+34,16,0,0,0,0,0,0,102,160,0,0,114,160,0,0,35,16,0,0,
+0,0,0,0,124,160,0,0,138,160,0,0,37,16,0,0,0,0,0,0,
+148,160,0,0,164,160,0,0,38,16,0,0,0,0,0,0,174,160,0,0,
+190,160,0,0,39,16,0,0,0,0,0,0,201,160,0,0,219,160,0,0,
+42,16,0,0,0,0,0,0,228,160,0,0,246,160,0,0,43,16,0,0,
+0,0,0,0,0,161,0,0,8,161,0,0,44,16,0,0,0,0,0,0,
+18,161,0,0,28,161,0,0,72,16,0,0,0,0,0,0,37,161,0,0,
+47,161,0,0,73,16,0,0,0,0,0,0,56,161,0,0,66,161,0,0,
+74,16,0,0,0,0,0,0,75,161,0,0,85,161,0,0,75,16,0,0,
+0,0,0,0,94,161,0,0,104,161,0,0,76,16,0,0,0,0,0,0,
+113,161,0,0,123,161,0,0,77,16,0,0,0,0,0,0,132,161,0,0,
+142,161,0,0,78,16,0,0,0,0,0,0,151,161,0,0,161,161,0,0,
+79,16,0,0,0,0,0,0,170,161,0,0,180,161,0,0,80,16,0,0,
+0,0,0,0,189,161,0,0,199,161,0,0,81,16,0,0,0,0,0,0,
+208,161,0,0,218,161,0,0,82,16,0,0,0,0,0,0,227,161,0,0,
+237,161,0,0,83,16,0,0,0,0,0,0,246,161,0,0,0,162,0,0,
+84,16,0,0,0,0,0,0,9,162,0,0,19,162,0,0,85,16,0,0,
+0,0,0,0,28,162,0,0,38,162,0,0,86,16,0,0,0,0,0,0,
+47,162,0,0,57,162,0,0,87,16,0,0,0,0,0,0,66,162,0,0,
+76,162,0,0,88,16,0,0,0,0,0,0,85,162,0,0,95,162,0,0,
+89,16,0,0,0,0,0,0,104,162,0,0,114,162,0,0,90,16,0,0,
+0,0,0,0,123,162,0,0,133,162,0,0,91,16,0,0,0,0,0,0,
+142,162,0,0,152,162,0,0,92,16,0,0,0,0,0,0,161,162,0,0,
+171,162,0,0,93,16,0,0,0,0,0,0,180,162,0,0,190,162,0,0,
+94,16,0,0,0,0,0,0,199,162,0,0,209,162,0,0,95,16,0,0,
+0,0,0,0,218,162,0,0,228,162,0,0,96,16,0,0,0,0,0,0,
+237,162,0,0,247,162,0,0,97,16,0,0,0,0,0,0,0,163,0,0,
+4,163,0,0,113,16,0,0,0,0,0,0,12,163,0,0,16,163,0,0,
+114,16,0,0,0,0,0,0,25,163,0,0,29,163,0,0,115,16,0,0,
+0,0,0,0,35,163,0,0,38,163,0,0,116,16,0,0,0,0,0,0,
+50,163,0,0,54,163,0,0,117,16,0,0,0,0,0,0,61,163,0,0,
+65,163,0,0,118,16,0,0,0,0,0,0,70,163,0,0,74,163,0,0,
+119,16,0,0,0,0,0,0,82,163,0,0,86,163,0,0,120,16,0,0,
+0,0,0,0,94,163,0,0,97,163,0,0,121,16,0,0,0,0,0,0,
+102,163,0,0,106,163,0,0,122,16,0,0,0,0,0,0,111,163,0,0,
+115,163,0,0,123,16,0,0,0,0,0,0,128,163,0,0,132,163,0,0,
+124,16,0,0,0,0,0,0,145,163,0,0,149,163,0,0,125,16,0,0,
+0,0,0,0,165,163,0,0,169,163,0,0,126,16,0,0,0,0,0,0,
+179,163,0,0,183,163,0,0,127,16,0,0,0,0,0,0,192,163,0,0,
+196,163,0,0,128,16,0,0,0,0,0,0,206,163,0,0,209,163,0,0,
+129,16,0,0,0,0,0,0,218,163,0,0,222,163,0,0,130,16,0,0,
+0,0,0,0,231,163,0,0,234,163,0,0,131,16,0,0,0,0,0,0,
+241,163,0,0,245,163,0,0,132,16,0,0,0,0,0,0,253,163,0,0,
+1,164,0,0,133,16,0,0,0,0,0,0,11,164,0,0,14,164,0,0,
+139,16,0,0,0,0,0,0,17,164,0,0,20,164,0,0,140,16,0,0,
+0,0,0,0,23,164,0,0,26,164,0,0,141,16,0,0,0,0,0,0,
+29,164,0,0,32,164,0,0,142,16,0,0,0,0,0,0,35,164,0,0,
+38,164,0,0,143,16,0,0,0,0,0,0,41,164,0,0,44,164,0,0,
+144,16,0,0,0,0,0,0,48,164,0,0,51,164,0,0,145,16,0,0,
+0,0,0,0,54,164,0,0,57,164,0,0,146,16,0,0,0,0,0,0,
+63,164,0,0,66,164,0,0,147,16,0,0,0,0,0,0,68,164,0,0,
+71,164,0,0,148,16,0,0,0,0,0,0,74,164,0,0,77,164,0,0,
+149,16,0,0,0,0,0,0,86,164,0,0,90,164,0,0,150,16,0,0,
+0,0,0,0,107,164,0,0,116,164,0,0,151,16,0,0,0,0,0,0,
+132,164,0,0,138,164,0,0,155,16,0,0,0,0,0,0,151,164,0,0,
+155,164,0,0,156,16,0,0,0,0,0,0,159,164,0,0,163,164,0,0,
+157,16,0,0,0,0,0,0,167,164,0,0,172,164,0,0,158,16,0,0,
+0,0,0,0,174,164,0,0,184,164,0,0,164,16,0,0,0,0,0,0,
+187,164,0,0,190,164,0,0,165,16,0,0,0,0,0,0,200,164,0,0,
+206,164,0,0,166,16,0,0,0,0,0,0,216,164,0,0,219,164,0,0,
+167,16,0,0,0,0,0,0,225,164,0,0,236,164,0,0,169,16,0,0,
+0,0,0,0,243,164,0,0,2,165,0,0,171,16,0,0,0,0,0,0,
+7,165,0,0,12,165,0,0,172,16,0,0,0,0,0,0,17,165,0,0,
+20,165,0,0,173,16,0,0,0,0,0,0,25,165,0,0,29,165,0,0,
+174,16,0,0,0,0,0,0,37,165,0,0,41,165,0,0,175,16,0,0,
+0,0,0,0,50,165,0,0,58,165,0,0,181,16,0,0,0,0,0,0,
+63,165,0,0,66,165,0,0,182,16,0,0,0,0,0,0,74,165,0,0,
+78,165,0,0,183,16,0,0,0,0,0,0,86,165,0,0,95,165,0,0,
+208,16,0,0,0,0,0,0,110,165,0,0,118,165,0,0,211,16,0,0,
+0,0,0,0,127,165,0,0,139,165,0,0,212,16,0,0,0,0,0,0,
+152,165,0,0,157,165,0,0,217,16,0,0,0,0,0,0,169,165,0,0,
+175,165,0,0,218,16,0,0,0,0,0,0,189,165,0,0,198,165,0,0,
+232,16,0,0,0,0,0,0,207,165,0,0,216,165,0,0,233,16,0,0,
+0,0,0,0,226,165,0,0,236,165,0,0,234,16,0,0,0,0,0,0,
+245,165,0,0,254,165,0,0,235,16,0,0,0,0,0,0,6,166,0,0,
+12,166,0,0,236,16,0,0,0,0,0,0,19,166,0,0,27,166,0,0,
+237,16,0,0,0,0,0,0,36,166,0,0,45,166,0,0,238,16,0,0,
+0,0,0,0,54,166,0,0,61,166,0,0,239,16,0,0,0,0,0,0,
+69,166,0,0,79,166,0,0,240,16,0,0,0,0,0,0,88,166,0,0,
+98,166,0,0,241,16,0,0,0,0,0,0,107,166,0,0,115,166,0,0,
+242,16,0,0,0,0,0,0,125,166,0,0,131,166,0,0,243,16,0,0,
+0,0,0,0,138,166,0,0,146,166,0,0,244,16,0,0,0,0,0,0,
+153,166,0,0,161,166,0,0,245,16,0,0,0,0,0,0,169,166,0,0,
+177,166,0,0,246,16,0,0,0,0,0,0,184,166,0,0,196,166,0,0,
+247,16,0,0,0,0,0,0,205,166,0,0,212,166,0,0,248,16,0,0,
+0,0,0,0,219,166,0,0,226,166,0,0,249,16,0,0,0,0,0,0,
+234,166,0,0,241,166,0,0,250,16,0,0,0,0,0,0,251,166,0,0,
+4,167,0,0,251,16,0,0,0,0,0,0,12,167,0,0,21,167,0,0,
+252,16,0,0,0,0,0,0,29,167,0,0,36,167,0,0,253,16,0,0,
+0,0,0,0,45,167,0,0,52,167,0,0,254,16,0,0,0,0,0,0,
+59,167,0,0,66,167,0,0,255,16,0,0,0,0,0,0,75,167,0,0,
+86,167,0,0,0,17,0,0,0,0,0,0,93,167,0,0,105,167,0,0,
+1,17,0,0,0,0,0,0,113,167,0,0,120,167,0,0,2,17,0,0,
+0,0,0,0,127,167,0,0,136,167,0,0,3,17,0,0,0,0,0,0,
+144,167,0,0,152,167,0,0,4,17,0,0,0,0,0,0,161,167,0,0,
+170,167,0,0,5,17,0,0,0,0,0,0,181,167,0,0,190,167,0,0,
+6,17,0,0,0,0,0,0,199,167,0,0,210,167,0,0,7,17,0,0,
+0,0,0,0,217,167,0,0,225,167,0,0,8,17,0,0,0,0,0,0,
+232,167,0,0,242,167,0,0,9,17,0,0,0,0,0,0,248,167,0,0,
+253,167,0,0,10,17,0,0,0,0,0,0,7,168,0,0,15,168,0,0,
+11,17,0,0,0,0,0,0,22,168,0,0,29,168,0,0,12,17,0,0,
+0,0,0,0,38,168,0,0,46,168,0,0,13,17,0,0,0,0,0,0,
+56,168,0,0,65,168,0,0,14,17,0,0,0,0,0,0,73,168,0,0,
+80,168,0,0,15,17,0,0,0,0,0,0,88,168,0,0,95,168,0,0,
+16,17,0,0,0,0,0,0,105,168,0,0,113,168,0,0,17,17,0,0,
+0,0,0,0,121,168,0,0,126,168,0,0,18,17,0,0,0,0,0,0,
+133,168,0,0,141,168,0,0,19,17,0,0,0,0,0,0,147,168,0,0,
+157,168,0,0,20,17,0,0,0,0,0,0,166,168,0,0,177,168,0,0,
+21,17,0,0,0,0,0,0,184,168,0,0,189,168,0,0,22,17,0,0,
+0,0,0,0,195,168,0,0,203,168,0,0,23,17,0,0,0,0,0,0,
+209,168,0,0,218,168,0,0,24,17,0,0,0,0,0,0,226,168,0,0,
+236,168,0,0,25,17,0,0,0,0,0,0,244,168,0,0,254,168,0,0,
+26,17,0,0,0,0,0,0,7,169,0,0,19,169,0,0,27,17,0,0,
+0,0,0,0,26,169,0,0,34,169,0,0,28,17,0,0,0,0,0,0,
+41,169,0,0,52,169,0,0,29,17,0,0,0,0,0,0,58,169,0,0,
+68,169,0,0,30,17,0,0,0,0,0,0,75,169,0,0,80,169,0,0,
+31,17,0,0,0,0,0,0,88,169,0,0,98,169,0,0,32,17,0,0,
+0,0,0,0,107,169,0,0,114,169,0,0,33,17,0,0,0,0,0,0,
+122,169,0,0,130,169,0,0,34,17,0,0,0,0,0,0,139,169,0,0,
+148,169,0,0,35,17,0,0,0,0,0,0,157,169,0,0,166,169,0,0,
+36,17,0,0,0,0,0,0,175,169,0,0,182,169,0,0,37,17,0,0,
+0,0,0,0,189,169,0,0,196,169,0,0,38,17,0,0,0,0,0,0,
+204,169,0,0,214,169,0,0,39,17,0,0,0,0,0,0,221,169,0,0,
+232,169,0,0,40,17,0,0,0,0,0,0,242,169,0,0,251,169,0,0,
+41,17,0,0,0,0,0,0,2,170,0,0,12,170,0,0,42,17,0,0,
+0,0,0,0,21,170,0,0,30,170,0,0,43,17,0,0,0,0,0,0,
+39,170,0,0,49,170,0,0,44,17,0,0,0,0,0,0,57,170,0,0,
+70,170,0,0,45,17,0,0,0,0,0,0,80,170,0,0,91,170,0,0,
+46,17,0,0,0,0,0,0,100,170,0,0,113,170,0,0,47,17,0,0,
+0,0,0,0,123,170,0,0,130,170,0,0,48,17,0,0,0,0,0,0,
+139,170,0,0,145,170,0,0,49,17,0,0,0,0,0,0,154,170,0,0,
+162,170,0,0,50,17,0,0,0,0,0,0,170,170,0,0,178,170,0,0,
+51,17,0,0,0,0,0,0,188,170,0,0,197,170,0,0,52,17,0,0,
+0,0,0,0,205,170,0,0,215,170,0,0,53,17,0,0,0,0,0,0,
+222,170,0,0,231,170,0,0,54,17,0,0,0,0,0,0,238,170,0,0,
+247,170,0,0,55,17,0,0,0,0,0,0,1,171,0,0,10,171,0,0,
+56,17,0,0,0,0,0,0,16,171,0,0,24,171,0,0,57,17,0,0,
+0,0,0,0,32,171,0,0,39,171,0,0,58,17,0,0,0,0,0,0,
+48,171,0,0,55,171,0,0,59,17,0,0,0,0,0,0,65,171,0,0,
+75,171,0,0,60,17,0,0,0,0,0,0,81,171,0,0,88,171,0,0,
+61,17,0,0,0,0,0,0,95,171,0,0,104,171,0,0,62,17,0,0,
+0,0,0,0,113,171,0,0,124,171,0,0,63,17,0,0,0,0,0,0,
+132,171,0,0,142,171,0,0,64,17,0,0,0,0,0,0,149,171,0,0,
+157,171,0,0,65,17,0,0,0,0,0,0,167,171,0,0,176,171,0,0,
+66,17,0,0,0,0,0,0,185,171,0,0,193,171,0,0,67,17,0,0,
+0,0,0,0,202,171,0,0,211,171,0,0,68,17,0,0,0,0,0,0,
+221,171,0,0,225,171,0,0,69,17,0,0,0,0,0,0,233,171,0,0,
+242,171,0,0,70,17,0,0,0,0,0,0,249,171,0,0,2,172,0,0,
+71,17,0,0,0,0,0,0,9,172,0,0,17,172,0,0,72,17,0,0,
+0,0,0,0,26,172,0,0,35,172,0,0,73,17,0,0,0,0,0,0,
+43,172,0,0,49,172,0,0,74,17,0,0,0,0,0,0,56,172,0,0,
+66,172,0,0,75,17,0,0,0,0,0,0,73,172,0,0,81,172,0,0,
+76,17,0,0,0,0,0,0,90,172,0,0,95,172,0,0,77,17,0,0,
+0,0,0,0,101,172,0,0,111,172,0,0,78,17,0,0,0,0,0,0,
+118,172,0,0,125,172,0,0,84,17,0,0,0,0,0,0,127,172,0,0,
+134,172,0,0,85,17,0,0,0,0,0,0,141,172,0,0,147,172,0,0,
+86,17,0,0,0,0,0,0,154,172,0,0,161,172,0,0,87,17,0,0,
+0,0,0,0,168,172,0,0,178,172,0,0,88,17,0,0,0,0,0,0,
+189,172,0,0,205,172,0,0,112,17,0,0,0,0,0,0,210,172,0,0,
+215,172,0,0,113,17,0,0,0,0,0,0,231,172,0,0,245,172,0,0,
+114,17,0,0,0,0,0,0,251,172,0,0,10,173,0,0,116,17,0,0,
+0,0,0,0,17,173,0,0,32,173,0,0,117,17,0,0,0,0,0,0,
+40,173,0,0,46,173,0,0,128,17,0,0,0,0,0,0,54,173,0,0,
+58,173,0,0,129,17,0,0,0,0,0,0,72,173,0,0,76,173,0,0,
+130,17,0,0,0,0,0,0,89,173,0,0,101,173,0,0,131,17,0,0,
+0,0,0,0,113,173,0,0,117,173,0,0,132,17,0,0,0,0,0,0,
+128,173,0,0,141,173,0,0,133,17,0,0,0,0,0,0,150,173,0,0,
+154,173,0,0,134,17,0,0,0,0,0,0,167,173,0,0,179,173,0,0,
+136,17,0,0,0,0,0,0,183,173,0,0,192,173,0,0,137,17,0,0,
+0,0,0,0,198,173,0,0,210,173,0,0,138,17,0,0,0,0,0,0,
+214,173,0,0,225,173,0,0,143,17,0,0,0,0,0,0,236,173,0,0,
+250,173,0,0,144,17,0,0,0,0,0,0,10,174,0,0,23,174,0,0,
+145,17,0,0,0,0,0,0,40,174,0,0,54,174,0,0,146,17,0,0,
+0,0,0,0,68,174,0,0,81,174,0,0,147,17,0,0,0,0,0,0,
+97,174,0,0,101,174,0,0,149,17,0,0,0,0,0,0,109,174,0,0,
+123,174,0,0,153,17,0,0,0,0,0,0,130,174,0,0,135,174,0,0,
+154,17,0,0,0,0,0,0,149,174,0,0,152,174,0,0,155,17,0,0,
+0,0,0,0,160,174,0,0,169,174,0,0,162,17,0,0,0,0,0,0,
+180,174,0,0,186,174,0,0,163,17,0,0,0,0,0,0,197,174,0,0,
+200,174,0,0,164,17,0,0,0,0,0,0,209,174,0,0,218,174,0,0,
+165,17,0,0,0,0,0,0,224,174,0,0,234,174,0,0,166,17,0,0,
+0,0,0,0,246,174,0,0,252,174,0,0,180,17,0,0,0,0,0,0,
+14,175,0,0,21,175,0,0,181,17,0,0,0,0,0,0,40,175,0,0,
+51,175,0,0,182,17,0,0,0,0,0,0,65,175,0,0,74,175,0,0,
+183,17,0,0,0,0,0,0,80,175,0,0,87,175,0,0,184,17,0,0,
+0,0,0,0,96,175,0,0,109,175,0,0,191,17,0,0,0,0,0,0,
+125,175,0,0,136,175,0,0,192,17,0,0,0,0,0,0,146,175,0,0,
+150,175,0,0,193,17,0,0,0,0,0,0,161,175,0,0,166,175,0,0,
+194,17,0,0,0,0,0,0,186,175,0,0,189,175,0,0,201,17,0,0,
+0,0,0,0,197,175,0,0,202,175,0,0,202,17,0,0,0,0,0,0,
+208,175,0,0,219,175,0,0,210,17,0,0,0,0,0,0,227,175,0,0,
+237,175,0,0,211,17,0,0,0,0,0,0,248,175,0,0,252,175,0,0,
+212,17,0,0,0,0,0,0,7,176,0,0,13,176,0,0,213,17,0,0,
+0,0,0,0,20,176,0,0,24,176,0,0,214,17,0,0,0,0,0,0,
+34,176,0,0,38,176,0,0,215,17,0,0,0,0,0,0,49,176,0,0,
+54,176,0,0,216,17,0,0,0,0,0,0,58,176,0,0,74,176,0,0,
+225,17,0,0,0,0,0,0,84,176,0,0,92,176,0,0,232,17,0,0,
+0,0,0,0,98,176,0,0,112,176,0,0,233,17,0,0,0,0,0,0,
+122,176,0,0,128,176,0,0,234,17,0,0,0,0,0,0,134,176,0,0,
+145,176,0,0,241,17,0,0,0,0,0,0,159,176,0,0,164,176,0,0,
+242,17,0,0,0,0,0,0,175,176,0,0,186,176,0,0,243,17,0,0,
+0,0,0,0,197,176,0,0,208,176,0,0,244,17,0,0,0,0,0,0,
+224,176,0,0,236,176,0,0,245,17,0,0,0,0,0,0,247,176,0,0,
+253,176,0,0,246,17,0,0,0,0,0,0,9,177,0,0,20,177,0,0,
+248,17,0,0,0,0,0,0,36,177,0,0,42,177,0,0,249,17,0,0,
+0,0,0,0,53,177,0,0,65,177,0,0,250,17,0,0,0,0,0,0,
+81,177,0,0,87,177,0,0,251,17,0,0,0,0,0,0,100,177,0,0,
+107,177,0,0,252,17,0,0,0,0,0,0,120,177,0,0,132,177,0,0,
+4,18,0,0,0,0,0,0,146,177,0,0,158,177,0,0,6,18,0,0,
+0,0,0,0,175,177,0,0,185,177,0,0,15,18,0,0,0,0,0,0,
+203,177,0,0,213,177,0,0,16,18,0,0,0,0,0,0,230,177,0,0,
+240,177,0,0,17,18,0,0,0,0,0,0,253,177,0,0,7,178,0,0,
+18,18,0,0,0,0,0,0,17,178,0,0,26,178,0,0,19,18,0,0,
+0,0,0,0,39,178,0,0,49,178,0,0,20,18,0,0,0,0,0,0,
+60,178,0,0,71,178,0,0,21,18,0,0,0,0,0,0,83,178,0,0,
+96,178,0,0,22,18,0,0,0,0,0,0,110,178,0,0,120,178,0,0,
+23,18,0,0,0,0,0,0,135,178,0,0,145,178,0,0,27,18,0,0,
+0,0,0,0,160,178,0,0,170,178,0,0,28,18,0,0,0,0,0,0,
+182,178,0,0,187,178,0,0,29,18,0,0,0,0,0,0,196,178,0,0,
+206,178,0,0,33,18,0,0,0,0,0,0,213,178,0,0,223,178,0,0,
+34,18,0,0,0,0,0,0,235,178,0,0,245,178,0,0,35,18,0,0,
+0,0,0,0,1,179,0,0,11,179,0,0,36,18,0,0,0,0,0,0,
+24,179,0,0,34,179,0,0,37,18,0,0,0,0,0,0,44,179,0,0,
+55,179,0,0,38,18,0,0,0,0,0,0,68,179,0,0,78,179,0,0,
+39,18,0,0,0,0,0,0,90,179,0,0,100,179,0,0,40,18,0,0,
+0,0,0,0,112,179,0,0,124,179,0,0,41,18,0,0,0,0,0,0,
+136,179,0,0,146,179,0,0,42,18,0,0,0,0,0,0,158,179,0,0,
+169,179,0,0,43,18,0,0,0,0,0,0,179,179,0,0,190,179,0,0,
+44,18,0,0,0,0,0,0,203,179,0,0,213,179,0,0,45,18,0,0,
+0,0,0,0,230,179,0,0,243,179,0,0,46,18,0,0,0,0,0,0,
+1,180,0,0,11,180,0,0,47,18,0,0,0,0,0,0,26,180,0,0,
+36,180,0,0,51,18,0,0,0,0,0,0,51,180,0,0,61,180,0,0,
+52,18,0,0,0,0,0,0,73,180,0,0,82,180,0,0,56,18,0,0,
+0,0,0,0,96,180,0,0,106,180,0,0,57,18,0,0,0,0,0,0,
+121,180,0,0,132,180,0,0,58,18,0,0,0,0,0,0,145,180,0,0,
+157,180,0,0,79,18,0,0,0,0,0,0,171,180,0,0,182,180,0,0,
+80,18,0,0,0,0,0,0,198,180,0,0,209,180,0,0,81,18,0,0,
+0,0,0,0,223,180,0,0,236,180,0,0,82,18,0,0,0,0,0,0,
+249,180,0,0,6,181,0,0,83,18,0,0,0,0,0,0,19,181,0,0,
+28,181,0,0,84,18,0,0,0,0,0,0,43,181,0,0,52,181,0,0,
+85,18,0,0,0,0,0,0,61,181,0,0,69,181,0,0,86,18,0,0,
+0,0,0,0,80,181,0,0,89,181,0,0,90,18,0,0,0,0,0,0,
+103,181,0,0,113,181,0,0,91,18,0,0,0,0,0,0,128,181,0,0,
+139,181,0,0,92,18,0,0,0,0,0,0,152,181,0,0,163,181,0,0,
+93,18,0,0,0,0,0,0,177,181,0,0,190,181,0,0,94,18,0,0,
+0,0,0,0,205,181,0,0,213,181,0,0,98,18,0,0,0,0,0,0,
+226,181,0,0,235,181,0,0,99,18,0,0,0,0,0,0,249,181,0,0,
+3,182,0,0,100,18,0,0,0,0,0,0,14,182,0,0,24,182,0,0,
+101,18,0,0,0,0,0,0,37,182,0,0,49,182,0,0,102,18,0,0,
+0,0,0,0,63,182,0,0,73,182,0,0,106,18,0,0,0,0,0,0,
+86,182,0,0,95,182,0,0,107,18,0,0,0,0,0,0,107,182,0,0,
+115,182,0,0,108,18,0,0,0,0,0,0,129,182,0,0,139,182,0,0,
+109,18,0,0,0,0,0,0,154,182,0,0,165,182,0,0,110,18,0,0,
+0,0,0,0,181,182,0,0,193,182,0,0,111,18,0,0,0,0,0,0,
+210,182,0,0,222,182,0,0,112,18,0,0,0,0,0,0,236,182,0,0,
+240,182,0,0,113,18,0,0,0,0,0,0,250,182,0,0,10,183,0,0,
+117,18,0,0,0,0,0,0,27,183,0,0,45,183,0,0,118,18,0,0,
+0,0,0,0,61,183,0,0,76,183,0,0,119,18,0,0,0,0,0,0,
+94,183,0,0,111,183,0,0,120,18,0,0,0,0,0,0,128,183,0,0,
+143,183,0,0,121,18,0,0,0,0,0,0,162,183,0,0,180,183,0,0,
+122,18,0,0,0,0,0,0,198,183,0,0,212,183,0,0,124,18,0,0,
+0,0,0,0,229,183,0,0,245,183,0,0,125,18,0,0,0,0,0,0,
+3,184,0,0,16,184,0,0,126,18,0,0,0,0,0,0,32,184,0,0,
+47,184,0,0,127,18,0,0,0,0,0,0,62,184,0,0,75,184,0,0,
+128,18,0,0,0,0,0,0,92,184,0,0,108,184,0,0,129,18,0,0,
+0,0,0,0,124,184,0,0,133,184,0,0,133,18,0,0,0,0,0,0,
+148,184,0,0,158,184,0,0,134,18,0,0,0,0,0,0,173,184,0,0,
+183,184,0,0,135,18,0,0,0,0,0,0,194,184,0,0,204,184,0,0,
+136,18,0,0,0,0,0,0,217,184,0,0,229,184,0,0,140,18,0,0,
+0,0,0,0,243,184,0,0,253,184,0,0,141,18,0,0,0,0,0,0,
+12,185,0,0,23,185,0,0,142,18,0,0,0,0,0,0,39,185,0,0,
+51,185,0,0,143,18,0,0,0,0,0,0,67,185,0,0,79,185,0,0,
+144,18,0,0,0,0,0,0,94,185,0,0,107,185,0,0,145,18,0,0,
+0,0,0,0,122,185,0,0,134,185,0,0,146,18,0,0,0,0,0,0,
+151,185,0,0,163,185,0,0,147,18,0,0,0,0,0,0,178,185,0,0,
+192,185,0,0,148,18,0,0,0,0,0,0,206,185,0,0,220,185,0,0,
+149,18,0,0,0,0,0,0,234,185,0,0,244,185,0,0,150,18,0,0,
+0,0,0,0,4,186,0,0,13,186,0,0,151,18,0,0,0,0,0,0,
+25,186,0,0,35,186,0,0,155,18,0,0,0,0,0,0,49,186,0,0,
+61,186,0,0,156,18,0,0,0,0,0,0,73,186,0,0,85,186,0,0,
+157,18,0,0,0,0,0,0,99,186,0,0,114,186,0,0,158,18,0,0,
+0,0,0,0,128,186,0,0,141,186,0,0,159,18,0,0,0,0,0,0,
+155,186,0,0,166,186,0,0,163,18,0,0,0,0,0,0,177,186,0,0,
+188,186,0,0,164,18,0,0,0,0,0,0,204,186,0,0,221,186,0,0,
+165,18,0,0,0,0,0,0,237,186,0,0,248,186,0,0,166,18,0,0,
+0,0,0,0,14,187,0,0,24,187,0,0,170,18,0,0,0,0,0,0,
+35,187,0,0,45,187,0,0,171,18,0,0,0,0,0,0,60,187,0,0,
+76,187,0,0,172,18,0,0,0,0,0,0,91,187,0,0,101,187,0,0,
+176,18,0,0,0,0,0,0,109,187,0,0,116,187,0,0,177,18,0,0,
+0,0,0,0,122,187,0,0,130,187,0,0,178,18,0,0,0,0,0,0,
+143,187,0,0,151,187,0,0,179,18,0,0,0,0,0,0,162,187,0,0,
+174,187,0,0,183,18,0,0,0,0,0,0,180,187,0,0,191,187,0,0,
+184,18,0,0,0,0,0,0,206,187,0,0,218,187,0,0,185,18,0,0,
+0,0,0,0,224,187,0,0,235,187,0,0,186,18,0,0,0,0,0,0,
+250,187,0,0,4,188,0,0,190,18,0,0,0,0,0,0,9,188,0,0,
+19,188,0,0,191,18,0,0,0,0,0,0,31,188,0,0,39,188,0,0,
+192,18,0,0,0,0,0,0,51,188,0,0,59,188,0,0,193,18,0,0,
+0,0,0,0,72,188,0,0,81,188,0,0,194,18,0,0,0,0,0,0,
+91,188,0,0,103,188,0,0,195,18,0,0,0,0,0,0,114,188,0,0,
+123,188,0,0,196,18,0,0,0,0,0,0,137,188,0,0,147,188,0,0,
+208,18,0,0,0,0,0,0,154,188,0,0,164,188,0,0,209,18,0,0,
+0,0,0,0,174,188,0,0,178,188,0,0,210,18,0,0,0,0,0,0,
+188,188,0,0,194,188,0,0,211,18,0,0,0,0,0,0,204,188,0,0,
+214,188,0,0,212,18,0,0,0,0,0,0,229,188,0,0,240,188,0,0,
+213,18,0,0,0,0,0,0,255,188,0,0,9,189,0,0,214,18,0,0,
+0,0,0,0,23,189,0,0,34,189,0,0,215,18,0,0,0,0,0,0,
+47,189,0,0,57,189,0,0,216,18,0,0,0,0,0,0,69,189,0,0,
+76,189,0,0,217,18,0,0,0,0,0,0,86,189,0,0,97,189,0,0,
+218,18,0,0,0,0,0,0,110,189,0,0,116,189,0,0,219,18,0,0,
+0,0,0,0,131,189,0,0,138,189,0,0,220,18,0,0,0,0,0,0,
+144,189,0,0,152,189,0,0,221,18,0,0,0,0,0,0,158,189,0,0,
+168,189,0,0,222,18,0,0,0,0,0,0,177,189,0,0,189,189,0,0,
+223,18,0,0,0,0,0,0,203,189,0,0,212,189,0,0,224,18,0,0,
+0,0,0,0,224,189,0,0,239,189,0,0,228,18,0,0,0,0,0,0,
+248,189,0,0,5,190,0,0,229,18,0,0,0,0,0,0,13,190,0,0,
+27,190,0,0,230,18,0,0,0,0,0,0,36,190,0,0,48,190,0,0,
+234,18,0,0,0,0,0,0,62,190,0,0,68,190,0,0,235,18,0,0,
+0,0,0,0,86,190,0,0,98,190,0,0,236,18,0,0,0,0,0,0,
+116,190,0,0,122,190,0,0,237,18,0,0,0,0,0,0,134,190,0,0,
+142,190,0,0,238,18,0,0,0,0,0,0,156,190,0,0,163,190,0,0,
+239,18,0,0,0,0,0,0,171,190,0,0,179,190,0,0,240,18,0,0,
+0,0,0,0,187,190,0,0,194,190,0,0,241,18,0,0,0,0,0,0,
+202,190,0,0,211,190,0,0,242,18,0,0,0,0,0,0,220,190,0,0,
+228,190,0,0,243,18,0,0,0,0,0,0,237,190,0,0,246,190,0,0,
+244,18,0,0,0,0,0,0,2,191,0,0,12,191,0,0,245,18,0,0,
+0,0,0,0,21,191,0,0,31,191,0,0,249,18,0,0,0,0,0,0,
+41,191,0,0,50,191,0,0,250,18,0,0,0,0,0,0,60,191,0,0,
+71,191,0,0,8,19,0,0,0,0,0,0,86,191,0,0,93,191,0,0,
+9,19,0,0,0,0,0,0,108,191,0,0,118,191,0,0,10,19,0,0,
+0,0,0,0,132,191,0,0,142,191,0,0,11,19,0,0,0,0,0,0,
+156,191,0,0,167,191,0,0,12,19,0,0,0,0,0,0,177,191,0,0,
+185,191,0,0,13,19,0,0,0,0,0,0,199,191,0,0,206,191,0,0,
+14,19,0,0,0,0,0,0,214,191,0,0,222,191,0,0,15,19,0,0,
+0,0,0,0,235,191,0,0,244,191,0,0,19,19,0,0,0,0,0,0,
+0,192,0,0,8,192,0,0,20,19,0,0,0,0,0,0,17,192,0,0,
+24,192,0,0,21,19,0,0,0,0,0,0,37,192,0,0,43,192,0,0,
+22,19,0,0,0,0,0,0,50,192,0,0,58,192,0,0,26,19,0,0,
+0,0,0,0,69,192,0,0,76,192,0,0,27,19,0,0,0,0,0,0,
+84,192,0,0,92,192,0,0,28,19,0,0,0,0,0,0,101,192,0,0,
+110,192,0,0,29,19,0,0,0,0,0,0,118,192,0,0,126,192,0,0,
+30,19,0,0,0,0,0,0,138,192,0,0,149,192,0,0,31,19,0,0,
+0,0,0,0,157,192,0,0,163,192,0,0,35,19,0,0,0,0,0,0,
+174,192,0,0,181,192,0,0,36,19,0,0,0,0,0,0,187,192,0,0,
+198,192,0,0,37,19,0,0,0,0,0,0,204,192,0,0,210,192,0,0,
+38,19,0,0,0,0,0,0,221,192,0,0,228,192,0,0,39,19,0,0,
+0,0,0,0,234,192,0,0,245,192,0,0,40,19,0,0,0,0,0,0,
+251,192,0,0,1,193,0,0,41,19,0,0,0,0,0,0,10,193,0,0,
+18,193,0,0,42,19,0,0,0,0,0,0,27,193,0,0,35,193,0,0,
+43,19,0,0,0,0,0,0,43,193,0,0,47,193,0,0,44,19,0,0,
+0,0,0,0,55,193,0,0,63,193,0,0,45,19,0,0,0,0,0,0,
+71,193,0,0,77,193,0,0,46,19,0,0,0,0,0,0,85,193,0,0,
+94,193,0,0,47,19,0,0,0,0,0,0,102,193,0,0,109,193,0,0,
+48,19,0,0,0,0,0,0,117,193,0,0,126,193,0,0,49,19,0,0,
+0,0,0,0,134,193,0,0,142,193,0,0,50,19,0,0,0,0,0,0,
+150,193,0,0,160,193,0,0,51,19,0,0,0,0,0,0,170,193,0,0,
+179,193,0,0,52,19,0,0,0,0,0,0,189,193,0,0,199,193,0,0,
+53,19,0,0,0,0,0,0,209,193,0,0,217,193,0,0,54,19,0,0,
+0,0,0,0,227,193,0,0,239,193,0,0,55,19,0,0,0,0,0,0,
+250,193,0,0,5,194,0,0,56,19,0,0,0,0,0,0,16,194,0,0,
+25,194,0,0,57,19,0,0,0,0,0,0,36,194,0,0,46,194,0,0,
+58,19,0,0,0,0,0,0,59,194,0,0,72,194,0,0,60,19,0,0,
+0,0,0,0,83,194,0,0,102,194,0,0,65,19,0,0,0,0,0,0,
+111,194,0,0,124,194,0,0,66,19,0,0,0,0,0,0,147,194,0,0,
+161,194,0,0,67,19,0,0,0,0,0,0,178,194,0,0,197,194,0,0,
+68,19,0,0,0,0,0,0,212,194,0,0,224,194,0,0,70,19,0,0,
+0,0,0,0,233,194,0,0,244,194,0,0,71,19,0,0,0,0,0,0,
+5,195,0,0,15,195,0,0,78,19,0,0,0,0,0,0,24,195,0,0,
+34,195,0,0,79,19,0,0,0,0,0,0,44,195,0,0,55,195,0,0,
+80,19,0,0,0,0,0,0,69,195,0,0,74,195,0,0,81,19,0,0,
+0,0,0,0,84,195,0,0,90,195,0,0,82,19,0,0,0,0,0,0,
+100,195,0,0,107,195,0,0,83,19,0,0,0,0,0,0,119,195,0,0,
+131,195,0,0,84,19,0,0,0,0,0,0,138,195,0,0,146,195,0,0,
+85,19,0,0,0,0,0,0,157,195,0,0,164,195,0,0,86,19,0,0,
+0,0,0,0,177,195,0,0,186,195,0,0,87,19,0,0,0,0,0,0,
+196,195,0,0,208,195,0,0,88,19,0,0,0,0,0,0,223,195,0,0,
+236,195,0,0,89,19,0,0,0,0,0,0,252,195,0,0,12,196,0,0,
+90,19,0,0,0,0,0,0,28,196,0,0,38,196,0,0,92,19,0,0,
+0,0,0,0,45,196,0,0,55,196,0,0,93,19,0,0,0,0,0,0,
+62,196,0,0,75,196,0,0,95,19,0,0,0,0,0,0,89,196,0,0,
+101,196,0,0,96,19,0,0,0,0,0,0,118,196,0,0,132,196,0,0,
+97,19,0,0,0,0,0,0,149,196,0,0,161,196,0,0,98,19,0,0,
+0,0,0,0,173,196,0,0,188,196,0,0,99,19,0,0,0,0,0,0,
+202,196,0,0,214,196,0,0,100,19,0,0,0,0,0,0,230,196,0,0,
+246,196,0,0,101,19,0,0,0,0,0,0,2,197,0,0,18,197,0,0,
+102,19,0,0,0,0,0,0,27,197,0,0,39,197,0,0,103,19,0,0,
+0,0,0,0,55,197,0,0,67,197,0,0,104,19,0,0,0,0,0,0,
+83,197,0,0,95,197,0,0,105,19,0,0,0,0,0,0,107,197,0,0,
+121,197,0,0,106,19,0,0,0,0,0,0,135,197,0,0,149,197,0,0,
+107,19,0,0,0,0,0,0,163,197,0,0,175,197,0,0,108,19,0,0,
+0,0,0,0,190,197,0,0,202,197,0,0,109,19,0,0,0,0,0,0,
+214,197,0,0,230,197,0,0,110,19,0,0,0,0,0,0,246,197,0,0,
+5,198,0,0,111,19,0,0,0,0,0,0,21,198,0,0,33,198,0,0,
+115,19,0,0,0,0,0,0,40,198,0,0,47,198,0,0,116,19,0,0,
+0,0,0,0,61,198,0,0,67,198,0,0,117,19,0,0,0,0,0,0,
+82,198,0,0,91,198,0,0,118,19,0,0,0,0,0,0,100,198,0,0,
+108,198,0,0,119,19,0,0,0,0,0,0,122,198,0,0,130,198,0,0,
+120,19,0,0,0,0,0,0,140,198,0,0,149,198,0,0,121,19,0,0,
+0,0,0,0,159,198,0,0,172,198,0,0,126,19,0,0,0,0,0,0,
+182,198,0,0,197,198,0,0,127,19,0,0,0,0,0,0,214,198,0,0,
+225,198,0,0,128,19,0,0,0,0,0,0,244,198,0,0,255,198,0,0,
+129,19,0,0,0,0,0,0,16,199,0,0,29,199,0,0,130,19,0,0,
+0,0,0,0,43,199,0,0,55,199,0,0,133,19,0,0,0,0,0,0,
+65,199,0,0,79,199,0,0,134,19,0,0,0,0,0,0,95,199,0,0,
+105,199,0,0,135,19,0,0,0,0,0,0,123,199,0,0,133,199,0,0,
+136,19,0,0,0,0,0,0,149,199,0,0,161,199,0,0,137,19,0,0,
+0,0,0,0,174,199,0,0,188,199,0,0,145,19,0,0,0,0,0,0,
+196,199,0,0,209,199,0,0,146,19,0,0,0,0,0,0,227,199,0,0,
+241,199,0,0,148,19,0,0,0,0,0,0,248,199,0,0,252,199,0,0,
+149,19,0,0,0,0,0,0,10,200,0,0,23,200,0,0,150,19,0,0,
+0,0,0,0,41,200,0,0,55,200,0,0,152,19,0,0,0,0,0,0,
+63,200,0,0,76,200,0,0,153,19,0,0,0,0,0,0,94,200,0,0,
+107,200,0,0,154,19,0,0,0,0,0,0,124,200,0,0,137,200,0,0,
+155,19,0,0,0,0,0,0,155,200,0,0,160,200,0,0,156,19,0,0,
+0,0,0,0,173,200,0,0,191,200,0,0,157,19,0,0,0,0,0,0,
+206,200,0,0,219,200,0,0,163,19,0,0,0,0,0,0,228,200,0,0,
+239,200,0,0,168,19,0,0,0,0,0,0,248,200,0,0,3,201,0,0,
+169,19,0,0,0,0,0,0,18,201,0,0,29,201,0,0,170,19,0,0,
+0,0,0,0,40,201,0,0,51,201,0,0,171,19,0,0,0,0,0,0,
+67,201,0,0,78,201,0,0,172,19,0,0,0,0,0,0,94,201,0,0,
+107,201,0,0,174,19,0,0,0,0,0,0,116,201,0,0,128,201,0,0,
+175,19,0,0,0,0,0,0,137,201,0,0,149,201,0,0,178,19,0,0,
+0,0,0,0,167,201,0,0,181,201,0,0,179,19,0,0,0,0,0,0,
+197,201,0,0,208,201,0,0,180,19,0,0,0,0,0,0,225,201,0,0,
+243,201,0,0,181,19,0,0,0,0,0,0,254,201,0,0,9,202,0,0,
+183,19,0,0,0,0,0,0,26,202,0,0,39,202,0,0,184,19,0,0,
+0,0,0,0,54,202,0,0,64,202,0,0,185,19,0,0,0,0,0,0,
+80,202,0,0,97,202,0,0,186,19,0,0,0,0,0,0,107,202,0,0,
+116,202,0,0,190,19,0,0,0,0,0,0,125,202,0,0,139,202,0,0,
+192,19,0,0,0,0,0,0,147,202,0,0,159,202,0,0,193,19,0,0,
+0,0,0,0,168,202,0,0,171,202,0,0,194,19,0,0,0,0,0,0,
+184,202,0,0,190,202,0,0,196,19,0,0,0,0,0,0,198,202,0,0,
+208,202,0,0,202,19,0,0,0,0,0,0,217,202,0,0,228,202,0,0,
+203,19,0,0,0,0,0,0,238,202,0,0,249,202,0,0,204,19,0,0,
+0,0,0,0,3,203,0,0,13,203,0,0,205,19,0,0,0,0,0,0,
+28,203,0,0,37,203,0,0,206,19,0,0,0,0,0,0,52,203,0,0,
+57,203,0,0,212,19,0,0,0,0,0,0,68,203,0,0,74,203,0,0,
+213,19,0,0,0,0,0,0,84,203,0,0,91,203,0,0,214,19,0,0,
+0,0,0,0,102,203,0,0,108,203,0,0,215,19,0,0,0,0,0,0,
+120,203,0,0,122,203,0,0,225,19,0,0,0,0,0,0,127,203,0,0,
+129,203,0,0,226,19,0,0,0,0,0,0,142,203,0,0,144,203,0,0,
+227,19,0,0,0,0,0,0,153,203,0,0,162,203,0,0,228,19,0,0,
+0,0,0,0,171,203,0,0,173,203,0,0,229,19,0,0,0,0,0,0,
+182,203,0,0,190,203,0,0,230,19,0,0,0,0,0,0,199,203,0,0,
+202,203,0,0,231,19,0,0,0,0,0,0,207,203,0,0,210,203,0,0,
+232,19,0,0,0,0,0,0,215,203,0,0,218,203,0,0,233,19,0,0,
+0,0,0,0,220,203,0,0,223,203,0,0,234,19,0,0,0,0,0,0,
+228,203,0,0,230,203,0,0,235,19,0,0,0,0,0,0,237,203,0,0,
+243,203,0,0,153,0,0,0,0,0,0,0,248,203,0,0,254,203,0,0,
+154,0,0,0,0,0,0,0,3,204,0,0,7,204,0,0,155,0,0,0,
+0,0,0,0,12,204,0,0,17,204,0,0,156,0,0,0,0,0,0,0,
+22,204,0,0,27,204,0,0,157,0,0,0,0,0,0,0,32,204,0,0,
+37,204,0,0,158,0,0,0,0,0,0,0,41,204,0,0,46,204,0,0,
+159,0,0,0,0,0,0,0,50,204,0,0,56,204,0,0,160,0,0,0,
+0,0,0,0,60,204,0,0,65,204,0,0,161,0,0,0,0,0,0,0,
+69,204,0,0,75,204,0,0,162,0,0,0,0,0,0,0,79,204,0,0,
+84,204,0,0,163,0,0,0,0,0,0,0,88,204,0,0,93,204,0,0,
+164,0,0,0,0,0,0,0,98,204,0,0,103,204,0,0,165,0,0,0,
+0,0,0,0,108,204,0,0,114,204,0,0,166,0,0,0,0,0,0,0,
+119,204,0,0,125,204,0,0,167,0,0,0,0,0,0,0,130,204,0,0,
+136,204,0,0,168,0,0,0,0,0,0,0,141,204,0,0,146,204,0,0,
+169,0,0,0,0,0,0,0,151,204,0,0,156,204,0,0,170,0,0,0,
+0,0,0,0,162,204,0,0,168,204,0,0,171,0,0,0,0,0,0,0,
+174,204,0,0,179,204,0,0,172,0,0,0,0,0,0,0,185,204,0,0,
+191,204,0,0,173,0,0,0,0,0,0,0,197,204,0,0,203,204,0,0,
+174,0,0,0,0,0,0,0,209,204,0,0,217,204,0,0,176,0,0,0,
+0,0,0,0,221,204,0,0,226,204,0,0,177,0,0,0,0,0,0,0,
+230,204,0,0,235,204,0,0,178,0,0,0,0,0,0,0,239,204,0,0,
+244,204,0,0,179,0,0,0,0,0,0,0,248,204,0,0,253,204,0,0,
+180,0,0,0,0,0,0,0,1,205,0,0,8,205,0,0,181,0,0,0,
+0,0,0,0,10,205,0,0,17,205,0,0,182,0,0,0,0,0,0,0,
+19,205,0,0,26,205,0,0,183,0,0,0,0,0,0,0,28,205,0,0,
+33,205,0,0,185,0,0,0,0,0,0,0,38,205,0,0,43,205,0,0,
+186,0,0,0,0,0,0,0,48,205,0,0,53,205,0,0,187,0,0,0,
+0,0,0,0,58,205,0,0,63,205,0,0,188,0,0,0,0,0,0,0,
+68,205,0,0,73,205,0,0,189,0,0,0,0,0,0,0,78,205,0,0,
+83,205,0,0,190,0,0,0,0,0,0,0,88,205,0,0,91,205,0,0,
+191,0,0,0,0,0,0,0,96,205,0,0,99,205,0,0,192,0,0,0,
+0,0,0,0,104,205,0,0,107,205,0,0,193,0,0,0,0,0,0,0,
+112,205,0,0,115,205,0,0,194,0,0,0,0,0,0,0,120,205,0,0,
+123,205,0,0,195,0,0,0,0,0,0,0,128,205,0,0,131,205,0,0,
+196,0,0,0,0,0,0,0,136,205,0,0,138,205,0,0,198,0,0,0,
+0,0,0,0,144,205,0,0,146,205,0,0,199,0,0,0,0,0,0,0,
+152,205,0,0,154,205,0,0,200,0,0,0,0,0,0,0,158,205,0,0,
+160,205,0,0,201,0,0,0,0,0,0,0,165,205,0,0,167,205,0,0,
+202,0,0,0,0,0,0,0,172,205,0,0,174,205,0,0,203,0,0,0,
+0,0,0,0,179,205,0,0,181,205,0,0,204,0,0,0,0,0,0,0,
+186,205,0,0,188,205,0,0,205,0,0,0,0,0,0,0,193,205,0,0,
+195,205,0,0,206,0,0,0,0,0,0,0,201,205,0,0,204,205,0,0,
+207,0,0,0,0,0,0,0,209,205,0,0,211,205,0,0,208,0,0,0,
+0,0,0,0,216,205,0,0,218,205,0,0,209,0,0,0,0,0,0,0,
+224,205,0,0,226,205,0,0,210,0,0,0,0,0,0,0,232,205,0,0,
+234,205,0,0,211,0,0,0,0,0,0,0,240,205,0,0,242,205,0,0,
+212,0,0,0,0,0,0,0,247,205,0,0,249,205,0,0,213,0,0,0,
+0,0,0,0,254,205,0,0,0,206,0,0,214,0,0,0,0,0,0,0,
+6,206,0,0,8,206,0,0,215,0,0,0,0,0,0,0,13,206,0,0,
+15,206,0,0,216,0,0,0,0,0,0,0,21,206,0,0,23,206,0,0,
+217,0,0,0,0,0,0,0,29,206,0,0,32,206,0,0,71,6,0,0,
+0,0,0,0,35,206,0,0,42,206,0,0,72,6,0,0,0,0,0,0,
+45,206,0,0,54,206,0,0,73,6,0,0,0,0,0,0,57,206,0,0,
+61,206,0,0,75,6,0,0,0,0,0,0,65,206,0,0,68,206,0,0,
+142,7,0,0,0,0,0,0,71,206,0,0,79,206,0,0,143,7,0,0,
+0,0,0,0,82,206,0,0,84,206,0,0,221,19,0,0,0,0,0,0,
+88,206,0,0,90,206,0,0,222,19,0,0,0,0,0,0,94,206,0,0,
+96,206,0,0,223,19,0,0,0,0,0,0,100,206,0,0,102,206,0,0,
+224,19,0,0,0,0,0,0,108,206,0,0,119,206,0,0,121,206,0,0,
+128,206,0,0,154,206,0,0,130,206,0,0,150,206,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,80,2,0,0,0,0,0,0,165,206,0,0,
+178,206,0,0,180,206,0,0,191,206,0,0,227,206,0,0,193,206,0,0,
+223,206,0,0,255,255,255,255,0,0,0,0,0,0,0,0,81,2,0,0,
+0,0,0,0,240,206,0,0,250,206,0,0,252,206,0,0,12,207,0,0,
+43,207,0,0,14,207,0,0,39,207,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,82,2,0,0,0,0,0,0,53,207,0,0,60,207,0,0,
+62,207,0,0,255,255,255,255,79,207,0,0,66,207,0,0,255,255,255,255,
+255,255,255,255,0,0,0,0,0,0,0,0,83,2,0,0,0,0,0,0,
+86,207,0,0,89,207,0,0,91,207,0,0,109,207,0,0,142,207,0,0,
+110,207,0,0,132,207,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+130,2,0,0,0,0,0,0,145,207,0,0,151,207,0,0,153,207,0,0,
+167,207,0,0,192,207,0,0,168,207,0,0,190,207,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,145,2,0,0,0,0,0,0,198,207,0,0,
+210,207,0,0,212,207,0,0,221,207,0,0,244,207,0,0,222,207,0,0,
+242,207,0,0,255,255,255,255,0,0,0,0,0,0,0,0,146,2,0,0,
+0,0,0,0,0,208,0,0,6,208,0,0,8,208,0,0,33,208,0,0,
+65,208,0,0,34,208,0,0,63,208,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,163,2,0,0,0,0,0,0,71,208,0,0,86,208,0,0,
+88,208,0,0,97,208,0,0,123,208,0,0,98,208,0,0,121,208,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,164,2,0,0,0,0,0,0,
+138,208,0,0,150,208,0,0,152,208,0,0,173,208,0,0,212,208,0,0,
+174,208,0,0,210,208,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+190,2,0,0,0,0,0,0,224,208,0,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,232,208,0,0,
+200,171,0,0,14,0,0,0,226,2,0,0,0,0,0,0,237,208,0,0,
+242,208,0,0,244,208,0,0,8,209,0,0,40,209,0,0,9,209,0,0,
+32,209,0,0,255,255,255,255,0,0,0,0,0,0,0,0,184,4,0,0,
+0,0,0,0,45,209,0,0,51,209,0,0,53,209,0,0,70,209,0,0,
+103,209,0,0,71,209,0,0,96,209,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,244,4,0,0,0,0,0,0,109,209,0,0,115,209,0,0,
+117,209,0,0,133,209,0,0,162,209,0,0,135,209,0,0,159,209,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,248,4,0,0,0,0,0,0,
+168,209,0,0,181,209,0,0,183,209,0,0,212,209,0,0,5,210,0,0,
+213,209,0,0,0,210,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+95,7,0,0,0,0,0,0,18,210,0,0,33,210,0,0,35,210,0,0,
+66,210,0,0,119,210,0,0,67,210,0,0,114,210,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,97,7,0,0,0,0,0,0,134,210,0,0,
+148,210,0,0,150,210,0,0,180,210,0,0,231,210,0,0,181,210,0,0,
+226,210,0,0,255,255,255,255,0,0,0,0,0,0,0,0,99,7,0,0,
+0,0,0,0,245,210,0,0,4,211,0,0,6,211,0,0,37,211,0,0,
+90,211,0,0,38,211,0,0,85,211,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,101,7,0,0,0,0,0,0,105,211,0,0,111,211,0,0,
+113,211,0,0,149,211,0,0,197,211,0,0,151,211,0,0,190,211,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,3,9,0,0,0,0,0,0,
+203,211,0,0,212,211,0,0,214,211,0,0,237,211,0,0,21,212,0,0,
+239,211,0,0,14,212,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+5,9,0,0,0,0,0,0,30,212,0,0,39,212,0,0,41,212,0,0,
+64,212,0,0,105,212,0,0,66,212,0,0,98,212,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,8,9,0,0,0,0,0,0,114,212,0,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,119,212,0,0,168,172,0,0,62,0,0,0,36,9,0,0,
+0,0,0,0,126,212,0,0,136,212,0,0,138,212,0,0,163,212,0,0,
+210,212,0,0,165,212,0,0,203,212,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,42,9,0,0,0,0,0,0,220,212,0,0,224,212,0,0,
+226,212,0,0,233,212,0,0,246,212,0,0,235,212,0,0,244,212,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,17,10,0,0,0,0,0,0,
+250,212,0,0,2,213,0,0,4,213,0,0,14,213,0,0,34,213,0,0,
+16,213,0,0,32,213,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+18,10,0,0,0,0,0,0,42,213,0,0,45,213,0,0,47,213,0,0,
+57,213,0,0,72,213,0,0,59,213,0,0,70,213,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,19,10,0,0,0,0,0,0,75,213,0,0,
+79,213,0,0,81,213,0,0,89,213,0,0,104,213,0,0,91,213,0,0,
+102,213,0,0,255,255,255,255,0,0,0,0,0,0,0,0,20,10,0,0,
+0,0,0,0,108,213,0,0,112,213,0,0,114,213,0,0,123,213,0,0,
+139,213,0,0,125,213,0,0,137,213,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,21,10,0,0,0,0,0,0,143,213,0,0,147,213,0,0,
+149,213,0,0,158,213,0,0,174,213,0,0,160,213,0,0,172,213,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,22,10,0,0,0,0,0,0,
+178,213,0,0,182,213,0,0,184,213,0,0,193,213,0,0,209,213,0,0,
+195,213,0,0,207,213,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+23,10,0,0,0,0,0,0,213,213,0,0,218,213,0,0,220,213,0,0,
+227,213,0,0,242,213,0,0,229,213,0,0,240,213,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,24,10,0,0,0,0,0,0,247,213,0,0,
+251,213,0,0,253,213,0,0,5,214,0,0,20,214,0,0,7,214,0,0,
+18,214,0,0,255,255,255,255,0,0,0,0,0,0,0,0,26,10,0,0,
+0,0,0,0,24,214,0,0,28,214,0,0,30,214,0,0,42,214,0,0,
+63,214,0,0,44,214,0,0,61,214,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,34,10,0,0,0,0,0,0,67,214,0,0,72,214,0,0,
+74,214,0,0,87,214,0,0,110,214,0,0,89,214,0,0,108,214,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,35,10,0,0,0,0,0,0,
+115,214,0,0,120,214,0,0,122,214,0,0,139,214,0,0,166,214,0,0,
+141,214,0,0,164,214,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+36,10,0,0,0,0,0,0,171,214,0,0,175,214,0,0,177,214,0,0,
+204,214,0,0,232,214,0,0,206,214,0,0,230,214,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,41,10,0,0,0,0,0,0,236,214,0,0,
+240,214,0,0,242,214,0,0,249,214,0,0,7,215,0,0,251,214,0,0,
+5,215,0,0,255,255,255,255,0,0,0,0,0,0,0,0,42,10,0,0,
+0,0,0,0,11,215,0,0,17,215,0,0,19,215,0,0,40,215,0,0,
+75,215,0,0,42,215,0,0,72,215,0,0,255,255,255,255,0,0,0,0,
+0,0,0,0,50,10,0,0,0,0,0,0,81,215,0,0,87,215,0,0,
+89,215,0,0,107,215,0,0,142,215,0,0,109,215,0,0,136,215,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,51,10,0,0,0,0,0,0,
+148,215,0,0,154,215,0,0,156,215,0,0,170,215,0,0,193,215,0,0,
+172,215,0,0,191,215,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+52,10,0,0,0,0,0,0,199,215,0,0,211,215,0,0,213,215,0,0,
+230,215,0,0,13,216,0,0,232,215,0,0,11,216,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,225,11,0,0,0,0,0,0,25,216,0,0,
+35,216,0,0,37,216,0,0,64,216,0,0,103,216,0,0,65,216,0,0,
+101,216,0,0,255,255,255,255,0,0,0,0,0,0,0,0,162,14,0,0,
+0,0,0,0,113,216,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,125,216,0,0,136,176,0,0,
+16,0,0,0,183,14,0,0,0,0,0,0,128,216,0,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+139,216,0,0,136,177,0,0,10,0,0,0,216,14,0,0,0,0,0,0,
+163,216,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,172,216,0,0,40,178,0,0,10,0,0,0,
+230,14,0,0,0,0,0,0,199,216,0,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,209,216,0,0,
+200,178,0,0,8,0,0,0,243,14,0,0,0,0,0,0,212,216,0,0,
+223,216,0,0,225,216,0,0,243,216,0,0,22,217,0,0,244,216,0,0,
+20,217,0,0,255,255,255,255,0,0,0,0,0,0,0,0,252,14,0,0,
+0,0,0,0,33,217,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,40,217,0,0,72,179,0,0,
+28,0,0,0,71,15,0,0,0,0,0,0,47,217,0,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+54,217,0,0,8,181,0,0,39,0,0,0,112,15,0,0,0,0,0,0,
+61,217,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,77,217,0,0,120,183,0,0,36,0,0,0,
+156,15,0,0,0,0,0,0,84,217,0,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,95,217,0,0,
+184,185,0,0,41,0,0,0,207,15,0,0,0,0,0,0,102,217,0,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,110,217,0,0,72,188,0,0,19,0,0,0,231,15,0,0,
+0,0,0,0,117,217,0,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,124,217,0,0,120,189,0,0,
+13,0,0,0,252,15,0,0,0,0,0,0,131,217,0,0,140,217,0,0,
+142,217,0,0,162,217,0,0,198,217,0,0,163,217,0,0,195,217,0,0,
+255,255,255,255,0,0,0,0,0,0,0,0,62,16,0,0,0,0,0,0,
+207,217,0,0,218,217,0,0,220,217,0,0,239,217,0,0,15,218,0,0,
+240,217,0,0,12,218,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+103,16,0,0,0,0,0,0,26,218,0,0,37,218,0,0,39,218,0,0,
+49,218,0,0,75,218,0,0,50,218,0,0,72,218,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,107,16,0,0,0,0,0,0,0,0,0,0,
+0,0,176,63,143,194,245,40,92,213,131,64,0,0,0,0,0,0,192,63,
+143,194,245,40,92,157,132,64,0,0,0,0,0,0,208,63,143,194,245,40,
+92,101,133,64,0,0,0,0,0,0,224,63,143,194,245,40,92,45,134,64,
+0,0,0,0,0,0,240,63,143,194,245,40,92,245,134,64,0,0,0,0,
+0,0,0,64,143,194,245,40,92,189,135,64,0,0,0,0,0,0,8,64,
+143,194,245,40,92,133,136,64,0,0,0,0,0,0,16,64,143,194,245,40,
+92,77,137,64,0,0,0,0,0,0,20,64,143,194,245,40,92,21,138,64,
+0,0,0,0,0,0,24,64,143,194,245,40,92,221,138,64,0,0,0,0,
+0,0,28,64,143,194,245,40,92,165,139,64,0,0,0,0,0,0,32,64,
+143,194,245,40,92,109,140,64,0,0,0,0,0,0,34,64,143,194,245,40,
+92,53,141,64,0,0,0,0,0,0,36,64,143,194,245,40,92,253,141,64,
+0,0,0,0,0,0,0,0,26,192,91,32,65,241,239,63,0,0,0,0,
+0,0,224,63,226,88,23,183,209,0,240,63,0,0,0,0,0,0,240,63,
+70,37,117,2,154,8,240,63,0,0,0,0,0,0,248,63,170,241,210,77,
+98,16,240,63,0,0,0,0,0,0,0,64,127,106,188,116,147,24,240,63,
+0,0,0,0,0,0,4,64,227,54,26,192,91,32,240,63,0,0,0,0,
+0,0,8,64,184,175,3,231,140,40,240,63,0,0,0,0,0,0,12,64,
+141,40,237,13,190,48,240,63,0,0,0,0,0,0,16,64,98,161,214,52,
+239,56,240,63,0,0,0,0,0,0,20,64,155,230,29,167,232,72,240,63,
+0,0,0,0,0,0,22,64,112,95,7,206,25,81,240,63,0,0,0,0,
+0,0,24,64,69,216,240,244,74,89,240,63,0,0,0,0,0,0,26,64,
+26,81,218,27,124,97,240,63,0,0,0,0,0,0,28,64,96,118,79,30,
+22,106,240,63,0,0,0,0,0,0,30,64,53,239,56,69,71,114,240,63,
+0,0,0,0,0,0,32,64,10,104,34,108,120,122,240,63,0,0,0,0,
+0,0,33,64,80,141,151,110,18,131,240,63,0,0,0,0,0,0,34,64,
+37,6,129,149,67,139,240,63,0,0,0,0,0,0,35,64,107,43,246,151,
+221,147,240,63,0,0,0,0,0,0,36,64,64,164,223,190,14,156,240,63,
+0,0,0,0,0,0,38,64,204,238,201,195,66,173,240,63,0,0,0,0,
+0,0,40,64,88,57,180,200,118,190,240,63,0,0,0,0,0,0,42,64,
+228,131,158,205,170,207,240,63,0,0,0,0,0,0,44,64,112,206,136,210,
+222,224,240,63,0,0,0,0,0,0,46,64,109,197,254,178,123,242,240,63,
+0,0,0,0,0,0,48,64,106,188,116,147,24,4,241,63,0,0,0,0,
+0,0,49,64,104,179,234,115,181,21,241,63,0,0,0,0,0,0,50,64,
+214,86,236,47,187,39,241,63,0,0,0,0,0,0,51,64,68,250,237,235,
+192,57,241,63,0,0,0,0,0,0,52,64,178,157,239,167,198,75,241,63,
+0,0,0,0,0,0,54,64,0,145,126,251,58,112,241,63,0,0,0,0,
+0,0,56,64,47,221,36,6,129,149,241,63,0,0,0,0,0,0,58,64,
+208,213,86,236,47,187,241,63,0,0,0,0,0,0,60,64,225,122,20,174,
+71,225,241,63,0,0,0,0,0,0,62,64,213,120,233,38,49,8,242,63,
+0,0,0,0,0,0,64,64,58,35,74,123,131,47,242,63,0,0,0,0,
+0,0,65,64,129,38,194,134,167,87,242,63,0,0,0,0,0,0,66,64,
+199,41,58,146,203,127,242,63,0,0,0,0,0,0,67,64,97,50,85,48,
+42,169,242,63,0,0,0,0,0,0,68,64,109,231,251,169,241,210,242,63,
+0,0,0,0,0,0,69,64,233,72,46,255,33,253,242,63,0,0,0,0,
+0,0,70,64,214,86,236,47,187,39,243,63,0,0,0,0,0,0,71,64,
+22,106,77,243,142,83,243,63,0,0,0,0,0,0,72,64,86,125,174,182,
+98,127,243,63,0,0,0,0,0,0,73,64,121,233,38,49,8,172,243,63,
+0,0,0,0,0,0,74,64,125,174,182,98,127,217,243,63,0,0,0,0,
+0,0,75,64,243,31,210,111,95,7,244,63,0,0,0,0,0,0,76,64,
+75,234,4,52,17,54,244,63,0,0,0,0,0,0,77,64,19,97,195,211,
+43,101,244,63,0,0,0,0,0,0,78,64,190,48,153,42,24,149,244,63,
+0,0,0,0,0,0,79,64,75,89,134,56,214,197,244,63,0,0,0,0,
+0,0,80,64,73,46,255,33,253,246,244,63,0,0,0,0,0,128,80,64,
+184,175,3,231,140,40,245,63,0,0,0,0,0,0,81,64,122,54,171,62,
+87,91,245,63,0,0,0,0,0,128,81,64,60,189,82,150,33,142,245,63,
+0,0,0,0,0,0,82,64,82,73,157,128,38,194,245,63,0,0,0,0,
+0,128,82,64,103,213,231,106,43,246,245,63,0,0,0,0,0,0,83,64,
+94,186,73,12,2,43,246,63,0,0,0,0,0,128,83,64,56,248,194,100,
+170,96,246,63,0,0,0,0,0,0,84,64,17,54,60,189,82,150,246,63,
+0,0,0,0,0,128,84,64,205,204,204,204,204,204,246,63,0,0,0,0,
+0,0,85,64,136,99,93,220,70,3,247,63,0,0,0,0,0,0,24,192,
+0,0,0,0,0,0,224,63,0,0,0,0,0,0,20,192,25,4,86,14,
+45,178,221,63,0,0,0,0,0,0,8,192,154,153,153,153,153,153,217,63,
+0,0,0,0,0,0,0,192,2,43,135,22,217,206,215,63,0,0,0,0,
+0,0,8,64,84,227,165,155,196,32,208,63,0,0,0,0,0,0,24,64,
+250,126,106,188,116,147,200,63,0,0,0,0,0,0,36,64,252,169,241,210,
+77,98,192,63,0,0,0,0,0,0,44,64,123,20,174,71,225,122,180,63,
+0,0,0,0,0,0,51,64,123,20,174,71,225,122,164,63,0,0,0,0,
+0,0,55,64,250,126,106,188,116,147,152,63,0,0,0,0,0,0,58,64,
+59,223,79,141,151,110,146,63,0,0,0,0,0,0,60,64,172,173,216,95,
+118,79,142,63,0,0,0,0,0,0,62,64,19,97,195,211,43,101,137,63,
+0,0,0,0,0,128,67,64,148,246,6,95,152,76,117,63,0,0,0,0,
+0,128,72,64,97,50,85,48,42,169,83,63,0,0,0,0,0,0,73,64,
+252,169,241,210,77,98,80,63,0,0,0,0,0,0,20,192,0,0,0,0,
+0,192,114,64,0,0,0,0,0,0,240,63,0,0,0,0,0,128,102,64,
+0,0,0,0,0,0,44,64,0,0,0,0,0,0,73,64,0,0,0,0,
+0,0,48,64,0,0,0,0,0,0,68,64,0,0,0,0,0,0,49,64,
+0,0,0,0,0,0,66,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,0,58,64,0,0,0,0,0,0,40,64,
+0,0,0,0,0,0,63,64,0,0,0,0,0,0,28,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,0,18,64,0,0,0,0,0,0,67,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,0,20,192,0,0,0,0,
+0,192,114,64,0,0,0,0,0,0,240,63,0,0,0,0,0,128,102,64,
+0,0,0,0,0,0,44,64,0,0,0,0,0,0,73,64,0,0,0,0,
+0,0,48,64,0,0,0,0,0,0,68,64,0,0,0,0,0,0,49,64,
+0,0,0,0,0,0,66,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,0,58,64,0,0,0,0,0,0,40,64,
+0,0,0,0,0,0,63,64,0,0,0,0,0,0,28,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,0,18,64,0,0,0,0,0,0,67,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,0,240,63,252,169,241,210,
+77,98,96,63,0,0,0,0,0,0,36,64,123,20,174,71,225,122,148,63,
+0,0,0,0,0,0,46,64,123,20,174,71,225,122,164,63,0,0,0,0,
+0,0,51,64,184,30,133,235,81,184,174,63,0,0,0,0,0,0,55,64,
+154,153,153,153,153,153,185,63,0,0,0,0,0,0,56,64,0,0,0,0,
+0,0,192,63,0,0,0,0,0,0,59,64,0,0,0,0,0,0,224,63,
+0,0,0,0,0,0,60,64,0,0,0,0,0,0,240,63,0,0,0,0,
+0,0,40,64,0,0,0,0,0,92,156,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,176,148,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,64,143,64,0,0,0,0,0,0,56,64,0,0,0,0,0,224,135,64,
+0,0,0,0,0,0,62,64,0,0,0,0,0,16,132,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,208,128,64,0,0,0,0,0,0,68,64,
+0,0,0,0,0,144,122,64,0,0,0,0,0,0,73,64,0,0,0,0,
+0,0,117,64,0,0,0,0,0,0,78,64,0,0,0,0,0,208,112,64,
+0,0,0,0,0,0,84,64,0,0,0,0,0,32,105,64,0,0,0,0,
+0,0,89,64,0,0,0,0,0,64,100,64,0,0,0,0,0,0,94,64,
+0,0,0,0,0,64,95,64,0,0,0,0,0,192,98,64,0,0,0,0,
+0,0,89,64,0,0,0,0,0,128,102,64,0,0,0,0,0,128,84,64,
+0,0,0,0,0,128,107,64,0,0,0,0,0,0,81,64,0,0,0,0,
+0,0,110,64,0,0,0,0,0,64,77,64,0,0,0,0,0,128,113,64,
+154,153,153,153,153,25,74,64,0,0,0,0,0,0,116,64,154,153,153,153,
+153,25,71,64,0,0,0,0,0,128,118,64,0,0,0,0,0,64,68,64,
+0,0,0,0,0,0,121,64,0,0,0,0,0,128,65,64,0,0,0,0,
+0,64,127,64,51,51,51,51,51,51,62,64,0,0,0,0,0,192,130,64,
+205,204,204,204,204,204,57,64,0,0,0,0,0,0,137,64,205,204,204,204,
+204,204,53,64,0,0,0,0,0,64,143,64,205,204,204,204,204,76,50,64,
+0,0,0,0,0,192,146,64,154,153,153,153,153,153,46,64,0,0,0,0,
+0,112,151,64,51,51,51,51,51,51,41,64,0,0,0,0,0,64,159,64,
+154,153,153,153,153,153,36,64,0,0,0,0,0,136,163,64,205,204,204,204,
+204,204,32,64,0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,
+0,0,0,0,0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,
+0,0,24,64,0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,
+0,0,0,0,0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,
+0,56,163,64,0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,
+0,0,0,0,0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,
+0,0,44,64,0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,64,144,64,0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,
+0,0,0,0,0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,
+0,0,62,64,0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,
+0,96,123,64,0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,
+0,0,0,0,0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,
+0,0,78,64,0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,
+0,0,0,0,0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,
+0,32,103,64,0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,
+0,0,0,0,0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,
+0,0,94,64,0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,
+0,0,0,0,0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,
+0,64,81,64,0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,
+0,0,0,0,0,192,108,64,0,0,0,0,0,128,74,64,0,0,0,0,
+0,0,110,64,0,0,0,0,0,64,70,64,0,0,0,0,0,128,113,64,
+0,0,0,0,0,64,66,64,0,0,0,0,0,0,116,64,51,51,51,51,
+51,51,61,64,0,0,0,0,0,128,118,64,205,204,204,204,204,204,54,64,
+0,0,0,0,0,0,121,64,205,204,204,204,204,76,49,64,0,0,0,0,
+0,64,127,64,154,153,153,153,153,153,41,64,0,0,0,0,0,192,130,64,
+154,153,153,153,153,153,34,64,0,0,0,0,0,0,137,64,0,0,0,0,
+0,0,26,64,0,0,0,0,0,64,143,64,0,0,0,0,0,0,18,64,
+0,0,0,0,0,192,146,64,0,0,0,0,0,0,8,64,0,0,0,0,
+0,112,151,64,0,0,0,0,0,0,0,64,0,0,0,0,0,64,159,64,
+51,51,51,51,51,51,243,63,0,0,0,0,0,0,16,64,0,0,0,0,
+0,26,179,64,0,0,0,0,0,0,20,64,0,0,0,0,0,29,176,64,
+0,0,0,0,0,0,24,64,0,0,0,0,0,8,171,64,0,0,0,0,
+0,0,28,64,0,0,0,0,0,168,166,64,0,0,0,0,0,0,32,64,
+0,0,0,0,0,56,163,64,0,0,0,0,0,0,36,64,0,0,0,0,
+0,74,160,64,0,0,0,0,0,0,40,64,0,0,0,0,0,148,155,64,
+0,0,0,0,0,0,44,64,0,0,0,0,0,248,150,64,0,0,0,0,
+0,0,48,64,0,0,0,0,0,56,147,64,0,0,0,0,0,0,52,64,
+0,0,0,0,0,64,144,64,0,0,0,0,0,0,54,64,0,0,0,0,
+0,168,139,64,0,0,0,0,0,0,56,64,0,0,0,0,0,72,135,64,
+0,0,0,0,0,0,62,64,0,0,0,0,0,136,131,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,104,128,64,0,0,0,0,0,0,68,64,
+0,0,0,0,0,96,123,64,0,0,0,0,0,0,71,64,0,0,0,0,
+0,32,119,64,0,0,0,0,0,0,75,64,0,0,0,0,0,96,115,64,
+0,0,0,0,0,0,78,64,0,0,0,0,0,64,112,64,0,0,0,0,
+0,128,81,64,0,0,0,0,0,64,107,64,0,0,0,0,0,0,84,64,
+0,0,0,0,0,32,103,64,0,0,0,0,0,128,86,64,0,0,0,0,
+0,64,99,64,0,0,0,0,0,0,89,64,0,0,0,0,0,32,96,64,
+0,0,0,0,0,0,94,64,0,0,0,0,0,64,91,64,0,0,0,0,
+0,192,98,64,0,0,0,0,0,128,84,64,0,0,0,0,0,128,102,64,
+0,0,0,0,0,64,81,64,0,0,0,0,0,128,107,64,0,0,0,0,
+0,0,77,64,0,0,0,0,0,0,110,64,0,0,0,0,0,0,73,64,
+0,0,0,0,0,128,113,64,0,0,0,0,0,192,67,64,0,0,0,0,
+0,0,116,64,0,0,0,0,0,128,61,64,0,0,0,0,0,128,118,64,
+0,0,0,0,0,0,55,64,0,0,0,0,0,0,121,64,0,0,0,0,
+0,64,50,64,0,0,0,0,0,64,127,64,205,204,204,204,204,204,43,64,
+0,0,0,0,0,192,130,64,154,153,153,153,153,25,37,64,0,0,0,0,
+0,0,137,64,154,153,153,153,153,153,30,64,0,0,0,0,0,64,143,64,
+51,51,51,51,51,51,23,64,0,0,0,0,0,192,146,64,102,102,102,102,
+102,102,14,64,0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,
+0,0,0,0,0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,
+0,0,24,64,0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,
+0,0,0,0,0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,
+0,56,163,64,0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,
+0,0,0,0,0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,
+0,0,44,64,0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,64,144,64,0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,
+0,0,0,0,0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,
+0,0,62,64,0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,
+0,96,123,64,0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,
+0,0,0,0,0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,
+0,0,78,64,0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,
+0,0,0,0,0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,
+0,32,103,64,0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,
+0,0,0,0,0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,
+0,0,94,64,0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,
+0,0,0,0,0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,
+0,64,81,64,0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,
+0,0,0,0,0,0,110,64,0,0,0,0,0,0,73,64,0,0,0,0,
+0,128,113,64,0,0,0,0,0,192,67,64,0,0,0,0,0,0,116,64,
+0,0,0,0,0,128,61,64,0,0,0,0,0,128,118,64,0,0,0,0,
+0,0,55,64,0,0,0,0,0,0,121,64,0,0,0,0,0,64,50,64,
+0,0,0,0,0,64,127,64,205,204,204,204,204,204,43,64,0,0,0,0,
+0,192,130,64,154,153,153,153,153,25,37,64,0,0,0,0,0,0,137,64,
+0,0,0,0,0,0,39,64,0,0,0,0,0,64,143,64,0,0,0,0,
+0,0,35,64,0,0,0,0,0,64,159,64,205,204,204,204,204,204,28,64,
+0,0,0,0,0,136,163,64,0,0,0,0,0,0,22,64,0,0,0,0,
+0,112,167,64,0,0,0,0,0,0,16,64,0,0,0,0,0,64,175,64,
+0,0,0,0,0,0,8,64,0,0,0,0,0,112,183,64,0,0,0,0,
+0,0,0,64,0,0,0,0,0,64,191,64,51,51,51,51,51,51,243,63,
+0,0,0,0,0,192,98,64,0,0,0,0,0,192,82,64,0,0,0,0,
+0,128,102,64,0,0,0,0,0,128,79,64,0,0,0,0,0,128,107,64,
+0,0,0,0,0,128,74,64,0,0,0,0,0,128,113,64,0,0,0,0,
+0,0,72,64,0,0,0,0,0,0,116,64,0,0,0,0,0,0,68,64,
+0,0,0,0,0,128,118,64,0,0,0,0,0,128,65,64,0,0,0,0,
+0,0,121,64,0,0,0,0,0,0,62,64,0,0,0,0,0,192,130,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,224,133,64,0,0,0,0,
+0,0,49,64,0,0,0,0,0,0,137,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,64,143,64,0,0,0,0,0,0,39,64,0,0,0,0,
+0,192,146,64,0,0,0,0,0,0,35,64,0,0,0,0,0,112,151,64,
+0,0,0,0,0,0,32,64,0,0,0,0,0,64,159,64,205,204,204,204,
+204,204,26,64,0,0,0,0,0,136,163,64,0,0,0,0,0,0,22,64,
+0,0,0,0,0,112,167,64,0,0,0,0,0,0,16,64,0,0,0,0,
+0,64,175,64,0,0,0,0,0,0,8,64,0,0,0,0,0,112,183,64,
+0,0,0,0,0,0,0,64,0,0,0,0,0,64,191,64,51,51,51,51,
+51,51,243,63,0,0,0,0,0,0,48,64,154,153,153,153,153,153,46,64,
+0,0,0,0,0,0,57,64,205,204,204,204,204,204,53,64,0,0,0,0,
+0,0,62,64,154,153,153,153,153,153,55,64,0,0,0,0,0,128,65,64,
+0,0,0,0,0,192,57,64,0,0,0,0,0,128,70,64,0,0,0,0,
+0,128,65,64,0,0,0,0,0,0,78,64,154,153,153,153,153,25,71,64,
+0,0,0,0,0,64,80,64,0,0,0,0,0,192,74,64,0,0,0,0,
+0,192,82,64,0,0,0,0,0,64,77,64,0,0,0,0,0,128,86,64,
+0,0,0,0,0,64,80,64,0,0,0,0,0,128,91,64,0,0,0,0,
+0,128,83,64,0,0,0,0,0,64,96,64,0,0,0,0,0,64,87,64,
+0,0,0,0,0,0,100,64,0,0,0,0,0,192,95,64,0,0,0,0,
+0,0,105,64,0,0,0,0,0,128,99,64,92,218,0,0,95,218,0,0,
+82,0,0,0,0,0,0,0,97,218,0,0,106,218,0,0,83,0,0,0,
+0,0,0,0,109,218,0,0,111,218,0,0,85,0,0,0,0,0,0,0,
+113,218,0,0,120,218,0,0,86,0,0,0,0,0,0,0,122,218,0,0,
+124,218,0,0,89,0,0,0,0,0,0,0,126,218,0,0,132,218,0,0,
+90,0,0,0,0,0,0,0,134,218,0,0,136,218,0,0,94,0,0,0,
+0,0,0,0,138,218,0,0,145,218,0,0,95,0,0,0,0,0,0,0,
+147,218,0,0,151,218,0,0,96,0,0,0,0,0,0,0,158,218,0,0,
+161,218,0,0,98,0,0,0,0,0,0,0,163,218,0,0,171,218,0,0,
+99,0,0,0,0,0,0,0,174,218,0,0,178,218,0,0,106,0,0,0,
+0,0,0,0,180,218,0,0,185,218,0,0,107,0,0,0,0,0,0,0,
+189,218,0,0,191,218,0,0,114,0,0,0,0,0,0,0,193,218,0,0,
+200,218,0,0,115,0,0,0,0,0,0,0,202,218,0,0,209,218,0,0,
+126,0,0,0,0,0,0,0,224,218,0,0,227,218,0,0,129,0,0,0,
+0,0,0,0,242,218,0,0,252,218,0,0,130,0,0,0,0,0,0,0,
+255,218,0,0,3,219,0,0,138,0,0,0,0,0,0,0,5,219,0,0,
+9,219,0,0,141,0,0,0,0,0,0,0,11,219,0,0,15,219,0,0,
+223,0,0,0,0,0,0,0,17,219,0,0,21,219,0,0,224,0,0,0,
+0,0,0,0,23,219,0,0,30,219,0,0,225,0,0,0,0,0,0,0,
+32,219,0,0,39,219,0,0,226,0,0,0,0,0,0,0,41,219,0,0,
+47,219,0,0,227,0,0,0,0,0,0,0,49,219,0,0,56,219,0,0,
+228,0,0,0,0,0,0,0,58,219,0,0,63,219,0,0,229,0,0,0,
+0,0,0,0,65,219,0,0,75,219,0,0,230,0,0,0,0,0,0,0,
+77,219,0,0,82,219,0,0,231,0,0,0,0,0,0,0,84,219,0,0,
+94,219,0,0,232,0,0,0,0,0,0,0,96,219,0,0,100,219,0,0,
+233,0,0,0,0,0,0,0,102,219,0,0,108,219,0,0,234,0,0,0,
+0,0,0,0,110,219,0,0,116,219,0,0,235,0,0,0,0,0,0,0,
+118,219,0,0,123,219,0,0,236,0,0,0,0,0,0,0,125,219,0,0,
+129,219,0,0,237,0,0,0,0,0,0,0,132,219,0,0,139,219,0,0,
+238,0,0,0,0,0,0,0,142,219,0,0,149,219,0,0,239,0,0,0,
+0,0,0,0,152,219,0,0,161,219,0,0,240,0,0,0,0,0,0,0,
+164,219,0,0,173,219,0,0,241,0,0,0,0,0,0,0,176,219,0,0,
+184,219,0,0,242,0,0,0,0,0,0,0,187,219,0,0,195,219,0,0,
+243,0,0,0,0,0,0,0,198,219,0,0,208,219,0,0,244,0,0,0,
+0,0,0,0,211,219,0,0,220,219,0,0,245,0,0,0,0,0,0,0,
+223,219,0,0,232,219,0,0,246,0,0,0,0,0,0,0,235,219,0,0,
+242,219,0,0,247,0,0,0,0,0,0,0,245,219,0,0,252,219,0,0,
+248,0,0,0,0,0,0,0,255,219,0,0,5,220,0,0,249,0,0,0,
+0,0,0,0,8,220,0,0,14,220,0,0,250,0,0,0,0,0,0,0,
+17,220,0,0,23,220,0,0,251,0,0,0,0,0,0,0,26,220,0,0,
+34,220,0,0,252,0,0,0,0,0,0,0,37,220,0,0,44,220,0,0,
+253,0,0,0,0,0,0,0,47,220,0,0,54,220,0,0,254,0,0,0,
+0,0,0,0,57,220,0,0,65,220,0,0,255,0,0,0,0,0,0,0,
+69,220,0,0,78,220,0,0,0,1,0,0,0,0,0,0,83,220,0,0,
+91,220,0,0,1,1,0,0,0,0,0,0,95,220,0,0,108,220,0,0,
+10,1,0,0,0,0,0,0,112,220,0,0,126,220,0,0,11,1,0,0,
+0,0,0,0,131,220,0,0,148,220,0,0,12,1,0,0,0,0,0,0,
+153,220,0,0,170,220,0,0,13,1,0,0,0,0,0,0,175,220,0,0,
+191,220,0,0,14,1,0,0,0,0,0,0,196,220,0,0,212,220,0,0,
+15,1,0,0,0,0,0,0,217,220,0,0,232,220,0,0,16,1,0,0,
+0,0,0,0,237,220,0,0,252,220,0,0,17,1,0,0,0,0,0,0,
+1,221,0,0,19,221,0,0,18,1,0,0,0,0,0,0,34,221,0,0,
+49,221,0,0,19,1,0,0,0,0,0,0,54,221,0,0,71,221,0,0,
+20,1,0,0,0,0,0,0,76,221,0,0,94,221,0,0,21,1,0,0,
+0,0,0,0,99,221,0,0,117,221,0,0,22,1,0,0,0,0,0,0,
+122,221,0,0,145,221,0,0,23,1,0,0,0,0,0,0,150,221,0,0,
+169,221,0,0,24,1,0,0,0,0,0,0,174,221,0,0,192,221,0,0,
+25,1,0,0,0,0,0,0,197,221,0,0,218,221,0,0,26,1,0,0,
+0,0,0,0,223,221,0,0,242,221,0,0,27,1,0,0,0,0,0,0,
+247,221,0,0,11,222,0,0,28,1,0,0,0,0,0,0,16,222,0,0,
+34,222,0,0,29,1,0,0,0,0,0,0,39,222,0,0,50,222,0,0,
+31,1,0,0,0,0,0,0,56,222,0,0,63,222,0,0,32,1,0,0,
+0,0,0,0,69,222,0,0,81,222,0,0,34,1,0,0,0,0,0,0,
+91,222,0,0,104,222,0,0,35,1,0,0,0,0,0,0,114,222,0,0,
+130,222,0,0,36,1,0,0,0,0,0,0,140,222,0,0,156,222,0,0,
+37,1,0,0,0,0,0,0,166,222,0,0,181,222,0,0,38,1,0,0,
+0,0,0,0,191,222,0,0,206,222,0,0,39,1,0,0,0,0,0,0,
+216,222,0,0,230,222,0,0,40,1,0,0,0,0,0,0,240,222,0,0,
+254,222,0,0,41,1,0,0,0,0,0,0,8,223,0,0,25,223,0,0,
+42,1,0,0,0,0,0,0,39,223,0,0,53,223,0,0,43,1,0,0,
+0,0,0,0,64,223,0,0,80,223,0,0,44,1,0,0,0,0,0,0,
+91,223,0,0,108,223,0,0,45,1,0,0,0,0,0,0,119,223,0,0,
+136,223,0,0,46,1,0,0,0,0,0,0,147,223,0,0,169,223,0,0,
+47,1,0,0,0,0,0,0,180,223,0,0,198,223,0,0,48,1,0,0,
+0,0,0,0,209,223,0,0,226,223,0,0,49,1,0,0,0,0,0,0,
+237,223,0,0,255,223,0,0,50,1,0,0,0,0,0,0,10,224,0,0,
+28,224,0,0,51,1,0,0,0,0,0,0,39,224,0,0,58,224,0,0,
+52,1,0,0,0,0,0,0,69,224,0,0,86,224,0,0,53,1,0,0,
+0,0,0,0,97,224,0,0,106,224,0,0,57,1,0,0,0,0,0,0,
+119,224,0,0,128,224,0,0,58,1,0,0,0,0,0,0,143,224,0,0,
+153,224,0,0,59,1,0,0,0,0,0,0,168,224,0,0,181,224,0,0,
+60,1,0,0,0,0,0,0,196,224,0,0,209,224,0,0,61,1,0,0,
+0,0,0,0,224,224,0,0,236,224,0,0,62,1,0,0,0,0,0,0,
+251,224,0,0,7,225,0,0,63,1,0,0,0,0,0,0,22,225,0,0,
+33,225,0,0,64,1,0,0,0,0,0,0,48,225,0,0,59,225,0,0,
+65,1,0,0,0,0,0,0,74,225,0,0,88,225,0,0,66,1,0,0,
+0,0,0,0,99,225,0,0,110,225,0,0,67,1,0,0,0,0,0,0,
+126,225,0,0,139,225,0,0,71,1,0,0,0,0,0,0,148,225,0,0,
+161,225,0,0,72,1,0,0,0,0,0,0,170,225,0,0,184,225,0,0,
+73,1,0,0,0,0,0,0,194,225,0,0,211,225,0,0,74,1,0,0,
+0,0,0,0,224,225,0,0,241,225,0,0,75,1,0,0,0,0,0,0,
+254,225,0,0,14,226,0,0,76,1,0,0,0,0,0,0,26,226,0,0,
+42,226,0,0,77,1,0,0,0,0,0,0,54,226,0,0,69,226,0,0,
+78,1,0,0,0,0,0,0,80,226,0,0,95,226,0,0,79,1,0,0,
+0,0,0,0,106,226,0,0,124,226,0,0,80,1,0,0,0,0,0,0,
+138,226,0,0,153,226,0,0,81,1,0,0,0,0,0,0,164,226,0,0,
+172,226,0,0,90,1,0,0,0,0,0,0,185,226,0,0,194,226,0,0,
+91,1,0,0,0,0,0,0,208,226,0,0,220,226,0,0,92,1,0,0,
+0,0,0,0,237,226,0,0,249,226,0,0,93,1,0,0,0,0,0,0,
+10,227,0,0,21,227,0,0,94,1,0,0,0,0,0,0,37,227,0,0,
+48,227,0,0,95,1,0,0,0,0,0,0,64,227,0,0,74,227,0,0,
+96,1,0,0,0,0,0,0,89,227,0,0,99,227,0,0,97,1,0,0,
+0,0,0,0,114,227,0,0,127,227,0,0,98,1,0,0,0,0,0,0,
+145,227,0,0,155,227,0,0,99,1,0,0,0,0,0,0,170,227,0,0,
+182,227,0,0,100,1,0,0,0,0,0,0,199,227,0,0,212,227,0,0,
+101,1,0,0,0,0,0,0,230,227,0,0,243,227,0,0,102,1,0,0,
+0,0,0,0,5,228,0,0,23,228,0,0,103,1,0,0,0,0,0,0,
+46,228,0,0,60,228,0,0,104,1,0,0,0,0,0,0,79,228,0,0,
+92,228,0,0,105,1,0,0,0,0,0,0,110,228,0,0,126,228,0,0,
+106,1,0,0,0,0,0,0,147,228,0,0,161,228,0,0,107,1,0,0,
+0,0,0,0,180,228,0,0,195,228,0,0,108,1,0,0,0,0,0,0,
+215,228,0,0,228,228,0,0,109,1,0,0,0,0,0,0,246,228,0,0,
+253,228,0,0,125,1,0,0,0,0,0,0,8,229,0,0,10,229,0,0,
+126,1,0,0,0,0,0,0,17,229,0,0,24,229,0,0,127,1,0,0,
+0,0,0,0,30,229,0,0,33,229,0,0,128,1,0,0,0,0,0,0,
+40,229,0,0,46,229,0,0,129,1,0,0,0,0,0,0,50,229,0,0,
+52,229,0,0,130,1,0,0,0,0,0,0,58,229,0,0,63,229,0,0,
+131,1,0,0,0,0,0,0,67,229,0,0,69,229,0,0,132,1,0,0,
+0,0,0,0,74,229,0,0,82,229,0,0,133,1,0,0,0,0,0,0,
+86,229,0,0,88,229,0,0,134,1,0,0,0,0,0,0,96,229,0,0,
+101,229,0,0,135,1,0,0,0,0,0,0,105,229,0,0,107,229,0,0,
+136,1,0,0,0,0,0,0,112,229,0,0,116,229,0,0,137,1,0,0,
+0,0,0,0,120,229,0,0,128,229,0,0,138,1,0,0,0,0,0,0,
+132,229,0,0,134,229,0,0,139,1,0,0,0,0,0,0,142,229,0,0,
+148,229,0,0,140,1,0,0,0,0,0,0,152,229,0,0,154,229,0,0,
+141,1,0,0,0,0,0,0,160,229,0,0,166,229,0,0,142,1,0,0,
+0,0,0,0,170,229,0,0,173,229,0,0,143,1,0,0,0,0,0,0,
+179,229,0,0,185,229,0,0,144,1,0,0,0,0,0,0,190,229,0,0,
+192,229,0,0,145,1,0,0,0,0,0,0,198,229,0,0,204,229,0,0,
+146,1,0,0,0,0,0,0,211,229,0,0,213,229,0,0,147,1,0,0,
+0,0,0,0,219,229,0,0,225,229,0,0,148,1,0,0,0,0,0,0,
+228,229,0,0,231,229,0,0,149,1,0,0,0,0,0,0,237,229,0,0,
+244,229,0,0,157,1,0,0,0,0,0,0,250,229,0,0,255,229,0,0,
+158,1,0,0,0,0,0,0,8,230,0,0,15,230,0,0,159,1,0,0,
+0,0,0,0,24,230,0,0,29,230,0,0,160,1,0,0,0,0,0,0,
+38,230,0,0,46,230,0,0,161,1,0,0,0,0,0,0,53,230,0,0,
+60,230,0,0,162,1,0,0,0,0,0,0,65,230,0,0,71,230,0,0,
+163,1,0,0,0,0,0,0,78,230,0,0,90,230,0,0,164,1,0,0,
+0,0,0,0,100,230,0,0,106,230,0,0,165,1,0,0,0,0,0,0,
+110,230,0,0,116,230,0,0,166,1,0,0,0,0,0,0,123,230,0,0,
+132,230,0,0,167,1,0,0,0,0,0,0,145,230,0,0,152,230,0,0,
+168,1,0,0,0,0,0,0,165,230,0,0,172,230,0,0,169,1,0,0,
+0,0,0,0,180,230,0,0,192,230,0,0,170,1,0,0,0,0,0,0,
+198,230,0,0,209,230,0,0,171,1,0,0,0,0,0,0,213,230,0,0,
+225,230,0,0,172,1,0,0,0,0,0,0,233,230,0,0,244,230,0,0,
+173,1,0,0,0,0,0,0,250,230,0,0,4,231,0,0,174,1,0,0,
+0,0,0,0,10,231,0,0,19,231,0,0,175,1,0,0,0,0,0,0,
+33,231,0,0,46,231,0,0,176,1,0,0,0,0,0,0,62,231,0,0,
+70,231,0,0,177,1,0,0,0,0,0,0,84,231,0,0,99,231,0,0,
+178,1,0,0,0,0,0,0,113,231,0,0,123,231,0,0,179,1,0,0,
+0,0,0,0,141,231,0,0,161,231,0,0,180,1,0,0,0,0,0,0,
+181,231,0,0,186,231,0,0,187,1,0,0,0,0,0,0,194,231,0,0,
+197,231,0,0,188,1,0,0,0,0,0,0,202,231,0,0,204,231,0,0,
+189,1,0,0,0,0,0,0,209,231,0,0,215,231,0,0,190,1,0,0,
+0,0,0,0,223,231,0,0,225,231,0,0,191,1,0,0,0,0,0,0,
+231,231,0,0,241,231,0,0,192,1,0,0,0,0,0,0,247,231,0,0,
+254,231,0,0,193,1,0,0,0,0,0,0,12,232,0,0,18,232,0,0,
+194,1,0,0,0,0,0,0,25,232,0,0,31,232,0,0,195,1,0,0,
+0,0,0,0,44,232,0,0,52,232,0,0,196,1,0,0,0,0,0,0,
+59,232,0,0,63,232,0,0,197,1,0,0,0,0,0,0,70,232,0,0,
+74,232,0,0,198,1,0,0,0,0,0,0,83,232,0,0,90,232,0,0,
+199,1,0,0,0,0,0,0,101,232,0,0,108,232,0,0,200,1,0,0,
+0,0,0,0,118,232,0,0,121,232,0,0,201,1,0,0,0,0,0,0,
+126,232,0,0,130,232,0,0,202,1,0,0,0,0,0,0,138,232,0,0,
+144,232,0,0,203,1,0,0,0,0,0,0,152,232,0,0,161,232,0,0,
+204,1,0,0,0,0,0,0,175,232,0,0,177,232,0,0,205,1,0,0,
+0,0,0,0,183,232,0,0,185,232,0,0,206,1,0,0,0,0,0,0,
+191,232,0,0,195,232,0,0,212,1,0,0,0,0,0,0,203,232,0,0,
+210,232,0,0,213,1,0,0,0,0,0,0,217,232,0,0,226,232,0,0,
+214,1,0,0,0,0,0,0,234,232,0,0,240,232,0,0,215,1,0,0,
+0,0,0,0,2,233,0,0,11,233,0,0,216,1,0,0,0,0,0,0,
+17,233,0,0,23,233,0,0,221,1,0,0,0,0,0,0,31,233,0,0,
+36,233,0,0,223,1,0,0,0,0,0,0,46,233,0,0,51,233,0,0,
+227,1,0,0,0,0,0,0,62,233,0,0,71,233,0,0,230,1,0,0,
+0,0,0,0,82,233,0,0,90,233,0,0,231,1,0,0,0,0,0,0,
+93,233,0,0,101,233,0,0,232,1,0,0,0,0,0,0,109,233,0,0,
+115,233,0,0,233,1,0,0,0,0,0,0,124,233,0,0,133,233,0,0,
+234,1,0,0,0,0,0,0,141,233,0,0,147,233,0,0,236,1,0,0,
+0,0,0,0,157,233,0,0,164,233,0,0,237,1,0,0,0,0,0,0,
+175,233,0,0,180,233,0,0,238,1,0,0,0,0,0,0,187,233,0,0,
+194,233,0,0,239,1,0,0,0,0,0,0,205,233,0,0,212,233,0,0,
+240,1,0,0,0,0,0,0,216,233,0,0,225,233,0,0,241,1,0,0,
+0,0,0,0,232,233,0,0,238,233,0,0,242,1,0,0,0,0,0,0,
+246,233,0,0,250,233,0,0,243,1,0,0,0,0,0,0,3,234,0,0,
+14,234,0,0,244,1,0,0,0,0,0,0,24,234,0,0,30,234,0,0,
+245,1,0,0,0,0,0,0,36,234,0,0,42,234,0,0,246,1,0,0,
+0,0,0,0,51,234,0,0,61,234,0,0,248,1,0,0,0,0,0,0,
+70,234,0,0,82,234,0,0,249,1,0,0,0,0,0,0,87,234,0,0,
+94,234,0,0,250,1,0,0,0,0,0,0,106,234,0,0,117,234,0,0,
+251,1,0,0,0,0,0,0,127,234,0,0,136,234,0,0,253,1,0,0,
+0,0,0,0,151,234,0,0,158,234,0,0,1,2,0,0,0,0,0,0,
+167,234,0,0,170,234,0,0,2,2,0,0,0,0,0,0,177,234,0,0,
+181,234,0,0,3,2,0,0,0,0,0,0,193,234,0,0,199,234,0,0,
+7,2,0,0,0,0,0,0,217,234,0,0,223,234,0,0,9,2,0,0,
+0,0,0,0,231,234,0,0,235,234,0,0,10,2,0,0,0,0,0,0,
+241,234,0,0,245,234,0,0,16,2,0,0,0,0,0,0,247,234,0,0,
+254,234,0,0,17,2,0,0,0,0,0,0,3,235,0,0,7,235,0,0,
+18,2,0,0,0,0,0,0,14,235,0,0,19,235,0,0,19,2,0,0,
+0,0,0,0,26,235,0,0,29,235,0,0,20,2,0,0,0,0,0,0,
+34,235,0,0,38,235,0,0,21,2,0,0,0,0,0,0,44,235,0,0,
+46,235,0,0,22,2,0,0,0,0,0,0,50,235,0,0,53,235,0,0,
+23,2,0,0,0,0,0,0,57,235,0,0,62,235,0,0,24,2,0,0,
+0,0,0,0,68,235,0,0,71,235,0,0,25,2,0,0,0,0,0,0,
+76,235,0,0,85,235,0,0,26,2,0,0,0,0,0,0,91,235,0,0,
+101,235,0,0,27,2,0,0,0,0,0,0,108,235,0,0,114,235,0,0,
+28,2,0,0,0,0,0,0,123,235,0,0,126,235,0,0,29,2,0,0,
+0,0,0,0,135,235,0,0,140,235,0,0,30,2,0,0,0,0,0,0,
+150,235,0,0,156,235,0,0,31,2,0,0,0,0,0,0,164,235,0,0,
+169,235,0,0,33,2,0,0,0,0,0,0,179,235,0,0,186,235,0,0,
+41,2,0,0,0,0,0,0,198,235,0,0,205,235,0,0,42,2,0,0,
+0,0,0,0,218,235,0,0,222,235,0,0,43,2,0,0,0,0,0,0,
+229,235,0,0,236,235,0,0,44,2,0,0,0,0,0,0,243,235,0,0,
+250,235,0,0,45,2,0,0,0,0,0,0,6,236,0,0,16,236,0,0,
+46,2,0,0,0,0,0,0,23,236,0,0,25,236,0,0,47,2,0,0,
+0,0,0,0,32,236,0,0,39,236,0,0,48,2,0,0,0,0,0,0,
+51,236,0,0,61,236,0,0,49,2,0,0,0,0,0,0,68,236,0,0,
+70,236,0,0,50,2,0,0,0,0,0,0,77,236,0,0,80,236,0,0,
+51,2,0,0,0,0,0,0,82,236,0,0,93,236,0,0,52,2,0,0,
+0,0,0,0,104,236,0,0,113,236,0,0,53,2,0,0,0,0,0,0,
+124,236,0,0,133,236,0,0,54,2,0,0,0,0,0,0,144,236,0,0,
+152,236,0,0,55,2,0,0,0,0,0,0,163,236,0,0,168,236,0,0,
+57,2,0,0,0,0,0,0,180,236,0,0,185,236,0,0,58,2,0,0,
+0,0,0,0,192,236,0,0,203,236,0,0,59,2,0,0,0,0,0,0,
+208,236,0,0,212,236,0,0,60,2,0,0,0,0,0,0,217,236,0,0,
+228,236,0,0,61,2,0,0,0,0,0,0,241,236,0,0,245,236,0,0,
+62,2,0,0,0,0,0,0,6,237,0,0,12,237,0,0,63,2,0,0,
+0,0,0,0,16,237,0,0,33,237,0,0,64,2,0,0,0,0,0,0,
+45,237,0,0,62,237,0,0,65,2,0,0,0,0,0,0,85,237,0,0,
+94,237,0,0,66,2,0,0,0,0,0,0,108,237,0,0,119,237,0,0,
+68,2,0,0,0,0,0,0,131,237,0,0,139,237,0,0,69,2,0,0,
+0,0,0,0,151,237,0,0,155,237,0,0,71,2,0,0,0,0,0,0,
+168,237,0,0,181,237,0,0,72,2,0,0,0,0,0,0,202,237,0,0,
+209,237,0,0,89,2,0,0,0,0,0,0,217,237,0,0,230,237,0,0,
+90,2,0,0,0,0,0,0,246,237,0,0,3,238,0,0,91,2,0,0,
+0,0,0,0,23,238,0,0,36,238,0,0,92,2,0,0,0,0,0,0,
+56,238,0,0,69,238,0,0,93,2,0,0,0,0,0,0,82,238,0,0,
+95,238,0,0,94,2,0,0,0,0,0,0,108,238,0,0,128,238,0,0,
+95,2,0,0,0,0,0,0,138,238,0,0,145,238,0,0,96,2,0,0,
+0,0,0,0,155,238,0,0,163,238,0,0,102,2,0,0,0,0,0,0,
+168,238,0,0,170,238,0,0,103,2,0,0,0,0,0,0,178,238,0,0,
+183,238,0,0,104,2,0,0,0,0,0,0,189,238,0,0,195,238,0,0,
+111,2,0,0,0,0,0,0,201,238,0,0,205,238,0,0,114,2,0,0,
+0,0,0,0,210,238,0,0,226,238,0,0,115,2,0,0,0,0,0,0,
+230,238,0,0,234,238,0,0,116,2,0,0,0,0,0,0,239,238,0,0,
+255,238,0,0,117,2,0,0,0,0,0,0,3,239,0,0,7,239,0,0,
+118,2,0,0,0,0,0,0,13,239,0,0,30,239,0,0,119,2,0,0,
+0,0,0,0,34,239,0,0,40,239,0,0,120,2,0,0,0,0,0,0,
+45,239,0,0,55,239,0,0,121,2,0,0,0,0,0,0,61,239,0,0,
+68,239,0,0,122,2,0,0,0,0,0,0,73,239,0,0,84,239,0,0,
+123,2,0,0,0,0,0,0,91,239,0,0,96,239,0,0,124,2,0,0,
+0,0,0,0,103,239,0,0,115,239,0,0,142,2,0,0,0,0,0,0,
+122,239,0,0,145,239,0,0,143,2,0,0,0,0,0,0,152,239,0,0,
+163,239,0,0,147,2,0,0,0,0,0,0,165,239,0,0,170,239,0,0,
+148,2,0,0,0,0,0,0,172,239,0,0,186,239,0,0,165,2,0,0,
+0,0,0,0,195,239,0,0,200,239,0,0,166,2,0,0,0,0,0,0,
+209,239,0,0,224,239,0,0,183,2,0,0,0,0,0,0,229,239,0,0,
+240,239,0,0,184,2,0,0,0,0,0,0,255,239,0,0,13,240,0,0,
+185,2,0,0,0,0,0,0,18,240,0,0,23,240,0,0,186,2,0,0,
+0,0,0,0,34,240,0,0,40,240,0,0,187,2,0,0,0,0,0,0,
+51,240,0,0,63,240,0,0,188,2,0,0,0,0,0,0,74,240,0,0,
+85,240,0,0,191,2,0,0,0,0,0,0,95,240,0,0,100,240,0,0,
+198,2,0,0,0,0,0,0,102,240,0,0,108,240,0,0,199,2,0,0,
+0,0,0,0,110,240,0,0,113,240,0,0,0,3,0,0,0,0,0,0,
+136,240,0,0,138,240,0,0,1,3,0,0,0,0,0,0,155,240,0,0,
+161,240,0,0,2,3,0,0,0,0,0,0,163,240,0,0,167,240,0,0,
+3,3,0,0,0,0,0,0,181,240,0,0,190,240,0,0,4,3,0,0,
+0,0,0,0,200,240,0,0,207,240,0,0,5,3,0,0,0,0,0,0,
+211,240,0,0,213,240,0,0,6,3,0,0,0,0,0,0,231,240,0,0,
+233,240,0,0,7,3,0,0,0,0,0,0,252,240,0,0,1,241,0,0,
+8,3,0,0,0,0,0,0,10,241,0,0,15,241,0,0,9,3,0,0,
+0,0,0,0,20,241,0,0,22,241,0,0,10,3,0,0,0,0,0,0,
+47,241,0,0,60,241,0,0,19,3,0,0,0,0,0,0,76,241,0,0,
+91,241,0,0,23,3,0,0,0,0,0,0,110,241,0,0,112,241,0,0,
+24,3,0,0,0,0,0,0,127,241,0,0,131,241,0,0,25,3,0,0,
+0,0,0,0,146,241,0,0,155,241,0,0,26,3,0,0,0,0,0,0,
+170,241,0,0,179,241,0,0,29,3,0,0,0,0,0,0,194,241,0,0,
+201,241,0,0,31,3,0,0,0,0,0,0,203,241,0,0,212,241,0,0,
+32,3,0,0,0,0,0,0,226,241,0,0,230,241,0,0,33,3,0,0,
+0,0,0,0,239,241,0,0,251,241,0,0,34,3,0,0,0,0,0,0,
+14,242,0,0,16,242,0,0,35,3,0,0,0,0,0,0,28,242,0,0,
+38,242,0,0,36,3,0,0,0,0,0,0,46,242,0,0,48,242,0,0,
+37,3,0,0,0,0,0,0,58,242,0,0,69,242,0,0,38,3,0,0,
+0,0,0,0,79,242,0,0,91,242,0,0,39,3,0,0,0,0,0,0,
+111,242,0,0,121,242,0,0,41,3,0,0,0,0,0,0,148,242,0,0,
+164,242,0,0,44,3,0,0,0,0,0,0,189,242,0,0,195,242,0,0,
+45,3,0,0,0,0,0,0,211,242,0,0,228,242,0,0,47,3,0,0,
+0,0,0,0,245,242,0,0,249,242,0,0,56,3,0,0,0,0,0,0,
+8,243,0,0,12,243,0,0,72,3,0,0,0,0,0,0,26,243,0,0,
+34,243,0,0,89,3,0,0,0,0,0,0,48,243,0,0,54,243,0,0,
+90,3,0,0,0,0,0,0,62,243,0,0,66,243,0,0,91,3,0,0,
+0,0,0,0,76,243,0,0,87,243,0,0,92,3,0,0,0,0,0,0,
+91,243,0,0,94,243,0,0,93,3,0,0,0,0,0,0,120,243,0,0,
+126,243,0,0,94,3,0,0,0,0,0,0,142,243,0,0,155,243,0,0,
+95,3,0,0,0,0,0,0,167,243,0,0,171,243,0,0,96,3,0,0,
+0,0,0,0,177,243,0,0,180,243,0,0,97,3,0,0,0,0,0,0,
+186,243,0,0,191,243,0,0,98,3,0,0,0,0,0,0,202,243,0,0,
+215,243,0,0,99,3,0,0,0,0,0,0,224,243,0,0,232,243,0,0,
+100,3,0,0,0,0,0,0,245,243,0,0,251,243,0,0,105,3,0,0,
+0,0,0,0,21,244,0,0,27,244,0,0,106,3,0,0,0,0,0,0,
+53,244,0,0,59,244,0,0,107,3,0,0,0,0,0,0,85,244,0,0,
+91,244,0,0,108,3,0,0,0,0,0,0,117,244,0,0,123,244,0,0,
+109,3,0,0,0,0,0,0,149,244,0,0,155,244,0,0,110,3,0,0,
+0,0,0,0,181,244,0,0,187,244,0,0,111,3,0,0,0,0,0,0,
+213,244,0,0,219,244,0,0,112,3,0,0,0,0,0,0,245,244,0,0,
+252,244,0,0,113,3,0,0,0,0,0,0,22,245,0,0,29,245,0,0,
+114,3,0,0,0,0,0,0,55,245,0,0,62,245,0,0,115,3,0,0,
+0,0,0,0,88,245,0,0,95,245,0,0,116,3,0,0,0,0,0,0,
+121,245,0,0,128,245,0,0,117,3,0,0,0,0,0,0,154,245,0,0,
+161,245,0,0,118,3,0,0,0,0,0,0,187,245,0,0,195,245,0,0,
+119,3,0,0,0,0,0,0,221,245,0,0,231,245,0,0,123,3,0,0,
+0,0,0,0,250,245,0,0,254,245,0,0,124,3,0,0,0,0,0,0,
+10,246,0,0,16,246,0,0,135,3,0,0,0,0,0,0,32,246,0,0,
+43,246,0,0,143,3,0,0,0,0,0,0,66,246,0,0,72,246,0,0,
+144,3,0,0,0,0,0,0,82,246,0,0,93,246,0,0,148,3,0,0,
+0,0,0,0,107,246,0,0,111,246,0,0,149,3,0,0,0,0,0,0,
+122,246,0,0,133,246,0,0,150,3,0,0,0,0,0,0,155,246,0,0,
+159,246,0,0,151,3,0,0,0,0,0,0,170,246,0,0,183,246,0,0,
+152,3,0,0,0,0,0,0,196,246,0,0,200,246,0,0,153,3,0,0,
+0,0,0,0,213,246,0,0,226,246,0,0,157,3,0,0,0,0,0,0,
+244,246,0,0,248,246,0,0,158,3,0,0,0,0,0,0,5,247,0,0,
+16,247,0,0,159,3,0,0,0,0,0,0,32,247,0,0,36,247,0,0,
+160,3,0,0,0,0,0,0,47,247,0,0,59,247,0,0,161,3,0,0,
+0,0,0,0,75,247,0,0,79,247,0,0,162,3,0,0,0,0,0,0,
+91,247,0,0,100,247,0,0,163,3,0,0,0,0,0,0,115,247,0,0,
+120,247,0,0,164,3,0,0,0,0,0,0,129,247,0,0,142,247,0,0,
+165,3,0,0,0,0,0,0,159,247,0,0,163,247,0,0,166,3,0,0,
+0,0,0,0,176,247,0,0,194,247,0,0,167,3,0,0,0,0,0,0,
+211,247,0,0,219,247,0,0,168,3,0,0,0,0,0,0,237,247,0,0,
+0,248,0,0,173,3,0,0,0,0,0,0,10,248,0,0,19,248,0,0,
+174,3,0,0,0,0,0,0,38,248,0,0,55,248,0,0,175,3,0,0,
+0,0,0,0,65,248,0,0,76,248,0,0,176,3,0,0,0,0,0,0,
+93,248,0,0,111,248,0,0,177,3,0,0,0,0,0,0,121,248,0,0,
+132,248,0,0,178,3,0,0,0,0,0,0,150,248,0,0,163,248,0,0,
+182,3,0,0,0,0,0,0,187,248,0,0,192,248,0,0,183,3,0,0,
+0,0,0,0,205,248,0,0,221,248,0,0,184,3,0,0,0,0,0,0,
+244,248,0,0,249,248,0,0,185,3,0,0,0,0,0,0,9,249,0,0,
+15,249,0,0,186,3,0,0,0,0,0,0,34,249,0,0,39,249,0,0,
+187,3,0,0,0,0,0,0,59,249,0,0,64,249,0,0,188,3,0,0,
+0,0,0,0,83,249,0,0,88,249,0,0,189,3,0,0,0,0,0,0,
+107,249,0,0,112,249,0,0,190,3,0,0,0,0,0,0,132,249,0,0,
+136,249,0,0,196,3,0,0,0,0,0,0,145,249,0,0,165,249,0,0,
+197,3,0,0,0,0,0,0,176,249,0,0,179,249,0,0,198,3,0,0,
+0,0,0,0,199,249,0,0,203,249,0,0,199,3,0,0,0,0,0,0,
+215,249,0,0,220,249,0,0,200,3,0,0,0,0,0,0,226,249,0,0,
+231,249,0,0,201,3,0,0,0,0,0,0,236,249,0,0,240,249,0,0,
+202,3,0,0,0,0,0,0,243,249,0,0,248,249,0,0,205,3,0,0,
+0,0,0,0,0,250,0,0,6,250,0,0,206,3,0,0,0,0,0,0,
+17,250,0,0,23,250,0,0,207,3,0,0,0,0,0,0,32,250,0,0,
+35,250,0,0,208,3,0,0,0,0,0,0,39,250,0,0,52,250,0,0,
+209,3,0,0,0,0,0,0,55,250,0,0,65,250,0,0,210,3,0,0,
+0,0,0,0,78,250,0,0,81,250,0,0,211,3,0,0,0,0,0,0,
+91,250,0,0,103,250,0,0,212,3,0,0,0,0,0,0,107,250,0,0,
+119,250,0,0,213,3,0,0,0,0,0,0,125,250,0,0,132,250,0,0,
+214,3,0,0,0,0,0,0,149,250,0,0,152,250,0,0,215,3,0,0,
+0,0,0,0,159,250,0,0,167,250,0,0,223,3,0,0,0,0,0,0,
+181,250,0,0,187,250,0,0,224,3,0,0,0,0,0,0,201,250,0,0,
+214,250,0,0,227,3,0,0,0,0,0,0,226,250,0,0,233,250,0,0,
+228,3,0,0,0,0,0,0,250,250,0,0,2,251,0,0,229,3,0,0,
+0,0,0,0,21,251,0,0,27,251,0,0,232,3,0,0,0,0,0,0,
+36,251,0,0,42,251,0,0,233,3,0,0,0,0,0,0,48,251,0,0,
+59,251,0,0,234,3,0,0,0,0,0,0,65,251,0,0,74,251,0,0,
+235,3,0,0,0,0,0,0,92,251,0,0,97,251,0,0,241,3,0,0,
+0,0,0,0,111,251,0,0,115,251,0,0,242,3,0,0,0,0,0,0,
+120,251,0,0,124,251,0,0,243,3,0,0,0,0,0,0,132,251,0,0,
+138,251,0,0,244,3,0,0,0,0,0,0,150,251,0,0,152,251,0,0,
+245,3,0,0,0,0,0,0,158,251,0,0,162,251,0,0,246,3,0,0,
+0,0,0,0,169,251,0,0,176,251,0,0,247,3,0,0,0,0,0,0,
+185,251,0,0,188,251,0,0,248,3,0,0,0,0,0,0,195,251,0,0,
+201,251,0,0,249,3,0,0,0,0,0,0,208,251,0,0,215,251,0,0,
+250,3,0,0,0,0,0,0,222,251,0,0,226,251,0,0,251,3,0,0,
+0,0,0,0,235,251,0,0,243,251,0,0,252,3,0,0,0,0,0,0,
+247,251,0,0,253,251,0,0,1,4,0,0,0,0,0,0,7,252,0,0,
+13,252,0,0,2,4,0,0,0,0,0,0,19,252,0,0,26,252,0,0,
+3,4,0,0,0,0,0,0,31,252,0,0,38,252,0,0,4,4,0,0,
+0,0,0,0,45,252,0,0,50,252,0,0,5,4,0,0,0,0,0,0,
+55,252,0,0,60,252,0,0,6,4,0,0,0,0,0,0,69,252,0,0,
+74,252,0,0,7,4,0,0,0,0,0,0,85,252,0,0,90,252,0,0,
+8,4,0,0,0,0,0,0,110,252,0,0,116,252,0,0,10,4,0,0,
+0,0,0,0,140,252,0,0,145,252,0,0,18,4,0,0,0,0,0,0,
+156,252,0,0,166,252,0,0,19,4,0,0,0,0,0,0,171,252,0,0,
+185,252,0,0,20,4,0,0,0,0,0,0,196,252,0,0,210,252,0,0,
+21,4,0,0,0,0,0,0,223,252,0,0,227,252,0,0,24,4,0,0,
+0,0,0,0,241,252,0,0,246,252,0,0,25,4,0,0,0,0,0,0,
+3,253,0,0,10,253,0,0,26,4,0,0,0,0,0,0,22,253,0,0,
+31,253,0,0,31,4,0,0,0,0,0,0,36,253,0,0,42,253,0,0,
+32,4,0,0,0,0,0,0,51,253,0,0,54,253,0,0,33,4,0,0,
+0,0,0,0,63,253,0,0,68,253,0,0,34,4,0,0,0,0,0,0,
+71,253,0,0,74,253,0,0,35,4,0,0,0,0,0,0,79,253,0,0,
+89,253,0,0,36,4,0,0,0,0,0,0,99,253,0,0,106,253,0,0,
+37,4,0,0,0,0,0,0,116,253,0,0,124,253,0,0,38,4,0,0,
+0,0,0,0,146,253,0,0,154,253,0,0,39,4,0,0,0,0,0,0,
+173,253,0,0,180,253,0,0,40,4,0,0,0,0,0,0,201,253,0,0,
+207,253,0,0,41,4,0,0,0,0,0,0,222,253,0,0,228,253,0,0,
+42,4,0,0,0,0,0,0,235,253,0,0,241,253,0,0,43,4,0,0,
+0,0,0,0,3,254,0,0,6,254,0,0,44,4,0,0,0,0,0,0,
+12,254,0,0,20,254,0,0,45,4,0,0,0,0,0,0,31,254,0,0,
+34,254,0,0,46,4,0,0,0,0,0,0,42,254,0,0,50,254,0,0,
+47,4,0,0,0,0,0,0,62,254,0,0,65,254,0,0,48,4,0,0,
+0,0,0,0,73,254,0,0,81,254,0,0,49,4,0,0,0,0,0,0,
+96,254,0,0,99,254,0,0,50,4,0,0,0,0,0,0,107,254,0,0,
+110,254,0,0,51,4,0,0,0,0,0,0,118,254,0,0,127,254,0,0,
+52,4,0,0,0,0,0,0,140,254,0,0,144,254,0,0,53,4,0,0,
+0,0,0,0,154,254,0,0,165,254,0,0,67,4,0,0,0,0,0,0,
+179,254,0,0,187,254,0,0,68,4,0,0,0,0,0,0,198,254,0,0,
+207,254,0,0,69,4,0,0,0,0,0,0,229,254,0,0,241,254,0,0,
+70,4,0,0,0,0,0,0,251,254,0,0,255,254,0,0,71,4,0,0,
+0,0,0,0,11,255,0,0,20,255,0,0,72,4,0,0,0,0,0,0,
+32,255,0,0,42,255,0,0,73,4,0,0,0,0,0,0,65,255,0,0,
+79,255,0,0,74,4,0,0,0,0,0,0,89,255,0,0,99,255,0,0,
+75,4,0,0,0,0,0,0,122,255,0,0,130,255,0,0,76,4,0,0,
+0,0,0,0,149,255,0,0,157,255,0,0,77,4,0,0,0,0,0,0,
+166,255,0,0,178,255,0,0,78,4,0,0,0,0,0,0,191,255,0,0,
+200,255,0,0,79,4,0,0,0,0,0,0,212,255,0,0,218,255,0,0,
+80,4,0,0,0,0,0,0,236,255,0,0,246,255,0,0,81,4,0,0,
+0,0,0,0,7,0,1,0,11,0,1,0,82,4,0,0,0,0,0,0,
+26,0,1,0,36,0,1,0,88,4,0,0,0,0,0,0,47,0,1,0,
+54,0,1,0,89,4,0,0,0,0,0,0,64,0,1,0,73,0,1,0,
+92,4,0,0,0,0,0,0,84,0,1,0,92,0,1,0,93,4,0,0,
+0,0,0,0,102,0,1,0,109,0,1,0,94,4,0,0,0,0,0,0,
+122,0,1,0,130,0,1,0,98,4,0,0,0,0,0,0,138,0,1,0,
+146,0,1,0,100,4,0,0,0,0,0,0,156,0,1,0,169,0,1,0,
+101,4,0,0,0,0,0,0,179,0,1,0,192,0,1,0,102,4,0,0,
+0,0,0,0,202,0,1,0,211,0,1,0,110,4,0,0,0,0,0,0,
+224,0,1,0,236,0,1,0,111,4,0,0,0,0,0,0,247,0,1,0,
+10,1,1,0,118,4,0,0,0,0,0,0,18,1,1,0,32,1,1,0,
+119,4,0,0,0,0,0,0,38,1,1,0,54,1,1,0,120,4,0,0,
+0,0,0,0,61,1,1,0,73,1,1,0,121,4,0,0,0,0,0,0,
+77,1,1,0,86,1,1,0,122,4,0,0,0,0,0,0,90,1,1,0,
+97,1,1,0,124,4,0,0,0,0,0,0,110,1,1,0,121,1,1,0,
+125,4,0,0,0,0,0,0,132,1,1,0,145,1,1,0,126,4,0,0,
+0,0,0,0,156,1,1,0,163,1,1,0,127,4,0,0,0,0,0,0,
+172,1,1,0,178,1,1,0,131,4,0,0,0,0,0,0,184,1,1,0,
+187,1,1,0,132,4,0,0,0,0,0,0,193,1,1,0,200,1,1,0,
+134,4,0,0,0,0,0,0,208,1,1,0,216,1,1,0,135,4,0,0,
+0,0,0,0,223,1,1,0,230,1,1,0,136,4,0,0,0,0,0,0,
+237,1,1,0,241,1,1,0,141,4,0,0,0,0,0,0,248,1,1,0,
+251,1,1,0,142,4,0,0,0,0,0,0,255,1,1,0,4,2,1,0,
+143,4,0,0,0,0,0,0,17,2,1,0,20,2,1,0,144,4,0,0,
+0,0,0,0,25,2,1,0,36,2,1,0,145,4,0,0,0,0,0,0,
+47,2,1,0,59,2,1,0,147,4,0,0,0,0,0,0,69,2,1,0,
+73,2,1,0,150,4,0,0,0,0,0,0,87,2,1,0,91,2,1,0,
+153,4,0,0,0,0,0,0,100,2,1,0,105,2,1,0,154,4,0,0,
+0,0,0,0,119,2,1,0,129,2,1,0,158,4,0,0,0,0,0,0,
+133,2,1,0,137,2,1,0,160,4,0,0,0,0,0,0,144,2,1,0,
+150,2,1,0,161,4,0,0,0,0,0,0,160,2,1,0,163,2,1,0,
+162,4,0,0,0,0,0,0,169,2,1,0,178,2,1,0,164,4,0,0,
+0,0,0,0,188,2,1,0,192,2,1,0,165,4,0,0,0,0,0,0,
+201,2,1,0,209,2,1,0,166,4,0,0,0,0,0,0,218,2,1,0,
+232,2,1,0,174,4,0,0,0,0,0,0,244,2,1,0,3,3,1,0,
+175,4,0,0,0,0,0,0,16,3,1,0,24,3,1,0,176,4,0,0,
+0,0,0,0,37,3,1,0,49,3,1,0,177,4,0,0,0,0,0,0,
+62,3,1,0,69,3,1,0,188,4,0,0,0,0,0,0,82,3,1,0,
+91,3,1,0,189,4,0,0,0,0,0,0,101,3,1,0,112,3,1,0,
+190,4,0,0,0,0,0,0,121,3,1,0,130,3,1,0,191,4,0,0,
+0,0,0,0,141,3,1,0,148,3,1,0,192,4,0,0,0,0,0,0,
+160,3,1,0,169,3,1,0,193,4,0,0,0,0,0,0,181,3,1,0,
+189,3,1,0,194,4,0,0,0,0,0,0,201,3,1,0,206,3,1,0,
+228,4,0,0,0,0,0,0,226,3,1,0,232,3,1,0,232,4,0,0,
+0,0,0,0,252,3,1,0,2,4,1,0,233,4,0,0,0,0,0,0,
+22,4,1,0,27,4,1,0,237,4,0,0,0,0,0,0,41,4,1,0,
+46,4,1,0,18,5,0,0,0,0,0,0,53,4,1,0,69,4,1,0,
+20,5,0,0,0,0,0,0,83,4,1,0,96,4,1,0,23,5,0,0,
+0,0,0,0,114,4,1,0,127,4,1,0,26,5,0,0,0,0,0,0,
+145,4,1,0,157,4,1,0,41,5,0,0,0,0,0,0,169,4,1,0,
+175,4,1,0,52,5,0,0,0,0,0,0,192,4,1,0,204,4,1,0,
+65,5,0,0,0,0,0,0,218,4,1,0,231,4,1,0,66,5,0,0,
+0,0,0,0,248,4,1,0,7,5,1,0,67,5,0,0,0,0,0,0,
+25,5,1,0,40,5,1,0,68,5,0,0,0,0,0,0,60,5,1,0,
+77,5,1,0,79,5,0,0,0,0,0,0,93,5,1,0,106,5,1,0,
+81,5,0,0,0,0,0,0,121,5,1,0,135,5,1,0,82,5,0,0,
+0,0,0,0,148,5,1,0,164,5,1,0,83,5,0,0,0,0,0,0,
+177,5,1,0,191,5,1,0,86,5,0,0,0,0,0,0,205,5,1,0,
+216,5,1,0,88,5,0,0,0,0,0,0,6,6,1,0,19,6,1,0,
+90,5,0,0,0,0,0,0,30,6,1,0,39,6,1,0,91,5,0,0,
+0,0,0,0,52,6,1,0,57,6,1,0,92,5,0,0,0,0,0,0,
+71,6,1,0,78,6,1,0,93,5,0,0,0,0,0,0,88,6,1,0,
+93,6,1,0,97,5,0,0,0,0,0,0,106,6,1,0,109,6,1,0,
+98,5,0,0,0,0,0,0,114,6,1,0,120,6,1,0,99,5,0,0,
+0,0,0,0,130,6,1,0,133,6,1,0,100,5,0,0,0,0,0,0,
+139,6,1,0,147,6,1,0,101,5,0,0,0,0,0,0,155,6,1,0,
+162,6,1,0,106,5,0,0,0,0,0,0,171,6,1,0,179,6,1,0,
+107,5,0,0,0,0,0,0,189,6,1,0,200,6,1,0,108,5,0,0,
+0,0,0,0,211,6,1,0,221,6,1,0,109,5,0,0,0,0,0,0,
+232,6,1,0,242,6,1,0,110,5,0,0,0,0,0,0,247,6,1,0,
+1,7,1,0,111,5,0,0,0,0,0,0,15,7,1,0,28,7,1,0,
+112,5,0,0,0,0,0,0,36,7,1,0,47,7,1,0,113,5,0,0,
+0,0,0,0,55,7,1,0,64,7,1,0,114,5,0,0,0,0,0,0,
+72,7,1,0,83,7,1,0,115,5,0,0,0,0,0,0,94,7,1,0,
+108,7,1,0,116,5,0,0,0,0,0,0,121,7,1,0,133,7,1,0,
+117,5,0,0,0,0,0,0,141,7,1,0,157,7,1,0,118,5,0,0,
+0,0,0,0,165,7,1,0,178,7,1,0,128,5,0,0,0,0,0,0,
+195,7,1,0,206,7,1,0,140,5,0,0,0,0,0,0,218,7,1,0,
+227,7,1,0,141,5,0,0,0,0,0,0,238,7,1,0,247,7,1,0,
+142,5,0,0,0,0,0,0,3,8,1,0,11,8,1,0,143,5,0,0,
+0,0,0,0,26,8,1,0,37,8,1,0,144,5,0,0,0,0,0,0,
+49,8,1,0,59,8,1,0,145,5,0,0,0,0,0,0,70,8,1,0,
+80,8,1,0,146,5,0,0,0,0,0,0,89,8,1,0,100,8,1,0,
+147,5,0,0,0,0,0,0,110,8,1,0,119,8,1,0,148,5,0,0,
+0,0,0,0,130,8,1,0,142,8,1,0,155,5,0,0,0,0,0,0,
+163,8,1,0,173,8,1,0,156,5,0,0,0,0,0,0,195,8,1,0,
+205,8,1,0,157,5,0,0,0,0,0,0,218,8,1,0,227,8,1,0,
+158,5,0,0,0,0,0,0,248,8,1,0,4,9,1,0,159,5,0,0,
+0,0,0,0,25,9,1,0,36,9,1,0,160,5,0,0,0,0,0,0,
+57,9,1,0,68,9,1,0,161,5,0,0,0,0,0,0,89,9,1,0,
+101,9,1,0,162,5,0,0,0,0,0,0,122,9,1,0,132,9,1,0,
+163,5,0,0,0,0,0,0,153,9,1,0,169,9,1,0,172,5,0,0,
+0,0,0,0,181,9,1,0,204,9,1,0,173,5,0,0,0,0,0,0,
+217,9,1,0,235,9,1,0,174,5,0,0,0,0,0,0,23,10,1,0,
+32,10,1,0,176,5,0,0,0,0,0,0,47,10,1,0,57,10,1,0,
+177,5,0,0,0,0,0,0,72,10,1,0,83,10,1,0,179,5,0,0,
+0,0,0,0,91,10,1,0,101,10,1,0,180,5,0,0,0,0,0,0,
+110,10,1,0,118,10,1,0,206,5,0,0,0,0,0,0,132,10,1,0,
+145,10,1,0,208,5,0,0,0,0,0,0,167,10,1,0,184,10,1,0,
+212,5,0,0,0,0,0,0,211,10,1,0,214,10,1,0,213,5,0,0,
+0,0,0,0,231,10,1,0,241,10,1,0,216,5,0,0,0,0,0,0,
+254,10,1,0,6,11,1,0,217,5,0,0,0,0,0,0,16,11,1,0,
+24,11,1,0,220,5,0,0,0,0,0,0,40,11,1,0,49,11,1,0,
+221,5,0,0,0,0,0,0,59,11,1,0,72,11,1,0,222,5,0,0,
+0,0,0,0,83,11,1,0,95,11,1,0,223,5,0,0,0,0,0,0,
+106,11,1,0,118,11,1,0,233,5,0,0,0,0,0,0,138,11,1,0,
+148,11,1,0,234,5,0,0,0,0,0,0,170,11,1,0,184,11,1,0,
+235,5,0,0,0,0,0,0,206,11,1,0,215,11,1,0,236,5,0,0,
+0,0,0,0,235,11,1,0,247,11,1,0,237,5,0,0,0,0,0,0,
+13,12,1,0,24,12,1,0,238,5,0,0,0,0,0,0,45,12,1,0,
+56,12,1,0,239,5,0,0,0,0,0,0,77,12,1,0,89,12,1,0,
+240,5,0,0,0,0,0,0,110,12,1,0,120,12,1,0,241,5,0,0,
+0,0,0,0,139,12,1,0,158,12,1,0,243,5,0,0,0,0,0,0,
+170,12,1,0,180,12,1,0,244,5,0,0,0,0,0,0,222,12,1,0,
+231,12,1,0,245,5,0,0,0,0,0,0,4,13,1,0,19,13,1,0,
+250,5,0,0,0,0,0,0,33,13,1,0,46,13,1,0,251,5,0,0,
+0,0,0,0,59,13,1,0,71,13,1,0,252,5,0,0,0,0,0,0,
+85,13,1,0,100,13,1,0,253,5,0,0,0,0,0,0,113,13,1,0,
+127,13,1,0,254,5,0,0,0,0,0,0,139,13,1,0,153,13,1,0,
+255,5,0,0,0,0,0,0,166,13,1,0,181,13,1,0,0,6,0,0,
+0,0,0,0,194,13,1,0,207,13,1,0,1,6,0,0,0,0,0,0,
+219,13,1,0,233,13,1,0,6,6,0,0,0,0,0,0,241,13,1,0,
+253,13,1,0,7,6,0,0,0,0,0,0,8,14,1,0,20,14,1,0,
+8,6,0,0,0,0,0,0,31,14,1,0,42,14,1,0,9,6,0,0,
+0,0,0,0,53,14,1,0,67,14,1,0,10,6,0,0,0,0,0,0,
+76,14,1,0,89,14,1,0,11,6,0,0,0,0,0,0,98,14,1,0,
+111,14,1,0,12,6,0,0,0,0,0,0,120,14,1,0,134,14,1,0,
+13,6,0,0,0,0,0,0,143,14,1,0,155,14,1,0,14,6,0,0,
+0,0,0,0,163,14,1,0,175,14,1,0,16,6,0,0,0,0,0,0,
+186,14,1,0,197,14,1,0,25,6,0,0,0,0,0,0,210,14,1,0,
+223,14,1,0,26,6,0,0,0,0,0,0,225,14,1,0,238,14,1,0,
+27,6,0,0,0,0,0,0,243,14,1,0,0,15,1,0,31,6,0,0,
+0,0,0,0,11,15,1,0,22,15,1,0,32,6,0,0,0,0,0,0,
+59,15,1,0,74,15,1,0,34,6,0,0,0,0,0,0,100,15,1,0,
+113,15,1,0,35,6,0,0,0,0,0,0,131,15,1,0,139,15,1,0,
+36,6,0,0,0,0,0,0,152,15,1,0,160,15,1,0,37,6,0,0,
+0,0,0,0,168,15,1,0,183,15,1,0,43,6,0,0,0,0,0,0,
+187,15,1,0,201,15,1,0,44,6,0,0,0,0,0,0,205,15,1,0,
+218,15,1,0,45,6,0,0,0,0,0,0,224,15,1,0,235,15,1,0,
+46,6,0,0,0,0,0,0,241,15,1,0,249,15,1,0,47,6,0,0,
+0,0,0,0,4,16,1,0,17,16,1,0,48,6,0,0,0,0,0,0,
+27,16,1,0,39,16,1,0,49,6,0,0,0,0,0,0,41,16,1,0,
+44,16,1,0,70,6,0,0,0,0,0,0,59,16,1,0,63,16,1,0,
+74,6,0,0,0,0,0,0,78,16,1,0,83,16,1,0,77,6,0,0,
+0,0,0,0,91,16,1,0,94,16,1,0,78,6,0,0,0,0,0,0,
+99,16,1,0,104,16,1,0,79,6,0,0,0,0,0,0,112,16,1,0,
+117,16,1,0,80,6,0,0,0,0,0,0,122,16,1,0,125,16,1,0,
+81,6,0,0,0,0,0,0,130,16,1,0,135,16,1,0,82,6,0,0,
+0,0,0,0,140,16,1,0,143,16,1,0,83,6,0,0,0,0,0,0,
+148,16,1,0,153,16,1,0,84,6,0,0,0,0,0,0,161,16,1,0,
+166,16,1,0,88,6,0,0,0,0,0,0,176,16,1,0,180,16,1,0,
+89,6,0,0,0,0,0,0,189,16,1,0,195,16,1,0,90,6,0,0,
+0,0,0,0,199,16,1,0,207,16,1,0,91,6,0,0,0,0,0,0,
+214,16,1,0,226,16,1,0,92,6,0,0,0,0,0,0,231,16,1,0,
+238,16,1,0,93,6,0,0,0,0,0,0,245,16,1,0,4,17,1,0,
+97,6,0,0,0,0,0,0,16,17,1,0,28,17,1,0,98,6,0,0,
+0,0,0,0,43,17,1,0,57,17,1,0,99,6,0,0,0,0,0,0,
+76,17,1,0,90,17,1,0,100,6,0,0,0,0,0,0,111,17,1,0,
+117,17,1,0,101,6,0,0,0,0,0,0,123,17,1,0,128,17,1,0,
+102,6,0,0,0,0,0,0,140,17,1,0,143,17,1,0,103,6,0,0,
+0,0,0,0,149,17,1,0,156,17,1,0,104,6,0,0,0,0,0,0,
+173,17,1,0,181,17,1,0,105,6,0,0,0,0,0,0,192,17,1,0,
+204,17,1,0,106,6,0,0,0,0,0,0,220,17,1,0,231,17,1,0,
+107,6,0,0,0,0,0,0,249,17,1,0,1,18,1,0,108,6,0,0,
+0,0,0,0,8,18,1,0,17,18,1,0,109,6,0,0,0,0,0,0,
+28,18,1,0,38,18,1,0,110,6,0,0,0,0,0,0,47,18,1,0,
+60,18,1,0,112,6,0,0,0,0,0,0,75,18,1,0,90,18,1,0,
+114,6,0,0,0,0,0,0,97,18,1,0,111,18,1,0,115,6,0,0,
+0,0,0,0,132,18,1,0,146,18,1,0,116,6,0,0,0,0,0,0,
+161,18,1,0,174,18,1,0,117,6,0,0,0,0,0,0,188,18,1,0,
+200,18,1,0,119,6,0,0,0,0,0,0,208,18,1,0,219,18,1,0,
+120,6,0,0,0,0,0,0,236,18,1,0,246,18,1,0,122,6,0,0,
+0,0,0,0,254,18,1,0,7,19,1,0,123,6,0,0,0,0,0,0,
+22,19,1,0,29,19,1,0,130,6,0,0,0,0,0,0,34,19,1,0,
+47,19,1,0,133,6,0,0,0,0,0,0,54,19,1,0,60,19,1,0,
+141,6,0,0,0,0,0,0,78,19,1,0,87,19,1,0,142,6,0,0,
+0,0,0,0,93,19,1,0,105,19,1,0,143,6,0,0,0,0,0,0,
+111,19,1,0,119,19,1,0,144,6,0,0,0,0,0,0,132,19,1,0,
+148,19,1,0,145,6,0,0,0,0,0,0,157,19,1,0,170,19,1,0,
+146,6,0,0,0,0,0,0,185,19,1,0,202,19,1,0,147,6,0,0,
+0,0,0,0,217,19,1,0,222,19,1,0,148,6,0,0,0,0,0,0,
+240,19,1,0,246,19,1,0,149,6,0,0,0,0,0,0,249,19,1,0,
+255,19,1,0,150,6,0,0,0,0,0,0,5,20,1,0,11,20,1,0,
+154,6,0,0,0,0,0,0,25,20,1,0,28,20,1,0,155,6,0,0,
+0,0,0,0,34,20,1,0,40,20,1,0,156,6,0,0,0,0,0,0,
+53,20,1,0,59,20,1,0,161,6,0,0,0,0,0,0,70,20,1,0,
+73,20,1,0,162,6,0,0,0,0,0,0,79,20,1,0,84,20,1,0,
+163,6,0,0,0,0,0,0,95,20,1,0,98,20,1,0,164,6,0,0,
+0,0,0,0,103,20,1,0,119,20,1,0,165,6,0,0,0,0,0,0,
+130,20,1,0,134,20,1,0,166,6,0,0,0,0,0,0,148,20,1,0,
+167,20,1,0,167,6,0,0,0,0,0,0,183,20,1,0,189,20,1,0,
+168,6,0,0,0,0,0,0,198,20,1,0,207,20,1,0,169,6,0,0,
+0,0,0,0,215,20,1,0,229,20,1,0,170,6,0,0,0,0,0,0,
+239,20,1,0,2,21,1,0,171,6,0,0,0,0,0,0,15,21,1,0,
+28,21,1,0,172,6,0,0,0,0,0,0,47,21,1,0,57,21,1,0,
+177,6,0,0,0,0,0,0,68,21,1,0,78,21,1,0,178,6,0,0,
+0,0,0,0,93,21,1,0,97,21,1,0,179,6,0,0,0,0,0,0,
+107,21,1,0,119,21,1,0,180,6,0,0,0,0,0,0,134,21,1,0,
+138,21,1,0,181,6,0,0,0,0,0,0,150,21,1,0,159,21,1,0,
+184,6,0,0,0,0,0,0,178,21,1,0,189,21,1,0,185,6,0,0,
+0,0,0,0,210,21,1,0,221,21,1,0,186,6,0,0,0,0,0,0,
+242,21,1,0,252,21,1,0,187,6,0,0,0,0,0,0,6,22,1,0,
+18,22,1,0,191,6,0,0,0,0,0,0,27,22,1,0,39,22,1,0,
+192,6,0,0,0,0,0,0,45,22,1,0,51,22,1,0,193,6,0,0,
+0,0,0,0,63,22,1,0,66,22,1,0,194,6,0,0,0,0,0,0,
+72,22,1,0,86,22,1,0,195,6,0,0,0,0,0,0,98,22,1,0,
+115,22,1,0,196,6,0,0,0,0,0,0,127,22,1,0,133,22,1,0,
+197,6,0,0,0,0,0,0,144,22,1,0,152,22,1,0,204,6,0,0,
+0,0,0,0,162,22,1,0,170,22,1,0,205,6,0,0,0,0,0,0,
+180,22,1,0,187,22,1,0,206,6,0,0,0,0,0,0,199,22,1,0,
+209,22,1,0,207,6,0,0,0,0,0,0,220,22,1,0,229,22,1,0,
+211,6,0,0,0,0,0,0,238,22,1,0,242,22,1,0,212,6,0,0,
+0,0,0,0,249,22,1,0,255,22,1,0,213,6,0,0,0,0,0,0,
+10,23,1,0,15,23,1,0,214,6,0,0,0,0,0,0,25,23,1,0,
+30,23,1,0,215,6,0,0,0,0,0,0,39,23,1,0,47,23,1,0,
+216,6,0,0,0,0,0,0,60,23,1,0,67,23,1,0,217,6,0,0,
+0,0,0,0,79,23,1,0,86,23,1,0,218,6,0,0,0,0,0,0,
+97,23,1,0,110,23,1,0,219,6,0,0,0,0,0,0,122,23,1,0,
+132,23,1,0,220,6,0,0,0,0,0,0,143,23,1,0,155,23,1,0,
+221,6,0,0,0,0,0,0,170,23,1,0,173,23,1,0,222,6,0,0,
+0,0,0,0,179,23,1,0,182,23,1,0,223,6,0,0,0,0,0,0,
+187,23,1,0,192,23,1,0,224,6,0,0,0,0,0,0,203,23,1,0,
+210,23,1,0,225,6,0,0,0,0,0,0,223,23,1,0,228,23,1,0,
+226,6,0,0,0,0,0,0,238,23,1,0,251,23,1,0,227,6,0,0,
+0,0,0,0,9,24,1,0,22,24,1,0,228,6,0,0,0,0,0,0,
+33,24,1,0,41,24,1,0,229,6,0,0,0,0,0,0,55,24,1,0,
+63,24,1,0,230,6,0,0,0,0,0,0,75,24,1,0,83,24,1,0,
+231,6,0,0,0,0,0,0,95,24,1,0,111,24,1,0,232,6,0,0,
+0,0,0,0,123,24,1,0,130,24,1,0,233,6,0,0,0,0,0,0,
+146,24,1,0,150,24,1,0,234,6,0,0,0,0,0,0,157,24,1,0,
+168,24,1,0,235,6,0,0,0,0,0,0,183,24,1,0,192,24,1,0,
+236,6,0,0,0,0,0,0,201,24,1,0,210,24,1,0,241,6,0,0,
+0,0,0,0,223,24,1,0,226,24,1,0,242,6,0,0,0,0,0,0,
+233,24,1,0,238,24,1,0,243,6,0,0,0,0,0,0,249,24,1,0,
+0,25,1,0,244,6,0,0,0,0,0,0,13,25,1,0,20,25,1,0,
+245,6,0,0,0,0,0,0,33,25,1,0,36,25,1,0,246,6,0,0,
+0,0,0,0,41,25,1,0,51,25,1,0,247,6,0,0,0,0,0,0,
+62,25,1,0,71,25,1,0,248,6,0,0,0,0,0,0,85,25,1,0,
+93,25,1,0,249,6,0,0,0,0,0,0,106,25,1,0,116,25,1,0,
+250,6,0,0,0,0,0,0,126,25,1,0,142,25,1,0,253,6,0,0,
+0,0,0,0,152,25,1,0,165,25,1,0,254,6,0,0,0,0,0,0,
+180,25,1,0,192,25,1,0,24,7,0,0,0,0,0,0,198,25,1,0,
+212,25,1,0,25,7,0,0,0,0,0,0,218,25,1,0,229,25,1,0,
+26,7,0,0,0,0,0,0,235,25,1,0,245,25,1,0,27,7,0,0,
+0,0,0,0,251,25,1,0,8,26,1,0,28,7,0,0,0,0,0,0,
+14,26,1,0,24,26,1,0,29,7,0,0,0,0,0,0,30,26,1,0,
+41,26,1,0,30,7,0,0,0,0,0,0,47,26,1,0,64,26,1,0,
+31,7,0,0,0,0,0,0,70,26,1,0,81,26,1,0,35,7,0,0,
+0,0,0,0,90,26,1,0,97,26,1,0,36,7,0,0,0,0,0,0,
+108,26,1,0,113,26,1,0,37,7,0,0,0,0,0,0,120,26,1,0,
+127,26,1,0,38,7,0,0,0,0,0,0,133,26,1,0,139,26,1,0,
+39,7,0,0,0,0,0,0,152,26,1,0,163,26,1,0,40,7,0,0,
+0,0,0,0,170,26,1,0,180,26,1,0,41,7,0,0,0,0,0,0,
+195,26,1,0,205,26,1,0,42,7,0,0,0,0,0,0,214,26,1,0,
+221,26,1,0,43,7,0,0,0,0,0,0,231,26,1,0,243,26,1,0,
+45,7,0,0,0,0,0,0,250,26,1,0,6,27,1,0,46,7,0,0,
+0,0,0,0,13,27,1,0,25,27,1,0,47,7,0,0,0,0,0,0,
+33,27,1,0,46,27,1,0,51,7,0,0,0,0,0,0,59,27,1,0,
+71,27,1,0,52,7,0,0,0,0,0,0,88,27,1,0,101,27,1,0,
+53,7,0,0,0,0,0,0,114,27,1,0,120,27,1,0,57,7,0,0,
+0,0,0,0,127,27,1,0,136,27,1,0,58,7,0,0,0,0,0,0,
+145,27,1,0,154,27,1,0,59,7,0,0,0,0,0,0,163,27,1,0,
+174,27,1,0,60,7,0,0,0,0,0,0,183,27,1,0,194,27,1,0,
+61,7,0,0,0,0,0,0,203,27,1,0,213,27,1,0,62,7,0,0,
+0,0,0,0,222,27,1,0,237,27,1,0,63,7,0,0,0,0,0,0,
+247,27,1,0,3,28,1,0,70,7,0,0,0,0,0,0,11,28,1,0,
+15,28,1,0,71,7,0,0,0,0,0,0,29,28,1,0,38,28,1,0,
+77,7,0,0,0,0,0,0,48,28,1,0,58,28,1,0,78,7,0,0,
+0,0,0,0,68,28,1,0,83,28,1,0,88,7,0,0,0,0,0,0,
+92,28,1,0,102,28,1,0,89,7,0,0,0,0,0,0,112,28,1,0,
+124,28,1,0,90,7,0,0,0,0,0,0,139,28,1,0,150,28,1,0,
+91,7,0,0,0,0,0,0,165,28,1,0,177,28,1,0,92,7,0,0,
+0,0,0,0,191,28,1,0,206,28,1,0,109,7,0,0,0,0,0,0,
+213,28,1,0,218,28,1,0,115,7,0,0,0,0,0,0,222,28,1,0,
+226,28,1,0,116,7,0,0,0,0,0,0,232,28,1,0,240,28,1,0,
+117,7,0,0,0,0,0,0,247,28,1,0,255,28,1,0,118,7,0,0,
+0,0,0,0,8,29,1,0,18,29,1,0,119,7,0,0,0,0,0,0,
+22,29,1,0,26,29,1,0,120,7,0,0,0,0,0,0,29,29,1,0,
+33,29,1,0,121,7,0,0,0,0,0,0,38,29,1,0,52,29,1,0,
+122,7,0,0,0,0,0,0,68,29,1,0,84,29,1,0,123,7,0,0,
+0,0,0,0,94,29,1,0,114,29,1,0,124,7,0,0,0,0,0,0,
+124,29,1,0,133,29,1,0,125,7,0,0,0,0,0,0,154,29,1,0,
+157,29,1,0,141,7,0,0,0,0,0,0,170,29,1,0,181,29,1,0,
+145,7,0,0,0,0,0,0,204,29,1,0,217,29,1,0,150,7,0,0,
+0,0,0,0,241,29,1,0,252,29,1,0,154,7,0,0,0,0,0,0,
+18,30,1,0,29,30,1,0,160,7,0,0,0,0,0,0,53,30,1,0,
+68,30,1,0,164,7,0,0,0,0,0,0,76,30,1,0,83,30,1,0,
+165,7,0,0,0,0,0,0,103,30,1,0,111,30,1,0,166,7,0,0,
+0,0,0,0,131,30,1,0,145,30,1,0,167,7,0,0,0,0,0,0,
+160,30,1,0,174,30,1,0,168,7,0,0,0,0,0,0,181,30,1,0,
+196,30,1,0,169,7,0,0,0,0,0,0,204,30,1,0,212,30,1,0,
+170,7,0,0,0,0,0,0,220,30,1,0,228,30,1,0,171,7,0,0,
+0,0,0,0,239,30,1,0,245,30,1,0,176,7,0,0,0,0,0,0,
+250,30,1,0,0,31,1,0,177,7,0,0,0,0,0,0,6,31,1,0,
+10,31,1,0,178,7,0,0,0,0,0,0,16,31,1,0,32,31,1,0,
+179,7,0,0,0,0,0,0,52,31,1,0,68,31,1,0,180,7,0,0,
+0,0,0,0,76,31,1,0,94,31,1,0,181,7,0,0,0,0,0,0,
+110,31,1,0,118,31,1,0,182,7,0,0,0,0,0,0,137,31,1,0,
+143,31,1,0,183,7,0,0,0,0,0,0,151,31,1,0,159,31,1,0,
+187,7,0,0,0,0,0,0,171,31,1,0,181,31,1,0,188,7,0,0,
+0,0,0,0,192,31,1,0,205,31,1,0,189,7,0,0,0,0,0,0,
+215,31,1,0,222,31,1,0,190,7,0,0,0,0,0,0,233,31,1,0,
+246,31,1,0,191,7,0,0,0,0,0,0,2,32,1,0,9,32,1,0,
+192,7,0,0,0,0,0,0,22,32,1,0,29,32,1,0,193,7,0,0,
+0,0,0,0,40,32,1,0,47,32,1,0,194,7,0,0,0,0,0,0,
+59,32,1,0,67,32,1,0,195,7,0,0,0,0,0,0,80,32,1,0,
+89,32,1,0,196,7,0,0,0,0,0,0,99,32,1,0,108,32,1,0,
+213,7,0,0,0,0,0,0,120,32,1,0,129,32,1,0,214,7,0,0,
+0,0,0,0,140,32,1,0,155,32,1,0,215,7,0,0,0,0,0,0,
+170,32,1,0,180,32,1,0,216,7,0,0,0,0,0,0,191,32,1,0,
+202,32,1,0,217,7,0,0,0,0,0,0,214,32,1,0,218,32,1,0,
+226,7,0,0,0,0,0,0,229,32,1,0,236,32,1,0,227,7,0,0,
+0,0,0,0,247,32,1,0,1,33,1,0,228,7,0,0,0,0,0,0,
+12,33,1,0,17,33,1,0,229,7,0,0,0,0,0,0,29,33,1,0,
+36,33,1,0,230,7,0,0,0,0,0,0,43,33,1,0,50,33,1,0,
+231,7,0,0,0,0,0,0,63,33,1,0,67,33,1,0,232,7,0,0,
+0,0,0,0,80,33,1,0,89,33,1,0,233,7,0,0,0,0,0,0,
+101,33,1,0,106,33,1,0,234,7,0,0,0,0,0,0,117,33,1,0,
+123,33,1,0,235,7,0,0,0,0,0,0,134,33,1,0,139,33,1,0,
+236,7,0,0,0,0,0,0,150,33,1,0,157,33,1,0,237,7,0,0,
+0,0,0,0,166,33,1,0,175,33,1,0,238,7,0,0,0,0,0,0,
+186,33,1,0,191,33,1,0,239,7,0,0,0,0,0,0,205,33,1,0,
+220,33,1,0,240,7,0,0,0,0,0,0,234,33,1,0,245,33,1,0,
+241,7,0,0,0,0,0,0,4,34,1,0,19,34,1,0,246,7,0,0,
+0,0,0,0,31,34,1,0,42,34,1,0,247,7,0,0,0,0,0,0,
+59,34,1,0,71,34,1,0,248,7,0,0,0,0,0,0,80,34,1,0,
+92,34,1,0,249,7,0,0,0,0,0,0,100,34,1,0,114,34,1,0,
+250,7,0,0,0,0,0,0,122,34,1,0,133,34,1,0,251,7,0,0,
+0,0,0,0,145,34,1,0,161,34,1,0,253,7,0,0,0,0,0,0,
+169,34,1,0,178,34,1,0,0,8,0,0,0,0,0,0,191,34,1,0,
+198,34,1,0,1,8,0,0,0,0,0,0,205,34,1,0,211,34,1,0,
+9,8,0,0,0,0,0,0,222,34,1,0,233,34,1,0,13,8,0,0,
+0,0,0,0,244,34,1,0,249,34,1,0,15,8,0,0,0,0,0,0,
+5,35,1,0,10,35,1,0,20,8,0,0,0,0,0,0,20,35,1,0,
+25,35,1,0,21,8,0,0,0,0,0,0,33,35,1,0,44,35,1,0,
+22,8,0,0,0,0,0,0,54,35,1,0,65,35,1,0,23,8,0,0,
+0,0,0,0,75,35,1,0,79,35,1,0,24,8,0,0,0,0,0,0,
+90,35,1,0,95,35,1,0,26,8,0,0,0,0,0,0,104,35,1,0,
+109,35,1,0,28,8,0,0,0,0,0,0,118,35,1,0,123,35,1,0,
+33,8,0,0,0,0,0,0,132,35,1,0,145,35,1,0,34,8,0,0,
+0,0,0,0,161,35,1,0,168,35,1,0,37,8,0,0,0,0,0,0,
+173,35,1,0,178,35,1,0,38,8,0,0,0,0,0,0,185,35,1,0,
+193,35,1,0,39,8,0,0,0,0,0,0,201,35,1,0,209,35,1,0,
+40,8,0,0,0,0,0,0,220,35,1,0,226,35,1,0,44,8,0,0,
+0,0,0,0,232,35,1,0,239,35,1,0,45,8,0,0,0,0,0,0,
+244,35,1,0,250,35,1,0,46,8,0,0,0,0,0,0,0,36,1,0,
+8,36,1,0,47,8,0,0,0,0,0,0,16,36,1,0,26,36,1,0,
+48,8,0,0,0,0,0,0,35,36,1,0,43,36,1,0,49,8,0,0,
+0,0,0,0,50,36,1,0,64,36,1,0,55,8,0,0,0,0,0,0,
+69,36,1,0,74,36,1,0,57,8,0,0,0,0,0,0,81,36,1,0,
+96,36,1,0,59,8,0,0,0,0,0,0,102,36,1,0,119,36,1,0,
+60,8,0,0,0,0,0,0,125,36,1,0,139,36,1,0,61,8,0,0,
+0,0,0,0,146,36,1,0,159,36,1,0,62,8,0,0,0,0,0,0,
+166,36,1,0,173,36,1,0,63,8,0,0,0,0,0,0,187,36,1,0,
+197,36,1,0,64,8,0,0,0,0,0,0,202,36,1,0,213,36,1,0,
+65,8,0,0,0,0,0,0,218,36,1,0,223,36,1,0,66,8,0,0,
+0,0,0,0,230,36,1,0,240,36,1,0,67,8,0,0,0,0,0,0,
+247,36,1,0,253,36,1,0,71,8,0,0,0,0,0,0,9,37,1,0,
+13,37,1,0,87,8,0,0,0,0,0,0,24,37,1,0,29,37,1,0,
+88,8,0,0,0,0,0,0,40,37,1,0,46,37,1,0,89,8,0,0,
+0,0,0,0,57,37,1,0,60,37,1,0,90,8,0,0,0,0,0,0,
+71,37,1,0,75,37,1,0,91,8,0,0,0,0,0,0,84,37,1,0,
+94,37,1,0,92,8,0,0,0,0,0,0,102,37,1,0,108,37,1,0,
+96,8,0,0,0,0,0,0,117,37,1,0,130,37,1,0,97,8,0,0,
+0,0,0,0,141,37,1,0,152,37,1,0,98,8,0,0,0,0,0,0,
+169,37,1,0,175,37,1,0,99,8,0,0,0,0,0,0,188,37,1,0,
+195,37,1,0,100,8,0,0,0,0,0,0,208,37,1,0,216,37,1,0,
+101,8,0,0,0,0,0,0,229,37,1,0,235,37,1,0,102,8,0,0,
+0,0,0,0,246,37,1,0,0,38,1,0,103,8,0,0,0,0,0,0,
+7,38,1,0,19,38,1,0,104,8,0,0,0,0,0,0,26,38,1,0,
+37,38,1,0,114,8,0,0,0,0,0,0,47,38,1,0,58,38,1,0,
+115,8,0,0,0,0,0,0,68,38,1,0,81,38,1,0,116,8,0,0,
+0,0,0,0,92,38,1,0,103,38,1,0,117,8,0,0,0,0,0,0,
+112,38,1,0,123,38,1,0,118,8,0,0,0,0,0,0,132,38,1,0,
+144,38,1,0,119,8,0,0,0,0,0,0,155,38,1,0,161,38,1,0,
+123,8,0,0,0,0,0,0,172,38,1,0,181,38,1,0,124,8,0,0,
+0,0,0,0,192,38,1,0,205,38,1,0,125,8,0,0,0,0,0,0,
+211,38,1,0,222,38,1,0,126,8,0,0,0,0,0,0,239,38,1,0,
+254,38,1,0,127,8,0,0,0,0,0,0,11,39,1,0,24,39,1,0,
+128,8,0,0,0,0,0,0,39,39,1,0,43,39,1,0,129,8,0,0,
+0,0,0,0,56,39,1,0,62,39,1,0,130,8,0,0,0,0,0,0,
+73,39,1,0,79,39,1,0,131,8,0,0,0,0,0,0,92,39,1,0,
+99,39,1,0,132,8,0,0,0,0,0,0,112,39,1,0,120,39,1,0,
+133,8,0,0,0,0,0,0,133,39,1,0,153,39,1,0,137,8,0,0,
+0,0,0,0,159,39,1,0,166,39,1,0,138,8,0,0,0,0,0,0,
+186,39,1,0,194,39,1,0,139,8,0,0,0,0,0,0,214,39,1,0,
+223,39,1,0,140,8,0,0,0,0,0,0,243,39,1,0,5,40,1,0,
+141,8,0,0,0,0,0,0,29,40,1,0,36,40,1,0,142,8,0,0,
+0,0,0,0,54,40,1,0,60,40,1,0,146,8,0,0,0,0,0,0,
+67,40,1,0,76,40,1,0,147,8,0,0,0,0,0,0,84,40,1,0,
+89,40,1,0,148,8,0,0,0,0,0,0,103,40,1,0,108,40,1,0,
+149,8,0,0,0,0,0,0,117,40,1,0,126,40,1,0,150,8,0,0,
+0,0,0,0,139,40,1,0,145,40,1,0,151,8,0,0,0,0,0,0,
+155,40,1,0,160,40,1,0,155,8,0,0,0,0,0,0,172,40,1,0,
+176,40,1,0,156,8,0,0,0,0,0,0,181,40,1,0,187,40,1,0,
+157,8,0,0,0,0,0,0,195,40,1,0,208,40,1,0,158,8,0,0,
+0,0,0,0,213,40,1,0,227,40,1,0,159,8,0,0,0,0,0,0,
+243,40,1,0,251,40,1,0,160,8,0,0,0,0,0,0,5,41,1,0,
+10,41,1,0,161,8,0,0,0,0,0,0,22,41,1,0,29,41,1,0,
+162,8,0,0,0,0,0,0,39,41,1,0,48,41,1,0,166,8,0,0,
+0,0,0,0,55,41,1,0,62,41,1,0,172,8,0,0,0,0,0,0,
+73,41,1,0,90,41,1,0,173,8,0,0,0,0,0,0,103,41,1,0,
+116,41,1,0,174,8,0,0,0,0,0,0,127,41,1,0,138,41,1,0,
+175,8,0,0,0,0,0,0,152,41,1,0,156,41,1,0,176,8,0,0,
+0,0,0,0,169,41,1,0,186,41,1,0,177,8,0,0,0,0,0,0,
+199,41,1,0,217,41,1,0,178,8,0,0,0,0,0,0,228,41,1,0,
+246,41,1,0,179,8,0,0,0,0,0,0,3,42,1,0,16,42,1,0,
+180,8,0,0,0,0,0,0,27,42,1,0,41,42,1,0,181,8,0,0,
+0,0,0,0,55,42,1,0,69,42,1,0,182,8,0,0,0,0,0,0,
+80,42,1,0,98,42,1,0,183,8,0,0,0,0,0,0,112,42,1,0,
+131,42,1,0,184,8,0,0,0,0,0,0,144,42,1,0,163,42,1,0,
+185,8,0,0,0,0,0,0,176,42,1,0,187,42,1,0,186,8,0,0,
+0,0,0,0,203,42,1,0,221,42,1,0,187,8,0,0,0,0,0,0,
+232,42,1,0,251,42,1,0,188,8,0,0,0,0,0,0,6,43,1,0,
+25,43,1,0,189,8,0,0,0,0,0,0,36,43,1,0,49,43,1,0,
+190,8,0,0,0,0,0,0,60,43,1,0,74,43,1,0,191,8,0,0,
+0,0,0,0,85,43,1,0,99,43,1,0,192,8,0,0,0,0,0,0,
+110,43,1,0,121,43,1,0,193,8,0,0,0,0,0,0,133,43,1,0,
+138,43,1,0,194,8,0,0,0,0,0,0,150,43,1,0,160,43,1,0,
+195,8,0,0,0,0,0,0,172,43,1,0,181,43,1,0,196,8,0,0,
+0,0,0,0,196,43,1,0,206,43,1,0,197,8,0,0,0,0,0,0,
+220,43,1,0,226,43,1,0,198,8,0,0,0,0,0,0,241,43,1,0,
+247,43,1,0,199,8,0,0,0,0,0,0,3,44,1,0,18,44,1,0,
+200,8,0,0,0,0,0,0,29,44,1,0,46,44,1,0,201,8,0,0,
+0,0,0,0,58,44,1,0,74,44,1,0,202,8,0,0,0,0,0,0,
+86,44,1,0,100,44,1,0,204,8,0,0,0,0,0,0,118,44,1,0,
+123,44,1,0,205,8,0,0,0,0,0,0,135,44,1,0,146,44,1,0,
+206,8,0,0,0,0,0,0,160,44,1,0,178,44,1,0,207,8,0,0,
+0,0,0,0,192,44,1,0,196,44,1,0,214,8,0,0,0,0,0,0,
+205,44,1,0,214,44,1,0,215,8,0,0,0,0,0,0,223,44,1,0,
+231,44,1,0,216,8,0,0,0,0,0,0,242,44,1,0,252,44,1,0,
+217,8,0,0,0,0,0,0,24,45,1,0,39,45,1,0,218,8,0,0,
+0,0,0,0,55,45,1,0,69,45,1,0,219,8,0,0,0,0,0,0,
+79,45,1,0,90,45,1,0,1,9,0,0,0,0,0,0,94,45,1,0,
+103,45,1,0,48,9,0,0,0,0,0,0,115,45,1,0,123,45,1,0,
+50,9,0,0,0,0,0,0,135,45,1,0,142,45,1,0,51,9,0,0,
+0,0,0,0,155,45,1,0,159,45,1,0,52,9,0,0,0,0,0,0,
+167,45,1,0,171,45,1,0,53,9,0,0,0,0,0,0,192,45,1,0,
+196,45,1,0,54,9,0,0,0,0,0,0,217,45,1,0,222,45,1,0,
+55,9,0,0,0,0,0,0,226,45,1,0,230,45,1,0,56,9,0,0,
+0,0,0,0,249,45,1,0,254,45,1,0,57,9,0,0,0,0,0,0,
+6,46,1,0,11,46,1,0,58,9,0,0,0,0,0,0,24,46,1,0,
+30,46,1,0,59,9,0,0,0,0,0,0,41,46,1,0,48,46,1,0,
+60,9,0,0,0,0,0,0,63,46,1,0,71,46,1,0,61,9,0,0,
+0,0,0,0,84,46,1,0,93,46,1,0,64,9,0,0,0,0,0,0,
+98,46,1,0,102,46,1,0,65,9,0,0,0,0,0,0,111,46,1,0,
+116,46,1,0,66,9,0,0,0,0,0,0,126,46,1,0,130,46,1,0,
+67,9,0,0,0,0,0,0,133,46,1,0,137,46,1,0,68,9,0,0,
+0,0,0,0,146,46,1,0,150,46,1,0,69,9,0,0,0,0,0,0,
+161,46,1,0,165,46,1,0,70,9,0,0,0,0,0,0,176,46,1,0,
+181,46,1,0,71,9,0,0,0,0,0,0,192,46,1,0,205,46,1,0,
+72,9,0,0,0,0,0,0,217,46,1,0,228,46,1,0,73,9,0,0,
+0,0,0,0,241,46,1,0,254,46,1,0,75,9,0,0,0,0,0,0,
+14,47,1,0,26,47,1,0,77,9,0,0,0,0,0,0,39,47,1,0,
+44,47,1,0,78,9,0,0,0,0,0,0,56,47,1,0,63,47,1,0,
+80,9,0,0,0,0,0,0,73,47,1,0,81,47,1,0,81,9,0,0,
+0,0,0,0,88,47,1,0,96,47,1,0,82,9,0,0,0,0,0,0,
+106,47,1,0,111,47,1,0,83,9,0,0,0,0,0,0,118,47,1,0,
+123,47,1,0,84,9,0,0,0,0,0,0,132,47,1,0,137,47,1,0,
+85,9,0,0,0,0,0,0,146,47,1,0,161,47,1,0,86,9,0,0,
+0,0,0,0,171,47,1,0,177,47,1,0,88,9,0,0,0,0,0,0,
+182,47,1,0,196,47,1,0,94,9,0,0,0,0,0,0,210,47,1,0,
+215,47,1,0,95,9,0,0,0,0,0,0,222,47,1,0,236,47,1,0,
+96,9,0,0,0,0,0,0,244,47,1,0,254,47,1,0,97,9,0,0,
+0,0,0,0,11,48,1,0,21,48,1,0,99,9,0,0,0,0,0,0,
+31,48,1,0,42,48,1,0,100,9,0,0,0,0,0,0,52,48,1,0,
+64,48,1,0,102,9,0,0,0,0,0,0,71,48,1,0,80,48,1,0,
+105,9,0,0,0,0,0,0,89,48,1,0,97,48,1,0,109,9,0,0,
+0,0,0,0,104,48,1,0,114,48,1,0,115,9,0,0,0,0,0,0,
+122,48,1,0,124,48,1,0,116,9,0,0,0,0,0,0,134,48,1,0,
+137,48,1,0,117,9,0,0,0,0,0,0,139,48,1,0,146,48,1,0,
+131,9,0,0,0,0,0,0,152,48,1,0,157,48,1,0,132,9,0,0,
+0,0,0,0,163,48,1,0,170,48,1,0,136,9,0,0,0,0,0,0,
+179,48,1,0,186,48,1,0,137,9,0,0,0,0,0,0,194,48,1,0,
+206,48,1,0,138,9,0,0,0,0,0,0,216,48,1,0,227,48,1,0,
+139,9,0,0,0,0,0,0,237,48,1,0,246,48,1,0,140,9,0,0,
+0,0,0,0,0,49,1,0,8,49,1,0,141,9,0,0,0,0,0,0,
+15,49,1,0,19,49,1,0,142,9,0,0,0,0,0,0,27,49,1,0,
+38,49,1,0,143,9,0,0,0,0,0,0,45,49,1,0,58,49,1,0,
+144,9,0,0,0,0,0,0,65,49,1,0,76,49,1,0,145,9,0,0,
+0,0,0,0,89,49,1,0,97,49,1,0,146,9,0,0,0,0,0,0,
+109,49,1,0,117,49,1,0,147,9,0,0,0,0,0,0,133,49,1,0,
+137,49,1,0,153,9,0,0,0,0,0,0,158,49,1,0,177,49,1,0,
+154,9,0,0,0,0,0,0,181,49,1,0,188,49,1,0,155,9,0,0,
+0,0,0,0,192,49,1,0,199,49,1,0,156,9,0,0,0,0,0,0,
+223,49,1,0,232,49,1,0,157,9,0,0,0,0,0,0,2,50,1,0,
+7,50,1,0,158,9,0,0,0,0,0,0,23,50,1,0,31,50,1,0,
+160,9,0,0,0,0,0,0,43,50,1,0,51,50,1,0,161,9,0,0,
+0,0,0,0,64,50,1,0,70,50,1,0,162,9,0,0,0,0,0,0,
+78,50,1,0,85,50,1,0,173,9,0,0,0,0,0,0,97,50,1,0,
+101,50,1,0,175,9,0,0,0,0,0,0,108,50,1,0,116,50,1,0,
+183,9,0,0,0,0,0,0,127,50,1,0,137,50,1,0,187,9,0,0,
+0,0,0,0,146,50,1,0,161,50,1,0,189,9,0,0,0,0,0,0,
+174,50,1,0,189,50,1,0,190,9,0,0,0,0,0,0,201,50,1,0,
+212,50,1,0,191,9,0,0,0,0,0,0,227,50,1,0,236,50,1,0,
+196,9,0,0,0,0,0,0,248,50,1,0,7,51,1,0,197,9,0,0,
+0,0,0,0,19,51,1,0,37,51,1,0,198,9,0,0,0,0,0,0,
+49,51,1,0,65,51,1,0,199,9,0,0,0,0,0,0,79,51,1,0,
+92,51,1,0,200,9,0,0,0,0,0,0,106,51,1,0,114,51,1,0,
+201,9,0,0,0,0,0,0,126,51,1,0,138,51,1,0,202,9,0,0,
+0,0,0,0,157,51,1,0,169,51,1,0,203,9,0,0,0,0,0,0,
+188,51,1,0,195,51,1,0,204,9,0,0,0,0,0,0,215,51,1,0,
+228,51,1,0,205,9,0,0,0,0,0,0,248,51,1,0,5,52,1,0,
+206,9,0,0,0,0,0,0,25,52,1,0,34,52,1,0,207,9,0,0,
+0,0,0,0,47,52,1,0,55,52,1,0,208,9,0,0,0,0,0,0,
+69,52,1,0,77,52,1,0,209,9,0,0,0,0,0,0,91,52,1,0,
+99,52,1,0,210,9,0,0,0,0,0,0,111,52,1,0,118,52,1,0,
+211,9,0,0,0,0,0,0,129,52,1,0,142,52,1,0,220,9,0,0,
+0,0,0,0,181,52,1,0,197,52,1,0,221,9,0,0,0,0,0,0,
+215,52,1,0,231,52,1,0,225,9,0,0,0,0,0,0,252,52,1,0,
+0,53,1,0,226,9,0,0,0,0,0,0,16,53,1,0,22,53,1,0,
+228,9,0,0,0,0,0,0,27,53,1,0,40,53,1,0,233,9,0,0,
+0,0,0,0,67,53,1,0,70,53,1,0,234,9,0,0,0,0,0,0,
+81,53,1,0,98,53,1,0,235,9,0,0,0,0,0,0,128,53,1,0,
+147,53,1,0,236,9,0,0,0,0,0,0,153,53,1,0,170,53,1,0,
+237,9,0,0,0,0,0,0,180,53,1,0,196,53,1,0,238,9,0,0,
+0,0,0,0,206,53,1,0,219,53,1,0,239,9,0,0,0,0,0,0,
+228,53,1,0,240,53,1,0,240,9,0,0,0,0,0,0,246,53,1,0,
+3,54,1,0,241,9,0,0,0,0,0,0,20,54,1,0,40,54,1,0,
+248,9,0,0,0,0,0,0,83,54,1,0,101,54,1,0,249,9,0,0,
+0,0,0,0,123,54,1,0,144,54,1,0,250,9,0,0,0,0,0,0,
+173,54,1,0,192,54,1,0,251,9,0,0,0,0,0,0,217,54,1,0,
+224,54,1,0,252,9,0,0,0,0,0,0,243,54,1,0,250,54,1,0,
+253,9,0,0,0,0,0,0,3,55,1,0,18,55,1,0,254,9,0,0,
+0,0,0,0,31,55,1,0,35,55,1,0,255,9,0,0,0,0,0,0,
+48,55,1,0,52,55,1,0,0,10,0,0,0,0,0,0,71,55,1,0,
+75,55,1,0,6,10,0,0,0,0,0,0,92,55,1,0,100,55,1,0,
+58,10,0,0,0,0,0,0,121,55,1,0,130,55,1,0,59,10,0,0,
+0,0,0,0,140,55,1,0,148,55,1,0,60,10,0,0,0,0,0,0,
+166,55,1,0,175,55,1,0,61,10,0,0,0,0,0,0,194,55,1,0,
+211,55,1,0,62,10,0,0,0,0,0,0,232,55,1,0,239,55,1,0,
+67,10,0,0,0,0,0,0,0,56,1,0,14,56,1,0,68,10,0,0,
+0,0,0,0,27,56,1,0,36,56,1,0,69,10,0,0,0,0,0,0,
+53,56,1,0,57,56,1,0,70,10,0,0,0,0,0,0,74,56,1,0,
+82,56,1,0,72,10,0,0,0,0,0,0,103,56,1,0,111,56,1,0,
+82,10,0,0,0,0,0,0,132,56,1,0,142,56,1,0,83,10,0,0,
+0,0,0,0,150,56,1,0,157,56,1,0,84,10,0,0,0,0,0,0,
+165,56,1,0,170,56,1,0,85,10,0,0,0,0,0,0,178,56,1,0,
+187,56,1,0,86,10,0,0,0,0,0,0,212,56,1,0,229,56,1,0,
+87,10,0,0,0,0,0,0,238,56,1,0,243,56,1,0,93,10,0,0,
+0,0,0,0,245,56,1,0,251,56,1,0,94,10,0,0,0,0,0,0,
+253,56,1,0,2,57,1,0,95,10,0,0,0,0,0,0,4,57,1,0,
+13,57,1,0,97,10,0,0,0,0,0,0,15,57,1,0,22,57,1,0,
+99,10,0,0,0,0,0,0,25,57,1,0,31,57,1,0,100,10,0,0,
+0,0,0,0,34,57,1,0,46,57,1,0,101,10,0,0,0,0,0,0,
+49,57,1,0,55,57,1,0,102,10,0,0,0,0,0,0,58,57,1,0,
+64,57,1,0,103,10,0,0,0,0,0,0,67,57,1,0,73,57,1,0,
+104,10,0,0,0,0,0,0,76,57,1,0,82,57,1,0,105,10,0,0,
+0,0,0,0,85,57,1,0,94,57,1,0,106,10,0,0,0,0,0,0,
+98,57,1,0,110,57,1,0,107,10,0,0,0,0,0,0,114,57,1,0,
+120,57,1,0,108,10,0,0,0,0,0,0,124,57,1,0,135,57,1,0,
+109,10,0,0,0,0,0,0,144,57,1,0,150,57,1,0,110,10,0,0,
+0,0,0,0,155,57,1,0,166,57,1,0,114,10,0,0,0,0,0,0,
+169,57,1,0,175,57,1,0,115,10,0,0,0,0,0,0,178,57,1,0,
+188,57,1,0,116,10,0,0,0,0,0,0,192,57,1,0,197,57,1,0,
+117,10,0,0,0,0,0,0,201,57,1,0,213,57,1,0,118,10,0,0,
+0,0,0,0,217,57,1,0,224,57,1,0,119,10,0,0,0,0,0,0,
+232,57,1,0,237,57,1,0,120,10,0,0,0,0,0,0,247,57,1,0,
+2,58,1,0,128,10,0,0,0,0,0,0,19,58,1,0,29,58,1,0,
+129,10,0,0,0,0,0,0,46,58,1,0,57,58,1,0,130,10,0,0,
+0,0,0,0,73,58,1,0,87,58,1,0,131,10,0,0,0,0,0,0,
+107,58,1,0,114,58,1,0,132,10,0,0,0,0,0,0,131,58,1,0,
+138,58,1,0,133,10,0,0,0,0,0,0,154,58,1,0,161,58,1,0,
+134,10,0,0,0,0,0,0,177,58,1,0,184,58,1,0,135,10,0,0,
+0,0,0,0,200,58,1,0,207,58,1,0,136,10,0,0,0,0,0,0,
+223,58,1,0,238,58,1,0,138,10,0,0,0,0,0,0,242,58,1,0,
+250,58,1,0,147,10,0,0,0,0,0,0,9,59,1,0,17,59,1,0,
+148,10,0,0,0,0,0,0,32,59,1,0,40,59,1,0,149,10,0,0,
+0,0,0,0,55,59,1,0,63,59,1,0,150,10,0,0,0,0,0,0,
+78,59,1,0,86,59,1,0,151,10,0,0,0,0,0,0,101,59,1,0,
+109,59,1,0,152,10,0,0,0,0,0,0,124,59,1,0,132,59,1,0,
+153,10,0,0,0,0,0,0,147,59,1,0,155,59,1,0,154,10,0,0,
+0,0,0,0,169,59,1,0,177,59,1,0,155,10,0,0,0,0,0,0,
+191,59,1,0,199,59,1,0,156,10,0,0,0,0,0,0,213,59,1,0,
+222,59,1,0,157,10,0,0,0,0,0,0,236,59,1,0,244,59,1,0,
+159,10,0,0,0,0,0,0,4,60,1,0,12,60,1,0,160,10,0,0,
+0,0,0,0,27,60,1,0,35,60,1,0,161,10,0,0,0,0,0,0,
+50,60,1,0,58,60,1,0,162,10,0,0,0,0,0,0,73,60,1,0,
+81,60,1,0,163,10,0,0,0,0,0,0,96,60,1,0,104,60,1,0,
+164,10,0,0,0,0,0,0,119,60,1,0,127,60,1,0,165,10,0,0,
+0,0,0,0,142,60,1,0,150,60,1,0,166,10,0,0,0,0,0,0,
+164,60,1,0,172,60,1,0,167,10,0,0,0,0,0,0,186,60,1,0,
+194,60,1,0,168,10,0,0,0,0,0,0,208,60,1,0,217,60,1,0,
+169,10,0,0,0,0,0,0,231,60,1,0,239,60,1,0,171,10,0,0,
+0,0,0,0,254,60,1,0,6,61,1,0,172,10,0,0,0,0,0,0,
+21,61,1,0,29,61,1,0,173,10,0,0,0,0,0,0,44,61,1,0,
+52,61,1,0,174,10,0,0,0,0,0,0,67,61,1,0,75,61,1,0,
+175,10,0,0,0,0,0,0,90,61,1,0,98,61,1,0,176,10,0,0,
+0,0,0,0,113,61,1,0,121,61,1,0,177,10,0,0,0,0,0,0,
+136,61,1,0,144,61,1,0,178,10,0,0,0,0,0,0,158,61,1,0,
+166,61,1,0,179,10,0,0,0,0,0,0,180,61,1,0,188,61,1,0,
+180,10,0,0,0,0,0,0,202,61,1,0,211,61,1,0,181,10,0,0,
+0,0,0,0,225,61,1,0,229,61,1,0,185,10,0,0,0,0,0,0,
+245,61,1,0,4,62,1,0,198,10,0,0,0,0,0,0,30,62,1,0,
+37,62,1,0,199,10,0,0,0,0,0,0,52,62,1,0,67,62,1,0,
+200,10,0,0,0,0,0,0,82,62,1,0,89,62,1,0,201,10,0,0,
+0,0,0,0,104,62,1,0,121,62,1,0,202,10,0,0,0,0,0,0,
+136,62,1,0,145,62,1,0,203,10,0,0,0,0,0,0,162,62,1,0,
+178,62,1,0,204,10,0,0,0,0,0,0,193,62,1,0,201,62,1,0,
+205,10,0,0,0,0,0,0,217,62,1,0,231,62,1,0,206,10,0,0,
+0,0,0,0,1,63,1,0,7,63,1,0,207,10,0,0,0,0,0,0,
+21,63,1,0,35,63,1,0,208,10,0,0,0,0,0,0,49,63,1,0,
+55,63,1,0,209,10,0,0,0,0,0,0,69,63,1,0,89,63,1,0,
+210,10,0,0,0,0,0,0,103,63,1,0,115,63,1,0,211,10,0,0,
+0,0,0,0,135,63,1,0,152,63,1,0,212,10,0,0,0,0,0,0,
+166,63,1,0,175,63,1,0,213,10,0,0,0,0,0,0,192,63,1,0,
+209,63,1,0,214,10,0,0,0,0,0,0,223,63,1,0,232,63,1,0,
+215,10,0,0,0,0,0,0,249,63,1,0,12,64,1,0,216,10,0,0,
+0,0,0,0,26,64,1,0,37,64,1,0,217,10,0,0,0,0,0,0,
+56,64,1,0,73,64,1,0,218,10,0,0,0,0,0,0,87,64,1,0,
+96,64,1,0,219,10,0,0,0,0,0,0,113,64,1,0,132,64,1,0,
+220,10,0,0,0,0,0,0,146,64,1,0,157,64,1,0,221,10,0,0,
+0,0,0,0,176,64,1,0,192,64,1,0,222,10,0,0,0,0,0,0,
+218,64,1,0,226,64,1,0,223,10,0,0,0,0,0,0,242,64,1,0,
+2,65,1,0,224,10,0,0,0,0,0,0,32,65,1,0,40,65,1,0,
+225,10,0,0,0,0,0,0,56,65,1,0,79,65,1,0,226,10,0,0,
+0,0,0,0,95,65,1,0,110,65,1,0,227,10,0,0,0,0,0,0,
+126,65,1,0,141,65,1,0,228,10,0,0,0,0,0,0,167,65,1,0,
+174,65,1,0,229,10,0,0,0,0,0,0,189,65,1,0,207,65,1,0,
+230,10,0,0,0,0,0,0,222,65,1,0,232,65,1,0,231,10,0,0,
+0,0,0,0,250,65,1,0,11,66,1,0,232,10,0,0,0,0,0,0,
+26,66,1,0,35,66,1,0,233,10,0,0,0,0,0,0,52,66,1,0,
+67,66,1,0,234,10,0,0,0,0,0,0,82,66,1,0,89,66,1,0,
+235,10,0,0,0,0,0,0,104,66,1,0,123,66,1,0,236,10,0,0,
+0,0,0,0,149,66,1,0,160,66,1,0,237,10,0,0,0,0,0,0,
+179,66,1,0,196,66,1,0,238,10,0,0,0,0,0,0,222,66,1,0,
+231,66,1,0,239,10,0,0,0,0,0,0,248,66,1,0,11,67,1,0,
+240,10,0,0,0,0,0,0,41,67,1,0,52,67,1,0,241,10,0,0,
+0,0,0,0,71,67,1,0,91,67,1,0,242,10,0,0,0,0,0,0,
+110,67,1,0,127,67,1,0,243,10,0,0,0,0,0,0,147,67,1,0,
+165,67,1,0,244,10,0,0,0,0,0,0,185,67,1,0,195,67,1,0,
+245,10,0,0,0,0,0,0,213,67,1,0,227,67,1,0,246,10,0,0,
+0,0,0,0,242,67,1,0,253,67,1,0,247,10,0,0,0,0,0,0,
+11,68,1,0,27,68,1,0,248,10,0,0,0,0,0,0,41,68,1,0,
+54,68,1,0,249,10,0,0,0,0,0,0,70,68,1,0,77,68,1,0,
+255,10,0,0,0,0,0,0,87,68,1,0,100,68,1,0,7,11,0,0,
+0,0,0,0,111,68,1,0,124,68,1,0,8,11,0,0,0,0,0,0,
+140,68,1,0,151,68,1,0,9,11,0,0,0,0,0,0,173,68,1,0,
+187,68,1,0,15,11,0,0,0,0,0,0,204,68,1,0,218,68,1,0,
+19,11,0,0,0,0,0,0,234,68,1,0,248,68,1,0,24,11,0,0,
+0,0,0,0,1,69,1,0,9,69,1,0,27,11,0,0,0,0,0,0,
+16,69,1,0,33,69,1,0,32,11,0,0,0,0,0,0,45,69,1,0,
+57,69,1,0,36,11,0,0,0,0,0,0,64,69,1,0,73,69,1,0,
+37,11,0,0,0,0,0,0,86,69,1,0,100,69,1,0,38,11,0,0,
+0,0,0,0,109,69,1,0,118,69,1,0,39,11,0,0,0,0,0,0,
+127,69,1,0,142,69,1,0,50,11,0,0,0,0,0,0,159,69,1,0,
+165,69,1,0,51,11,0,0,0,0,0,0,180,69,1,0,194,69,1,0,
+52,11,0,0,0,0,0,0,204,69,1,0,210,69,1,0,53,11,0,0,
+0,0,0,0,224,69,1,0,237,69,1,0,54,11,0,0,0,0,0,0,
+254,69,1,0,14,70,1,0,55,11,0,0,0,0,0,0,28,70,1,0,
+36,70,1,0,56,11,0,0,0,0,0,0,52,70,1,0,57,70,1,0,
+57,11,0,0,0,0,0,0,68,70,1,0,70,70,1,0,58,11,0,0,
+0,0,0,0,77,70,1,0,97,70,1,0,60,11,0,0,0,0,0,0,
+111,70,1,0,122,70,1,0,61,11,0,0,0,0,0,0,139,70,1,0,
+153,70,1,0,62,11,0,0,0,0,0,0,164,70,1,0,171,70,1,0,
+63,11,0,0,0,0,0,0,185,70,1,0,191,70,1,0,65,11,0,0,
+0,0,0,0,200,70,1,0,210,70,1,0,69,11,0,0,0,0,0,0,
+221,70,1,0,231,70,1,0,70,11,0,0,0,0,0,0,244,70,1,0,
+0,71,1,0,71,11,0,0,0,0,0,0,11,71,1,0,17,71,1,0,
+72,11,0,0,0,0,0,0,28,71,1,0,34,71,1,0,73,11,0,0,
+0,0,0,0,47,71,1,0,52,71,1,0,75,11,0,0,0,0,0,0,
+58,71,1,0,68,71,1,0,76,11,0,0,0,0,0,0,79,71,1,0,
+90,71,1,0,77,11,0,0,0,0,0,0,103,71,1,0,111,71,1,0,
+78,11,0,0,0,0,0,0,122,71,1,0,129,71,1,0,79,11,0,0,
+0,0,0,0,140,71,1,0,148,71,1,0,80,11,0,0,0,0,0,0,
+159,71,1,0,169,71,1,0,81,11,0,0,0,0,0,0,180,71,1,0,
+191,71,1,0,82,11,0,0,0,0,0,0,203,71,1,0,213,71,1,0,
+83,11,0,0,0,0,0,0,225,71,1,0,230,71,1,0,84,11,0,0,
+0,0,0,0,242,71,1,0,250,71,1,0,85,11,0,0,0,0,0,0,
+6,72,1,0,16,72,1,0,86,11,0,0,0,0,0,0,28,72,1,0,
+40,72,1,0,87,11,0,0,0,0,0,0,52,72,1,0,60,72,1,0,
+88,11,0,0,0,0,0,0,72,72,1,0,81,72,1,0,89,11,0,0,
+0,0,0,0,93,72,1,0,99,72,1,0,90,11,0,0,0,0,0,0,
+111,72,1,0,124,72,1,0,94,11,0,0,0,0,0,0,137,72,1,0,
+146,72,1,0,95,11,0,0,0,0,0,0,159,72,1,0,167,72,1,0,
+96,11,0,0,0,0,0,0,180,72,1,0,185,72,1,0,97,11,0,0,
+0,0,0,0,198,72,1,0,210,72,1,0,98,11,0,0,0,0,0,0,
+223,72,1,0,231,72,1,0,99,11,0,0,0,0,0,0,244,72,1,0,
+250,72,1,0,100,11,0,0,0,0,0,0,7,73,1,0,14,73,1,0,
+101,11,0,0,0,0,0,0,27,73,1,0,34,73,1,0,102,11,0,0,
+0,0,0,0,48,73,1,0,55,73,1,0,103,11,0,0,0,0,0,0,
+62,73,1,0,71,73,1,0,104,11,0,0,0,0,0,0,78,73,1,0,
+85,73,1,0,105,11,0,0,0,0,0,0,99,73,1,0,106,73,1,0,
+106,11,0,0,0,0,0,0,120,73,1,0,125,73,1,0,107,11,0,0,
+0,0,0,0,139,73,1,0,152,73,1,0,108,11,0,0,0,0,0,0,
+166,73,1,0,172,73,1,0,109,11,0,0,0,0,0,0,186,73,1,0,
+198,73,1,0,110,11,0,0,0,0,0,0,212,73,1,0,219,73,1,0,
+111,11,0,0,0,0,0,0,233,73,1,0,246,73,1,0,112,11,0,0,
+0,0,0,0,4,74,1,0,16,74,1,0,113,11,0,0,0,0,0,0,
+30,74,1,0,42,74,1,0,120,11,0,0,0,0,0,0,46,74,1,0,
+50,74,1,0,122,11,0,0,0,0,0,0,61,74,1,0,69,74,1,0,
+123,11,0,0,0,0,0,0,83,74,1,0,87,74,1,0,130,11,0,0,
+0,0,0,0,95,74,1,0,100,74,1,0,136,11,0,0,0,0,0,0,
+106,74,1,0,108,74,1,0,137,11,0,0,0,0,0,0,113,74,1,0,
+119,74,1,0,143,11,0,0,0,0,0,0,126,74,1,0,133,74,1,0,
+144,11,0,0,0,0,0,0,140,74,1,0,147,74,1,0,147,11,0,0,
+0,0,0,0,154,74,1,0,158,74,1,0,148,11,0,0,0,0,0,0,
+165,74,1,0,169,74,1,0,153,11,0,0,0,0,0,0,178,74,1,0,
+182,74,1,0,155,11,0,0,0,0,0,0,191,74,1,0,197,74,1,0,
+166,11,0,0,0,0,0,0,206,74,1,0,214,74,1,0,167,11,0,0,
+0,0,0,0,220,74,1,0,233,74,1,0,179,11,0,0,0,0,0,0,
+252,74,1,0,7,75,1,0,181,11,0,0,0,0,0,0,27,75,1,0,
+36,75,1,0,191,11,0,0,0,0,0,0,46,75,1,0,53,75,1,0,
+207,11,0,0,0,0,0,0,55,75,1,0,67,75,1,0,208,11,0,0,
+0,0,0,0,91,75,1,0,102,75,1,0,209,11,0,0,0,0,0,0,
+106,75,1,0,117,75,1,0,210,11,0,0,0,0,0,0,121,75,1,0,
+135,75,1,0,211,11,0,0,0,0,0,0,139,75,1,0,152,75,1,0,
+212,11,0,0,0,0,0,0,156,75,1,0,167,75,1,0,213,11,0,0,
+0,0,0,0,192,75,1,0,203,75,1,0,214,11,0,0,0,0,0,0,
+228,75,1,0,241,75,1,0,215,11,0,0,0,0,0,0,9,76,1,0,
+22,76,1,0,216,11,0,0,0,0,0,0,46,76,1,0,63,76,1,0,
+218,11,0,0,0,0,0,0,99,76,1,0,113,76,1,0,219,11,0,0,
+0,0,0,0,143,76,1,0,160,76,1,0,220,11,0,0,0,0,0,0,
+187,76,1,0,196,76,1,0,224,11,0,0,0,0,0,0,210,76,1,0,
+220,76,1,0,231,11,0,0,0,0,0,0,222,76,1,0,242,76,1,0,
+232,11,0,0,0,0,0,0,252,76,1,0,5,77,1,0,233,11,0,0,
+0,0,0,0,19,77,1,0,31,77,1,0,234,11,0,0,0,0,0,0,
+45,77,1,0,56,77,1,0,235,11,0,0,0,0,0,0,70,77,1,0,
+84,77,1,0,236,11,0,0,0,0,0,0,99,77,1,0,116,77,1,0,
+237,11,0,0,0,0,0,0,131,77,1,0,147,77,1,0,238,11,0,0,
+0,0,0,0,162,77,1,0,169,77,1,0,239,11,0,0,0,0,0,0,
+173,77,1,0,186,77,1,0,240,11,0,0,0,0,0,0,190,77,1,0,
+196,77,1,0,241,11,0,0,0,0,0,0,212,77,1,0,222,77,1,0,
+242,11,0,0,0,0,0,0,232,77,1,0,242,77,1,0,243,11,0,0,
+0,0,0,0,251,77,1,0,4,78,1,0,244,11,0,0,0,0,0,0,
+16,78,1,0,23,78,1,0,245,11,0,0,0,0,0,0,34,78,1,0,
+45,78,1,0,246,11,0,0,0,0,0,0,59,78,1,0,74,78,1,0,
+247,11,0,0,0,0,0,0,91,78,1,0,110,78,1,0,248,11,0,0,
+0,0,0,0,126,78,1,0,145,78,1,0,249,11,0,0,0,0,0,0,
+164,78,1,0,176,78,1,0,1,12,0,0,0,0,0,0,192,78,1,0,
+200,78,1,0,3,12,0,0,0,0,0,0,215,78,1,0,231,78,1,0,
+5,12,0,0,0,0,0,0,246,78,1,0,5,79,1,0,6,12,0,0,
+0,0,0,0,20,79,1,0,37,79,1,0,7,12,0,0,0,0,0,0,
+51,79,1,0,67,79,1,0,8,12,0,0,0,0,0,0,78,79,1,0,
+85,79,1,0,9,12,0,0,0,0,0,0,93,79,1,0,114,79,1,0,
+10,12,0,0,0,0,0,0,131,79,1,0,135,79,1,0,11,12,0,0,
+0,0,0,0,141,79,1,0,146,79,1,0,12,12,0,0,0,0,0,0,
+157,79,1,0,169,79,1,0,13,12,0,0,0,0,0,0,179,79,1,0,
+183,79,1,0,15,12,0,0,0,0,0,0,193,79,1,0,198,79,1,0,
+16,12,0,0,0,0,0,0,206,79,1,0,213,79,1,0,17,12,0,0,
+0,0,0,0,227,79,1,0,239,79,1,0,21,12,0,0,0,0,0,0,
+250,79,1,0,5,80,1,0,24,12,0,0,0,0,0,0,12,80,1,0,
+21,80,1,0,25,12,0,0,0,0,0,0,28,80,1,0,33,80,1,0,
+26,12,0,0,0,0,0,0,44,80,1,0,49,80,1,0,27,12,0,0,
+0,0,0,0,59,80,1,0,63,80,1,0,28,12,0,0,0,0,0,0,
+73,80,1,0,77,80,1,0,29,12,0,0,0,0,0,0,87,80,1,0,
+102,80,1,0,31,12,0,0,0,0,0,0,110,80,1,0,126,80,1,0,
+32,12,0,0,0,0,0,0,154,80,1,0,164,80,1,0,34,12,0,0,
+0,0,0,0,191,80,1,0,198,80,1,0,35,12,0,0,0,0,0,0,
+208,80,1,0,212,80,1,0,45,12,0,0,0,0,0,0,222,80,1,0,
+234,80,1,0,46,12,0,0,0,0,0,0,249,80,1,0,6,81,1,0,
+47,12,0,0,0,0,0,0,20,81,1,0,30,81,1,0,48,12,0,0,
+0,0,0,0,46,81,1,0,51,81,1,0,49,12,0,0,0,0,0,0,
+59,81,1,0,69,81,1,0,54,12,0,0,0,0,0,0,76,81,1,0,
+95,81,1,0,65,12,0,0,0,0,0,0,102,81,1,0,110,81,1,0,
+73,12,0,0,0,0,0,0,119,81,1,0,126,81,1,0,74,12,0,0,
+0,0,0,0,134,81,1,0,141,81,1,0,75,12,0,0,0,0,0,0,
+149,81,1,0,157,81,1,0,76,12,0,0,0,0,0,0,166,81,1,0,
+175,81,1,0,77,12,0,0,0,0,0,0,183,81,1,0,185,81,1,0,
+86,12,0,0,0,0,0,0,192,81,1,0,197,81,1,0,87,12,0,0,
+0,0,0,0,209,81,1,0,217,81,1,0,88,12,0,0,0,0,0,0,
+234,81,1,0,248,81,1,0,89,12,0,0,0,0,0,0,0,82,1,0,
+11,82,1,0,90,12,0,0,0,0,0,0,26,82,1,0,33,82,1,0,
+91,12,0,0,0,0,0,0,45,82,1,0,50,82,1,0,92,12,0,0,
+0,0,0,0,66,82,1,0,73,82,1,0,93,12,0,0,0,0,0,0,
+88,82,1,0,96,82,1,0,94,12,0,0,0,0,0,0,115,82,1,0,
+130,82,1,0,95,12,0,0,0,0,0,0,149,82,1,0,154,82,1,0,
+96,12,0,0,0,0,0,0,165,82,1,0,169,82,1,0,97,12,0,0,
+0,0,0,0,178,82,1,0,183,82,1,0,98,12,0,0,0,0,0,0,
+193,82,1,0,199,82,1,0,99,12,0,0,0,0,0,0,210,82,1,0,
+218,82,1,0,100,12,0,0,0,0,0,0,232,82,1,0,238,82,1,0,
+101,12,0,0,0,0,0,0,250,82,1,0,1,83,1,0,102,12,0,0,
+0,0,0,0,15,83,1,0,28,83,1,0,103,12,0,0,0,0,0,0,
+46,83,1,0,60,83,1,0,104,12,0,0,0,0,0,0,73,83,1,0,
+78,83,1,0,105,12,0,0,0,0,0,0,88,83,1,0,105,83,1,0,
+111,12,0,0,0,0,0,0,120,83,1,0,133,83,1,0,112,12,0,0,
+0,0,0,0,148,83,1,0,161,83,1,0,113,12,0,0,0,0,0,0,
+176,83,1,0,190,83,1,0,114,12,0,0,0,0,0,0,205,83,1,0,
+217,83,1,0,115,12,0,0,0,0,0,0,232,83,1,0,244,83,1,0,
+116,12,0,0,0,0,0,0,3,84,1,0,17,84,1,0,117,12,0,0,
+0,0,0,0,31,84,1,0,43,84,1,0,118,12,0,0,0,0,0,0,
+59,84,1,0,69,84,1,0,119,12,0,0,0,0,0,0,84,84,1,0,
+100,84,1,0,120,12,0,0,0,0,0,0,115,84,1,0,134,84,1,0,
+121,12,0,0,0,0,0,0,149,84,1,0,164,84,1,0,122,12,0,0,
+0,0,0,0,179,84,1,0,191,84,1,0,123,12,0,0,0,0,0,0,
+206,84,1,0,218,84,1,0,124,12,0,0,0,0,0,0,234,84,1,0,
+244,84,1,0,125,12,0,0,0,0,0,0,4,85,1,0,18,85,1,0,
+126,12,0,0,0,0,0,0,33,85,1,0,48,85,1,0,127,12,0,0,
+0,0,0,0,63,85,1,0,88,85,1,0,131,12,0,0,0,0,0,0,
+99,85,1,0,118,85,1,0,132,12,0,0,0,0,0,0,130,85,1,0,
+141,85,1,0,133,12,0,0,0,0,0,0,154,85,1,0,166,85,1,0,
+134,12,0,0,0,0,0,0,178,85,1,0,205,85,1,0,135,12,0,0,
+0,0,0,0,216,85,1,0,229,85,1,0,136,12,0,0,0,0,0,0,
+241,85,1,0,255,85,1,0,137,12,0,0,0,0,0,0,10,86,1,0,
+26,86,1,0,138,12,0,0,0,0,0,0,37,86,1,0,51,86,1,0,
+139,12,0,0,0,0,0,0,62,86,1,0,81,86,1,0,140,12,0,0,
+0,0,0,0,92,86,1,0,104,86,1,0,141,12,0,0,0,0,0,0,
+115,86,1,0,130,86,1,0,142,12,0,0,0,0,0,0,141,86,1,0,
+156,86,1,0,143,12,0,0,0,0,0,0,168,86,1,0,180,86,1,0,
+144,12,0,0,0,0,0,0,188,86,1,0,201,86,1,0,145,12,0,0,
+0,0,0,0,211,86,1,0,224,86,1,0,146,12,0,0,0,0,0,0,
+237,86,1,0,251,86,1,0,147,12,0,0,0,0,0,0,1,87,1,0,
+14,87,1,0,148,12,0,0,0,0,0,0,25,87,1,0,42,87,1,0,
+149,12,0,0,0,0,0,0,53,87,1,0,64,87,1,0,150,12,0,0,
+0,0,0,0,75,87,1,0,89,87,1,0,151,12,0,0,0,0,0,0,
+95,87,1,0,110,87,1,0,152,12,0,0,0,0,0,0,122,87,1,0,
+135,87,1,0,153,12,0,0,0,0,0,0,146,87,1,0,159,87,1,0,
+154,12,0,0,0,0,0,0,172,87,1,0,185,87,1,0,155,12,0,0,
+0,0,0,0,196,87,1,0,209,87,1,0,156,12,0,0,0,0,0,0,
+220,87,1,0,231,87,1,0,157,12,0,0,0,0,0,0,244,87,1,0,
+5,88,1,0,158,12,0,0,0,0,0,0,16,88,1,0,26,88,1,0,
+159,12,0,0,0,0,0,0,39,88,1,0,49,88,1,0,160,12,0,0,
+0,0,0,0,60,88,1,0,73,88,1,0,161,12,0,0,0,0,0,0,
+86,88,1,0,101,88,1,0,162,12,0,0,0,0,0,0,114,88,1,0,
+123,88,1,0,163,12,0,0,0,0,0,0,129,88,1,0,145,88,1,0,
+164,12,0,0,0,0,0,0,157,88,1,0,169,88,1,0,165,12,0,0,
+0,0,0,0,180,88,1,0,194,88,1,0,166,12,0,0,0,0,0,0,
+207,88,1,0,221,88,1,0,167,12,0,0,0,0,0,0,232,88,1,0,
+254,88,1,0,168,12,0,0,0,0,0,0,10,89,1,0,23,89,1,0,
+169,12,0,0,0,0,0,0,35,89,1,0,46,89,1,0,170,12,0,0,
+0,0,0,0,57,89,1,0,70,89,1,0,171,12,0,0,0,0,0,0,
+82,89,1,0,95,89,1,0,172,12,0,0,0,0,0,0,107,89,1,0,
+112,89,1,0,173,12,0,0,0,0,0,0,123,89,1,0,134,89,1,0,
+174,12,0,0,0,0,0,0,145,89,1,0,166,89,1,0,175,12,0,0,
+0,0,0,0,177,89,1,0,195,89,1,0,176,12,0,0,0,0,0,0,
+206,89,1,0,218,89,1,0,177,12,0,0,0,0,0,0,229,89,1,0,
+239,89,1,0,178,12,0,0,0,0,0,0,249,89,1,0,8,90,1,0,
+179,12,0,0,0,0,0,0,19,90,1,0,32,90,1,0,180,12,0,0,
+0,0,0,0,44,90,1,0,56,90,1,0,181,12,0,0,0,0,0,0,
+69,90,1,0,86,90,1,0,182,12,0,0,0,0,0,0,97,90,1,0,
+110,90,1,0,183,12,0,0,0,0,0,0,123,90,1,0,138,90,1,0,
+184,12,0,0,0,0,0,0,149,90,1,0,165,90,1,0,185,12,0,0,
+0,0,0,0,177,90,1,0,189,90,1,0,186,12,0,0,0,0,0,0,
+200,90,1,0,213,90,1,0,187,12,0,0,0,0,0,0,225,90,1,0,
+239,90,1,0,188,12,0,0,0,0,0,0,252,90,1,0,12,91,1,0,
+189,12,0,0,0,0,0,0,24,91,1,0,40,91,1,0,190,12,0,0,
+0,0,0,0,51,91,1,0,62,91,1,0,191,12,0,0,0,0,0,0,
+74,91,1,0,84,91,1,0,192,12,0,0,0,0,0,0,97,91,1,0,
+106,91,1,0,193,12,0,0,0,0,0,0,119,91,1,0,132,91,1,0,
+194,12,0,0,0,0,0,0,145,91,1,0,159,91,1,0,195,12,0,0,
+0,0,0,0,171,91,1,0,183,91,1,0,196,12,0,0,0,0,0,0,
+194,91,1,0,203,91,1,0,197,12,0,0,0,0,0,0,214,91,1,0,
+228,91,1,0,198,12,0,0,0,0,0,0,239,91,1,0,253,91,1,0,
+199,12,0,0,0,0,0,0,9,92,1,0,22,92,1,0,200,12,0,0,
+0,0,0,0,34,92,1,0,47,92,1,0,201,12,0,0,0,0,0,0,
+60,92,1,0,74,92,1,0,202,12,0,0,0,0,0,0,87,92,1,0,
+99,92,1,0,203,12,0,0,0,0,0,0,110,92,1,0,130,92,1,0,
+204,12,0,0,0,0,0,0,141,92,1,0,157,92,1,0,205,12,0,0,
+0,0,0,0,170,92,1,0,178,92,1,0,206,12,0,0,0,0,0,0,
+191,92,1,0,204,92,1,0,207,12,0,0,0,0,0,0,217,92,1,0,
+231,92,1,0,208,12,0,0,0,0,0,0,244,92,1,0,2,93,1,0,
+209,12,0,0,0,0,0,0,14,93,1,0,28,93,1,0,210,12,0,0,
+0,0,0,0,39,93,1,0,54,93,1,0,211,12,0,0,0,0,0,0,
+64,93,1,0,76,93,1,0,212,12,0,0,0,0,0,0,87,93,1,0,
+98,93,1,0,213,12,0,0,0,0,0,0,109,93,1,0,123,93,1,0,
+214,12,0,0,0,0,0,0,134,93,1,0,145,93,1,0,215,12,0,0,
+0,0,0,0,157,93,1,0,174,93,1,0,216,12,0,0,0,0,0,0,
+187,93,1,0,202,93,1,0,217,12,0,0,0,0,0,0,214,93,1,0,
+226,93,1,0,218,12,0,0,0,0,0,0,237,93,1,0,252,93,1,0,
+219,12,0,0,0,0,0,0,9,94,1,0,21,94,1,0,220,12,0,0,
+0,0,0,0,31,94,1,0,49,94,1,0,221,12,0,0,0,0,0,0,
+62,94,1,0,77,94,1,0,222,12,0,0,0,0,0,0,89,94,1,0,
+105,94,1,0,223,12,0,0,0,0,0,0,117,94,1,0,130,94,1,0,
+224,12,0,0,0,0,0,0,143,94,1,0,154,94,1,0,225,12,0,0,
+0,0,0,0,166,94,1,0,182,94,1,0,226,12,0,0,0,0,0,0,
+193,94,1,0,211,94,1,0,227,12,0,0,0,0,0,0,222,94,1,0,
+236,94,1,0,228,12,0,0,0,0,0,0,247,94,1,0,4,95,1,0,
+229,12,0,0,0,0,0,0,17,95,1,0,34,95,1,0,230,12,0,0,
+0,0,0,0,45,95,1,0,57,95,1,0,231,12,0,0,0,0,0,0,
+68,95,1,0,84,95,1,0,232,12,0,0,0,0,0,0,96,95,1,0,
+113,95,1,0,233,12,0,0,0,0,0,0,124,95,1,0,133,95,1,0,
+234,12,0,0,0,0,0,0,144,95,1,0,157,95,1,0,235,12,0,0,
+0,0,0,0,163,95,1,0,171,95,1,0,236,12,0,0,0,0,0,0,
+182,95,1,0,201,95,1,0,237,12,0,0,0,0,0,0,212,95,1,0,
+228,95,1,0,238,12,0,0,0,0,0,0,240,95,1,0,254,95,1,0,
+239,12,0,0,0,0,0,0,10,96,1,0,22,96,1,0,240,12,0,0,
+0,0,0,0,33,96,1,0,49,96,1,0,241,12,0,0,0,0,0,0,
+62,96,1,0,72,96,1,0,242,12,0,0,0,0,0,0,83,96,1,0,
+94,96,1,0,243,12,0,0,0,0,0,0,105,96,1,0,117,96,1,0,
+244,12,0,0,0,0,0,0,129,96,1,0,141,96,1,0,245,12,0,0,
+0,0,0,0,153,96,1,0,165,96,1,0,246,12,0,0,0,0,0,0,
+178,96,1,0,195,96,1,0,247,12,0,0,0,0,0,0,206,96,1,0,
+227,96,1,0,248,12,0,0,0,0,0,0,238,96,1,0,254,96,1,0,
+249,12,0,0,0,0,0,0,10,97,1,0,21,97,1,0,250,12,0,0,
+0,0,0,0,32,97,1,0,45,97,1,0,251,12,0,0,0,0,0,0,
+56,97,1,0,72,97,1,0,252,12,0,0,0,0,0,0,83,97,1,0,
+100,97,1,0,253,12,0,0,0,0,0,0,111,97,1,0,128,97,1,0,
+254,12,0,0,0,0,0,0,141,97,1,0,157,97,1,0,255,12,0,0,
+0,0,0,0,170,97,1,0,185,97,1,0,0,13,0,0,0,0,0,0,
+196,97,1,0,209,97,1,0,1,13,0,0,0,0,0,0,223,97,1,0,
+239,97,1,0,2,13,0,0,0,0,0,0,250,97,1,0,5,98,1,0,
+3,13,0,0,0,0,0,0,17,98,1,0,37,98,1,0,4,13,0,0,
+0,0,0,0,48,98,1,0,61,98,1,0,5,13,0,0,0,0,0,0,
+73,98,1,0,90,98,1,0,6,13,0,0,0,0,0,0,100,98,1,0,
+113,98,1,0,7,13,0,0,0,0,0,0,124,98,1,0,137,98,1,0,
+8,13,0,0,0,0,0,0,147,98,1,0,161,98,1,0,9,13,0,0,
+0,0,0,0,172,98,1,0,196,98,1,0,10,13,0,0,0,0,0,0,
+207,98,1,0,221,98,1,0,11,13,0,0,0,0,0,0,233,98,1,0,
+250,98,1,0,12,13,0,0,0,0,0,0,7,99,1,0,22,99,1,0,
+13,13,0,0,0,0,0,0,33,99,1,0,48,99,1,0,14,13,0,0,
+0,0,0,0,61,99,1,0,80,99,1,0,15,13,0,0,0,0,0,0,
+86,99,1,0,98,99,1,0,16,13,0,0,0,0,0,0,110,99,1,0,
+124,99,1,0,17,13,0,0,0,0,0,0,137,99,1,0,154,99,1,0,
+18,13,0,0,0,0,0,0,164,99,1,0,176,99,1,0,19,13,0,0,
+0,0,0,0,188,99,1,0,200,99,1,0,20,13,0,0,0,0,0,0,
+212,99,1,0,222,99,1,0,21,13,0,0,0,0,0,0,233,99,1,0,
+245,99,1,0,22,13,0,0,0,0,0,0,0,100,1,0,10,100,1,0,
+23,13,0,0,0,0,0,0,21,100,1,0,41,100,1,0,24,13,0,0,
+0,0,0,0,52,100,1,0,67,100,1,0,25,13,0,0,0,0,0,0,
+77,100,1,0,91,100,1,0,26,13,0,0,0,0,0,0,102,100,1,0,
+112,100,1,0,27,13,0,0,0,0,0,0,125,100,1,0,141,100,1,0,
+28,13,0,0,0,0,0,0,152,100,1,0,165,100,1,0,29,13,0,0,
+0,0,0,0,178,100,1,0,193,100,1,0,30,13,0,0,0,0,0,0,
+206,100,1,0,210,100,1,0,34,13,0,0,0,0,0,0,235,100,1,0,
+239,100,1,0,35,13,0,0,0,0,0,0,2,101,1,0,6,101,1,0,
+36,13,0,0,0,0,0,0,17,101,1,0,21,101,1,0,37,13,0,0,
+0,0,0,0,33,101,1,0,37,101,1,0,38,13,0,0,0,0,0,0,
+64,101,1,0,68,101,1,0,39,13,0,0,0,0,0,0,81,101,1,0,
+85,101,1,0,40,13,0,0,0,0,0,0,99,101,1,0,103,101,1,0,
+41,13,0,0,0,0,0,0,119,101,1,0,123,101,1,0,42,13,0,0,
+0,0,0,0,137,101,1,0,141,101,1,0,43,13,0,0,0,0,0,0,
+160,101,1,0,164,101,1,0,44,13,0,0,0,0,0,0,176,101,1,0,
+180,101,1,0,45,13,0,0,0,0,0,0,195,101,1,0,199,101,1,0,
+46,13,0,0,0,0,0,0,214,101,1,0,218,101,1,0,47,13,0,0,
+0,0,0,0,230,101,1,0,234,101,1,0,48,13,0,0,0,0,0,0,
+247,101,1,0,251,101,1,0,49,13,0,0,0,0,0,0,8,102,1,0,
+12,102,1,0,50,13,0,0,0,0,0,0,26,102,1,0,30,102,1,0,
+51,13,0,0,0,0,0,0,43,102,1,0,47,102,1,0,52,13,0,0,
+0,0,0,0,64,102,1,0,68,102,1,0,53,13,0,0,0,0,0,0,
+79,102,1,0,83,102,1,0,54,13,0,0,0,0,0,0,97,102,1,0,
+101,102,1,0,55,13,0,0,0,0,0,0,116,102,1,0,120,102,1,0,
+56,13,0,0,0,0,0,0,133,102,1,0,137,102,1,0,57,13,0,0,
+0,0,0,0,150,102,1,0,154,102,1,0,58,13,0,0,0,0,0,0,
+167,102,1,0,171,102,1,0,59,13,0,0,0,0,0,0,184,102,1,0,
+188,102,1,0,60,13,0,0,0,0,0,0,199,102,1,0,203,102,1,0,
+61,13,0,0,0,0,0,0,220,102,1,0,224,102,1,0,62,13,0,0,
+0,0,0,0,234,102,1,0,238,102,1,0,63,13,0,0,0,0,0,0,
+248,102,1,0,252,102,1,0,64,13,0,0,0,0,0,0,9,103,1,0,
+13,103,1,0,65,13,0,0,0,0,0,0,28,103,1,0,32,103,1,0,
+66,13,0,0,0,0,0,0,41,103,1,0,45,103,1,0,67,13,0,0,
+0,0,0,0,61,103,1,0,65,103,1,0,68,13,0,0,0,0,0,0,
+77,103,1,0,81,103,1,0,69,13,0,0,0,0,0,0,95,103,1,0,
+99,103,1,0,70,13,0,0,0,0,0,0,113,103,1,0,117,103,1,0,
+71,13,0,0,0,0,0,0,139,103,1,0,143,103,1,0,72,13,0,0,
+0,0,0,0,156,103,1,0,160,103,1,0,73,13,0,0,0,0,0,0,
+173,103,1,0,177,103,1,0,74,13,0,0,0,0,0,0,188,103,1,0,
+192,103,1,0,75,13,0,0,0,0,0,0,205,103,1,0,209,103,1,0,
+76,13,0,0,0,0,0,0,222,103,1,0,226,103,1,0,77,13,0,0,
+0,0,0,0,231,103,1,0,235,103,1,0,78,13,0,0,0,0,0,0,
+246,103,1,0,250,103,1,0,79,13,0,0,0,0,0,0,15,104,1,0,
+19,104,1,0,80,13,0,0,0,0,0,0,37,104,1,0,41,104,1,0,
+81,13,0,0,0,0,0,0,53,104,1,0,57,104,1,0,82,13,0,0,
+0,0,0,0,67,104,1,0,71,104,1,0,83,13,0,0,0,0,0,0,
+86,104,1,0,90,104,1,0,84,13,0,0,0,0,0,0,103,104,1,0,
+107,104,1,0,85,13,0,0,0,0,0,0,119,104,1,0,123,104,1,0,
+86,13,0,0,0,0,0,0,140,104,1,0,144,104,1,0,87,13,0,0,
+0,0,0,0,157,104,1,0,161,104,1,0,88,13,0,0,0,0,0,0,
+176,104,1,0,180,104,1,0,89,13,0,0,0,0,0,0,196,104,1,0,
+200,104,1,0,90,13,0,0,0,0,0,0,212,104,1,0,216,104,1,0,
+91,13,0,0,0,0,0,0,229,104,1,0,233,104,1,0,92,13,0,0,
+0,0,0,0,247,104,1,0,251,104,1,0,93,13,0,0,0,0,0,0,
+11,105,1,0,15,105,1,0,94,13,0,0,0,0,0,0,31,105,1,0,
+35,105,1,0,95,13,0,0,0,0,0,0,46,105,1,0,50,105,1,0,
+96,13,0,0,0,0,0,0,60,105,1,0,64,105,1,0,97,13,0,0,
+0,0,0,0,73,105,1,0,77,105,1,0,98,13,0,0,0,0,0,0,
+90,105,1,0,94,105,1,0,99,13,0,0,0,0,0,0,108,105,1,0,
+112,105,1,0,100,13,0,0,0,0,0,0,124,105,1,0,128,105,1,0,
+101,13,0,0,0,0,0,0,137,105,1,0,141,105,1,0,102,13,0,0,
+0,0,0,0,155,105,1,0,159,105,1,0,103,13,0,0,0,0,0,0,
+173,105,1,0,177,105,1,0,104,13,0,0,0,0,0,0,190,105,1,0,
+194,105,1,0,105,13,0,0,0,0,0,0,207,105,1,0,211,105,1,0,
+106,13,0,0,0,0,0,0,225,105,1,0,229,105,1,0,107,13,0,0,
+0,0,0,0,241,105,1,0,245,105,1,0,108,13,0,0,0,0,0,0,
+9,106,1,0,13,106,1,0,109,13,0,0,0,0,0,0,29,106,1,0,
+33,106,1,0,110,13,0,0,0,0,0,0,41,106,1,0,45,106,1,0,
+111,13,0,0,0,0,0,0,58,106,1,0,62,106,1,0,112,13,0,0,
+0,0,0,0,76,106,1,0,80,106,1,0,113,13,0,0,0,0,0,0,
+94,106,1,0,98,106,1,0,114,13,0,0,0,0,0,0,112,106,1,0,
+116,106,1,0,115,13,0,0,0,0,0,0,131,106,1,0,135,106,1,0,
+116,13,0,0,0,0,0,0,147,106,1,0,151,106,1,0,117,13,0,0,
+0,0,0,0,162,106,1,0,166,106,1,0,118,13,0,0,0,0,0,0,
+180,106,1,0,184,106,1,0,119,13,0,0,0,0,0,0,195,106,1,0,
+199,106,1,0,120,13,0,0,0,0,0,0,216,106,1,0,220,106,1,0,
+121,13,0,0,0,0,0,0,235,106,1,0,239,106,1,0,122,13,0,0,
+0,0,0,0,251,106,1,0,255,106,1,0,123,13,0,0,0,0,0,0,
+14,107,1,0,18,107,1,0,124,13,0,0,0,0,0,0,30,107,1,0,
+34,107,1,0,125,13,0,0,0,0,0,0,52,107,1,0,56,107,1,0,
+126,13,0,0,0,0,0,0,71,107,1,0,75,107,1,0,127,13,0,0,
+0,0,0,0,91,107,1,0,95,107,1,0,128,13,0,0,0,0,0,0,
+108,107,1,0,112,107,1,0,129,13,0,0,0,0,0,0,123,107,1,0,
+127,107,1,0,130,13,0,0,0,0,0,0,143,107,1,0,147,107,1,0,
+131,13,0,0,0,0,0,0,165,107,1,0,169,107,1,0,132,13,0,0,
+0,0,0,0,183,107,1,0,187,107,1,0,133,13,0,0,0,0,0,0,
+200,107,1,0,204,107,1,0,134,13,0,0,0,0,0,0,221,107,1,0,
+225,107,1,0,135,13,0,0,0,0,0,0,237,107,1,0,241,107,1,0,
+136,13,0,0,0,0,0,0,1,108,1,0,5,108,1,0,137,13,0,0,
+0,0,0,0,22,108,1,0,26,108,1,0,138,13,0,0,0,0,0,0,
+35,108,1,0,39,108,1,0,139,13,0,0,0,0,0,0,52,108,1,0,
+56,108,1,0,140,13,0,0,0,0,0,0,64,108,1,0,68,108,1,0,
+141,13,0,0,0,0,0,0,87,108,1,0,91,108,1,0,142,13,0,0,
+0,0,0,0,107,108,1,0,111,108,1,0,143,13,0,0,0,0,0,0,
+125,108,1,0,129,108,1,0,144,13,0,0,0,0,0,0,141,108,1,0,
+145,108,1,0,145,13,0,0,0,0,0,0,161,108,1,0,165,108,1,0,
+146,13,0,0,0,0,0,0,175,108,1,0,179,108,1,0,147,13,0,0,
+0,0,0,0,190,108,1,0,194,108,1,0,148,13,0,0,0,0,0,0,
+206,108,1,0,210,108,1,0,149,13,0,0,0,0,0,0,222,108,1,0,
+226,108,1,0,150,13,0,0,0,0,0,0,238,108,1,0,242,108,1,0,
+151,13,0,0,0,0,0,0,3,109,1,0,7,109,1,0,152,13,0,0,
+0,0,0,0,28,109,1,0,32,109,1,0,153,13,0,0,0,0,0,0,
+48,109,1,0,52,109,1,0,154,13,0,0,0,0,0,0,63,109,1,0,
+67,109,1,0,155,13,0,0,0,0,0,0,80,109,1,0,84,109,1,0,
+156,13,0,0,0,0,0,0,100,109,1,0,104,109,1,0,157,13,0,0,
+0,0,0,0,121,109,1,0,125,109,1,0,158,13,0,0,0,0,0,0,
+142,109,1,0,146,109,1,0,159,13,0,0,0,0,0,0,162,109,1,0,
+166,109,1,0,160,13,0,0,0,0,0,0,181,109,1,0,185,109,1,0,
+161,13,0,0,0,0,0,0,198,109,1,0,202,109,1,0,162,13,0,0,
+0,0,0,0,218,109,1,0,222,109,1,0,163,13,0,0,0,0,0,0,
+233,109,1,0,237,109,1,0,164,13,0,0,0,0,0,0,1,110,1,0,
+5,110,1,0,165,13,0,0,0,0,0,0,18,110,1,0,22,110,1,0,
+166,13,0,0,0,0,0,0,39,110,1,0,43,110,1,0,167,13,0,0,
+0,0,0,0,56,110,1,0,60,110,1,0,168,13,0,0,0,0,0,0,
+73,110,1,0,77,110,1,0,169,13,0,0,0,0,0,0,91,110,1,0,
+95,110,1,0,170,13,0,0,0,0,0,0,119,110,1,0,123,110,1,0,
+171,13,0,0,0,0,0,0,137,110,1,0,141,110,1,0,172,13,0,0,
+0,0,0,0,158,110,1,0,162,110,1,0,173,13,0,0,0,0,0,0,
+177,110,1,0,181,110,1,0,174,13,0,0,0,0,0,0,196,110,1,0,
+200,110,1,0,175,13,0,0,0,0,0,0,219,110,1,0,223,110,1,0,
+176,13,0,0,0,0,0,0,235,110,1,0,239,110,1,0,177,13,0,0,
+0,0,0,0,253,110,1,0,1,111,1,0,178,13,0,0,0,0,0,0,
+18,111,1,0,22,111,1,0,179,13,0,0,0,0,0,0,34,111,1,0,
+38,111,1,0,180,13,0,0,0,0,0,0,50,111,1,0,54,111,1,0,
+181,13,0,0,0,0,0,0,64,111,1,0,68,111,1,0,182,13,0,0,
+0,0,0,0,80,111,1,0,84,111,1,0,183,13,0,0,0,0,0,0,
+94,111,1,0,98,111,1,0,184,13,0,0,0,0,0,0,118,111,1,0,
+122,111,1,0,185,13,0,0,0,0,0,0,137,111,1,0,141,111,1,0,
+186,13,0,0,0,0,0,0,155,111,1,0,159,111,1,0,187,13,0,0,
+0,0,0,0,169,111,1,0,173,111,1,0,188,13,0,0,0,0,0,0,
+189,111,1,0,193,111,1,0,189,13,0,0,0,0,0,0,206,111,1,0,
+210,111,1,0,190,13,0,0,0,0,0,0,225,111,1,0,237,111,1,0,
+194,13,0,0,0,0,0,0,5,112,1,0,15,112,1,0,195,13,0,0,
+0,0,0,0,37,112,1,0,52,112,1,0,196,13,0,0,0,0,0,0,
+79,112,1,0,93,112,1,0,197,13,0,0,0,0,0,0,119,112,1,0,
+123,112,1,0,200,13,0,0,0,0,0,0,127,112,1,0,131,112,1,0,
+202,13,0,0,0,0,0,0,142,112,1,0,156,112,1,0,210,13,0,0,
+0,0,0,0,179,112,1,0,193,112,1,0,211,13,0,0,0,0,0,0,
+215,112,1,0,226,112,1,0,212,13,0,0,0,0,0,0,240,112,1,0,
+250,112,1,0,213,13,0,0,0,0,0,0,15,113,1,0,29,113,1,0,
+218,13,0,0,0,0,0,0,39,113,1,0,54,113,1,0,219,13,0,0,
+0,0,0,0,62,113,1,0,75,113,1,0,220,13,0,0,0,0,0,0,
+100,113,1,0,116,113,1,0,221,13,0,0,0,0,0,0,141,113,1,0,
+160,113,1,0,222,13,0,0,0,0,0,0,185,113,1,0,198,113,1,0,
+223,13,0,0,0,0,0,0,208,113,1,0,213,113,1,0,227,13,0,0,
+0,0,0,0,226,113,1,0,232,113,1,0,228,13,0,0,0,0,0,0,
+239,113,1,0,246,113,1,0,229,13,0,0,0,0,0,0,254,113,1,0,
+5,114,1,0,230,13,0,0,0,0,0,0,14,114,1,0,22,114,1,0,
+231,13,0,0,0,0,0,0,32,114,1,0,36,114,1,0,232,13,0,0,
+0,0,0,0,45,114,1,0,54,114,1,0,234,13,0,0,0,0,0,0,
+72,114,1,0,81,114,1,0,235,13,0,0,0,0,0,0,95,114,1,0,
+104,114,1,0,236,13,0,0,0,0,0,0,117,114,1,0,124,114,1,0,
+237,13,0,0,0,0,0,0,136,114,1,0,142,114,1,0,238,13,0,0,
+0,0,0,0,153,114,1,0,160,114,1,0,239,13,0,0,0,0,0,0,
+171,114,1,0,177,114,1,0,240,13,0,0,0,0,0,0,188,114,1,0,
+195,114,1,0,241,13,0,0,0,0,0,0,206,114,1,0,214,114,1,0,
+242,13,0,0,0,0,0,0,232,114,1,0,238,114,1,0,243,13,0,0,
+0,0,0,0,246,114,1,0,255,114,1,0,244,13,0,0,0,0,0,0,
+7,115,1,0,16,115,1,0,245,13,0,0,0,0,0,0,25,115,1,0,
+34,115,1,0,246,13,0,0,0,0,0,0,46,115,1,0,54,115,1,0,
+247,13,0,0,0,0,0,0,63,115,1,0,72,115,1,0,248,13,0,0,
+0,0,0,0,81,115,1,0,93,115,1,0,249,13,0,0,0,0,0,0,
+104,115,1,0,116,115,1,0,250,13,0,0,0,0,0,0,128,115,1,0,
+139,115,1,0,251,13,0,0,0,0,0,0,150,115,1,0,161,115,1,0,
+252,13,0,0,0,0,0,0,172,115,1,0,186,115,1,0,253,13,0,0,
+0,0,0,0,197,115,1,0,211,115,1,0,254,13,0,0,0,0,0,0,
+222,115,1,0,235,115,1,0,255,13,0,0,0,0,0,0,248,115,1,0,
+4,116,1,0,0,14,0,0,0,0,0,0,17,116,1,0,28,116,1,0,
+1,14,0,0,0,0,0,0,40,116,1,0,47,116,1,0,2,14,0,0,
+0,0,0,0,63,116,1,0,69,116,1,0,6,14,0,0,0,0,0,0,
+84,116,1,0,90,116,1,0,7,14,0,0,0,0,0,0,105,116,1,0,
+110,116,1,0,13,14,0,0,0,0,0,0,121,116,1,0,130,116,1,0,
+14,14,0,0,0,0,0,0,139,116,1,0,148,116,1,0,15,14,0,0,
+0,0,0,0,157,116,1,0,166,116,1,0,16,14,0,0,0,0,0,0,
+175,116,1,0,185,116,1,0,17,14,0,0,0,0,0,0,194,116,1,0,
+204,116,1,0,19,14,0,0,0,0,0,0,214,116,1,0,224,116,1,0,
+20,14,0,0,0,0,0,0,234,116,1,0,238,116,1,0,21,14,0,0,
+0,0,0,0,248,116,1,0,254,116,1,0,22,14,0,0,0,0,0,0,
+7,117,1,0,12,117,1,0,23,14,0,0,0,0,0,0,32,117,1,0,
+38,117,1,0,28,14,0,0,0,0,0,0,42,117,1,0,53,117,1,0,
+29,14,0,0,0,0,0,0,58,117,1,0,67,117,1,0,30,14,0,0,
+0,0,0,0,90,117,1,0,95,117,1,0,44,14,0,0,0,0,0,0,
+114,117,1,0,124,117,1,0,45,14,0,0,0,0,0,0,144,117,1,0,
+154,117,1,0,47,14,0,0,0,0,0,0,173,117,1,0,184,117,1,0,
+54,14,0,0,0,0,0,0,198,117,1,0,204,117,1,0,58,14,0,0,
+0,0,0,0,210,117,1,0,216,117,1,0,59,14,0,0,0,0,0,0,
+223,117,1,0,227,117,1,0,63,14,0,0,0,0,0,0,234,117,1,0,
+238,117,1,0,64,14,0,0,0,0,0,0,246,117,1,0,250,117,1,0,
+65,14,0,0,0,0,0,0,6,118,1,0,10,118,1,0,66,14,0,0,
+0,0,0,0,17,118,1,0,21,118,1,0,67,14,0,0,0,0,0,0,
+31,118,1,0,35,118,1,0,68,14,0,0,0,0,0,0,44,118,1,0,
+48,118,1,0,69,14,0,0,0,0,0,0,58,118,1,0,62,118,1,0,
+70,14,0,0,0,0,0,0,69,118,1,0,73,118,1,0,74,14,0,0,
+0,0,0,0,89,118,1,0,102,118,1,0,86,14,0,0,0,0,0,0,
+115,118,1,0,128,118,1,0,87,14,0,0,0,0,0,0,141,118,1,0,
+154,118,1,0,88,14,0,0,0,0,0,0,167,118,1,0,180,118,1,0,
+89,14,0,0,0,0,0,0,193,118,1,0,206,118,1,0,90,14,0,0,
+0,0,0,0,219,118,1,0,232,118,1,0,91,14,0,0,0,0,0,0,
+245,118,1,0,2,119,1,0,92,14,0,0,0,0,0,0,15,119,1,0,
+28,119,1,0,93,14,0,0,0,0,0,0,41,119,1,0,54,119,1,0,
+94,14,0,0,0,0,0,0,67,119,1,0,80,119,1,0,95,14,0,0,
+0,0,0,0,93,119,1,0,106,119,1,0,96,14,0,0,0,0,0,0,
+119,119,1,0,132,119,1,0,97,14,0,0,0,0,0,0,145,119,1,0,
+158,119,1,0,98,14,0,0,0,0,0,0,176,119,1,0,189,119,1,0,
+99,14,0,0,0,0,0,0,203,119,1,0,212,119,1,0,103,14,0,0,
+0,0,0,0,226,119,1,0,235,119,1,0,114,14,0,0,0,0,0,0,
+255,119,1,0,4,120,1,0,116,14,0,0,0,0,0,0,15,120,1,0,
+20,120,1,0,117,14,0,0,0,0,0,0,31,120,1,0,36,120,1,0,
+118,14,0,0,0,0,0,0,50,120,1,0,55,120,1,0,119,14,0,0,
+0,0,0,0,68,120,1,0,73,120,1,0,120,14,0,0,0,0,0,0,
+87,120,1,0,92,120,1,0,121,14,0,0,0,0,0,0,107,120,1,0,
+113,120,1,0,122,14,0,0,0,0,0,0,133,120,1,0,137,120,1,0,
+139,14,0,0,0,0,0,0,142,120,1,0,147,120,1,0,140,14,0,0,
+0,0,0,0,152,120,1,0,158,120,1,0,141,14,0,0,0,0,0,0,
+163,120,1,0,170,120,1,0,142,14,0,0,0,0,0,0,175,120,1,0,
+183,120,1,0,143,14,0,0,0,0,0,0,188,120,1,0,197,120,1,0,
+144,14,0,0,0,0,0,0,202,120,1,0,214,120,1,0,2,16,0,0,
+0,0,0,0,225,120,1,0,235,120,1,0,3,16,0,0,0,0,0,0,
+247,120,1,0,253,120,1,0,4,16,0,0,0,0,0,0,9,121,1,0,
+20,121,1,0,5,16,0,0,0,0,0,0,30,121,1,0,35,121,1,0,
+6,16,0,0,0,0,0,0,46,121,1,0,55,121,1,0,7,16,0,0,
+0,0,0,0,66,121,1,0,76,121,1,0,8,16,0,0,0,0,0,0,
+86,121,1,0,91,121,1,0,9,16,0,0,0,0,0,0,101,121,1,0,
+109,121,1,0,10,16,0,0,0,0,0,0,119,121,1,0,127,121,1,0,
+11,16,0,0,0,0,0,0,137,121,1,0,144,121,1,0,12,16,0,0,
+0,0,0,0,152,121,1,0,157,121,1,0,13,16,0,0,0,0,0,0,
+165,121,1,0,174,121,1,0,14,16,0,0,0,0,0,0,183,121,1,0,
+188,121,1,0,15,16,0,0,0,0,0,0,197,121,1,0,206,121,1,0,
+16,16,0,0,0,0,0,0,215,121,1,0,226,121,1,0,17,16,0,0,
+0,0,0,0,235,121,1,0,242,121,1,0,18,16,0,0,0,0,0,0,
+253,121,1,0,6,122,1,0,19,16,0,0,0,0,0,0,17,122,1,0,
+27,122,1,0,20,16,0,0,0,0,0,0,36,122,1,0,43,122,1,0,
+21,16,0,0,0,0,0,0,53,122,1,0,59,122,1,0,22,16,0,0,
+0,0,0,0,69,122,1,0,93,122,1,0,29,16,0,0,0,0,0,0,
+102,122,1,0,115,122,1,0,30,16,0,0,0,0,0,0,125,122,1,0,
+140,122,1,0,32,16,0,0,0,0,0,0,150,122,1,0,160,122,1,0,
+33,16,0,0,0,0,0,0,170,122,1,0,182,122,1,0,34,16,0,0,
+0,0,0,0,194,122,1,0,206,122,1,0,35,16,0,0,0,0,0,0,
+216,122,1,0,230,122,1,0,37,16,0,0,0,0,0,0,240,122,1,0,
+0,123,1,0,38,16,0,0,0,0,0,0,10,123,1,0,26,123,1,0,
+39,16,0,0,0,0,0,0,37,123,1,0,55,123,1,0,42,16,0,0,
+0,0,0,0,64,123,1,0,82,123,1,0,43,16,0,0,0,0,0,0,
+92,123,1,0,100,123,1,0,44,16,0,0,0,0,0,0,110,123,1,0,
+120,123,1,0,72,16,0,0,0,0,0,0,129,123,1,0,139,123,1,0,
+73,16,0,0,0,0,0,0,148,123,1,0,158,123,1,0,74,16,0,0,
+0,0,0,0,167,123,1,0,177,123,1,0,75,16,0,0,0,0,0,0,
+186,123,1,0,196,123,1,0,76,16,0,0,0,0,0,0,205,123,1,0,
+215,123,1,0,77,16,0,0,0,0,0,0,224,123,1,0,234,123,1,0,
+78,16,0,0,0,0,0,0,243,123,1,0,253,123,1,0,79,16,0,0,
+0,0,0,0,6,124,1,0,16,124,1,0,80,16,0,0,0,0,0,0,
+25,124,1,0,35,124,1,0,81,16,0,0,0,0,0,0,44,124,1,0,
+54,124,1,0,82,16,0,0,0,0,0,0,63,124,1,0,73,124,1,0,
+83,16,0,0,0,0,0,0,82,124,1,0,92,124,1,0,84,16,0,0,
+0,0,0,0,101,124,1,0,111,124,1,0,85,16,0,0,0,0,0,0,
+120,124,1,0,130,124,1,0,86,16,0,0,0,0,0,0,139,124,1,0,
+149,124,1,0,87,16,0,0,0,0,0,0,158,124,1,0,168,124,1,0,
+88,16,0,0,0,0,0,0,177,124,1,0,187,124,1,0,89,16,0,0,
+0,0,0,0,196,124,1,0,206,124,1,0,90,16,0,0,0,0,0,0,
+215,124,1,0,225,124,1,0,91,16,0,0,0,0,0,0,234,124,1,0,
+244,124,1,0,92,16,0,0,0,0,0,0,253,124,1,0,7,125,1,0,
+93,16,0,0,0,0,0,0,16,125,1,0,26,125,1,0,94,16,0,0,
+0,0,0,0,35,125,1,0,45,125,1,0,95,16,0,0,0,0,0,0,
+54,125,1,0,64,125,1,0,96,16,0,0,0,0,0,0,73,125,1,0,
+83,125,1,0,97,16,0,0,0,0,0,0,92,125,1,0,96,125,1,0,
+113,16,0,0,0,0,0,0,104,125,1,0,108,125,1,0,114,16,0,0,
+0,0,0,0,117,125,1,0,121,125,1,0,115,16,0,0,0,0,0,0,
+127,125,1,0,130,125,1,0,116,16,0,0,0,0,0,0,142,125,1,0,
+146,125,1,0,117,16,0,0,0,0,0,0,153,125,1,0,157,125,1,0,
+118,16,0,0,0,0,0,0,162,125,1,0,166,125,1,0,119,16,0,0,
+0,0,0,0,174,125,1,0,178,125,1,0,120,16,0,0,0,0,0,0,
+186,125,1,0,189,125,1,0,121,16,0,0,0,0,0,0,194,125,1,0,
+198,125,1,0,122,16,0,0,0,0,0,0,203,125,1,0,207,125,1,0,
+123,16,0,0,0,0,0,0,220,125,1,0,224,125,1,0,124,16,0,0,
+0,0,0,0,237,125,1,0,241,125,1,0,125,16,0,0,0,0,0,0,
+1,126,1,0,5,126,1,0,126,16,0,0,0,0,0,0,15,126,1,0,
+19,126,1,0,127,16,0,0,0,0,0,0,28,126,1,0,32,126,1,0,
+128,16,0,0,0,0,0,0,42,126,1,0,45,126,1,0,129,16,0,0,
+0,0,0,0,54,126,1,0,58,126,1,0,130,16,0,0,0,0,0,0,
+67,126,1,0,70,126,1,0,131,16,0,0,0,0,0,0,77,126,1,0,
+81,126,1,0,132,16,0,0,0,0,0,0,89,126,1,0,93,126,1,0,
+133,16,0,0,0,0,0,0,103,126,1,0,106,126,1,0,139,16,0,0,
+0,0,0,0,109,126,1,0,112,126,1,0,140,16,0,0,0,0,0,0,
+115,126,1,0,118,126,1,0,141,16,0,0,0,0,0,0,121,126,1,0,
+124,126,1,0,142,16,0,0,0,0,0,0,127,126,1,0,130,126,1,0,
+143,16,0,0,0,0,0,0,133,126,1,0,136,126,1,0,144,16,0,0,
+0,0,0,0,140,126,1,0,143,126,1,0,145,16,0,0,0,0,0,0,
+146,126,1,0,149,126,1,0,146,16,0,0,0,0,0,0,155,126,1,0,
+158,126,1,0,147,16,0,0,0,0,0,0,160,126,1,0,163,126,1,0,
+148,16,0,0,0,0,0,0,166,126,1,0,169,126,1,0,149,16,0,0,
+0,0,0,0,178,126,1,0,182,126,1,0,150,16,0,0,0,0,0,0,
+199,126,1,0,208,126,1,0,151,16,0,0,0,0,0,0,224,126,1,0,
+230,126,1,0,155,16,0,0,0,0,0,0,243,126,1,0,247,126,1,0,
+156,16,0,0,0,0,0,0,251,126,1,0,255,126,1,0,157,16,0,0,
+0,0,0,0,3,127,1,0,8,127,1,0,158,16,0,0,0,0,0,0,
+10,127,1,0,20,127,1,0,164,16,0,0,0,0,0,0,23,127,1,0,
+26,127,1,0,165,16,0,0,0,0,0,0,36,127,1,0,42,127,1,0,
+166,16,0,0,0,0,0,0,52,127,1,0,55,127,1,0,167,16,0,0,
+0,0,0,0,61,127,1,0,72,127,1,0,169,16,0,0,0,0,0,0,
+79,127,1,0,94,127,1,0,171,16,0,0,0,0,0,0,99,127,1,0,
+104,127,1,0,172,16,0,0,0,0,0,0,109,127,1,0,112,127,1,0,
+173,16,0,0,0,0,0,0,117,127,1,0,121,127,1,0,174,16,0,0,
+0,0,0,0,129,127,1,0,133,127,1,0,175,16,0,0,0,0,0,0,
+142,127,1,0,150,127,1,0,181,16,0,0,0,0,0,0,155,127,1,0,
+158,127,1,0,182,16,0,0,0,0,0,0,166,127,1,0,170,127,1,0,
+183,16,0,0,0,0,0,0,178,127,1,0,187,127,1,0,208,16,0,0,
+0,0,0,0,202,127,1,0,210,127,1,0,211,16,0,0,0,0,0,0,
+219,127,1,0,231,127,1,0,212,16,0,0,0,0,0,0,244,127,1,0,
+249,127,1,0,217,16,0,0,0,0,0,0,5,128,1,0,11,128,1,0,
+218,16,0,0,0,0,0,0,25,128,1,0,34,128,1,0,232,16,0,0,
+0,0,0,0,43,128,1,0,52,128,1,0,233,16,0,0,0,0,0,0,
+62,128,1,0,72,128,1,0,234,16,0,0,0,0,0,0,81,128,1,0,
+90,128,1,0,235,16,0,0,0,0,0,0,98,128,1,0,104,128,1,0,
+236,16,0,0,0,0,0,0,111,128,1,0,119,128,1,0,237,16,0,0,
+0,0,0,0,128,128,1,0,137,128,1,0,238,16,0,0,0,0,0,0,
+146,128,1,0,153,128,1,0,239,16,0,0,0,0,0,0,161,128,1,0,
+171,128,1,0,240,16,0,0,0,0,0,0,180,128,1,0,190,128,1,0,
+241,16,0,0,0,0,0,0,199,128,1,0,207,128,1,0,242,16,0,0,
+0,0,0,0,217,128,1,0,223,128,1,0,243,16,0,0,0,0,0,0,
+230,128,1,0,238,128,1,0,244,16,0,0,0,0,0,0,245,128,1,0,
+253,128,1,0,245,16,0,0,0,0,0,0,5,129,1,0,13,129,1,0,
+246,16,0,0,0,0,0,0,20,129,1,0,32,129,1,0,247,16,0,0,
+0,0,0,0,41,129,1,0,48,129,1,0,248,16,0,0,0,0,0,0,
+55,129,1,0,62,129,1,0,249,16,0,0,0,0,0,0,70,129,1,0,
+77,129,1,0,250,16,0,0,0,0,0,0,87,129,1,0,96,129,1,0,
+251,16,0,0,0,0,0,0,104,129,1,0,113,129,1,0,252,16,0,0,
+0,0,0,0,121,129,1,0,128,129,1,0,253,16,0,0,0,0,0,0,
+137,129,1,0,144,129,1,0,254,16,0,0,0,0,0,0,151,129,1,0,
+158,129,1,0,255,16,0,0,0,0,0,0,167,129,1,0,178,129,1,0,
+0,17,0,0,0,0,0,0,185,129,1,0,197,129,1,0,1,17,0,0,
+0,0,0,0,205,129,1,0,212,129,1,0,2,17,0,0,0,0,0,0,
+219,129,1,0,228,129,1,0,3,17,0,0,0,0,0,0,236,129,1,0,
+244,129,1,0,4,17,0,0,0,0,0,0,253,129,1,0,6,130,1,0,
+5,17,0,0,0,0,0,0,17,130,1,0,26,130,1,0,6,17,0,0,
+0,0,0,0,35,130,1,0,46,130,1,0,7,17,0,0,0,0,0,0,
+53,130,1,0,61,130,1,0,8,17,0,0,0,0,0,0,68,130,1,0,
+78,130,1,0,9,17,0,0,0,0,0,0,84,130,1,0,89,130,1,0,
+10,17,0,0,0,0,0,0,99,130,1,0,107,130,1,0,11,17,0,0,
+0,0,0,0,114,130,1,0,121,130,1,0,12,17,0,0,0,0,0,0,
+130,130,1,0,138,130,1,0,13,17,0,0,0,0,0,0,148,130,1,0,
+157,130,1,0,14,17,0,0,0,0,0,0,165,130,1,0,172,130,1,0,
+15,17,0,0,0,0,0,0,180,130,1,0,187,130,1,0,16,17,0,0,
+0,0,0,0,197,130,1,0,205,130,1,0,17,17,0,0,0,0,0,0,
+213,130,1,0,218,130,1,0,18,17,0,0,0,0,0,0,225,130,1,0,
+233,130,1,0,19,17,0,0,0,0,0,0,239,130,1,0,249,130,1,0,
+20,17,0,0,0,0,0,0,2,131,1,0,13,131,1,0,21,17,0,0,
+0,0,0,0,20,131,1,0,25,131,1,0,22,17,0,0,0,0,0,0,
+31,131,1,0,39,131,1,0,23,17,0,0,0,0,0,0,45,131,1,0,
+54,131,1,0,24,17,0,0,0,0,0,0,62,131,1,0,72,131,1,0,
+25,17,0,0,0,0,0,0,80,131,1,0,90,131,1,0,26,17,0,0,
+0,0,0,0,99,131,1,0,111,131,1,0,27,17,0,0,0,0,0,0,
+118,131,1,0,126,131,1,0,28,17,0,0,0,0,0,0,133,131,1,0,
+144,131,1,0,29,17,0,0,0,0,0,0,150,131,1,0,160,131,1,0,
+30,17,0,0,0,0,0,0,167,131,1,0,172,131,1,0,31,17,0,0,
+0,0,0,0,180,131,1,0,190,131,1,0,32,17,0,0,0,0,0,0,
+199,131,1,0,206,131,1,0,33,17,0,0,0,0,0,0,214,131,1,0,
+222,131,1,0,34,17,0,0,0,0,0,0,231,131,1,0,240,131,1,0,
+35,17,0,0,0,0,0,0,249,131,1,0,2,132,1,0,36,17,0,0,
+0,0,0,0,11,132,1,0,18,132,1,0,37,17,0,0,0,0,0,0,
+25,132,1,0,32,132,1,0,38,17,0,0,0,0,0,0,40,132,1,0,
+50,132,1,0,39,17,0,0,0,0,0,0,57,132,1,0,68,132,1,0,
+40,17,0,0,0,0,0,0,78,132,1,0,87,132,1,0,41,17,0,0,
+0,0,0,0,94,132,1,0,104,132,1,0,42,17,0,0,0,0,0,0,
+113,132,1,0,122,132,1,0,43,17,0,0,0,0,0,0,131,132,1,0,
+141,132,1,0,44,17,0,0,0,0,0,0,149,132,1,0,162,132,1,0,
+45,17,0,0,0,0,0,0,172,132,1,0,183,132,1,0,46,17,0,0,
+0,0,0,0,192,132,1,0,205,132,1,0,47,17,0,0,0,0,0,0,
+215,132,1,0,222,132,1,0,48,17,0,0,0,0,0,0,231,132,1,0,
+237,132,1,0,49,17,0,0,0,0,0,0,246,132,1,0,254,132,1,0,
+50,17,0,0,0,0,0,0,6,133,1,0,14,133,1,0,51,17,0,0,
+0,0,0,0,24,133,1,0,33,133,1,0,52,17,0,0,0,0,0,0,
+41,133,1,0,51,133,1,0,53,17,0,0,0,0,0,0,58,133,1,0,
+67,133,1,0,54,17,0,0,0,0,0,0,74,133,1,0,83,133,1,0,
+55,17,0,0,0,0,0,0,93,133,1,0,102,133,1,0,56,17,0,0,
+0,0,0,0,108,133,1,0,116,133,1,0,57,17,0,0,0,0,0,0,
+124,133,1,0,131,133,1,0,58,17,0,0,0,0,0,0,140,133,1,0,
+147,133,1,0,59,17,0,0,0,0,0,0,157,133,1,0,167,133,1,0,
+60,17,0,0,0,0,0,0,173,133,1,0,180,133,1,0,61,17,0,0,
+0,0,0,0,187,133,1,0,196,133,1,0,62,17,0,0,0,0,0,0,
+205,133,1,0,216,133,1,0,63,17,0,0,0,0,0,0,224,133,1,0,
+234,133,1,0,64,17,0,0,0,0,0,0,241,133,1,0,249,133,1,0,
+65,17,0,0,0,0,0,0,3,134,1,0,12,134,1,0,66,17,0,0,
+0,0,0,0,21,134,1,0,29,134,1,0,67,17,0,0,0,0,0,0,
+38,134,1,0,47,134,1,0,68,17,0,0,0,0,0,0,57,134,1,0,
+61,134,1,0,69,17,0,0,0,0,0,0,69,134,1,0,78,134,1,0,
+70,17,0,0,0,0,0,0,85,134,1,0,94,134,1,0,71,17,0,0,
+0,0,0,0,101,134,1,0,109,134,1,0,72,17,0,0,0,0,0,0,
+118,134,1,0,127,134,1,0,73,17,0,0,0,0,0,0,135,134,1,0,
+141,134,1,0,74,17,0,0,0,0,0,0,148,134,1,0,158,134,1,0,
+75,17,0,0,0,0,0,0,165,134,1,0,173,134,1,0,76,17,0,0,
+0,0,0,0,182,134,1,0,187,134,1,0,77,17,0,0,0,0,0,0,
+193,134,1,0,203,134,1,0,78,17,0,0,0,0,0,0,210,134,1,0,
+217,134,1,0,84,17,0,0,0,0,0,0,219,134,1,0,226,134,1,0,
+85,17,0,0,0,0,0,0,233,134,1,0,239,134,1,0,86,17,0,0,
+0,0,0,0,246,134,1,0,253,134,1,0,87,17,0,0,0,0,0,0,
+4,135,1,0,14,135,1,0,88,17,0,0,0,0,0,0,25,135,1,0,
+41,135,1,0,112,17,0,0,0,0,0,0,46,135,1,0,51,135,1,0,
+113,17,0,0,0,0,0,0,67,135,1,0,81,135,1,0,114,17,0,0,
+0,0,0,0,87,135,1,0,102,135,1,0,116,17,0,0,0,0,0,0,
+109,135,1,0,124,135,1,0,117,17,0,0,0,0,0,0,132,135,1,0,
+138,135,1,0,128,17,0,0,0,0,0,0,146,135,1,0,150,135,1,0,
+129,17,0,0,0,0,0,0,164,135,1,0,168,135,1,0,130,17,0,0,
+0,0,0,0,181,135,1,0,193,135,1,0,131,17,0,0,0,0,0,0,
+205,135,1,0,209,135,1,0,132,17,0,0,0,0,0,0,220,135,1,0,
+233,135,1,0,133,17,0,0,0,0,0,0,242,135,1,0,246,135,1,0,
+134,17,0,0,0,0,0,0,3,136,1,0,15,136,1,0,136,17,0,0,
+0,0,0,0,19,136,1,0,28,136,1,0,137,17,0,0,0,0,0,0,
+34,136,1,0,46,136,1,0,138,17,0,0,0,0,0,0,50,136,1,0,
+61,136,1,0,143,17,0,0,0,0,0,0,72,136,1,0,86,136,1,0,
+144,17,0,0,0,0,0,0,102,136,1,0,115,136,1,0,145,17,0,0,
+0,0,0,0,132,136,1,0,146,136,1,0,146,17,0,0,0,0,0,0,
+160,136,1,0,173,136,1,0,147,17,0,0,0,0,0,0,189,136,1,0,
+193,136,1,0,149,17,0,0,0,0,0,0,201,136,1,0,215,136,1,0,
+153,17,0,0,0,0,0,0,222,136,1,0,227,136,1,0,154,17,0,0,
+0,0,0,0,241,136,1,0,244,136,1,0,155,17,0,0,0,0,0,0,
+252,136,1,0,5,137,1,0,162,17,0,0,0,0,0,0,16,137,1,0,
+22,137,1,0,163,17,0,0,0,0,0,0,33,137,1,0,36,137,1,0,
+164,17,0,0,0,0,0,0,45,137,1,0,54,137,1,0,165,17,0,0,
+0,0,0,0,60,137,1,0,70,137,1,0,166,17,0,0,0,0,0,0,
+82,137,1,0,88,137,1,0,180,17,0,0,0,0,0,0,106,137,1,0,
+113,137,1,0,181,17,0,0,0,0,0,0,132,137,1,0,143,137,1,0,
+182,17,0,0,0,0,0,0,157,137,1,0,166,137,1,0,183,17,0,0,
+0,0,0,0,172,137,1,0,179,137,1,0,184,17,0,0,0,0,0,0,
+188,137,1,0,201,137,1,0,191,17,0,0,0,0,0,0,217,137,1,0,
+228,137,1,0,192,17,0,0,0,0,0,0,238,137,1,0,242,137,1,0,
+193,17,0,0,0,0,0,0,253,137,1,0,2,138,1,0,194,17,0,0,
+0,0,0,0,22,138,1,0,25,138,1,0,201,17,0,0,0,0,0,0,
+33,138,1,0,38,138,1,0,202,17,0,0,0,0,0,0,44,138,1,0,
+55,138,1,0,210,17,0,0,0,0,0,0,63,138,1,0,73,138,1,0,
+211,17,0,0,0,0,0,0,84,138,1,0,88,138,1,0,212,17,0,0,
+0,0,0,0,99,138,1,0,105,138,1,0,213,17,0,0,0,0,0,0,
+112,138,1,0,116,138,1,0,214,17,0,0,0,0,0,0,126,138,1,0,
+130,138,1,0,215,17,0,0,0,0,0,0,141,138,1,0,146,138,1,0,
+216,17,0,0,0,0,0,0,150,138,1,0,166,138,1,0,225,17,0,0,
+0,0,0,0,176,138,1,0,184,138,1,0,232,17,0,0,0,0,0,0,
+190,138,1,0,204,138,1,0,233,17,0,0,0,0,0,0,214,138,1,0,
+220,138,1,0,234,17,0,0,0,0,0,0,226,138,1,0,237,138,1,0,
+241,17,0,0,0,0,0,0,251,138,1,0,0,139,1,0,242,17,0,0,
+0,0,0,0,11,139,1,0,22,139,1,0,243,17,0,0,0,0,0,0,
+33,139,1,0,44,139,1,0,244,17,0,0,0,0,0,0,60,139,1,0,
+72,139,1,0,245,17,0,0,0,0,0,0,83,139,1,0,89,139,1,0,
+246,17,0,0,0,0,0,0,101,139,1,0,112,139,1,0,248,17,0,0,
+0,0,0,0,128,139,1,0,134,139,1,0,249,17,0,0,0,0,0,0,
+145,139,1,0,157,139,1,0,250,17,0,0,0,0,0,0,173,139,1,0,
+179,139,1,0,251,17,0,0,0,0,0,0,192,139,1,0,199,139,1,0,
+252,17,0,0,0,0,0,0,212,139,1,0,224,139,1,0,4,18,0,0,
+0,0,0,0,238,139,1,0,250,139,1,0,6,18,0,0,0,0,0,0,
+11,140,1,0,21,140,1,0,15,18,0,0,0,0,0,0,39,140,1,0,
+49,140,1,0,16,18,0,0,0,0,0,0,66,140,1,0,76,140,1,0,
+17,18,0,0,0,0,0,0,89,140,1,0,99,140,1,0,18,18,0,0,
+0,0,0,0,109,140,1,0,118,140,1,0,19,18,0,0,0,0,0,0,
+131,140,1,0,141,140,1,0,20,18,0,0,0,0,0,0,152,140,1,0,
+163,140,1,0,21,18,0,0,0,0,0,0,175,140,1,0,188,140,1,0,
+22,18,0,0,0,0,0,0,202,140,1,0,212,140,1,0,23,18,0,0,
+0,0,0,0,227,140,1,0,237,140,1,0,27,18,0,0,0,0,0,0,
+252,140,1,0,6,141,1,0,28,18,0,0,0,0,0,0,18,141,1,0,
+23,141,1,0,29,18,0,0,0,0,0,0,32,141,1,0,42,141,1,0,
+33,18,0,0,0,0,0,0,49,141,1,0,59,141,1,0,34,18,0,0,
+0,0,0,0,71,141,1,0,81,141,1,0,35,18,0,0,0,0,0,0,
+93,141,1,0,103,141,1,0,36,18,0,0,0,0,0,0,116,141,1,0,
+126,141,1,0,37,18,0,0,0,0,0,0,136,141,1,0,147,141,1,0,
+38,18,0,0,0,0,0,0,160,141,1,0,170,141,1,0,39,18,0,0,
+0,0,0,0,182,141,1,0,192,141,1,0,40,18,0,0,0,0,0,0,
+204,141,1,0,216,141,1,0,41,18,0,0,0,0,0,0,228,141,1,0,
+238,141,1,0,42,18,0,0,0,0,0,0,250,141,1,0,5,142,1,0,
+43,18,0,0,0,0,0,0,15,142,1,0,26,142,1,0,44,18,0,0,
+0,0,0,0,39,142,1,0,49,142,1,0,45,18,0,0,0,0,0,0,
+66,142,1,0,79,142,1,0,46,18,0,0,0,0,0,0,93,142,1,0,
+103,142,1,0,47,18,0,0,0,0,0,0,118,142,1,0,128,142,1,0,
+51,18,0,0,0,0,0,0,143,142,1,0,153,142,1,0,52,18,0,0,
+0,0,0,0,165,142,1,0,174,142,1,0,56,18,0,0,0,0,0,0,
+188,142,1,0,198,142,1,0,57,18,0,0,0,0,0,0,213,142,1,0,
+224,142,1,0,58,18,0,0,0,0,0,0,237,142,1,0,249,142,1,0,
+79,18,0,0,0,0,0,0,7,143,1,0,18,143,1,0,80,18,0,0,
+0,0,0,0,34,143,1,0,45,143,1,0,81,18,0,0,0,0,0,0,
+59,143,1,0,72,143,1,0,82,18,0,0,0,0,0,0,85,143,1,0,
+98,143,1,0,83,18,0,0,0,0,0,0,111,143,1,0,120,143,1,0,
+84,18,0,0,0,0,0,0,135,143,1,0,144,143,1,0,85,18,0,0,
+0,0,0,0,153,143,1,0,161,143,1,0,86,18,0,0,0,0,0,0,
+172,143,1,0,181,143,1,0,90,18,0,0,0,0,0,0,195,143,1,0,
+205,143,1,0,91,18,0,0,0,0,0,0,220,143,1,0,231,143,1,0,
+92,18,0,0,0,0,0,0,244,143,1,0,255,143,1,0,93,18,0,0,
+0,0,0,0,13,144,1,0,26,144,1,0,94,18,0,0,0,0,0,0,
+41,144,1,0,49,144,1,0,98,18,0,0,0,0,0,0,62,144,1,0,
+71,144,1,0,99,18,0,0,0,0,0,0,85,144,1,0,95,144,1,0,
+100,18,0,0,0,0,0,0,106,144,1,0,116,144,1,0,101,18,0,0,
+0,0,0,0,129,144,1,0,141,144,1,0,102,18,0,0,0,0,0,0,
+155,144,1,0,165,144,1,0,106,18,0,0,0,0,0,0,178,144,1,0,
+187,144,1,0,107,18,0,0,0,0,0,0,199,144,1,0,207,144,1,0,
+108,18,0,0,0,0,0,0,221,144,1,0,231,144,1,0,109,18,0,0,
+0,0,0,0,246,144,1,0,1,145,1,0,110,18,0,0,0,0,0,0,
+17,145,1,0,29,145,1,0,111,18,0,0,0,0,0,0,46,145,1,0,
+58,145,1,0,112,18,0,0,0,0,0,0,72,145,1,0,76,145,1,0,
+113,18,0,0,0,0,0,0,86,145,1,0,102,145,1,0,117,18,0,0,
+0,0,0,0,119,145,1,0,137,145,1,0,118,18,0,0,0,0,0,0,
+153,145,1,0,168,145,1,0,119,18,0,0,0,0,0,0,186,145,1,0,
+203,145,1,0,120,18,0,0,0,0,0,0,220,145,1,0,235,145,1,0,
+121,18,0,0,0,0,0,0,254,145,1,0,16,146,1,0,122,18,0,0,
+0,0,0,0,34,146,1,0,48,146,1,0,124,18,0,0,0,0,0,0,
+65,146,1,0,81,146,1,0,125,18,0,0,0,0,0,0,95,146,1,0,
+108,146,1,0,126,18,0,0,0,0,0,0,124,146,1,0,139,146,1,0,
+127,18,0,0,0,0,0,0,154,146,1,0,167,146,1,0,128,18,0,0,
+0,0,0,0,184,146,1,0,200,146,1,0,129,18,0,0,0,0,0,0,
+216,146,1,0,225,146,1,0,133,18,0,0,0,0,0,0,240,146,1,0,
+250,146,1,0,134,18,0,0,0,0,0,0,9,147,1,0,19,147,1,0,
+135,18,0,0,0,0,0,0,30,147,1,0,40,147,1,0,136,18,0,0,
+0,0,0,0,53,147,1,0,65,147,1,0,140,18,0,0,0,0,0,0,
+79,147,1,0,89,147,1,0,141,18,0,0,0,0,0,0,104,147,1,0,
+115,147,1,0,142,18,0,0,0,0,0,0,131,147,1,0,143,147,1,0,
+143,18,0,0,0,0,0,0,159,147,1,0,171,147,1,0,144,18,0,0,
+0,0,0,0,186,147,1,0,199,147,1,0,145,18,0,0,0,0,0,0,
+214,147,1,0,226,147,1,0,146,18,0,0,0,0,0,0,243,147,1,0,
+255,147,1,0,147,18,0,0,0,0,0,0,14,148,1,0,28,148,1,0,
+148,18,0,0,0,0,0,0,42,148,1,0,56,148,1,0,149,18,0,0,
+0,0,0,0,70,148,1,0,80,148,1,0,150,18,0,0,0,0,0,0,
+96,148,1,0,105,148,1,0,151,18,0,0,0,0,0,0,117,148,1,0,
+127,148,1,0,155,18,0,0,0,0,0,0,141,148,1,0,153,148,1,0,
+156,18,0,0,0,0,0,0,165,148,1,0,177,148,1,0,157,18,0,0,
+0,0,0,0,191,148,1,0,206,148,1,0,158,18,0,0,0,0,0,0,
+220,148,1,0,233,148,1,0,159,18,0,0,0,0,0,0,247,148,1,0,
+2,149,1,0,163,18,0,0,0,0,0,0,13,149,1,0,24,149,1,0,
+164,18,0,0,0,0,0,0,40,149,1,0,57,149,1,0,165,18,0,0,
+0,0,0,0,73,149,1,0,84,149,1,0,166,18,0,0,0,0,0,0,
+106,149,1,0,116,149,1,0,170,18,0,0,0,0,0,0,127,149,1,0,
+137,149,1,0,171,18,0,0,0,0,0,0,152,149,1,0,168,149,1,0,
+172,18,0,0,0,0,0,0,183,149,1,0,193,149,1,0,176,18,0,0,
+0,0,0,0,201,149,1,0,208,149,1,0,177,18,0,0,0,0,0,0,
+214,149,1,0,222,149,1,0,178,18,0,0,0,0,0,0,235,149,1,0,
+243,149,1,0,179,18,0,0,0,0,0,0,254,149,1,0,10,150,1,0,
+183,18,0,0,0,0,0,0,16,150,1,0,27,150,1,0,184,18,0,0,
+0,0,0,0,42,150,1,0,54,150,1,0,185,18,0,0,0,0,0,0,
+60,150,1,0,71,150,1,0,186,18,0,0,0,0,0,0,86,150,1,0,
+96,150,1,0,190,18,0,0,0,0,0,0,101,150,1,0,111,150,1,0,
+191,18,0,0,0,0,0,0,123,150,1,0,131,150,1,0,192,18,0,0,
+0,0,0,0,143,150,1,0,151,150,1,0,193,18,0,0,0,0,0,0,
+164,150,1,0,173,150,1,0,194,18,0,0,0,0,0,0,183,150,1,0,
+195,150,1,0,195,18,0,0,0,0,0,0,206,150,1,0,215,150,1,0,
+196,18,0,0,0,0,0,0,229,150,1,0,239,150,1,0,208,18,0,0,
+0,0,0,0,246,150,1,0,0,151,1,0,209,18,0,0,0,0,0,0,
+10,151,1,0,14,151,1,0,210,18,0,0,0,0,0,0,24,151,1,0,
+30,151,1,0,211,18,0,0,0,0,0,0,40,151,1,0,50,151,1,0,
+212,18,0,0,0,0,0,0,65,151,1,0,76,151,1,0,213,18,0,0,
+0,0,0,0,91,151,1,0,101,151,1,0,214,18,0,0,0,0,0,0,
+115,151,1,0,126,151,1,0,215,18,0,0,0,0,0,0,139,151,1,0,
+149,151,1,0,216,18,0,0,0,0,0,0,161,151,1,0,168,151,1,0,
+217,18,0,0,0,0,0,0,178,151,1,0,189,151,1,0,218,18,0,0,
+0,0,0,0,202,151,1,0,208,151,1,0,219,18,0,0,0,0,0,0,
+223,151,1,0,230,151,1,0,220,18,0,0,0,0,0,0,236,151,1,0,
+244,151,1,0,221,18,0,0,0,0,0,0,250,151,1,0,4,152,1,0,
+222,18,0,0,0,0,0,0,13,152,1,0,25,152,1,0,223,18,0,0,
+0,0,0,0,39,152,1,0,48,152,1,0,224,18,0,0,0,0,0,0,
+60,152,1,0,75,152,1,0,228,18,0,0,0,0,0,0,84,152,1,0,
+97,152,1,0,229,18,0,0,0,0,0,0,105,152,1,0,119,152,1,0,
+230,18,0,0,0,0,0,0,128,152,1,0,140,152,1,0,234,18,0,0,
+0,0,0,0,154,152,1,0,160,152,1,0,235,18,0,0,0,0,0,0,
+178,152,1,0,190,152,1,0,236,18,0,0,0,0,0,0,208,152,1,0,
+214,152,1,0,237,18,0,0,0,0,0,0,226,152,1,0,234,152,1,0,
+238,18,0,0,0,0,0,0,248,152,1,0,255,152,1,0,239,18,0,0,
+0,0,0,0,7,153,1,0,15,153,1,0,240,18,0,0,0,0,0,0,
+23,153,1,0,30,153,1,0,241,18,0,0,0,0,0,0,38,153,1,0,
+47,153,1,0,242,18,0,0,0,0,0,0,56,153,1,0,64,153,1,0,
+243,18,0,0,0,0,0,0,73,153,1,0,82,153,1,0,244,18,0,0,
+0,0,0,0,94,153,1,0,104,153,1,0,245,18,0,0,0,0,0,0,
+113,153,1,0,123,153,1,0,249,18,0,0,0,0,0,0,133,153,1,0,
+142,153,1,0,250,18,0,0,0,0,0,0,152,153,1,0,163,153,1,0,
+8,19,0,0,0,0,0,0,178,153,1,0,185,153,1,0,9,19,0,0,
+0,0,0,0,200,153,1,0,210,153,1,0,10,19,0,0,0,0,0,0,
+224,153,1,0,234,153,1,0,11,19,0,0,0,0,0,0,248,153,1,0,
+3,154,1,0,12,19,0,0,0,0,0,0,13,154,1,0,21,154,1,0,
+13,19,0,0,0,0,0,0,35,154,1,0,42,154,1,0,14,19,0,0,
+0,0,0,0,50,154,1,0,58,154,1,0,15,19,0,0,0,0,0,0,
+71,154,1,0,80,154,1,0,19,19,0,0,0,0,0,0,92,154,1,0,
+100,154,1,0,20,19,0,0,0,0,0,0,109,154,1,0,116,154,1,0,
+21,19,0,0,0,0,0,0,129,154,1,0,135,154,1,0,22,19,0,0,
+0,0,0,0,142,154,1,0,150,154,1,0,26,19,0,0,0,0,0,0,
+161,154,1,0,168,154,1,0,27,19,0,0,0,0,0,0,176,154,1,0,
+184,154,1,0,28,19,0,0,0,0,0,0,193,154,1,0,202,154,1,0,
+29,19,0,0,0,0,0,0,210,154,1,0,218,154,1,0,30,19,0,0,
+0,0,0,0,230,154,1,0,241,154,1,0,31,19,0,0,0,0,0,0,
+249,154,1,0,255,154,1,0,35,19,0,0,0,0,0,0,10,155,1,0,
+17,155,1,0,36,19,0,0,0,0,0,0,23,155,1,0,34,155,1,0,
+37,19,0,0,0,0,0,0,40,155,1,0,46,155,1,0,38,19,0,0,
+0,0,0,0,57,155,1,0,64,155,1,0,39,19,0,0,0,0,0,0,
+70,155,1,0,81,155,1,0,40,19,0,0,0,0,0,0,87,155,1,0,
+93,155,1,0,41,19,0,0,0,0,0,0,102,155,1,0,110,155,1,0,
+42,19,0,0,0,0,0,0,119,155,1,0,127,155,1,0,43,19,0,0,
+0,0,0,0,135,155,1,0,139,155,1,0,44,19,0,0,0,0,0,0,
+147,155,1,0,155,155,1,0,45,19,0,0,0,0,0,0,163,155,1,0,
+169,155,1,0,46,19,0,0,0,0,0,0,177,155,1,0,186,155,1,0,
+47,19,0,0,0,0,0,0,194,155,1,0,201,155,1,0,48,19,0,0,
+0,0,0,0,209,155,1,0,218,155,1,0,49,19,0,0,0,0,0,0,
+226,155,1,0,234,155,1,0,50,19,0,0,0,0,0,0,242,155,1,0,
+252,155,1,0,51,19,0,0,0,0,0,0,6,156,1,0,15,156,1,0,
+52,19,0,0,0,0,0,0,25,156,1,0,35,156,1,0,53,19,0,0,
+0,0,0,0,45,156,1,0,53,156,1,0,54,19,0,0,0,0,0,0,
+63,156,1,0,75,156,1,0,55,19,0,0,0,0,0,0,86,156,1,0,
+97,156,1,0,56,19,0,0,0,0,0,0,108,156,1,0,117,156,1,0,
+57,19,0,0,0,0,0,0,128,156,1,0,138,156,1,0,58,19,0,0,
+0,0,0,0,151,156,1,0,164,156,1,0,60,19,0,0,0,0,0,0,
+175,156,1,0,194,156,1,0,65,19,0,0,0,0,0,0,203,156,1,0,
+216,156,1,0,66,19,0,0,0,0,0,0,239,156,1,0,253,156,1,0,
+67,19,0,0,0,0,0,0,14,157,1,0,33,157,1,0,68,19,0,0,
+0,0,0,0,48,157,1,0,60,157,1,0,70,19,0,0,0,0,0,0,
+69,157,1,0,80,157,1,0,71,19,0,0,0,0,0,0,97,157,1,0,
+107,157,1,0,78,19,0,0,0,0,0,0,116,157,1,0,126,157,1,0,
+79,19,0,0,0,0,0,0,136,157,1,0,147,157,1,0,80,19,0,0,
+0,0,0,0,161,157,1,0,166,157,1,0,81,19,0,0,0,0,0,0,
+176,157,1,0,182,157,1,0,82,19,0,0,0,0,0,0,192,157,1,0,
+199,157,1,0,83,19,0,0,0,0,0,0,211,157,1,0,223,157,1,0,
+84,19,0,0,0,0,0,0,230,157,1,0,238,157,1,0,85,19,0,0,
+0,0,0,0,249,157,1,0,0,158,1,0,86,19,0,0,0,0,0,0,
+13,158,1,0,22,158,1,0,87,19,0,0,0,0,0,0,32,158,1,0,
+44,158,1,0,88,19,0,0,0,0,0,0,59,158,1,0,72,158,1,0,
+89,19,0,0,0,0,0,0,88,158,1,0,104,158,1,0,90,19,0,0,
+0,0,0,0,120,158,1,0,130,158,1,0,92,19,0,0,0,0,0,0,
+137,158,1,0,147,158,1,0,93,19,0,0,0,0,0,0,154,158,1,0,
+167,158,1,0,95,19,0,0,0,0,0,0,181,158,1,0,193,158,1,0,
+96,19,0,0,0,0,0,0,210,158,1,0,224,158,1,0,97,19,0,0,
+0,0,0,0,241,158,1,0,253,158,1,0,98,19,0,0,0,0,0,0,
+9,159,1,0,24,159,1,0,99,19,0,0,0,0,0,0,38,159,1,0,
+50,159,1,0,100,19,0,0,0,0,0,0,66,159,1,0,82,159,1,0,
+101,19,0,0,0,0,0,0,94,159,1,0,110,159,1,0,102,19,0,0,
+0,0,0,0,119,159,1,0,131,159,1,0,103,19,0,0,0,0,0,0,
+147,159,1,0,159,159,1,0,104,19,0,0,0,0,0,0,175,159,1,0,
+187,159,1,0,105,19,0,0,0,0,0,0,199,159,1,0,213,159,1,0,
+106,19,0,0,0,0,0,0,227,159,1,0,241,159,1,0,107,19,0,0,
+0,0,0,0,255,159,1,0,11,160,1,0,108,19,0,0,0,0,0,0,
+26,160,1,0,38,160,1,0,109,19,0,0,0,0,0,0,50,160,1,0,
+66,160,1,0,110,19,0,0,0,0,0,0,82,160,1,0,97,160,1,0,
+111,19,0,0,0,0,0,0,113,160,1,0,125,160,1,0,115,19,0,0,
+0,0,0,0,132,160,1,0,139,160,1,0,116,19,0,0,0,0,0,0,
+153,160,1,0,159,160,1,0,117,19,0,0,0,0,0,0,174,160,1,0,
+183,160,1,0,118,19,0,0,0,0,0,0,192,160,1,0,200,160,1,0,
+119,19,0,0,0,0,0,0,214,160,1,0,222,160,1,0,120,19,0,0,
+0,0,0,0,232,160,1,0,241,160,1,0,121,19,0,0,0,0,0,0,
+251,160,1,0,8,161,1,0,126,19,0,0,0,0,0,0,18,161,1,0,
+33,161,1,0,127,19,0,0,0,0,0,0,50,161,1,0,61,161,1,0,
+128,19,0,0,0,0,0,0,80,161,1,0,91,161,1,0,129,19,0,0,
+0,0,0,0,108,161,1,0,121,161,1,0,130,19,0,0,0,0,0,0,
+135,161,1,0,147,161,1,0,133,19,0,0,0,0,0,0,157,161,1,0,
+171,161,1,0,134,19,0,0,0,0,0,0,187,161,1,0,197,161,1,0,
+135,19,0,0,0,0,0,0,215,161,1,0,225,161,1,0,136,19,0,0,
+0,0,0,0,241,161,1,0,253,161,1,0,137,19,0,0,0,0,0,0,
+10,162,1,0,24,162,1,0,145,19,0,0,0,0,0,0,32,162,1,0,
+45,162,1,0,146,19,0,0,0,0,0,0,63,162,1,0,77,162,1,0,
+148,19,0,0,0,0,0,0,84,162,1,0,88,162,1,0,149,19,0,0,
+0,0,0,0,102,162,1,0,115,162,1,0,150,19,0,0,0,0,0,0,
+133,162,1,0,147,162,1,0,152,19,0,0,0,0,0,0,155,162,1,0,
+168,162,1,0,153,19,0,0,0,0,0,0,186,162,1,0,199,162,1,0,
+154,19,0,0,0,0,0,0,216,162,1,0,229,162,1,0,155,19,0,0,
+0,0,0,0,247,162,1,0,252,162,1,0,156,19,0,0,0,0,0,0,
+9,163,1,0,27,163,1,0,157,19,0,0,0,0,0,0,42,163,1,0,
+55,163,1,0,163,19,0,0,0,0,0,0,64,163,1,0,75,163,1,0,
+168,19,0,0,0,0,0,0,84,163,1,0,95,163,1,0,169,19,0,0,
+0,0,0,0,110,163,1,0,121,163,1,0,170,19,0,0,0,0,0,0,
+132,163,1,0,143,163,1,0,171,19,0,0,0,0,0,0,159,163,1,0,
+170,163,1,0,172,19,0,0,0,0,0,0,186,163,1,0,199,163,1,0,
+174,19,0,0,0,0,0,0,208,163,1,0,220,163,1,0,175,19,0,0,
+0,0,0,0,229,163,1,0,241,163,1,0,178,19,0,0,0,0,0,0,
+3,164,1,0,17,164,1,0,179,19,0,0,0,0,0,0,33,164,1,0,
+44,164,1,0,180,19,0,0,0,0,0,0,61,164,1,0,79,164,1,0,
+181,19,0,0,0,0,0,0,90,164,1,0,101,164,1,0,183,19,0,0,
+0,0,0,0,118,164,1,0,131,164,1,0,184,19,0,0,0,0,0,0,
+146,164,1,0,156,164,1,0,185,19,0,0,0,0,0,0,172,164,1,0,
+189,164,1,0,186,19,0,0,0,0,0,0,199,164,1,0,208,164,1,0,
+190,19,0,0,0,0,0,0,217,164,1,0,231,164,1,0,192,19,0,0,
+0,0,0,0,239,164,1,0,251,164,1,0,193,19,0,0,0,0,0,0,
+4,165,1,0,7,165,1,0,194,19,0,0,0,0,0,0,20,165,1,0,
+26,165,1,0,196,19,0,0,0,0,0,0,34,165,1,0,44,165,1,0,
+202,19,0,0,0,0,0,0,53,165,1,0,64,165,1,0,203,19,0,0,
+0,0,0,0,74,165,1,0,85,165,1,0,204,19,0,0,0,0,0,0,
+95,165,1,0,105,165,1,0,205,19,0,0,0,0,0,0,120,165,1,0,
+129,165,1,0,206,19,0,0,0,0,0,0,144,165,1,0,149,165,1,0,
+212,19,0,0,0,0,0,0,160,165,1,0,166,165,1,0,213,19,0,0,
+0,0,0,0,176,165,1,0,183,165,1,0,214,19,0,0,0,0,0,0,
+194,165,1,0,200,165,1,0,215,19,0,0,0,0,0,0,212,165,1,0,
+214,165,1,0,225,19,0,0,0,0,0,0,219,165,1,0,221,165,1,0,
+226,19,0,0,0,0,0,0,234,165,1,0,236,165,1,0,227,19,0,0,
+0,0,0,0,245,165,1,0,254,165,1,0,228,19,0,0,0,0,0,0,
+7,166,1,0,9,166,1,0,229,19,0,0,0,0,0,0,18,166,1,0,
+26,166,1,0,230,19,0,0,0,0,0,0,35,166,1,0,38,166,1,0,
+231,19,0,0,0,0,0,0,43,166,1,0,46,166,1,0,232,19,0,0,
+0,0,0,0,51,166,1,0,54,166,1,0,233,19,0,0,0,0,0,0,
+56,166,1,0,59,166,1,0,234,19,0,0,0,0,0,0,64,166,1,0,
+66,166,1,0,235,19,0,0,0,0,0,0,73,166,1,0,87,166,1,0,
+242,19,0,0,0,0,0,0,103,166,1,0,107,166,1,0,243,19,0,0,
+0,0,0,0,113,166,1,0,121,166,1,0,244,19,0,0,0,0,0,0,
+131,166,1,0,142,166,1,0,245,19,0,0,0,0,0,0,155,166,1,0,
+162,166,1,0,246,19,0,0,0,0,0,0,171,166,1,0,178,166,1,0,
+247,19,0,0,0,0,0,0,187,166,1,0,195,166,1,0,248,19,0,0,
+0,0,0,0,209,166,1,0,213,166,1,0,249,19,0,0,0,0,0,0,
+219,166,1,0,230,166,1,0,250,19,0,0,0,0,0,0,243,166,1,0,
+252,166,1,0,251,19,0,0,0,0,0,0,7,167,1,0,18,167,1,0,
+252,19,0,0,0,0,0,0,31,167,1,0,38,167,1,0,253,19,0,0,
+0,0,0,0,42,167,1,0,47,167,1,0,254,19,0,0,0,0,0,0,
+54,167,1,0,60,167,1,0,255,19,0,0,0,0,0,0,65,167,1,0,
+71,167,1,0,0,20,0,0,0,0,0,0,83,167,1,0,88,167,1,0,
+1,20,0,0,0,0,0,0,99,167,1,0,105,167,1,0,2,20,0,0,
+0,0,0,0,113,167,1,0,120,167,1,0,3,20,0,0,0,0,0,0,
+129,167,1,0,138,167,1,0,4,20,0,0,0,0,0,0,149,167,1,0,
+154,167,1,0,5,20,0,0,0,0,0,0,161,167,1,0,170,167,1,0,
+6,20,0,0,0,0,0,0,181,167,1,0,187,167,1,0,153,0,0,0,
+0,0,0,0,192,167,1,0,198,167,1,0,154,0,0,0,0,0,0,0,
+203,167,1,0,207,167,1,0,155,0,0,0,0,0,0,0,212,167,1,0,
+217,167,1,0,156,0,0,0,0,0,0,0,222,167,1,0,227,167,1,0,
+157,0,0,0,0,0,0,0,232,167,1,0,237,167,1,0,158,0,0,0,
+0,0,0,0,241,167,1,0,246,167,1,0,159,0,0,0,0,0,0,0,
+250,167,1,0,0,168,1,0,160,0,0,0,0,0,0,0,4,168,1,0,
+9,168,1,0,161,0,0,0,0,0,0,0,13,168,1,0,19,168,1,0,
+162,0,0,0,0,0,0,0,23,168,1,0,28,168,1,0,163,0,0,0,
+0,0,0,0,32,168,1,0,37,168,1,0,164,0,0,0,0,0,0,0,
+42,168,1,0,47,168,1,0,165,0,0,0,0,0,0,0,52,168,1,0,
+58,168,1,0,166,0,0,0,0,0,0,0,63,168,1,0,69,168,1,0,
+167,0,0,0,0,0,0,0,74,168,1,0,80,168,1,0,168,0,0,0,
+0,0,0,0,85,168,1,0,90,168,1,0,169,0,0,0,0,0,0,0,
+95,168,1,0,100,168,1,0,170,0,0,0,0,0,0,0,106,168,1,0,
+112,168,1,0,171,0,0,0,0,0,0,0,118,168,1,0,123,168,1,0,
+172,0,0,0,0,0,0,0,129,168,1,0,135,168,1,0,173,0,0,0,
+0,0,0,0,141,168,1,0,147,168,1,0,174,0,0,0,0,0,0,0,
+153,168,1,0,161,168,1,0,176,0,0,0,0,0,0,0,165,168,1,0,
+170,168,1,0,177,0,0,0,0,0,0,0,174,168,1,0,179,168,1,0,
+178,0,0,0,0,0,0,0,183,168,1,0,188,168,1,0,179,0,0,0,
+0,0,0,0,192,168,1,0,197,168,1,0,180,0,0,0,0,0,0,0,
+201,168,1,0,208,168,1,0,181,0,0,0,0,0,0,0,210,168,1,0,
+217,168,1,0,182,0,0,0,0,0,0,0,219,168,1,0,226,168,1,0,
+183,0,0,0,0,0,0,0,228,168,1,0,233,168,1,0,185,0,0,0,
+0,0,0,0,238,168,1,0,243,168,1,0,186,0,0,0,0,0,0,0,
+248,168,1,0,253,168,1,0,187,0,0,0,0,0,0,0,2,169,1,0,
+7,169,1,0,188,0,0,0,0,0,0,0,12,169,1,0,17,169,1,0,
+189,0,0,0,0,0,0,0,22,169,1,0,27,169,1,0,190,0,0,0,
+0,0,0,0,32,169,1,0,35,169,1,0,191,0,0,0,0,0,0,0,
+40,169,1,0,43,169,1,0,192,0,0,0,0,0,0,0,48,169,1,0,
+51,169,1,0,193,0,0,0,0,0,0,0,56,169,1,0,59,169,1,0,
+194,0,0,0,0,0,0,0,64,169,1,0,67,169,1,0,195,0,0,0,
+0,0,0,0,72,169,1,0,75,169,1,0,196,0,0,0,0,0,0,0,
+80,169,1,0,82,169,1,0,198,0,0,0,0,0,0,0,88,169,1,0,
+90,169,1,0,199,0,0,0,0,0,0,0,96,169,1,0,98,169,1,0,
+200,0,0,0,0,0,0,0,102,169,1,0,104,169,1,0,201,0,0,0,
+0,0,0,0,109,169,1,0,111,169,1,0,202,0,0,0,0,0,0,0,
+116,169,1,0,118,169,1,0,203,0,0,0,0,0,0,0,123,169,1,0,
+125,169,1,0,204,0,0,0,0,0,0,0,130,169,1,0,132,169,1,0,
+205,0,0,0,0,0,0,0,137,169,1,0,139,169,1,0,206,0,0,0,
+0,0,0,0,145,169,1,0,148,169,1,0,207,0,0,0,0,0,0,0,
+153,169,1,0,155,169,1,0,208,0,0,0,0,0,0,0,160,169,1,0,
+162,169,1,0,209,0,0,0,0,0,0,0,168,169,1,0,170,169,1,0,
+210,0,0,0,0,0,0,0,176,169,1,0,178,169,1,0,211,0,0,0,
+0,0,0,0,184,169,1,0,186,169,1,0,212,0,0,0,0,0,0,0,
+191,169,1,0,193,169,1,0,213,0,0,0,0,0,0,0,198,169,1,0,
+200,169,1,0,214,0,0,0,0,0,0,0,206,169,1,0,208,169,1,0,
+215,0,0,0,0,0,0,0,213,169,1,0,215,169,1,0,216,0,0,0,
+0,0,0,0,221,169,1,0,223,169,1,0,217,0,0,0,0,0,0,0,
+229,169,1,0,232,169,1,0,71,6,0,0,0,0,0,0,235,169,1,0,
+242,169,1,0,72,6,0,0,0,0,0,0,245,169,1,0,254,169,1,0,
+73,6,0,0,0,0,0,0,1,170,1,0,5,170,1,0,75,6,0,0,
+0,0,0,0,9,170,1,0,12,170,1,0,142,7,0,0,0,0,0,0,
+15,170,1,0,23,170,1,0,143,7,0,0,0,0,0,0,26,170,1,0,
+28,170,1,0,221,19,0,0,0,0,0,0,32,170,1,0,34,170,1,0,
+222,19,0,0,0,0,0,0,38,170,1,0,40,170,1,0,223,19,0,0,
+0,0,0,0,44,170,1,0,46,170,1,0,224,19,0,0,0,0,0,0,
+52,170,1,0,63,170,1,0,65,170,1,0,72,170,1,0,98,170,1,0,
+74,170,1,0,94,170,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+80,2,0,0,0,0,0,0,109,170,1,0,122,170,1,0,124,170,1,0,
+135,170,1,0,171,170,1,0,137,170,1,0,167,170,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,81,2,0,0,0,0,0,0,184,170,1,0,
+194,170,1,0,196,170,1,0,212,170,1,0,243,170,1,0,214,170,1,0,
+239,170,1,0,255,255,255,255,0,0,0,0,0,0,0,0,82,2,0,0,
+0,0,0,0,253,170,1,0,4,171,1,0,6,171,1,0,255,255,255,255,
+23,171,1,0,10,171,1,0,255,255,255,255,255,255,255,255,0,0,0,0,
+0,0,0,0,83,2,0,0,0,0,0,0,30,171,1,0,33,171,1,0,
+35,171,1,0,53,171,1,0,86,171,1,0,54,171,1,0,76,171,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,130,2,0,0,0,0,0,0,
+89,171,1,0,95,171,1,0,97,171,1,0,111,171,1,0,136,171,1,0,
+112,171,1,0,134,171,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+145,2,0,0,0,0,0,0,142,171,1,0,154,171,1,0,156,171,1,0,
+165,171,1,0,188,171,1,0,166,171,1,0,186,171,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,146,2,0,0,0,0,0,0,200,171,1,0,
+206,171,1,0,208,171,1,0,233,171,1,0,9,172,1,0,234,171,1,0,
+7,172,1,0,255,255,255,255,0,0,0,0,0,0,0,0,163,2,0,0,
+0,0,0,0,15,172,1,0,30,172,1,0,32,172,1,0,41,172,1,0,
+67,172,1,0,42,172,1,0,65,172,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,164,2,0,0,0,0,0,0,82,172,1,0,94,172,1,0,
+96,172,1,0,117,172,1,0,156,172,1,0,118,172,1,0,154,172,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,190,2,0,0,0,0,0,0,
+168,172,1,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,176,172,1,0,40,107,1,0,14,0,0,0,
+226,2,0,0,0,0,0,0,181,172,1,0,186,172,1,0,188,172,1,0,
+208,172,1,0,240,172,1,0,209,172,1,0,232,172,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,184,4,0,0,0,0,0,0,245,172,1,0,
+251,172,1,0,253,172,1,0,14,173,1,0,47,173,1,0,15,173,1,0,
+40,173,1,0,255,255,255,255,0,0,0,0,0,0,0,0,244,4,0,0,
+0,0,0,0,53,173,1,0,59,173,1,0,61,173,1,0,77,173,1,0,
+106,173,1,0,79,173,1,0,103,173,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,248,4,0,0,0,0,0,0,112,173,1,0,125,173,1,0,
+127,173,1,0,156,173,1,0,205,173,1,0,157,173,1,0,200,173,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,95,7,0,0,0,0,0,0,
+218,173,1,0,233,173,1,0,235,173,1,0,10,174,1,0,63,174,1,0,
+11,174,1,0,58,174,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+97,7,0,0,0,0,0,0,78,174,1,0,92,174,1,0,94,174,1,0,
+124,174,1,0,175,174,1,0,125,174,1,0,170,174,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,99,7,0,0,0,0,0,0,189,174,1,0,
+204,174,1,0,206,174,1,0,237,174,1,0,34,175,1,0,238,174,1,0,
+29,175,1,0,255,255,255,255,0,0,0,0,0,0,0,0,101,7,0,0,
+0,0,0,0,49,175,1,0,55,175,1,0,57,175,1,0,93,175,1,0,
+141,175,1,0,95,175,1,0,134,175,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,3,9,0,0,0,0,0,0,147,175,1,0,156,175,1,0,
+158,175,1,0,181,175,1,0,221,175,1,0,183,175,1,0,214,175,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,5,9,0,0,0,0,0,0,
+230,175,1,0,239,175,1,0,241,175,1,0,8,176,1,0,49,176,1,0,
+10,176,1,0,42,176,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+8,9,0,0,0,0,0,0,58,176,1,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,63,176,1,0,
+8,108,1,0,62,0,0,0,36,9,0,0,0,0,0,0,70,176,1,0,
+80,176,1,0,82,176,1,0,107,176,1,0,154,176,1,0,109,176,1,0,
+147,176,1,0,255,255,255,255,0,0,0,0,0,0,0,0,42,9,0,0,
+0,0,0,0,164,176,1,0,168,176,1,0,170,176,1,0,177,176,1,0,
+190,176,1,0,179,176,1,0,188,176,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,17,10,0,0,0,0,0,0,194,176,1,0,202,176,1,0,
+204,176,1,0,214,176,1,0,234,176,1,0,216,176,1,0,232,176,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,18,10,0,0,0,0,0,0,
+242,176,1,0,245,176,1,0,247,176,1,0,1,177,1,0,16,177,1,0,
+3,177,1,0,14,177,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+19,10,0,0,0,0,0,0,19,177,1,0,23,177,1,0,25,177,1,0,
+33,177,1,0,48,177,1,0,35,177,1,0,46,177,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,20,10,0,0,0,0,0,0,52,177,1,0,
+56,177,1,0,58,177,1,0,67,177,1,0,83,177,1,0,69,177,1,0,
+81,177,1,0,255,255,255,255,0,0,0,0,0,0,0,0,21,10,0,0,
+0,0,0,0,87,177,1,0,91,177,1,0,93,177,1,0,102,177,1,0,
+118,177,1,0,104,177,1,0,116,177,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,22,10,0,0,0,0,0,0,122,177,1,0,126,177,1,0,
+128,177,1,0,137,177,1,0,153,177,1,0,139,177,1,0,151,177,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,23,10,0,0,0,0,0,0,
+157,177,1,0,162,177,1,0,164,177,1,0,171,177,1,0,186,177,1,0,
+173,177,1,0,184,177,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+24,10,0,0,0,0,0,0,191,177,1,0,195,177,1,0,197,177,1,0,
+205,177,1,0,220,177,1,0,207,177,1,0,218,177,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,26,10,0,0,0,0,0,0,224,177,1,0,
+228,177,1,0,230,177,1,0,242,177,1,0,7,178,1,0,244,177,1,0,
+5,178,1,0,255,255,255,255,0,0,0,0,0,0,0,0,34,10,0,0,
+0,0,0,0,11,178,1,0,16,178,1,0,18,178,1,0,31,178,1,0,
+54,178,1,0,33,178,1,0,52,178,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,35,10,0,0,0,0,0,0,59,178,1,0,64,178,1,0,
+66,178,1,0,83,178,1,0,110,178,1,0,85,178,1,0,108,178,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,36,10,0,0,0,0,0,0,
+115,178,1,0,119,178,1,0,121,178,1,0,148,178,1,0,176,178,1,0,
+150,178,1,0,174,178,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+41,10,0,0,0,0,0,0,180,178,1,0,184,178,1,0,186,178,1,0,
+193,178,1,0,207,178,1,0,195,178,1,0,205,178,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,42,10,0,0,0,0,0,0,211,178,1,0,
+217,178,1,0,219,178,1,0,240,178,1,0,19,179,1,0,242,178,1,0,
+16,179,1,0,255,255,255,255,0,0,0,0,0,0,0,0,50,10,0,0,
+0,0,0,0,25,179,1,0,31,179,1,0,33,179,1,0,51,179,1,0,
+86,179,1,0,53,179,1,0,80,179,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,51,10,0,0,0,0,0,0,92,179,1,0,98,179,1,0,
+100,179,1,0,114,179,1,0,137,179,1,0,116,179,1,0,135,179,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,52,10,0,0,0,0,0,0,
+143,179,1,0,155,179,1,0,157,179,1,0,174,179,1,0,213,179,1,0,
+176,179,1,0,211,179,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+225,11,0,0,0,0,0,0,225,179,1,0,235,179,1,0,237,179,1,0,
+8,180,1,0,47,180,1,0,9,180,1,0,45,180,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,162,14,0,0,0,0,0,0,57,180,1,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,69,180,1,0,232,111,1,0,16,0,0,0,183,14,0,0,
+0,0,0,0,72,180,1,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,83,180,1,0,232,112,1,0,
+10,0,0,0,216,14,0,0,0,0,0,0,107,180,1,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+116,180,1,0,136,113,1,0,10,0,0,0,230,14,0,0,0,0,0,0,
+143,180,1,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,153,180,1,0,40,114,1,0,8,0,0,0,
+243,14,0,0,0,0,0,0,156,180,1,0,167,180,1,0,169,180,1,0,
+187,180,1,0,222,180,1,0,188,180,1,0,220,180,1,0,255,255,255,255,
+0,0,0,0,0,0,0,0,252,14,0,0,0,0,0,0,233,180,1,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,240,180,1,0,168,114,1,0,28,0,0,0,71,15,0,0,
+0,0,0,0,247,180,1,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,254,180,1,0,104,116,1,0,
+39,0,0,0,112,15,0,0,0,0,0,0,5,181,1,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+21,181,1,0,216,118,1,0,36,0,0,0,156,15,0,0,0,0,0,0,
+28,181,1,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,39,181,1,0,24,121,1,0,41,0,0,0,
+207,15,0,0,0,0,0,0,46,181,1,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,54,181,1,0,
+168,123,1,0,19,0,0,0,231,15,0,0,0,0,0,0,61,181,1,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,68,181,1,0,216,124,1,0,13,0,0,0,252,15,0,0,
+0,0,0,0,75,181,1,0,84,181,1,0,86,181,1,0,106,181,1,0,
+142,181,1,0,107,181,1,0,139,181,1,0,255,255,255,255,0,0,0,0,
+0,0,0,0,62,16,0,0,0,0,0,0,151,181,1,0,162,181,1,0,
+164,181,1,0,183,181,1,0,215,181,1,0,184,181,1,0,212,181,1,0,
+255,255,255,255,0,0,0,0,0,0,0,0,103,16,0,0,0,0,0,0,
+226,181,1,0,237,181,1,0,239,181,1,0,249,181,1,0,19,182,1,0,
+250,181,1,0,16,182,1,0,255,255,255,255,0,0,0,0,0,0,0,0,
+107,16,0,0,0,0,0,0,0,0,0,0,0,0,176,63,143,194,245,40,
+92,213,131,64,0,0,0,0,0,0,192,63,143,194,245,40,92,157,132,64,
+0,0,0,0,0,0,208,63,143,194,245,40,92,101,133,64,0,0,0,0,
+0,0,224,63,143,194,245,40,92,45,134,64,0,0,0,0,0,0,240,63,
+143,194,245,40,92,245,134,64,0,0,0,0,0,0,0,64,143,194,245,40,
+92,189,135,64,0,0,0,0,0,0,8,64,143,194,245,40,92,133,136,64,
+0,0,0,0,0,0,16,64,143,194,245,40,92,77,137,64,0,0,0,0,
+0,0,20,64,143,194,245,40,92,21,138,64,0,0,0,0,0,0,24,64,
+143,194,245,40,92,221,138,64,0,0,0,0,0,0,28,64,143,194,245,40,
+92,165,139,64,0,0,0,0,0,0,32,64,143,194,245,40,92,109,140,64,
+0,0,0,0,0,0,34,64,143,194,245,40,92,53,141,64,0,0,0,0,
+0,0,36,64,143,194,245,40,92,253,141,64,0,0,0,0,0,0,0,0,
+26,192,91,32,65,241,239,63,0,0,0,0,0,0,224,63,226,88,23,183,
+209,0,240,63,0,0,0,0,0,0,240,63,70,37,117,2,154,8,240,63,
+0,0,0,0,0,0,248,63,170,241,210,77,98,16,240,63,0,0,0,0,
+0,0,0,64,127,106,188,116,147,24,240,63,0,0,0,0,0,0,4,64,
+227,54,26,192,91,32,240,63,0,0,0,0,0,0,8,64,184,175,3,231,
+140,40,240,63,0,0,0,0,0,0,12,64,141,40,237,13,190,48,240,63,
+0,0,0,0,0,0,16,64,98,161,214,52,239,56,240,63,0,0,0,0,
+0,0,20,64,155,230,29,167,232,72,240,63,0,0,0,0,0,0,22,64,
+112,95,7,206,25,81,240,63,0,0,0,0,0,0,24,64,69,216,240,244,
+74,89,240,63,0,0,0,0,0,0,26,64,26,81,218,27,124,97,240,63,
+0,0,0,0,0,0,28,64,96,118,79,30,22,106,240,63,0,0,0,0,
+0,0,30,64,53,239,56,69,71,114,240,63,0,0,0,0,0,0,32,64,
+10,104,34,108,120,122,240,63,0,0,0,0,0,0,33,64,80,141,151,110,
+18,131,240,63,0,0,0,0,0,0,34,64,37,6,129,149,67,139,240,63,
+0,0,0,0,0,0,35,64,107,43,246,151,221,147,240,63,0,0,0,0,
+0,0,36,64,64,164,223,190,14,156,240,63,0,0,0,0,0,0,38,64,
+204,238,201,195,66,173,240,63,0,0,0,0,0,0,40,64,88,57,180,200,
+118,190,240,63,0,0,0,0,0,0,42,64,228,131,158,205,170,207,240,63,
+0,0,0,0,0,0,44,64,112,206,136,210,222,224,240,63,0,0,0,0,
+0,0,46,64,109,197,254,178,123,242,240,63,0,0,0,0,0,0,48,64,
+106,188,116,147,24,4,241,63,0,0,0,0,0,0,49,64,104,179,234,115,
+181,21,241,63,0,0,0,0,0,0,50,64,214,86,236,47,187,39,241,63,
+0,0,0,0,0,0,51,64,68,250,237,235,192,57,241,63,0,0,0,0,
+0,0,52,64,178,157,239,167,198,75,241,63,0,0,0,0,0,0,54,64,
+0,145,126,251,58,112,241,63,0,0,0,0,0,0,56,64,47,221,36,6,
+129,149,241,63,0,0,0,0,0,0,58,64,208,213,86,236,47,187,241,63,
+0,0,0,0,0,0,60,64,225,122,20,174,71,225,241,63,0,0,0,0,
+0,0,62,64,213,120,233,38,49,8,242,63,0,0,0,0,0,0,64,64,
+58,35,74,123,131,47,242,63,0,0,0,0,0,0,65,64,129,38,194,134,
+167,87,242,63,0,0,0,0,0,0,66,64,199,41,58,146,203,127,242,63,
+0,0,0,0,0,0,67,64,97,50,85,48,42,169,242,63,0,0,0,0,
+0,0,68,64,109,231,251,169,241,210,242,63,0,0,0,0,0,0,69,64,
+233,72,46,255,33,253,242,63,0,0,0,0,0,0,70,64,214,86,236,47,
+187,39,243,63,0,0,0,0,0,0,71,64,22,106,77,243,142,83,243,63,
+0,0,0,0,0,0,72,64,86,125,174,182,98,127,243,63,0,0,0,0,
+0,0,73,64,121,233,38,49,8,172,243,63,0,0,0,0,0,0,74,64,
+125,174,182,98,127,217,243,63,0,0,0,0,0,0,75,64,243,31,210,111,
+95,7,244,63,0,0,0,0,0,0,76,64,75,234,4,52,17,54,244,63,
+0,0,0,0,0,0,77,64,19,97,195,211,43,101,244,63,0,0,0,0,
+0,0,78,64,190,48,153,42,24,149,244,63,0,0,0,0,0,0,79,64,
+75,89,134,56,214,197,244,63,0,0,0,0,0,0,80,64,73,46,255,33,
+253,246,244,63,0,0,0,0,0,128,80,64,184,175,3,231,140,40,245,63,
+0,0,0,0,0,0,81,64,122,54,171,62,87,91,245,63,0,0,0,0,
+0,128,81,64,60,189,82,150,33,142,245,63,0,0,0,0,0,0,82,64,
+82,73,157,128,38,194,245,63,0,0,0,0,0,128,82,64,103,213,231,106,
+43,246,245,63,0,0,0,0,0,0,83,64,94,186,73,12,2,43,246,63,
+0,0,0,0,0,128,83,64,56,248,194,100,170,96,246,63,0,0,0,0,
+0,0,84,64,17,54,60,189,82,150,246,63,0,0,0,0,0,128,84,64,
+205,204,204,204,204,204,246,63,0,0,0,0,0,0,85,64,136,99,93,220,
+70,3,247,63,0,0,0,0,0,0,24,192,0,0,0,0,0,0,224,63,
+0,0,0,0,0,0,20,192,25,4,86,14,45,178,221,63,0,0,0,0,
+0,0,8,192,154,153,153,153,153,153,217,63,0,0,0,0,0,0,0,192,
+2,43,135,22,217,206,215,63,0,0,0,0,0,0,8,64,84,227,165,155,
+196,32,208,63,0,0,0,0,0,0,24,64,250,126,106,188,116,147,200,63,
+0,0,0,0,0,0,36,64,252,169,241,210,77,98,192,63,0,0,0,0,
+0,0,44,64,123,20,174,71,225,122,180,63,0,0,0,0,0,0,51,64,
+123,20,174,71,225,122,164,63,0,0,0,0,0,0,55,64,250,126,106,188,
+116,147,152,63,0,0,0,0,0,0,58,64,59,223,79,141,151,110,146,63,
+0,0,0,0,0,0,60,64,172,173,216,95,118,79,142,63,0,0,0,0,
+0,0,62,64,19,97,195,211,43,101,137,63,0,0,0,0,0,128,67,64,
+148,246,6,95,152,76,117,63,0,0,0,0,0,128,72,64,97,50,85,48,
+42,169,83,63,0,0,0,0,0,0,73,64,252,169,241,210,77,98,80,63,
+0,0,0,0,0,0,20,192,0,0,0,0,0,192,114,64,0,0,0,0,
+0,0,240,63,0,0,0,0,0,128,102,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,0,73,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,0,68,64,0,0,0,0,0,0,49,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,0,56,64,0,0,0,0,
+0,0,58,64,0,0,0,0,0,0,40,64,0,0,0,0,0,0,63,64,
+0,0,0,0,0,0,28,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,0,18,64,0,0,0,0,0,0,67,64,0,0,0,0,0,0,16,64,
+0,0,0,0,0,0,20,192,0,0,0,0,0,192,114,64,0,0,0,0,
+0,0,240,63,0,0,0,0,0,128,102,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,0,73,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,0,68,64,0,0,0,0,0,0,49,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,0,56,64,0,0,0,0,
+0,0,58,64,0,0,0,0,0,0,40,64,0,0,0,0,0,0,63,64,
+0,0,0,0,0,0,28,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,0,18,64,0,0,0,0,0,0,67,64,0,0,0,0,0,0,16,64,
+0,0,0,0,0,0,240,63,252,169,241,210,77,98,96,63,0,0,0,0,
+0,0,36,64,123,20,174,71,225,122,148,63,0,0,0,0,0,0,46,64,
+123,20,174,71,225,122,164,63,0,0,0,0,0,0,51,64,184,30,133,235,
+81,184,174,63,0,0,0,0,0,0,55,64,154,153,153,153,153,153,185,63,
+0,0,0,0,0,0,56,64,0,0,0,0,0,0,192,63,0,0,0,0,
+0,0,59,64,0,0,0,0,0,0,224,63,0,0,0,0,0,0,60,64,
+0,0,0,0,0,0,240,63,0,0,0,0,0,0,40,64,0,0,0,0,
+0,92,156,64,0,0,0,0,0,0,48,64,0,0,0,0,0,176,148,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,64,143,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,224,135,64,0,0,0,0,0,0,62,64,
+0,0,0,0,0,16,132,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,208,128,64,0,0,0,0,0,0,68,64,0,0,0,0,0,144,122,64,
+0,0,0,0,0,0,73,64,0,0,0,0,0,0,117,64,0,0,0,0,
+0,0,78,64,0,0,0,0,0,208,112,64,0,0,0,0,0,0,84,64,
+0,0,0,0,0,32,105,64,0,0,0,0,0,0,89,64,0,0,0,0,
+0,64,100,64,0,0,0,0,0,0,94,64,0,0,0,0,0,64,95,64,
+0,0,0,0,0,192,98,64,0,0,0,0,0,0,89,64,0,0,0,0,
+0,128,102,64,0,0,0,0,0,128,84,64,0,0,0,0,0,128,107,64,
+0,0,0,0,0,0,81,64,0,0,0,0,0,0,110,64,0,0,0,0,
+0,64,77,64,0,0,0,0,0,128,113,64,154,153,153,153,153,25,74,64,
+0,0,0,0,0,0,116,64,154,153,153,153,153,25,71,64,0,0,0,0,
+0,128,118,64,0,0,0,0,0,64,68,64,0,0,0,0,0,0,121,64,
+0,0,0,0,0,128,65,64,0,0,0,0,0,64,127,64,51,51,51,51,
+51,51,62,64,0,0,0,0,0,192,130,64,205,204,204,204,204,204,57,64,
+0,0,0,0,0,0,137,64,205,204,204,204,204,204,53,64,0,0,0,0,
+0,64,143,64,205,204,204,204,204,76,50,64,0,0,0,0,0,192,146,64,
+154,153,153,153,153,153,46,64,0,0,0,0,0,112,151,64,51,51,51,51,
+51,51,41,64,0,0,0,0,0,64,159,64,154,153,153,153,153,153,36,64,
+0,0,0,0,0,136,163,64,205,204,204,204,204,204,32,64,0,0,0,0,
+0,0,16,64,0,0,0,0,0,26,179,64,0,0,0,0,0,0,20,64,
+0,0,0,0,0,29,176,64,0,0,0,0,0,0,24,64,0,0,0,0,
+0,8,171,64,0,0,0,0,0,0,28,64,0,0,0,0,0,168,166,64,
+0,0,0,0,0,0,32,64,0,0,0,0,0,56,163,64,0,0,0,0,
+0,0,36,64,0,0,0,0,0,74,160,64,0,0,0,0,0,0,40,64,
+0,0,0,0,0,148,155,64,0,0,0,0,0,0,44,64,0,0,0,0,
+0,248,150,64,0,0,0,0,0,0,48,64,0,0,0,0,0,56,147,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,64,144,64,0,0,0,0,
+0,0,54,64,0,0,0,0,0,168,139,64,0,0,0,0,0,0,56,64,
+0,0,0,0,0,72,135,64,0,0,0,0,0,0,62,64,0,0,0,0,
+0,136,131,64,0,0,0,0,0,0,66,64,0,0,0,0,0,104,128,64,
+0,0,0,0,0,0,68,64,0,0,0,0,0,96,123,64,0,0,0,0,
+0,0,71,64,0,0,0,0,0,32,119,64,0,0,0,0,0,0,75,64,
+0,0,0,0,0,96,115,64,0,0,0,0,0,0,78,64,0,0,0,0,
+0,64,112,64,0,0,0,0,0,128,81,64,0,0,0,0,0,64,107,64,
+0,0,0,0,0,0,84,64,0,0,0,0,0,32,103,64,0,0,0,0,
+0,128,86,64,0,0,0,0,0,64,99,64,0,0,0,0,0,0,89,64,
+0,0,0,0,0,32,96,64,0,0,0,0,0,0,94,64,0,0,0,0,
+0,64,91,64,0,0,0,0,0,192,98,64,0,0,0,0,0,128,84,64,
+0,0,0,0,0,128,102,64,0,0,0,0,0,64,81,64,0,0,0,0,
+0,128,107,64,0,0,0,0,0,0,77,64,0,0,0,0,0,192,108,64,
+0,0,0,0,0,128,74,64,0,0,0,0,0,0,110,64,0,0,0,0,
+0,64,70,64,0,0,0,0,0,128,113,64,0,0,0,0,0,64,66,64,
+0,0,0,0,0,0,116,64,51,51,51,51,51,51,61,64,0,0,0,0,
+0,128,118,64,205,204,204,204,204,204,54,64,0,0,0,0,0,0,121,64,
+205,204,204,204,204,76,49,64,0,0,0,0,0,64,127,64,154,153,153,153,
+153,153,41,64,0,0,0,0,0,192,130,64,154,153,153,153,153,153,34,64,
+0,0,0,0,0,0,137,64,0,0,0,0,0,0,26,64,0,0,0,0,
+0,64,143,64,0,0,0,0,0,0,18,64,0,0,0,0,0,192,146,64,
+0,0,0,0,0,0,8,64,0,0,0,0,0,112,151,64,0,0,0,0,
+0,0,0,64,0,0,0,0,0,64,159,64,51,51,51,51,51,51,243,63,
+0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,0,0,0,0,
+0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,0,0,24,64,
+0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,0,0,0,0,
+0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,0,56,163,64,
+0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,0,0,0,0,
+0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,0,64,144,64,
+0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,0,0,62,64,
+0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,0,96,123,64,
+0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,0,0,0,0,
+0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,0,0,78,64,
+0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,0,0,0,0,
+0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,0,32,103,64,
+0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,0,0,0,0,
+0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,0,0,94,64,
+0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,0,0,0,0,
+0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,0,64,81,64,
+0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,0,0,0,0,
+0,0,110,64,0,0,0,0,0,0,73,64,0,0,0,0,0,128,113,64,
+0,0,0,0,0,192,67,64,0,0,0,0,0,0,116,64,0,0,0,0,
+0,128,61,64,0,0,0,0,0,128,118,64,0,0,0,0,0,0,55,64,
+0,0,0,0,0,0,121,64,0,0,0,0,0,64,50,64,0,0,0,0,
+0,64,127,64,205,204,204,204,204,204,43,64,0,0,0,0,0,192,130,64,
+154,153,153,153,153,25,37,64,0,0,0,0,0,0,137,64,154,153,153,153,
+153,153,30,64,0,0,0,0,0,64,143,64,51,51,51,51,51,51,23,64,
+0,0,0,0,0,192,146,64,102,102,102,102,102,102,14,64,0,0,0,0,
+0,0,16,64,0,0,0,0,0,26,179,64,0,0,0,0,0,0,20,64,
+0,0,0,0,0,29,176,64,0,0,0,0,0,0,24,64,0,0,0,0,
+0,8,171,64,0,0,0,0,0,0,28,64,0,0,0,0,0,168,166,64,
+0,0,0,0,0,0,32,64,0,0,0,0,0,56,163,64,0,0,0,0,
+0,0,36,64,0,0,0,0,0,74,160,64,0,0,0,0,0,0,40,64,
+0,0,0,0,0,148,155,64,0,0,0,0,0,0,44,64,0,0,0,0,
+0,248,150,64,0,0,0,0,0,0,48,64,0,0,0,0,0,56,147,64,
+0,0,0,0,0,0,52,64,0,0,0,0,0,64,144,64,0,0,0,0,
+0,0,54,64,0,0,0,0,0,168,139,64,0,0,0,0,0,0,56,64,
+0,0,0,0,0,72,135,64,0,0,0,0,0,0,62,64,0,0,0,0,
+0,136,131,64,0,0,0,0,0,0,66,64,0,0,0,0,0,104,128,64,
+0,0,0,0,0,0,68,64,0,0,0,0,0,96,123,64,0,0,0,0,
+0,0,71,64,0,0,0,0,0,32,119,64,0,0,0,0,0,0,75,64,
+0,0,0,0,0,96,115,64,0,0,0,0,0,0,78,64,0,0,0,0,
+0,64,112,64,0,0,0,0,0,128,81,64,0,0,0,0,0,64,107,64,
+0,0,0,0,0,0,84,64,0,0,0,0,0,32,103,64,0,0,0,0,
+0,128,86,64,0,0,0,0,0,64,99,64,0,0,0,0,0,0,89,64,
+0,0,0,0,0,32,96,64,0,0,0,0,0,0,94,64,0,0,0,0,
+0,64,91,64,0,0,0,0,0,192,98,64,0,0,0,0,0,128,84,64,
+0,0,0,0,0,128,102,64,0,0,0,0,0,64,81,64,0,0,0,0,
+0,128,107,64,0,0,0,0,0,0,77,64,0,0,0,0,0,0,110,64,
+0,0,0,0,0,0,73,64,0,0,0,0,0,128,113,64,0,0,0,0,
+0,192,67,64,0,0,0,0,0,0,116,64,0,0,0,0,0,128,61,64,
+0,0,0,0,0,128,118,64,0,0,0,0,0,0,55,64,0,0,0,0,
+0,0,121,64,0,0,0,0,0,64,50,64,0,0,0,0,0,64,127,64,
+205,204,204,204,204,204,43,64,0,0,0,0,0,192,130,64,154,153,153,153,
+153,25,37,64,0,0,0,0,0,0,137,64,0,0,0,0,0,0,39,64,
+0,0,0,0,0,64,143,64,0,0,0,0,0,0,35,64,0,0,0,0,
+0,64,159,64,205,204,204,204,204,204,28,64,0,0,0,0,0,136,163,64,
+0,0,0,0,0,0,22,64,0,0,0,0,0,112,167,64,0,0,0,0,
+0,0,16,64,0,0,0,0,0,64,175,64,0,0,0,0,0,0,8,64,
+0,0,0,0,0,112,183,64,0,0,0,0,0,0,0,64,0,0,0,0,
+0,64,191,64,51,51,51,51,51,51,243,63,0,0,0,0,0,192,98,64,
+0,0,0,0,0,192,82,64,0,0,0,0,0,128,102,64,0,0,0,0,
+0,128,79,64,0,0,0,0,0,128,107,64,0,0,0,0,0,128,74,64,
+0,0,0,0,0,128,113,64,0,0,0,0,0,0,72,64,0,0,0,0,
+0,0,116,64,0,0,0,0,0,0,68,64,0,0,0,0,0,128,118,64,
+0,0,0,0,0,128,65,64,0,0,0,0,0,0,121,64,0,0,0,0,
+0,0,62,64,0,0,0,0,0,192,130,64,0,0,0,0,0,0,52,64,
+0,0,0,0,0,224,133,64,0,0,0,0,0,0,49,64,0,0,0,0,
+0,0,137,64,0,0,0,0,0,0,44,64,0,0,0,0,0,64,143,64,
+0,0,0,0,0,0,39,64,0,0,0,0,0,192,146,64,0,0,0,0,
+0,0,35,64,0,0,0,0,0,112,151,64,0,0,0,0,0,0,32,64,
+0,0,0,0,0,64,159,64,205,204,204,204,204,204,26,64,0,0,0,0,
+0,136,163,64,0,0,0,0,0,0,22,64,0,0,0,0,0,112,167,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,64,175,64,0,0,0,0,
+0,0,8,64,0,0,0,0,0,112,183,64,0,0,0,0,0,0,0,64,
+0,0,0,0,0,64,191,64,51,51,51,51,51,51,243,63,0,0,0,0,
+0,0,48,64,154,153,153,153,153,153,46,64,0,0,0,0,0,0,57,64,
+205,204,204,204,204,204,53,64,0,0,0,0,0,0,62,64,154,153,153,153,
+153,153,55,64,0,0,0,0,0,128,65,64,0,0,0,0,0,192,57,64,
+0,0,0,0,0,128,70,64,0,0,0,0,0,128,65,64,0,0,0,0,
+0,0,78,64,154,153,153,153,153,25,71,64,0,0,0,0,0,64,80,64,
+0,0,0,0,0,192,74,64,0,0,0,0,0,192,82,64,0,0,0,0,
+0,64,77,64,0,0,0,0,0,128,86,64,0,0,0,0,0,64,80,64,
+0,0,0,0,0,128,91,64,0,0,0,0,0,128,83,64,0,0,0,0,
+0,64,96,64,0,0,0,0,0,64,87,64,0,0,0,0,0,0,100,64,
+0,0,0,0,0,192,95,64,0,0,0,0,0,0,105,64,0,0,0,0,
+0,128,99,64,36,182,1,0,39,182,1,0,82,0,0,0,0,0,0,0,
+41,182,1,0,50,182,1,0,83,0,0,0,0,0,0,0,53,182,1,0,
+55,182,1,0,85,0,0,0,0,0,0,0,57,182,1,0,64,182,1,0,
+86,0,0,0,0,0,0,0,66,182,1,0,68,182,1,0,89,0,0,0,
+0,0,0,0,70,182,1,0,76,182,1,0,90,0,0,0,0,0,0,0,
+78,182,1,0,80,182,1,0,94,0,0,0,0,0,0,0,82,182,1,0,
+89,182,1,0,95,0,0,0,0,0,0,0,91,182,1,0,95,182,1,0,
+96,0,0,0,0,0,0,0,102,182,1,0,105,182,1,0,98,0,0,0,
+0,0,0,0,107,182,1,0,115,182,1,0,99,0,0,0,0,0,0,0,
+118,182,1,0,122,182,1,0,106,0,0,0,0,0,0,0,124,182,1,0,
+129,182,1,0,107,0,0,0,0,0,0,0,133,182,1,0,135,182,1,0,
+114,0,0,0,0,0,0,0,137,182,1,0,144,182,1,0,115,0,0,0,
+0,0,0,0,146,182,1,0,153,182,1,0,126,0,0,0,0,0,0,0,
+168,182,1,0,171,182,1,0,129,0,0,0,0,0,0,0,186,182,1,0,
+196,182,1,0,130,0,0,0,0,0,0,0,199,182,1,0,203,182,1,0,
+138,0,0,0,0,0,0,0,205,182,1,0,209,182,1,0,141,0,0,0,
+0,0,0,0,211,182,1,0,215,182,1,0,223,0,0,0,0,0,0,0,
+217,182,1,0,221,182,1,0,224,0,0,0,0,0,0,0,223,182,1,0,
+230,182,1,0,225,0,0,0,0,0,0,0,232,182,1,0,239,182,1,0,
+226,0,0,0,0,0,0,0,241,182,1,0,247,182,1,0,227,0,0,0,
+0,0,0,0,249,182,1,0,0,183,1,0,228,0,0,0,0,0,0,0,
+2,183,1,0,7,183,1,0,229,0,0,0,0,0,0,0,9,183,1,0,
+19,183,1,0,230,0,0,0,0,0,0,0,21,183,1,0,26,183,1,0,
+231,0,0,0,0,0,0,0,28,183,1,0,38,183,1,0,232,0,0,0,
+0,0,0,0,40,183,1,0,44,183,1,0,233,0,0,0,0,0,0,0,
+46,183,1,0,52,183,1,0,234,0,0,0,0,0,0,0,54,183,1,0,
+60,183,1,0,235,0,0,0,0,0,0,0,62,183,1,0,67,183,1,0,
+236,0,0,0,0,0,0,0,69,183,1,0,73,183,1,0,237,0,0,0,
+0,0,0,0,76,183,1,0,83,183,1,0,238,0,0,0,0,0,0,0,
+86,183,1,0,93,183,1,0,239,0,0,0,0,0,0,0,96,183,1,0,
+105,183,1,0,240,0,0,0,0,0,0,0,108,183,1,0,117,183,1,0,
+241,0,0,0,0,0,0,0,120,183,1,0,128,183,1,0,242,0,0,0,
+0,0,0,0,131,183,1,0,139,183,1,0,243,0,0,0,0,0,0,0,
+142,183,1,0,152,183,1,0,244,0,0,0,0,0,0,0,155,183,1,0,
+164,183,1,0,245,0,0,0,0,0,0,0,167,183,1,0,176,183,1,0,
+246,0,0,0,0,0,0,0,179,183,1,0,186,183,1,0,247,0,0,0,
+0,0,0,0,189,183,1,0,196,183,1,0,248,0,0,0,0,0,0,0,
+199,183,1,0,205,183,1,0,249,0,0,0,0,0,0,0,208,183,1,0,
+214,183,1,0,250,0,0,0,0,0,0,0,217,183,1,0,223,183,1,0,
+251,0,0,0,0,0,0,0,226,183,1,0,234,183,1,0,252,0,0,0,
+0,0,0,0,237,183,1,0,244,183,1,0,253,0,0,0,0,0,0,0,
+247,183,1,0,254,183,1,0,254,0,0,0,0,0,0,0,1,184,1,0,
+9,184,1,0,255,0,0,0,0,0,0,0,13,184,1,0,22,184,1,0,
+0,1,0,0,0,0,0,0,27,184,1,0,35,184,1,0,1,1,0,0,
+0,0,0,0,39,184,1,0,52,184,1,0,10,1,0,0,0,0,0,0,
+56,184,1,0,70,184,1,0,11,1,0,0,0,0,0,0,75,184,1,0,
+92,184,1,0,12,1,0,0,0,0,0,0,97,184,1,0,114,184,1,0,
+13,1,0,0,0,0,0,0,119,184,1,0,135,184,1,0,14,1,0,0,
+0,0,0,0,140,184,1,0,156,184,1,0,15,1,0,0,0,0,0,0,
+161,184,1,0,176,184,1,0,16,1,0,0,0,0,0,0,181,184,1,0,
+196,184,1,0,17,1,0,0,0,0,0,0,201,184,1,0,219,184,1,0,
+18,1,0,0,0,0,0,0,234,184,1,0,249,184,1,0,19,1,0,0,
+0,0,0,0,254,184,1,0,15,185,1,0,20,1,0,0,0,0,0,0,
+20,185,1,0,38,185,1,0,21,1,0,0,0,0,0,0,43,185,1,0,
+61,185,1,0,22,1,0,0,0,0,0,0,66,185,1,0,89,185,1,0,
+23,1,0,0,0,0,0,0,94,185,1,0,113,185,1,0,24,1,0,0,
+0,0,0,0,118,185,1,0,136,185,1,0,25,1,0,0,0,0,0,0,
+141,185,1,0,162,185,1,0,26,1,0,0,0,0,0,0,167,185,1,0,
+186,185,1,0,27,1,0,0,0,0,0,0,191,185,1,0,211,185,1,0,
+28,1,0,0,0,0,0,0,216,185,1,0,234,185,1,0,29,1,0,0,
+0,0,0,0,239,185,1,0,250,185,1,0,31,1,0,0,0,0,0,0,
+0,186,1,0,7,186,1,0,32,1,0,0,0,0,0,0,13,186,1,0,
+25,186,1,0,34,1,0,0,0,0,0,0,35,186,1,0,48,186,1,0,
+35,1,0,0,0,0,0,0,58,186,1,0,74,186,1,0,36,1,0,0,
+0,0,0,0,84,186,1,0,100,186,1,0,37,1,0,0,0,0,0,0,
+110,186,1,0,125,186,1,0,38,1,0,0,0,0,0,0,135,186,1,0,
+150,186,1,0,39,1,0,0,0,0,0,0,160,186,1,0,174,186,1,0,
+40,1,0,0,0,0,0,0,184,186,1,0,198,186,1,0,41,1,0,0,
+0,0,0,0,208,186,1,0,225,186,1,0,42,1,0,0,0,0,0,0,
+239,186,1,0,253,186,1,0,43,1,0,0,0,0,0,0,8,187,1,0,
+24,187,1,0,44,1,0,0,0,0,0,0,35,187,1,0,52,187,1,0,
+45,1,0,0,0,0,0,0,63,187,1,0,80,187,1,0,46,1,0,0,
+0,0,0,0,91,187,1,0,113,187,1,0,47,1,0,0,0,0,0,0,
+124,187,1,0,142,187,1,0,48,1,0,0,0,0,0,0,153,187,1,0,
+170,187,1,0,49,1,0,0,0,0,0,0,181,187,1,0,199,187,1,0,
+50,1,0,0,0,0,0,0,210,187,1,0,228,187,1,0,51,1,0,0,
+0,0,0,0,239,187,1,0,2,188,1,0,52,1,0,0,0,0,0,0,
+13,188,1,0,30,188,1,0,53,1,0,0,0,0,0,0,41,188,1,0,
+50,188,1,0,57,1,0,0,0,0,0,0,63,188,1,0,72,188,1,0,
+58,1,0,0,0,0,0,0,87,188,1,0,97,188,1,0,59,1,0,0,
+0,0,0,0,112,188,1,0,125,188,1,0,60,1,0,0,0,0,0,0,
+140,188,1,0,153,188,1,0,61,1,0,0,0,0,0,0,168,188,1,0,
+180,188,1,0,62,1,0,0,0,0,0,0,195,188,1,0,207,188,1,0,
+63,1,0,0,0,0,0,0,222,188,1,0,233,188,1,0,64,1,0,0,
+0,0,0,0,248,188,1,0,3,189,1,0,65,1,0,0,0,0,0,0,
+18,189,1,0,32,189,1,0,66,1,0,0,0,0,0,0,43,189,1,0,
+54,189,1,0,67,1,0,0,0,0,0,0,70,189,1,0,83,189,1,0,
+71,1,0,0,0,0,0,0,92,189,1,0,105,189,1,0,72,1,0,0,
+0,0,0,0,114,189,1,0,128,189,1,0,73,1,0,0,0,0,0,0,
+138,189,1,0,155,189,1,0,74,1,0,0,0,0,0,0,168,189,1,0,
+185,189,1,0,75,1,0,0,0,0,0,0,198,189,1,0,214,189,1,0,
+76,1,0,0,0,0,0,0,226,189,1,0,242,189,1,0,77,1,0,0,
+0,0,0,0,254,189,1,0,13,190,1,0,78,1,0,0,0,0,0,0,
+24,190,1,0,39,190,1,0,79,1,0,0,0,0,0,0,50,190,1,0,
+68,190,1,0,80,1,0,0,0,0,0,0,82,190,1,0,97,190,1,0,
+81,1,0,0,0,0,0,0,108,190,1,0,116,190,1,0,90,1,0,0,
+0,0,0,0,129,190,1,0,138,190,1,0,91,1,0,0,0,0,0,0,
+152,190,1,0,164,190,1,0,92,1,0,0,0,0,0,0,181,190,1,0,
+193,190,1,0,93,1,0,0,0,0,0,0,210,190,1,0,221,190,1,0,
+94,1,0,0,0,0,0,0,237,190,1,0,248,190,1,0,95,1,0,0,
+0,0,0,0,8,191,1,0,18,191,1,0,96,1,0,0,0,0,0,0,
+33,191,1,0,43,191,1,0,97,1,0,0,0,0,0,0,58,191,1,0,
+71,191,1,0,98,1,0,0,0,0,0,0,89,191,1,0,99,191,1,0,
+99,1,0,0,0,0,0,0,114,191,1,0,126,191,1,0,100,1,0,0,
+0,0,0,0,143,191,1,0,156,191,1,0,101,1,0,0,0,0,0,0,
+174,191,1,0,187,191,1,0,102,1,0,0,0,0,0,0,205,191,1,0,
+223,191,1,0,103,1,0,0,0,0,0,0,246,191,1,0,4,192,1,0,
+104,1,0,0,0,0,0,0,23,192,1,0,36,192,1,0,105,1,0,0,
+0,0,0,0,54,192,1,0,70,192,1,0,106,1,0,0,0,0,0,0,
+91,192,1,0,105,192,1,0,107,1,0,0,0,0,0,0,124,192,1,0,
+139,192,1,0,108,1,0,0,0,0,0,0,159,192,1,0,172,192,1,0,
+109,1,0,0,0,0,0,0,190,192,1,0,197,192,1,0,125,1,0,0,
+0,0,0,0,208,192,1,0,210,192,1,0,126,1,0,0,0,0,0,0,
+217,192,1,0,224,192,1,0,127,1,0,0,0,0,0,0,230,192,1,0,
+233,192,1,0,128,1,0,0,0,0,0,0,240,192,1,0,246,192,1,0,
+129,1,0,0,0,0,0,0,250,192,1,0,252,192,1,0,130,1,0,0,
+0,0,0,0,2,193,1,0,7,193,1,0,131,1,0,0,0,0,0,0,
+11,193,1,0,13,193,1,0,132,1,0,0,0,0,0,0,18,193,1,0,
+26,193,1,0,133,1,0,0,0,0,0,0,30,193,1,0,32,193,1,0,
+134,1,0,0,0,0,0,0,40,193,1,0,45,193,1,0,135,1,0,0,
+0,0,0,0,49,193,1,0,51,193,1,0,136,1,0,0,0,0,0,0,
+56,193,1,0,60,193,1,0,137,1,0,0,0,0,0,0,64,193,1,0,
+72,193,1,0,138,1,0,0,0,0,0,0,76,193,1,0,78,193,1,0,
+139,1,0,0,0,0,0,0,86,193,1,0,92,193,1,0,140,1,0,0,
+0,0,0,0,96,193,1,0,98,193,1,0,141,1,0,0,0,0,0,0,
+104,193,1,0,110,193,1,0,142,1,0,0,0,0,0,0,114,193,1,0,
+117,193,1,0,143,1,0,0,0,0,0,0,123,193,1,0,129,193,1,0,
+144,1,0,0,0,0,0,0,134,193,1,0,136,193,1,0,145,1,0,0,
+0,0,0,0,142,193,1,0,148,193,1,0,146,1,0,0,0,0,0,0,
+155,193,1,0,157,193,1,0,147,1,0,0,0,0,0,0,163,193,1,0,
+169,193,1,0,148,1,0,0,0,0,0,0,172,193,1,0,175,193,1,0,
+149,1,0,0,0,0,0,0,181,193,1,0,188,193,1,0,157,1,0,0,
+0,0,0,0,194,193,1,0,199,193,1,0,158,1,0,0,0,0,0,0,
+208,193,1,0,215,193,1,0,159,1,0,0,0,0,0,0,224,193,1,0,
+229,193,1,0,160,1,0,0,0,0,0,0,238,193,1,0,246,193,1,0,
+161,1,0,0,0,0,0,0,253,193,1,0,4,194,1,0,162,1,0,0,
+0,0,0,0,9,194,1,0,15,194,1,0,163,1,0,0,0,0,0,0,
+22,194,1,0,34,194,1,0,164,1,0,0,0,0,0,0,44,194,1,0,
+50,194,1,0,165,1,0,0,0,0,0,0,54,194,1,0,60,194,1,0,
+166,1,0,0,0,0,0,0,67,194,1,0,76,194,1,0,167,1,0,0,
+0,0,0,0,89,194,1,0,96,194,1,0,168,1,0,0,0,0,0,0,
+109,194,1,0,116,194,1,0,169,1,0,0,0,0,0,0,124,194,1,0,
+136,194,1,0,170,1,0,0,0,0,0,0,142,194,1,0,153,194,1,0,
+171,1,0,0,0,0,0,0,157,194,1,0,169,194,1,0,172,1,0,0,
+0,0,0,0,177,194,1,0,188,194,1,0,173,1,0,0,0,0,0,0,
+194,194,1,0,204,194,1,0,174,1,0,0,0,0,0,0,210,194,1,0,
+219,194,1,0,175,1,0,0,0,0,0,0,233,194,1,0,246,194,1,0,
+176,1,0,0,0,0,0,0,6,195,1,0,14,195,1,0,177,1,0,0,
+0,0,0,0,28,195,1,0,43,195,1,0,178,1,0,0,0,0,0,0,
+57,195,1,0,67,195,1,0,179,1,0,0,0,0,0,0,85,195,1,0,
+105,195,1,0,180,1,0,0,0,0,0,0,125,195,1,0,130,195,1,0,
+187,1,0,0,0,0,0,0,138,195,1,0,141,195,1,0,188,1,0,0,
+0,0,0,0,146,195,1,0,148,195,1,0,189,1,0,0,0,0,0,0,
+153,195,1,0,159,195,1,0,190,1,0,0,0,0,0,0,167,195,1,0,
+169,195,1,0,191,1,0,0,0,0,0,0,175,195,1,0,185,195,1,0,
+192,1,0,0,0,0,0,0,191,195,1,0,198,195,1,0,193,1,0,0,
+0,0,0,0,212,195,1,0,218,195,1,0,194,1,0,0,0,0,0,0,
+225,195,1,0,231,195,1,0,195,1,0,0,0,0,0,0,244,195,1,0,
+252,195,1,0,196,1,0,0,0,0,0,0,3,196,1,0,7,196,1,0,
+197,1,0,0,0,0,0,0,14,196,1,0,18,196,1,0,198,1,0,0,
+0,0,0,0,27,196,1,0,34,196,1,0,199,1,0,0,0,0,0,0,
+45,196,1,0,52,196,1,0,200,1,0,0,0,0,0,0,62,196,1,0,
+65,196,1,0,201,1,0,0,0,0,0,0,70,196,1,0,74,196,1,0,
+202,1,0,0,0,0,0,0,82,196,1,0,88,196,1,0,203,1,0,0,
+0,0,0,0,96,196,1,0,105,196,1,0,204,1,0,0,0,0,0,0,
+119,196,1,0,121,196,1,0,205,1,0,0,0,0,0,0,127,196,1,0,
+129,196,1,0,206,1,0,0,0,0,0,0,135,196,1,0,139,196,1,0,
+212,1,0,0,0,0,0,0,147,196,1,0,154,196,1,0,213,1,0,0,
+0,0,0,0,161,196,1,0,170,196,1,0,214,1,0,0,0,0,0,0,
+178,196,1,0,184,196,1,0,215,1,0,0,0,0,0,0,202,196,1,0,
+211,196,1,0,216,1,0,0,0,0,0,0,217,196,1,0,223,196,1,0,
+221,1,0,0,0,0,0,0,231,196,1,0,236,196,1,0,223,1,0,0,
+0,0,0,0,246,196,1,0,251,196,1,0,227,1,0,0,0,0,0,0,
+6,197,1,0,15,197,1,0,230,1,0,0,0,0,0,0,26,197,1,0,
+34,197,1,0,231,1,0,0,0,0,0,0,37,197,1,0,45,197,1,0,
+232,1,0,0,0,0,0,0,53,197,1,0,59,197,1,0,233,1,0,0,
+0,0,0,0,68,197,1,0,77,197,1,0,234,1,0,0,0,0,0,0,
+85,197,1,0,91,197,1,0,236,1,0,0,0,0,0,0,101,197,1,0,
+108,197,1,0,237,1,0,0,0,0,0,0,119,197,1,0,124,197,1,0,
+238,1,0,0,0,0,0,0,131,197,1,0,138,197,1,0,239,1,0,0,
+0,0,0,0,149,197,1,0,156,197,1,0,240,1,0,0,0,0,0,0,
+160,197,1,0,169,197,1,0,241,1,0,0,0,0,0,0,176,197,1,0,
+182,197,1,0,242,1,0,0,0,0,0,0,190,197,1,0,194,197,1,0,
+243,1,0,0,0,0,0,0,203,197,1,0,214,197,1,0,244,1,0,0,
+0,0,0,0,224,197,1,0,230,197,1,0,245,1,0,0,0,0,0,0,
+236,197,1,0,242,197,1,0,246,1,0,0,0,0,0,0,251,197,1,0,
+5,198,1,0,248,1,0,0,0,0,0,0,14,198,1,0,26,198,1,0,
+249,1,0,0,0,0,0,0,31,198,1,0,38,198,1,0,250,1,0,0,
+0,0,0,0,50,198,1,0,61,198,1,0,251,1,0,0,0,0,0,0,
+71,198,1,0,80,198,1,0,253,1,0,0,0,0,0,0,95,198,1,0,
+102,198,1,0,1,2,0,0,0,0,0,0,111,198,1,0,114,198,1,0,
+2,2,0,0,0,0,0,0,121,198,1,0,125,198,1,0,3,2,0,0,
+0,0,0,0,137,198,1,0,143,198,1,0,7,2,0,0,0,0,0,0,
+161,198,1,0,167,198,1,0,9,2,0,0,0,0,0,0,175,198,1,0,
+179,198,1,0,10,2,0,0,0,0,0,0,185,198,1,0,189,198,1,0,
+16,2,0,0,0,0,0,0,191,198,1,0,198,198,1,0,17,2,0,0,
+0,0,0,0,203,198,1,0,207,198,1,0,18,2,0,0,0,0,0,0,
+214,198,1,0,219,198,1,0,19,2,0,0,0,0,0,0,226,198,1,0,
+229,198,1,0,20,2,0,0,0,0,0,0,234,198,1,0,238,198,1,0,
+21,2,0,0,0,0,0,0,244,198,1,0,246,198,1,0,22,2,0,0,
+0,0,0,0,250,198,1,0,253,198,1,0,23,2,0,0,0,0,0,0,
+1,199,1,0,6,199,1,0,24,2,0,0,0,0,0,0,12,199,1,0,
+15,199,1,0,25,2,0,0,0,0,0,0,20,199,1,0,29,199,1,0,
+26,2,0,0,0,0,0,0,35,199,1,0,45,199,1,0,27,2,0,0,
+0,0,0,0,52,199,1,0,58,199,1,0,28,2,0,0,0,0,0,0,
+67,199,1,0,70,199,1,0,29,2,0,0,0,0,0,0,79,199,1,0,
+84,199,1,0,30,2,0,0,0,0,0,0,94,199,1,0,100,199,1,0,
+31,2,0,0,0,0,0,0,108,199,1,0,113,199,1,0,33,2,0,0,
+0,0,0,0,123,199,1,0,130,199,1,0,41,2,0,0,0,0,0,0,
+142,199,1,0,149,199,1,0,42,2,0,0,0,0,0,0,162,199,1,0,
+166,199,1,0,43,2,0,0,0,0,0,0,173,199,1,0,180,199,1,0,
+44,2,0,0,0,0,0,0,187,199,1,0,194,199,1,0,45,2,0,0,
+0,0,0,0,206,199,1,0,216,199,1,0,46,2,0,0,0,0,0,0,
+223,199,1,0,225,199,1,0,47,2,0,0,0,0,0,0,232,199,1,0,
+239,199,1,0,48,2,0,0,0,0,0,0,251,199,1,0,5,200,1,0,
+49,2,0,0,0,0,0,0,12,200,1,0,14,200,1,0,50,2,0,0,
+0,0,0,0,21,200,1,0,24,200,1,0,51,2,0,0,0,0,0,0,
+26,200,1,0,37,200,1,0,52,2,0,0,0,0,0,0,48,200,1,0,
+57,200,1,0,53,2,0,0,0,0,0,0,68,200,1,0,77,200,1,0,
+54,2,0,0,0,0,0,0,88,200,1,0,96,200,1,0,55,2,0,0,
+0,0,0,0,107,200,1,0,112,200,1,0,57,2,0,0,0,0,0,0,
+124,200,1,0,129,200,1,0,58,2,0,0,0,0,0,0,136,200,1,0,
+147,200,1,0,59,2,0,0,0,0,0,0,152,200,1,0,156,200,1,0,
+60,2,0,0,0,0,0,0,161,200,1,0,172,200,1,0,61,2,0,0,
+0,0,0,0,185,200,1,0,189,200,1,0,62,2,0,0,0,0,0,0,
+206,200,1,0,212,200,1,0,63,2,0,0,0,0,0,0,216,200,1,0,
+233,200,1,0,64,2,0,0,0,0,0,0,245,200,1,0,6,201,1,0,
+65,2,0,0,0,0,0,0,29,201,1,0,38,201,1,0,66,2,0,0,
+0,0,0,0,52,201,1,0,63,201,1,0,68,2,0,0,0,0,0,0,
+75,201,1,0,83,201,1,0,69,2,0,0,0,0,0,0,95,201,1,0,
+99,201,1,0,71,2,0,0,0,0,0,0,112,201,1,0,125,201,1,0,
+72,2,0,0,0,0,0,0,146,201,1,0,153,201,1,0,89,2,0,0,
+0,0,0,0,161,201,1,0,174,201,1,0,90,2,0,0,0,0,0,0,
+190,201,1,0,203,201,1,0,91,2,0,0,0,0,0,0,223,201,1,0,
+236,201,1,0,92,2,0,0,0,0,0,0,0,202,1,0,13,202,1,0,
+93,2,0,0,0,0,0,0,26,202,1,0,39,202,1,0,94,2,0,0,
+0,0,0,0,52,202,1,0,72,202,1,0,95,2,0,0,0,0,0,0,
+82,202,1,0,89,202,1,0,96,2,0,0,0,0,0,0,99,202,1,0,
+107,202,1,0,102,2,0,0,0,0,0,0,112,202,1,0,114,202,1,0,
+103,2,0,0,0,0,0,0,122,202,1,0,127,202,1,0,104,2,0,0,
+0,0,0,0,133,202,1,0,139,202,1,0,111,2,0,0,0,0,0,0,
+145,202,1,0,149,202,1,0,114,2,0,0,0,0,0,0,154,202,1,0,
+170,202,1,0,115,2,0,0,0,0,0,0,174,202,1,0,178,202,1,0,
+116,2,0,0,0,0,0,0,183,202,1,0,199,202,1,0,117,2,0,0,
+0,0,0,0,203,202,1,0,207,202,1,0,118,2,0,0,0,0,0,0,
+213,202,1,0,230,202,1,0,119,2,0,0,0,0,0,0,234,202,1,0,
+240,202,1,0,120,2,0,0,0,0,0,0,245,202,1,0,255,202,1,0,
+121,2,0,0,0,0,0,0,5,203,1,0,12,203,1,0,122,2,0,0,
+0,0,0,0,17,203,1,0,28,203,1,0,123,2,0,0,0,0,0,0,
+35,203,1,0,40,203,1,0,124,2,0,0,0,0,0,0,47,203,1,0,
+59,203,1,0,142,2,0,0,0,0,0,0,66,203,1,0,89,203,1,0,
+143,2,0,0,0,0,0,0,96,203,1,0,107,203,1,0,147,2,0,0,
+0,0,0,0,109,203,1,0,114,203,1,0,148,2,0,0,0,0,0,0,
+116,203,1,0,130,203,1,0,165,2,0,0,0,0,0,0,139,203,1,0,
+144,203,1,0,166,2,0,0,0,0,0,0,153,203,1,0,168,203,1,0,
+183,2,0,0,0,0,0,0,173,203,1,0,184,203,1,0,184,2,0,0,
+0,0,0,0,199,203,1,0,213,203,1,0,185,2,0,0,0,0,0,0,
+218,203,1,0,223,203,1,0,186,2,0,0,0,0,0,0,234,203,1,0,
+240,203,1,0,187,2,0,0,0,0,0,0,251,203,1,0,7,204,1,0,
+188,2,0,0,0,0,0,0,18,204,1,0,29,204,1,0,191,2,0,0,
+0,0,0,0,39,204,1,0,44,204,1,0,198,2,0,0,0,0,0,0,
+46,204,1,0,52,204,1,0,199,2,0,0,0,0,0,0,54,204,1,0,
+57,204,1,0,0,3,0,0,0,0,0,0,80,204,1,0,82,204,1,0,
+1,3,0,0,0,0,0,0,99,204,1,0,105,204,1,0,2,3,0,0,
+0,0,0,0,107,204,1,0,111,204,1,0,3,3,0,0,0,0,0,0,
+125,204,1,0,134,204,1,0,4,3,0,0,0,0,0,0,144,204,1,0,
+151,204,1,0,5,3,0,0,0,0,0,0,155,204,1,0,157,204,1,0,
+6,3,0,0,0,0,0,0,175,204,1,0,177,204,1,0,7,3,0,0,
+0,0,0,0,196,204,1,0,201,204,1,0,8,3,0,0,0,0,0,0,
+210,204,1,0,215,204,1,0,9,3,0,0,0,0,0,0,220,204,1,0,
+222,204,1,0,10,3,0,0,0,0,0,0,247,204,1,0,4,205,1,0,
+19,3,0,0,0,0,0,0,20,205,1,0,35,205,1,0,23,3,0,0,
+0,0,0,0,54,205,1,0,56,205,1,0,24,3,0,0,0,0,0,0,
+71,205,1,0,75,205,1,0,25,3,0,0,0,0,0,0,90,205,1,0,
+99,205,1,0,26,3,0,0,0,0,0,0,114,205,1,0,123,205,1,0,
+29,3,0,0,0,0,0,0,138,205,1,0,145,205,1,0,31,3,0,0,
+0,0,0,0,147,205,1,0,156,205,1,0,32,3,0,0,0,0,0,0,
+170,205,1,0,174,205,1,0,33,3,0,0,0,0,0,0,183,205,1,0,
+195,205,1,0,34,3,0,0,0,0,0,0,214,205,1,0,216,205,1,0,
+35,3,0,0,0,0,0,0,228,205,1,0,238,205,1,0,36,3,0,0,
+0,0,0,0,246,205,1,0,248,205,1,0,37,3,0,0,0,0,0,0,
+2,206,1,0,13,206,1,0,38,3,0,0,0,0,0,0,23,206,1,0,
+35,206,1,0,39,3,0,0,0,0,0,0,55,206,1,0,65,206,1,0,
+41,3,0,0,0,0,0,0,92,206,1,0,108,206,1,0,44,3,0,0,
+0,0,0,0,133,206,1,0,139,206,1,0,45,3,0,0,0,0,0,0,
+155,206,1,0,172,206,1,0,47,3,0,0,0,0,0,0,189,206,1,0,
+193,206,1,0,56,3,0,0,0,0,0,0,208,206,1,0,212,206,1,0,
+72,3,0,0,0,0,0,0,226,206,1,0,234,206,1,0,89,3,0,0,
+0,0,0,0,248,206,1,0,254,206,1,0,90,3,0,0,0,0,0,0,
+6,207,1,0,10,207,1,0,91,3,0,0,0,0,0,0,20,207,1,0,
+31,207,1,0,92,3,0,0,0,0,0,0,35,207,1,0,38,207,1,0,
+93,3,0,0,0,0,0,0,64,207,1,0,70,207,1,0,94,3,0,0,
+0,0,0,0,86,207,1,0,99,207,1,0,95,3,0,0,0,0,0,0,
+111,207,1,0,115,207,1,0,96,3,0,0,0,0,0,0,121,207,1,0,
+124,207,1,0,97,3,0,0,0,0,0,0,130,207,1,0,135,207,1,0,
+98,3,0,0,0,0,0,0,146,207,1,0,159,207,1,0,99,3,0,0,
+0,0,0,0,168,207,1,0,176,207,1,0,100,3,0,0,0,0,0,0,
+189,207,1,0,195,207,1,0,105,3,0,0,0,0,0,0,221,207,1,0,
+227,207,1,0,106,3,0,0,0,0,0,0,253,207,1,0,3,208,1,0,
+107,3,0,0,0,0,0,0,29,208,1,0,35,208,1,0,108,3,0,0,
+0,0,0,0,61,208,1,0,67,208,1,0,109,3,0,0,0,0,0,0,
+93,208,1,0,99,208,1,0,110,3,0,0,0,0,0,0,125,208,1,0,
+131,208,1,0,111,3,0,0,0,0,0,0,157,208,1,0,163,208,1,0,
+112,3,0,0,0,0,0,0,189,208,1,0,196,208,1,0,113,3,0,0,
+0,0,0,0,222,208,1,0,229,208,1,0,114,3,0,0,0,0,0,0,
+255,208,1,0,6,209,1,0,115,3,0,0,0,0,0,0,32,209,1,0,
+39,209,1,0,116,3,0,0,0,0,0,0,65,209,1,0,72,209,1,0,
+117,3,0,0,0,0,0,0,98,209,1,0,105,209,1,0,118,3,0,0,
+0,0,0,0,131,209,1,0,139,209,1,0,119,3,0,0,0,0,0,0,
+165,209,1,0,175,209,1,0,123,3,0,0,0,0,0,0,194,209,1,0,
+198,209,1,0,124,3,0,0,0,0,0,0,210,209,1,0,216,209,1,0,
+135,3,0,0,0,0,0,0,232,209,1,0,243,209,1,0,143,3,0,0,
+0,0,0,0,10,210,1,0,16,210,1,0,144,3,0,0,0,0,0,0,
+26,210,1,0,37,210,1,0,148,3,0,0,0,0,0,0,51,210,1,0,
+55,210,1,0,149,3,0,0,0,0,0,0,66,210,1,0,77,210,1,0,
+150,3,0,0,0,0,0,0,99,210,1,0,103,210,1,0,151,3,0,0,
+0,0,0,0,114,210,1,0,127,210,1,0,152,3,0,0,0,0,0,0,
+140,210,1,0,144,210,1,0,153,3,0,0,0,0,0,0,157,210,1,0,
+170,210,1,0,157,3,0,0,0,0,0,0,188,210,1,0,192,210,1,0,
+158,3,0,0,0,0,0,0,205,210,1,0,216,210,1,0,159,3,0,0,
+0,0,0,0,232,210,1,0,236,210,1,0,160,3,0,0,0,0,0,0,
+247,210,1,0,3,211,1,0,161,3,0,0,0,0,0,0,19,211,1,0,
+23,211,1,0,162,3,0,0,0,0,0,0,35,211,1,0,44,211,1,0,
+163,3,0,0,0,0,0,0,59,211,1,0,64,211,1,0,164,3,0,0,
+0,0,0,0,73,211,1,0,86,211,1,0,165,3,0,0,0,0,0,0,
+103,211,1,0,107,211,1,0,166,3,0,0,0,0,0,0,120,211,1,0,
+138,211,1,0,167,3,0,0,0,0,0,0,155,211,1,0,163,211,1,0,
+168,3,0,0,0,0,0,0,181,211,1,0,200,211,1,0,173,3,0,0,
+0,0,0,0,210,211,1,0,219,211,1,0,174,3,0,0,0,0,0,0,
+238,211,1,0,255,211,1,0,175,3,0,0,0,0,0,0,9,212,1,0,
+20,212,1,0,176,3,0,0,0,0,0,0,37,212,1,0,55,212,1,0,
+177,3,0,0,0,0,0,0,65,212,1,0,76,212,1,0,178,3,0,0,
+0,0,0,0,94,212,1,0,107,212,1,0,182,3,0,0,0,0,0,0,
+131,212,1,0,136,212,1,0,183,3,0,0,0,0,0,0,149,212,1,0,
+165,212,1,0,184,3,0,0,0,0,0,0,188,212,1,0,193,212,1,0,
+185,3,0,0,0,0,0,0,209,212,1,0,215,212,1,0,186,3,0,0,
+0,0,0,0,234,212,1,0,239,212,1,0,187,3,0,0,0,0,0,0,
+3,213,1,0,8,213,1,0,188,3,0,0,0,0,0,0,27,213,1,0,
+32,213,1,0,189,3,0,0,0,0,0,0,51,213,1,0,56,213,1,0,
+190,3,0,0,0,0,0,0,76,213,1,0,80,213,1,0,196,3,0,0,
+0,0,0,0,89,213,1,0,109,213,1,0,197,3,0,0,0,0,0,0,
+120,213,1,0,123,213,1,0,198,3,0,0,0,0,0,0,143,213,1,0,
+147,213,1,0,199,3,0,0,0,0,0,0,159,213,1,0,164,213,1,0,
+200,3,0,0,0,0,0,0,170,213,1,0,175,213,1,0,201,3,0,0,
+0,0,0,0,180,213,1,0,184,213,1,0,202,3,0,0,0,0,0,0,
+187,213,1,0,192,213,1,0,205,3,0,0,0,0,0,0,200,213,1,0,
+206,213,1,0,206,3,0,0,0,0,0,0,217,213,1,0,223,213,1,0,
+207,3,0,0,0,0,0,0,232,213,1,0,235,213,1,0,208,3,0,0,
+0,0,0,0,239,213,1,0,252,213,1,0,209,3,0,0,0,0,0,0,
+255,213,1,0,9,214,1,0,210,3,0,0,0,0,0,0,22,214,1,0,
+25,214,1,0,211,3,0,0,0,0,0,0,35,214,1,0,47,214,1,0,
+212,3,0,0,0,0,0,0,51,214,1,0,63,214,1,0,213,3,0,0,
+0,0,0,0,69,214,1,0,76,214,1,0,214,3,0,0,0,0,0,0,
+93,214,1,0,96,214,1,0,215,3,0,0,0,0,0,0,103,214,1,0,
+111,214,1,0,223,3,0,0,0,0,0,0,125,214,1,0,131,214,1,0,
+224,3,0,0,0,0,0,0,145,214,1,0,158,214,1,0,227,3,0,0,
+0,0,0,0,170,214,1,0,177,214,1,0,228,3,0,0,0,0,0,0,
+194,214,1,0,202,214,1,0,229,3,0,0,0,0,0,0,221,214,1,0,
+227,214,1,0,232,3,0,0,0,0,0,0,236,214,1,0,242,214,1,0,
+233,3,0,0,0,0,0,0,248,214,1,0,3,215,1,0,234,3,0,0,
+0,0,0,0,9,215,1,0,18,215,1,0,235,3,0,0,0,0,0,0,
+36,215,1,0,41,215,1,0,241,3,0,0,0,0,0,0,55,215,1,0,
+59,215,1,0,242,3,0,0,0,0,0,0,64,215,1,0,68,215,1,0,
+243,3,0,0,0,0,0,0,76,215,1,0,82,215,1,0,244,3,0,0,
+0,0,0,0,94,215,1,0,96,215,1,0,245,3,0,0,0,0,0,0,
+102,215,1,0,106,215,1,0,246,3,0,0,0,0,0,0,113,215,1,0,
+120,215,1,0,247,3,0,0,0,0,0,0,129,215,1,0,132,215,1,0,
+248,3,0,0,0,0,0,0,139,215,1,0,145,215,1,0,249,3,0,0,
+0,0,0,0,152,215,1,0,159,215,1,0,250,3,0,0,0,0,0,0,
+166,215,1,0,170,215,1,0,251,3,0,0,0,0,0,0,179,215,1,0,
+187,215,1,0,252,3,0,0,0,0,0,0,191,215,1,0,197,215,1,0,
+1,4,0,0,0,0,0,0,207,215,1,0,213,215,1,0,2,4,0,0,
+0,0,0,0,219,215,1,0,226,215,1,0,3,4,0,0,0,0,0,0,
+231,215,1,0,238,215,1,0,4,4,0,0,0,0,0,0,245,215,1,0,
+250,215,1,0,5,4,0,0,0,0,0,0,255,215,1,0,4,216,1,0,
+6,4,0,0,0,0,0,0,13,216,1,0,18,216,1,0,7,4,0,0,
+0,0,0,0,29,216,1,0,34,216,1,0,8,4,0,0,0,0,0,0,
+54,216,1,0,60,216,1,0,10,4,0,0,0,0,0,0,84,216,1,0,
+89,216,1,0,18,4,0,0,0,0,0,0,100,216,1,0,110,216,1,0,
+19,4,0,0,0,0,0,0,115,216,1,0,129,216,1,0,20,4,0,0,
+0,0,0,0,140,216,1,0,154,216,1,0,21,4,0,0,0,0,0,0,
+167,216,1,0,171,216,1,0,24,4,0,0,0,0,0,0,185,216,1,0,
+190,216,1,0,25,4,0,0,0,0,0,0,203,216,1,0,210,216,1,0,
+26,4,0,0,0,0,0,0,222,216,1,0,231,216,1,0,31,4,0,0,
+0,0,0,0,236,216,1,0,242,216,1,0,32,4,0,0,0,0,0,0,
+251,216,1,0,254,216,1,0,33,4,0,0,0,0,0,0,7,217,1,0,
+12,217,1,0,34,4,0,0,0,0,0,0,15,217,1,0,18,217,1,0,
+35,4,0,0,0,0,0,0,23,217,1,0,33,217,1,0,36,4,0,0,
+0,0,0,0,43,217,1,0,50,217,1,0,37,4,0,0,0,0,0,0,
+60,217,1,0,68,217,1,0,38,4,0,0,0,0,0,0,90,217,1,0,
+98,217,1,0,39,4,0,0,0,0,0,0,117,217,1,0,124,217,1,0,
+40,4,0,0,0,0,0,0,145,217,1,0,151,217,1,0,41,4,0,0,
+0,0,0,0,166,217,1,0,172,217,1,0,42,4,0,0,0,0,0,0,
+179,217,1,0,185,217,1,0,43,4,0,0,0,0,0,0,203,217,1,0,
+206,217,1,0,44,4,0,0,0,0,0,0,212,217,1,0,220,217,1,0,
+45,4,0,0,0,0,0,0,231,217,1,0,234,217,1,0,46,4,0,0,
+0,0,0,0,242,217,1,0,250,217,1,0,47,4,0,0,0,0,0,0,
+6,218,1,0,9,218,1,0,48,4,0,0,0,0,0,0,17,218,1,0,
+25,218,1,0,49,4,0,0,0,0,0,0,40,218,1,0,43,218,1,0,
+50,4,0,0,0,0,0,0,51,218,1,0,54,218,1,0,51,4,0,0,
+0,0,0,0,62,218,1,0,71,218,1,0,52,4,0,0,0,0,0,0,
+84,218,1,0,88,218,1,0,53,4,0,0,0,0,0,0,98,218,1,0,
+109,218,1,0,67,4,0,0,0,0,0,0,123,218,1,0,131,218,1,0,
+68,4,0,0,0,0,0,0,142,218,1,0,151,218,1,0,69,4,0,0,
+0,0,0,0,173,218,1,0,185,218,1,0,70,4,0,0,0,0,0,0,
+195,218,1,0,199,218,1,0,71,4,0,0,0,0,0,0,211,218,1,0,
+220,218,1,0,72,4,0,0,0,0,0,0,232,218,1,0,242,218,1,0,
+73,4,0,0,0,0,0,0,9,219,1,0,23,219,1,0,74,4,0,0,
+0,0,0,0,33,219,1,0,43,219,1,0,75,4,0,0,0,0,0,0,
+66,219,1,0,74,219,1,0,76,4,0,0,0,0,0,0,93,219,1,0,
+101,219,1,0,77,4,0,0,0,0,0,0,110,219,1,0,122,219,1,0,
+78,4,0,0,0,0,0,0,135,219,1,0,144,219,1,0,79,4,0,0,
+0,0,0,0,156,219,1,0,162,219,1,0,80,4,0,0,0,0,0,0,
+180,219,1,0,190,219,1,0,81,4,0,0,0,0,0,0,207,219,1,0,
+211,219,1,0,82,4,0,0,0,0,0,0,226,219,1,0,236,219,1,0,
+88,4,0,0,0,0,0,0,247,219,1,0,254,219,1,0,89,4,0,0,
+0,0,0,0,8,220,1,0,17,220,1,0,92,4,0,0,0,0,0,0,
+28,220,1,0,36,220,1,0,93,4,0,0,0,0,0,0,46,220,1,0,
+53,220,1,0,94,4,0,0,0,0,0,0,66,220,1,0,74,220,1,0,
+98,4,0,0,0,0,0,0,82,220,1,0,90,220,1,0,100,4,0,0,
+0,0,0,0,100,220,1,0,113,220,1,0,101,4,0,0,0,0,0,0,
+123,220,1,0,136,220,1,0,102,4,0,0,0,0,0,0,146,220,1,0,
+155,220,1,0,110,4,0,0,0,0,0,0,168,220,1,0,180,220,1,0,
+111,4,0,0,0,0,0,0,191,220,1,0,210,220,1,0,118,4,0,0,
+0,0,0,0,218,220,1,0,232,220,1,0,119,4,0,0,0,0,0,0,
+238,220,1,0,254,220,1,0,120,4,0,0,0,0,0,0,5,221,1,0,
+17,221,1,0,121,4,0,0,0,0,0,0,21,221,1,0,30,221,1,0,
+122,4,0,0,0,0,0,0,34,221,1,0,41,221,1,0,124,4,0,0,
+0,0,0,0,54,221,1,0,65,221,1,0,125,4,0,0,0,0,0,0,
+76,221,1,0,89,221,1,0,126,4,0,0,0,0,0,0,100,221,1,0,
+107,221,1,0,127,4,0,0,0,0,0,0,116,221,1,0,122,221,1,0,
+131,4,0,0,0,0,0,0,128,221,1,0,131,221,1,0,132,4,0,0,
+0,0,0,0,137,221,1,0,144,221,1,0,134,4,0,0,0,0,0,0,
+152,221,1,0,160,221,1,0,135,4,0,0,0,0,0,0,167,221,1,0,
+174,221,1,0,136,4,0,0,0,0,0,0,181,221,1,0,185,221,1,0,
+141,4,0,0,0,0,0,0,192,221,1,0,195,221,1,0,142,4,0,0,
+0,0,0,0,199,221,1,0,204,221,1,0,143,4,0,0,0,0,0,0,
+217,221,1,0,220,221,1,0,144,4,0,0,0,0,0,0,225,221,1,0,
+236,221,1,0,145,4,0,0,0,0,0,0,247,221,1,0,3,222,1,0,
+147,4,0,0,0,0,0,0,13,222,1,0,17,222,1,0,150,4,0,0,
+0,0,0,0,31,222,1,0,35,222,1,0,153,4,0,0,0,0,0,0,
+44,222,1,0,49,222,1,0,154,4,0,0,0,0,0,0,63,222,1,0,
+73,222,1,0,158,4,0,0,0,0,0,0,77,222,1,0,81,222,1,0,
+160,4,0,0,0,0,0,0,88,222,1,0,94,222,1,0,161,4,0,0,
+0,0,0,0,104,222,1,0,107,222,1,0,162,4,0,0,0,0,0,0,
+113,222,1,0,122,222,1,0,164,4,0,0,0,0,0,0,132,222,1,0,
+136,222,1,0,165,4,0,0,0,0,0,0,145,222,1,0,153,222,1,0,
+166,4,0,0,0,0,0,0,162,222,1,0,176,222,1,0,174,4,0,0,
+0,0,0,0,188,222,1,0,203,222,1,0,175,4,0,0,0,0,0,0,
+216,222,1,0,224,222,1,0,176,4,0,0,0,0,0,0,237,222,1,0,
+249,222,1,0,177,4,0,0,0,0,0,0,6,223,1,0,13,223,1,0,
+188,4,0,0,0,0,0,0,26,223,1,0,35,223,1,0,189,4,0,0,
+0,0,0,0,45,223,1,0,56,223,1,0,190,4,0,0,0,0,0,0,
+65,223,1,0,74,223,1,0,191,4,0,0,0,0,0,0,85,223,1,0,
+92,223,1,0,192,4,0,0,0,0,0,0,104,223,1,0,113,223,1,0,
+193,4,0,0,0,0,0,0,125,223,1,0,133,223,1,0,194,4,0,0,
+0,0,0,0,145,223,1,0,150,223,1,0,228,4,0,0,0,0,0,0,
+170,223,1,0,176,223,1,0,232,4,0,0,0,0,0,0,196,223,1,0,
+202,223,1,0,233,4,0,0,0,0,0,0,222,223,1,0,227,223,1,0,
+237,4,0,0,0,0,0,0,241,223,1,0,246,223,1,0,18,5,0,0,
+0,0,0,0,253,223,1,0,13,224,1,0,20,5,0,0,0,0,0,0,
+27,224,1,0,40,224,1,0,23,5,0,0,0,0,0,0,58,224,1,0,
+71,224,1,0,26,5,0,0,0,0,0,0,89,224,1,0,101,224,1,0,
+41,5,0,0,0,0,0,0,113,224,1,0,119,224,1,0,52,5,0,0,
+0,0,0,0,136,224,1,0,148,224,1,0,65,5,0,0,0,0,0,0,
+162,224,1,0,175,224,1,0,66,5,0,0,0,0,0,0,192,224,1,0,
+207,224,1,0,67,5,0,0,0,0,0,0,225,224,1,0,240,224,1,0,
+68,5,0,0,0,0,0,0,4,225,1,0,21,225,1,0,79,5,0,0,
+0,0,0,0,37,225,1,0,50,225,1,0,81,5,0,0,0,0,0,0,
+65,225,1,0,79,225,1,0,82,5,0,0,0,0,0,0,92,225,1,0,
+108,225,1,0,83,5,0,0,0,0,0,0,121,225,1,0,135,225,1,0,
+86,5,0,0,0,0,0,0,149,225,1,0,160,225,1,0,88,5,0,0,
+0,0,0,0,206,225,1,0,219,225,1,0,90,5,0,0,0,0,0,0,
+230,225,1,0,239,225,1,0,91,5,0,0,0,0,0,0,252,225,1,0,
+1,226,1,0,92,5,0,0,0,0,0,0,15,226,1,0,22,226,1,0,
+93,5,0,0,0,0,0,0,32,226,1,0,37,226,1,0,97,5,0,0,
+0,0,0,0,50,226,1,0,53,226,1,0,98,5,0,0,0,0,0,0,
+58,226,1,0,64,226,1,0,99,5,0,0,0,0,0,0,74,226,1,0,
+77,226,1,0,100,5,0,0,0,0,0,0,83,226,1,0,91,226,1,0,
+101,5,0,0,0,0,0,0,99,226,1,0,106,226,1,0,106,5,0,0,
+0,0,0,0,115,226,1,0,123,226,1,0,107,5,0,0,0,0,0,0,
+133,226,1,0,144,226,1,0,108,5,0,0,0,0,0,0,155,226,1,0,
+165,226,1,0,109,5,0,0,0,0,0,0,176,226,1,0,186,226,1,0,
+110,5,0,0,0,0,0,0,191,226,1,0,201,226,1,0,111,5,0,0,
+0,0,0,0,215,226,1,0,228,226,1,0,112,5,0,0,0,0,0,0,
+236,226,1,0,247,226,1,0,113,5,0,0,0,0,0,0,255,226,1,0,
+8,227,1,0,114,5,0,0,0,0,0,0,16,227,1,0,27,227,1,0,
+115,5,0,0,0,0,0,0,38,227,1,0,52,227,1,0,116,5,0,0,
+0,0,0,0,65,227,1,0,77,227,1,0,117,5,0,0,0,0,0,0,
+85,227,1,0,101,227,1,0,118,5,0,0,0,0,0,0,109,227,1,0,
+122,227,1,0,128,5,0,0,0,0,0,0,139,227,1,0,150,227,1,0,
+140,5,0,0,0,0,0,0,162,227,1,0,171,227,1,0,141,5,0,0,
+0,0,0,0,182,227,1,0,191,227,1,0,142,5,0,0,0,0,0,0,
+203,227,1,0,211,227,1,0,143,5,0,0,0,0,0,0,226,227,1,0,
+237,227,1,0,144,5,0,0,0,0,0,0,249,227,1,0,3,228,1,0,
+145,5,0,0,0,0,0,0,14,228,1,0,24,228,1,0,146,5,0,0,
+0,0,0,0,33,228,1,0,44,228,1,0,147,5,0,0,0,0,0,0,
+54,228,1,0,63,228,1,0,148,5,0,0,0,0,0,0,74,228,1,0,
+86,228,1,0,155,5,0,0,0,0,0,0,107,228,1,0,117,228,1,0,
+156,5,0,0,0,0,0,0,139,228,1,0,149,228,1,0,157,5,0,0,
+0,0,0,0,162,228,1,0,171,228,1,0,158,5,0,0,0,0,0,0,
+192,228,1,0,204,228,1,0,159,5,0,0,0,0,0,0,225,228,1,0,
+236,228,1,0,160,5,0,0,0,0,0,0,1,229,1,0,12,229,1,0,
+161,5,0,0,0,0,0,0,33,229,1,0,45,229,1,0,162,5,0,0,
+0,0,0,0,66,229,1,0,76,229,1,0,163,5,0,0,0,0,0,0,
+97,229,1,0,113,229,1,0,172,5,0,0,0,0,0,0,125,229,1,0,
+148,229,1,0,173,5,0,0,0,0,0,0,161,229,1,0,179,229,1,0,
+174,5,0,0,0,0,0,0,223,229,1,0,232,229,1,0,176,5,0,0,
+0,0,0,0,247,229,1,0,1,230,1,0,177,5,0,0,0,0,0,0,
+16,230,1,0,27,230,1,0,179,5,0,0,0,0,0,0,35,230,1,0,
+45,230,1,0,180,5,0,0,0,0,0,0,54,230,1,0,62,230,1,0,
+206,5,0,0,0,0,0,0,76,230,1,0,89,230,1,0,208,5,0,0,
+0,0,0,0,111,230,1,0,128,230,1,0,212,5,0,0,0,0,0,0,
+155,230,1,0,158,230,1,0,213,5,0,0,0,0,0,0,175,230,1,0,
+185,230,1,0,216,5,0,0,0,0,0,0,198,230,1,0,206,230,1,0,
+217,5,0,0,0,0,0,0,216,230,1,0,224,230,1,0,220,5,0,0,
+0,0,0,0,240,230,1,0,249,230,1,0,221,5,0,0,0,0,0,0,
+3,231,1,0,16,231,1,0,222,5,0,0,0,0,0,0,27,231,1,0,
+39,231,1,0,223,5,0,0,0,0,0,0,50,231,1,0,62,231,1,0,
+233,5,0,0,0,0,0,0,82,231,1,0,92,231,1,0,234,5,0,0,
+0,0,0,0,114,231,1,0,128,231,1,0,235,5,0,0,0,0,0,0,
+150,231,1,0,159,231,1,0,236,5,0,0,0,0,0,0,179,231,1,0,
+191,231,1,0,237,5,0,0,0,0,0,0,213,231,1,0,224,231,1,0,
+238,5,0,0,0,0,0,0,245,231,1,0,0,232,1,0,239,5,0,0,
+0,0,0,0,21,232,1,0,33,232,1,0,240,5,0,0,0,0,0,0,
+54,232,1,0,64,232,1,0,241,5,0,0,0,0,0,0,83,232,1,0,
+102,232,1,0,243,5,0,0,0,0,0,0,114,232,1,0,124,232,1,0,
+244,5,0,0,0,0,0,0,166,232,1,0,175,232,1,0,245,5,0,0,
+0,0,0,0,204,232,1,0,219,232,1,0,250,5,0,0,0,0,0,0,
+233,232,1,0,246,232,1,0,251,5,0,0,0,0,0,0,3,233,1,0,
+15,233,1,0,252,5,0,0,0,0,0,0,29,233,1,0,44,233,1,0,
+253,5,0,0,0,0,0,0,57,233,1,0,71,233,1,0,254,5,0,0,
+0,0,0,0,83,233,1,0,97,233,1,0,255,5,0,0,0,0,0,0,
+110,233,1,0,125,233,1,0,0,6,0,0,0,0,0,0,138,233,1,0,
+151,233,1,0,1,6,0,0,0,0,0,0,163,233,1,0,177,233,1,0,
+6,6,0,0,0,0,0,0,185,233,1,0,197,233,1,0,7,6,0,0,
+0,0,0,0,208,233,1,0,220,233,1,0,8,6,0,0,0,0,0,0,
+231,233,1,0,242,233,1,0,9,6,0,0,0,0,0,0,253,233,1,0,
+11,234,1,0,10,6,0,0,0,0,0,0,20,234,1,0,33,234,1,0,
+11,6,0,0,0,0,0,0,42,234,1,0,55,234,1,0,12,6,0,0,
+0,0,0,0,64,234,1,0,78,234,1,0,13,6,0,0,0,0,0,0,
+87,234,1,0,99,234,1,0,14,6,0,0,0,0,0,0,107,234,1,0,
+119,234,1,0,16,6,0,0,0,0,0,0,130,234,1,0,141,234,1,0,
+25,6,0,0,0,0,0,0,154,234,1,0,167,234,1,0,26,6,0,0,
+0,0,0,0,169,234,1,0,182,234,1,0,27,6,0,0,0,0,0,0,
+187,234,1,0,200,234,1,0,31,6,0,0,0,0,0,0,211,234,1,0,
+222,234,1,0,32,6,0,0,0,0,0,0,3,235,1,0,18,235,1,0,
+34,6,0,0,0,0,0,0,44,235,1,0,57,235,1,0,35,6,0,0,
+0,0,0,0,75,235,1,0,83,235,1,0,36,6,0,0,0,0,0,0,
+96,235,1,0,104,235,1,0,37,6,0,0,0,0,0,0,112,235,1,0,
+127,235,1,0,43,6,0,0,0,0,0,0,131,235,1,0,145,235,1,0,
+44,6,0,0,0,0,0,0,149,235,1,0,162,235,1,0,45,6,0,0,
+0,0,0,0,168,235,1,0,179,235,1,0,46,6,0,0,0,0,0,0,
+185,235,1,0,193,235,1,0,47,6,0,0,0,0,0,0,204,235,1,0,
+217,235,1,0,48,6,0,0,0,0,0,0,227,235,1,0,239,235,1,0,
+49,6,0,0,0,0,0,0,241,235,1,0,244,235,1,0,70,6,0,0,
+0,0,0,0,3,236,1,0,7,236,1,0,74,6,0,0,0,0,0,0,
+22,236,1,0,27,236,1,0,77,6,0,0,0,0,0,0,35,236,1,0,
+38,236,1,0,78,6,0,0,0,0,0,0,43,236,1,0,48,236,1,0,
+79,6,0,0,0,0,0,0,56,236,1,0,61,236,1,0,80,6,0,0,
+0,0,0,0,66,236,1,0,69,236,1,0,81,6,0,0,0,0,0,0,
+74,236,1,0,79,236,1,0,82,6,0,0,0,0,0,0,84,236,1,0,
+87,236,1,0,83,6,0,0,0,0,0,0,92,236,1,0,97,236,1,0,
+84,6,0,0,0,0,0,0,105,236,1,0,110,236,1,0,88,6,0,0,
+0,0,0,0,120,236,1,0,124,236,1,0,89,6,0,0,0,0,0,0,
+133,236,1,0,139,236,1,0,90,6,0,0,0,0,0,0,143,236,1,0,
+151,236,1,0,91,6,0,0,0,0,0,0,158,236,1,0,170,236,1,0,
+92,6,0,0,0,0,0,0,175,236,1,0,182,236,1,0,93,6,0,0,
+0,0,0,0,189,236,1,0,204,236,1,0,97,6,0,0,0,0,0,0,
+216,236,1,0,228,236,1,0,98,6,0,0,0,0,0,0,243,236,1,0,
+1,237,1,0,99,6,0,0,0,0,0,0,20,237,1,0,34,237,1,0,
+100,6,0,0,0,0,0,0,55,237,1,0,61,237,1,0,101,6,0,0,
+0,0,0,0,67,237,1,0,72,237,1,0,102,6,0,0,0,0,0,0,
+84,237,1,0,87,237,1,0,103,6,0,0,0,0,0,0,93,237,1,0,
+100,237,1,0,104,6,0,0,0,0,0,0,117,237,1,0,125,237,1,0,
+105,6,0,0,0,0,0,0,136,237,1,0,148,237,1,0,106,6,0,0,
+0,0,0,0,164,237,1,0,175,237,1,0,107,6,0,0,0,0,0,0,
+193,237,1,0,201,237,1,0,108,6,0,0,0,0,0,0,208,237,1,0,
+217,237,1,0,109,6,0,0,0,0,0,0,228,237,1,0,238,237,1,0,
+110,6,0,0,0,0,0,0,247,237,1,0,4,238,1,0,112,6,0,0,
+0,0,0,0,19,238,1,0,34,238,1,0,114,6,0,0,0,0,0,0,
+41,238,1,0,55,238,1,0,115,6,0,0,0,0,0,0,76,238,1,0,
+90,238,1,0,116,6,0,0,0,0,0,0,105,238,1,0,118,238,1,0,
+117,6,0,0,0,0,0,0,132,238,1,0,144,238,1,0,119,6,0,0,
+0,0,0,0,152,238,1,0,163,238,1,0,120,6,0,0,0,0,0,0,
+180,238,1,0,190,238,1,0,122,6,0,0,0,0,0,0,198,238,1,0,
+207,238,1,0,123,6,0,0,0,0,0,0,222,238,1,0,229,238,1,0,
+130,6,0,0,0,0,0,0,234,238,1,0,247,238,1,0,133,6,0,0,
+0,0,0,0,254,238,1,0,4,239,1,0,141,6,0,0,0,0,0,0,
+22,239,1,0,31,239,1,0,142,6,0,0,0,0,0,0,37,239,1,0,
+49,239,1,0,143,6,0,0,0,0,0,0,55,239,1,0,63,239,1,0,
+144,6,0,0,0,0,0,0,76,239,1,0,92,239,1,0,145,6,0,0,
+0,0,0,0,101,239,1,0,114,239,1,0,146,6,0,0,0,0,0,0,
+129,239,1,0,146,239,1,0,147,6,0,0,0,0,0,0,161,239,1,0,
+166,239,1,0,148,6,0,0,0,0,0,0,184,239,1,0,190,239,1,0,
+149,6,0,0,0,0,0,0,193,239,1,0,199,239,1,0,150,6,0,0,
+0,0,0,0,205,239,1,0,211,239,1,0,154,6,0,0,0,0,0,0,
+225,239,1,0,228,239,1,0,155,6,0,0,0,0,0,0,234,239,1,0,
+240,239,1,0,156,6,0,0,0,0,0,0,253,239,1,0,3,240,1,0,
+161,6,0,0,0,0,0,0,14,240,1,0,17,240,1,0,162,6,0,0,
+0,0,0,0,23,240,1,0,28,240,1,0,163,6,0,0,0,0,0,0,
+39,240,1,0,42,240,1,0,164,6,0,0,0,0,0,0,47,240,1,0,
+63,240,1,0,165,6,0,0,0,0,0,0,74,240,1,0,78,240,1,0,
+166,6,0,0,0,0,0,0,92,240,1,0,111,240,1,0,167,6,0,0,
+0,0,0,0,127,240,1,0,133,240,1,0,168,6,0,0,0,0,0,0,
+142,240,1,0,151,240,1,0,169,6,0,0,0,0,0,0,159,240,1,0,
+173,240,1,0,170,6,0,0,0,0,0,0,183,240,1,0,202,240,1,0,
+171,6,0,0,0,0,0,0,215,240,1,0,228,240,1,0,172,6,0,0,
+0,0,0,0,247,240,1,0,1,241,1,0,177,6,0,0,0,0,0,0,
+12,241,1,0,22,241,1,0,178,6,0,0,0,0,0,0,37,241,1,0,
+41,241,1,0,179,6,0,0,0,0,0,0,51,241,1,0,63,241,1,0,
+180,6,0,0,0,0,0,0,78,241,1,0,82,241,1,0,181,6,0,0,
+0,0,0,0,94,241,1,0,103,241,1,0,184,6,0,0,0,0,0,0,
+122,241,1,0,133,241,1,0,185,6,0,0,0,0,0,0,154,241,1,0,
+165,241,1,0,186,6,0,0,0,0,0,0,186,241,1,0,196,241,1,0,
+187,6,0,0,0,0,0,0,206,241,1,0,218,241,1,0,191,6,0,0,
+0,0,0,0,227,241,1,0,239,241,1,0,192,6,0,0,0,0,0,0,
+245,241,1,0,251,241,1,0,193,6,0,0,0,0,0,0,7,242,1,0,
+10,242,1,0,194,6,0,0,0,0,0,0,16,242,1,0,30,242,1,0,
+195,6,0,0,0,0,0,0,42,242,1,0,59,242,1,0,196,6,0,0,
+0,0,0,0,71,242,1,0,77,242,1,0,197,6,0,0,0,0,0,0,
+88,242,1,0,96,242,1,0,204,6,0,0,0,0,0,0,106,242,1,0,
+114,242,1,0,205,6,0,0,0,0,0,0,124,242,1,0,131,242,1,0,
+206,6,0,0,0,0,0,0,143,242,1,0,153,242,1,0,207,6,0,0,
+0,0,0,0,164,242,1,0,173,242,1,0,211,6,0,0,0,0,0,0,
+182,242,1,0,186,242,1,0,212,6,0,0,0,0,0,0,193,242,1,0,
+199,242,1,0,213,6,0,0,0,0,0,0,210,242,1,0,215,242,1,0,
+214,6,0,0,0,0,0,0,225,242,1,0,230,242,1,0,215,6,0,0,
+0,0,0,0,239,242,1,0,247,242,1,0,216,6,0,0,0,0,0,0,
+4,243,1,0,11,243,1,0,217,6,0,0,0,0,0,0,23,243,1,0,
+30,243,1,0,218,6,0,0,0,0,0,0,41,243,1,0,54,243,1,0,
+219,6,0,0,0,0,0,0,66,243,1,0,76,243,1,0,220,6,0,0,
+0,0,0,0,87,243,1,0,99,243,1,0,221,6,0,0,0,0,0,0,
+114,243,1,0,117,243,1,0,222,6,0,0,0,0,0,0,123,243,1,0,
+126,243,1,0,223,6,0,0,0,0,0,0,131,243,1,0,136,243,1,0,
+224,6,0,0,0,0,0,0,147,243,1,0,154,243,1,0,225,6,0,0,
+0,0,0,0,167,243,1,0,172,243,1,0,226,6,0,0,0,0,0,0,
+182,243,1,0,195,243,1,0,227,6,0,0,0,0,0,0,209,243,1,0,
+222,243,1,0,228,6,0,0,0,0,0,0,233,243,1,0,241,243,1,0,
+229,6,0,0,0,0,0,0,255,243,1,0,7,244,1,0,230,6,0,0,
+0,0,0,0,19,244,1,0,27,244,1,0,231,6,0,0,0,0,0,0,
+39,244,1,0,55,244,1,0,232,6,0,0,0,0,0,0,67,244,1,0,
+74,244,1,0,233,6,0,0,0,0,0,0,90,244,1,0,94,244,1,0,
+234,6,0,0,0,0,0,0,101,244,1,0,112,244,1,0,235,6,0,0,
+0,0,0,0,127,244,1,0,136,244,1,0,236,6,0,0,0,0,0,0,
+145,244,1,0,154,244,1,0,241,6,0,0,0,0,0,0,167,244,1,0,
+170,244,1,0,242,6,0,0,0,0,0,0,177,244,1,0,182,244,1,0,
+243,6,0,0,0,0,0,0,193,244,1,0,200,244,1,0,244,6,0,0,
+0,0,0,0,213,244,1,0,220,244,1,0,245,6,0,0,0,0,0,0,
+233,244,1,0,236,244,1,0,246,6,0,0,0,0,0,0,241,244,1,0,
+251,244,1,0,247,6,0,0,0,0,0,0,6,245,1,0,15,245,1,0,
+248,6,0,0,0,0,0,0,29,245,1,0,37,245,1,0,249,6,0,0,
+0,0,0,0,50,245,1,0,60,245,1,0,250,6,0,0,0,0,0,0,
+70,245,1,0,86,245,1,0,253,6,0,0,0,0,0,0,96,245,1,0,
+109,245,1,0,254,6,0,0,0,0,0,0,124,245,1,0,136,245,1,0,
+24,7,0,0,0,0,0,0,142,245,1,0,156,245,1,0,25,7,0,0,
+0,0,0,0,162,245,1,0,173,245,1,0,26,7,0,0,0,0,0,0,
+179,245,1,0,189,245,1,0,27,7,0,0,0,0,0,0,195,245,1,0,
+208,245,1,0,28,7,0,0,0,0,0,0,214,245,1,0,224,245,1,0,
+29,7,0,0,0,0,0,0,230,245,1,0,241,245,1,0,30,7,0,0,
+0,0,0,0,247,245,1,0,8,246,1,0,31,7,0,0,0,0,0,0,
+14,246,1,0,25,246,1,0,35,7,0,0,0,0,0,0,34,246,1,0,
+41,246,1,0,36,7,0,0,0,0,0,0,52,246,1,0,57,246,1,0,
+37,7,0,0,0,0,0,0,64,246,1,0,71,246,1,0,38,7,0,0,
+0,0,0,0,77,246,1,0,83,246,1,0,39,7,0,0,0,0,0,0,
+96,246,1,0,107,246,1,0,40,7,0,0,0,0,0,0,114,246,1,0,
+124,246,1,0,41,7,0,0,0,0,0,0,139,246,1,0,149,246,1,0,
+42,7,0,0,0,0,0,0,158,246,1,0,165,246,1,0,43,7,0,0,
+0,0,0,0,175,246,1,0,187,246,1,0,45,7,0,0,0,0,0,0,
+194,246,1,0,206,246,1,0,46,7,0,0,0,0,0,0,213,246,1,0,
+225,246,1,0,47,7,0,0,0,0,0,0,233,246,1,0,246,246,1,0,
+51,7,0,0,0,0,0,0,3,247,1,0,15,247,1,0,52,7,0,0,
+0,0,0,0,32,247,1,0,45,247,1,0,53,7,0,0,0,0,0,0,
+58,247,1,0,64,247,1,0,57,7,0,0,0,0,0,0,71,247,1,0,
+80,247,1,0,58,7,0,0,0,0,0,0,89,247,1,0,98,247,1,0,
+59,7,0,0,0,0,0,0,107,247,1,0,118,247,1,0,60,7,0,0,
+0,0,0,0,127,247,1,0,138,247,1,0,61,7,0,0,0,0,0,0,
+147,247,1,0,157,247,1,0,62,7,0,0,0,0,0,0,166,247,1,0,
+181,247,1,0,63,7,0,0,0,0,0,0,191,247,1,0,203,247,1,0,
+70,7,0,0,0,0,0,0,211,247,1,0,215,247,1,0,71,7,0,0,
+0,0,0,0,229,247,1,0,238,247,1,0,77,7,0,0,0,0,0,0,
+248,247,1,0,2,248,1,0,78,7,0,0,0,0,0,0,12,248,1,0,
+27,248,1,0,88,7,0,0,0,0,0,0,36,248,1,0,46,248,1,0,
+89,7,0,0,0,0,0,0,56,248,1,0,68,248,1,0,90,7,0,0,
+0,0,0,0,83,248,1,0,94,248,1,0,91,7,0,0,0,0,0,0,
+109,248,1,0,121,248,1,0,92,7,0,0,0,0,0,0,135,248,1,0,
+150,248,1,0,109,7,0,0,0,0,0,0,157,248,1,0,162,248,1,0,
+115,7,0,0,0,0,0,0,166,248,1,0,170,248,1,0,116,7,0,0,
+0,0,0,0,176,248,1,0,184,248,1,0,117,7,0,0,0,0,0,0,
+191,248,1,0,199,248,1,0,118,7,0,0,0,0,0,0,208,248,1,0,
+218,248,1,0,119,7,0,0,0,0,0,0,222,248,1,0,226,248,1,0,
+120,7,0,0,0,0,0,0,229,248,1,0,233,248,1,0,121,7,0,0,
+0,0,0,0,238,248,1,0,252,248,1,0,122,7,0,0,0,0,0,0,
+12,249,1,0,28,249,1,0,123,7,0,0,0,0,0,0,38,249,1,0,
+58,249,1,0,124,7,0,0,0,0,0,0,68,249,1,0,77,249,1,0,
+125,7,0,0,0,0,0,0,98,249,1,0,101,249,1,0,141,7,0,0,
+0,0,0,0,114,249,1,0,125,249,1,0,145,7,0,0,0,0,0,0,
+148,249,1,0,161,249,1,0,150,7,0,0,0,0,0,0,185,249,1,0,
+196,249,1,0,154,7,0,0,0,0,0,0,218,249,1,0,229,249,1,0,
+160,7,0,0,0,0,0,0,253,249,1,0,12,250,1,0,164,7,0,0,
+0,0,0,0,20,250,1,0,27,250,1,0,165,7,0,0,0,0,0,0,
+47,250,1,0,55,250,1,0,166,7,0,0,0,0,0,0,75,250,1,0,
+89,250,1,0,167,7,0,0,0,0,0,0,104,250,1,0,118,250,1,0,
+168,7,0,0,0,0,0,0,125,250,1,0,140,250,1,0,169,7,0,0,
+0,0,0,0,148,250,1,0,156,250,1,0,170,7,0,0,0,0,0,0,
+164,250,1,0,172,250,1,0,171,7,0,0,0,0,0,0,183,250,1,0,
+189,250,1,0,176,7,0,0,0,0,0,0,194,250,1,0,200,250,1,0,
+177,7,0,0,0,0,0,0,206,250,1,0,210,250,1,0,178,7,0,0,
+0,0,0,0,216,250,1,0,232,250,1,0,179,7,0,0,0,0,0,0,
+252,250,1,0,12,251,1,0,180,7,0,0,0,0,0,0,20,251,1,0,
+38,251,1,0,181,7,0,0,0,0,0,0,54,251,1,0,62,251,1,0,
+182,7,0,0,0,0,0,0,81,251,1,0,87,251,1,0,183,7,0,0,
+0,0,0,0,95,251,1,0,103,251,1,0,187,7,0,0,0,0,0,0,
+115,251,1,0,125,251,1,0,188,7,0,0,0,0,0,0,136,251,1,0,
+149,251,1,0,189,7,0,0,0,0,0,0,159,251,1,0,166,251,1,0,
+190,7,0,0,0,0,0,0,177,251,1,0,190,251,1,0,191,7,0,0,
+0,0,0,0,202,251,1,0,209,251,1,0,192,7,0,0,0,0,0,0,
+222,251,1,0,229,251,1,0,193,7,0,0,0,0,0,0,240,251,1,0,
+247,251,1,0,194,7,0,0,0,0,0,0,3,252,1,0,11,252,1,0,
+195,7,0,0,0,0,0,0,24,252,1,0,33,252,1,0,196,7,0,0,
+0,0,0,0,43,252,1,0,52,252,1,0,213,7,0,0,0,0,0,0,
+64,252,1,0,73,252,1,0,214,7,0,0,0,0,0,0,84,252,1,0,
+99,252,1,0,215,7,0,0,0,0,0,0,114,252,1,0,124,252,1,0,
+216,7,0,0,0,0,0,0,135,252,1,0,146,252,1,0,217,7,0,0,
+0,0,0,0,158,252,1,0,162,252,1,0,226,7,0,0,0,0,0,0,
+173,252,1,0,180,252,1,0,227,7,0,0,0,0,0,0,191,252,1,0,
+201,252,1,0,228,7,0,0,0,0,0,0,212,252,1,0,217,252,1,0,
+229,7,0,0,0,0,0,0,229,252,1,0,236,252,1,0,230,7,0,0,
+0,0,0,0,243,252,1,0,250,252,1,0,231,7,0,0,0,0,0,0,
+7,253,1,0,11,253,1,0,232,7,0,0,0,0,0,0,24,253,1,0,
+33,253,1,0,233,7,0,0,0,0,0,0,45,253,1,0,50,253,1,0,
+234,7,0,0,0,0,0,0,61,253,1,0,67,253,1,0,235,7,0,0,
+0,0,0,0,78,253,1,0,83,253,1,0,236,7,0,0,0,0,0,0,
+94,253,1,0,101,253,1,0,237,7,0,0,0,0,0,0,110,253,1,0,
+119,253,1,0,238,7,0,0,0,0,0,0,130,253,1,0,135,253,1,0,
+239,7,0,0,0,0,0,0,149,253,1,0,164,253,1,0,240,7,0,0,
+0,0,0,0,178,253,1,0,189,253,1,0,241,7,0,0,0,0,0,0,
+204,253,1,0,219,253,1,0,246,7,0,0,0,0,0,0,231,253,1,0,
+242,253,1,0,247,7,0,0,0,0,0,0,3,254,1,0,15,254,1,0,
+248,7,0,0,0,0,0,0,24,254,1,0,36,254,1,0,249,7,0,0,
+0,0,0,0,44,254,1,0,58,254,1,0,250,7,0,0,0,0,0,0,
+66,254,1,0,77,254,1,0,251,7,0,0,0,0,0,0,89,254,1,0,
+105,254,1,0,253,7,0,0,0,0,0,0,113,254,1,0,122,254,1,0,
+0,8,0,0,0,0,0,0,135,254,1,0,142,254,1,0,1,8,0,0,
+0,0,0,0,149,254,1,0,155,254,1,0,9,8,0,0,0,0,0,0,
+166,254,1,0,177,254,1,0,13,8,0,0,0,0,0,0,188,254,1,0,
+193,254,1,0,15,8,0,0,0,0,0,0,205,254,1,0,210,254,1,0,
+20,8,0,0,0,0,0,0,220,254,1,0,225,254,1,0,21,8,0,0,
+0,0,0,0,233,254,1,0,244,254,1,0,22,8,0,0,0,0,0,0,
+254,254,1,0,9,255,1,0,23,8,0,0,0,0,0,0,19,255,1,0,
+23,255,1,0,24,8,0,0,0,0,0,0,34,255,1,0,39,255,1,0,
+26,8,0,0,0,0,0,0,48,255,1,0,53,255,1,0,28,8,0,0,
+0,0,0,0,62,255,1,0,67,255,1,0,33,8,0,0,0,0,0,0,
+76,255,1,0,89,255,1,0,34,8,0,0,0,0,0,0,105,255,1,0,
+112,255,1,0,37,8,0,0,0,0,0,0,117,255,1,0,122,255,1,0,
+38,8,0,0,0,0,0,0,129,255,1,0,137,255,1,0,39,8,0,0,
+0,0,0,0,145,255,1,0,153,255,1,0,40,8,0,0,0,0,0,0,
+164,255,1,0,170,255,1,0,44,8,0,0,0,0,0,0,176,255,1,0,
+183,255,1,0,45,8,0,0,0,0,0,0,188,255,1,0,194,255,1,0,
+46,8,0,0,0,0,0,0,200,255,1,0,208,255,1,0,47,8,0,0,
+0,0,0,0,216,255,1,0,226,255,1,0,48,8,0,0,0,0,0,0,
+235,255,1,0,243,255,1,0,49,8,0,0,0,0,0,0,250,255,1,0,
+8,0,2,0,55,8,0,0,0,0,0,0,13,0,2,0,18,0,2,0,
+57,8,0,0,0,0,0,0,25,0,2,0,40,0,2,0,59,8,0,0,
+0,0,0,0,46,0,2,0,63,0,2,0,60,8,0,0,0,0,0,0,
+69,0,2,0,83,0,2,0,61,8,0,0,0,0,0,0,90,0,2,0,
+103,0,2,0,62,8,0,0,0,0,0,0,110,0,2,0,117,0,2,0,
+63,8,0,0,0,0,0,0,131,0,2,0,141,0,2,0,64,8,0,0,
+0,0,0,0,146,0,2,0,157,0,2,0,65,8,0,0,0,0,0,0,
+162,0,2,0,167,0,2,0,66,8,0,0,0,0,0,0,174,0,2,0,
+184,0,2,0,67,8,0,0,0,0,0,0,191,0,2,0,197,0,2,0,
+71,8,0,0,0,0,0,0,209,0,2,0,213,0,2,0,87,8,0,0,
+0,0,0,0,224,0,2,0,229,0,2,0,88,8,0,0,0,0,0,0,
+240,0,2,0,246,0,2,0,89,8,0,0,0,0,0,0,1,1,2,0,
+4,1,2,0,90,8,0,0,0,0,0,0,15,1,2,0,19,1,2,0,
+91,8,0,0,0,0,0,0,28,1,2,0,38,1,2,0,92,8,0,0,
+0,0,0,0,46,1,2,0,52,1,2,0,96,8,0,0,0,0,0,0,
+61,1,2,0,74,1,2,0,97,8,0,0,0,0,0,0,85,1,2,0,
+96,1,2,0,98,8,0,0,0,0,0,0,113,1,2,0,119,1,2,0,
+99,8,0,0,0,0,0,0,132,1,2,0,139,1,2,0,100,8,0,0,
+0,0,0,0,152,1,2,0,160,1,2,0,101,8,0,0,0,0,0,0,
+173,1,2,0,179,1,2,0,102,8,0,0,0,0,0,0,190,1,2,0,
+200,1,2,0,103,8,0,0,0,0,0,0,207,1,2,0,219,1,2,0,
+104,8,0,0,0,0,0,0,226,1,2,0,237,1,2,0,114,8,0,0,
+0,0,0,0,247,1,2,0,2,2,2,0,115,8,0,0,0,0,0,0,
+12,2,2,0,25,2,2,0,116,8,0,0,0,0,0,0,36,2,2,0,
+47,2,2,0,117,8,0,0,0,0,0,0,56,2,2,0,67,2,2,0,
+118,8,0,0,0,0,0,0,76,2,2,0,88,2,2,0,119,8,0,0,
+0,0,0,0,99,2,2,0,105,2,2,0,123,8,0,0,0,0,0,0,
+116,2,2,0,125,2,2,0,124,8,0,0,0,0,0,0,136,2,2,0,
+149,2,2,0,125,8,0,0,0,0,0,0,155,2,2,0,166,2,2,0,
+126,8,0,0,0,0,0,0,183,2,2,0,198,2,2,0,127,8,0,0,
+0,0,0,0,211,2,2,0,224,2,2,0,128,8,0,0,0,0,0,0,
+239,2,2,0,243,2,2,0,129,8,0,0,0,0,0,0,0,3,2,0,
+6,3,2,0,130,8,0,0,0,0,0,0,17,3,2,0,23,3,2,0,
+131,8,0,0,0,0,0,0,36,3,2,0,43,3,2,0,132,8,0,0,
+0,0,0,0,56,3,2,0,64,3,2,0,133,8,0,0,0,0,0,0,
+77,3,2,0,97,3,2,0,137,8,0,0,0,0,0,0,103,3,2,0,
+110,3,2,0,138,8,0,0,0,0,0,0,130,3,2,0,138,3,2,0,
+139,8,0,0,0,0,0,0,158,3,2,0,167,3,2,0,140,8,0,0,
+0,0,0,0,187,3,2,0,205,3,2,0,141,8,0,0,0,0,0,0,
+229,3,2,0,236,3,2,0,142,8,0,0,0,0,0,0,254,3,2,0,
+4,4,2,0,146,8,0,0,0,0,0,0,11,4,2,0,20,4,2,0,
+147,8,0,0,0,0,0,0,28,4,2,0,33,4,2,0,148,8,0,0,
+0,0,0,0,47,4,2,0,52,4,2,0,149,8,0,0,0,0,0,0,
+61,4,2,0,70,4,2,0,150,8,0,0,0,0,0,0,83,4,2,0,
+89,4,2,0,151,8,0,0,0,0,0,0,99,4,2,0,104,4,2,0,
+155,8,0,0,0,0,0,0,116,4,2,0,120,4,2,0,156,8,0,0,
+0,0,0,0,125,4,2,0,131,4,2,0,157,8,0,0,0,0,0,0,
+139,4,2,0,152,4,2,0,158,8,0,0,0,0,0,0,157,4,2,0,
+171,4,2,0,159,8,0,0,0,0,0,0,187,4,2,0,195,4,2,0,
+160,8,0,0,0,0,0,0,205,4,2,0,210,4,2,0,161,8,0,0,
+0,0,0,0,222,4,2,0,229,4,2,0,162,8,0,0,0,0,0,0,
+239,4,2,0,248,4,2,0,166,8,0,0,0,0,0,0,255,4,2,0,
+6,5,2,0,172,8,0,0,0,0,0,0,17,5,2,0,34,5,2,0,
+173,8,0,0,0,0,0,0,47,5,2,0,60,5,2,0,174,8,0,0,
+0,0,0,0,71,5,2,0,82,5,2,0,175,8,0,0,0,0,0,0,
+96,5,2,0,100,5,2,0,176,8,0,0,0,0,0,0,113,5,2,0,
+130,5,2,0,177,8,0,0,0,0,0,0,143,5,2,0,161,5,2,0,
+178,8,0,0,0,0,0,0,172,5,2,0,190,5,2,0,179,8,0,0,
+0,0,0,0,203,5,2,0,216,5,2,0,180,8,0,0,0,0,0,0,
+227,5,2,0,241,5,2,0,181,8,0,0,0,0,0,0,255,5,2,0,
+13,6,2,0,182,8,0,0,0,0,0,0,24,6,2,0,42,6,2,0,
+183,8,0,0,0,0,0,0,56,6,2,0,75,6,2,0,184,8,0,0,
+0,0,0,0,88,6,2,0,107,6,2,0,185,8,0,0,0,0,0,0,
+120,6,2,0,131,6,2,0,186,8,0,0,0,0,0,0,147,6,2,0,
+165,6,2,0,187,8,0,0,0,0,0,0,176,6,2,0,195,6,2,0,
+188,8,0,0,0,0,0,0,206,6,2,0,225,6,2,0,189,8,0,0,
+0,0,0,0,236,6,2,0,249,6,2,0,190,8,0,0,0,0,0,0,
+4,7,2,0,18,7,2,0,191,8,0,0,0,0,0,0,29,7,2,0,
+43,7,2,0,192,8,0,0,0,0,0,0,54,7,2,0,65,7,2,0,
+193,8,0,0,0,0,0,0,77,7,2,0,82,7,2,0,194,8,0,0,
+0,0,0,0,94,7,2,0,104,7,2,0,195,8,0,0,0,0,0,0,
+116,7,2,0,125,7,2,0,196,8,0,0,0,0,0,0,140,7,2,0,
+150,7,2,0,197,8,0,0,0,0,0,0,164,7,2,0,170,7,2,0,
+198,8,0,0,0,0,0,0,185,7,2,0,191,7,2,0,199,8,0,0,
+0,0,0,0,203,7,2,0,218,7,2,0,200,8,0,0,0,0,0,0,
+229,7,2,0,246,7,2,0,201,8,0,0,0,0,0,0,2,8,2,0,
+18,8,2,0,202,8,0,0,0,0,0,0,30,8,2,0,44,8,2,0,
+204,8,0,0,0,0,0,0,62,8,2,0,67,8,2,0,205,8,0,0,
+0,0,0,0,79,8,2,0,90,8,2,0,206,8,0,0,0,0,0,0,
+104,8,2,0,122,8,2,0,207,8,0,0,0,0,0,0,136,8,2,0,
+140,8,2,0,214,8,0,0,0,0,0,0,149,8,2,0,158,8,2,0,
+215,8,0,0,0,0,0,0,167,8,2,0,175,8,2,0,216,8,0,0,
+0,0,0,0,186,8,2,0,196,8,2,0,217,8,0,0,0,0,0,0,
+224,8,2,0,239,8,2,0,218,8,0,0,0,0,0,0,255,8,2,0,
+13,9,2,0,219,8,0,0,0,0,0,0,23,9,2,0,34,9,2,0,
+1,9,0,0,0,0,0,0,38,9,2,0,47,9,2,0,48,9,0,0,
+0,0,0,0,59,9,2,0,67,9,2,0,50,9,0,0,0,0,0,0,
+79,9,2,0,86,9,2,0,51,9,0,0,0,0,0,0,99,9,2,0,
+103,9,2,0,52,9,0,0,0,0,0,0,111,9,2,0,115,9,2,0,
+53,9,0,0,0,0,0,0,136,9,2,0,140,9,2,0,54,9,0,0,
+0,0,0,0,161,9,2,0,166,9,2,0,55,9,0,0,0,0,0,0,
+170,9,2,0,174,9,2,0,56,9,0,0,0,0,0,0,193,9,2,0,
+198,9,2,0,57,9,0,0,0,0,0,0,206,9,2,0,211,9,2,0,
+58,9,0,0,0,0,0,0,224,9,2,0,230,9,2,0,59,9,0,0,
+0,0,0,0,241,9,2,0,248,9,2,0,60,9,0,0,0,0,0,0,
+7,10,2,0,15,10,2,0,61,9,0,0,0,0,0,0,28,10,2,0,
+37,10,2,0,64,9,0,0,0,0,0,0,42,10,2,0,46,10,2,0,
+65,9,0,0,0,0,0,0,55,10,2,0,60,10,2,0,66,9,0,0,
+0,0,0,0,70,10,2,0,74,10,2,0,67,9,0,0,0,0,0,0,
+77,10,2,0,81,10,2,0,68,9,0,0,0,0,0,0,90,10,2,0,
+94,10,2,0,69,9,0,0,0,0,0,0,105,10,2,0,109,10,2,0,
+70,9,0,0,0,0,0,0,120,10,2,0,125,10,2,0,71,9,0,0,
+0,0,0,0,136,10,2,0,149,10,2,0,72,9,0,0,0,0,0,0,
+161,10,2,0,172,10,2,0,73,9,0,0,0,0,0,0,185,10,2,0,
+198,10,2,0,75,9,0,0,0,0,0,0,214,10,2,0,226,10,2,0,
+77,9,0,0,0,0,0,0,239,10,2,0,244,10,2,0,78,9,0,0,
+0,0,0,0,0,11,2,0,7,11,2,0,80,9,0,0,0,0,0,0,
+17,11,2,0,25,11,2,0,81,9,0,0,0,0,0,0,32,11,2,0,
+40,11,2,0,82,9,0,0,0,0,0,0,50,11,2,0,55,11,2,0,
+83,9,0,0,0,0,0,0,62,11,2,0,67,11,2,0,84,9,0,0,
+0,0,0,0,76,11,2,0,81,11,2,0,85,9,0,0,0,0,0,0,
+90,11,2,0,105,11,2,0,86,9,0,0,0,0,0,0,115,11,2,0,
+121,11,2,0,88,9,0,0,0,0,0,0,126,11,2,0,140,11,2,0,
+94,9,0,0,0,0,0,0,154,11,2,0,159,11,2,0,95,9,0,0,
+0,0,0,0,166,11,2,0,180,11,2,0,96,9,0,0,0,0,0,0,
+188,11,2,0,198,11,2,0,97,9,0,0,0,0,0,0,211,11,2,0,
+221,11,2,0,99,9,0,0,0,0,0,0,231,11,2,0,242,11,2,0,
+100,9,0,0,0,0,0,0,252,11,2,0,8,12,2,0,102,9,0,0,
+0,0,0,0,15,12,2,0,24,12,2,0,105,9,0,0,0,0,0,0,
+33,12,2,0,41,12,2,0,109,9,0,0,0,0,0,0,48,12,2,0,
+58,12,2,0,115,9,0,0,0,0,0,0,66,12,2,0,68,12,2,0,
+116,9,0,0,0,0,0,0,78,12,2,0,81,12,2,0,117,9,0,0,
+0,0,0,0,83,12,2,0,90,12,2,0,131,9,0,0,0,0,0,0,
+96,12,2,0,101,12,2,0,132,9,0,0,0,0,0,0,107,12,2,0,
+114,12,2,0,136,9,0,0,0,0,0,0,123,12,2,0,130,12,2,0,
+137,9,0,0,0,0,0,0,138,12,2,0,150,12,2,0,138,9,0,0,
+0,0,0,0,160,12,2,0,171,12,2,0,139,9,0,0,0,0,0,0,
+181,12,2,0,190,12,2,0,140,9,0,0,0,0,0,0,200,12,2,0,
+208,12,2,0,141,9,0,0,0,0,0,0,215,12,2,0,219,12,2,0,
+142,9,0,0,0,0,0,0,227,12,2,0,238,12,2,0,143,9,0,0,
+0,0,0,0,245,12,2,0,2,13,2,0,144,9,0,0,0,0,0,0,
+9,13,2,0,20,13,2,0,145,9,0,0,0,0,0,0,33,13,2,0,
+41,13,2,0,146,9,0,0,0,0,0,0,53,13,2,0,61,13,2,0,
+147,9,0,0,0,0,0,0,77,13,2,0,81,13,2,0,153,9,0,0,
+0,0,0,0,102,13,2,0,121,13,2,0,154,9,0,0,0,0,0,0,
+125,13,2,0,132,13,2,0,155,9,0,0,0,0,0,0,136,13,2,0,
+143,13,2,0,156,9,0,0,0,0,0,0,167,13,2,0,176,13,2,0,
+157,9,0,0,0,0,0,0,202,13,2,0,207,13,2,0,158,9,0,0,
+0,0,0,0,223,13,2,0,231,13,2,0,160,9,0,0,0,0,0,0,
+243,13,2,0,251,13,2,0,161,9,0,0,0,0,0,0,8,14,2,0,
+14,14,2,0,162,9,0,0,0,0,0,0,22,14,2,0,29,14,2,0,
+173,9,0,0,0,0,0,0,41,14,2,0,45,14,2,0,175,9,0,0,
+0,0,0,0,52,14,2,0,60,14,2,0,183,9,0,0,0,0,0,0,
+71,14,2,0,81,14,2,0,187,9,0,0,0,0,0,0,90,14,2,0,
+105,14,2,0,189,9,0,0,0,0,0,0,118,14,2,0,133,14,2,0,
+190,9,0,0,0,0,0,0,145,14,2,0,156,14,2,0,191,9,0,0,
+0,0,0,0,171,14,2,0,180,14,2,0,196,9,0,0,0,0,0,0,
+192,14,2,0,207,14,2,0,197,9,0,0,0,0,0,0,219,14,2,0,
+237,14,2,0,198,9,0,0,0,0,0,0,249,14,2,0,9,15,2,0,
+199,9,0,0,0,0,0,0,23,15,2,0,36,15,2,0,200,9,0,0,
+0,0,0,0,50,15,2,0,58,15,2,0,201,9,0,0,0,0,0,0,
+70,15,2,0,82,15,2,0,202,9,0,0,0,0,0,0,101,15,2,0,
+113,15,2,0,203,9,0,0,0,0,0,0,132,15,2,0,139,15,2,0,
+204,9,0,0,0,0,0,0,159,15,2,0,172,15,2,0,205,9,0,0,
+0,0,0,0,192,15,2,0,205,15,2,0,206,9,0,0,0,0,0,0,
+225,15,2,0,234,15,2,0,207,9,0,0,0,0,0,0,247,15,2,0,
+255,15,2,0,208,9,0,0,0,0,0,0,13,16,2,0,21,16,2,0,
+209,9,0,0,0,0,0,0,35,16,2,0,43,16,2,0,210,9,0,0,
+0,0,0,0,55,16,2,0,62,16,2,0,211,9,0,0,0,0,0,0,
+73,16,2,0,86,16,2,0,220,9,0,0,0,0,0,0,125,16,2,0,
+141,16,2,0,221,9,0,0,0,0,0,0,159,16,2,0,175,16,2,0,
+225,9,0,0,0,0,0,0,196,16,2,0,200,16,2,0,226,9,0,0,
+0,0,0,0,216,16,2,0,222,16,2,0,228,9,0,0,0,0,0,0,
+227,16,2,0,240,16,2,0,233,9,0,0,0,0,0,0,11,17,2,0,
+14,17,2,0,234,9,0,0,0,0,0,0,25,17,2,0,42,17,2,0,
+235,9,0,0,0,0,0,0,72,17,2,0,91,17,2,0,236,9,0,0,
+0,0,0,0,97,17,2,0,114,17,2,0,237,9,0,0,0,0,0,0,
+124,17,2,0,140,17,2,0,238,9,0,0,0,0,0,0,150,17,2,0,
+163,17,2,0,239,9,0,0,0,0,0,0,172,17,2,0,184,17,2,0,
+240,9,0,0,0,0,0,0,190,17,2,0,203,17,2,0,241,9,0,0,
+0,0,0,0,220,17,2,0,240,17,2,0,248,9,0,0,0,0,0,0,
+27,18,2,0,45,18,2,0,249,9,0,0,0,0,0,0,67,18,2,0,
+88,18,2,0,250,9,0,0,0,0,0,0,117,18,2,0,136,18,2,0,
+251,9,0,0,0,0,0,0,161,18,2,0,168,18,2,0,252,9,0,0,
+0,0,0,0,187,18,2,0,194,18,2,0,253,9,0,0,0,0,0,0,
+203,18,2,0,218,18,2,0,254,9,0,0,0,0,0,0,231,18,2,0,
+235,18,2,0,255,9,0,0,0,0,0,0,248,18,2,0,252,18,2,0,
+0,10,0,0,0,0,0,0,15,19,2,0,19,19,2,0,6,10,0,0,
+0,0,0,0,36,19,2,0,44,19,2,0,58,10,0,0,0,0,0,0,
+65,19,2,0,74,19,2,0,59,10,0,0,0,0,0,0,84,19,2,0,
+92,19,2,0,60,10,0,0,0,0,0,0,110,19,2,0,119,19,2,0,
+61,10,0,0,0,0,0,0,138,19,2,0,155,19,2,0,62,10,0,0,
+0,0,0,0,176,19,2,0,183,19,2,0,67,10,0,0,0,0,0,0,
+200,19,2,0,214,19,2,0,68,10,0,0,0,0,0,0,227,19,2,0,
+236,19,2,0,69,10,0,0,0,0,0,0,253,19,2,0,1,20,2,0,
+70,10,0,0,0,0,0,0,18,20,2,0,26,20,2,0,72,10,0,0,
+0,0,0,0,47,20,2,0,55,20,2,0,82,10,0,0,0,0,0,0,
+76,20,2,0,86,20,2,0,83,10,0,0,0,0,0,0,94,20,2,0,
+101,20,2,0,84,10,0,0,0,0,0,0,109,20,2,0,114,20,2,0,
+85,10,0,0,0,0,0,0,122,20,2,0,131,20,2,0,86,10,0,0,
+0,0,0,0,156,20,2,0,173,20,2,0,87,10,0,0,0,0,0,0,
+182,20,2,0,187,20,2,0,93,10,0,0,0,0,0,0,189,20,2,0,
+195,20,2,0,94,10,0,0,0,0,0,0,197,20,2,0,202,20,2,0,
+95,10,0,0,0,0,0,0,204,20,2,0,213,20,2,0,97,10,0,0,
+0,0,0,0,215,20,2,0,222,20,2,0,99,10,0,0,0,0,0,0,
+225,20,2,0,231,20,2,0,100,10,0,0,0,0,0,0,234,20,2,0,
+246,20,2,0,101,10,0,0,0,0,0,0,249,20,2,0,255,20,2,0,
+102,10,0,0,0,0,0,0,2,21,2,0,8,21,2,0,103,10,0,0,
+0,0,0,0,11,21,2,0,17,21,2,0,104,10,0,0,0,0,0,0,
+20,21,2,0,26,21,2,0,105,10,0,0,0,0,0,0,29,21,2,0,
+38,21,2,0,106,10,0,0,0,0,0,0,42,21,2,0,54,21,2,0,
+107,10,0,0,0,0,0,0,58,21,2,0,64,21,2,0,108,10,0,0,
+0,0,0,0,68,21,2,0,79,21,2,0,109,10,0,0,0,0,0,0,
+88,21,2,0,94,21,2,0,110,10,0,0,0,0,0,0,99,21,2,0,
+110,21,2,0,114,10,0,0,0,0,0,0,113,21,2,0,119,21,2,0,
+115,10,0,0,0,0,0,0,122,21,2,0,132,21,2,0,116,10,0,0,
+0,0,0,0,136,21,2,0,141,21,2,0,117,10,0,0,0,0,0,0,
+145,21,2,0,157,21,2,0,118,10,0,0,0,0,0,0,161,21,2,0,
+168,21,2,0,119,10,0,0,0,0,0,0,176,21,2,0,181,21,2,0,
+120,10,0,0,0,0,0,0,191,21,2,0,202,21,2,0,128,10,0,0,
+0,0,0,0,219,21,2,0,229,21,2,0,129,10,0,0,0,0,0,0,
+246,21,2,0,1,22,2,0,130,10,0,0,0,0,0,0,17,22,2,0,
+31,22,2,0,131,10,0,0,0,0,0,0,51,22,2,0,58,22,2,0,
+132,10,0,0,0,0,0,0,75,22,2,0,82,22,2,0,133,10,0,0,
+0,0,0,0,98,22,2,0,105,22,2,0,134,10,0,0,0,0,0,0,
+121,22,2,0,128,22,2,0,135,10,0,0,0,0,0,0,144,22,2,0,
+151,22,2,0,136,10,0,0,0,0,0,0,167,22,2,0,182,22,2,0,
+138,10,0,0,0,0,0,0,186,22,2,0,194,22,2,0,147,10,0,0,
+0,0,0,0,209,22,2,0,217,22,2,0,148,10,0,0,0,0,0,0,
+232,22,2,0,240,22,2,0,149,10,0,0,0,0,0,0,255,22,2,0,
+7,23,2,0,150,10,0,0,0,0,0,0,22,23,2,0,30,23,2,0,
+151,10,0,0,0,0,0,0,45,23,2,0,53,23,2,0,152,10,0,0,
+0,0,0,0,68,23,2,0,76,23,2,0,153,10,0,0,0,0,0,0,
+91,23,2,0,99,23,2,0,154,10,0,0,0,0,0,0,113,23,2,0,
+121,23,2,0,155,10,0,0,0,0,0,0,135,23,2,0,143,23,2,0,
+156,10,0,0,0,0,0,0,157,23,2,0,166,23,2,0,157,10,0,0,
+0,0,0,0,180,23,2,0,188,23,2,0,159,10,0,0,0,0,0,0,
+204,23,2,0,212,23,2,0,160,10,0,0,0,0,0,0,227,23,2,0,
+235,23,2,0,161,10,0,0,0,0,0,0,250,23,2,0,2,24,2,0,
+162,10,0,0,0,0,0,0,17,24,2,0,25,24,2,0,163,10,0,0,
+0,0,0,0,40,24,2,0,48,24,2,0,164,10,0,0,0,0,0,0,
+63,24,2,0,71,24,2,0,165,10,0,0,0,0,0,0,86,24,2,0,
+94,24,2,0,166,10,0,0,0,0,0,0,108,24,2,0,116,24,2,0,
+167,10,0,0,0,0,0,0,130,24,2,0,138,24,2,0,168,10,0,0,
+0,0,0,0,152,24,2,0,161,24,2,0,169,10,0,0,0,0,0,0,
+175,24,2,0,183,24,2,0,171,10,0,0,0,0,0,0,198,24,2,0,
+206,24,2,0,172,10,0,0,0,0,0,0,221,24,2,0,229,24,2,0,
+173,10,0,0,0,0,0,0,244,24,2,0,252,24,2,0,174,10,0,0,
+0,0,0,0,11,25,2,0,19,25,2,0,175,10,0,0,0,0,0,0,
+34,25,2,0,42,25,2,0,176,10,0,0,0,0,0,0,57,25,2,0,
+65,25,2,0,177,10,0,0,0,0,0,0,80,25,2,0,88,25,2,0,
+178,10,0,0,0,0,0,0,102,25,2,0,110,25,2,0,179,10,0,0,
+0,0,0,0,124,25,2,0,132,25,2,0,180,10,0,0,0,0,0,0,
+146,25,2,0,155,25,2,0,181,10,0,0,0,0,0,0,169,25,2,0,
+173,25,2,0,185,10,0,0,0,0,0,0,189,25,2,0,204,25,2,0,
+198,10,0,0,0,0,0,0,230,25,2,0,237,25,2,0,199,10,0,0,
+0,0,0,0,252,25,2,0,11,26,2,0,200,10,0,0,0,0,0,0,
+26,26,2,0,33,26,2,0,201,10,0,0,0,0,0,0,48,26,2,0,
+65,26,2,0,202,10,0,0,0,0,0,0,80,26,2,0,89,26,2,0,
+203,10,0,0,0,0,0,0,106,26,2,0,122,26,2,0,204,10,0,0,
+0,0,0,0,137,26,2,0,145,26,2,0,205,10,0,0,0,0,0,0,
+161,26,2,0,175,26,2,0,206,10,0,0,0,0,0,0,201,26,2,0,
+207,26,2,0,207,10,0,0,0,0,0,0,221,26,2,0,235,26,2,0,
+208,10,0,0,0,0,0,0,249,26,2,0,255,26,2,0,209,10,0,0,
+0,0,0,0,13,27,2,0,33,27,2,0,210,10,0,0,0,0,0,0,
+47,27,2,0,59,27,2,0,211,10,0,0,0,0,0,0,79,27,2,0,
+96,27,2,0,212,10,0,0,0,0,0,0,110,27,2,0,119,27,2,0,
+213,10,0,0,0,0,0,0,136,27,2,0,153,27,2,0,214,10,0,0,
+0,0,0,0,167,27,2,0,176,27,2,0,215,10,0,0,0,0,0,0,
+193,27,2,0,212,27,2,0,216,10,0,0,0,0,0,0,226,27,2,0,
+237,27,2,0,217,10,0,0,0,0,0,0,0,28,2,0,17,28,2,0,
+218,10,0,0,0,0,0,0,31,28,2,0,40,28,2,0,219,10,0,0,
+0,0,0,0,57,28,2,0,76,28,2,0,220,10,0,0,0,0,0,0,
+90,28,2,0,101,28,2,0,221,10,0,0,0,0,0,0,120,28,2,0,
+136,28,2,0,222,10,0,0,0,0,0,0,162,28,2,0,170,28,2,0,
+223,10,0,0,0,0,0,0,186,28,2,0,202,28,2,0,224,10,0,0,
+0,0,0,0,232,28,2,0,240,28,2,0,225,10,0,0,0,0,0,0,
+0,29,2,0,23,29,2,0,226,10,0,0,0,0,0,0,39,29,2,0,
+54,29,2,0,227,10,0,0,0,0,0,0,70,29,2,0,85,29,2,0,
+228,10,0,0,0,0,0,0,111,29,2,0,118,29,2,0,229,10,0,0,
+0,0,0,0,133,29,2,0,151,29,2,0,230,10,0,0,0,0,0,0,
+166,29,2,0,176,29,2,0,231,10,0,0,0,0,0,0,194,29,2,0,
+211,29,2,0,232,10,0,0,0,0,0,0,226,29,2,0,235,29,2,0,
+233,10,0,0,0,0,0,0,252,29,2,0,11,30,2,0,234,10,0,0,
+0,0,0,0,26,30,2,0,33,30,2,0,235,10,0,0,0,0,0,0,
+48,30,2,0,67,30,2,0,236,10,0,0,0,0,0,0,93,30,2,0,
+104,30,2,0,237,10,0,0,0,0,0,0,123,30,2,0,140,30,2,0,
+238,10,0,0,0,0,0,0,166,30,2,0,175,30,2,0,239,10,0,0,
+0,0,0,0,192,30,2,0,211,30,2,0,240,10,0,0,0,0,0,0,
+241,30,2,0,252,30,2,0,241,10,0,0,0,0,0,0,15,31,2,0,
+35,31,2,0,242,10,0,0,0,0,0,0,54,31,2,0,71,31,2,0,
+243,10,0,0,0,0,0,0,91,31,2,0,109,31,2,0,244,10,0,0,
+0,0,0,0,129,31,2,0,139,31,2,0,245,10,0,0,0,0,0,0,
+157,31,2,0,171,31,2,0,246,10,0,0,0,0,0,0,186,31,2,0,
+197,31,2,0,247,10,0,0,0,0,0,0,211,31,2,0,227,31,2,0,
+248,10,0,0,0,0,0,0,241,31,2,0,254,31,2,0,249,10,0,0,
+0,0,0,0,14,32,2,0,21,32,2,0,255,10,0,0,0,0,0,0,
+31,32,2,0,44,32,2,0,7,11,0,0,0,0,0,0,55,32,2,0,
+68,32,2,0,8,11,0,0,0,0,0,0,84,32,2,0,95,32,2,0,
+9,11,0,0,0,0,0,0,117,32,2,0,131,32,2,0,15,11,0,0,
+0,0,0,0,148,32,2,0,162,32,2,0,19,11,0,0,0,0,0,0,
+178,32,2,0,192,32,2,0,24,11,0,0,0,0,0,0,201,32,2,0,
+209,32,2,0,27,11,0,0,0,0,0,0,216,32,2,0,233,32,2,0,
+32,11,0,0,0,0,0,0,245,32,2,0,1,33,2,0,36,11,0,0,
+0,0,0,0,8,33,2,0,17,33,2,0,37,11,0,0,0,0,0,0,
+30,33,2,0,44,33,2,0,38,11,0,0,0,0,0,0,53,33,2,0,
+62,33,2,0,39,11,0,0,0,0,0,0,71,33,2,0,86,33,2,0,
+50,11,0,0,0,0,0,0,103,33,2,0,109,33,2,0,51,11,0,0,
+0,0,0,0,124,33,2,0,138,33,2,0,52,11,0,0,0,0,0,0,
+148,33,2,0,154,33,2,0,53,11,0,0,0,0,0,0,168,33,2,0,
+181,33,2,0,54,11,0,0,0,0,0,0,198,33,2,0,214,33,2,0,
+55,11,0,0,0,0,0,0,228,33,2,0,236,33,2,0,56,11,0,0,
+0,0,0,0,252,33,2,0,1,34,2,0,57,11,0,0,0,0,0,0,
+12,34,2,0,14,34,2,0,58,11,0,0,0,0,0,0,21,34,2,0,
+41,34,2,0,60,11,0,0,0,0,0,0,55,34,2,0,66,34,2,0,
+61,11,0,0,0,0,0,0,83,34,2,0,97,34,2,0,62,11,0,0,
+0,0,0,0,108,34,2,0,115,34,2,0,63,11,0,0,0,0,0,0,
+129,34,2,0,135,34,2,0,65,11,0,0,0,0,0,0,144,34,2,0,
+154,34,2,0,69,11,0,0,0,0,0,0,165,34,2,0,175,34,2,0,
+70,11,0,0,0,0,0,0,188,34,2,0,200,34,2,0,71,11,0,0,
+0,0,0,0,211,34,2,0,217,34,2,0,72,11,0,0,0,0,0,0,
+228,34,2,0,234,34,2,0,73,11,0,0,0,0,0,0,247,34,2,0,
+252,34,2,0,75,11,0,0,0,0,0,0,2,35,2,0,12,35,2,0,
+76,11,0,0,0,0,0,0,23,35,2,0,34,35,2,0,77,11,0,0,
+0,0,0,0,47,35,2,0,55,35,2,0,78,11,0,0,0,0,0,0,
+66,35,2,0,73,35,2,0,79,11,0,0,0,0,0,0,84,35,2,0,
+92,35,2,0,80,11,0,0,0,0,0,0,103,35,2,0,113,35,2,0,
+81,11,0,0,0,0,0,0,124,35,2,0,135,35,2,0,82,11,0,0,
+0,0,0,0,147,35,2,0,157,35,2,0,83,11,0,0,0,0,0,0,
+169,35,2,0,174,35,2,0,84,11,0,0,0,0,0,0,186,35,2,0,
+194,35,2,0,85,11,0,0,0,0,0,0,206,35,2,0,216,35,2,0,
+86,11,0,0,0,0,0,0,228,35,2,0,240,35,2,0,87,11,0,0,
+0,0,0,0,252,35,2,0,4,36,2,0,88,11,0,0,0,0,0,0,
+16,36,2,0,25,36,2,0,89,11,0,0,0,0,0,0,37,36,2,0,
+43,36,2,0,90,11,0,0,0,0,0,0,55,36,2,0,68,36,2,0,
+94,11,0,0,0,0,0,0,81,36,2,0,90,36,2,0,95,11,0,0,
+0,0,0,0,103,36,2,0,111,36,2,0,96,11,0,0,0,0,0,0,
+124,36,2,0,129,36,2,0,97,11,0,0,0,0,0,0,142,36,2,0,
+154,36,2,0,98,11,0,0,0,0,0,0,167,36,2,0,175,36,2,0,
+99,11,0,0,0,0,0,0,188,36,2,0,194,36,2,0,100,11,0,0,
+0,0,0,0,207,36,2,0,214,36,2,0,101,11,0,0,0,0,0,0,
+227,36,2,0,234,36,2,0,102,11,0,0,0,0,0,0,248,36,2,0,
+255,36,2,0,103,11,0,0,0,0,0,0,6,37,2,0,15,37,2,0,
+104,11,0,0,0,0,0,0,22,37,2,0,29,37,2,0,105,11,0,0,
+0,0,0,0,43,37,2,0,50,37,2,0,106,11,0,0,0,0,0,0,
+64,37,2,0,69,37,2,0,107,11,0,0,0,0,0,0,83,37,2,0,
+96,37,2,0,108,11,0,0,0,0,0,0,110,37,2,0,116,37,2,0,
+109,11,0,0,0,0,0,0,130,37,2,0,142,37,2,0,110,11,0,0,
+0,0,0,0,156,37,2,0,163,37,2,0,111,11,0,0,0,0,0,0,
+177,37,2,0,190,37,2,0,112,11,0,0,0,0,0,0,204,37,2,0,
+216,37,2,0,113,11,0,0,0,0,0,0,230,37,2,0,242,37,2,0,
+120,11,0,0,0,0,0,0,246,37,2,0,250,37,2,0,122,11,0,0,
+0,0,0,0,5,38,2,0,13,38,2,0,123,11,0,0,0,0,0,0,
+27,38,2,0,31,38,2,0,130,11,0,0,0,0,0,0,39,38,2,0,
+44,38,2,0,136,11,0,0,0,0,0,0,50,38,2,0,52,38,2,0,
+137,11,0,0,0,0,0,0,57,38,2,0,63,38,2,0,143,11,0,0,
+0,0,0,0,70,38,2,0,77,38,2,0,144,11,0,0,0,0,0,0,
+84,38,2,0,91,38,2,0,147,11,0,0,0,0,0,0,98,38,2,0,
+102,38,2,0,148,11,0,0,0,0,0,0,109,38,2,0,113,38,2,0,
+153,11,0,0,0,0,0,0,122,38,2,0,126,38,2,0,155,11,0,0,
+0,0,0,0,135,38,2,0,141,38,2,0,166,11,0,0,0,0,0,0,
+150,38,2,0,158,38,2,0,167,11,0,0,0,0,0,0,164,38,2,0,
+177,38,2,0,179,11,0,0,0,0,0,0,196,38,2,0,207,38,2,0,
+181,11,0,0,0,0,0,0,227,38,2,0,236,38,2,0,191,11,0,0,
+0,0,0,0,246,38,2,0,253,38,2,0,207,11,0,0,0,0,0,0,
+255,38,2,0,11,39,2,0,208,11,0,0,0,0,0,0,35,39,2,0,
+46,39,2,0,209,11,0,0,0,0,0,0,50,39,2,0,61,39,2,0,
+210,11,0,0,0,0,0,0,65,39,2,0,79,39,2,0,211,11,0,0,
+0,0,0,0,83,39,2,0,96,39,2,0,212,11,0,0,0,0,0,0,
+100,39,2,0,111,39,2,0,213,11,0,0,0,0,0,0,136,39,2,0,
+147,39,2,0,214,11,0,0,0,0,0,0,172,39,2,0,185,39,2,0,
+215,11,0,0,0,0,0,0,209,39,2,0,222,39,2,0,216,11,0,0,
+0,0,0,0,246,39,2,0,7,40,2,0,218,11,0,0,0,0,0,0,
+43,40,2,0,57,40,2,0,219,11,0,0,0,0,0,0,87,40,2,0,
+104,40,2,0,220,11,0,0,0,0,0,0,131,40,2,0,140,40,2,0,
+224,11,0,0,0,0,0,0,154,40,2,0,164,40,2,0,231,11,0,0,
+0,0,0,0,166,40,2,0,186,40,2,0,232,11,0,0,0,0,0,0,
+196,40,2,0,205,40,2,0,233,11,0,0,0,0,0,0,219,40,2,0,
+231,40,2,0,234,11,0,0,0,0,0,0,245,40,2,0,0,41,2,0,
+235,11,0,0,0,0,0,0,14,41,2,0,28,41,2,0,236,11,0,0,
+0,0,0,0,43,41,2,0,60,41,2,0,237,11,0,0,0,0,0,0,
+75,41,2,0,91,41,2,0,238,11,0,0,0,0,0,0,106,41,2,0,
+113,41,2,0,239,11,0,0,0,0,0,0,117,41,2,0,130,41,2,0,
+240,11,0,0,0,0,0,0,134,41,2,0,140,41,2,0,241,11,0,0,
+0,0,0,0,156,41,2,0,166,41,2,0,242,11,0,0,0,0,0,0,
+176,41,2,0,186,41,2,0,243,11,0,0,0,0,0,0,195,41,2,0,
+204,41,2,0,244,11,0,0,0,0,0,0,216,41,2,0,223,41,2,0,
+245,11,0,0,0,0,0,0,234,41,2,0,245,41,2,0,246,11,0,0,
+0,0,0,0,3,42,2,0,18,42,2,0,247,11,0,0,0,0,0,0,
+35,42,2,0,54,42,2,0,248,11,0,0,0,0,0,0,70,42,2,0,
+89,42,2,0,249,11,0,0,0,0,0,0,108,42,2,0,120,42,2,0,
+1,12,0,0,0,0,0,0,136,42,2,0,144,42,2,0,3,12,0,0,
+0,0,0,0,159,42,2,0,175,42,2,0,5,12,0,0,0,0,0,0,
+190,42,2,0,205,42,2,0,6,12,0,0,0,0,0,0,220,42,2,0,
+237,42,2,0,7,12,0,0,0,0,0,0,251,42,2,0,11,43,2,0,
+8,12,0,0,0,0,0,0,22,43,2,0,29,43,2,0,9,12,0,0,
+0,0,0,0,37,43,2,0,58,43,2,0,10,12,0,0,0,0,0,0,
+75,43,2,0,79,43,2,0,11,12,0,0,0,0,0,0,85,43,2,0,
+90,43,2,0,12,12,0,0,0,0,0,0,101,43,2,0,113,43,2,0,
+13,12,0,0,0,0,0,0,123,43,2,0,127,43,2,0,15,12,0,0,
+0,0,0,0,137,43,2,0,142,43,2,0,16,12,0,0,0,0,0,0,
+150,43,2,0,157,43,2,0,17,12,0,0,0,0,0,0,171,43,2,0,
+183,43,2,0,21,12,0,0,0,0,0,0,194,43,2,0,205,43,2,0,
+24,12,0,0,0,0,0,0,212,43,2,0,221,43,2,0,25,12,0,0,
+0,0,0,0,228,43,2,0,233,43,2,0,26,12,0,0,0,0,0,0,
+244,43,2,0,249,43,2,0,27,12,0,0,0,0,0,0,3,44,2,0,
+7,44,2,0,28,12,0,0,0,0,0,0,17,44,2,0,21,44,2,0,
+29,12,0,0,0,0,0,0,31,44,2,0,46,44,2,0,31,12,0,0,
+0,0,0,0,54,44,2,0,70,44,2,0,32,12,0,0,0,0,0,0,
+98,44,2,0,108,44,2,0,34,12,0,0,0,0,0,0,135,44,2,0,
+142,44,2,0,35,12,0,0,0,0,0,0,152,44,2,0,156,44,2,0,
+45,12,0,0,0,0,0,0,166,44,2,0,178,44,2,0,46,12,0,0,
+0,0,0,0,193,44,2,0,206,44,2,0,47,12,0,0,0,0,0,0,
+220,44,2,0,230,44,2,0,48,12,0,0,0,0,0,0,246,44,2,0,
+251,44,2,0,49,12,0,0,0,0,0,0,3,45,2,0,13,45,2,0,
+54,12,0,0,0,0,0,0,20,45,2,0,39,45,2,0,65,12,0,0,
+0,0,0,0,46,45,2,0,54,45,2,0,73,12,0,0,0,0,0,0,
+63,45,2,0,70,45,2,0,74,12,0,0,0,0,0,0,78,45,2,0,
+85,45,2,0,75,12,0,0,0,0,0,0,93,45,2,0,101,45,2,0,
+76,12,0,0,0,0,0,0,110,45,2,0,119,45,2,0,77,12,0,0,
+0,0,0,0,127,45,2,0,129,45,2,0,86,12,0,0,0,0,0,0,
+136,45,2,0,141,45,2,0,87,12,0,0,0,0,0,0,153,45,2,0,
+161,45,2,0,88,12,0,0,0,0,0,0,178,45,2,0,192,45,2,0,
+89,12,0,0,0,0,0,0,200,45,2,0,211,45,2,0,90,12,0,0,
+0,0,0,0,226,45,2,0,233,45,2,0,91,12,0,0,0,0,0,0,
+245,45,2,0,250,45,2,0,92,12,0,0,0,0,0,0,10,46,2,0,
+17,46,2,0,93,12,0,0,0,0,0,0,32,46,2,0,40,46,2,0,
+94,12,0,0,0,0,0,0,59,46,2,0,74,46,2,0,95,12,0,0,
+0,0,0,0,93,46,2,0,98,46,2,0,96,12,0,0,0,0,0,0,
+109,46,2,0,113,46,2,0,97,12,0,0,0,0,0,0,122,46,2,0,
+127,46,2,0,98,12,0,0,0,0,0,0,137,46,2,0,143,46,2,0,
+99,12,0,0,0,0,0,0,154,46,2,0,162,46,2,0,100,12,0,0,
+0,0,0,0,176,46,2,0,182,46,2,0,101,12,0,0,0,0,0,0,
+194,46,2,0,201,46,2,0,102,12,0,0,0,0,0,0,215,46,2,0,
+228,46,2,0,103,12,0,0,0,0,0,0,246,46,2,0,4,47,2,0,
+104,12,0,0,0,0,0,0,17,47,2,0,22,47,2,0,105,12,0,0,
+0,0,0,0,32,47,2,0,49,47,2,0,111,12,0,0,0,0,0,0,
+64,47,2,0,77,47,2,0,112,12,0,0,0,0,0,0,92,47,2,0,
+105,47,2,0,113,12,0,0,0,0,0,0,120,47,2,0,134,47,2,0,
+114,12,0,0,0,0,0,0,149,47,2,0,161,47,2,0,115,12,0,0,
+0,0,0,0,176,47,2,0,188,47,2,0,116,12,0,0,0,0,0,0,
+203,47,2,0,217,47,2,0,117,12,0,0,0,0,0,0,231,47,2,0,
+243,47,2,0,118,12,0,0,0,0,0,0,3,48,2,0,13,48,2,0,
+119,12,0,0,0,0,0,0,28,48,2,0,44,48,2,0,120,12,0,0,
+0,0,0,0,59,48,2,0,78,48,2,0,121,12,0,0,0,0,0,0,
+93,48,2,0,108,48,2,0,122,12,0,0,0,0,0,0,123,48,2,0,
+135,48,2,0,123,12,0,0,0,0,0,0,150,48,2,0,162,48,2,0,
+124,12,0,0,0,0,0,0,178,48,2,0,188,48,2,0,125,12,0,0,
+0,0,0,0,204,48,2,0,218,48,2,0,126,12,0,0,0,0,0,0,
+233,48,2,0,248,48,2,0,127,12,0,0,0,0,0,0,7,49,2,0,
+32,49,2,0,131,12,0,0,0,0,0,0,43,49,2,0,62,49,2,0,
+132,12,0,0,0,0,0,0,74,49,2,0,85,49,2,0,133,12,0,0,
+0,0,0,0,98,49,2,0,110,49,2,0,134,12,0,0,0,0,0,0,
+122,49,2,0,149,49,2,0,135,12,0,0,0,0,0,0,160,49,2,0,
+173,49,2,0,136,12,0,0,0,0,0,0,185,49,2,0,199,49,2,0,
+137,12,0,0,0,0,0,0,210,49,2,0,226,49,2,0,138,12,0,0,
+0,0,0,0,237,49,2,0,251,49,2,0,139,12,0,0,0,0,0,0,
+6,50,2,0,25,50,2,0,140,12,0,0,0,0,0,0,36,50,2,0,
+48,50,2,0,141,12,0,0,0,0,0,0,59,50,2,0,74,50,2,0,
+142,12,0,0,0,0,0,0,85,50,2,0,100,50,2,0,143,12,0,0,
+0,0,0,0,112,50,2,0,124,50,2,0,144,12,0,0,0,0,0,0,
+132,50,2,0,145,50,2,0,145,12,0,0,0,0,0,0,155,50,2,0,
+168,50,2,0,146,12,0,0,0,0,0,0,181,50,2,0,195,50,2,0,
+147,12,0,0,0,0,0,0,201,50,2,0,214,50,2,0,148,12,0,0,
+0,0,0,0,225,50,2,0,242,50,2,0,149,12,0,0,0,0,0,0,
+253,50,2,0,8,51,2,0,150,12,0,0,0,0,0,0,19,51,2,0,
+33,51,2,0,151,12,0,0,0,0,0,0,39,51,2,0,54,51,2,0,
+152,12,0,0,0,0,0,0,66,51,2,0,79,51,2,0,153,12,0,0,
+0,0,0,0,90,51,2,0,103,51,2,0,154,12,0,0,0,0,0,0,
+116,51,2,0,129,51,2,0,155,12,0,0,0,0,0,0,140,51,2,0,
+153,51,2,0,156,12,0,0,0,0,0,0,164,51,2,0,175,51,2,0,
+157,12,0,0,0,0,0,0,188,51,2,0,205,51,2,0,158,12,0,0,
+0,0,0,0,216,51,2,0,226,51,2,0,159,12,0,0,0,0,0,0,
+239,51,2,0,249,51,2,0,160,12,0,0,0,0,0,0,4,52,2,0,
+17,52,2,0,161,12,0,0,0,0,0,0,30,52,2,0,45,52,2,0,
+162,12,0,0,0,0,0,0,58,52,2,0,67,52,2,0,163,12,0,0,
+0,0,0,0,73,52,2,0,89,52,2,0,164,12,0,0,0,0,0,0,
+101,52,2,0,113,52,2,0,165,12,0,0,0,0,0,0,124,52,2,0,
+138,52,2,0,166,12,0,0,0,0,0,0,151,52,2,0,165,52,2,0,
+167,12,0,0,0,0,0,0,176,52,2,0,198,52,2,0,168,12,0,0,
+0,0,0,0,210,52,2,0,223,52,2,0,169,12,0,0,0,0,0,0,
+235,52,2,0,246,52,2,0,170,12,0,0,0,0,0,0,1,53,2,0,
+14,53,2,0,171,12,0,0,0,0,0,0,26,53,2,0,39,53,2,0,
+172,12,0,0,0,0,0,0,51,53,2,0,56,53,2,0,173,12,0,0,
+0,0,0,0,67,53,2,0,78,53,2,0,174,12,0,0,0,0,0,0,
+89,53,2,0,110,53,2,0,175,12,0,0,0,0,0,0,121,53,2,0,
+139,53,2,0,176,12,0,0,0,0,0,0,150,53,2,0,162,53,2,0,
+177,12,0,0,0,0,0,0,173,53,2,0,183,53,2,0,178,12,0,0,
+0,0,0,0,193,53,2,0,208,53,2,0,179,12,0,0,0,0,0,0,
+219,53,2,0,232,53,2,0,180,12,0,0,0,0,0,0,244,53,2,0,
+0,54,2,0,181,12,0,0,0,0,0,0,13,54,2,0,30,54,2,0,
+182,12,0,0,0,0,0,0,41,54,2,0,54,54,2,0,183,12,0,0,
+0,0,0,0,67,54,2,0,82,54,2,0,184,12,0,0,0,0,0,0,
+93,54,2,0,109,54,2,0,185,12,0,0,0,0,0,0,121,54,2,0,
+133,54,2,0,186,12,0,0,0,0,0,0,144,54,2,0,157,54,2,0,
+187,12,0,0,0,0,0,0,169,54,2,0,183,54,2,0,188,12,0,0,
+0,0,0,0,196,54,2,0,212,54,2,0,189,12,0,0,0,0,0,0,
+224,54,2,0,240,54,2,0,190,12,0,0,0,0,0,0,251,54,2,0,
+6,55,2,0,191,12,0,0,0,0,0,0,18,55,2,0,28,55,2,0,
+192,12,0,0,0,0,0,0,41,55,2,0,50,55,2,0,193,12,0,0,
+0,0,0,0,63,55,2,0,76,55,2,0,194,12,0,0,0,0,0,0,
+89,55,2,0,103,55,2,0,195,12,0,0,0,0,0,0,115,55,2,0,
+127,55,2,0,196,12,0,0,0,0,0,0,138,55,2,0,147,55,2,0,
+197,12,0,0,0,0,0,0,158,55,2,0,172,55,2,0,198,12,0,0,
+0,0,0,0,183,55,2,0,197,55,2,0,199,12,0,0,0,0,0,0,
+209,55,2,0,222,55,2,0,200,12,0,0,0,0,0,0,234,55,2,0,
+247,55,2,0,201,12,0,0,0,0,0,0,4,56,2,0,18,56,2,0,
+202,12,0,0,0,0,0,0,31,56,2,0,43,56,2,0,203,12,0,0,
+0,0,0,0,54,56,2,0,74,56,2,0,204,12,0,0,0,0,0,0,
+85,56,2,0,101,56,2,0,205,12,0,0,0,0,0,0,114,56,2,0,
+122,56,2,0,206,12,0,0,0,0,0,0,135,56,2,0,148,56,2,0,
+207,12,0,0,0,0,0,0,161,56,2,0,175,56,2,0,208,12,0,0,
+0,0,0,0,188,56,2,0,202,56,2,0,209,12,0,0,0,0,0,0,
+214,56,2,0,228,56,2,0,210,12,0,0,0,0,0,0,239,56,2,0,
+254,56,2,0,211,12,0,0,0,0,0,0,8,57,2,0,20,57,2,0,
+212,12,0,0,0,0,0,0,31,57,2,0,42,57,2,0,213,12,0,0,
+0,0,0,0,53,57,2,0,67,57,2,0,214,12,0,0,0,0,0,0,
+78,57,2,0,89,57,2,0,215,12,0,0,0,0,0,0,101,57,2,0,
+118,57,2,0,216,12,0,0,0,0,0,0,131,57,2,0,146,57,2,0,
+217,12,0,0,0,0,0,0,158,57,2,0,170,57,2,0,218,12,0,0,
+0,0,0,0,181,57,2,0,196,57,2,0,219,12,0,0,0,0,0,0,
+209,57,2,0,221,57,2,0,220,12,0,0,0,0,0,0,231,57,2,0,
+249,57,2,0,221,12,0,0,0,0,0,0,6,58,2,0,21,58,2,0,
+222,12,0,0,0,0,0,0,33,58,2,0,49,58,2,0,223,12,0,0,
+0,0,0,0,61,58,2,0,74,58,2,0,224,12,0,0,0,0,0,0,
+87,58,2,0,98,58,2,0,225,12,0,0,0,0,0,0,110,58,2,0,
+126,58,2,0,226,12,0,0,0,0,0,0,137,58,2,0,155,58,2,0,
+227,12,0,0,0,0,0,0,166,58,2,0,180,58,2,0,228,12,0,0,
+0,0,0,0,191,58,2,0,204,58,2,0,229,12,0,0,0,0,0,0,
+217,58,2,0,234,58,2,0,230,12,0,0,0,0,0,0,245,58,2,0,
+1,59,2,0,231,12,0,0,0,0,0,0,12,59,2,0,28,59,2,0,
+232,12,0,0,0,0,0,0,40,59,2,0,57,59,2,0,233,12,0,0,
+0,0,0,0,68,59,2,0,77,59,2,0,234,12,0,0,0,0,0,0,
+88,59,2,0,101,59,2,0,235,12,0,0,0,0,0,0,107,59,2,0,
+115,59,2,0,236,12,0,0,0,0,0,0,126,59,2,0,145,59,2,0,
+237,12,0,0,0,0,0,0,156,59,2,0,172,59,2,0,238,12,0,0,
+0,0,0,0,184,59,2,0,198,59,2,0,239,12,0,0,0,0,0,0,
+210,59,2,0,222,59,2,0,240,12,0,0,0,0,0,0,233,59,2,0,
+249,59,2,0,241,12,0,0,0,0,0,0,6,60,2,0,16,60,2,0,
+242,12,0,0,0,0,0,0,27,60,2,0,38,60,2,0,243,12,0,0,
+0,0,0,0,49,60,2,0,61,60,2,0,244,12,0,0,0,0,0,0,
+73,60,2,0,85,60,2,0,245,12,0,0,0,0,0,0,97,60,2,0,
+109,60,2,0,246,12,0,0,0,0,0,0,122,60,2,0,139,60,2,0,
+247,12,0,0,0,0,0,0,150,60,2,0,171,60,2,0,248,12,0,0,
+0,0,0,0,182,60,2,0,198,60,2,0,249,12,0,0,0,0,0,0,
+210,60,2,0,221,60,2,0,250,12,0,0,0,0,0,0,232,60,2,0,
+245,60,2,0,251,12,0,0,0,0,0,0,0,61,2,0,16,61,2,0,
+252,12,0,0,0,0,0,0,27,61,2,0,44,61,2,0,253,12,0,0,
+0,0,0,0,55,61,2,0,72,61,2,0,254,12,0,0,0,0,0,0,
+85,61,2,0,101,61,2,0,255,12,0,0,0,0,0,0,114,61,2,0,
+129,61,2,0,0,13,0,0,0,0,0,0,140,61,2,0,153,61,2,0,
+1,13,0,0,0,0,0,0,167,61,2,0,183,61,2,0,2,13,0,0,
+0,0,0,0,194,61,2,0,205,61,2,0,3,13,0,0,0,0,0,0,
+217,61,2,0,237,61,2,0,4,13,0,0,0,0,0,0,248,61,2,0,
+5,62,2,0,5,13,0,0,0,0,0,0,17,62,2,0,34,62,2,0,
+6,13,0,0,0,0,0,0,44,62,2,0,57,62,2,0,7,13,0,0,
+0,0,0,0,68,62,2,0,81,62,2,0,8,13,0,0,0,0,0,0,
+91,62,2,0,105,62,2,0,9,13,0,0,0,0,0,0,116,62,2,0,
+140,62,2,0,10,13,0,0,0,0,0,0,151,62,2,0,165,62,2,0,
+11,13,0,0,0,0,0,0,177,62,2,0,194,62,2,0,12,13,0,0,
+0,0,0,0,207,62,2,0,222,62,2,0,13,13,0,0,0,0,0,0,
+233,62,2,0,248,62,2,0,14,13,0,0,0,0,0,0,5,63,2,0,
+24,63,2,0,15,13,0,0,0,0,0,0,30,63,2,0,42,63,2,0,
+16,13,0,0,0,0,0,0,54,63,2,0,68,63,2,0,17,13,0,0,
+0,0,0,0,81,63,2,0,98,63,2,0,18,13,0,0,0,0,0,0,
+108,63,2,0,120,63,2,0,19,13,0,0,0,0,0,0,132,63,2,0,
+144,63,2,0,20,13,0,0,0,0,0,0,156,63,2,0,166,63,2,0,
+21,13,0,0,0,0,0,0,177,63,2,0,189,63,2,0,22,13,0,0,
+0,0,0,0,200,63,2,0,210,63,2,0,23,13,0,0,0,0,0,0,
+221,63,2,0,241,63,2,0,24,13,0,0,0,0,0,0,252,63,2,0,
+11,64,2,0,25,13,0,0,0,0,0,0,21,64,2,0,35,64,2,0,
+26,13,0,0,0,0,0,0,46,64,2,0,56,64,2,0,27,13,0,0,
+0,0,0,0,69,64,2,0,85,64,2,0,28,13,0,0,0,0,0,0,
+96,64,2,0,109,64,2,0,29,13,0,0,0,0,0,0,122,64,2,0,
+137,64,2,0,30,13,0,0,0,0,0,0,150,64,2,0,154,64,2,0,
+34,13,0,0,0,0,0,0,179,64,2,0,183,64,2,0,35,13,0,0,
+0,0,0,0,202,64,2,0,206,64,2,0,36,13,0,0,0,0,0,0,
+217,64,2,0,221,64,2,0,37,13,0,0,0,0,0,0,233,64,2,0,
+237,64,2,0,38,13,0,0,0,0,0,0,8,65,2,0,12,65,2,0,
+39,13,0,0,0,0,0,0,25,65,2,0,29,65,2,0,40,13,0,0,
+0,0,0,0,43,65,2,0,47,65,2,0,41,13,0,0,0,0,0,0,
+63,65,2,0,67,65,2,0,42,13,0,0,0,0,0,0,81,65,2,0,
+85,65,2,0,43,13,0,0,0,0,0,0,104,65,2,0,108,65,2,0,
+44,13,0,0,0,0,0,0,120,65,2,0,124,65,2,0,45,13,0,0,
+0,0,0,0,139,65,2,0,143,65,2,0,46,13,0,0,0,0,0,0,
+158,65,2,0,162,65,2,0,47,13,0,0,0,0,0,0,174,65,2,0,
+178,65,2,0,48,13,0,0,0,0,0,0,191,65,2,0,195,65,2,0,
+49,13,0,0,0,0,0,0,208,65,2,0,212,65,2,0,50,13,0,0,
+0,0,0,0,226,65,2,0,230,65,2,0,51,13,0,0,0,0,0,0,
+243,65,2,0,247,65,2,0,52,13,0,0,0,0,0,0,8,66,2,0,
+12,66,2,0,53,13,0,0,0,0,0,0,23,66,2,0,27,66,2,0,
+54,13,0,0,0,0,0,0,41,66,2,0,45,66,2,0,55,13,0,0,
+0,0,0,0,60,66,2,0,64,66,2,0,56,13,0,0,0,0,0,0,
+77,66,2,0,81,66,2,0,57,13,0,0,0,0,0,0,94,66,2,0,
+98,66,2,0,58,13,0,0,0,0,0,0,111,66,2,0,115,66,2,0,
+59,13,0,0,0,0,0,0,128,66,2,0,132,66,2,0,60,13,0,0,
+0,0,0,0,143,66,2,0,147,66,2,0,61,13,0,0,0,0,0,0,
+164,66,2,0,168,66,2,0,62,13,0,0,0,0,0,0,178,66,2,0,
+182,66,2,0,63,13,0,0,0,0,0,0,192,66,2,0,196,66,2,0,
+64,13,0,0,0,0,0,0,209,66,2,0,213,66,2,0,65,13,0,0,
+0,0,0,0,228,66,2,0,232,66,2,0,66,13,0,0,0,0,0,0,
+241,66,2,0,245,66,2,0,67,13,0,0,0,0,0,0,5,67,2,0,
+9,67,2,0,68,13,0,0,0,0,0,0,21,67,2,0,25,67,2,0,
+69,13,0,0,0,0,0,0,39,67,2,0,43,67,2,0,70,13,0,0,
+0,0,0,0,57,67,2,0,61,67,2,0,71,13,0,0,0,0,0,0,
+83,67,2,0,87,67,2,0,72,13,0,0,0,0,0,0,100,67,2,0,
+104,67,2,0,73,13,0,0,0,0,0,0,117,67,2,0,121,67,2,0,
+74,13,0,0,0,0,0,0,132,67,2,0,136,67,2,0,75,13,0,0,
+0,0,0,0,149,67,2,0,153,67,2,0,76,13,0,0,0,0,0,0,
+166,67,2,0,170,67,2,0,77,13,0,0,0,0,0,0,175,67,2,0,
+179,67,2,0,78,13,0,0,0,0,0,0,190,67,2,0,194,67,2,0,
+79,13,0,0,0,0,0,0,215,67,2,0,219,67,2,0,80,13,0,0,
+0,0,0,0,237,67,2,0,241,67,2,0,81,13,0,0,0,0,0,0,
+253,67,2,0,1,68,2,0,82,13,0,0,0,0,0,0,11,68,2,0,
+15,68,2,0,83,13,0,0,0,0,0,0,30,68,2,0,34,68,2,0,
+84,13,0,0,0,0,0,0,47,68,2,0,51,68,2,0,85,13,0,0,
+0,0,0,0,63,68,2,0,67,68,2,0,86,13,0,0,0,0,0,0,
+84,68,2,0,88,68,2,0,87,13,0,0,0,0,0,0,101,68,2,0,
+105,68,2,0,88,13,0,0,0,0,0,0,120,68,2,0,124,68,2,0,
+89,13,0,0,0,0,0,0,140,68,2,0,144,68,2,0,90,13,0,0,
+0,0,0,0,156,68,2,0,160,68,2,0,91,13,0,0,0,0,0,0,
+173,68,2,0,177,68,2,0,92,13,0,0,0,0,0,0,191,68,2,0,
+195,68,2,0,93,13,0,0,0,0,0,0,211,68,2,0,215,68,2,0,
+94,13,0,0,0,0,0,0,231,68,2,0,235,68,2,0,95,13,0,0,
+0,0,0,0,246,68,2,0,250,68,2,0,96,13,0,0,0,0,0,0,
+4,69,2,0,8,69,2,0,97,13,0,0,0,0,0,0,17,69,2,0,
+21,69,2,0,98,13,0,0,0,0,0,0,34,69,2,0,38,69,2,0,
+99,13,0,0,0,0,0,0,52,69,2,0,56,69,2,0,100,13,0,0,
+0,0,0,0,68,69,2,0,72,69,2,0,101,13,0,0,0,0,0,0,
+81,69,2,0,85,69,2,0,102,13,0,0,0,0,0,0,99,69,2,0,
+103,69,2,0,103,13,0,0,0,0,0,0,117,69,2,0,121,69,2,0,
+104,13,0,0,0,0,0,0,134,69,2,0,138,69,2,0,105,13,0,0,
+0,0,0,0,151,69,2,0,155,69,2,0,106,13,0,0,0,0,0,0,
+169,69,2,0,173,69,2,0,107,13,0,0,0,0,0,0,185,69,2,0,
+189,69,2,0,108,13,0,0,0,0,0,0,209,69,2,0,213,69,2,0,
+109,13,0,0,0,0,0,0,229,69,2,0,233,69,2,0,110,13,0,0,
+0,0,0,0,241,69,2,0,245,69,2,0,111,13,0,0,0,0,0,0,
+2,70,2,0,6,70,2,0,112,13,0,0,0,0,0,0,20,70,2,0,
+24,70,2,0,113,13,0,0,0,0,0,0,38,70,2,0,42,70,2,0,
+114,13,0,0,0,0,0,0,56,70,2,0,60,70,2,0,115,13,0,0,
+0,0,0,0,75,70,2,0,79,70,2,0,116,13,0,0,0,0,0,0,
+91,70,2,0,95,70,2,0,117,13,0,0,0,0,0,0,106,70,2,0,
+110,70,2,0,118,13,0,0,0,0,0,0,124,70,2,0,128,70,2,0,
+119,13,0,0,0,0,0,0,139,70,2,0,143,70,2,0,120,13,0,0,
+0,0,0,0,160,70,2,0,164,70,2,0,121,13,0,0,0,0,0,0,
+179,70,2,0,183,70,2,0,122,13,0,0,0,0,0,0,195,70,2,0,
+199,70,2,0,123,13,0,0,0,0,0,0,214,70,2,0,218,70,2,0,
+124,13,0,0,0,0,0,0,230,70,2,0,234,70,2,0,125,13,0,0,
+0,0,0,0,252,70,2,0,0,71,2,0,126,13,0,0,0,0,0,0,
+15,71,2,0,19,71,2,0,127,13,0,0,0,0,0,0,35,71,2,0,
+39,71,2,0,128,13,0,0,0,0,0,0,52,71,2,0,56,71,2,0,
+129,13,0,0,0,0,0,0,67,71,2,0,71,71,2,0,130,13,0,0,
+0,0,0,0,87,71,2,0,91,71,2,0,131,13,0,0,0,0,0,0,
+109,71,2,0,113,71,2,0,132,13,0,0,0,0,0,0,127,71,2,0,
+131,71,2,0,133,13,0,0,0,0,0,0,144,71,2,0,148,71,2,0,
+134,13,0,0,0,0,0,0,165,71,2,0,169,71,2,0,135,13,0,0,
+0,0,0,0,181,71,2,0,185,71,2,0,136,13,0,0,0,0,0,0,
+201,71,2,0,205,71,2,0,137,13,0,0,0,0,0,0,222,71,2,0,
+226,71,2,0,138,13,0,0,0,0,0,0,235,71,2,0,239,71,2,0,
+139,13,0,0,0,0,0,0,252,71,2,0,0,72,2,0,140,13,0,0,
+0,0,0,0,8,72,2,0,12,72,2,0,141,13,0,0,0,0,0,0,
+31,72,2,0,35,72,2,0,142,13,0,0,0,0,0,0,51,72,2,0,
+55,72,2,0,143,13,0,0,0,0,0,0,69,72,2,0,73,72,2,0,
+144,13,0,0,0,0,0,0,85,72,2,0,89,72,2,0,145,13,0,0,
+0,0,0,0,105,72,2,0,109,72,2,0,146,13,0,0,0,0,0,0,
+119,72,2,0,123,72,2,0,147,13,0,0,0,0,0,0,134,72,2,0,
+138,72,2,0,148,13,0,0,0,0,0,0,150,72,2,0,154,72,2,0,
+149,13,0,0,0,0,0,0,166,72,2,0,170,72,2,0,150,13,0,0,
+0,0,0,0,182,72,2,0,186,72,2,0,151,13,0,0,0,0,0,0,
+203,72,2,0,207,72,2,0,152,13,0,0,0,0,0,0,228,72,2,0,
+232,72,2,0,153,13,0,0,0,0,0,0,248,72,2,0,252,72,2,0,
+154,13,0,0,0,0,0,0,7,73,2,0,11,73,2,0,155,13,0,0,
+0,0,0,0,24,73,2,0,28,73,2,0,156,13,0,0,0,0,0,0,
+44,73,2,0,48,73,2,0,157,13,0,0,0,0,0,0,65,73,2,0,
+69,73,2,0,158,13,0,0,0,0,0,0,86,73,2,0,90,73,2,0,
+159,13,0,0,0,0,0,0,106,73,2,0,110,73,2,0,160,13,0,0,
+0,0,0,0,125,73,2,0,129,73,2,0,161,13,0,0,0,0,0,0,
+142,73,2,0,146,73,2,0,162,13,0,0,0,0,0,0,162,73,2,0,
+166,73,2,0,163,13,0,0,0,0,0,0,177,73,2,0,181,73,2,0,
+164,13,0,0,0,0,0,0,201,73,2,0,205,73,2,0,165,13,0,0,
+0,0,0,0,218,73,2,0,222,73,2,0,166,13,0,0,0,0,0,0,
+239,73,2,0,243,73,2,0,167,13,0,0,0,0,0,0,0,74,2,0,
+4,74,2,0,168,13,0,0,0,0,0,0,17,74,2,0,21,74,2,0,
+169,13,0,0,0,0,0,0,35,74,2,0,39,74,2,0,170,13,0,0,
+0,0,0,0,63,74,2,0,67,74,2,0,171,13,0,0,0,0,0,0,
+81,74,2,0,85,74,2,0,172,13,0,0,0,0,0,0,102,74,2,0,
+106,74,2,0,173,13,0,0,0,0,0,0,121,74,2,0,125,74,2,0,
+174,13,0,0,0,0,0,0,140,74,2,0,144,74,2,0,175,13,0,0,
+0,0,0,0,163,74,2,0,167,74,2,0,176,13,0,0,0,0,0,0,
+179,74,2,0,183,74,2,0,177,13,0,0,0,0,0,0,197,74,2,0,
+201,74,2,0,178,13,0,0,0,0,0,0,218,74,2,0,222,74,2,0,
+179,13,0,0,0,0,0,0,234,74,2,0,238,74,2,0,180,13,0,0,
+0,0,0,0,250,74,2,0,254,74,2,0,181,13,0,0,0,0,0,0,
+8,75,2,0,12,75,2,0,182,13,0,0,0,0,0,0,24,75,2,0,
+28,75,2,0,183,13,0,0,0,0,0,0,38,75,2,0,42,75,2,0,
+184,13,0,0,0,0,0,0,62,75,2,0,66,75,2,0,185,13,0,0,
+0,0,0,0,81,75,2,0,85,75,2,0,186,13,0,0,0,0,0,0,
+99,75,2,0,103,75,2,0,187,13,0,0,0,0,0,0,113,75,2,0,
+117,75,2,0,188,13,0,0,0,0,0,0,133,75,2,0,137,75,2,0,
+189,13,0,0,0,0,0,0,150,75,2,0,154,75,2,0,190,13,0,0,
+0,0,0,0,169,75,2,0,181,75,2,0,194,13,0,0,0,0,0,0,
+205,75,2,0,215,75,2,0,195,13,0,0,0,0,0,0,237,75,2,0,
+252,75,2,0,196,13,0,0,0,0,0,0,23,76,2,0,37,76,2,0,
+197,13,0,0,0,0,0,0,63,76,2,0,67,76,2,0,200,13,0,0,
+0,0,0,0,71,76,2,0,75,76,2,0,202,13,0,0,0,0,0,0,
+86,76,2,0,100,76,2,0,210,13,0,0,0,0,0,0,123,76,2,0,
+137,76,2,0,211,13,0,0,0,0,0,0,159,76,2,0,170,76,2,0,
+212,13,0,0,0,0,0,0,184,76,2,0,194,76,2,0,213,13,0,0,
+0,0,0,0,215,76,2,0,229,76,2,0,218,13,0,0,0,0,0,0,
+239,76,2,0,254,76,2,0,219,13,0,0,0,0,0,0,6,77,2,0,
+19,77,2,0,220,13,0,0,0,0,0,0,44,77,2,0,60,77,2,0,
+221,13,0,0,0,0,0,0,85,77,2,0,104,77,2,0,222,13,0,0,
+0,0,0,0,129,77,2,0,142,77,2,0,223,13,0,0,0,0,0,0,
+152,77,2,0,157,77,2,0,227,13,0,0,0,0,0,0,170,77,2,0,
+176,77,2,0,228,13,0,0,0,0,0,0,183,77,2,0,190,77,2,0,
+229,13,0,0,0,0,0,0,198,77,2,0,205,77,2,0,230,13,0,0,
+0,0,0,0,214,77,2,0,222,77,2,0,231,13,0,0,0,0,0,0,
+232,77,2,0,236,77,2,0,232,13,0,0,0,0,0,0,245,77,2,0,
+254,77,2,0,234,13,0,0,0,0,0,0,16,78,2,0,25,78,2,0,
+235,13,0,0,0,0,0,0,39,78,2,0,48,78,2,0,236,13,0,0,
+0,0,0,0,61,78,2,0,68,78,2,0,237,13,0,0,0,0,0,0,
+80,78,2,0,86,78,2,0,238,13,0,0,0,0,0,0,97,78,2,0,
+104,78,2,0,239,13,0,0,0,0,0,0,115,78,2,0,121,78,2,0,
+240,13,0,0,0,0,0,0,132,78,2,0,139,78,2,0,241,13,0,0,
+0,0,0,0,150,78,2,0,158,78,2,0,242,13,0,0,0,0,0,0,
+176,78,2,0,182,78,2,0,243,13,0,0,0,0,0,0,190,78,2,0,
+199,78,2,0,244,13,0,0,0,0,0,0,207,78,2,0,216,78,2,0,
+245,13,0,0,0,0,0,0,225,78,2,0,234,78,2,0,246,13,0,0,
+0,0,0,0,246,78,2,0,254,78,2,0,247,13,0,0,0,0,0,0,
+7,79,2,0,16,79,2,0,248,13,0,0,0,0,0,0,25,79,2,0,
+37,79,2,0,249,13,0,0,0,0,0,0,48,79,2,0,60,79,2,0,
+250,13,0,0,0,0,0,0,72,79,2,0,83,79,2,0,251,13,0,0,
+0,0,0,0,94,79,2,0,105,79,2,0,252,13,0,0,0,0,0,0,
+116,79,2,0,130,79,2,0,253,13,0,0,0,0,0,0,141,79,2,0,
+155,79,2,0,254,13,0,0,0,0,0,0,166,79,2,0,179,79,2,0,
+255,13,0,0,0,0,0,0,192,79,2,0,204,79,2,0,0,14,0,0,
+0,0,0,0,217,79,2,0,228,79,2,0,1,14,0,0,0,0,0,0,
+240,79,2,0,247,79,2,0,2,14,0,0,0,0,0,0,7,80,2,0,
+13,80,2,0,6,14,0,0,0,0,0,0,28,80,2,0,34,80,2,0,
+7,14,0,0,0,0,0,0,49,80,2,0,54,80,2,0,13,14,0,0,
+0,0,0,0,65,80,2,0,74,80,2,0,14,14,0,0,0,0,0,0,
+83,80,2,0,92,80,2,0,15,14,0,0,0,0,0,0,101,80,2,0,
+110,80,2,0,16,14,0,0,0,0,0,0,119,80,2,0,129,80,2,0,
+17,14,0,0,0,0,0,0,138,80,2,0,148,80,2,0,19,14,0,0,
+0,0,0,0,158,80,2,0,168,80,2,0,20,14,0,0,0,0,0,0,
+178,80,2,0,182,80,2,0,21,14,0,0,0,0,0,0,192,80,2,0,
+198,80,2,0,22,14,0,0,0,0,0,0,207,80,2,0,212,80,2,0,
+23,14,0,0,0,0,0,0,232,80,2,0,238,80,2,0,28,14,0,0,
+0,0,0,0,242,80,2,0,253,80,2,0,29,14,0,0,0,0,0,0,
+2,81,2,0,11,81,2,0,30,14,0,0,0,0,0,0,34,81,2,0,
+39,81,2,0,44,14,0,0,0,0,0,0,58,81,2,0,68,81,2,0,
+45,14,0,0,0,0,0,0,88,81,2,0,98,81,2,0,47,14,0,0,
+0,0,0,0,117,81,2,0,128,81,2,0,54,14,0,0,0,0,0,0,
+142,81,2,0,148,81,2,0,58,14,0,0,0,0,0,0,154,81,2,0,
+160,81,2,0,59,14,0,0,0,0,0,0,167,81,2,0,171,81,2,0,
+63,14,0,0,0,0,0,0,178,81,2,0,182,81,2,0,64,14,0,0,
+0,0,0,0,190,81,2,0,194,81,2,0,65,14,0,0,0,0,0,0,
+206,81,2,0,210,81,2,0,66,14,0,0,0,0,0,0,217,81,2,0,
+221,81,2,0,67,14,0,0,0,0,0,0,231,81,2,0,235,81,2,0,
+68,14,0,0,0,0,0,0,244,81,2,0,248,81,2,0,69,14,0,0,
+0,0,0,0,2,82,2,0,6,82,2,0,70,14,0,0,0,0,0,0,
+13,82,2,0,17,82,2,0,74,14,0,0,0,0,0,0,33,82,2,0,
+46,82,2,0,86,14,0,0,0,0,0,0,59,82,2,0,72,82,2,0,
+87,14,0,0,0,0,0,0,85,82,2,0,98,82,2,0,88,14,0,0,
+0,0,0,0,111,82,2,0,124,82,2,0,89,14,0,0,0,0,0,0,
+137,82,2,0,150,82,2,0,90,14,0,0,0,0,0,0,163,82,2,0,
+176,82,2,0,91,14,0,0,0,0,0,0,189,82,2,0,202,82,2,0,
+92,14,0,0,0,0,0,0,215,82,2,0,228,82,2,0,93,14,0,0,
+0,0,0,0,241,82,2,0,254,82,2,0,94,14,0,0,0,0,0,0,
+11,83,2,0,24,83,2,0,95,14,0,0,0,0,0,0,37,83,2,0,
+50,83,2,0,96,14,0,0,0,0,0,0,63,83,2,0,76,83,2,0,
+97,14,0,0,0,0,0,0,89,83,2,0,102,83,2,0,98,14,0,0,
+0,0,0,0,120,83,2,0,133,83,2,0,99,14,0,0,0,0,0,0,
+147,83,2,0,156,83,2,0,103,14,0,0,0,0,0,0,170,83,2,0,
+179,83,2,0,114,14,0,0,0,0,0,0,199,83,2,0,204,83,2,0,
+116,14,0,0,0,0,0,0,215,83,2,0,220,83,2,0,117,14,0,0,
+0,0,0,0,231,83,2,0,236,83,2,0,118,14,0,0,0,0,0,0,
+250,83,2,0,255,83,2,0,119,14,0,0,0,0,0,0,12,84,2,0,
+17,84,2,0,120,14,0,0,0,0,0,0,31,84,2,0,36,84,2,0,
+121,14,0,0,0,0,0,0,51,84,2,0,57,84,2,0,122,14,0,0,
+0,0,0,0,77,84,2,0,81,84,2,0,139,14,0,0,0,0,0,0,
+86,84,2,0,91,84,2,0,140,14,0,0,0,0,0,0,96,84,2,0,
+102,84,2,0,141,14,0,0,0,0,0,0,107,84,2,0,114,84,2,0,
+142,14,0,0,0,0,0,0,119,84,2,0,127,84,2,0,143,14,0,0,
+0,0,0,0,132,84,2,0,141,84,2,0,144,14,0,0,0,0,0,0,
+146,84,2,0,158,84,2,0,2,16,0,0,0,0,0,0,169,84,2,0,
+179,84,2,0,3,16,0,0,0,0,0,0,191,84,2,0,197,84,2,0,
+4,16,0,0,0,0,0,0,209,84,2,0,220,84,2,0,5,16,0,0,
+0,0,0,0,230,84,2,0,235,84,2,0,6,16,0,0,0,0,0,0,
+246,84,2,0,255,84,2,0,7,16,0,0,0,0,0,0,10,85,2,0,
+20,85,2,0,8,16,0,0,0,0,0,0,30,85,2,0,35,85,2,0,
+9,16,0,0,0,0,0,0,45,85,2,0,53,85,2,0,10,16,0,0,
+0,0,0,0,63,85,2,0,71,85,2,0,11,16,0,0,0,0,0,0,
+81,85,2,0,88,85,2,0,12,16,0,0,0,0,0,0,96,85,2,0,
+101,85,2,0,13,16,0,0,0,0,0,0,109,85,2,0,118,85,2,0,
+14,16,0,0,0,0,0,0,127,85,2,0,132,85,2,0,15,16,0,0,
+0,0,0,0,141,85,2,0,150,85,2,0,16,16,0,0,0,0,0,0,
+159,85,2,0,170,85,2,0,17,16,0,0,0,0,0,0,179,85,2,0,
+186,85,2,0,18,16,0,0,0,0,0,0,197,85,2,0,206,85,2,0,
+19,16,0,0,0,0,0,0,217,85,2,0,227,85,2,0,20,16,0,0,
+0,0,0,0,236,85,2,0,243,85,2,0,21,16,0,0,0,0,0,0,
+253,85,2,0,3,86,2,0,22,16,0,0,0,0,0,0,13,86,2,0,
+37,86,2,0,29,16,0,0,0,0,0,0,46,86,2,0,59,86,2,0,
+30,16,0,0,0,0,0,0,69,86,2,0,84,86,2,0,32,16,0,0,
+0,0,0,0,94,86,2,0,104,86,2,0,33,16,0,0,0,0,0,0,
+114,86,2,0,126,86,2,0,34,16,0,0,0,0,0,0,138,86,2,0,
+150,86,2,0,35,16,0,0,0,0,0,0,160,86,2,0,174,86,2,0,
+37,16,0,0,0,0,0,0,184,86,2,0,200,86,2,0,38,16,0,0,
+0,0,0,0,210,86,2,0,226,86,2,0,39,16,0,0,0,0,0,0,
+237,86,2,0,255,86,2,0,42,16,0,0,0,0,0,0,8,87,2,0,
+26,87,2,0,43,16,0,0,0,0,0,0,36,87,2,0,44,87,2,0,
+44,16,0,0,0,0,0,0,54,87,2,0,64,87,2,0,72,16,0,0,
+0,0,0,0,73,87,2,0,83,87,2,0,73,16,0,0,0,0,0,0,
+92,87,2,0,102,87,2,0,74,16,0,0,0,0,0,0,111,87,2,0,
+121,87,2,0,75,16,0,0,0,0,0,0,130,87,2,0,140,87,2,0,
+76,16,0,0,0,0,0,0,149,87,2,0,159,87,2,0,77,16,0,0,
+0,0,0,0,168,87,2,0,178,87,2,0,78,16,0,0,0,0,0,0,
+187,87,2,0,197,87,2,0,79,16,0,0,0,0,0,0,206,87,2,0,
+216,87,2,0,80,16,0,0,0,0,0,0,225,87,2,0,235,87,2,0,
+81,16,0,0,0,0,0,0,244,87,2,0,254,87,2,0,82,16,0,0,
+0,0,0,0,7,88,2,0,17,88,2,0,83,16,0,0,0,0,0,0,
+26,88,2,0,36,88,2,0,84,16,0,0,0,0,0,0,45,88,2,0,
+55,88,2,0,85,16,0,0,0,0,0,0,64,88,2,0,74,88,2,0,
+86,16,0,0,0,0,0,0,83,88,2,0,93,88,2,0,87,16,0,0,
+0,0,0,0,102,88,2,0,112,88,2,0,88,16,0,0,0,0,0,0,
+121,88,2,0,131,88,2,0,89,16,0,0,0,0,0,0,140,88,2,0,
+150,88,2,0,90,16,0,0,0,0,0,0,159,88,2,0,169,88,2,0,
+91,16,0,0,0,0,0,0,178,88,2,0,188,88,2,0,92,16,0,0,
+0,0,0,0,197,88,2,0,207,88,2,0,93,16,0,0,0,0,0,0,
+216,88,2,0,226,88,2,0,94,16,0,0,0,0,0,0,235,88,2,0,
+245,88,2,0,95,16,0,0,0,0,0,0,254,88,2,0,8,89,2,0,
+96,16,0,0,0,0,0,0,17,89,2,0,27,89,2,0,97,16,0,0,
+0,0,0,0,36,89,2,0,40,89,2,0,113,16,0,0,0,0,0,0,
+48,89,2,0,52,89,2,0,114,16,0,0,0,0,0,0,61,89,2,0,
+65,89,2,0,115,16,0,0,0,0,0,0,71,89,2,0,74,89,2,0,
+116,16,0,0,0,0,0,0,86,89,2,0,90,89,2,0,117,16,0,0,
+0,0,0,0,97,89,2,0,101,89,2,0,118,16,0,0,0,0,0,0,
+106,89,2,0,110,89,2,0,119,16,0,0,0,0,0,0,118,89,2,0,
+122,89,2,0,120,16,0,0,0,0,0,0,130,89,2,0,133,89,2,0,
+121,16,0,0,0,0,0,0,138,89,2,0,142,89,2,0,122,16,0,0,
+0,0,0,0,147,89,2,0,151,89,2,0,123,16,0,0,0,0,0,0,
+164,89,2,0,168,89,2,0,124,16,0,0,0,0,0,0,181,89,2,0,
+185,89,2,0,125,16,0,0,0,0,0,0,201,89,2,0,205,89,2,0,
+126,16,0,0,0,0,0,0,215,89,2,0,219,89,2,0,127,16,0,0,
+0,0,0,0,228,89,2,0,232,89,2,0,128,16,0,0,0,0,0,0,
+242,89,2,0,245,89,2,0,129,16,0,0,0,0,0,0,254,89,2,0,
+2,90,2,0,130,16,0,0,0,0,0,0,11,90,2,0,14,90,2,0,
+131,16,0,0,0,0,0,0,21,90,2,0,25,90,2,0,132,16,0,0,
+0,0,0,0,33,90,2,0,37,90,2,0,133,16,0,0,0,0,0,0,
+47,90,2,0,50,90,2,0,139,16,0,0,0,0,0,0,53,90,2,0,
+56,90,2,0,140,16,0,0,0,0,0,0,59,90,2,0,62,90,2,0,
+141,16,0,0,0,0,0,0,65,90,2,0,68,90,2,0,142,16,0,0,
+0,0,0,0,71,90,2,0,74,90,2,0,143,16,0,0,0,0,0,0,
+77,90,2,0,80,90,2,0,144,16,0,0,0,0,0,0,84,90,2,0,
+87,90,2,0,145,16,0,0,0,0,0,0,90,90,2,0,93,90,2,0,
+146,16,0,0,0,0,0,0,99,90,2,0,102,90,2,0,147,16,0,0,
+0,0,0,0,104,90,2,0,107,90,2,0,148,16,0,0,0,0,0,0,
+110,90,2,0,113,90,2,0,149,16,0,0,0,0,0,0,122,90,2,0,
+126,90,2,0,150,16,0,0,0,0,0,0,143,90,2,0,152,90,2,0,
+151,16,0,0,0,0,0,0,168,90,2,0,174,90,2,0,155,16,0,0,
+0,0,0,0,187,90,2,0,191,90,2,0,156,16,0,0,0,0,0,0,
+195,90,2,0,199,90,2,0,157,16,0,0,0,0,0,0,203,90,2,0,
+208,90,2,0,158,16,0,0,0,0,0,0,210,90,2,0,220,90,2,0,
+164,16,0,0,0,0,0,0,223,90,2,0,226,90,2,0,165,16,0,0,
+0,0,0,0,236,90,2,0,242,90,2,0,166,16,0,0,0,0,0,0,
+252,90,2,0,255,90,2,0,167,16,0,0,0,0,0,0,5,91,2,0,
+16,91,2,0,169,16,0,0,0,0,0,0,23,91,2,0,38,91,2,0,
+171,16,0,0,0,0,0,0,43,91,2,0,48,91,2,0,172,16,0,0,
+0,0,0,0,53,91,2,0,56,91,2,0,173,16,0,0,0,0,0,0,
+61,91,2,0,65,91,2,0,174,16,0,0,0,0,0,0,73,91,2,0,
+77,91,2,0,175,16,0,0,0,0,0,0,86,91,2,0,94,91,2,0,
+181,16,0,0,0,0,0,0,99,91,2,0,102,91,2,0,182,16,0,0,
+0,0,0,0,110,91,2,0,114,91,2,0,183,16,0,0,0,0,0,0,
+122,91,2,0,131,91,2,0,208,16,0,0,0,0,0,0,146,91,2,0,
+154,91,2,0,211,16,0,0,0,0,0,0,163,91,2,0,175,91,2,0,
+212,16,0,0,0,0,0,0,188,91,2,0,193,91,2,0,217,16,0,0,
+0,0,0,0,205,91,2,0,211,91,2,0,218,16,0,0,0,0,0,0,
+225,91,2,0,234,91,2,0,232,16,0,0,0,0,0,0,243,91,2,0,
+252,91,2,0,233,16,0,0,0,0,0,0,6,92,2,0,16,92,2,0,
+234,16,0,0,0,0,0,0,25,92,2,0,34,92,2,0,235,16,0,0,
+0,0,0,0,42,92,2,0,48,92,2,0,236,16,0,0,0,0,0,0,
+55,92,2,0,63,92,2,0,237,16,0,0,0,0,0,0,72,92,2,0,
+81,92,2,0,238,16,0,0,0,0,0,0,90,92,2,0,97,92,2,0,
+239,16,0,0,0,0,0,0,105,92,2,0,115,92,2,0,240,16,0,0,
+0,0,0,0,124,92,2,0,134,92,2,0,241,16,0,0,0,0,0,0,
+143,92,2,0,151,92,2,0,242,16,0,0,0,0,0,0,161,92,2,0,
+167,92,2,0,243,16,0,0,0,0,0,0,174,92,2,0,182,92,2,0,
+244,16,0,0,0,0,0,0,189,92,2,0,197,92,2,0,245,16,0,0,
+0,0,0,0,205,92,2,0,213,92,2,0,246,16,0,0,0,0,0,0,
+220,92,2,0,232,92,2,0,247,16,0,0,0,0,0,0,241,92,2,0,
+248,92,2,0,248,16,0,0,0,0,0,0,255,92,2,0,6,93,2,0,
+249,16,0,0,0,0,0,0,14,93,2,0,21,93,2,0,250,16,0,0,
+0,0,0,0,31,93,2,0,40,93,2,0,251,16,0,0,0,0,0,0,
+48,93,2,0,57,93,2,0,252,16,0,0,0,0,0,0,65,93,2,0,
+72,93,2,0,253,16,0,0,0,0,0,0,81,93,2,0,88,93,2,0,
+254,16,0,0,0,0,0,0,95,93,2,0,102,93,2,0,255,16,0,0,
+0,0,0,0,111,93,2,0,122,93,2,0,0,17,0,0,0,0,0,0,
+129,93,2,0,141,93,2,0,1,17,0,0,0,0,0,0,149,93,2,0,
+156,93,2,0,2,17,0,0,0,0,0,0,163,93,2,0,172,93,2,0,
+3,17,0,0,0,0,0,0,180,93,2,0,188,93,2,0,4,17,0,0,
+0,0,0,0,197,93,2,0,206,93,2,0,5,17,0,0,0,0,0,0,
+217,93,2,0,226,93,2,0,6,17,0,0,0,0,0,0,235,93,2,0,
+246,93,2,0,7,17,0,0,0,0,0,0,253,93,2,0,5,94,2,0,
+8,17,0,0,0,0,0,0,12,94,2,0,22,94,2,0,9,17,0,0,
+0,0,0,0,28,94,2,0,33,94,2,0,10,17,0,0,0,0,0,0,
+43,94,2,0,51,94,2,0,11,17,0,0,0,0,0,0,58,94,2,0,
+65,94,2,0,12,17,0,0,0,0,0,0,74,94,2,0,82,94,2,0,
+13,17,0,0,0,0,0,0,92,94,2,0,101,94,2,0,14,17,0,0,
+0,0,0,0,109,94,2,0,116,94,2,0,15,17,0,0,0,0,0,0,
+124,94,2,0,131,94,2,0,16,17,0,0,0,0,0,0,141,94,2,0,
+149,94,2,0,17,17,0,0,0,0,0,0,157,94,2,0,162,94,2,0,
+18,17,0,0,0,0,0,0,169,94,2,0,177,94,2,0,19,17,0,0,
+0,0,0,0,183,94,2,0,193,94,2,0,20,17,0,0,0,0,0,0,
+202,94,2,0,213,94,2,0,21,17,0,0,0,0,0,0,220,94,2,0,
+225,94,2,0,22,17,0,0,0,0,0,0,231,94,2,0,239,94,2,0,
+23,17,0,0,0,0,0,0,245,94,2,0,254,94,2,0,24,17,0,0,
+0,0,0,0,6,95,2,0,16,95,2,0,25,17,0,0,0,0,0,0,
+24,95,2,0,34,95,2,0,26,17,0,0,0,0,0,0,43,95,2,0,
+55,95,2,0,27,17,0,0,0,0,0,0,62,95,2,0,70,95,2,0,
+28,17,0,0,0,0,0,0,77,95,2,0,88,95,2,0,29,17,0,0,
+0,0,0,0,94,95,2,0,104,95,2,0,30,17,0,0,0,0,0,0,
+111,95,2,0,116,95,2,0,31,17,0,0,0,0,0,0,124,95,2,0,
+134,95,2,0,32,17,0,0,0,0,0,0,143,95,2,0,150,95,2,0,
+33,17,0,0,0,0,0,0,158,95,2,0,166,95,2,0,34,17,0,0,
+0,0,0,0,175,95,2,0,184,95,2,0,35,17,0,0,0,0,0,0,
+193,95,2,0,202,95,2,0,36,17,0,0,0,0,0,0,211,95,2,0,
+218,95,2,0,37,17,0,0,0,0,0,0,225,95,2,0,232,95,2,0,
+38,17,0,0,0,0,0,0,240,95,2,0,250,95,2,0,39,17,0,0,
+0,0,0,0,1,96,2,0,12,96,2,0,40,17,0,0,0,0,0,0,
+22,96,2,0,31,96,2,0,41,17,0,0,0,0,0,0,38,96,2,0,
+48,96,2,0,42,17,0,0,0,0,0,0,57,96,2,0,66,96,2,0,
+43,17,0,0,0,0,0,0,75,96,2,0,85,96,2,0,44,17,0,0,
+0,0,0,0,93,96,2,0,106,96,2,0,45,17,0,0,0,0,0,0,
+116,96,2,0,127,96,2,0,46,17,0,0,0,0,0,0,136,96,2,0,
+149,96,2,0,47,17,0,0,0,0,0,0,159,96,2,0,166,96,2,0,
+48,17,0,0,0,0,0,0,175,96,2,0,181,96,2,0,49,17,0,0,
+0,0,0,0,190,96,2,0,198,96,2,0,50,17,0,0,0,0,0,0,
+206,96,2,0,214,96,2,0,51,17,0,0,0,0,0,0,224,96,2,0,
+233,96,2,0,52,17,0,0,0,0,0,0,241,96,2,0,251,96,2,0,
+53,17,0,0,0,0,0,0,2,97,2,0,11,97,2,0,54,17,0,0,
+0,0,0,0,18,97,2,0,27,97,2,0,55,17,0,0,0,0,0,0,
+37,97,2,0,46,97,2,0,56,17,0,0,0,0,0,0,52,97,2,0,
+60,97,2,0,57,17,0,0,0,0,0,0,68,97,2,0,75,97,2,0,
+58,17,0,0,0,0,0,0,84,97,2,0,91,97,2,0,59,17,0,0,
+0,0,0,0,101,97,2,0,111,97,2,0,60,17,0,0,0,0,0,0,
+117,97,2,0,124,97,2,0,61,17,0,0,0,0,0,0,131,97,2,0,
+140,97,2,0,62,17,0,0,0,0,0,0,149,97,2,0,160,97,2,0,
+63,17,0,0,0,0,0,0,168,97,2,0,178,97,2,0,64,17,0,0,
+0,0,0,0,185,97,2,0,193,97,2,0,65,17,0,0,0,0,0,0,
+203,97,2,0,212,97,2,0,66,17,0,0,0,0,0,0,221,97,2,0,
+229,97,2,0,67,17,0,0,0,0,0,0,238,97,2,0,247,97,2,0,
+68,17,0,0,0,0,0,0,1,98,2,0,5,98,2,0,69,17,0,0,
+0,0,0,0,13,98,2,0,22,98,2,0,70,17,0,0,0,0,0,0,
+29,98,2,0,38,98,2,0,71,17,0,0,0,0,0,0,45,98,2,0,
+53,98,2,0,72,17,0,0,0,0,0,0,62,98,2,0,71,98,2,0,
+73,17,0,0,0,0,0,0,79,98,2,0,85,98,2,0,74,17,0,0,
+0,0,0,0,92,98,2,0,102,98,2,0,75,17,0,0,0,0,0,0,
+109,98,2,0,117,98,2,0,76,17,0,0,0,0,0,0,126,98,2,0,
+131,98,2,0,77,17,0,0,0,0,0,0,137,98,2,0,147,98,2,0,
+78,17,0,0,0,0,0,0,154,98,2,0,161,98,2,0,84,17,0,0,
+0,0,0,0,163,98,2,0,170,98,2,0,85,17,0,0,0,0,0,0,
+177,98,2,0,183,98,2,0,86,17,0,0,0,0,0,0,190,98,2,0,
+197,98,2,0,87,17,0,0,0,0,0,0,204,98,2,0,214,98,2,0,
+88,17,0,0,0,0,0,0,225,98,2,0,241,98,2,0,112,17,0,0,
+0,0,0,0,246,98,2,0,251,98,2,0,113,17,0,0,0,0,0,0,
+11,99,2,0,25,99,2,0,114,17,0,0,0,0,0,0,31,99,2,0,
+46,99,2,0,116,17,0,0,0,0,0,0,53,99,2,0,68,99,2,0,
+117,17,0,0,0,0,0,0,76,99,2,0,82,99,2,0,128,17,0,0,
+0,0,0,0,90,99,2,0,94,99,2,0,129,17,0,0,0,0,0,0,
+108,99,2,0,112,99,2,0,130,17,0,0,0,0,0,0,125,99,2,0,
+137,99,2,0,131,17,0,0,0,0,0,0,149,99,2,0,153,99,2,0,
+132,17,0,0,0,0,0,0,164,99,2,0,177,99,2,0,133,17,0,0,
+0,0,0,0,186,99,2,0,190,99,2,0,134,17,0,0,0,0,0,0,
+203,99,2,0,215,99,2,0,136,17,0,0,0,0,0,0,219,99,2,0,
+228,99,2,0,137,17,0,0,0,0,0,0,234,99,2,0,246,99,2,0,
+138,17,0,0,0,0,0,0,250,99,2,0,5,100,2,0,143,17,0,0,
+0,0,0,0,16,100,2,0,30,100,2,0,144,17,0,0,0,0,0,0,
+46,100,2,0,59,100,2,0,145,17,0,0,0,0,0,0,76,100,2,0,
+90,100,2,0,146,17,0,0,0,0,0,0,104,100,2,0,117,100,2,0,
+147,17,0,0,0,0,0,0,133,100,2,0,137,100,2,0,149,17,0,0,
+0,0,0,0,145,100,2,0,159,100,2,0,153,17,0,0,0,0,0,0,
+166,100,2,0,171,100,2,0,154,17,0,0,0,0,0,0,185,100,2,0,
+188,100,2,0,155,17,0,0,0,0,0,0,196,100,2,0,205,100,2,0,
+162,17,0,0,0,0,0,0,216,100,2,0,222,100,2,0,163,17,0,0,
+0,0,0,0,233,100,2,0,236,100,2,0,164,17,0,0,0,0,0,0,
+245,100,2,0,254,100,2,0,165,17,0,0,0,0,0,0,4,101,2,0,
+14,101,2,0,166,17,0,0,0,0,0,0,26,101,2,0,32,101,2,0,
+180,17,0,0,0,0,0,0,50,101,2,0,57,101,2,0,181,17,0,0,
+0,0,0,0,76,101,2,0,87,101,2,0,182,17,0,0,0,0,0,0,
+101,101,2,0,110,101,2,0,183,17,0,0,0,0,0,0,116,101,2,0,
+123,101,2,0,184,17,0,0,0,0,0,0,132,101,2,0,145,101,2,0,
+191,17,0,0,0,0,0,0,161,101,2,0,172,101,2,0,192,17,0,0,
+0,0,0,0,182,101,2,0,186,101,2,0,193,17,0,0,0,0,0,0,
+197,101,2,0,202,101,2,0,194,17,0,0,0,0,0,0,222,101,2,0,
+225,101,2,0,201,17,0,0,0,0,0,0,233,101,2,0,238,101,2,0,
+202,17,0,0,0,0,0,0,244,101,2,0,255,101,2,0,210,17,0,0,
+0,0,0,0,7,102,2,0,17,102,2,0,211,17,0,0,0,0,0,0,
+28,102,2,0,32,102,2,0,212,17,0,0,0,0,0,0,43,102,2,0,
+49,102,2,0,213,17,0,0,0,0,0,0,56,102,2,0,60,102,2,0,
+214,17,0,0,0,0,0,0,70,102,2,0,74,102,2,0,215,17,0,0,
+0,0,0,0,85,102,2,0,90,102,2,0,216,17,0,0,0,0,0,0,
+94,102,2,0,110,102,2,0,225,17,0,0,0,0,0,0,120,102,2,0,
+128,102,2,0,232,17,0,0,0,0,0,0,134,102,2,0,148,102,2,0,
+233,17,0,0,0,0,0,0,158,102,2,0,164,102,2,0,234,17,0,0,
+0,0,0,0,170,102,2,0,181,102,2,0,241,17,0,0,0,0,0,0,
+195,102,2,0,200,102,2,0,242,17,0,0,0,0,0,0,211,102,2,0,
+222,102,2,0,243,17,0,0,0,0,0,0,233,102,2,0,244,102,2,0,
+244,17,0,0,0,0,0,0,4,103,2,0,16,103,2,0,245,17,0,0,
+0,0,0,0,27,103,2,0,33,103,2,0,246,17,0,0,0,0,0,0,
+45,103,2,0,56,103,2,0,248,17,0,0,0,0,0,0,72,103,2,0,
+78,103,2,0,249,17,0,0,0,0,0,0,89,103,2,0,101,103,2,0,
+250,17,0,0,0,0,0,0,117,103,2,0,123,103,2,0,251,17,0,0,
+0,0,0,0,136,103,2,0,143,103,2,0,252,17,0,0,0,0,0,0,
+156,103,2,0,168,103,2,0,4,18,0,0,0,0,0,0,182,103,2,0,
+194,103,2,0,6,18,0,0,0,0,0,0,211,103,2,0,221,103,2,0,
+15,18,0,0,0,0,0,0,239,103,2,0,249,103,2,0,16,18,0,0,
+0,0,0,0,10,104,2,0,20,104,2,0,17,18,0,0,0,0,0,0,
+33,104,2,0,43,104,2,0,18,18,0,0,0,0,0,0,53,104,2,0,
+62,104,2,0,19,18,0,0,0,0,0,0,75,104,2,0,85,104,2,0,
+20,18,0,0,0,0,0,0,96,104,2,0,107,104,2,0,21,18,0,0,
+0,0,0,0,119,104,2,0,132,104,2,0,22,18,0,0,0,0,0,0,
+146,104,2,0,156,104,2,0,23,18,0,0,0,0,0,0,171,104,2,0,
+181,104,2,0,27,18,0,0,0,0,0,0,196,104,2,0,206,104,2,0,
+28,18,0,0,0,0,0,0,218,104,2,0,223,104,2,0,29,18,0,0,
+0,0,0,0,232,104,2,0,242,104,2,0,33,18,0,0,0,0,0,0,
+249,104,2,0,3,105,2,0,34,18,0,0,0,0,0,0,15,105,2,0,
+25,105,2,0,35,18,0,0,0,0,0,0,37,105,2,0,47,105,2,0,
+36,18,0,0,0,0,0,0,60,105,2,0,70,105,2,0,37,18,0,0,
+0,0,0,0,80,105,2,0,91,105,2,0,38,18,0,0,0,0,0,0,
+104,105,2,0,114,105,2,0,39,18,0,0,0,0,0,0,126,105,2,0,
+136,105,2,0,40,18,0,0,0,0,0,0,148,105,2,0,160,105,2,0,
+41,18,0,0,0,0,0,0,172,105,2,0,182,105,2,0,42,18,0,0,
+0,0,0,0,194,105,2,0,205,105,2,0,43,18,0,0,0,0,0,0,
+215,105,2,0,226,105,2,0,44,18,0,0,0,0,0,0,239,105,2,0,
+249,105,2,0,45,18,0,0,0,0,0,0,10,106,2,0,23,106,2,0,
+46,18,0,0,0,0,0,0,37,106,2,0,47,106,2,0,47,18,0,0,
+0,0,0,0,62,106,2,0,72,106,2,0,51,18,0,0,0,0,0,0,
+87,106,2,0,97,106,2,0,52,18,0,0,0,0,0,0,109,106,2,0,
+118,106,2,0,56,18,0,0,0,0,0,0,132,106,2,0,142,106,2,0,
+57,18,0,0,0,0,0,0,157,106,2,0,168,106,2,0,58,18,0,0,
+0,0,0,0,181,106,2,0,193,106,2,0,79,18,0,0,0,0,0,0,
+207,106,2,0,218,106,2,0,80,18,0,0,0,0,0,0,234,106,2,0,
+245,106,2,0,81,18,0,0,0,0,0,0,3,107,2,0,16,107,2,0,
+82,18,0,0,0,0,0,0,29,107,2,0,42,107,2,0,83,18,0,0,
+0,0,0,0,55,107,2,0,64,107,2,0,84,18,0,0,0,0,0,0,
+79,107,2,0,88,107,2,0,85,18,0,0,0,0,0,0,97,107,2,0,
+105,107,2,0,86,18,0,0,0,0,0,0,116,107,2,0,125,107,2,0,
+90,18,0,0,0,0,0,0,139,107,2,0,149,107,2,0,91,18,0,0,
+0,0,0,0,164,107,2,0,175,107,2,0,92,18,0,0,0,0,0,0,
+188,107,2,0,199,107,2,0,93,18,0,0,0,0,0,0,213,107,2,0,
+226,107,2,0,94,18,0,0,0,0,0,0,241,107,2,0,249,107,2,0,
+98,18,0,0,0,0,0,0,6,108,2,0,15,108,2,0,99,18,0,0,
+0,0,0,0,29,108,2,0,39,108,2,0,100,18,0,0,0,0,0,0,
+50,108,2,0,60,108,2,0,101,18,0,0,0,0,0,0,73,108,2,0,
+85,108,2,0,102,18,0,0,0,0,0,0,99,108,2,0,109,108,2,0,
+106,18,0,0,0,0,0,0,122,108,2,0,131,108,2,0,107,18,0,0,
+0,0,0,0,143,108,2,0,151,108,2,0,108,18,0,0,0,0,0,0,
+165,108,2,0,175,108,2,0,109,18,0,0,0,0,0,0,190,108,2,0,
+201,108,2,0,110,18,0,0,0,0,0,0,217,108,2,0,229,108,2,0,
+111,18,0,0,0,0,0,0,246,108,2,0,2,109,2,0,112,18,0,0,
+0,0,0,0,16,109,2,0,20,109,2,0,113,18,0,0,0,0,0,0,
+30,109,2,0,46,109,2,0,117,18,0,0,0,0,0,0,63,109,2,0,
+81,109,2,0,118,18,0,0,0,0,0,0,97,109,2,0,112,109,2,0,
+119,18,0,0,0,0,0,0,130,109,2,0,147,109,2,0,120,18,0,0,
+0,0,0,0,164,109,2,0,179,109,2,0,121,18,0,0,0,0,0,0,
+198,109,2,0,216,109,2,0,122,18,0,0,0,0,0,0,234,109,2,0,
+248,109,2,0,124,18,0,0,0,0,0,0,9,110,2,0,25,110,2,0,
+125,18,0,0,0,0,0,0,39,110,2,0,52,110,2,0,126,18,0,0,
+0,0,0,0,68,110,2,0,83,110,2,0,127,18,0,0,0,0,0,0,
+98,110,2,0,111,110,2,0,128,18,0,0,0,0,0,0,128,110,2,0,
+144,110,2,0,129,18,0,0,0,0,0,0,160,110,2,0,169,110,2,0,
+133,18,0,0,0,0,0,0,184,110,2,0,194,110,2,0,134,18,0,0,
+0,0,0,0,209,110,2,0,219,110,2,0,135,18,0,0,0,0,0,0,
+230,110,2,0,240,110,2,0,136,18,0,0,0,0,0,0,253,110,2,0,
+9,111,2,0,140,18,0,0,0,0,0,0,23,111,2,0,33,111,2,0,
+141,18,0,0,0,0,0,0,48,111,2,0,59,111,2,0,142,18,0,0,
+0,0,0,0,75,111,2,0,87,111,2,0,143,18,0,0,0,0,0,0,
+103,111,2,0,115,111,2,0,144,18,0,0,0,0,0,0,130,111,2,0,
+143,111,2,0,145,18,0,0,0,0,0,0,158,111,2,0,170,111,2,0,
+146,18,0,0,0,0,0,0,187,111,2,0,199,111,2,0,147,18,0,0,
+0,0,0,0,214,111,2,0,228,111,2,0,148,18,0,0,0,0,0,0,
+242,111,2,0,0,112,2,0,149,18,0,0,0,0,0,0,14,112,2,0,
+24,112,2,0,150,18,0,0,0,0,0,0,40,112,2,0,49,112,2,0,
+151,18,0,0,0,0,0,0,61,112,2,0,71,112,2,0,155,18,0,0,
+0,0,0,0,85,112,2,0,97,112,2,0,156,18,0,0,0,0,0,0,
+109,112,2,0,121,112,2,0,157,18,0,0,0,0,0,0,135,112,2,0,
+150,112,2,0,158,18,0,0,0,0,0,0,164,112,2,0,177,112,2,0,
+159,18,0,0,0,0,0,0,191,112,2,0,202,112,2,0,163,18,0,0,
+0,0,0,0,213,112,2,0,224,112,2,0,164,18,0,0,0,0,0,0,
+240,112,2,0,1,113,2,0,165,18,0,0,0,0,0,0,17,113,2,0,
+28,113,2,0,166,18,0,0,0,0,0,0,50,113,2,0,60,113,2,0,
+170,18,0,0,0,0,0,0,71,113,2,0,81,113,2,0,171,18,0,0,
+0,0,0,0,96,113,2,0,112,113,2,0,172,18,0,0,0,0,0,0,
+127,113,2,0,137,113,2,0,176,18,0,0,0,0,0,0,145,113,2,0,
+152,113,2,0,177,18,0,0,0,0,0,0,158,113,2,0,166,113,2,0,
+178,18,0,0,0,0,0,0,179,113,2,0,187,113,2,0,179,18,0,0,
+0,0,0,0,198,113,2,0,210,113,2,0,183,18,0,0,0,0,0,0,
+216,113,2,0,227,113,2,0,184,18,0,0,0,0,0,0,242,113,2,0,
+254,113,2,0,185,18,0,0,0,0,0,0,4,114,2,0,15,114,2,0,
+186,18,0,0,0,0,0,0,30,114,2,0,40,114,2,0,190,18,0,0,
+0,0,0,0,45,114,2,0,55,114,2,0,191,18,0,0,0,0,0,0,
+67,114,2,0,75,114,2,0,192,18,0,0,0,0,0,0,87,114,2,0,
+95,114,2,0,193,18,0,0,0,0,0,0,108,114,2,0,117,114,2,0,
+194,18,0,0,0,0,0,0,127,114,2,0,139,114,2,0,195,18,0,0,
+0,0,0,0,150,114,2,0,159,114,2,0,196,18,0,0,0,0,0,0,
+173,114,2,0,183,114,2,0,208,18,0,0,0,0,0,0,190,114,2,0,
+200,114,2,0,209,18,0,0,0,0,0,0,210,114,2,0,214,114,2,0,
+210,18,0,0,0,0,0,0,224,114,2,0,230,114,2,0,211,18,0,0,
+0,0,0,0,240,114,2,0,250,114,2,0,212,18,0,0,0,0,0,0,
+9,115,2,0,20,115,2,0,213,18,0,0,0,0,0,0,35,115,2,0,
+45,115,2,0,214,18,0,0,0,0,0,0,59,115,2,0,70,115,2,0,
+215,18,0,0,0,0,0,0,83,115,2,0,93,115,2,0,216,18,0,0,
+0,0,0,0,105,115,2,0,112,115,2,0,217,18,0,0,0,0,0,0,
+122,115,2,0,133,115,2,0,218,18,0,0,0,0,0,0,146,115,2,0,
+152,115,2,0,219,18,0,0,0,0,0,0,167,115,2,0,174,115,2,0,
+220,18,0,0,0,0,0,0,180,115,2,0,188,115,2,0,221,18,0,0,
+0,0,0,0,194,115,2,0,204,115,2,0,222,18,0,0,0,0,0,0,
+213,115,2,0,225,115,2,0,223,18,0,0,0,0,0,0,239,115,2,0,
+248,115,2,0,224,18,0,0,0,0,0,0,4,116,2,0,19,116,2,0,
+228,18,0,0,0,0,0,0,28,116,2,0,41,116,2,0,229,18,0,0,
+0,0,0,0,49,116,2,0,63,116,2,0,230,18,0,0,0,0,0,0,
+72,116,2,0,84,116,2,0,234,18,0,0,0,0,0,0,98,116,2,0,
+104,116,2,0,235,18,0,0,0,0,0,0,122,116,2,0,134,116,2,0,
+236,18,0,0,0,0,0,0,152,116,2,0,158,116,2,0,237,18,0,0,
+0,0,0,0,170,116,2,0,178,116,2,0,238,18,0,0,0,0,0,0,
+192,116,2,0,199,116,2,0,239,18,0,0,0,0,0,0,207,116,2,0,
+215,116,2,0,240,18,0,0,0,0,0,0,223,116,2,0,230,116,2,0,
+241,18,0,0,0,0,0,0,238,116,2,0,247,116,2,0,242,18,0,0,
+0,0,0,0,0,117,2,0,8,117,2,0,243,18,0,0,0,0,0,0,
+17,117,2,0,26,117,2,0,244,18,0,0,0,0,0,0,38,117,2,0,
+48,117,2,0,245,18,0,0,0,0,0,0,57,117,2,0,67,117,2,0,
+249,18,0,0,0,0,0,0,77,117,2,0,86,117,2,0,250,18,0,0,
+0,0,0,0,96,117,2,0,107,117,2,0,8,19,0,0,0,0,0,0,
+122,117,2,0,129,117,2,0,9,19,0,0,0,0,0,0,144,117,2,0,
+154,117,2,0,10,19,0,0,0,0,0,0,168,117,2,0,178,117,2,0,
+11,19,0,0,0,0,0,0,192,117,2,0,203,117,2,0,12,19,0,0,
+0,0,0,0,213,117,2,0,221,117,2,0,13,19,0,0,0,0,0,0,
+235,117,2,0,242,117,2,0,14,19,0,0,0,0,0,0,250,117,2,0,
+2,118,2,0,15,19,0,0,0,0,0,0,15,118,2,0,24,118,2,0,
+19,19,0,0,0,0,0,0,36,118,2,0,44,118,2,0,20,19,0,0,
+0,0,0,0,53,118,2,0,60,118,2,0,21,19,0,0,0,0,0,0,
+73,118,2,0,79,118,2,0,22,19,0,0,0,0,0,0,86,118,2,0,
+94,118,2,0,26,19,0,0,0,0,0,0,105,118,2,0,112,118,2,0,
+27,19,0,0,0,0,0,0,120,118,2,0,128,118,2,0,28,19,0,0,
+0,0,0,0,137,118,2,0,146,118,2,0,29,19,0,0,0,0,0,0,
+154,118,2,0,162,118,2,0,30,19,0,0,0,0,0,0,174,118,2,0,
+185,118,2,0,31,19,0,0,0,0,0,0,193,118,2,0,199,118,2,0,
+35,19,0,0,0,0,0,0,210,118,2,0,217,118,2,0,36,19,0,0,
+0,0,0,0,223,118,2,0,234,118,2,0,37,19,0,0,0,0,0,0,
+240,118,2,0,246,118,2,0,38,19,0,0,0,0,0,0,1,119,2,0,
+8,119,2,0,39,19,0,0,0,0,0,0,14,119,2,0,25,119,2,0,
+40,19,0,0,0,0,0,0,31,119,2,0,37,119,2,0,41,19,0,0,
+0,0,0,0,46,119,2,0,54,119,2,0,42,19,0,0,0,0,0,0,
+63,119,2,0,71,119,2,0,43,19,0,0,0,0,0,0,79,119,2,0,
+83,119,2,0,44,19,0,0,0,0,0,0,91,119,2,0,99,119,2,0,
+45,19,0,0,0,0,0,0,107,119,2,0,113,119,2,0,46,19,0,0,
+0,0,0,0,121,119,2,0,130,119,2,0,47,19,0,0,0,0,0,0,
+138,119,2,0,145,119,2,0,48,19,0,0,0,0,0,0,153,119,2,0,
+162,119,2,0,49,19,0,0,0,0,0,0,170,119,2,0,178,119,2,0,
+50,19,0,0,0,0,0,0,186,119,2,0,196,119,2,0,51,19,0,0,
+0,0,0,0,206,119,2,0,215,119,2,0,52,19,0,0,0,0,0,0,
+225,119,2,0,235,119,2,0,53,19,0,0,0,0,0,0,245,119,2,0,
+253,119,2,0,54,19,0,0,0,0,0,0,7,120,2,0,19,120,2,0,
+55,19,0,0,0,0,0,0,30,120,2,0,41,120,2,0,56,19,0,0,
+0,0,0,0,52,120,2,0,61,120,2,0,57,19,0,0,0,0,0,0,
+72,120,2,0,82,120,2,0,58,19,0,0,0,0,0,0,95,120,2,0,
+108,120,2,0,60,19,0,0,0,0,0,0,119,120,2,0,138,120,2,0,
+65,19,0,0,0,0,0,0,147,120,2,0,160,120,2,0,66,19,0,0,
+0,0,0,0,183,120,2,0,197,120,2,0,67,19,0,0,0,0,0,0,
+214,120,2,0,233,120,2,0,68,19,0,0,0,0,0,0,248,120,2,0,
+4,121,2,0,70,19,0,0,0,0,0,0,13,121,2,0,24,121,2,0,
+71,19,0,0,0,0,0,0,41,121,2,0,51,121,2,0,78,19,0,0,
+0,0,0,0,60,121,2,0,70,121,2,0,79,19,0,0,0,0,0,0,
+80,121,2,0,91,121,2,0,80,19,0,0,0,0,0,0,105,121,2,0,
+110,121,2,0,81,19,0,0,0,0,0,0,120,121,2,0,126,121,2,0,
+82,19,0,0,0,0,0,0,136,121,2,0,143,121,2,0,83,19,0,0,
+0,0,0,0,155,121,2,0,167,121,2,0,84,19,0,0,0,0,0,0,
+174,121,2,0,182,121,2,0,85,19,0,0,0,0,0,0,193,121,2,0,
+200,121,2,0,86,19,0,0,0,0,0,0,213,121,2,0,222,121,2,0,
+87,19,0,0,0,0,0,0,232,121,2,0,244,121,2,0,88,19,0,0,
+0,0,0,0,3,122,2,0,16,122,2,0,89,19,0,0,0,0,0,0,
+32,122,2,0,48,122,2,0,90,19,0,0,0,0,0,0,64,122,2,0,
+74,122,2,0,92,19,0,0,0,0,0,0,81,122,2,0,91,122,2,0,
+93,19,0,0,0,0,0,0,98,122,2,0,111,122,2,0,95,19,0,0,
+0,0,0,0,125,122,2,0,137,122,2,0,96,19,0,0,0,0,0,0,
+154,122,2,0,168,122,2,0,97,19,0,0,0,0,0,0,185,122,2,0,
+197,122,2,0,98,19,0,0,0,0,0,0,209,122,2,0,224,122,2,0,
+99,19,0,0,0,0,0,0,238,122,2,0,250,122,2,0,100,19,0,0,
+0,0,0,0,10,123,2,0,26,123,2,0,101,19,0,0,0,0,0,0,
+38,123,2,0,54,123,2,0,102,19,0,0,0,0,0,0,63,123,2,0,
+75,123,2,0,103,19,0,0,0,0,0,0,91,123,2,0,103,123,2,0,
+104,19,0,0,0,0,0,0,119,123,2,0,131,123,2,0,105,19,0,0,
+0,0,0,0,143,123,2,0,157,123,2,0,106,19,0,0,0,0,0,0,
+171,123,2,0,185,123,2,0,107,19,0,0,0,0,0,0,199,123,2,0,
+211,123,2,0,108,19,0,0,0,0,0,0,226,123,2,0,238,123,2,0,
+109,19,0,0,0,0,0,0,250,123,2,0,10,124,2,0,110,19,0,0,
+0,0,0,0,26,124,2,0,41,124,2,0,111,19,0,0,0,0,0,0,
+57,124,2,0,69,124,2,0,115,19,0,0,0,0,0,0,76,124,2,0,
+83,124,2,0,116,19,0,0,0,0,0,0,97,124,2,0,103,124,2,0,
+117,19,0,0,0,0,0,0,118,124,2,0,127,124,2,0,118,19,0,0,
+0,0,0,0,136,124,2,0,144,124,2,0,119,19,0,0,0,0,0,0,
+158,124,2,0,166,124,2,0,120,19,0,0,0,0,0,0,176,124,2,0,
+185,124,2,0,121,19,0,0,0,0,0,0,195,124,2,0,208,124,2,0,
+126,19,0,0,0,0,0,0,218,124,2,0,233,124,2,0,127,19,0,0,
+0,0,0,0,250,124,2,0,5,125,2,0,128,19,0,0,0,0,0,0,
+24,125,2,0,35,125,2,0,129,19,0,0,0,0,0,0,52,125,2,0,
+65,125,2,0,130,19,0,0,0,0,0,0,79,125,2,0,91,125,2,0,
+133,19,0,0,0,0,0,0,101,125,2,0,115,125,2,0,134,19,0,0,
+0,0,0,0,131,125,2,0,141,125,2,0,135,19,0,0,0,0,0,0,
+159,125,2,0,169,125,2,0,136,19,0,0,0,0,0,0,185,125,2,0,
+197,125,2,0,137,19,0,0,0,0,0,0,210,125,2,0,224,125,2,0,
+145,19,0,0,0,0,0,0,232,125,2,0,245,125,2,0,146,19,0,0,
+0,0,0,0,7,126,2,0,21,126,2,0,148,19,0,0,0,0,0,0,
+28,126,2,0,32,126,2,0,149,19,0,0,0,0,0,0,46,126,2,0,
+59,126,2,0,150,19,0,0,0,0,0,0,77,126,2,0,91,126,2,0,
+152,19,0,0,0,0,0,0,99,126,2,0,112,126,2,0,153,19,0,0,
+0,0,0,0,130,126,2,0,143,126,2,0,154,19,0,0,0,0,0,0,
+160,126,2,0,173,126,2,0,155,19,0,0,0,0,0,0,191,126,2,0,
+196,126,2,0,156,19,0,0,0,0,0,0,209,126,2,0,227,126,2,0,
+157,19,0,0,0,0,0,0,242,126,2,0,255,126,2,0,163,19,0,0,
+0,0,0,0,8,127,2,0,19,127,2,0,168,19,0,0,0,0,0,0,
+28,127,2,0,39,127,2,0,169,19,0,0,0,0,0,0,54,127,2,0,
+65,127,2,0,170,19,0,0,0,0,0,0,76,127,2,0,87,127,2,0,
+171,19,0,0,0,0,0,0,103,127,2,0,114,127,2,0,172,19,0,0,
+0,0,0,0,130,127,2,0,143,127,2,0,174,19,0,0,0,0,0,0,
+152,127,2,0,164,127,2,0,175,19,0,0,0,0,0,0,173,127,2,0,
+185,127,2,0,178,19,0,0,0,0,0,0,203,127,2,0,217,127,2,0,
+179,19,0,0,0,0,0,0,233,127,2,0,244,127,2,0,180,19,0,0,
+0,0,0,0,5,128,2,0,23,128,2,0,181,19,0,0,0,0,0,0,
+34,128,2,0,45,128,2,0,183,19,0,0,0,0,0,0,62,128,2,0,
+75,128,2,0,184,19,0,0,0,0,0,0,90,128,2,0,100,128,2,0,
+185,19,0,0,0,0,0,0,116,128,2,0,133,128,2,0,186,19,0,0,
+0,0,0,0,143,128,2,0,152,128,2,0,190,19,0,0,0,0,0,0,
+161,128,2,0,175,128,2,0,192,19,0,0,0,0,0,0,183,128,2,0,
+195,128,2,0,193,19,0,0,0,0,0,0,204,128,2,0,207,128,2,0,
+194,19,0,0,0,0,0,0,220,128,2,0,226,128,2,0,196,19,0,0,
+0,0,0,0,234,128,2,0,244,128,2,0,202,19,0,0,0,0,0,0,
+253,128,2,0,8,129,2,0,203,19,0,0,0,0,0,0,18,129,2,0,
+29,129,2,0,204,19,0,0,0,0,0,0,39,129,2,0,49,129,2,0,
+205,19,0,0,0,0,0,0,64,129,2,0,73,129,2,0,206,19,0,0,
+0,0,0,0,88,129,2,0,93,129,2,0,212,19,0,0,0,0,0,0,
+104,129,2,0,110,129,2,0,213,19,0,0,0,0,0,0,120,129,2,0,
+127,129,2,0,214,19,0,0,0,0,0,0,138,129,2,0,144,129,2,0,
+215,19,0,0,0,0,0,0,156,129,2,0,158,129,2,0,225,19,0,0,
+0,0,0,0,163,129,2,0,165,129,2,0,226,19,0,0,0,0,0,0,
+178,129,2,0,180,129,2,0,227,19,0,0,0,0,0,0,189,129,2,0,
+198,129,2,0,228,19,0,0,0,0,0,0,207,129,2,0,209,129,2,0,
+229,19,0,0,0,0,0,0,218,129,2,0,226,129,2,0,230,19,0,0,
+0,0,0,0,235,129,2,0,238,129,2,0,231,19,0,0,0,0,0,0,
+243,129,2,0,246,129,2,0,232,19,0,0,0,0,0,0,251,129,2,0,
+254,129,2,0,233,19,0,0,0,0,0,0,0,130,2,0,3,130,2,0,
+234,19,0,0,0,0,0,0,8,130,2,0,10,130,2,0,235,19,0,0,
+0,0,0,0,17,130,2,0,31,130,2,0,10,20,0,0,0,0,0,0,
+47,130,2,0,51,130,2,0,11,20,0,0,0,0,0,0,57,130,2,0,
+65,130,2,0,12,20,0,0,0,0,0,0,75,130,2,0,86,130,2,0,
+13,20,0,0,0,0,0,0,99,130,2,0,106,130,2,0,14,20,0,0,
+0,0,0,0,115,130,2,0,122,130,2,0,15,20,0,0,0,0,0,0,
+131,130,2,0,139,130,2,0,16,20,0,0,0,0,0,0,149,130,2,0,
+158,130,2,0,17,20,0,0,0,0,0,0,169,130,2,0,173,130,2,0,
+18,20,0,0,0,0,0,0,179,130,2,0,186,130,2,0,19,20,0,0,
+0,0,0,0,195,130,2,0,206,130,2,0,20,20,0,0,0,0,0,0,
+219,130,2,0,228,130,2,0,21,20,0,0,0,0,0,0,239,130,2,0,
+250,130,2,0,22,20,0,0,0,0,0,0,7,131,2,0,14,131,2,0,
+23,20,0,0,0,0,0,0,18,131,2,0,23,131,2,0,24,20,0,0,
+0,0,0,0,30,131,2,0,36,131,2,0,25,20,0,0,0,0,0,0,
+44,131,2,0,50,131,2,0,26,20,0,0,0,0,0,0,60,131,2,0,
+65,131,2,0,27,20,0,0,0,0,0,0,72,131,2,0,78,131,2,0,
+28,20,0,0,0,0,0,0,86,131,2,0,93,131,2,0,29,20,0,0,
+0,0,0,0,102,131,2,0,111,131,2,0,30,20,0,0,0,0,0,0,
+122,131,2,0,127,131,2,0,31,20,0,0,0,0,0,0,135,131,2,0,
+144,131,2,0,32,20,0,0,0,0,0,0,156,131,2,0,162,131,2,0,
+153,0,0,0,0,0,0,0,167,131,2,0,173,131,2,0,154,0,0,0,
+0,0,0,0,178,131,2,0,182,131,2,0,155,0,0,0,0,0,0,0,
+187,131,2,0,192,131,2,0,156,0,0,0,0,0,0,0,197,131,2,0,
+202,131,2,0,157,0,0,0,0,0,0,0,207,131,2,0,212,131,2,0,
+158,0,0,0,0,0,0,0,216,131,2,0,221,131,2,0,159,0,0,0,
+0,0,0,0,225,131,2,0,231,131,2,0,160,0,0,0,0,0,0,0,
+235,131,2,0,240,131,2,0,161,0,0,0,0,0,0,0,244,131,2,0,
+250,131,2,0,162,0,0,0,0,0,0,0,254,131,2,0,3,132,2,0,
+163,0,0,0,0,0,0,0,7,132,2,0,12,132,2,0,164,0,0,0,
+0,0,0,0,17,132,2,0,22,132,2,0,165,0,0,0,0,0,0,0,
+27,132,2,0,33,132,2,0,166,0,0,0,0,0,0,0,38,132,2,0,
+44,132,2,0,167,0,0,0,0,0,0,0,49,132,2,0,55,132,2,0,
+168,0,0,0,0,0,0,0,60,132,2,0,65,132,2,0,169,0,0,0,
+0,0,0,0,70,132,2,0,75,132,2,0,170,0,0,0,0,0,0,0,
+81,132,2,0,87,132,2,0,171,0,0,0,0,0,0,0,93,132,2,0,
+98,132,2,0,172,0,0,0,0,0,0,0,104,132,2,0,110,132,2,0,
+173,0,0,0,0,0,0,0,116,132,2,0,122,132,2,0,174,0,0,0,
+0,0,0,0,128,132,2,0,136,132,2,0,176,0,0,0,0,0,0,0,
+140,132,2,0,145,132,2,0,177,0,0,0,0,0,0,0,149,132,2,0,
+154,132,2,0,178,0,0,0,0,0,0,0,158,132,2,0,163,132,2,0,
+179,0,0,0,0,0,0,0,167,132,2,0,172,132,2,0,180,0,0,0,
+0,0,0,0,176,132,2,0,183,132,2,0,181,0,0,0,0,0,0,0,
+185,132,2,0,192,132,2,0,182,0,0,0,0,0,0,0,194,132,2,0,
+201,132,2,0,183,0,0,0,0,0,0,0,203,132,2,0,208,132,2,0,
+185,0,0,0,0,0,0,0,213,132,2,0,218,132,2,0,186,0,0,0,
+0,0,0,0,223,132,2,0,228,132,2,0,187,0,0,0,0,0,0,0,
+233,132,2,0,238,132,2,0,188,0,0,0,0,0,0,0,243,132,2,0,
+248,132,2,0,189,0,0,0,0,0,0,0,253,132,2,0,2,133,2,0,
+190,0,0,0,0,0,0,0,7,133,2,0,10,133,2,0,191,0,0,0,
+0,0,0,0,15,133,2,0,18,133,2,0,192,0,0,0,0,0,0,0,
+23,133,2,0,26,133,2,0,193,0,0,0,0,0,0,0,31,133,2,0,
+34,133,2,0,194,0,0,0,0,0,0,0,39,133,2,0,42,133,2,0,
+195,0,0,0,0,0,0,0,47,133,2,0,50,133,2,0,196,0,0,0,
+0,0,0,0,55,133,2,0,57,133,2,0,198,0,0,0,0,0,0,0,
+63,133,2,0,65,133,2,0,199,0,0,0,0,0,0,0,71,133,2,0,
+73,133,2,0,200,0,0,0,0,0,0,0,77,133,2,0,79,133,2,0,
+201,0,0,0,0,0,0,0,84,133,2,0,86,133,2,0,202,0,0,0,
+0,0,0,0,91,133,2,0,93,133,2,0,203,0,0,0,0,0,0,0,
+98,133,2,0,100,133,2,0,204,0,0,0,0,0,0,0,105,133,2,0,
+107,133,2,0,205,0,0,0,0,0,0,0,112,133,2,0,114,133,2,0,
+206,0,0,0,0,0,0,0,120,133,2,0,123,133,2,0,207,0,0,0,
+0,0,0,0,128,133,2,0,130,133,2,0,208,0,0,0,0,0,0,0,
+135,133,2,0,137,133,2,0,209,0,0,0,0,0,0,0,143,133,2,0,
+145,133,2,0,210,0,0,0,0,0,0,0,151,133,2,0,153,133,2,0,
+211,0,0,0,0,0,0,0,159,133,2,0,161,133,2,0,212,0,0,0,
+0,0,0,0,166,133,2,0,168,133,2,0,213,0,0,0,0,0,0,0,
+173,133,2,0,175,133,2,0,214,0,0,0,0,0,0,0,181,133,2,0,
+183,133,2,0,215,0,0,0,0,0,0,0,188,133,2,0,190,133,2,0,
+216,0,0,0,0,0,0,0,196,133,2,0,198,133,2,0,217,0,0,0,
+0,0,0,0,204,133,2,0,207,133,2,0,71,6,0,0,0,0,0,0,
+210,133,2,0,217,133,2,0,72,6,0,0,0,0,0,0,220,133,2,0,
+229,133,2,0,73,6,0,0,0,0,0,0,232,133,2,0,236,133,2,0,
+75,6,0,0,0,0,0,0,240,133,2,0,243,133,2,0,142,7,0,0,
+0,0,0,0,246,133,2,0,254,133,2,0,143,7,0,0,0,0,0,0,
+1,134,2,0,3,134,2,0,221,19,0,0,0,0,0,0,7,134,2,0,
+9,134,2,0,222,19,0,0,0,0,0,0,13,134,2,0,15,134,2,0,
+223,19,0,0,0,0,0,0,19,134,2,0,21,134,2,0,224,19,0,0,
+0,0,0,0,27,134,2,0,38,134,2,0,40,134,2,0,47,134,2,0,
+73,134,2,0,49,134,2,0,69,134,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,80,2,0,0,0,0,0,0,84,134,2,0,97,134,2,0,
+99,134,2,0,110,134,2,0,146,134,2,0,112,134,2,0,142,134,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,81,2,0,0,0,0,0,0,
+159,134,2,0,169,134,2,0,171,134,2,0,187,134,2,0,218,134,2,0,
+189,134,2,0,214,134,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+82,2,0,0,0,0,0,0,228,134,2,0,235,134,2,0,237,134,2,0,
+255,255,255,255,254,134,2,0,241,134,2,0,255,255,255,255,255,255,255,255,
+0,0,0,0,0,0,0,0,83,2,0,0,0,0,0,0,5,135,2,0,
+8,135,2,0,10,135,2,0,28,135,2,0,61,135,2,0,29,135,2,0,
+51,135,2,0,255,255,255,255,0,0,0,0,0,0,0,0,130,2,0,0,
+0,0,0,0,64,135,2,0,70,135,2,0,72,135,2,0,86,135,2,0,
+111,135,2,0,87,135,2,0,109,135,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,145,2,0,0,0,0,0,0,117,135,2,0,129,135,2,0,
+131,135,2,0,140,135,2,0,163,135,2,0,141,135,2,0,161,135,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,146,2,0,0,0,0,0,0,
+175,135,2,0,181,135,2,0,183,135,2,0,208,135,2,0,240,135,2,0,
+209,135,2,0,238,135,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+163,2,0,0,0,0,0,0,246,135,2,0,5,136,2,0,7,136,2,0,
+16,136,2,0,42,136,2,0,17,136,2,0,40,136,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,164,2,0,0,0,0,0,0,57,136,2,0,
+69,136,2,0,71,136,2,0,92,136,2,0,131,136,2,0,93,136,2,0,
+129,136,2,0,255,255,255,255,0,0,0,0,0,0,0,0,190,2,0,0,
+0,0,0,0,143,136,2,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,151,136,2,0,168,42,2,0,
+14,0,0,0,226,2,0,0,0,0,0,0,156,136,2,0,161,136,2,0,
+163,136,2,0,183,136,2,0,215,136,2,0,184,136,2,0,207,136,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,184,4,0,0,0,0,0,0,
+220,136,2,0,226,136,2,0,228,136,2,0,245,136,2,0,22,137,2,0,
+246,136,2,0,15,137,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+244,4,0,0,0,0,0,0,28,137,2,0,34,137,2,0,36,137,2,0,
+52,137,2,0,81,137,2,0,54,137,2,0,78,137,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,248,4,0,0,0,0,0,0,87,137,2,0,
+100,137,2,0,102,137,2,0,131,137,2,0,180,137,2,0,132,137,2,0,
+175,137,2,0,255,255,255,255,0,0,0,0,0,0,0,0,95,7,0,0,
+0,0,0,0,193,137,2,0,208,137,2,0,210,137,2,0,241,137,2,0,
+38,138,2,0,242,137,2,0,33,138,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,97,7,0,0,0,0,0,0,53,138,2,0,67,138,2,0,
+69,138,2,0,99,138,2,0,150,138,2,0,100,138,2,0,145,138,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,99,7,0,0,0,0,0,0,
+164,138,2,0,179,138,2,0,181,138,2,0,212,138,2,0,9,139,2,0,
+213,138,2,0,4,139,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+101,7,0,0,0,0,0,0,24,139,2,0,30,139,2,0,32,139,2,0,
+68,139,2,0,116,139,2,0,70,139,2,0,109,139,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,3,9,0,0,0,0,0,0,122,139,2,0,
+131,139,2,0,133,139,2,0,156,139,2,0,196,139,2,0,158,139,2,0,
+189,139,2,0,255,255,255,255,0,0,0,0,0,0,0,0,5,9,0,0,
+0,0,0,0,205,139,2,0,214,139,2,0,216,139,2,0,239,139,2,0,
+24,140,2,0,241,139,2,0,17,140,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,8,9,0,0,0,0,0,0,33,140,2,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+38,140,2,0,136,43,2,0,62,0,0,0,36,9,0,0,0,0,0,0,
+45,140,2,0,55,140,2,0,57,140,2,0,82,140,2,0,129,140,2,0,
+84,140,2,0,122,140,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+42,9,0,0,0,0,0,0,139,140,2,0,143,140,2,0,145,140,2,0,
+152,140,2,0,165,140,2,0,154,140,2,0,163,140,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,17,10,0,0,0,0,0,0,169,140,2,0,
+177,140,2,0,179,140,2,0,189,140,2,0,209,140,2,0,191,140,2,0,
+207,140,2,0,255,255,255,255,0,0,0,0,0,0,0,0,18,10,0,0,
+0,0,0,0,217,140,2,0,220,140,2,0,222,140,2,0,232,140,2,0,
+247,140,2,0,234,140,2,0,245,140,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,19,10,0,0,0,0,0,0,250,140,2,0,254,140,2,0,
+0,141,2,0,8,141,2,0,23,141,2,0,10,141,2,0,21,141,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,20,10,0,0,0,0,0,0,
+27,141,2,0,31,141,2,0,33,141,2,0,42,141,2,0,58,141,2,0,
+44,141,2,0,56,141,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+21,10,0,0,0,0,0,0,62,141,2,0,66,141,2,0,68,141,2,0,
+77,141,2,0,93,141,2,0,79,141,2,0,91,141,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,22,10,0,0,0,0,0,0,97,141,2,0,
+101,141,2,0,103,141,2,0,112,141,2,0,128,141,2,0,114,141,2,0,
+126,141,2,0,255,255,255,255,0,0,0,0,0,0,0,0,23,10,0,0,
+0,0,0,0,132,141,2,0,137,141,2,0,139,141,2,0,146,141,2,0,
+161,141,2,0,148,141,2,0,159,141,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,24,10,0,0,0,0,0,0,166,141,2,0,170,141,2,0,
+172,141,2,0,180,141,2,0,195,141,2,0,182,141,2,0,193,141,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,26,10,0,0,0,0,0,0,
+199,141,2,0,203,141,2,0,205,141,2,0,217,141,2,0,238,141,2,0,
+219,141,2,0,236,141,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+34,10,0,0,0,0,0,0,242,141,2,0,247,141,2,0,249,141,2,0,
+6,142,2,0,29,142,2,0,8,142,2,0,27,142,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,35,10,0,0,0,0,0,0,34,142,2,0,
+39,142,2,0,41,142,2,0,58,142,2,0,85,142,2,0,60,142,2,0,
+83,142,2,0,255,255,255,255,0,0,0,0,0,0,0,0,36,10,0,0,
+0,0,0,0,90,142,2,0,94,142,2,0,96,142,2,0,123,142,2,0,
+151,142,2,0,125,142,2,0,149,142,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,41,10,0,0,0,0,0,0,155,142,2,0,159,142,2,0,
+161,142,2,0,168,142,2,0,182,142,2,0,170,142,2,0,180,142,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,42,10,0,0,0,0,0,0,
+186,142,2,0,192,142,2,0,194,142,2,0,215,142,2,0,250,142,2,0,
+217,142,2,0,247,142,2,0,255,255,255,255,0,0,0,0,0,0,0,0,
+50,10,0,0,0,0,0,0,0,143,2,0,6,143,2,0,8,143,2,0,
+26,143,2,0,61,143,2,0,28,143,2,0,55,143,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,51,10,0,0,0,0,0,0,67,143,2,0,
+73,143,2,0,75,143,2,0,89,143,2,0,112,143,2,0,91,143,2,0,
+110,143,2,0,255,255,255,255,0,0,0,0,0,0,0,0,52,10,0,0,
+0,0,0,0,118,143,2,0,130,143,2,0,132,143,2,0,149,143,2,0,
+188,143,2,0,151,143,2,0,186,143,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,225,11,0,0,0,0,0,0,200,143,2,0,210,143,2,0,
+212,143,2,0,239,143,2,0,22,144,2,0,240,143,2,0,20,144,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,162,14,0,0,0,0,0,0,
+32,144,2,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,44,144,2,0,104,47,2,0,16,0,0,0,
+183,14,0,0,0,0,0,0,47,144,2,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,58,144,2,0,
+104,48,2,0,10,0,0,0,216,14,0,0,0,0,0,0,82,144,2,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,91,144,2,0,8,49,2,0,10,0,0,0,230,14,0,0,
+0,0,0,0,118,144,2,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,128,144,2,0,168,49,2,0,
+8,0,0,0,243,14,0,0,0,0,0,0,131,144,2,0,142,144,2,0,
+144,144,2,0,162,144,2,0,197,144,2,0,163,144,2,0,195,144,2,0,
+255,255,255,255,0,0,0,0,0,0,0,0,252,14,0,0,0,0,0,0,
+208,144,2,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,215,144,2,0,40,50,2,0,28,0,0,0,
+71,15,0,0,0,0,0,0,222,144,2,0,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,229,144,2,0,
+232,51,2,0,39,0,0,0,112,15,0,0,0,0,0,0,236,144,2,0,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,252,144,2,0,88,54,2,0,36,0,0,0,156,15,0,0,
+0,0,0,0,3,145,2,0,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,14,145,2,0,152,56,2,0,
+41,0,0,0,207,15,0,0,0,0,0,0,21,145,2,0,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+29,145,2,0,40,59,2,0,19,0,0,0,231,15,0,0,0,0,0,0,
+36,145,2,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,43,145,2,0,88,60,2,0,13,0,0,0,
+252,15,0,0,0,0,0,0,50,145,2,0,59,145,2,0,61,145,2,0,
+81,145,2,0,117,145,2,0,82,145,2,0,114,145,2,0,255,255,255,255,
+0,0,0,0,0,0,0,0,62,16,0,0,0,0,0,0,126,145,2,0,
+137,145,2,0,139,145,2,0,158,145,2,0,190,145,2,0,159,145,2,0,
+187,145,2,0,255,255,255,255,0,0,0,0,0,0,0,0,103,16,0,0,
+0,0,0,0,201,145,2,0,212,145,2,0,214,145,2,0,224,145,2,0,
+250,145,2,0,225,145,2,0,247,145,2,0,255,255,255,255,0,0,0,0,
+0,0,0,0,107,16,0,0,0,0,0,0,0,0,0,0,0,0,176,63,
+143,194,245,40,92,213,131,64,0,0,0,0,0,0,192,63,143,194,245,40,
+92,157,132,64,0,0,0,0,0,0,208,63,143,194,245,40,92,101,133,64,
+0,0,0,0,0,0,224,63,143,194,245,40,92,45,134,64,0,0,0,0,
+0,0,240,63,143,194,245,40,92,245,134,64,0,0,0,0,0,0,0,64,
+143,194,245,40,92,189,135,64,0,0,0,0,0,0,8,64,143,194,245,40,
+92,133,136,64,0,0,0,0,0,0,16,64,143,194,245,40,92,77,137,64,
+0,0,0,0,0,0,20,64,143,194,245,40,92,21,138,64,0,0,0,0,
+0,0,24,64,143,194,245,40,92,221,138,64,0,0,0,0,0,0,28,64,
+143,194,245,40,92,165,139,64,0,0,0,0,0,0,32,64,143,194,245,40,
+92,109,140,64,0,0,0,0,0,0,34,64,143,194,245,40,92,53,141,64,
+0,0,0,0,0,0,36,64,143,194,245,40,92,253,141,64,0,0,0,0,
+0,0,0,0,26,192,91,32,65,241,239,63,0,0,0,0,0,0,224,63,
+226,88,23,183,209,0,240,63,0,0,0,0,0,0,240,63,70,37,117,2,
+154,8,240,63,0,0,0,0,0,0,248,63,170,241,210,77,98,16,240,63,
+0,0,0,0,0,0,0,64,127,106,188,116,147,24,240,63,0,0,0,0,
+0,0,4,64,227,54,26,192,91,32,240,63,0,0,0,0,0,0,8,64,
+184,175,3,231,140,40,240,63,0,0,0,0,0,0,12,64,141,40,237,13,
+190,48,240,63,0,0,0,0,0,0,16,64,98,161,214,52,239,56,240,63,
+0,0,0,0,0,0,20,64,155,230,29,167,232,72,240,63,0,0,0,0,
+0,0,22,64,112,95,7,206,25,81,240,63,0,0,0,0,0,0,24,64,
+69,216,240,244,74,89,240,63,0,0,0,0,0,0,26,64,26,81,218,27,
+124,97,240,63,0,0,0,0,0,0,28,64,96,118,79,30,22,106,240,63,
+0,0,0,0,0,0,30,64,53,239,56,69,71,114,240,63,0,0,0,0,
+0,0,32,64,10,104,34,108,120,122,240,63,0,0,0,0,0,0,33,64,
+80,141,151,110,18,131,240,63,0,0,0,0,0,0,34,64,37,6,129,149,
+67,139,240,63,0,0,0,0,0,0,35,64,107,43,246,151,221,147,240,63,
+0,0,0,0,0,0,36,64,64,164,223,190,14,156,240,63,0,0,0,0,
+0,0,38,64,204,238,201,195,66,173,240,63,0,0,0,0,0,0,40,64,
+88,57,180,200,118,190,240,63,0,0,0,0,0,0,42,64,228,131,158,205,
+170,207,240,63,0,0,0,0,0,0,44,64,112,206,136,210,222,224,240,63,
+0,0,0,0,0,0,46,64,109,197,254,178,123,242,240,63,0,0,0,0,
+0,0,48,64,106,188,116,147,24,4,241,63,0,0,0,0,0,0,49,64,
+104,179,234,115,181,21,241,63,0,0,0,0,0,0,50,64,214,86,236,47,
+187,39,241,63,0,0,0,0,0,0,51,64,68,250,237,235,192,57,241,63,
+0,0,0,0,0,0,52,64,178,157,239,167,198,75,241,63,0,0,0,0,
+0,0,54,64,0,145,126,251,58,112,241,63,0,0,0,0,0,0,56,64,
+47,221,36,6,129,149,241,63,0,0,0,0,0,0,58,64,208,213,86,236,
+47,187,241,63,0,0,0,0,0,0,60,64,225,122,20,174,71,225,241,63,
+0,0,0,0,0,0,62,64,213,120,233,38,49,8,242,63,0,0,0,0,
+0,0,64,64,58,35,74,123,131,47,242,63,0,0,0,0,0,0,65,64,
+129,38,194,134,167,87,242,63,0,0,0,0,0,0,66,64,199,41,58,146,
+203,127,242,63,0,0,0,0,0,0,67,64,97,50,85,48,42,169,242,63,
+0,0,0,0,0,0,68,64,109,231,251,169,241,210,242,63,0,0,0,0,
+0,0,69,64,233,72,46,255,33,253,242,63,0,0,0,0,0,0,70,64,
+214,86,236,47,187,39,243,63,0,0,0,0,0,0,71,64,22,106,77,243,
+142,83,243,63,0,0,0,0,0,0,72,64,86,125,174,182,98,127,243,63,
+0,0,0,0,0,0,73,64,121,233,38,49,8,172,243,63,0,0,0,0,
+0,0,74,64,125,174,182,98,127,217,243,63,0,0,0,0,0,0,75,64,
+243,31,210,111,95,7,244,63,0,0,0,0,0,0,76,64,75,234,4,52,
+17,54,244,63,0,0,0,0,0,0,77,64,19,97,195,211,43,101,244,63,
+0,0,0,0,0,0,78,64,190,48,153,42,24,149,244,63,0,0,0,0,
+0,0,79,64,75,89,134,56,214,197,244,63,0,0,0,0,0,0,80,64,
+73,46,255,33,253,246,244,63,0,0,0,0,0,128,80,64,184,175,3,231,
+140,40,245,63,0,0,0,0,0,0,81,64,122,54,171,62,87,91,245,63,
+0,0,0,0,0,128,81,64,60,189,82,150,33,142,245,63,0,0,0,0,
+0,0,82,64,82,73,157,128,38,194,245,63,0,0,0,0,0,128,82,64,
+103,213,231,106,43,246,245,63,0,0,0,0,0,0,83,64,94,186,73,12,
+2,43,246,63,0,0,0,0,0,128,83,64,56,248,194,100,170,96,246,63,
+0,0,0,0,0,0,84,64,17,54,60,189,82,150,246,63,0,0,0,0,
+0,128,84,64,205,204,204,204,204,204,246,63,0,0,0,0,0,0,85,64,
+136,99,93,220,70,3,247,63,0,0,0,0,0,0,24,192,0,0,0,0,
+0,0,224,63,0,0,0,0,0,0,20,192,25,4,86,14,45,178,221,63,
+0,0,0,0,0,0,8,192,154,153,153,153,153,153,217,63,0,0,0,0,
+0,0,0,192,2,43,135,22,217,206,215,63,0,0,0,0,0,0,8,64,
+84,227,165,155,196,32,208,63,0,0,0,0,0,0,24,64,250,126,106,188,
+116,147,200,63,0,0,0,0,0,0,36,64,252,169,241,210,77,98,192,63,
+0,0,0,0,0,0,44,64,123,20,174,71,225,122,180,63,0,0,0,0,
+0,0,51,64,123,20,174,71,225,122,164,63,0,0,0,0,0,0,55,64,
+250,126,106,188,116,147,152,63,0,0,0,0,0,0,58,64,59,223,79,141,
+151,110,146,63,0,0,0,0,0,0,60,64,172,173,216,95,118,79,142,63,
+0,0,0,0,0,0,62,64,19,97,195,211,43,101,137,63,0,0,0,0,
+0,128,67,64,148,246,6,95,152,76,117,63,0,0,0,0,0,128,72,64,
+97,50,85,48,42,169,83,63,0,0,0,0,0,0,73,64,252,169,241,210,
+77,98,80,63,0,0,0,0,0,0,20,192,0,0,0,0,0,192,114,64,
+0,0,0,0,0,0,240,63,0,0,0,0,0,128,102,64,0,0,0,0,
+0,0,44,64,0,0,0,0,0,0,73,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,0,68,64,0,0,0,0,0,0,49,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,0,52,64,0,0,0,0,0,0,56,64,
+0,0,0,0,0,0,58,64,0,0,0,0,0,0,40,64,0,0,0,0,
+0,0,63,64,0,0,0,0,0,0,28,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,0,18,64,0,0,0,0,0,0,67,64,0,0,0,0,
+0,0,16,64,0,0,0,0,0,0,20,192,0,0,0,0,0,192,114,64,
+0,0,0,0,0,0,240,63,0,0,0,0,0,128,102,64,0,0,0,0,
+0,0,44,64,0,0,0,0,0,0,73,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,0,68,64,0,0,0,0,0,0,49,64,0,0,0,0,
+0,0,66,64,0,0,0,0,0,0,52,64,0,0,0,0,0,0,56,64,
+0,0,0,0,0,0,58,64,0,0,0,0,0,0,40,64,0,0,0,0,
+0,0,63,64,0,0,0,0,0,0,28,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,0,18,64,0,0,0,0,0,0,67,64,0,0,0,0,
+0,0,16,64,0,0,0,0,0,0,240,63,252,169,241,210,77,98,96,63,
+0,0,0,0,0,0,36,64,123,20,174,71,225,122,148,63,0,0,0,0,
+0,0,46,64,123,20,174,71,225,122,164,63,0,0,0,0,0,0,51,64,
+184,30,133,235,81,184,174,63,0,0,0,0,0,0,55,64,154,153,153,153,
+153,153,185,63,0,0,0,0,0,0,56,64,0,0,0,0,0,0,192,63,
+0,0,0,0,0,0,59,64,0,0,0,0,0,0,224,63,0,0,0,0,
+0,0,60,64,0,0,0,0,0,0,240,63,0,0,0,0,0,0,40,64,
+0,0,0,0,0,92,156,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,176,148,64,0,0,0,0,0,0,52,64,0,0,0,0,0,64,143,64,
+0,0,0,0,0,0,56,64,0,0,0,0,0,224,135,64,0,0,0,0,
+0,0,62,64,0,0,0,0,0,16,132,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,208,128,64,0,0,0,0,0,0,68,64,0,0,0,0,
+0,144,122,64,0,0,0,0,0,0,73,64,0,0,0,0,0,0,117,64,
+0,0,0,0,0,0,78,64,0,0,0,0,0,208,112,64,0,0,0,0,
+0,0,84,64,0,0,0,0,0,32,105,64,0,0,0,0,0,0,89,64,
+0,0,0,0,0,64,100,64,0,0,0,0,0,0,94,64,0,0,0,0,
+0,64,95,64,0,0,0,0,0,192,98,64,0,0,0,0,0,0,89,64,
+0,0,0,0,0,128,102,64,0,0,0,0,0,128,84,64,0,0,0,0,
+0,128,107,64,0,0,0,0,0,0,81,64,0,0,0,0,0,0,110,64,
+0,0,0,0,0,64,77,64,0,0,0,0,0,128,113,64,154,153,153,153,
+153,25,74,64,0,0,0,0,0,0,116,64,154,153,153,153,153,25,71,64,
+0,0,0,0,0,128,118,64,0,0,0,0,0,64,68,64,0,0,0,0,
+0,0,121,64,0,0,0,0,0,128,65,64,0,0,0,0,0,64,127,64,
+51,51,51,51,51,51,62,64,0,0,0,0,0,192,130,64,205,204,204,204,
+204,204,57,64,0,0,0,0,0,0,137,64,205,204,204,204,204,204,53,64,
+0,0,0,0,0,64,143,64,205,204,204,204,204,76,50,64,0,0,0,0,
+0,192,146,64,154,153,153,153,153,153,46,64,0,0,0,0,0,112,151,64,
+51,51,51,51,51,51,41,64,0,0,0,0,0,64,159,64,154,153,153,153,
+153,153,36,64,0,0,0,0,0,136,163,64,205,204,204,204,204,204,32,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,0,0,0,0,
+0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,0,0,24,64,
+0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,0,0,0,0,
+0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,0,56,163,64,
+0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,0,0,0,0,
+0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,0,64,144,64,
+0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,0,0,62,64,
+0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,0,96,123,64,
+0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,0,0,0,0,
+0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,0,0,78,64,
+0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,0,0,0,0,
+0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,0,32,103,64,
+0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,0,0,0,0,
+0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,0,0,94,64,
+0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,0,0,0,0,
+0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,0,64,81,64,
+0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,0,0,0,0,
+0,192,108,64,0,0,0,0,0,128,74,64,0,0,0,0,0,0,110,64,
+0,0,0,0,0,64,70,64,0,0,0,0,0,128,113,64,0,0,0,0,
+0,64,66,64,0,0,0,0,0,0,116,64,51,51,51,51,51,51,61,64,
+0,0,0,0,0,128,118,64,205,204,204,204,204,204,54,64,0,0,0,0,
+0,0,121,64,205,204,204,204,204,76,49,64,0,0,0,0,0,64,127,64,
+154,153,153,153,153,153,41,64,0,0,0,0,0,192,130,64,154,153,153,153,
+153,153,34,64,0,0,0,0,0,0,137,64,0,0,0,0,0,0,26,64,
+0,0,0,0,0,64,143,64,0,0,0,0,0,0,18,64,0,0,0,0,
+0,192,146,64,0,0,0,0,0,0,8,64,0,0,0,0,0,112,151,64,
+0,0,0,0,0,0,0,64,0,0,0,0,0,64,159,64,51,51,51,51,
+51,51,243,63,0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,
+0,0,0,0,0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,
+0,0,24,64,0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,
+0,0,0,0,0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,
+0,56,163,64,0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,
+0,0,0,0,0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,
+0,0,44,64,0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,
+0,0,0,0,0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,
+0,64,144,64,0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,
+0,0,0,0,0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,
+0,0,62,64,0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,
+0,0,0,0,0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,
+0,96,123,64,0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,
+0,0,0,0,0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,
+0,0,78,64,0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,
+0,0,0,0,0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,
+0,32,103,64,0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,
+0,0,0,0,0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,
+0,0,94,64,0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,
+0,0,0,0,0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,
+0,64,81,64,0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,
+0,0,0,0,0,0,110,64,0,0,0,0,0,0,73,64,0,0,0,0,
+0,128,113,64,0,0,0,0,0,192,67,64,0,0,0,0,0,0,116,64,
+0,0,0,0,0,128,61,64,0,0,0,0,0,128,118,64,0,0,0,0,
+0,0,55,64,0,0,0,0,0,0,121,64,0,0,0,0,0,64,50,64,
+0,0,0,0,0,64,127,64,205,204,204,204,204,204,43,64,0,0,0,0,
+0,192,130,64,154,153,153,153,153,25,37,64,0,0,0,0,0,0,137,64,
+154,153,153,153,153,153,30,64,0,0,0,0,0,64,143,64,51,51,51,51,
+51,51,23,64,0,0,0,0,0,192,146,64,102,102,102,102,102,102,14,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,26,179,64,0,0,0,0,
+0,0,20,64,0,0,0,0,0,29,176,64,0,0,0,0,0,0,24,64,
+0,0,0,0,0,8,171,64,0,0,0,0,0,0,28,64,0,0,0,0,
+0,168,166,64,0,0,0,0,0,0,32,64,0,0,0,0,0,56,163,64,
+0,0,0,0,0,0,36,64,0,0,0,0,0,74,160,64,0,0,0,0,
+0,0,40,64,0,0,0,0,0,148,155,64,0,0,0,0,0,0,44,64,
+0,0,0,0,0,248,150,64,0,0,0,0,0,0,48,64,0,0,0,0,
+0,56,147,64,0,0,0,0,0,0,52,64,0,0,0,0,0,64,144,64,
+0,0,0,0,0,0,54,64,0,0,0,0,0,168,139,64,0,0,0,0,
+0,0,56,64,0,0,0,0,0,72,135,64,0,0,0,0,0,0,62,64,
+0,0,0,0,0,136,131,64,0,0,0,0,0,0,66,64,0,0,0,0,
+0,104,128,64,0,0,0,0,0,0,68,64,0,0,0,0,0,96,123,64,
+0,0,0,0,0,0,71,64,0,0,0,0,0,32,119,64,0,0,0,0,
+0,0,75,64,0,0,0,0,0,96,115,64,0,0,0,0,0,0,78,64,
+0,0,0,0,0,64,112,64,0,0,0,0,0,128,81,64,0,0,0,0,
+0,64,107,64,0,0,0,0,0,0,84,64,0,0,0,0,0,32,103,64,
+0,0,0,0,0,128,86,64,0,0,0,0,0,64,99,64,0,0,0,0,
+0,0,89,64,0,0,0,0,0,32,96,64,0,0,0,0,0,0,94,64,
+0,0,0,0,0,64,91,64,0,0,0,0,0,192,98,64,0,0,0,0,
+0,128,84,64,0,0,0,0,0,128,102,64,0,0,0,0,0,64,81,64,
+0,0,0,0,0,128,107,64,0,0,0,0,0,0,77,64,0,0,0,0,
+0,0,110,64,0,0,0,0,0,0,73,64,0,0,0,0,0,128,113,64,
+0,0,0,0,0,192,67,64,0,0,0,0,0,0,116,64,0,0,0,0,
+0,128,61,64,0,0,0,0,0,128,118,64,0,0,0,0,0,0,55,64,
+0,0,0,0,0,0,121,64,0,0,0,0,0,64,50,64,0,0,0,0,
+0,64,127,64,205,204,204,204,204,204,43,64,0,0,0,0,0,192,130,64,
+154,153,153,153,153,25,37,64,0,0,0,0,0,0,137,64,0,0,0,0,
+0,0,39,64,0,0,0,0,0,64,143,64,0,0,0,0,0,0,35,64,
+0,0,0,0,0,64,159,64,205,204,204,204,204,204,28,64,0,0,0,0,
+0,136,163,64,0,0,0,0,0,0,22,64,0,0,0,0,0,112,167,64,
+0,0,0,0,0,0,16,64,0,0,0,0,0,64,175,64,0,0,0,0,
+0,0,8,64,0,0,0,0,0,112,183,64,0,0,0,0,0,0,0,64,
+0,0,0,0,0,64,191,64,51,51,51,51,51,51,243,63,0,0,0,0,
+0,192,98,64,0,0,0,0,0,192,82,64,0,0,0,0,0,128,102,64,
+0,0,0,0,0,128,79,64,0,0,0,0,0,128,107,64,0,0,0,0,
+0,128,74,64,0,0,0,0,0,128,113,64,0,0,0,0,0,0,72,64,
+0,0,0,0,0,0,116,64,0,0,0,0,0,0,68,64,0,0,0,0,
+0,128,118,64,0,0,0,0,0,128,65,64,0,0,0,0,0,0,121,64,
+0,0,0,0,0,0,62,64,0,0,0,0,0,192,130,64,0,0,0,0,
+0,0,52,64,0,0,0,0,0,224,133,64,0,0,0,0,0,0,49,64,
+0,0,0,0,0,0,137,64,0,0,0,0,0,0,44,64,0,0,0,0,
+0,64,143,64,0,0,0,0,0,0,39,64,0,0,0,0,0,192,146,64,
+0,0,0,0,0,0,35,64,0,0,0,0,0,112,151,64,0,0,0,0,
+0,0,32,64,0,0,0,0,0,64,159,64,205,204,204,204,204,204,26,64,
+0,0,0,0,0,136,163,64,0,0,0,0,0,0,22,64,0,0,0,0,
+0,112,167,64,0,0,0,0,0,0,16,64,0,0,0,0,0,64,175,64,
+0,0,0,0,0,0,8,64,0,0,0,0,0,112,183,64,0,0,0,0,
+0,0,0,64,0,0,0,0,0,64,191,64,51,51,51,51,51,51,243,63,
+0,0,0,0,0,0,48,64,154,153,153,153,153,153,46,64,0,0,0,0,
+0,0,57,64,205,204,204,204,204,204,53,64,0,0,0,0,0,0,62,64,
+154,153,153,153,153,153,55,64,0,0,0,0,0,128,65,64,0,0,0,0,
+0,192,57,64,0,0,0,0,0,128,70,64,0,0,0,0,0,128,65,64,
+0,0,0,0,0,0,78,64,154,153,153,153,153,25,71,64,0,0,0,0,
+0,64,80,64,0,0,0,0,0,192,74,64,0,0,0,0,0,192,82,64,
+0,0,0,0,0,64,77,64,0,0,0,0,0,128,86,64,0,0,0,0,
+0,64,80,64,0,0,0,0,0,128,91,64,0,0,0,0,0,128,83,64,
+0,0,0,0,0,64,96,64,0,0,0,0,0,64,87,64,0,0,0,0,
+0,0,100,64,0,0,0,0,0,192,95,64,0,0,0,0,0,0,105,64,
+0,0,0,0,0,128,99,64,255,255,255,255,201,9,0,0,56,0,0,0,
+72,0,0,0,200,156,0,0,56,0,0,0,72,161,0,0,86,218,0,0,
+222,9,0,0,72,190,0,0,72,0,0,0,40,92,1,0,56,0,0,0,
+168,96,1,0,30,182,1,0,224,9,0,0,168,125,1,0,72,0,0,0,
+168,27,2,0,56,0,0,0,40,32,2,0,0,0,0,0,5,146,2,0,
+0,0,0,0,148,98,3,0,0,0,0,0,86,249,232,75,0,0,0,0,
+107,103,0,33,0,107,105,108,111,103,114,97,109,0,107,103,0,115,0,33,
+0,115,101,99,111,110,100,0,115,0,109,0,33,0,109,101,116,101,114,0,
+109,0,65,0,33,0,97,109,112,101,114,101,0,65,0,97,109,112,0,97,
+109,112,101,114,101,0,99,100,0,33,0,99,97,110,100,101,108,97,0,99,
+100,0,109,111,108,0,33,0,109,111,108,101,0,109,111,108,0,75,0,33,
+0,107,101,108,118,105,110,0,75,0,114,97,100,105,97,110,0,33,100,105,
+109,101,110,115,105,111,110,108,101,115,115,0,115,114,0,33,100,105,109,101,
+110,115,105,111,110,108,101,115,115,0,115,116,101,114,97,100,105,97,110,0,
+115,114,0,85,83,36,0,33,0,98,105,116,0,33,0,111,110,101,0,49,
+0,116,119,111,0,50,0,100,111,117,98,108,101,0,50,0,99,111,117,112,
+108,101,0,50,0,116,104,114,101,101,0,51,0,116,114,105,112,108,101,0,
+51,0,102,111,117,114,0,52,0,113,117,97,100,114,117,112,108,101,0,52,
+0,102,105,118,101,0,53,0,113,117,105,110,116,117,112,108,101,0,53,0,
+115,105,120,0,54,0,115,101,118,101,110,0,55,0,101,105,103,104,116,0,
+56,0,110,105,110,101,0,57,0,116,101,110,0,49,48,0,101,108,101,118,
+101,110,0,49,49,0,116,119,101,108,118,101,0,49,50,0,116,104,105,114,
+116,101,101,110,0,49,51,0,102,111,117,114,116,101,101,110,0,49,52,0,
+102,105,102,116,101,101,110,0,49,53,0,115,105,120,116,101,101,110,0,49,
+54,0,115,101,118,101,110,116,101,101,110,0,49,55,0,101,105,103,104,116,
+101,101,110,0,49,56,0,110,105,110,101,116,101,101,110,0,49,57,0,116,
+119,101,110,116,121,0,50,48,0,116,104,105,114,116,121,0,51,48,0,102,
+111,114,116,121,0,52,48,0,102,105,102,116,121,0,53,48,0,115,105,120,
+116,121,0,54,48,0,115,101,118,101,110,116,121,0,55,48,0,101,105,103,
+104,116,121,0,56,48,0,110,105,110,101,116,121,0,57,48,0,104,117,110,
+100,114,101,100,0,49,48,48,0,116,104,111,117,115,97,110,100,0,49,48,
+48,48,0,109,105,108,108,105,111,110,0,49,101,54,0,115,104,111,114,116,
+98,105,108,108,105,111,110,0,49,101,57,0,115,104,111,114,116,116,114,105,
+108,108,105,111,110,0,49,101,49,50,0,115,104,111,114,116,113,117,97,100,
+114,105,108,108,105,111,110,0,49,101,49,53,0,115,104,111,114,116,113,117,
+105,110,116,105,108,108,105,111,110,0,49,101,49,56,0,115,104,111,114,116,
+115,101,120,116,105,108,108,105,111,110,0,49,101,50,49,0,115,104,111,114,
+116,115,101,112,116,105,108,108,105,111,110,0,49,101,50,52,0,115,104,111,
+114,116,111,99,116,105,108,108,105,111,110,0,49,101,50,55,0,115,104,111,
+114,116,110,111,110,105,108,108,105,111,110,0,49,101,51,48,0,115,104,111,
+114,116,110,111,118,101,110,116,105,108,108,105,111,110,0,115,104,111,114,116,
+110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,100,101,99,105,108,
+108,105,111,110,0,49,101,51,51,0,115,104,111,114,116,117,110,100,101,99,
+105,108,108,105,111,110,0,49,101,51,54,0,115,104,111,114,116,100,117,111,
+100,101,99,105,108,108,105,111,110,0,49,101,51,57,0,115,104,111,114,116,
+116,114,101,100,101,99,105,108,108,105,111,110,0,49,101,52,50,0,115,104,
+111,114,116,113,117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,
+0,49,101,52,53,0,115,104,111,114,116,113,117,105,110,100,101,99,105,108,
+108,105,111,110,0,49,101,52,56,0,115,104,111,114,116,115,101,120,100,101,
+99,105,108,108,105,111,110,0,49,101,53,49,0,115,104,111,114,116,115,101,
+112,116,101,110,100,101,99,105,108,108,105,111,110,0,49,101,53,52,0,115,
+104,111,114,116,111,99,116,111,100,101,99,105,108,108,105,111,110,0,49,101,
+53,55,0,115,104,111,114,116,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,49,101,54,48,0,115,104,111,114,116,118,105,103,105,110,116,105,
+108,108,105,111,110,0,49,101,54,51,0,99,101,110,116,105,108,108,105,111,
+110,0,49,101,51,48,51,0,103,111,111,103,111,108,0,49,101,49,48,48,
+0,108,111,110,103,98,105,108,108,105,111,110,0,109,105,108,108,105,111,110,
+94,50,0,108,111,110,103,116,114,105,108,108,105,111,110,0,109,105,108,108,
+105,111,110,94,51,0,108,111,110,103,113,117,97,100,114,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,52,0,108,111,110,103,113,117,105,110,
+116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,53,0,108,111,
+110,103,115,101,120,116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,
+94,54,0,108,111,110,103,115,101,112,116,105,108,108,105,111,110,0,109,105,
+108,108,105,111,110,94,55,0,108,111,110,103,111,99,116,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,56,0,108,111,110,103,110,111,110,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,57,0,108,111,110,103,
+110,111,118,101,110,116,105,108,108,105,111,110,0,108,111,110,103,110,111,110,
+105,108,108,105,111,110,0,108,111,110,103,100,101,99,105,108,108,105,111,110,
+0,109,105,108,108,105,111,110,94,49,48,0,108,111,110,103,117,110,100,101,
+99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,49,0,108,
+111,110,103,100,117,111,100,101,99,105,108,108,105,111,110,0,109,105,108,108,
+105,111,110,94,49,50,0,108,111,110,103,116,114,101,100,101,99,105,108,108,
+105,111,110,0,109,105,108,108,105,111,110,94,49,51,0,108,111,110,103,113,
+117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,0,109,105,108,
+108,105,111,110,94,49,52,0,108,111,110,103,113,117,105,110,100,101,99,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,53,0,108,111,110,
+103,115,101,120,100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,
+110,94,49,54,0,108,111,110,103,115,101,112,116,100,101,99,105,108,108,105,
+111,110,0,109,105,108,108,105,111,110,94,49,55,0,108,111,110,103,111,99,
+116,111,100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,
+49,56,0,108,111,110,103,110,111,118,101,109,100,101,99,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,49,57,0,108,111,110,103,118,105,103,
+105,110,116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,50,48,
+0,109,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,
+111,110,0,98,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,
+108,105,111,110,94,50,0,116,114,105,108,108,105,97,114,100,0,49,48,48,
+48,32,109,105,108,108,105,111,110,94,51,0,113,117,97,100,114,105,108,108,
+105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,52,0,
+113,117,105,110,116,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,
+108,108,105,111,110,94,53,0,115,101,120,116,105,108,108,105,97,114,100,0,
+49,48,48,48,32,109,105,108,108,105,111,110,94,54,0,115,101,112,116,105,
+108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,
+55,0,111,99,116,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,
+108,108,105,111,110,94,56,0,110,111,110,105,108,108,105,97,114,100,0,49,
+48,48,48,32,109,105,108,108,105,111,110,94,57,0,110,111,118,101,110,116,
+105,108,108,105,97,114,100,0,110,111,110,105,108,108,105,97,114,100,0,100,
+101,99,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,
+111,110,94,49,48,0,108,111,110,103,109,105,108,108,105,97,114,100,0,109,
+105,108,108,105,97,114,100,0,108,111,110,103,98,105,108,108,105,97,114,100,
+0,98,105,108,108,105,97,114,100,0,108,111,110,103,116,114,105,108,108,105,
+97,114,100,0,116,114,105,108,108,105,97,114,100,0,108,111,110,103,113,117,
+97,100,114,105,108,108,105,97,114,100,0,113,117,97,100,114,105,108,108,105,
+97,114,100,0,108,111,110,103,113,117,105,110,116,105,108,108,105,97,114,100,
+0,113,117,105,110,116,105,108,108,105,97,114,100,0,108,111,110,103,115,101,
+120,116,105,108,108,105,97,114,100,0,115,101,120,116,105,108,108,105,97,114,
+100,0,108,111,110,103,115,101,112,116,105,108,108,105,97,114,100,0,115,101,
+112,116,105,108,108,105,97,114,100,0,108,111,110,103,111,99,116,105,108,108,
+105,97,114,100,0,111,99,116,105,108,108,105,97,114,100,0,108,111,110,103,
+110,111,110,105,108,108,105,97,114,100,0,110,111,110,105,108,108,105,97,114,
+100,0,108,111,110,103,110,111,118,101,110,116,105,108,108,105,97,114,100,0,
+110,111,118,101,110,116,105,108,108,105,97,114,100,0,108,111,110,103,100,101,
+99,105,108,108,105,97,114,100,0,100,101,99,105,108,108,105,97,114,100,0,
+98,105,108,108,105,111,110,0,115,104,111,114,116,98,105,108,108,105,111,110,
+0,116,114,105,108,108,105,111,110,0,115,104,111,114,116,116,114,105,108,108,
+105,111,110,0,113,117,97,100,114,105,108,108,105,111,110,0,115,104,111,114,
+116,113,117,97,100,114,105,108,108,105,111,110,0,113,117,105,110,116,105,108,
+108,105,111,110,0,115,104,111,114,116,113,117,105,110,116,105,108,108,105,111,
+110,0,115,101,120,116,105,108,108,105,111,110,0,115,104,111,114,116,115,101,
+120,116,105,108,108,105,111,110,0,115,101,112,116,105,108,108,105,111,110,0,
+115,104,111,114,116,115,101,112,116,105,108,108,105,111,110,0,111,99,116,105,
+108,108,105,111,110,0,115,104,111,114,116,111,99,116,105,108,108,105,111,110,
+0,110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,110,111,110,105,
+108,108,105,111,110,0,110,111,118,101,110,116,105,108,108,105,111,110,0,115,
+104,111,114,116,110,111,118,101,110,116,105,108,108,105,111,110,0,100,101,99,
+105,108,108,105,111,110,0,115,104,111,114,116,100,101,99,105,108,108,105,111,
+110,0,117,110,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,117,
+110,100,101,99,105,108,108,105,111,110,0,100,117,111,100,101,99,105,108,108,
+105,111,110,0,115,104,111,114,116,100,117,111,100,101,99,105,108,108,105,111,
+110,0,116,114,101,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,
+116,114,101,100,101,99,105,108,108,105,111,110,0,113,117,97,116,116,117,111,
+114,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,113,117,97,116,
+116,117,111,114,100,101,99,105,108,108,105,111,110,0,113,117,105,110,100,101,
+99,105,108,108,105,111,110,0,115,104,111,114,116,113,117,105,110,100,101,99,
+105,108,108,105,111,110,0,115,101,120,100,101,99,105,108,108,105,111,110,0,
+115,104,111,114,116,115,101,120,100,101,99,105,108,108,105,111,110,0,115,101,
+112,116,101,110,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,115,
+101,112,116,101,110,100,101,99,105,108,108,105,111,110,0,111,99,116,111,100,
+101,99,105,108,108,105,111,110,0,115,104,111,114,116,111,99,116,111,100,101,
+99,105,108,108,105,111,110,0,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,115,104,111,114,116,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,118,105,103,105,110,116,105,108,108,105,111,110,0,115,104,111,114,
+116,118,105,103,105,110,116,105,108,108,105,111,110,0,110,101,119,116,111,110,
+0,107,103,32,109,32,47,32,115,94,50,0,78,0,110,101,119,116,111,110,
+0,112,97,115,99,97,108,0,78,47,109,94,50,0,80,97,0,112,97,115,
+99,97,108,0,106,111,117,108,101,0,78,32,109,0,74,0,106,111,117,108,
+101,0,119,97,116,116,0,74,47,115,0,87,0,119,97,116,116,0,99,111,
+117,108,111,109,98,0,65,32,115,0,67,0,99,111,117,108,111,109,98,0,
+118,111,108,116,0,87,47,65,0,86,0,118,111,108,116,0,111,104,109,0,
+86,47,65,0,115,105,101,109,101,110,115,0,65,47,86,0,83,0,115,105,
+101,109,101,110,115,0,102,97,114,97,100,0,67,47,86,0,70,0,102,97,
+114,97,100,0,119,101,98,101,114,0,86,32,115,0,87,98,0,119,101,98,
+101,114,0,104,101,110,114,121,0,87,98,47,65,0,72,0,104,101,110,114,
+121,0,116,101,115,108,97,0,87,98,47,109,94,50,0,84,0,116,101,115,
+108,97,0,104,101,114,116,122,0,47,115,0,72,122,0,104,101,114,116,122,
+0,76,69,78,71,84,72,0,109,101,116,101,114,0,65,82,69,65,0,76,
+69,78,71,84,72,94,50,0,86,79,76,85,77,69,0,76,69,78,71,84,
+72,94,51,0,77,65,83,83,0,107,105,108,111,103,114,97,109,0,67,85,
+82,82,69,78,84,0,97,109,112,101,114,101,0,65,77,79,85,78,84,0,
+109,111,108,101,0,65,78,71,76,69,0,114,97,100,105,97,110,0,83,79,
+76,73,68,95,65,78,71,76,69,0,115,116,101,114,97,100,105,97,110,0,
+77,79,78,69,89,0,85,83,36,0,70,79,82,67,69,0,110,101,119,116,
+111,110,0,80,82,69,83,83,85,82,69,0,70,79,82,67,69,32,47,32,
+65,82,69,65,0,83,84,82,69,83,83,0,70,79,82,67,69,32,47,32,
+65,82,69,65,0,67,72,65,82,71,69,0,99,111,117,108,111,109,98,0,
+67,65,80,65,67,73,84,65,78,67,69,0,102,97,114,97,100,0,82,69,
+83,73,83,84,65,78,67,69,0,111,104,109,0,67,79,78,68,85,67,84,
+65,78,67,69,0,115,105,101,109,101,110,115,0,73,78,68,85,67,84,65,
+78,67,69,0,104,101,110,114,121,0,70,82,69,81,85,69,78,67,89,0,
+104,101,114,116,122,0,86,69,76,79,67,73,84,89,0,76,69,78,71,84,
+72,32,47,32,84,73,77,69,0,65,67,67,69,76,69,82,65,84,73,79,
+78,0,86,69,76,79,67,73,84,89,32,47,32,84,73,77,69,0,68,69,
+78,83,73,84,89,0,77,65,83,83,32,47,32,86,79,76,85,77,69,0,
+76,73,78,69,65,82,95,68,69,78,83,73,84,89,0,77,65,83,83,32,
+47,32,76,69,78,71,84,72,0,86,73,83,67,79,83,73,84,89,0,70,
+79,82,67,69,32,84,73,77,69,32,47,32,65,82,69,65,0,75,73,78,
+69,77,65,84,73,67,95,86,73,83,67,79,83,73,84,89,0,86,73,83,
+67,79,83,73,84,89,32,47,32,68,69,78,83,73,84,89,0,103,114,97,
+109,0,109,105,108,108,105,107,103,0,103,109,0,103,114,97,109,0,103,0,
+103,114,97,109,0,116,111,110,110,101,0,49,48,48,48,32,107,103,0,116,
+0,116,111,110,110,101,0,109,101,116,114,105,99,116,111,110,0,116,111,110,
+110,101,0,115,116,104,101,110,101,0,116,111,110,110,101,32,109,32,47,32,
+115,94,50,0,102,117,110,97,108,0,115,116,104,101,110,101,0,112,105,101,
+122,101,0,115,116,104,101,110,101,32,47,32,109,94,50,0,113,117,105,110,
+116,97,108,0,49,48,48,32,107,103,0,98,97,114,0,49,101,53,32,80,
+97,0,118,97,99,0,109,105,108,108,105,98,97,114,0,109,105,99,114,111,
+110,0,109,105,99,114,111,109,101,116,101,114,0,98,105,99,114,111,110,0,
+112,105,99,111,109,101,116,101,114,0,99,99,0,99,109,94,51,0,97,114,
+101,0,49,48,48,32,109,94,50,0,108,105,116,101,114,0,49,48,48,48,
+32,99,99,0,111,108,100,108,105,116,101,114,0,49,46,48,48,48,48,50,
+56,32,100,109,94,51,0,108,0,108,105,116,101,114,0,76,0,108,105,116,
+101,114,0,109,104,111,0,115,105,101,109,101,110,115,0,103,97,108,118,97,
+116,0,97,109,112,101,114,101,0,97,110,103,115,116,114,111,109,0,49,101,
+45,49,48,32,109,0,120,117,110,105,116,0,49,46,48,48,50,48,50,101,
+45,49,51,32,109,101,116,101,114,0,115,105,101,103,98,97,104,110,0,120,
+117,110,105,116,0,102,101,114,109,105,0,49,101,45,49,53,32,109,0,98,
+97,114,110,0,49,101,45,50,56,32,109,94,50,0,115,104,101,100,0,49,
+101,45,50,52,32,98,97,114,110,0,98,114,101,119,115,116,101,114,0,109,
+105,99,114,111,110,94,50,47,78,0,100,105,111,112,116,101,114,0,47,109,
+0,102,114,101,115,110,101,108,0,49,101,49,50,32,72,122,0,115,104,97,
+107,101,0,49,101,45,56,32,115,101,99,0,115,118,101,100,98,101,114,103,
+0,49,101,45,49,51,32,115,0,103,97,109,109,97,0,109,105,99,114,111,
+103,114,97,109,0,108,97,109,98,100,97,0,109,105,99,114,111,108,105,116,
+101,114,0,115,112,97,116,0,49,101,49,50,32,109,0,112,114,101,101,99,
+101,0,49,101,49,51,32,111,104,109,32,109,0,112,108,97,110,99,107,0,
+74,32,115,0,115,116,117,114,103,101,111,110,0,47,104,101,110,114,121,0,
+100,97,114,97,102,0,49,47,102,97,114,97,100,0,108,101,111,0,49,48,
+32,109,47,115,94,50,0,112,111,105,115,101,117,105,108,108,101,0,78,32,
+115,32,47,32,109,94,50,0,109,97,121,101,114,0,74,47,103,32,75,0,
+109,105,114,101,100,0,47,32,109,105,99,114,111,75,0,99,114,111,99,111,
+100,105,108,101,0,109,101,103,97,118,111,108,116,0,109,101,116,114,105,99,
+111,117,110,99,101,0,50,53,32,103,0,109,111,117,110,99,101,0,109,101,
+116,114,105,99,111,117,110,99,101,0,102,105,110,115,101,110,117,110,105,116,
+0,49,101,53,32,87,47,109,94,50,0,102,108,117,120,117,110,105,116,0,
+49,101,45,50,54,32,87,47,109,94,50,32,72,122,0,106,97,110,115,107,
+121,0,102,108,117,120,117,110,105,116,0,74,121,0,106,97,110,115,107,121,
+0,112,102,117,0,47,32,99,109,94,50,32,115,114,32,115,0,112,121,114,
+111,110,0,99,97,108,95,73,84,32,47,32,99,109,94,50,32,109,105,110,
+0,107,97,116,97,108,0,109,111,108,47,115,101,99,0,107,97,116,0,107,
+97,116,97,108,0,115,101,99,0,115,0,109,105,110,117,116,101,0,54,48,
+32,115,0,109,105,110,0,109,105,110,117,116,101,0,104,111,117,114,0,54,
+48,32,109,105,110,0,104,114,0,104,111,117,114,0,100,97,121,0,50,52,
+32,104,114,0,100,0,100,97,121,0,100,97,0,100,97,121,0,119,101,101,
+107,0,55,32,100,97,121,0,119,107,0,119,101,101,107,0,115,101,110,110,
+105,103,104,116,0,55,32,100,97,121,0,102,111,114,116,110,105,103,104,116,
+0,49,52,32,100,97,121,0,98,108,105,110,107,0,49,101,45,53,32,100,
+97,121,0,99,101,0,49,101,45,50,32,100,97,121,0,99,114,111,110,0,
+49,101,54,32,121,101,97,114,115,0,119,97,116,99,104,0,52,32,104,111,
+117,114,115,0,98,101,108,108,0,49,124,56,32,119,97,116,99,104,0,99,
+105,114,99,108,101,0,50,32,112,105,32,114,97,100,105,97,110,0,100,101,
+103,114,101,101,0,49,124,51,54,48,32,99,105,114,99,108,101,0,100,101,
+103,0,100,101,103,114,101,101,0,97,114,99,100,101,103,0,100,101,103,114,
+101,101,0,97,114,99,109,105,110,0,49,124,54,48,32,100,101,103,114,101,
+101,0,97,114,99,109,105,110,117,116,101,0,97,114,99,109,105,110,0,39,
+0,97,114,99,109,105,110,0,97,114,99,115,101,99,0,49,124,54,48,32,
+97,114,99,109,105,110,0,97,114,99,115,101,99,111,110,100,0,97,114,99,
+115,101,99,0,34,0,97,114,99,115,101,99,0,39,39,0,34,0,114,105,
+103,104,116,97,110,103,108,101,0,57,48,32,100,101,103,114,101,101,115,0,
+113,117,97,100,114,97,110,116,0,49,124,52,32,99,105,114,99,108,101,0,
+113,117,105,110,116,97,110,116,0,49,124,53,32,99,105,114,99,108,101,0,
+115,101,120,116,97,110,116,0,49,124,54,32,99,105,114,99,108,101,0,115,
+105,103,110,0,49,124,49,50,32,99,105,114,99,108,101,0,116,117,114,110,
+0,99,105,114,99,108,101,0,114,101,118,111,108,117,116,105,111,110,0,116,
+117,114,110,0,114,101,118,0,116,117,114,110,0,112,117,108,115,97,116,97,
+110,99,101,0,114,97,100,105,97,110,32,47,32,115,101,99,0,103,111,110,
+0,49,124,49,48,48,32,114,105,103,104,116,97,110,103,108,101,0,103,114,
+97,100,101,0,103,111,110,0,99,101,110,116,101,115,105,109,97,108,109,105,
+110,117,116,101,0,49,124,49,48,48,32,103,114,97,100,101,0,99,101,110,
+116,101,115,105,109,97,108,115,101,99,111,110,100,0,49,124,49,48,48,32,
+99,101,110,116,101,115,105,109,97,108,109,105,110,117,116,101,0,109,105,108,
+97,110,103,108,101,0,49,124,54,52,48,48,32,99,105,114,99,108,101,0,
+112,111,105,110,116,97,110,103,108,101,0,49,124,51,50,32,99,105,114,99,
+108,101,0,99,101,110,116,114,97,100,0,48,46,48,49,32,114,97,100,105,
+97,110,0,109,97,115,0,109,105,108,108,105,32,97,114,99,115,101,99,0,
+115,101,99,108,111,110,103,105,116,117,100,101,0,99,105,114,99,108,101,32,
+40,115,101,99,111,110,100,115,47,100,97,121,41,0,115,112,104,101,114,101,
+0,52,32,112,105,32,115,114,0,115,113,117,97,114,101,100,101,103,114,101,
+101,0,49,124,49,56,48,94,50,32,112,105,94,50,32,115,114,0,115,113,
+117,97,114,101,109,105,110,117,116,101,0,49,124,54,48,94,50,32,115,113,
+117,97,114,101,100,101,103,114,101,101,0,115,113,117,97,114,101,115,101,99,
+111,110,100,0,49,124,54,48,94,50,32,115,113,117,97,114,101,109,105,110,
+117,116,101,0,115,113,117,97,114,101,97,114,99,109,105,110,0,115,113,117,
+97,114,101,109,105,110,117,116,101,0,115,113,117,97,114,101,97,114,99,115,
+101,99,0,115,113,117,97,114,101,115,101,99,111,110,100,0,115,112,104,101,
+114,105,99,97,108,114,105,103,104,116,97,110,103,108,101,0,48,46,53,32,
+112,105,32,115,114,0,111,99,116,97,110,116,0,48,46,53,32,112,105,32,
+115,114,0,112,101,114,99,101,110,116,0,48,46,48,49,0,37,0,112,101,
+114,99,101,110,116,0,109,105,108,108,0,48,46,48,48,49,0,112,114,111,
+111,102,0,49,124,50,48,48,0,112,112,109,0,49,101,45,54,0,112,97,
+114,116,115,112,101,114,109,105,108,108,105,111,110,0,112,112,109,0,112,112,
+98,0,49,101,45,57,0,112,97,114,116,115,112,101,114,98,105,108,108,105,
+111,110,0,112,112,98,0,112,112,116,0,49,101,45,49,50,0,112,97,114,
+116,115,112,101,114,116,114,105,108,108,105,111,110,0,112,112,116,0,107,97,
+114,97,116,0,49,124,50,52,0,99,97,114,97,116,103,111,108,100,0,107,
+97,114,97,116,0,103,97,109,109,105,108,0,109,103,47,108,0,98,97,115,
+105,115,112,111,105,110,116,0,48,46,48,49,32,37,0,102,105,110,101,0,
+49,124,49,48,48,48,0,84,69,77,80,69,82,65,84,85,82,69,0,107,
+101,108,118,105,110,0,84,69,77,80,69,82,65,84,85,82,69,95,68,73,
+70,70,69,82,69,78,67,69,0,107,101,108,118,105,110,0,100,101,103,99,
+101,108,115,105,117,115,0,75,0,100,101,103,67,0,75,0,100,101,103,102,
+97,104,114,101,110,104,101,105,116,0,53,124,57,32,100,101,103,67,0,100,
+101,103,70,0,53,124,57,32,100,101,103,67,0,100,101,103,114,101,101,115,
+114,97,110,107,105,110,101,0,100,101,103,70,0,100,101,103,114,97,110,107,
+105,110,101,0,100,101,103,114,101,101,115,114,97,110,107,105,110,101,0,100,
+101,103,114,101,101,114,97,110,107,105,110,101,0,100,101,103,70,0,100,101,
+103,82,0,100,101,103,114,97,110,107,105,110,101,0,116,101,109,112,82,0,
+100,101,103,114,97,110,107,105,110,101,0,116,101,109,112,114,97,110,107,105,
+110,101,0,100,101,103,114,97,110,107,105,110,101,0,100,101,103,114,101,97,
+117,109,117,114,0,49,48,124,56,32,100,101,103,67,0,100,101,103,75,0,
+75,0,116,101,109,112,75,0,75,0,112,105,0,51,46,49,52,49,53,57,
+50,54,53,51,53,56,57,55,57,51,50,51,56,52,54,0,99,0,50,46,
+57,57,55,57,50,52,53,56,101,56,32,109,47,115,0,108,105,103,104,116,
+0,99,0,109,117,48,0,52,32,112,105,32,49,101,45,55,32,72,47,109,
+0,101,112,115,105,108,111,110,48,0,49,47,109,117,48,32,99,94,50,0,
+101,110,101,114,103,121,0,99,94,50,0,101,0,49,46,54,48,50,49,55,
+54,52,56,55,101,45,49,57,32,67,0,104,0,54,46,54,50,54,48,54,
+56,57,54,101,45,51,52,32,74,32,115,0,104,98,97,114,0,104,32,47,
+32,50,32,112,105,0,115,112,105,110,0,104,98,97,114,0,71,0,54,46,
+54,55,52,50,56,101,45,49,49,32,78,32,109,94,50,32,47,32,107,103,
+94,50,0,99,111,117,108,111,109,98,99,111,110,115,116,0,49,47,52,32,
+112,105,32,101,112,115,105,108,111,110,48,0,97,116,111,109,105,99,109,97,
+115,115,117,110,105,116,0,49,46,54,54,48,53,51,56,55,56,50,101,45,
+50,55,32,107,103,0,117,0,97,116,111,109,105,99,109,97,115,115,117,110,
+105,116,0,97,109,117,0,97,116,111,109,105,99,109,97,115,115,117,110,105,
+116,0,97,109,117,95,99,104,101,109,0,49,46,54,54,48,50,54,101,45,
+50,55,32,107,103,0,97,109,117,95,112,104,121,115,0,49,46,54,53,57,
+56,49,101,45,50,55,32,107,103,0,100,97,108,116,111,110,0,117,0,97,
+118,111,103,97,100,114,111,0,103,114,97,109,115,47,97,109,117,32,109,111,
+108,0,78,95,65,0,97,118,111,103,97,100,114,111,0,103,97,115,99,111,
+110,115,116,97,110,116,0,56,46,51,49,52,52,55,50,32,74,32,47,32,
+109,111,108,32,75,0,82,0,103,97,115,99,111,110,115,116,97,110,116,0,
+98,111,108,116,122,109,97,110,110,0,82,32,47,32,78,95,65,0,107,0,
+98,111,108,116,122,109,97,110,110,0,107,98,111,108,116,122,109,97,110,110,
+0,98,111,108,116,122,109,97,110,110,0,109,111,108,97,114,118,111,108,117,
+109,101,0,109,111,108,32,82,32,115,116,100,116,101,109,112,32,47,32,97,
+116,109,0,108,111,115,99,104,109,105,100,116,0,97,118,111,103,97,100,114,
+111,32,109,111,108,32,47,32,109,111,108,97,114,118,111,108,117,109,101,0,
+115,116,101,102,97,110,98,111,108,116,122,109,97,110,110,0,112,105,94,50,
+32,107,94,52,32,47,32,54,48,32,104,98,97,114,94,51,32,99,94,50,
+0,115,105,103,109,97,0,115,116,101,102,97,110,98,111,108,116,122,109,97,
+110,110,0,119,105,101,110,100,105,115,112,108,97,99,101,109,101,110,116,0,
+50,46,56,57,55,55,54,56,53,101,45,51,32,109,32,75,0,75,95,74,
+0,52,56,51,53,57,55,46,57,32,71,72,122,47,86,0,82,95,75,0,
+50,53,56,49,50,46,56,48,55,32,111,104,109,0,103,114,97,118,105,116,
+121,0,57,46,56,48,54,54,53,32,109,47,115,94,50,0,102,111,114,99,
+101,0,103,114,97,118,105,116,121,0,97,116,109,0,49,48,49,51,50,53,
+32,80,97,0,97,116,109,111,115,112,104,101,114,101,0,97,116,109,0,72,
+103,0,49,51,46,53,57,53,49,32,103,114,97,109,32,102,111,114,99,101,
+32,47,32,99,109,94,51,0,119,97,116,101,114,0,103,114,97,109,32,102,
+111,114,99,101,47,99,109,94,51,0,119,97,116,101,114,100,101,110,115,105,
+116,121,0,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,0,119,
+97,116,101,114,0,119,99,0,119,97,116,101,114,0,109,97,99,104,0,51,
+51,49,46,52,54,32,109,47,115,0,115,116,97,110,100,97,114,100,116,101,
+109,112,0,50,55,51,46,49,53,32,75,0,115,116,100,116,101,109,112,0,
+115,116,97,110,100,97,114,100,116,101,109,112,0,72,103,49,48,67,0,49,
+51,46,53,55,48,56,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,103,50,48,67,0,49,51,46,53,52,54,50,32,102,
+111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,50,
+51,67,0,49,51,46,53,51,56,54,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,103,51,48,67,0,49,51,46,53,50,
+49,55,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,103,52,48,67,0,49,51,46,52,57,55,51,32,102,111,114,99,101,
+32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,54,48,70,0,49,
+51,46,53,53,55,52,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,50,79,48,67,0,48,46,57,57,57,56,55,32,102,
+111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,
+53,67,0,48,46,57,57,57,57,57,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,50,79,49,48,67,0,48,46,57,57,
+57,55,51,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,
+51,0,72,50,79,49,53,67,0,48,46,57,57,57,49,51,32,102,111,114,
+99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,49,56,
+67,0,48,46,57,57,56,54,50,32,102,111,114,99,101,32,103,114,97,109,
+32,47,32,99,109,94,51,0,72,50,79,50,48,67,0,48,46,57,57,56,
+50,51,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,50,79,50,53,67,0,48,46,57,57,55,48,55,32,102,111,114,99,
+101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,53,48,67,
+0,48,46,57,56,56,48,55,32,102,111,114,99,101,32,103,114,97,109,32,
+47,32,99,109,94,51,0,72,50,79,49,48,48,67,0,48,46,57,53,56,
+51,56,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,82,105,110,102,105,110,105,116,121,0,49,48,57,55,51,55,51,49,46,
+53,54,56,53,50,55,32,47,109,0,82,95,72,0,49,48,57,54,55,55,
+54,48,32,47,109,0,97,108,112,104,97,0,55,46,50,57,55,51,53,50,
+53,51,55,54,101,45,51,0,98,111,104,114,114,97,100,105,117,115,0,97,
+108,112,104,97,32,47,32,52,32,112,105,32,82,105,110,102,105,110,105,116,
+121,0,112,114,111,117,116,0,49,56,53,46,53,32,107,101,86,0,112,108,
+97,110,99,107,109,97,115,115,0,50,46,49,55,54,52,52,101,45,56,32,
+107,103,0,109,95,80,0,112,108,97,110,99,107,109,97,115,115,0,112,108,
+97,110,99,107,116,105,109,101,0,104,98,97,114,32,47,32,112,108,97,110,
+99,107,109,97,115,115,32,99,94,50,0,116,95,80,0,112,108,97,110,99,
+107,116,105,109,101,0,112,108,97,110,99,107,108,101,110,103,116,104,0,112,
+108,97,110,99,107,116,105,109,101,32,99,0,108,95,80,0,112,108,97,110,
+99,107,108,101,110,103,116,104,0,101,108,101,99,116,114,111,110,109,97,115,
+115,0,53,46,52,56,53,55,57,57,48,57,52,51,101,45,52,32,117,0,
+109,95,101,0,101,108,101,99,116,114,111,110,109,97,115,115,0,112,114,111,
+116,111,110,109,97,115,115,0,49,46,48,48,55,50,55,54,52,54,54,55,
+55,32,117,0,109,95,112,0,112,114,111,116,111,110,109,97,115,115,0,110,
+101,117,116,114,111,110,109,97,115,115,0,49,46,48,48,56,54,54,52,57,
+49,53,57,55,32,117,0,109,95,110,0,110,101,117,116,114,111,110,109,97,
+115,115,0,109,117,111,110,109,97,115,115,0,48,46,49,49,51,52,50,56,
+57,50,53,54,32,117,0,109,95,109,117,0,109,117,111,110,109,97,115,115,
+0,100,101,117,116,101,114,111,110,109,97,115,115,0,50,46,48,49,51,53,
+53,51,50,49,50,55,50,52,32,117,0,109,95,100,0,100,101,117,116,101,
+114,111,110,109,97,115,115,0,97,108,112,104,97,112,97,114,116,105,99,108,
+101,109,97,115,115,0,52,46,48,48,49,53,48,54,49,55,57,49,50,55,
+32,117,0,109,95,97,108,112,104,97,0,97,108,112,104,97,112,97,114,116,
+105,99,108,101,109,97,115,115,0,101,108,101,99,116,114,111,110,119,97,118,
+101,108,101,110,103,116,104,0,104,32,47,32,109,95,101,32,99,0,108,97,
+109,98,100,97,95,67,0,101,108,101,99,116,114,111,110,119,97,118,101,108,
+101,110,103,116,104,0,112,114,111,116,111,110,119,97,118,101,108,101,110,103,
+116,104,0,104,32,47,32,109,95,112,32,99,0,108,97,109,98,100,97,95,
+67,44,112,0,112,114,111,116,111,110,119,97,118,101,108,101,110,103,116,104,
+0,110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,116,104,0,104,
+32,47,32,109,95,110,32,99,0,108,97,109,98,100,97,95,67,44,110,0,
+110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,116,104,0,98,111,
+104,114,109,97,103,110,101,116,111,110,0,101,32,104,98,97,114,32,47,32,
+50,32,101,108,101,99,116,114,111,110,109,97,115,115,0,109,117,95,66,0,
+98,111,104,114,109,97,103,110,101,116,111,110,0,110,117,99,108,101,97,114,
+109,97,103,110,101,116,111,110,0,101,32,104,98,97,114,32,47,32,32,50,
+32,112,114,111,116,111,110,109,97,115,115,0,109,117,95,78,0,110,117,99,
+108,101,97,114,109,97,103,110,101,116,111,110,0,109,117,95,109,117,0,52,
+46,52,57,48,52,52,55,56,54,101,45,50,54,32,74,47,84,0,109,117,
+95,112,0,49,46,52,49,48,54,48,54,54,54,50,101,45,50,54,32,74,
+47,84,0,109,117,95,101,0,57,50,56,46,52,55,54,51,55,55,101,45,
+50,54,32,74,47,84,0,109,117,95,110,0,48,46,57,54,54,50,51,54,
+52,49,101,45,50,54,32,74,47,84,0,109,117,95,100,0,48,46,52,51,
+51,48,55,51,52,54,53,101,45,50,54,32,74,47,84,0,107,103,102,0,
+107,103,32,102,111,114,99,101,0,116,101,99,104,110,105,99,97,108,97,116,
+109,111,115,112,104,101,114,101,0,107,103,102,32,47,32,99,109,94,50,0,
+97,116,0,116,101,99,104,110,105,99,97,108,97,116,109,111,115,112,104,101,
+114,101,0,104,121,108,0,107,103,102,32,115,94,50,32,47,32,109,0,109,
+109,72,103,0,109,109,32,72,103,0,116,111,114,114,0,109,109,72,103,0,
+116,111,114,0,80,97,0,105,110,72,103,0,105,110,99,104,32,72,103,0,
+105,110,72,50,79,0,105,110,99,104,32,119,97,116,101,114,0,109,109,72,
+50,79,0,109,109,32,119,97,116,101,114,0,101,86,0,101,32,86,0,101,
+108,101,99,116,114,111,110,118,111,108,116,0,101,86,0,108,105,103,104,116,
+121,101,97,114,0,99,32,106,117,108,105,97,110,121,101,97,114,0,108,121,
+0,108,105,103,104,116,121,101,97,114,0,108,105,103,104,116,115,101,99,111,
+110,100,0,99,32,115,0,108,105,103,104,116,109,105,110,117,116,101,0,99,
+32,109,105,110,0,112,97,114,115,101,99,0,97,117,32,47,32,116,97,110,
+40,97,114,99,115,101,99,41,0,112,99,0,112,97,114,115,101,99,0,114,
+121,100,98,101,114,103,0,104,32,99,32,82,105,110,102,105,110,105,116,121,
+0,99,114,105,116,104,0,48,46,48,56,57,56,56,53,32,103,114,97,109,
+0,97,109,97,103,97,116,118,111,108,117,109,101,0,109,111,108,97,114,118,
+111,108,117,109,101,0,97,109,97,103,97,116,0,109,111,108,47,97,109,97,
+103,97,116,118,111,108,117,109,101,0,108,111,114,101,110,116,122,0,98,111,
+104,114,109,97,103,110,101,116,111,110,32,47,32,104,32,99,0,99,109,105,
+110,118,0,104,32,99,32,47,32,99,109,0,105,110,118,99,109,0,99,109,
+105,110,118,0,119,97,118,101,110,117,109,98,101,114,0,99,109,105,110,118,
+0,107,99,97,108,95,109,111,108,0,107,99,97,108,95,116,104,32,47,32,
+109,111,108,32,78,95,65,0,100,121,110,101,0,99,109,32,103,114,97,109,
+32,47,32,115,94,50,0,100,121,110,0,100,121,110,101,0,101,114,103,0,
+99,109,32,100,121,110,101,0,112,111,105,115,101,0,103,114,97,109,32,47,
+32,99,109,32,115,0,80,0,112,111,105,115,101,0,114,104,101,0,47,112,
+111,105,115,101,0,115,116,111,107,101,115,0,99,109,94,50,32,47,32,115,
+0,83,116,0,115,116,111,107,101,115,0,115,116,111,107,101,0,115,116,111,
+107,101,115,0,108,101,110,116,111,114,0,115,116,111,107,101,115,0,71,97,
+108,0,99,109,32,47,32,115,94,50,0,103,97,108,105,108,101,111,0,71,
+97,108,0,98,97,114,121,101,0,100,121,110,101,47,99,109,94,50,0,98,
+97,114,97,100,0,98,97,114,121,101,0,107,97,121,115,101,114,0,49,47,
+99,109,0,98,97,108,109,101,114,0,107,97,121,115,101,114,0,107,105,110,
+101,0,99,109,47,115,0,98,111,108,101,0,103,32,99,109,32,47,32,115,
+0,112,111,110,100,0,103,114,97,109,32,102,111,114,99,101,0,103,108,117,
+103,0,103,114,97,109,32,102,111,114,99,101,32,115,94,50,32,47,32,99,
+109,0,100,97,114,99,121,0,99,101,110,116,105,112,111,105,115,101,32,99,
+109,94,50,32,47,32,115,32,97,116,109,0,109,111,104,109,0,99,109,32,
+47,32,100,121,110,32,115,0,109,111,98,105,108,101,111,104,109,0,109,111,
+104,109,0,109,101,99,104,97,110,105,99,97,108,111,104,109,0,100,121,110,
+32,115,32,47,32,99,109,0,97,99,111,117,115,116,105,99,97,108,111,104,
+109,0,100,121,110,32,115,32,47,32,99,109,94,53,0,114,97,121,0,97,
+99,111,117,115,116,105,99,97,108,111,104,109,0,114,97,121,108,0,100,121,
+110,32,115,32,47,32,99,109,94,51,0,101,111,116,118,111,115,0,49,101,
+45,57,32,71,97,108,47,99,109,0,97,98,97,109,112,101,114,101,0,49,
+48,32,65,0,97,98,97,109,112,0,97,98,97,109,112,101,114,101,0,97,
+65,0,97,98,97,109,112,101,114,101,0,98,105,111,116,0,97,65,0,66,
+105,0,98,105,111,116,0,97,98,99,111,117,108,111,109,98,0,97,98,97,
+109,112,32,115,101,99,0,97,98,99,111,117,108,0,97,98,99,111,117,108,
+111,109,98,0,97,98,102,97,114,97,100,0,97,98,97,109,112,101,114,101,
+32,115,101,99,32,47,32,97,98,118,111,108,116,0,97,98,104,101,110,114,
+121,0,97,98,118,111,108,116,32,115,101,99,32,47,32,97,98,97,109,112,
+0,97,98,118,111,108,116,0,100,121,110,101,32,99,109,32,32,47,32,97,
+98,97,109,112,32,115,101,99,0,97,98,111,104,109,0,97,98,118,111,108,
+116,32,47,32,97,98,97,109,112,0,97,98,109,104,111,0,47,97,98,111,
+104,109,0,103,97,117,115,115,0,97,98,118,111,108,116,32,115,101,99,32,
+47,32,99,109,94,50,0,71,115,0,103,97,117,115,115,0,109,97,120,119,
+101,108,108,0,97,98,118,111,108,116,32,115,101,99,0,77,120,0,109,97,
+120,119,101,108,108,0,111,101,114,115,116,101,100,0,103,97,117,115,115,32,
+47,32,109,117,48,0,79,101,0,111,101,114,115,116,101,100,0,103,105,108,
+98,101,114,116,0,103,97,117,115,115,32,99,109,32,47,32,109,117,48,0,
+71,98,0,103,105,108,98,101,114,116,0,71,105,0,103,105,108,98,101,114,
+116,0,117,110,105,116,112,111,108,101,0,52,32,112,105,32,109,97,120,119,
+101,108,108,0,101,109,117,0,101,114,103,47,103,97,117,115,115,0,115,116,
+97,116,97,109,112,101,114,101,0,49,48,32,65,32,99,109,32,47,32,115,
+32,99,0,115,116,97,116,97,109,112,0,115,116,97,116,97,109,112,101,114,
+101,0,115,116,97,116,118,111,108,116,0,100,121,110,101,32,99,109,32,47,
+32,115,116,97,116,97,109,112,32,115,101,99,0,115,116,97,116,99,111,117,
+108,111,109,98,0,115,116,97,116,97,109,112,32,115,0,101,115,117,0,115,
+116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,99,111,117,108,0,
+115,116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,102,97,114,97,
+100,0,115,116,97,116,97,109,112,32,115,101,99,32,47,32,115,116,97,116,
+118,111,108,116,0,99,109,99,97,112,97,99,105,116,97,110,99,101,0,115,
+116,97,116,102,97,114,97,100,0,115,116,97,116,104,101,110,114,121,0,115,
+116,97,116,118,111,108,116,32,115,101,99,32,47,32,115,116,97,116,97,109,
+112,0,115,116,97,116,111,104,109,0,115,116,97,116,118,111,108,116,32,47,
+32,115,116,97,116,97,109,112,0,115,116,97,116,109,104,111,0,47,115,116,
+97,116,111,104,109,0,115,116,97,116,109,97,120,119,101,108,108,0,115,116,
+97,116,118,111,108,116,32,115,101,99,0,102,114,97,110,107,108,105,110,0,
+115,116,97,116,99,111,117,108,111,109,98,0,100,101,98,121,101,0,49,101,
+45,49,56,32,115,116,97,116,99,111,117,108,32,99,109,0,104,101,108,109,
+104,111,108,116,122,0,100,101,98,121,101,47,97,110,103,115,116,114,111,109,
+94,50,0,106,97,114,0,49,48,48,48,32,115,116,97,116,102,97,114,97,
+100,0,105,110,116,97,109,112,101,114,101,0,48,46,57,57,57,56,51,53,
+32,65,0,105,110,116,97,109,112,0,105,110,116,97,109,112,101,114,101,0,
+105,110,116,102,97,114,97,100,0,48,46,57,57,57,53,48,53,32,70,0,
+105,110,116,118,111,108,116,0,49,46,48,48,48,51,51,32,86,0,105,110,
+116,111,104,109,0,49,46,48,48,48,52,57,53,32,111,104,109,0,100,97,
+110,105,101,108,108,0,49,46,48,52,50,32,86,0,102,97,114,97,100,97,
+121,0,78,95,65,32,101,32,109,111,108,0,102,97,114,97,100,97,121,95,
+112,104,121,115,0,57,54,53,50,49,46,57,32,67,0,102,97,114,97,100,
+97,121,95,99,104,101,109,0,57,54,52,57,53,46,55,32,67,0,107,97,
+112,112,108,105,110,101,0,54,48,48,48,32,109,97,120,119,101,108,108,0,
+115,105,101,109,101,110,115,117,110,105,116,0,48,46,57,53,51,52,32,111,
+104,109,0,76,85,77,73,78,79,85,83,95,73,78,84,69,78,83,73,84,
+89,0,99,97,110,100,101,108,97,0,76,85,77,73,78,79,85,83,95,70,
+76,85,88,0,108,117,109,101,110,0,76,85,77,73,78,79,85,83,95,69,
+78,69,82,71,89,0,116,97,108,98,111,116,0,73,76,76,85,77,73,78,
+65,78,67,69,0,108,117,120,0,69,88,73,84,65,78,67,69,0,108,117,
+120,0,99,97,110,100,108,101,0,49,46,48,50,32,99,97,110,100,101,108,
+97,0,104,101,102,110,101,114,117,110,105,116,0,48,46,57,32,99,97,110,
+100,108,101,0,104,101,102,110,101,114,99,97,110,100,108,101,0,104,101,102,
+110,101,114,117,110,105,116,0,118,105,111,108,108,101,0,50,48,46,49,55,
+32,99,100,0,108,117,109,101,110,0,99,100,32,115,114,0,108,109,0,108,
+117,109,101,110,0,116,97,108,98,111,116,0,108,117,109,101,110,32,115,0,
+108,117,109,98,101,114,103,0,116,97,108,98,111,116,0,108,117,109,101,114,
+103,0,116,97,108,98,111,116,0,108,117,120,0,108,109,47,109,94,50,0,
+108,120,0,108,117,120,0,112,104,111,116,0,108,117,109,101,110,32,47,32,
+99,109,94,50,0,112,104,0,112,104,111,116,0,102,111,111,116,99,97,110,
+100,108,101,0,108,117,109,101,110,47,102,116,94,50,0,109,101,116,101,114,
+99,97,110,100,108,101,0,108,117,109,101,110,47,109,94,50,0,109,99,115,
+0,109,101,116,101,114,99,97,110,100,108,101,32,115,0,110,111,120,0,49,
+101,45,51,32,108,117,120,0,115,107,111,116,0,49,101,45,51,32,97,112,
+111,115,116,105,108,98,0,76,85,77,73,78,65,78,67,69,0,110,105,116,
+0,110,105,116,0,99,100,47,109,94,50,0,115,116,105,108,98,0,99,100,
+32,47,32,99,109,94,50,0,115,98,0,115,116,105,108,98,0,97,112,111,
+115,116,105,108,98,0,99,100,47,112,105,32,109,94,50,0,97,115,98,0,
+97,112,111,115,116,105,108,98,0,98,108,111,110,100,101,108,0,97,112,111,
+115,116,105,108,98,0,101,113,117,105,118,97,108,101,110,116,108,117,120,0,
+99,100,32,47,32,112,105,32,109,94,50,0,101,113,117,105,118,97,108,101,
+110,116,112,104,111,116,0,99,100,32,47,32,112,105,32,99,109,94,50,0,
+108,97,109,98,101,114,116,0,99,100,32,47,32,112,105,32,99,109,94,50,
+0,102,111,111,116,108,97,109,98,101,114,116,0,99,100,32,47,32,112,105,
+32,102,116,94,50,0,115,117,110,108,117,109,0,49,46,54,101,57,32,99,
+100,47,109,94,50,0,115,117,110,105,108,108,117,109,0,49,48,48,101,51,
+32,108,117,120,0,115,117,110,105,108,108,117,109,95,111,0,49,48,101,51,
+32,108,117,120,0,115,117,110,108,117,109,95,104,0,54,101,54,32,99,100,
+47,109,94,50,0,115,107,121,108,117,109,0,56,48,48,48,32,99,100,47,
+109,94,50,0,115,107,121,108,117,109,95,111,0,50,48,48,48,32,99,100,
+47,109,94,50,0,109,111,111,110,108,117,109,0,50,53,48,48,32,99,100,
+47,109,94,50,0,115,49,48,48,0,54,52,32,42,32,50,94,40,50,124,
+51,41,32,47,32,108,120,32,115,0,107,49,50,53,48,0,49,50,46,53,
+32,40,99,100,47,109,50,41,32,47,32,108,120,32,115,0,107,49,52,48,
+48,0,49,52,32,32,32,40,99,100,47,109,50,41,32,47,32,108,120,32,
+115,0,99,50,53,48,0,50,53,48,32,108,120,32,47,32,108,120,32,115,
+0,84,73,77,69,0,115,101,99,111,110,100,0,97,110,111,109,97,108,105,
+115,116,105,99,121,101,97,114,0,51,54,53,46,50,53,57,54,32,100,97,
+121,115,0,115,105,100,101,114,101,97,108,121,101,97,114,0,51,54,53,46,
+50,53,54,51,54,48,52,49,55,32,100,97,121,0,116,114,111,112,105,99,
+97,108,121,101,97,114,0,51,54,53,46,50,52,50,49,57,56,55,56,49,
+32,100,97,121,0,101,99,108,105,112,115,101,121,101,97,114,0,51,52,54,
+46,54,50,32,100,97,121,115,0,115,97,114,111,115,0,50,50,51,32,115,
+121,110,111,100,105,99,109,111,110,116,104,0,115,105,100,101,114,101,97,108,
+100,97,121,0,56,54,49,54,52,46,48,57,48,53,52,32,115,0,115,105,
+100,101,114,101,97,108,104,111,117,114,0,49,124,50,52,32,115,105,100,101,
+114,101,97,108,100,97,121,0,115,105,100,101,114,101,97,108,109,105,110,117,
+116,101,0,49,124,54,48,32,115,105,100,101,114,101,97,108,104,111,117,114,
+0,115,105,100,101,114,101,97,108,115,101,99,111,110,100,0,49,124,54,48,
+32,115,105,100,101,114,101,97,108,109,105,110,117,116,101,0,97,110,111,109,
+97,108,105,115,116,105,99,109,111,110,116,104,0,50,55,46,53,53,52,53,
+52,57,55,55,32,100,97,121,0,110,111,100,105,99,97,108,109,111,110,116,
+104,0,50,55,46,50,49,50,50,49,57,57,32,100,97,121,0,100,114,97,
+99,111,110,105,99,109,111,110,116,104,0,110,111,100,105,99,97,108,109,111,
+110,116,104,0,100,114,97,99,111,110,105,116,105,99,109,111,110,116,104,0,
+110,111,100,105,99,97,108,109,111,110,116,104,0,115,105,100,101,114,101,97,
+108,109,111,110,116,104,0,50,55,46,51,50,49,54,54,49,32,100,97,121,
+0,108,117,110,97,114,109,111,110,116,104,0,50,57,32,100,97,121,115,32,
+43,32,49,50,32,104,111,117,114,115,32,43,32,52,52,32,109,105,110,117,
+116,101,115,32,43,32,50,46,56,32,115,101,99,111,110,100,115,0,115,121,
+110,111,100,105,99,109,111,110,116,104,0,108,117,110,97,114,109,111,110,116,
+104,0,108,117,110,97,116,105,111,110,0,115,121,110,111,100,105,99,109,111,
+110,116,104,0,108,117,110,101,0,49,124,51,48,32,108,117,110,97,116,105,
+111,110,0,108,117,110,111,117,114,0,49,124,50,52,32,108,117,110,101,0,
+121,101,97,114,0,116,114,111,112,105,99,97,108,121,101,97,114,0,121,114,
+0,121,101,97,114,0,109,111,110,116,104,0,49,124,49,50,32,121,101,97,
+114,0,109,111,0,109,111,110,116,104,0,108,117,115,116,114,117,109,0,53,
+32,121,101,97,114,115,0,100,101,99,97,100,101,0,49,48,32,121,101,97,
+114,115,0,99,101,110,116,117,114,121,0,49,48,48,32,121,101,97,114,115,
+0,109,105,108,108,101,110,110,105,117,109,0,49,48,48,48,32,121,101,97,
+114,115,0,109,105,108,108,101,110,110,105,97,0,109,105,108,108,101,110,110,
+105,117,109,0,115,111,108,97,114,121,101,97,114,0,121,101,97,114,0,108,
+117,110,97,114,121,101,97,114,0,49,50,32,108,117,110,97,114,109,111,110,
+116,104,0,99,97,108,101,110,100,97,114,121,101,97,114,0,51,54,53,32,
+100,97,121,0,99,111,109,109,111,110,121,101,97,114,0,51,54,53,32,100,
+97,121,0,108,101,97,112,121,101,97,114,0,51,54,54,32,100,97,121,0,
+106,117,108,105,97,110,121,101,97,114,0,51,54,53,46,50,53,32,100,97,
+121,0,103,114,101,103,111,114,105,97,110,121,101,97,114,0,51,54,53,46,
+50,52,50,53,32,100,97,121,0,105,115,108,97,109,105,99,121,101,97,114,
+0,51,53,52,32,100,97,121,0,105,115,108,97,109,105,99,108,101,97,112,
+121,101,97,114,0,51,53,53,32,100,97,121,0,105,115,108,97,109,105,99,
+109,111,110,116,104,0,49,124,49,50,32,105,115,108,97,109,105,99,121,101,
+97,114,0,109,101,114,99,117,114,121,100,97,121,0,53,56,46,54,52,54,
+50,32,100,97,121,0,118,101,110,117,115,100,97,121,0,50,52,51,46,48,
+49,32,100,97,121,0,101,97,114,116,104,100,97,121,0,115,105,100,101,114,
+101,97,108,100,97,121,0,109,97,114,115,100,97,121,0,49,46,48,50,53,
+57,53,54,55,53,32,100,97,121,0,106,117,112,105,116,101,114,100,97,121,
+0,48,46,52,49,51,53,52,32,100,97,121,0,115,97,116,117,114,110,100,
+97,121,0,48,46,52,51,55,53,32,100,97,121,0,117,114,97,110,117,115,
+100,97,121,0,48,46,54,53,32,100,97,121,0,110,101,112,116,117,110,101,
+100,97,121,0,48,46,55,54,56,32,100,97,121,0,112,108,117,116,111,100,
+97,121,0,54,46,51,56,54,55,32,100,97,121,0,109,101,114,99,117,114,
+121,121,101,97,114,0,48,46,50,52,48,56,52,54,55,32,106,117,108,105,
+97,110,121,101,97,114,0,118,101,110,117,115,121,101,97,114,0,48,46,54,
+49,53,49,57,55,50,54,32,106,117,108,105,97,110,121,101,97,114,0,101,
+97,114,116,104,121,101,97,114,0,115,105,100,101,114,101,97,108,121,101,97,
+114,0,109,97,114,115,121,101,97,114,0,49,46,56,56,48,56,52,55,54,
+32,106,117,108,105,97,110,121,101,97,114,0,106,117,112,105,116,101,114,121,
+101,97,114,0,49,49,46,56,54,50,54,49,53,32,106,117,108,105,97,110,
+121,101,97,114,0,115,97,116,117,114,110,121,101,97,114,0,50,57,46,52,
+52,55,52,57,56,32,106,117,108,105,97,110,121,101,97,114,0,117,114,97,
+110,117,115,121,101,97,114,0,56,52,46,48,49,54,56,52,54,32,106,117,
+108,105,97,110,121,101,97,114,0,110,101,112,116,117,110,101,121,101,97,114,
+0,49,54,52,46,55,57,49,51,50,32,106,117,108,105,97,110,121,101,97,
+114,0,112,108,117,116,111,121,101,97,114,0,50,52,55,46,57,50,48,54,
+53,32,106,117,108,105,97,110,121,101,97,114,0,101,97,114,116,104,102,108,
+97,116,116,101,110,105,110,103,0,49,124,50,57,56,46,50,53,54,52,50,
+0,101,97,114,116,104,114,97,100,105,117,115,95,101,113,117,97,116,111,114,
+105,97,108,0,54,51,55,56,49,51,54,46,52,57,32,109,0,101,97,114,
+116,104,114,97,100,105,117,115,95,112,111,108,97,114,0,40,45,101,97,114,
+116,104,102,108,97,116,116,101,110,105,110,103,43,49,41,32,101,97,114,116,
+104,114,97,100,105,117,115,95,101,113,117,97,116,111,114,105,97,108,0,108,
+97,110,100,97,114,101,97,0,49,52,56,46,56,52,55,101,54,32,107,109,
+94,50,0,111,99,101,97,110,97,114,101,97,0,51,54,49,46,50,53,52,
+101,54,32,107,109,94,50,0,109,111,111,110,114,97,100,105,117,115,0,49,
+55,51,56,32,107,109,0,115,117,110,114,97,100,105,117,115,0,54,46,57,
+54,101,56,32,109,0,103,97,117,115,115,95,107,0,48,46,48,49,55,50,
+48,50,48,57,56,57,53,0,103,97,117,115,115,105,97,110,121,101,97,114,
+0,40,50,32,112,105,32,47,32,103,97,117,115,115,95,107,41,32,100,97,
+121,115,0,97,115,116,114,111,110,111,109,105,99,97,108,117,110,105,116,0,
+52,57,57,46,48,48,52,55,56,51,56,48,54,32,108,105,103,104,116,32,
+115,101,99,111,110,100,0,97,117,0,97,115,116,114,111,110,111,109,105,99,
+97,108,117,110,105,116,0,115,111,108,97,114,109,97,115,115,0,49,46,57,
+56,57,49,101,51,48,32,107,103,0,115,117,110,109,97,115,115,0,115,111,
+108,97,114,109,97,115,115,0,115,117,110,100,105,115,116,0,49,46,48,48,
+48,48,48,49,48,49,55,56,32,97,117,0,109,111,111,110,100,105,115,116,
+0,51,46,56,52,52,101,56,32,109,0,115,117,110,100,105,115,116,95,110,
+101,97,114,0,49,46,52,55,49,101,49,49,32,109,0,115,117,110,100,105,
+115,116,95,102,97,114,0,49,46,53,50,49,101,49,49,32,109,0,109,101,
+114,99,117,114,121,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,
+47,32,54,48,50,51,54,48,48,0,118,101,110,117,115,109,97,115,115,0,
+115,111,108,97,114,109,97,115,115,32,47,32,52,48,56,53,50,51,46,55,
+49,0,101,97,114,116,104,109,111,111,110,109,97,115,115,0,115,111,108,97,
+114,109,97,115,115,32,47,32,51,50,56,57,48,48,46,53,54,0,109,97,
+114,115,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,51,
+48,57,56,55,48,56,0,106,117,112,105,116,101,114,109,97,115,115,0,115,
+111,108,97,114,109,97,115,115,32,47,32,49,48,52,55,46,51,52,56,54,
+0,115,97,116,117,114,110,109,97,115,115,0,115,111,108,97,114,109,97,115,
+115,32,47,32,51,52,57,55,46,56,57,56,0,117,114,97,110,117,115,109,
+97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,50,50,57,48,
+50,46,57,56,0,110,101,112,116,117,110,101,109,97,115,115,0,115,111,108,
+97,114,109,97,115,115,32,47,32,49,57,52,49,50,46,50,52,0,112,108,
+117,116,111,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,
+49,46,51,53,101,56,0,109,111,111,110,101,97,114,116,104,109,97,115,115,
+114,97,116,105,111,0,48,46,48,49,50,51,48,48,48,51,52,0,101,97,
+114,116,104,109,97,115,115,0,101,97,114,116,104,109,111,111,110,109,97,115,
+115,32,47,32,40,32,49,32,43,32,109,111,111,110,101,97,114,116,104,109,
+97,115,115,114,97,116,105,111,41,0,109,111,111,110,109,97,115,115,0,109,
+111,111,110,101,97,114,116,104,109,97,115,115,114,97,116,105,111,32,101,97,
+114,116,104,109,97,115,115,0,111,108,100,109,101,114,99,117,114,121,109,97,
+115,115,0,48,46,51,51,48,50,50,101,50,52,32,107,103,0,111,108,100,
+118,101,110,117,115,109,97,115,115,0,52,46,56,54,57,48,101,50,52,32,
+107,103,0,111,108,100,109,97,114,115,109,97,115,115,0,48,46,54,52,49,
+57,49,101,50,52,32,107,103,0,111,108,100,106,117,112,105,116,101,114,109,
+97,115,115,0,49,56,57,56,46,56,101,50,52,32,107,103,0,111,108,100,
+115,97,116,117,114,110,109,97,115,115,0,53,54,56,46,53,101,50,52,32,
+107,103,0,111,108,100,117,114,97,110,117,115,109,97,115,115,0,56,54,46,
+54,50,53,101,50,52,32,107,103,0,111,108,100,110,101,112,116,117,110,101,
+109,97,115,115,0,49,48,50,46,55,56,101,50,52,32,107,103,0,111,108,
+100,112,108,117,116,111,109,97,115,115,0,48,46,48,49,53,101,50,52,32,
+107,103,0,109,101,114,99,117,114,121,114,97,100,105,117,115,0,50,52,52,
+48,32,107,109,0,118,101,110,117,115,114,97,100,105,117,115,0,54,48,53,
+49,46,56,52,32,107,109,0,101,97,114,116,104,114,97,100,105,117,115,0,
+54,51,55,49,46,48,49,32,107,109,0,109,97,114,115,114,97,100,105,117,
+115,0,51,51,56,57,46,57,50,32,107,109,0,106,117,112,105,116,101,114,
+114,97,100,105,117,115,0,54,57,57,49,49,32,107,109,0,115,97,116,117,
+114,110,114,97,100,105,117,115,0,53,56,50,51,50,32,107,109,0,117,114,
+97,110,117,115,114,97,100,105,117,115,0,50,53,51,54,50,32,107,109,0,
+110,101,112,116,117,110,101,114,97,100,105,117,115,0,50,52,54,50,52,32,
+107,109,0,112,108,117,116,111,114,97,100,105,117,115,0,49,49,53,49,32,
+107,109,0,109,111,111,110,103,114,97,118,105,116,121,0,49,46,54,50,32,
+109,47,115,94,50,0,97,116,111,109,105,99,109,97,115,115,0,101,108,101,
+99,116,114,111,110,109,97,115,115,0,97,116,111,109,105,99,99,104,97,114,
+103,101,0,101,0,97,116,111,109,105,99,97,99,116,105,111,110,0,104,98,
+97,114,0,97,116,111,109,105,99,108,101,110,103,116,104,0,98,111,104,114,
+114,97,100,105,117,115,0,97,116,111,109,105,99,116,105,109,101,0,104,98,
+97,114,94,51,47,99,111,117,108,111,109,98,99,111,110,115,116,94,50,32,
+97,116,111,109,105,99,109,97,115,115,32,101,94,52,0,97,116,111,109,105,
+99,118,101,108,111,99,105,116,121,0,97,116,111,109,105,99,108,101,110,103,
+116,104,32,47,32,97,116,111,109,105,99,116,105,109,101,0,97,116,111,109,
+105,99,101,110,101,114,103,121,0,104,98,97,114,32,47,32,97,116,111,109,
+105,99,116,105,109,101,0,104,97,114,116,114,101,101,0,97,116,111,109,105,
+99,101,110,101,114,103,121,0,72,97,114,116,114,101,101,0,104,97,114,116,
+114,101,101,0,116,104,101,114,109,97,108,99,111,117,108,111,109,98,0,74,
+47,75,0,116,104,101,114,109,97,108,97,109,112,101,114,101,0,87,47,75,
+0,116,104,101,114,109,97,108,102,97,114,97,100,0,74,47,75,94,50,0,
+116,104,101,114,109,97,108,111,104,109,0,75,94,50,47,87,0,102,111,117,
+114,105,101,114,0,116,104,101,114,109,97,108,111,104,109,0,116,104,101,114,
+109,97,108,104,101,110,114,121,0,74,32,75,94,50,47,87,94,50,0,116,
+104,101,114,109,97,108,118,111,108,116,0,75,0,85,83,0,49,50,48,48,
+124,51,57,51,55,32,109,47,102,116,0,105,110,116,0,51,57,51,55,124,
+49,50,48,48,32,102,116,47,109,0,105,110,99,104,0,50,46,53,52,32,
+99,109,0,105,110,0,105,110,99,104,0,102,111,111,116,0,49,50,32,105,
+110,99,104,0,102,101,101,116,0,102,111,111,116,0,102,116,0,102,111,111,
+116,0,121,97,114,100,0,51,32,102,116,0,121,100,0,121,97,114,100,0,
+109,105,108,101,0,53,50,56,48,32,102,116,0,108,105,110,101,0,49,124,
+49,50,32,105,110,99,104,0,114,111,100,0,53,46,53,32,121,97,114,100,
+0,112,101,114,99,104,0,114,111,100,0,102,117,114,108,111,110,103,0,52,
+48,32,114,111,100,0,115,116,97,116,117,116,101,109,105,108,101,0,109,105,
+108,101,0,108,101,97,103,117,101,0,51,32,109,105,108,101,0,115,117,114,
+118,101,121,111,114,115,99,104,97,105,110,0,54,54,32,115,117,114,118,101,
+121,102,116,0,115,117,114,118,101,121,99,104,97,105,110,0,115,117,114,118,
+101,121,111,114,115,99,104,97,105,110,0,115,117,114,118,101,121,111,114,115,
+112,111,108,101,0,49,124,52,32,115,117,114,118,101,121,111,114,115,99,104,
+97,105,110,0,115,117,114,118,101,121,111,114,115,108,105,110,107,0,49,124,
+49,48,48,32,115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,99,
+104,97,105,110,0,54,54,32,102,116,0,108,105,110,107,0,49,124,49,48,
+48,32,99,104,97,105,110,0,99,104,0,99,104,97,105,110,0,117,115,97,
+99,114,101,0,49,48,32,115,117,114,118,101,121,99,104,97,105,110,94,50,
+0,105,110,116,97,99,114,101,0,49,48,32,99,104,97,105,110,94,50,0,
+105,110,116,97,99,114,101,102,111,111,116,0,97,99,114,101,32,115,117,114,
+118,101,121,102,111,111,116,0,117,115,97,99,114,101,102,111,111,116,0,117,
+115,97,99,114,101,32,115,117,114,118,101,121,102,111,111,116,0,115,101,99,
+116,105,111,110,0,109,105,108,101,94,50,0,116,111,119,110,115,104,105,112,
+0,51,54,32,115,101,99,116,105,111,110,0,104,111,109,101,115,116,101,97,
+100,0,49,54,48,32,97,99,114,101,0,103,117,110,116,101,114,115,99,104,
+97,105,110,0,115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,101,
+110,103,105,110,101,101,114,115,99,104,97,105,110,0,49,48,48,32,102,116,
+0,101,110,103,105,110,101,101,114,115,108,105,110,107,0,49,124,49,48,48,
+32,101,110,103,105,110,101,101,114,115,99,104,97,105,110,0,114,97,109,115,
+100,101,110,115,99,104,97,105,110,0,101,110,103,105,110,101,101,114,115,99,
+104,97,105,110,0,114,97,109,115,100,101,110,115,108,105,110,107,0,101,110,
+103,105,110,101,101,114,115,108,105,110,107,0,103,117,114,108,101,121,99,104,
+97,105,110,0,51,51,32,102,101,101,116,0,103,117,114,108,101,121,108,105,
+110,107,0,49,124,53,48,32,103,117,114,108,101,121,99,104,97,105,110,0,
+119,105,110,103,99,104,97,105,110,0,54,54,32,102,101,101,116,0,119,105,
+110,103,108,105,110,107,0,49,124,56,48,32,119,105,110,103,99,104,97,105,
+110,0,102,97,116,104,111,109,0,54,32,102,116,0,110,97,117,116,105,99,
+97,108,109,105,108,101,0,49,56,53,50,32,109,0,99,97,98,108,101,0,
+49,124,49,48,32,110,97,117,116,105,99,97,108,109,105,108,101,0,105,110,
+116,99,97,98,108,101,0,99,97,98,108,101,0,99,97,98,108,101,108,101,
+110,103,116,104,0,99,97,98,108,101,0,85,83,99,97,98,108,101,0,49,
+48,48,32,85,83,102,97,116,104,111,109,0,110,97,118,121,99,97,98,108,
+101,108,101,110,103,116,104,0,55,50,48,32,85,83,102,116,0,109,97,114,
+105,110,101,108,101,97,103,117,101,0,51,32,110,97,117,116,105,99,97,108,
+109,105,108,101,0,103,101,111,103,114,97,112,104,105,99,97,108,109,105,108,
+101,0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,0,107,110,111,
+116,0,110,97,117,116,105,99,97,108,109,105,108,101,32,47,32,104,114,0,
+99,108,105,99,107,0,107,109,0,107,108,105,99,107,0,99,108,105,99,107,
+0,112,111,117,110,100,0,48,46,52,53,51,53,57,50,51,55,32,107,103,
+0,108,98,0,112,111,117,110,100,0,103,114,97,105,110,0,49,124,55,48,
+48,48,32,112,111,117,110,100,0,111,117,110,99,101,0,49,124,49,54,32,
+112,111,117,110,100,0,111,122,0,111,117,110,99,101,0,100,114,97,109,0,
+49,124,49,54,32,111,117,110,99,101,0,100,114,0,100,114,97,109,0,117,
+115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,49,48,48,32,112,
+111,117,110,100,115,0,99,119,116,0,104,117,110,100,114,101,100,119,101,105,
+103,104,116,0,115,104,111,114,116,104,117,110,100,114,101,100,119,101,105,103,
+104,116,0,117,115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,117,
+115,116,111,110,0,115,104,111,114,116,116,111,110,0,115,104,111,114,116,116,
+111,110,0,50,48,48,48,32,108,98,0,113,117,97,114,116,101,114,119,101,
+105,103,104,116,0,49,124,52,32,117,115,116,111,110,0,115,104,111,114,116,
+113,117,97,114,116,101,114,119,101,105,103,104,116,0,49,124,52,32,115,104,
+111,114,116,116,111,110,0,115,104,111,114,116,113,117,97,114,116,101,114,0,
+115,104,111,114,116,113,117,97,114,116,101,114,119,101,105,103,104,116,0,116,
+114,111,121,112,111,117,110,100,0,53,55,54,48,32,103,114,97,105,110,0,
+116,114,111,121,111,117,110,99,101,0,49,124,49,50,32,116,114,111,121,112,
+111,117,110,100,0,111,122,116,0,116,114,111,121,111,117,110,99,101,0,112,
+101,110,110,121,119,101,105,103,104,116,0,49,124,50,48,32,116,114,111,121,
+111,117,110,99,101,0,100,119,116,0,112,101,110,110,121,119,101,105,103,104,
+116,0,97,115,115,97,121,116,111,110,0,109,103,32,116,111,110,32,47,32,
+116,114,111,121,111,117,110,99,101,0,117,115,97,115,115,97,121,116,111,110,
+0,109,103,32,117,115,116,111,110,32,47,32,116,114,111,121,111,117,110,99,
+101,0,98,114,97,115,115,97,121,116,111,110,0,109,103,32,98,114,116,111,
+110,32,47,32,116,114,111,121,111,117,110,99,101,0,102,105,110,101,111,117,
+110,99,101,0,116,114,111,121,111,117,110,99,101,0,109,101,116,114,105,99,
+99,97,114,97,116,0,48,46,50,32,103,114,97,109,0,109,101,116,114,105,
+99,103,114,97,105,110,0,53,48,32,109,103,0,99,97,114,97,116,0,109,
+101,116,114,105,99,99,97,114,97,116,0,99,116,0,99,97,114,97,116,0,
+106,101,119,101,108,101,114,115,112,111,105,110,116,0,49,124,49,48,48,32,
+99,97,114,97,116,0,115,105,108,118,101,114,115,109,105,116,104,112,111,105,
+110,116,0,49,124,52,48,48,48,32,105,110,99,104,0,109,111,109,109,101,
+0,51,46,55,53,32,103,114,97,109,115,0,97,112,112,111,117,110,100,0,
+116,114,111,121,112,111,117,110,100,0,97,112,111,117,110,99,101,0,116,114,
+111,121,111,117,110,99,101,0,97,112,100,114,97,109,0,49,124,56,32,97,
+112,111,117,110,99,101,0,97,112,115,99,114,117,112,108,101,0,49,124,51,
+32,97,112,100,114,97,109,0,117,115,103,97,108,108,111,110,0,50,51,49,
+32,105,110,94,51,0,103,97,108,0,103,97,108,108,111,110,0,113,117,97,
+114,116,0,49,124,52,32,103,97,108,108,111,110,0,112,105,110,116,0,49,
+124,50,32,113,117,97,114,116,0,103,105,108,108,0,49,124,52,32,112,105,
+110,116,0,117,115,113,117,97,114,116,0,49,124,52,32,117,115,103,97,108,
+108,111,110,0,117,115,112,105,110,116,0,49,124,50,32,117,115,113,117,97,
+114,116,0,117,115,103,105,108,108,0,49,124,52,32,117,115,112,105,110,116,
+0,117,115,102,108,117,105,100,111,117,110,99,101,0,49,124,49,54,32,117,
+115,112,105,110,116,0,102,108,117,105,100,100,114,97,109,0,49,124,56,32,
+117,115,102,108,111,122,0,109,105,110,105,109,118,111,108,117,109,101,0,49,
+124,54,48,32,102,108,117,105,100,100,114,97,109,0,113,116,0,113,117,97,
+114,116,0,112,116,0,112,105,110,116,0,102,108,111,122,0,102,108,117,105,
+100,111,117,110,99,101,0,117,115,102,108,111,122,0,117,115,102,108,117,105,
+100,111,117,110,99,101,0,102,108,100,114,0,102,108,117,105,100,100,114,97,
+109,0,108,105,113,117,105,100,98,97,114,114,101,108,0,51,49,46,53,32,
+117,115,103,97,108,108,111,110,0,117,115,98,101,101,114,98,97,114,114,101,
+108,0,50,32,98,101,101,114,107,101,103,115,0,98,101,101,114,107,101,103,
+0,49,53,46,53,32,117,115,103,97,108,108,111,110,0,112,111,110,121,107,
+101,103,0,49,124,50,32,98,101,101,114,107,101,103,0,119,105,110,101,107,
+101,103,0,49,50,32,117,115,103,97,108,108,111,110,0,112,101,116,114,111,
+108,101,117,109,98,97,114,114,101,108,0,52,50,32,117,115,103,97,108,108,
+111,110,0,98,97,114,114,101,108,0,112,101,116,114,111,108,101,117,109,98,
+97,114,114,101,108,0,98,98,108,0,98,97,114,114,101,108,0,117,115,104,
+111,103,115,104,101,97,100,0,50,32,108,105,113,117,105,100,98,97,114,114,
+101,108,0,117,115,102,105,114,107,105,110,0,57,32,103,97,108,108,111,110,
+0,117,115,98,117,115,104,101,108,0,50,49,53,48,46,52,50,32,105,110,
+94,51,0,98,117,0,98,117,115,104,101,108,0,112,101,99,107,0,49,124,
+52,32,98,117,115,104,101,108,0,117,115,112,101,99,107,0,49,124,52,32,
+117,115,98,117,115,104,101,108,0,98,114,112,101,99,107,0,49,124,52,32,
+98,114,98,117,115,104,101,108,0,112,107,0,112,101,99,107,0,100,114,121,
+103,97,108,108,111,110,0,49,124,50,32,117,115,112,101,99,107,0,100,114,
+121,113,117,97,114,116,0,49,124,52,32,100,114,121,103,97,108,108,111,110,
+0,100,114,121,112,105,110,116,0,49,124,50,32,100,114,121,113,117,97,114,
+116,0,100,114,121,98,97,114,114,101,108,0,55,48,53,54,32,105,110,94,
+51,0,99,114,97,110,98,101,114,114,121,98,97,114,114,101,108,0,53,56,
+50,54,32,105,110,94,51,0,104,101,97,112,101,100,98,117,115,104,101,108,
+0,49,46,50,55,56,32,117,115,98,117,115,104,101,108,0,119,104,101,97,
+116,98,117,115,104,101,108,0,54,48,32,108,98,0,115,111,121,98,101,97,
+110,98,117,115,104,101,108,0,54,48,32,108,98,0,99,111,114,110,98,117,
+115,104,101,108,0,53,54,32,108,98,0,114,121,101,98,117,115,104,101,108,
+0,53,54,32,108,98,0,98,97,114,108,101,121,98,117,115,104,101,108,0,
+52,56,32,108,98,0,111,97,116,98,117,115,104,101,108,0,51,50,32,108,
+98,0,114,105,99,101,98,117,115,104,101,108,0,52,53,32,108,98,0,99,
+97,110,97,100,97,95,111,97,116,98,117,115,104,101,108,0,51,52,32,108,
+98,0,112,111,110,121,118,111,108,117,109,101,0,49,32,117,115,102,108,111,
+122,0,106,105,103,103,101,114,0,49,46,53,32,117,115,102,108,111,122,0,
+115,104,111,116,0,106,105,103,103,101,114,0,101,117,115,104,111,116,0,50,
+53,32,109,108,0,102,105,102,116,104,0,49,124,53,32,117,115,103,97,108,
+108,111,110,0,119,105,110,101,98,111,116,116,108,101,0,55,53,48,32,109,
+108,0,119,105,110,101,115,112,108,105,116,0,49,124,52,32,119,105,110,101,
+98,111,116,116,108,101,0,119,105,110,101,103,108,97,115,115,0,52,32,117,
+115,102,108,111,122,0,109,97,103,110,117,109,0,49,46,53,32,108,105,116,
+101,114,0,109,101,116,114,105,99,116,101,110,116,104,0,51,55,53,32,109,
+108,0,109,101,116,114,105,99,102,105,102,116,104,0,55,53,48,32,109,108,
+0,109,101,116,114,105,99,113,117,97,114,116,0,49,32,108,105,116,101,114,
+0,114,101,112,117,116,101,100,113,117,97,114,116,0,49,124,54,32,98,114,
+103,97,108,108,111,110,0,114,101,112,117,116,101,100,112,105,110,116,0,49,
+124,50,32,114,101,112,117,116,101,100,113,117,97,114,116,0,98,114,119,105,
+110,101,98,111,116,116,108,101,0,114,101,112,117,116,101,100,113,117,97,114,
+116,0,115,112,108,105,116,0,50,48,48,32,109,108,0,106,101,114,111,98,
+111,97,109,0,50,32,109,97,103,110,117,109,0,114,101,104,111,98,111,97,
+109,0,51,32,109,97,103,110,117,109,0,109,101,116,104,117,115,101,108,97,
+104,0,52,32,109,97,103,110,117,109,0,115,97,108,109,97,110,97,122,97,
+114,0,54,32,109,97,103,110,117,109,0,98,97,108,116,104,97,122,97,114,
+0,56,32,109,97,103,110,117,109,0,110,101,98,117,99,104,97,100,110,101,
+122,122,97,114,0,49,48,32,109,97,103,110,117,109,0,99,108,97,114,107,
+100,101,103,114,101,101,0,49,124,55,48,48,48,48,0,103,112,103,0,103,
+114,97,105,110,115,47,103,97,108,108,111,110,0,115,104,111,101,105,114,111,
+110,0,49,124,52,56,32,105,110,99,104,0,115,104,111,101,111,117,110,99,
+101,0,49,124,54,52,32,105,110,99,104,0,115,104,111,101,115,105,122,101,
+95,100,101,108,116,97,0,49,124,51,32,105,110,99,104,0,115,104,111,101,
+95,109,101,110,48,0,56,46,50,53,32,105,110,99,104,0,115,104,111,101,
+95,119,111,109,101,110,48,0,40,55,43,49,49,124,49,50,41,32,105,110,
+99,104,0,115,104,111,101,95,98,111,121,115,48,0,40,51,43,49,49,124,
+49,50,41,32,105,110,99,104,0,115,104,111,101,95,103,105,114,108,115,48,
+0,40,51,43,55,124,49,50,41,32,105,110,99,104,0,101,117,114,111,112,
+101,115,104,111,101,115,105,122,101,0,50,124,51,32,99,109,0,98,117,99,
+107,0,85,83,36,0,102,105,110,0,53,32,85,83,36,0,115,97,119,98,
+117,99,107,0,49,48,32,85,83,36,0,117,115,103,114,97,110,100,0,49,
+48,48,48,32,85,83,36,0,103,114,101,101,110,98,97,99,107,0,85,83,
+36,0,107,101,121,0,107,103,0,108,105,100,0,49,32,111,122,0,102,111,
+111,116,98,97,108,108,102,105,101,108,100,0,117,115,102,111,111,116,98,97,
+108,108,102,105,101,108,100,0,117,115,102,111,111,116,98,97,108,108,102,105,
+101,108,100,0,49,48,48,32,121,97,114,100,115,0,99,97,110,97,100,97,
+102,111,111,116,98,97,108,108,102,105,101,108,100,0,49,49,48,32,121,97,
+114,100,115,0,109,97,114,97,116,104,111,110,0,50,54,32,109,105,108,101,
+115,32,43,32,51,56,53,32,121,97,114,100,115,0,85,75,0,85,75,108,
+101,110,103,116,104,95,83,74,74,0,85,75,108,101,110,103,116,104,95,66,
+0,48,46,57,49,52,51,57,57,50,32,109,101,116,101,114,32,47,32,121,
+97,114,100,0,85,75,108,101,110,103,116,104,95,83,74,74,0,48,46,57,
+49,52,51,57,56,52,49,32,109,101,116,101,114,32,47,32,121,97,114,100,
+0,85,75,108,101,110,103,116,104,95,75,0,109,101,116,101,114,32,47,32,
+51,57,46,51,55,48,55,57,32,105,110,99,104,0,85,75,108,101,110,103,
+116,104,95,67,0,109,101,116,101,114,32,47,32,49,46,48,57,51,54,50,
+51,49,49,32,121,97,114,100,0,98,114,110,97,117,116,105,99,97,108,109,
+105,108,101,0,54,48,56,48,32,102,116,0,98,114,107,110,111,116,0,98,
+114,110,97,117,116,105,99,97,108,109,105,108,101,32,47,32,104,114,0,98,
+114,99,97,98,108,101,0,49,124,49,48,32,98,114,110,97,117,116,105,99,
+97,108,109,105,108,101,0,97,100,109,105,114,97,108,116,121,109,105,108,101,
+0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,0,97,100,109,105,
+114,97,108,116,121,107,110,111,116,0,98,114,107,110,111,116,0,97,100,109,
+105,114,97,108,116,121,99,97,98,108,101,0,98,114,99,97,98,108,101,0,
+115,101,97,109,105,108,101,0,54,48,48,48,32,102,116,0,115,104,97,99,
+107,108,101,0,49,53,32,102,97,116,104,111,109,115,0,99,108,111,118,101,
+0,55,32,108,98,0,115,116,111,110,101,0,49,52,32,108,98,0,116,111,
+100,0,50,56,32,108,98,0,98,114,113,117,97,114,116,101,114,119,101,105,
+103,104,116,0,49,124,52,32,98,114,104,117,110,100,114,101,100,119,101,105,
+103,104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,103,104,116,0,
+56,32,115,116,111,110,101,0,108,111,110,103,104,117,110,100,114,101,100,119,
+101,105,103,104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,103,104,
+116,0,108,111,110,103,116,111,110,0,50,48,32,98,114,104,117,110,100,114,
+101,100,119,101,105,103,104,116,0,98,114,116,111,110,0,108,111,110,103,116,
+111,110,0,98,114,109,105,110,105,109,0,49,124,54,48,32,98,114,100,114,
+97,109,0,98,114,115,99,114,117,112,108,101,0,49,124,51,32,98,114,100,
+114,97,109,0,102,108,117,105,100,115,99,114,117,112,108,101,0,98,114,115,
+99,114,117,112,108,101,0,98,114,100,114,97,109,0,49,124,56,32,98,114,
+102,108,111,122,0,98,114,102,108,117,105,100,111,117,110,99,101,0,49,124,
+50,48,32,98,114,112,105,110,116,0,98,114,102,108,111,122,0,98,114,102,
+108,117,105,100,111,117,110,99,101,0,98,114,103,105,108,108,0,49,124,52,
+32,98,114,112,105,110,116,0,98,114,112,105,110,116,0,49,124,50,32,98,
+114,113,117,97,114,116,0,98,114,113,117,97,114,116,0,49,124,52,32,98,
+114,103,97,108,108,111,110,0,98,114,103,97,108,108,111,110,0,52,46,53,
+52,54,48,57,32,108,0,98,114,98,97,114,114,101,108,0,51,54,32,98,
+114,103,97,108,108,111,110,0,98,114,98,117,115,104,101,108,0,56,32,98,
+114,103,97,108,108,111,110,0,98,114,104,101,97,112,101,100,98,117,115,104,
+101,108,0,49,46,50,55,56,32,98,114,98,117,115,104,101,108,0,98,114,
+113,117,97,114,116,101,114,0,56,32,98,114,98,117,115,104,101,108,0,98,
+114,99,104,97,108,100,114,111,110,0,51,54,32,98,114,98,117,115,104,101,
+108,0,98,97,103,0,52,32,98,114,98,117,115,104,101,108,0,98,117,99,
+107,101,116,0,52,32,98,114,103,97,108,108,111,110,0,107,105,108,100,101,
+114,107,105,110,0,50,32,98,114,102,105,114,107,105,110,0,108,97,115,116,
+0,52,48,32,98,114,98,117,115,104,101,108,0,110,111,103,103,105,110,0,
+98,114,103,105,108,108,0,112,111,116,116,108,101,0,48,46,53,32,98,114,
+103,97,108,108,111,110,0,112,105,110,0,52,46,53,32,98,114,103,97,108,
+108,111,110,0,112,117,110,99,104,101,111,110,0,55,50,32,98,114,103,97,
+108,108,111,110,0,115,101,97,109,0,56,32,98,114,98,117,115,104,101,108,
+0,99,111,111,109,98,0,52,32,98,114,98,117,115,104,101,108,0,98,111,
+108,108,0,54,32,98,114,98,117,115,104,101,108,0,102,105,114,108,111,116,
+0,49,124,52,32,98,111,108,108,0,98,114,102,105,114,107,105,110,0,57,
+32,98,114,103,97,108,108,111,110,0,99,114,97,110,0,51,55,46,53,32,
+98,114,103,97,108,108,111,110,0,98,114,119,105,110,101,104,111,103,115,104,
+101,97,100,0,53,50,46,53,32,98,114,103,97,108,108,111,110,0,98,114,
+104,111,103,115,104,101,97,100,0,98,114,119,105,110,101,104,111,103,115,104,
+101,97,100,0,98,114,98,101,101,114,104,111,103,115,104,101,97,100,0,53,
+52,32,98,114,103,97,108,108,111,110,0,98,114,98,101,101,114,98,117,116,
+116,0,50,32,98,114,98,101,101,114,104,111,103,115,104,101,97,100,0,114,
+101,103,105,115,116,101,114,116,111,110,0,49,48,48,32,102,116,94,51,0,
+115,104,105,112,112,105,110,103,116,111,110,0,52,48,32,102,116,94,51,0,
+98,114,115,104,105,112,112,105,110,103,116,111,110,0,52,50,32,102,116,94,
+51,0,102,114,101,105,103,104,116,116,111,110,0,115,104,105,112,112,105,110,
+103,116,111,110,0,100,105,115,112,108,97,99,101,109,101,110,116,116,111,110,
+0,51,53,32,102,116,94,51,0,119,97,116,101,114,116,111,110,0,50,50,
+52,32,98,114,103,97,108,108,111,110,0,115,116,114,105,107,101,0,55,48,
+46,53,32,108,0,97,109,98,101,114,0,52,32,98,114,98,117,115,104,101,
+108,0,98,97,114,108,101,121,99,111,114,110,0,49,124,51,32,85,75,105,
+110,99,104,0,110,97,105,108,0,49,124,49,54,32,85,75,121,97,114,100,
+0,112,111,108,101,0,49,54,46,53,32,85,75,102,116,0,114,111,112,101,
+0,50,48,32,85,75,102,116,0,101,110,103,108,105,115,104,101,108,108,0,
+52,53,32,85,75,105,110,99,104,0,102,108,101,109,105,115,104,101,108,108,
+0,50,55,32,85,75,105,110,99,104,0,101,108,108,0,101,110,103,108,105,
+115,104,101,108,108,0,115,112,97,110,0,57,32,85,75,105,110,99,104,0,
+103,111,97,100,0,52,46,53,32,85,75,102,116,0,114,111,111,100,0,49,
+124,52,32,97,99,114,101,0,101,110,103,108,105,115,104,99,97,114,97,116,
+0,116,114,111,121,111,117,110,99,101,47,49,53,49,46,53,0,109,97,110,
+99,117,115,0,50,32,111,122,0,109,97,115,116,0,50,46,53,32,108,98,
+0,110,97,105,108,107,101,103,0,49,48,48,32,108,98,115,0,98,97,115,
+101,98,111,120,0,51,49,51,54,48,32,105,110,94,50,0,109,101,116,114,
+101,0,109,101,116,101,114,0,103,114,97,109,109,101,0,103,114,97,109,0,
+108,105,116,114,101,0,108,105,116,101,114,0,100,105,111,112,116,114,101,0,
+100,105,111,112,116,101,114,0,97,108,117,109,105,110,105,117,109,0,97,108,
+117,109,105,110,117,109,0,115,117,108,112,104,117,114,0,115,117,108,102,117,
+114,0,103,101,111,109,101,116,114,105,99,112,97,99,101,0,53,32,102,116,
+0,112,97,99,101,0,50,46,53,32,102,116,0,85,83,109,105,108,105,116,
+97,114,121,112,97,99,101,0,51,48,32,105,110,0,85,83,100,111,117,98,
+108,101,116,105,109,101,112,97,99,101,0,51,54,32,105,110,0,102,105,110,
+103,101,114,98,114,101,97,100,116,104,0,55,124,56,32,105,110,0,102,105,
+110,103,101,114,108,101,110,103,116,104,0,52,46,53,32,105,110,0,102,105,
+110,103,101,114,0,102,105,110,103,101,114,98,114,101,97,100,116,104,0,112,
+97,108,109,119,105,100,116,104,0,104,97,110,100,0,112,97,108,109,108,101,
+110,103,116,104,0,56,32,105,110,0,104,97,110,100,0,52,32,105,110,99,
+104,0,115,104,97,102,116,109,101,110,116,0,54,32,105,110,99,104,0,115,
+109,111,111,116,0,53,32,102,116,32,43,32,55,32,105,110,0,116,98,108,
+0,116,97,98,108,101,115,112,111,111,110,0,116,98,115,112,0,116,97,98,
+108,101,115,112,111,111,110,0,116,98,108,115,112,0,116,97,98,108,101,115,
+112,111,111,110,0,84,98,0,116,97,98,108,101,115,112,111,111,110,0,116,
+115,112,0,116,101,97,115,112,111,111,110,0,115,97,108,116,115,112,111,111,
+110,0,49,124,52,32,116,115,112,0,117,115,99,117,112,0,56,32,117,115,
+102,108,111,122,0,117,115,116,97,98,108,101,115,112,111,111,110,0,49,124,
+49,54,32,117,115,99,117,112,0,117,115,116,101,97,115,112,111,111,110,0,
+49,124,51,32,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,
+98,108,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,98,
+115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,98,
+108,115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,
+115,112,0,117,115,116,101,97,115,112,111,111,110,0,109,101,116,114,105,99,
+99,117,112,0,50,53,48,32,109,108,0,115,116,105,99,107,98,117,116,116,
+101,114,0,49,124,52,32,108,98,0,110,117,109,98,101,114,49,99,97,110,
+0,49,48,32,117,115,102,108,111,122,0,110,117,109,98,101,114,50,99,97,
+110,0,49,57,32,117,115,102,108,111,122,0,110,117,109,98,101,114,50,46,
+53,99,97,110,0,51,46,53,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,51,99,97,110,0,52,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,53,99,97,110,0,55,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,49,48,99,97,110,0,49,48,53,32,117,115,102,108,111,122,0,98,
+114,99,117,112,0,49,124,50,32,98,114,112,105,110,116,0,98,114,116,101,
+97,99,117,112,0,49,124,51,32,98,114,112,105,110,116,0,98,114,116,97,
+98,108,101,115,112,111,111,110,0,49,53,32,109,108,0,98,114,116,101,97,
+115,112,111,111,110,0,49,124,51,32,98,114,116,97,98,108,101,115,112,111,
+111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,111,110,0,50,32,
+98,114,116,101,97,115,112,111,111,110,0,100,101,115,115,101,114,116,115,112,
+111,111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,111,110,0,100,
+115,112,0,100,101,115,115,101,114,116,115,112,111,111,110,0,98,114,116,115,
+112,0,98,114,116,101,97,115,112,111,111,110,0,98,114,116,98,108,0,98,
+114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,115,112,0,98,
+114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,108,115,112,0,
+98,114,116,97,98,108,101,115,112,111,111,110,0,97,117,115,116,114,97,108,
+105,97,116,97,98,108,101,115,112,111,111,110,0,50,48,32,109,108,0,97,
+117,115,116,98,108,0,97,117,115,116,114,97,108,105,97,116,97,98,108,101,
+115,112,111,111,110,0,97,117,115,116,98,115,112,0,97,117,115,116,114,97,
+108,105,97,116,97,98,108,101,115,112,111,111,110,0,97,117,115,116,98,108,
+115,112,0,97,117,115,116,114,97,108,105,97,116,97,98,108,101,115,112,111,
+111,110,0,97,117,115,116,114,97,108,105,97,116,101,97,115,112,111,111,110,
+0,49,124,52,32,97,117,115,116,114,97,108,105,97,116,97,98,108,101,115,
+112,111,111,110,0,97,117,115,116,115,112,0,97,117,115,116,114,97,108,105,
+97,116,101,97,115,112,111,111,110,0,99,97,116,116,121,0,48,46,53,32,
+107,103,0,111,108,100,99,97,116,116,121,0,52,124,51,32,108,98,115,0,
+116,97,101,108,0,49,124,49,54,32,111,108,100,99,97,116,116,121,0,109,
+97,99,101,0,48,46,49,32,116,97,101,108,0,111,108,100,112,105,99,117,
+108,0,49,48,48,32,111,108,100,99,97,116,116,121,0,112,105,99,117,108,
+0,49,48,48,32,99,97,116,116,121,0,115,101,101,114,0,49,52,52,48,
+48,32,103,114,97,105,110,0,115,101,114,0,115,101,101,114,0,109,97,117,
+110,100,0,52,48,32,115,101,101,114,0,112,97,107,105,115,116,97,110,115,
+101,101,114,0,49,32,107,103,0,112,97,107,105,115,116,97,110,109,97,117,
+110,100,0,52,48,32,112,97,107,105,115,116,97,110,115,101,101,114,0,99,
+104,105,116,116,97,107,0,49,124,49,54,32,115,101,101,114,0,116,111,108,
+97,0,49,124,53,32,99,104,105,116,116,97,107,0,111,108,108,111,99,107,
+0,49,124,52,32,108,105,116,101,114,0,106,97,112,97,110,99,117,112,0,
+50,48,48,32,109,108,0,98,117,116,116,101,114,0,56,32,111,122,47,117,
+115,99,117,112,0,98,117,116,116,101,114,95,99,108,97,114,105,102,105,101,
+100,0,54,46,56,32,111,122,47,117,115,99,117,112,0,99,111,99,111,97,
+95,98,117,116,116,101,114,0,57,32,111,122,47,117,115,99,117,112,0,115,
+104,111,114,116,101,110,105,110,103,0,54,46,55,53,32,111,122,47,117,115,
+99,117,112,0,111,105,108,0,55,46,53,32,111,122,47,117,115,99,117,112,
+0,99,97,107,101,102,108,111,117,114,95,115,105,102,116,101,100,0,51,46,
+53,32,111,122,47,117,115,99,117,112,0,99,97,107,101,102,108,111,117,114,
+95,115,112,111,111,110,101,100,0,52,32,111,122,47,117,115,99,117,112,0,
+99,97,107,101,102,108,111,117,114,95,115,99,111,111,112,101,100,0,52,46,
+53,32,111,122,47,117,115,99,117,112,0,102,108,111,117,114,95,115,105,102,
+116,101,100,0,52,32,111,122,47,117,115,99,117,112,0,102,108,111,117,114,
+95,115,112,111,111,110,101,100,0,52,46,50,53,32,111,122,47,117,115,99,
+117,112,0,102,108,111,117,114,95,115,99,111,111,112,101,100,0,53,32,111,
+122,47,117,115,99,117,112,0,98,114,101,97,100,102,108,111,117,114,95,115,
+105,102,116,101,100,0,52,46,50,53,32,111,122,47,117,115,99,117,112,0,
+98,114,101,97,100,102,108,111,117,114,95,115,112,111,111,110,101,100,0,52,
+46,53,32,111,122,47,117,115,99,117,112,0,98,114,101,97,100,102,108,111,
+117,114,95,115,99,111,111,112,101,100,0,53,46,53,32,111,122,47,117,115,
+99,117,112,0,99,111,114,110,115,116,97,114,99,104,0,49,50,48,32,103,
+114,97,109,115,47,117,115,99,117,112,0,100,117,116,99,104,99,111,99,111,
+97,95,115,105,102,116,101,100,0,55,53,32,103,47,117,115,99,117,112,0,
+100,117,116,99,104,99,111,99,111,97,95,115,112,111,111,110,101,100,0,57,
+50,32,103,47,117,115,99,117,112,0,100,117,116,99,104,99,111,99,111,97,
+95,115,99,111,111,112,101,100,0,57,53,32,103,47,117,115,99,117,112,0,
+99,111,99,111,97,95,115,105,102,116,101,100,0,55,53,32,103,47,117,115,
+99,117,112,0,99,111,99,111,97,95,115,112,111,111,110,101,100,0,56,50,
+32,103,47,117,115,99,117,112,0,99,111,99,111,97,95,115,99,111,111,112,
+101,100,0,57,53,32,103,47,117,115,99,117,112,0,104,101,97,118,121,99,
+114,101,97,109,0,50,51,50,32,103,47,117,115,99,117,112,0,109,105,108,
+107,0,50,52,50,32,103,47,117,115,99,117,112,0,115,111,117,114,99,114,
+101,97,109,0,50,52,50,32,103,47,117,115,99,117,112,0,109,111,108,97,
+115,115,101,115,0,49,49,46,50,53,32,111,122,47,117,115,99,117,112,0,
+99,111,114,110,115,121,114,117,112,0,49,49,46,53,32,111,122,47,117,115,
+99,117,112,0,104,111,110,101,121,0,49,49,46,55,53,32,111,122,47,117,
+115,99,117,112,0,115,117,103,97,114,0,50,48,48,32,103,47,117,115,99,
+117,112,0,112,111,119,100,101,114,101,100,95,115,117,103,97,114,0,52,32,
+111,122,47,117,115,99,117,112,0,98,114,111,119,110,115,117,103,97,114,95,
+108,105,103,104,116,0,50,49,55,32,103,47,117,115,99,117,112,0,98,114,
+111,119,110,115,117,103,97,114,95,100,97,114,107,0,50,51,57,32,103,47,
+117,115,99,117,112,0,98,97,107,105,110,103,95,112,111,119,100,101,114,0,
+52,46,54,32,103,114,97,109,115,32,47,32,117,115,116,115,112,0,115,97,
+108,116,0,54,32,103,32,47,32,117,115,116,115,112,0,107,111,115,104,101,
+114,115,97,108,116,0,50,46,56,32,103,32,47,32,117,115,116,115,112,0,
+107,111,115,104,101,114,115,97,108,116,95,109,111,114,116,111,110,0,52,46,
+56,32,103,32,47,32,117,115,116,115,112,0,101,103,103,0,53,48,32,103,
+114,97,109,115,0,101,103,103,119,104,105,116,101,0,51,48,32,103,114,97,
+109,115,0,101,103,103,121,111,108,107,0,49,56,46,54,32,103,114,97,109,
+115,0,101,103,103,118,111,108,117,109,101,0,51,32,117,115,116,97,98,108,
+101,115,112,111,111,110,115,32,43,32,49,124,50,32,117,115,116,115,112,0,
+101,103,103,119,104,105,116,101,118,111,108,117,109,101,0,50,32,117,115,116,
+97,98,108,101,115,112,111,111,110,115,0,101,103,103,121,111,108,107,118,111,
+108,117,109,101,0,51,46,53,32,117,115,116,115,112,0,98,97,117,109,101,
+99,111,110,115,116,0,49,52,52,0,111,117,110,99,101,100,97,108,0,111,
+122,32,102,116,32,47,32,115,94,50,0,112,111,117,110,100,97,108,0,108,
+98,32,102,116,32,47,32,115,94,50,0,116,111,110,100,97,108,0,116,111,
+110,32,102,116,32,47,32,115,94,50,0,112,100,108,0,112,111,117,110,100,
+97,108,0,111,115,105,0,111,117,110,99,101,32,102,111,114,99,101,32,47,
+32,105,110,99,104,94,50,0,112,115,105,0,112,111,117,110,100,32,102,111,
+114,99,101,32,47,32,105,110,99,104,94,50,0,112,115,105,97,0,112,115,
+105,0,116,115,105,0,116,111,110,32,102,111,114,99,101,32,47,32,105,110,
+99,104,94,50,0,114,101,121,110,0,112,115,105,32,115,101,99,0,115,108,
+117,103,0,108,98,102,32,115,94,50,32,47,32,102,116,0,115,108,117,103,
+102,0,115,108,117,103,32,102,111,114,99,101,0,115,108,105,110,99,104,0,
+108,98,102,32,115,94,50,32,47,32,105,110,99,104,0,115,108,105,110,99,
+104,102,0,115,108,105,110,99,104,32,102,111,114,99,101,0,103,101,101,112,
+111,117,110,100,0,115,108,117,103,0,108,98,102,0,108,98,32,102,111,114,
+99,101,0,116,111,110,102,0,116,111,110,32,102,111,114,99,101,0,108,98,
+109,0,108,98,0,107,105,112,0,49,48,48,48,32,108,98,102,0,107,115,
+105,0,107,105,112,32,47,32,105,110,94,50,0,109,105,108,0,48,46,48,
+48,49,32,105,110,99,104,0,116,104,111,117,0,48,46,48,48,49,32,105,
+110,99,104,0,99,105,114,99,117,108,97,114,105,110,99,104,0,49,124,52,
+32,112,105,32,105,110,94,50,0,99,105,114,99,108,101,105,110,99,104,0,
+99,105,114,99,117,108,97,114,105,110,99,104,0,99,121,108,105,110,100,101,
+114,105,110,99,104,0,99,105,114,99,108,101,105,110,99,104,32,105,110,99,
+104,0,99,105,114,99,117,108,97,114,109,105,108,0,49,124,52,32,112,105,
+32,109,105,108,94,50,0,99,109,105,108,0,99,105,114,99,117,108,97,114,
+109,105,108,0,99,101,110,116,97,108,0,49,48,48,32,112,111,117,110,100,
+0,99,101,110,116,110,101,114,0,99,101,110,116,97,108,0,99,97,108,105,
+98,101,114,0,48,46,48,49,32,105,110,99,104,0,100,117,116,121,0,102,
+116,32,108,98,102,0,99,101,108,111,0,102,116,32,47,32,115,94,50,0,
+106,101,114,107,0,102,116,32,47,32,115,94,51,0,97,117,115,116,114,97,
+108,105,97,112,111,105,110,116,0,48,46,48,49,32,105,110,99,104,0,115,
+97,98,105,110,0,102,116,94,50,0,115,116,97,110,100,97,114,100,103,97,
+117,103,101,0,52,32,102,116,32,43,32,56,46,53,32,105,110,0,102,108,
+97,103,0,53,32,102,116,94,50,0,114,111,108,108,119,97,108,108,112,97,
+112,101,114,0,51,48,32,102,116,94,50,0,102,105,108,108,112,111,119,101,
+114,0,105,110,94,51,32,47,32,111,117,110,99,101,0,112,105,110,108,101,
+110,103,116,104,0,49,124,49,54,32,105,110,99,104,0,98,117,116,116,111,
+110,108,105,110,101,0,49,124,52,48,32,105,110,99,104,0,115,99,111,111,
+112,110,117,109,98,101,114,0,47,113,117,97,114,116,0,98,101,101,115,112,
+97,99,101,0,49,124,52,32,105,110,99,104,0,100,105,97,109,111,110,100,
+0,56,124,53,32,102,116,0,114,101,116,109,97,117,110,105,116,0,49,46,
+55,53,32,105,110,0,85,0,114,101,116,109,97,117,110,105,116,0,82,85,
+0,85,0,69,78,69,82,71,89,0,106,111,117,108,101,0,87,79,82,75,
+0,106,111,117,108,101,0,99,97,108,95,73,84,0,52,46,49,56,54,56,
+32,74,0,99,97,108,95,116,104,0,52,46,49,56,52,32,74,0,99,97,
+108,95,102,105,102,116,101,101,110,0,52,46,49,56,53,56,48,32,74,0,
+99,97,108,95,116,119,101,110,116,121,0,52,46,49,56,49,57,48,32,74,
+0,99,97,108,95,109,101,97,110,0,52,46,49,57,48,48,50,32,74,0,
+99,97,108,111,114,105,101,0,99,97,108,95,73,84,0,99,97,108,0,99,
+97,108,111,114,105,101,0,99,97,108,111,114,105,101,95,73,84,0,99,97,
+108,95,73,84,0,116,104,101,114,109,99,97,108,111,114,105,101,0,99,97,
+108,95,116,104,0,99,97,108,111,114,105,101,95,116,104,0,116,104,101,114,
+109,99,97,108,111,114,105,101,0,67,97,108,111,114,105,101,0,107,105,108,
+111,99,97,108,111,114,105,101,0,116,104,101,114,109,105,101,0,49,101,54,
+32,99,97,108,95,102,105,102,116,101,101,110,0,98,116,117,0,99,97,108,
+32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,75,0,98,114,
+105,116,105,115,104,116,104,101,114,109,97,108,117,110,105,116,0,98,116,117,
+0,98,116,117,95,73,84,0,98,116,117,0,98,116,117,95,116,104,0,99,
+97,108,95,116,104,32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,
+32,75,0,98,116,117,95,109,101,97,110,0,99,97,108,95,109,101,97,110,
+32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,75,0,113,117,
+97,100,0,113,117,97,100,114,105,108,108,105,111,110,32,98,116,117,0,69,
+67,116,104,101,114,109,0,49,46,48,53,53,48,54,101,56,32,74,0,85,
+83,116,104,101,114,109,0,49,46,48,53,52,56,48,52,101,56,32,74,0,
+116,104,101,114,109,0,85,83,116,104,101,114,109,0,116,111,110,111,105,108,
+0,49,101,49,48,32,99,97,108,95,73,84,0,116,111,101,0,116,111,110,
+111,105,108,0,116,111,110,99,111,97,108,0,55,101,57,32,99,97,108,95,
+73,84,0,98,97,114,114,101,108,111,105,108,0,53,46,56,32,77,98,116,
+117,0,110,97,116,117,114,97,108,103,97,115,95,72,72,86,0,49,48,50,
+55,32,98,116,117,47,102,116,51,0,110,97,116,117,114,97,108,103,97,115,
+95,76,72,86,0,57,51,48,32,98,116,117,47,102,116,51,0,110,97,116,
+117,114,97,108,103,97,115,0,110,97,116,117,114,97,108,103,97,115,95,72,
+72,86,0,99,104,97,114,99,111,97,108,0,51,48,32,71,74,47,116,111,
+110,110,101,0,119,111,111,100,101,110,101,114,103,121,95,100,114,121,0,50,
+48,32,71,74,47,116,111,110,110,101,0,119,111,111,100,101,110,101,114,103,
+121,95,97,105,114,100,114,121,0,49,53,32,71,74,47,116,111,110,110,101,
+0,99,111,97,108,95,98,105,116,117,109,105,110,111,117,115,0,50,55,32,
+71,74,32,47,32,116,111,110,110,101,0,99,111,97,108,95,108,105,103,110,
+105,116,101,0,49,53,32,71,74,32,47,32,116,111,110,110,101,0,99,111,
+97,108,95,85,83,0,50,50,32,71,74,32,47,32,116,111,110,0,101,116,
+104,97,110,111,108,95,72,72,86,0,56,52,48,48,48,32,98,116,117,47,
+117,115,103,97,108,108,111,110,0,101,116,104,97,110,111,108,95,76,72,86,
+0,55,53,55,48,48,32,98,116,117,47,117,115,103,97,108,108,111,110,0,
+100,105,101,115,101,108,0,49,51,48,53,48,48,32,98,116,117,47,117,115,
+103,97,108,108,111,110,0,103,97,115,111,108,105,110,101,95,76,72,86,0,
+49,49,53,48,48,48,32,98,116,117,47,117,115,103,97,108,108,111,110,0,
+103,97,115,111,108,105,110,101,95,72,72,86,0,49,50,53,48,48,48,32,
+98,116,117,47,117,115,103,97,108,108,111,110,0,103,97,115,111,108,105,110,
+101,0,103,97,115,111,108,105,110,101,95,72,72,86,0,104,101,97,116,105,
+110,103,0,51,55,46,51,32,77,74,47,108,105,116,101,114,0,102,117,101,
+108,111,105,108,0,51,57,46,55,32,77,74,47,108,105,116,101,114,0,112,
+114,111,112,97,110,101,0,57,51,46,51,32,77,74,47,109,94,51,0,98,
+117,116,97,110,101,0,49,50,52,32,77,74,47,109,94,51,0,117,114,97,
+110,105,117,109,95,112,117,114,101,0,50,48,48,32,77,101,86,32,97,118,
+111,103,97,100,114,111,32,47,32,40,50,51,53,46,48,52,51,57,50,57,
+57,32,103,47,109,111,108,41,0,117,114,97,110,105,117,109,95,110,97,116,
+117,114,97,108,0,48,46,55,37,32,117,114,97,110,105,117,109,95,112,117,
+114,101,0,99,101,108,115,105,117,115,104,101,97,116,117,110,105,116,0,99,
+97,108,32,108,98,32,100,101,103,67,32,47,32,103,114,97,109,32,75,0,
+99,104,117,0,99,101,108,115,105,117,115,104,101,97,116,117,110,105,116,0,
+80,79,87,69,82,0,119,97,116,116,0,117,115,104,111,114,115,101,112,111,
+119,101,114,0,53,53,48,32,102,111,111,116,32,112,111,117,110,100,32,102,
+111,114,99,101,32,47,32,115,101,99,0,104,112,0,104,111,114,115,101,112,
+111,119,101,114,0,109,101,116,114,105,99,104,111,114,115,101,112,111,119,101,
+114,0,55,53,32,107,105,108,111,103,114,97,109,32,102,111,114,99,101,32,
+109,101,116,101,114,32,47,32,115,101,99,0,101,108,101,99,116,114,105,99,
+104,111,114,115,101,112,111,119,101,114,0,55,52,54,32,87,0,98,111,105,
+108,101,114,104,111,114,115,101,112,111,119,101,114,0,57,56,48,57,46,53,
+48,32,87,0,119,97,116,101,114,104,111,114,115,101,112,111,119,101,114,0,
+55,52,54,46,48,52,51,32,87,0,98,114,104,111,114,115,101,112,111,119,
+101,114,0,55,52,53,46,55,48,32,87,0,100,111,110,107,101,121,112,111,
+119,101,114,0,50,53,48,32,87,0,99,104,101,118,97,108,118,97,112,101,
+117,114,0,109,101,116,114,105,99,104,111,114,115,101,112,111,119,101,114,0,
+84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,78,67,69,0,
+80,79,87,69,82,47,65,82,69,65,32,40,84,69,77,80,69,82,65,84,
+85,82,69,95,68,73,70,70,69,82,69,78,67,69,47,76,69,78,71,84,
+72,41,0,84,72,69,82,77,65,76,95,73,78,83,85,76,65,78,67,69,
+0,49,47,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,78,
+67,69,0,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,73,86,
+73,84,89,0,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,
+78,67,69,32,47,32,76,69,78,71,84,72,0,84,72,69,82,77,65,76,
+95,73,78,83,85,76,65,84,73,79,78,0,84,72,69,82,77,65,76,95,
+73,78,83,85,76,65,78,67,69,32,76,69,78,71,84,72,0,82,118,97,
+108,117,101,0,100,101,103,70,32,102,116,94,50,32,104,114,32,47,32,98,
+116,117,0,85,118,97,108,117,101,0,49,47,82,118,97,108,117,101,0,101,
+117,114,111,112,101,97,110,85,118,97,108,117,101,0,119,97,116,116,32,47,
+32,109,94,50,32,75,0,82,83,73,0,100,101,103,67,32,109,94,50,32,
+47,32,87,0,99,108,111,0,48,46,49,53,53,32,100,101,103,67,32,109,
+94,50,32,47,32,87,0,116,111,103,0,48,46,49,32,100,101,103,67,32,
+109,94,50,32,47,32,87,0,69,78,84,82,79,80,89,0,69,78,69,82,
+71,89,32,47,32,84,69,77,80,69,82,65,84,85,82,69,0,99,108,97,
+117,115,105,117,115,0,49,101,51,32,99,97,108,47,75,0,108,97,110,103,
+108,101,121,0,116,104,101,114,109,99,97,108,111,114,105,101,47,99,109,94,
+50,0,112,111,110,99,101,108,101,116,0,49,48,48,32,107,103,32,102,111,
+114,99,101,32,109,32,47,32,115,0,116,111,110,114,101,102,114,105,103,101,
+114,97,116,105,111,110,0,116,111,110,32,49,52,52,32,98,116,117,32,47,
+32,108,98,32,100,97,121,0,116,111,110,114,101,102,0,116,111,110,114,101,
+102,114,105,103,101,114,97,116,105,111,110,0,114,101,102,114,105,103,101,114,
+97,116,105,111,110,0,116,111,110,114,101,102,32,47,32,116,111,110,0,102,
+114,105,103,111,114,105,101,0,49,48,48,48,32,99,97,108,95,102,105,102,
+116,101,101,110,0,116,110,116,0,49,101,57,32,99,97,108,95,116,104,32,
+47,32,116,111,110,0,97,105,114,119,97,116,116,0,56,46,53,32,40,102,
+116,94,51,47,109,105,110,41,32,105,110,72,50,79,0,112,101,114,109,95,
+48,67,0,103,114,97,105,110,32,47,32,104,114,32,102,116,94,50,32,105,
+110,72,103,0,112,101,114,109,95,122,101,114,111,0,112,101,114,109,95,48,
+67,0,112,101,114,109,95,48,0,112,101,114,109,95,48,67,0,112,101,114,
+109,0,112,101,114,109,95,48,67,0,112,101,114,109,95,50,51,67,0,103,
+114,97,105,110,32,47,32,104,114,32,102,116,94,50,32,105,110,32,72,103,
+50,51,67,0,112,101,114,109,95,116,119,101,110,116,121,116,104,114,101,101,
+0,112,101,114,109,95,50,51,67,0,112,97,105,114,0,50,0,98,114,97,
+99,101,0,50,0,110,101,115,116,0,51,0,104,97,116,116,114,105,99,107,
+0,51,0,100,105,99,107,101,114,0,49,48,0,100,111,122,101,110,0,49,
+50,0,98,97,107,101,114,115,100,111,122,101,110,0,49,51,0,115,99,111,
+114,101,0,50,48,0,102,108,111,99,107,0,52,48,0,116,105,109,101,114,
+0,52,48,0,115,104,111,99,107,0,54,48,0,116,111,110,99,111,117,110,
+116,0,49,48,48,0,108,111,110,103,104,117,110,100,114,101,100,0,49,50,
+48,0,103,114,111,115,115,0,49,52,52,0,103,114,101,97,116,103,114,111,
+115,115,0,49,50,32,103,114,111,115,115,0,116,105,116,104,101,0,49,124,
+49,48,0,115,104,111,114,116,113,117,105,114,101,0,50,52,0,113,117,105,
+114,101,0,50,53,0,115,104,111,114,116,114,101,97,109,0,52,56,48,0,
+114,101,97,109,0,53,48,48,0,112,101,114,102,101,99,116,114,101,97,109,
+0,53,49,54,0,98,117,110,100,108,101,0,50,32,114,101,97,109,115,0,
+98,97,108,101,0,53,32,98,117,110,100,108,101,115,0,108,101,116,116,101,
+114,115,105,122,101,0,56,46,53,32,105,110,99,104,32,49,49,32,105,110,
+99,104,0,108,101,103,97,108,115,105,122,101,0,56,46,53,32,105,110,99,
+104,32,49,52,32,105,110,99,104,0,108,101,100,103,101,114,115,105,122,101,
+0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,104,0,101,120,101,
+99,117,116,105,118,101,115,105,122,101,0,55,46,50,53,32,105,110,99,104,
+32,49,48,46,53,32,105,110,99,104,0,65,112,97,112,101,114,0,56,46,
+53,32,105,110,99,104,32,49,49,32,105,110,99,104,0,66,112,97,112,101,
+114,0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,104,0,67,112,
+97,112,101,114,0,49,55,32,105,110,99,104,32,50,50,32,105,110,99,104,
+0,68,112,97,112,101,114,0,50,50,32,105,110,99,104,32,51,52,32,105,
+110,99,104,0,69,112,97,112,101,114,0,51,52,32,105,110,99,104,32,52,
+52,32,105,110,99,104,0,112,111,105,110,116,116,104,105,99,107,110,101,115,
+115,0,109,105,108,0,65,48,112,97,112,101,114,0,56,52,49,32,109,109,
+32,49,49,56,57,32,109,109,0,65,49,112,97,112,101,114,0,53,57,52,
+32,109,109,32,32,56,52,49,32,109,109,0,65,50,112,97,112,101,114,0,
+52,50,48,32,109,109,32,32,53,57,52,32,109,109,0,65,51,112,97,112,
+101,114,0,50,57,55,32,109,109,32,32,52,50,48,32,109,109,0,65,52,
+112,97,112,101,114,0,50,49,48,32,109,109,32,32,50,57,55,32,109,109,
+0,65,53,112,97,112,101,114,0,49,52,56,32,109,109,32,32,50,49,48,
+32,109,109,0,65,54,112,97,112,101,114,0,49,48,53,32,109,109,32,32,
+49,52,56,32,109,109,0,65,55,112,97,112,101,114,0,55,52,32,109,109,
+32,32,49,48,53,32,109,109,0,65,56,112,97,112,101,114,0,53,50,32,
+109,109,32,32,32,55,52,32,109,109,0,65,57,112,97,112,101,114,0,51,
+55,32,109,109,32,32,32,53,50,32,109,109,0,65,49,48,112,97,112,101,
+114,0,50,54,32,109,109,32,32,32,51,55,32,109,109,0,66,48,112,97,
+112,101,114,0,49,48,48,48,32,109,109,32,49,52,49,52,32,109,109,0,
+66,49,112,97,112,101,114,0,55,48,55,32,109,109,32,49,48,48,48,32,
+109,109,0,66,50,112,97,112,101,114,0,53,48,48,32,109,109,32,32,55,
+48,55,32,109,109,0,66,51,112,97,112,101,114,0,51,53,51,32,109,109,
+32,32,53,48,48,32,109,109,0,66,52,112,97,112,101,114,0,50,53,48,
+32,109,109,32,32,51,53,51,32,109,109,0,66,53,112,97,112,101,114,0,
+49,55,54,32,109,109,32,32,50,53,48,32,109,109,0,66,54,112,97,112,
+101,114,0,49,50,53,32,109,109,32,32,49,55,54,32,109,109,0,66,55,
+112,97,112,101,114,0,56,56,32,109,109,32,32,49,50,53,32,109,109,0,
+66,56,112,97,112,101,114,0,54,50,32,109,109,32,32,32,56,56,32,109,
+109,0,66,57,112,97,112,101,114,0,52,52,32,109,109,32,32,32,54,50,
+32,109,109,0,66,49,48,112,97,112,101,114,0,51,49,32,109,109,32,32,
+32,52,52,32,109,109,0,67,48,112,97,112,101,114,0,57,49,55,32,109,
+109,32,49,50,57,55,32,109,109,0,67,49,112,97,112,101,114,0,54,52,
+56,32,109,109,32,32,57,49,55,32,109,109,0,67,50,112,97,112,101,114,
+0,52,53,56,32,109,109,32,32,54,52,56,32,109,109,0,67,51,112,97,
+112,101,114,0,51,50,52,32,109,109,32,32,52,53,56,32,109,109,0,67,
+52,112,97,112,101,114,0,50,50,57,32,109,109,32,32,51,50,52,32,109,
+109,0,67,53,112,97,112,101,114,0,49,54,50,32,109,109,32,32,50,50,
+57,32,109,109,0,67,54,112,97,112,101,114,0,49,49,52,32,109,109,32,
+32,49,54,50,32,109,109,0,67,55,112,97,112,101,114,0,56,49,32,109,
+109,32,32,49,49,52,32,109,109,0,67,56,112,97,112,101,114,0,53,55,
+32,109,109,32,32,32,56,49,32,109,109,0,67,57,112,97,112,101,114,0,
+52,48,32,109,109,32,32,32,53,55,32,109,109,0,67,49,48,112,97,112,
+101,114,0,50,56,32,109,109,32,32,32,52,48,32,109,109,0,103,115,109,
+0,103,114,97,109,115,32,47,32,109,101,116,101,114,94,50,0,112,111,117,
+110,100,98,111,111,107,112,97,112,101,114,0,108,98,32,47,32,50,53,32,
+105,110,99,104,32,51,56,32,105,110,99,104,32,114,101,97,109,0,108,98,
+98,111,111,107,0,112,111,117,110,100,98,111,111,107,112,97,112,101,114,0,
+112,111,117,110,100,116,101,120,116,112,97,112,101,114,0,112,111,117,110,100,
+98,111,111,107,112,97,112,101,114,0,108,98,116,101,120,116,0,112,111,117,
+110,100,116,101,120,116,112,97,112,101,114,0,112,111,117,110,100,111,102,102,
+115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,111,111,107,112,97,
+112,101,114,0,108,98,111,102,102,115,101,116,0,112,111,117,110,100,111,102,
+102,115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,105,98,108,101,
+112,97,112,101,114,0,112,111,117,110,100,98,111,111,107,112,97,112,101,114,
+0,108,98,98,105,98,108,101,0,112,111,117,110,100,98,105,98,108,101,112,
+97,112,101,114,0,112,111,117,110,100,116,97,103,112,97,112,101,114,0,108,
+98,32,47,32,50,52,32,105,110,99,104,32,51,54,32,105,110,99,104,32,
+114,101,97,109,0,108,98,116,97,103,0,112,111,117,110,100,116,97,103,112,
+97,112,101,114,0,112,111,117,110,100,98,97,103,112,97,112,101,114,0,112,
+111,117,110,100,116,97,103,112,97,112,101,114,0,108,98,98,97,103,0,112,
+111,117,110,100,98,97,103,112,97,112,101,114,0,112,111,117,110,100,110,101,
+119,115,112,114,105,110,116,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,110,101,119,115,112,114,105,110,116,0,112,
+111,117,110,100,110,101,119,115,112,114,105,110,116,112,97,112,101,114,0,112,
+111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,112,111,117,110,
+100,116,97,103,112,97,112,101,114,0,108,98,112,111,115,116,101,114,0,112,
+111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,112,111,117,110,
+100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,116,105,115,115,117,101,0,112,111,117,110,
+100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,110,100,119,114,
+97,112,112,105,110,103,112,97,112,101,114,0,112,111,117,110,100,116,97,103,
+112,97,112,101,114,0,108,98,119,114,97,112,112,105,110,103,0,112,111,117,
+110,100,119,114,97,112,112,105,110,103,112,97,112,101,114,0,112,111,117,110,
+100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,119,97,120,105,110,103,0,112,111,117,110,
+100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,110,100,103,108,
+97,115,115,105,110,101,112,97,112,101,114,0,112,111,117,110,100,116,97,103,
+112,97,112,101,114,0,108,98,103,108,97,115,115,105,110,101,0,112,111,117,
+110,100,103,108,97,115,115,105,110,101,112,97,112,101,114,0,112,111,117,110,
+100,99,111,118,101,114,112,97,112,101,114,0,108,98,32,47,32,50,48,32,
+105,110,99,104,32,50,54,32,105,110,99,104,32,114,101,97,109,0,108,98,
+99,111,118,101,114,0,112,111,117,110,100,99,111,118,101,114,112,97,112,101,
+114,0,112,111,117,110,100,105,110,100,101,120,112,97,112,101,114,0,108,98,
+32,47,32,50,53,46,53,32,105,110,99,104,32,51,48,46,53,32,105,110,
+99,104,32,114,101,97,109,0,108,98,105,110,100,101,120,0,112,111,117,110,
+100,105,110,100,101,120,112,97,112,101,114,0,112,111,117,110,100,105,110,100,
+101,120,98,114,105,115,116,111,108,112,97,112,101,114,0,112,111,117,110,100,
+105,110,100,101,120,112,97,112,101,114,0,108,98,105,110,100,101,120,98,114,
+105,115,116,111,108,0,112,111,117,110,100,105,110,100,101,120,112,97,112,101,
+114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,32,
+47,32,49,55,32,105,110,99,104,32,50,50,32,105,110,99,104,32,114,101,
+97,109,0,108,98,98,111,110,100,0,112,111,117,110,100,98,111,110,100,112,
+97,112,101,114,0,112,111,117,110,100,119,114,105,116,105,110,103,112,97,112,
+101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,
+119,114,105,116,105,110,103,0,112,111,117,110,100,119,114,105,116,105,110,103,
+112,97,112,101,114,0,112,111,117,110,100,108,101,100,103,101,114,112,97,112,
+101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,
+108,101,100,103,101,114,0,112,111,117,110,100,108,101,100,103,101,114,112,97,
+112,101,114,0,112,111,117,110,100,99,111,112,121,112,97,112,101,114,0,112,
+111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,99,111,112,121,
+0,112,111,117,110,100,99,111,112,121,112,97,112,101,114,0,112,111,117,110,
+100,98,108,111,116,116,105,110,103,112,97,112,101,114,0,108,98,32,47,32,
+49,57,32,105,110,99,104,32,50,52,32,105,110,99,104,32,114,101,97,109,
+0,108,98,98,108,111,116,116,105,110,103,0,112,111,117,110,100,98,108,111,
+116,116,105,110,103,112,97,112,101,114,0,112,111,117,110,100,98,108,97,110,
+107,115,112,97,112,101,114,0,108,98,32,47,32,50,50,32,105,110,99,104,
+32,50,56,32,105,110,99,104,32,114,101,97,109,0,108,98,98,108,97,110,
+107,115,0,112,111,117,110,100,98,108,97,110,107,115,112,97,112,101,114,0,
+112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,108,
+98,32,47,32,50,50,46,53,32,105,110,99,104,32,50,56,46,53,32,105,
+110,99,104,32,114,101,97,109,0,108,98,112,111,115,116,99,97,114,100,0,
+112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,112,
+111,117,110,100,119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,
+111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,108,98,
+119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,111,117,110,100,
+119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,111,117,110,100,
+98,114,105,115,116,111,108,112,97,112,101,114,0,112,111,117,110,100,119,101,
+100,100,105,110,103,98,114,105,115,116,111,108,0,108,98,98,114,105,115,116,
+111,108,0,112,111,117,110,100,98,114,105,115,116,111,108,112,97,112,101,114,
+0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,108,98,32,47,32,
+49,48,48,48,32,102,116,94,50,0,108,98,98,111,120,98,111,97,114,100,
+0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,112,111,117,110,100,
+112,97,112,101,114,98,111,97,114,100,0,112,111,117,110,100,98,111,120,98,
+111,97,114,100,0,108,98,112,97,112,101,114,98,111,97,114,100,0,112,111,
+117,110,100,112,97,112,101,114,98,111,97,114,100,0,112,97,112,101,114,77,
+0,108,98,32,47,32,49,48,48,48,0,112,97,112,101,114,100,101,110,115,
+105,116,121,0,48,46,56,32,103,47,99,109,94,51,0,112,97,112,101,114,
+99,97,108,105,112,101,114,0,105,110,32,112,97,112,101,114,100,101,110,115,
+105,116,121,0,112,97,112,101,114,112,111,105,110,116,0,48,46,48,48,49,
+32,105,110,32,112,97,112,101,114,100,101,110,115,105,116,121,0,102,111,117,
+114,110,105,101,114,112,111,105,110,116,0,48,46,49,54,52,56,32,105,110,
+99,104,32,47,32,49,50,0,111,108,100,100,105,100,111,116,112,111,105,110,
+116,0,49,124,55,50,32,102,114,101,110,99,104,105,110,99,104,0,98,101,
+114,116,104,111,108,100,112,111,105,110,116,0,49,124,50,54,54,48,32,109,
+0,73,78,112,111,105,110,116,0,48,46,52,32,109,109,0,103,101,114,109,
+97,110,100,105,100,111,116,112,111,105,110,116,0,48,46,51,55,54,48,54,
+53,32,109,109,0,109,101,116,114,105,99,112,111,105,110,116,0,51,124,56,
+32,109,109,0,111,108,100,112,111,105,110,116,0,49,124,55,50,46,50,55,
+32,105,110,99,104,0,112,114,105,110,116,101,114,115,112,111,105,110,116,0,
+111,108,100,112,111,105,110,116,0,116,101,120,112,111,105,110,116,0,111,108,
+100,112,111,105,110,116,0,116,101,120,115,99,97,108,101,100,112,111,105,110,
+116,0,49,124,54,53,53,51,54,32,116,101,120,112,111,105,110,116,0,116,
+101,120,115,112,0,116,101,120,115,99,97,108,101,100,112,111,105,110,116,0,
+99,111,109,112,117,116,101,114,112,111,105,110,116,0,49,124,55,50,32,105,
+110,99,104,0,112,111,105,110,116,0,99,111,109,112,117,116,101,114,112,111,
+105,110,116,0,99,111,109,112,117,116,101,114,112,105,99,97,0,49,50,32,
+99,111,109,112,117,116,101,114,112,111,105,110,116,0,112,111,115,116,115,99,
+114,105,112,116,112,111,105,110,116,0,99,111,109,112,117,116,101,114,112,111,
+105,110,116,0,112,115,112,111,105,110,116,0,112,111,115,116,115,99,114,105,
+112,116,112,111,105,110,116,0,116,119,105,112,0,49,124,50,48,32,112,111,
+105,110,116,0,81,0,49,124,52,32,109,109,0,102,114,101,110,99,104,112,
+114,105,110,116,101,114,115,112,111,105,110,116,0,111,108,100,100,105,100,111,
+116,112,111,105,110,116,0,100,105,100,111,116,112,111,105,110,116,0,103,101,
+114,109,97,110,100,105,100,111,116,112,111,105,110,116,0,101,117,114,111,112,
+101,97,110,112,111,105,110,116,0,100,105,100,111,116,112,111,105,110,116,0,
+99,105,99,101,114,111,0,49,50,32,100,105,100,111,116,112,111,105,110,116,
+0,115,116,105,99,107,0,50,32,105,110,99,104,101,115,0,101,120,99,101,
+108,115,105,111,114,0,51,32,111,108,100,112,111,105,110,116,0,98,114,105,
+108,108,105,97,110,116,0,51,46,53,32,111,108,100,112,111,105,110,116,0,
+100,105,97,109,111,110,100,116,121,112,101,0,52,32,111,108,100,112,111,105,
+110,116,0,112,101,97,114,108,0,53,32,111,108,100,112,111,105,110,116,0,
+97,103,97,116,101,0,53,46,53,32,111,108,100,112,111,105,110,116,0,114,
+117,98,121,0,97,103,97,116,101,0,110,111,110,112,97,114,101,105,108,0,
+54,32,111,108,100,112,111,105,110,116,0,109,105,103,110,111,110,101,116,116,
+101,0,54,46,53,32,111,108,100,112,111,105,110,116,0,101,109,101,114,97,
+108,100,0,109,105,103,110,111,110,101,116,116,101,0,109,105,110,105,111,110,
+0,55,32,111,108,100,112,111,105,110,116,0,98,114,101,118,105,101,114,0,
+56,32,111,108,100,112,111,105,110,116,0,98,111,117,114,103,101,111,105,115,
+0,57,32,111,108,100,112,111,105,110,116,0,108,111,110,103,112,114,105,109,
+101,114,0,49,48,32,111,108,100,112,111,105,110,116,0,115,109,97,108,108,
+112,105,99,97,0,49,49,32,111,108,100,112,111,105,110,116,0,112,105,99,
+97,0,49,50,32,111,108,100,112,111,105,110,116,0,101,110,103,108,105,115,
+104,0,49,52,32,111,108,100,112,111,105,110,116,0,99,111,108,117,109,98,
+105,97,110,0,49,54,32,111,108,100,112,111,105,110,116,0,103,114,101,97,
+116,112,114,105,109,101,114,0,49,56,32,111,108,100,112,111,105,110,116,0,
+112,97,114,97,103,111,110,0,50,48,32,111,108,100,112,111,105,110,116,0,
+109,101,114,105,100,105,97,110,0,52,52,32,111,108,100,112,111,105,110,116,
+0,99,97,110,111,110,0,52,56,32,111,108,100,112,111,105,110,116,0,110,
+111,110,112,108,117,115,117,108,116,114,97,0,50,32,100,105,100,111,116,112,
+111,105,110,116,0,98,114,105,108,108,97,110,116,0,51,32,100,105,100,111,
+116,112,111,105,110,116,0,100,105,97,109,97,110,116,0,52,32,100,105,100,
+111,116,112,111,105,110,116,0,112,101,114,108,0,53,32,100,105,100,111,116,
+112,111,105,110,116,0,110,111,110,112,97,114,101,105,108,108,101,0,54,32,
+100,105,100,111,116,112,111,105,110,116,0,107,111,108,111,110,101,108,0,55,
+32,100,105,100,111,116,112,111,105,110,116,0,112,101,116,105,116,0,56,32,
+100,105,100,111,116,112,111,105,110,116,0,98,111,114,103,105,115,0,57,32,
+100,105,100,111,116,112,111,105,110,116,0,107,111,114,112,117,115,0,49,48,
+32,100,105,100,111,116,112,111,105,110,116,0,99,111,114,112,117,115,0,107,
+111,114,112,117,115,0,103,97,114,97,109,111,110,100,0,107,111,114,112,117,
+115,0,109,105,116,116,101,108,0,49,52,32,100,105,100,111,116,112,111,105,
+110,116,0,116,101,114,116,105,97,0,49,54,32,100,105,100,111,116,112,111,
+105,110,116,0,116,101,120,116,0,49,56,32,100,105,100,111,116,112,111,105,
+110,116,0,107,108,101,105,110,101,95,107,97,110,111,110,0,51,50,32,100,
+105,100,111,116,112,111,105,110,116,0,107,97,110,111,110,0,51,54,32,100,
+105,100,111,116,112,111,105,110,116,0,103,114,111,98,101,95,107,97,110,111,
+110,0,52,50,32,100,105,100,111,116,112,111,105,110,116,0,109,105,115,115,
+97,108,0,52,56,32,100,105,100,111,116,112,111,105,110,116,0,107,108,101,
+105,110,101,95,115,97,98,111,110,0,55,50,32,100,105,100,111,116,112,111,
+105,110,116,0,103,114,111,98,101,95,115,97,98,111,110,0,56,52,32,100,
+105,100,111,116,112,111,105,110,116,0,73,78,70,79,82,77,65,84,73,79,
+78,0,98,105,116,0,110,97,116,0,108,110,40,50,41,32,98,105,116,115,
+0,104,97,114,116,108,101,121,0,108,111,103,50,40,49,48,41,32,98,105,
+116,115,0,98,112,115,0,98,105,116,47,115,101,99,0,98,121,116,101,0,
+56,32,98,105,116,0,66,0,98,121,116,101,0,111,99,116,101,116,0,56,
+32,98,105,116,115,0,110,121,98,98,108,101,0,52,32,98,105,116,115,0,
+110,105,98,98,108,101,0,110,121,98,98,108,101,0,110,121,112,0,50,32,
+98,105,116,115,0,109,101,103,0,109,101,103,97,98,121,116,101,0,103,105,
+103,0,103,105,103,97,98,121,116,101,0,106,105,102,102,121,0,48,46,48,
+49,32,115,101,99,0,106,105,102,102,105,101,115,0,106,105,102,102,121,0,
+99,100,97,117,100,105,111,115,112,101,101,100,0,52,52,46,49,32,107,72,
+122,32,50,42,49,54,32,98,105,116,115,0,99,100,114,111,109,115,112,101,
+101,100,0,55,53,32,50,48,52,56,32,98,121,116,101,115,32,47,32,115,
+101,99,0,100,118,100,115,112,101,101,100,0,49,51,56,53,32,107,66,47,
+115,0,111,99,116,97,118,101,0,50,0,109,97,106,111,114,115,101,99,111,
+110,100,0,109,117,115,105,99,97,108,102,105,102,116,104,94,50,32,47,32,
+111,99,116,97,118,101,0,109,97,106,111,114,116,104,105,114,100,0,53,124,
+52,0,109,105,110,111,114,116,104,105,114,100,0,54,124,53,0,109,117,115,
+105,99,97,108,102,111,117,114,116,104,0,52,124,51,0,109,117,115,105,99,
+97,108,102,105,102,116,104,0,51,124,50,0,109,97,106,111,114,115,105,120,
+116,104,0,109,117,115,105,99,97,108,102,111,117,114,116,104,32,109,97,106,
+111,114,116,104,105,114,100,0,109,105,110,111,114,115,105,120,116,104,0,109,
+117,115,105,99,97,108,102,111,117,114,116,104,32,109,105,110,111,114,116,104,
+105,114,100,0,109,97,106,111,114,115,101,118,101,110,116,104,0,109,117,115,
+105,99,97,108,102,105,102,116,104,32,109,97,106,111,114,116,104,105,114,100,
+0,109,105,110,111,114,115,101,118,101,110,116,104,0,109,117,115,105,99,97,
+108,102,105,102,116,104,32,109,105,110,111,114,116,104,105,114,100,0,112,121,
+116,104,97,103,111,114,101,97,110,116,104,105,114,100,0,109,97,106,111,114,
+115,101,99,111,110,100,32,109,117,115,105,99,97,108,102,105,102,116,104,94,
+50,32,47,32,111,99,116,97,118,101,0,115,121,110,116,111,110,105,99,99,
+111,109,109,97,0,112,121,116,104,97,103,111,114,101,97,110,116,104,105,114,
+100,32,47,32,109,97,106,111,114,116,104,105,114,100,0,112,121,116,104,97,
+103,111,114,101,97,110,99,111,109,109,97,0,109,117,115,105,99,97,108,102,
+105,102,116,104,94,49,50,32,47,32,111,99,116,97,118,101,94,55,0,115,
+101,109,105,116,111,110,101,0,111,99,116,97,118,101,94,40,49,124,49,50,
+41,0,119,104,111,108,101,110,111,116,101,0,33,0,77,85,83,73,67,65,
+76,95,78,79,84,69,95,76,69,78,71,84,72,0,119,104,111,108,101,110,
+111,116,101,0,104,97,108,102,110,111,116,101,0,49,124,50,32,119,104,111,
+108,101,110,111,116,101,0,113,117,97,114,116,101,114,110,111,116,101,0,49,
+124,52,32,119,104,111,108,101,110,111,116,101,0,101,105,103,104,116,104,110,
+111,116,101,0,49,124,56,32,119,104,111,108,101,110,111,116,101,0,115,105,
+120,116,101,101,110,116,104,110,111,116,101,0,49,124,49,54,32,119,104,111,
+108,101,110,111,116,101,0,116,104,105,114,116,121,115,101,99,111,110,100,110,
+111,116,101,0,49,124,51,50,32,119,104,111,108,101,110,111,116,101,0,115,
+105,120,116,121,102,111,117,114,116,104,110,111,116,101,0,49,124,54,52,32,
+119,104,111,108,101,110,111,116,101,0,100,111,116,116,101,100,0,51,124,50,
+0,100,111,117,98,108,101,100,111,116,116,101,100,0,55,124,52,0,98,114,
+101,118,101,0,100,111,117,98,108,101,119,104,111,108,101,110,111,116,101,0,
+115,101,109,105,98,114,101,118,101,0,119,104,111,108,101,110,111,116,101,0,
+109,105,110,105,109,110,111,116,101,0,104,97,108,102,110,111,116,101,0,99,
+114,111,116,99,104,101,116,0,113,117,97,114,116,101,114,110,111,116,101,0,
+113,117,97,118,101,114,0,101,105,103,104,116,104,110,111,116,101,0,115,101,
+109,105,113,117,97,118,101,114,0,115,105,120,116,101,101,110,116,104,110,111,
+116,101,0,100,101,109,105,115,101,109,105,113,117,97,118,101,114,0,116,104,
+105,114,116,121,115,101,99,111,110,100,110,111,116,101,0,104,101,109,105,100,
+101,109,105,115,101,109,105,113,117,97,118,101,114,0,115,105,120,116,121,102,
+111,117,114,116,104,110,111,116,101,0,115,101,109,105,100,101,109,105,115,101,
+109,105,113,117,97,118,101,114,0,104,101,109,105,100,101,109,105,115,101,109,
+105,113,117,97,118,101,114,0,119,111,111,108,121,97,114,110,114,117,110,0,
+49,54,48,48,32,121,97,114,100,47,112,111,117,110,100,0,121,97,114,110,
+99,117,116,0,51,48,48,32,121,97,114,100,47,112,111,117,110,100,0,99,
+111,116,116,111,110,121,97,114,110,99,111,117,110,116,0,56,52,48,32,121,
+97,114,100,47,112,111,117,110,100,0,108,105,110,101,110,121,97,114,110,99,
+111,117,110,116,0,51,48,48,32,121,97,114,100,47,112,111,117,110,100,0,
+119,111,114,115,116,101,100,121,97,114,110,99,111,117,110,116,0,49,54,56,
+48,32,102,116,47,112,111,117,110,100,0,109,101,116,114,105,99,121,97,114,
+110,99,111,117,110,116,0,109,101,116,101,114,47,103,114,97,109,0,100,101,
+110,105,101,114,0,49,124,57,32,116,101,120,0,109,97,110,99,104,101,115,
+116,101,114,121,97,114,110,110,117,109,98,101,114,0,100,114,97,109,115,47,
+49,48,48,48,32,121,97,114,100,115,0,112,108,105,0,108,98,47,105,110,
+0,116,121,112,112,0,49,48,48,48,32,121,100,47,108,98,0,97,115,98,
+101,115,116,111,115,99,117,116,0,49,48,48,32,121,100,47,108,98,0,116,
+101,120,0,103,114,97,109,32,47,32,107,109,0,100,114,101,120,0,48,46,
+49,32,116,101,120,0,112,111,117,109,97,114,0,108,98,32,47,32,49,101,
+54,32,121,97,114,100,0,115,107,101,105,110,99,111,116,116,111,110,0,56,
+48,42,53,52,32,105,110,99,104,0,99,111,116,116,111,110,98,111,108,116,
+0,49,50,48,32,102,116,0,119,111,111,108,98,111,108,116,0,50,49,48,
+32,102,116,0,98,111,108,116,0,99,111,116,116,111,110,98,111,108,116,0,
+104,101,101,114,0,54,48,48,32,121,97,114,100,115,0,99,117,116,0,51,
+48,48,32,121,97,114,100,115,0,108,101,97,0,51,48,48,32,121,97,114,
+100,115,0,115,97,105,108,109,97,107,101,114,115,121,97,114,100,0,50,56,
+46,53,32,105,110,0,115,97,105,108,109,97,107,101,114,115,111,117,110,99,
+101,0,111,122,32,47,32,115,97,105,108,109,97,107,101,114,115,121,97,114,
+100,32,51,54,32,105,110,99,104,0,115,105,108,107,109,111,109,109,101,0,
+109,111,109,109,101,32,47,32,50,53,32,121,97,114,100,115,32,49,46,52,
+57,32,105,110,99,104,0,115,105,108,107,109,109,0,115,105,108,107,109,111,
+109,109,101,0,109,99,103,0,109,105,99,114,111,103,114,97,109,0,105,117,
+100,105,112,116,104,101,114,105,97,0,54,50,46,56,32,109,105,99,114,111,
+103,114,97,109,0,105,117,112,101,110,105,99,105,108,108,105,110,0,48,46,
+54,32,109,105,99,114,111,103,114,97,109,0,105,117,105,110,115,117,108,105,
+110,0,52,49,46,54,55,32,109,105,99,114,111,103,114,97,109,0,100,114,
+111,112,0,49,124,50,48,32,109,108,0,98,108,111,111,100,117,110,105,116,
+0,52,53,48,32,109,108,0,102,114,101,110,99,104,99,97,116,104,101,116,
+101,114,115,105,122,101,0,49,124,51,32,109,109,0,104,101,99,116,97,114,
+101,0,104,101,99,116,111,97,114,101,0,109,101,103,111,104,109,0,109,101,
+103,97,111,104,109,0,107,105,108,111,104,109,0,107,105,108,111,111,104,109,
+0,109,105,99,114,111,104,109,0,109,105,99,114,111,111,104,109,0,109,101,
+103,97,108,101,114,103,0,109,101,103,97,101,114,103,0,36,0,100,111,108,
+108,97,114,0,109,97,114,107,0,103,101,114,109,97,110,121,109,97,114,107,
+0,98,111,108,105,118,97,114,0,118,101,110,101,122,117,101,108,97,98,111,
+108,105,118,97,114,0,98,111,108,105,118,97,114,102,117,101,114,116,101,0,
+98,111,108,105,118,97,114,0,111,108,100,98,111,108,105,118,97,114,0,49,
+124,49,48,48,48,32,98,111,108,105,118,97,114,0,112,101,115,101,116,97,
+0,115,112,97,105,110,112,101,115,101,116,97,0,114,97,110,100,0,115,111,
+117,116,104,97,102,114,105,99,97,114,97,110,100,0,101,115,99,117,100,111,
+0,112,111,114,116,117,103,97,108,101,115,99,117,100,111,0,103,117,105,108,
+100,101,114,0,110,101,116,104,101,114,108,97,110,100,115,103,117,105,108,100,
+101,114,0,104,111,108,108,97,110,100,103,117,105,108,100,101,114,0,110,101,
+116,104,101,114,108,97,110,100,115,103,117,105,108,100,101,114,0,112,101,115,
+111,0,109,101,120,105,99,111,112,101,115,111,0,121,101,110,0,106,97,112,
+97,110,121,101,110,0,108,105,114,97,0,105,116,97,108,121,108,105,114,97,
+0,114,117,112,101,101,0,105,110,100,105,97,114,117,112,101,101,0,100,114,
+97,99,104,109,97,0,103,114,101,101,99,101,100,114,97,99,104,109,97,0,
+102,114,97,110,99,0,102,114,97,110,99,101,102,114,97,110,99,0,109,97,
+114,107,107,97,0,102,105,110,108,97,110,100,109,97,114,107,107,97,0,98,
+114,105,116,97,105,110,112,111,117,110,100,0,103,114,101,97,116,98,114,105,
+116,97,105,110,112,111,117,110,100,0,112,111,117,110,100,115,116,101,114,108,
+105,110,103,0,98,114,105,116,97,105,110,112,111,117,110,100,0,121,117,97,
+110,0,99,104,105,110,97,121,117,97,110,0,97,117,115,116,114,105,97,115,
+99,104,105,108,108,105,110,103,0,49,124,49,51,46,55,54,48,51,32,101,
+117,114,111,0,98,101,108,103,105,117,109,102,114,97,110,99,0,49,124,52,
+48,46,51,51,57,57,32,101,117,114,111,0,101,115,116,111,110,105,97,107,
+114,111,111,110,0,49,124,49,53,46,54,52,54,54,32,101,117,114,111,0,
+102,105,110,108,97,110,100,109,97,114,107,107,97,0,49,124,53,46,57,52,
+53,55,51,32,101,117,114,111,0,102,114,97,110,99,101,102,114,97,110,99,
+0,49,124,54,46,53,53,57,53,55,32,101,117,114,111,0,103,101,114,109,
+97,110,121,109,97,114,107,0,49,124,49,46,57,53,53,56,51,32,101,117,
+114,111,0,103,114,101,101,99,101,100,114,97,99,104,109,97,0,49,124,51,
+52,48,46,55,53,32,101,117,114,111,0,105,114,101,108,97,110,100,112,117,
+110,116,0,49,124,48,46,55,56,55,53,54,52,32,101,117,114,111,0,105,
+116,97,108,121,108,105,114,97,0,49,124,49,57,51,54,46,50,55,32,101,
+117,114,111,0,108,117,120,101,109,98,111,117,114,103,102,114,97,110,99,0,
+49,124,52,48,46,51,51,57,57,32,101,117,114,111,0,110,101,116,104,101,
+114,108,97,110,100,115,103,117,105,108,100,101,114,0,49,124,50,46,50,48,
+51,55,49,32,101,117,114,111,0,112,111,114,116,117,103,97,108,101,115,99,
+117,100,111,0,49,124,50,48,48,46,52,56,50,32,101,117,114,111,0,115,
+112,97,105,110,112,101,115,101,116,97,0,49,124,49,54,54,46,51,56,54,
+32,101,117,114,111,0,99,121,112,114,117,115,112,111,117,110,100,0,49,124,
+48,46,53,56,53,50,55,52,32,101,117,114,111,0,109,97,108,116,97,108,
+105,114,97,0,49,124,48,46,52,50,57,51,48,48,32,101,117,114,111,0,
+115,108,111,118,101,110,105,97,116,111,108,97,114,0,49,124,50,51,57,46,
+54,52,48,32,101,117,114,111,0,115,108,111,118,97,107,105,97,107,111,114,
+117,110,97,0,49,124,51,48,46,49,50,54,48,32,101,117,114,111,0,117,
+110,105,116,101,100,97,114,97,98,101,109,105,114,97,116,101,115,100,105,114,
+104,97,109,0,48,46,50,55,50,50,32,85,83,36,0,97,102,103,104,97,
+110,105,115,116,97,110,97,102,103,104,97,110,105,0,48,46,48,50,50,50,
+52,32,85,83,36,0,97,108,98,97,110,105,97,108,101,107,0,48,46,48,
+48,57,57,48,50,32,85,83,36,0,97,114,109,101,110,105,97,100,114,97,
+109,0,48,46,48,48,50,54,52,32,85,83,36,0,110,101,116,104,101,114,
+108,97,110,100,115,97,110,116,105,108,108,101,115,103,117,105,108,100,101,114,
+0,48,46,53,53,56,55,32,85,83,36,0,97,110,103,111,108,97,107,119,
+97,110,122,97,0,48,46,48,49,49,48,56,32,85,83,36,0,97,114,103,
+101,110,116,105,110,97,112,101,115,111,0,48,46,50,54,48,51,32,85,83,
+36,0,97,117,115,116,114,97,108,105,97,100,111,108,108,97,114,0,48,46,
+56,56,53,53,32,85,83,36,0,97,114,117,98,97,103,117,105,108,100,101,
+114,115,0,48,46,53,53,56,55,32,85,83,36,0,97,122,101,114,98,97,
+105,106,97,110,110,101,119,109,97,110,97,116,0,49,46,50,52,52,57,32,
+85,83,36,0,98,111,115,110,105,97,109,97,114,107,97,0,48,46,55,48,
+50,56,32,85,83,36,0,98,97,114,98,97,100,111,115,100,111,108,108,97,
+114,0,48,46,52,57,56,56,32,85,83,36,0,98,97,110,103,108,97,100,
+101,115,104,116,97,107,97,0,48,46,48,49,52,52,53,32,85,83,36,0,
+98,117,108,103,97,114,105,97,108,101,118,0,48,46,55,32,85,83,36,0,
+98,97,104,114,97,105,110,100,105,110,97,114,0,50,46,54,53,50,32,85,
+83,36,0,98,117,114,117,110,100,105,102,114,97,110,99,0,48,46,48,48,
+48,56,50,51,32,85,83,36,0,98,101,114,109,117,100,97,100,111,108,108,
+97,114,0,49,32,85,83,36,0,98,114,117,110,101,105,100,111,108,108,97,
+114,0,48,46,55,48,54,54,32,85,83,36,0,98,111,108,105,118,105,97,
+98,111,108,105,118,105,97,110,111,0,48,46,49,52,50,53,32,85,83,36,
+0,98,114,97,122,105,108,114,101,97,108,0,48,46,53,52,48,52,32,85,
+83,36,0,98,97,104,97,109,97,115,100,111,108,108,97,114,0,49,32,85,
+83,36,0,98,104,117,116,97,110,110,103,117,108,116,114,117,109,0,48,46,
+48,50,49,53,49,32,85,83,36,0,98,111,116,115,119,97,110,97,112,117,
+108,97,0,48,46,49,52,53,53,32,85,83,36,0,98,101,108,97,114,117,
+115,114,117,98,108,101,0,48,46,48,48,48,51,52,53,32,85,83,36,0,
+98,101,108,105,122,101,100,111,108,108,97,114,0,48,46,53,49,50,56,32,
+85,83,36,0,99,97,110,97,100,97,100,111,108,108,97,114,0,48,46,57,
+52,52,52,32,85,83,36,0,99,111,110,103,111,102,114,97,110,99,0,48,
+46,48,48,49,48,57,57,32,85,83,36,0,115,119,105,116,122,101,114,108,
+97,110,100,102,114,97,110,99,0,48,46,57,51,57,49,32,85,83,36,0,
+99,104,105,108,101,112,101,115,111,0,48,46,48,48,49,56,55,49,32,85,
+83,36,0,99,104,105,110,97,121,117,97,110,0,48,46,49,52,54,53,32,
+85,83,36,0,99,111,108,111,109,98,105,97,112,101,115,111,0,48,46,48,
+48,48,53,49,49,32,85,83,36,0,99,111,115,116,97,114,105,99,97,99,
+111,108,111,110,0,48,46,48,48,49,56,48,51,32,85,83,36,0,99,117,
+98,97,112,101,115,111,0,49,32,85,83,36,0,99,97,112,101,118,101,114,
+100,101,101,115,99,117,100,111,0,48,46,48,49,51,53,49,32,85,83,36,
+0,99,122,101,99,104,107,111,114,117,110,121,0,53,46,50,55,55,50,32,
+85,83,36,0,100,106,105,98,111,117,116,105,102,114,97,110,99,0,48,46,
+48,48,53,53,57,53,32,85,83,36,0,100,101,110,109,97,114,107,107,114,
+111,110,101,114,0,49,56,46,52,57,56,32,85,83,36,0,100,111,109,105,
+110,105,99,97,110,114,101,112,117,98,108,105,99,112,101,115,111,0,48,46,
+48,50,55,53,53,32,85,83,36,0,97,108,103,101,114,105,97,100,105,110,
+97,114,0,48,46,48,49,51,55,49,32,85,83,36,0,101,103,121,112,116,
+112,111,117,110,100,0,48,46,49,56,50,50,32,85,83,36,0,101,114,105,
+116,114,101,97,110,97,107,102,97,0,48,46,48,54,54,50,50,32,85,83,
+36,0,101,116,104,105,111,112,105,97,98,105,114,114,0,48,46,48,55,52,
+54,57,32,85,83,36,0,101,117,114,111,0,49,46,51,55,55,52,32,85,
+83,36,0,102,105,106,105,100,111,108,108,97,114,0,48,46,53,48,57,57,
+32,85,83,36,0,102,97,108,107,108,97,110,100,105,115,108,97,110,100,115,
+112,111,117,110,100,0,49,46,53,54,50,56,32,85,83,36,0,103,114,101,
+97,116,98,114,105,116,97,105,110,112,111,117,110,100,0,49,46,53,54,50,
+54,32,85,83,36,0,103,101,111,114,103,105,97,108,97,114,105,0,48,46,
+53,56,53,54,32,85,83,36,0,103,104,97,110,97,99,101,100,105,0,48,
+46,55,48,51,32,85,83,36,0,103,105,98,114,97,108,116,97,114,112,111,
+117,110,100,0,49,46,53,54,50,56,32,85,83,36,0,103,97,109,98,105,
+97,100,97,108,97,115,105,0,48,46,48,51,55,51,55,32,85,83,36,0,
+103,117,105,110,101,97,102,114,97,110,99,0,48,46,48,48,48,49,57,57,
+32,85,83,36,0,103,117,97,116,101,109,97,108,97,113,117,101,116,122,97,
+108,0,48,46,49,50,50,49,32,85,83,36,0,103,117,121,97,110,97,100,
+111,108,108,97,114,0,48,46,48,48,52,56,54,50,32,85,83,36,0,104,
+111,110,103,107,111,110,103,100,111,108,108,97,114,0,48,46,49,50,56,55,
+32,85,83,36,0,104,111,110,100,117,114,97,115,108,101,109,112,105,114,97,
+0,48,46,48,53,50,57,50,32,85,83,36,0,99,114,111,97,116,105,97,
+107,117,110,97,0,48,46,49,56,56,51,32,85,83,36,0,104,97,105,116,
+105,103,111,117,114,100,101,115,0,48,46,48,50,53,49,54,32,85,83,36,
+0,104,117,110,103,97,114,121,102,111,114,105,110,116,0,48,46,48,48,53,
+48,55,53,32,85,83,36,0,105,110,100,111,110,101,115,105,97,114,117,112,
+105,97,104,0,48,46,48,49,48,54,56,32,85,83,36,0,105,115,114,97,
+101,108,110,101,119,115,104,101,107,101,108,0,48,46,50,54,54,55,32,85,
+83,36,0,105,110,100,105,97,114,117,112,101,101,0,48,46,48,50,49,53,
+55,32,85,83,36,0,105,114,97,113,100,105,110,97,114,0,48,46,48,48,
+48,56,53,56,32,85,83,36,0,105,114,97,110,114,105,97,108,0,48,46,
+48,48,48,49,48,50,32,85,83,36,0,105,99,101,108,97,110,100,107,114,
+111,110,97,0,48,46,48,48,55,56,50,50,32,85,83,36,0,106,97,109,
+97,105,99,97,100,111,108,108,97,114,0,48,46,48,49,49,50,50,32,85,
+83,36,0,106,111,114,100,97,110,100,105,110,97,114,0,49,46,52,48,56,
+53,32,85,83,36,0,106,97,112,97,110,121,101,110,0,48,46,48,49,49,
+49,32,85,83,36,0,107,101,110,121,97,115,104,105,108,108,105,110,103,0,
+48,46,48,49,51,49,32,85,83,36,0,107,121,114,103,121,122,115,116,97,
+110,115,111,109,0,48,46,48,50,50,51,57,32,85,83,36,0,99,97,109,
+98,111,100,105,97,114,105,101,108,0,48,46,48,48,48,50,52,32,85,83,
+36,0,99,111,109,111,114,111,115,102,114,97,110,99,0,48,46,48,48,50,
+55,57,57,32,85,83,36,0,110,111,114,116,104,107,111,114,101,97,119,111,
+110,0,48,46,48,48,49,49,49,49,32,85,83,36,0,107,117,119,97,105,
+116,100,105,110,97,114,0,51,46,52,54,57,55,32,85,83,36,0,99,97,
+121,109,97,110,105,115,108,97,110,100,115,100,111,108,108,97,114,0,49,46,
+50,49,56,51,32,85,83,36,0,107,97,122,97,107,104,115,116,97,110,116,
+101,110,103,101,0,48,46,48,48,54,55,52,55,32,85,83,36,0,108,97,
+111,115,107,105,112,0,48,46,48,48,48,49,49,56,32,85,83,36,0,108,
+101,98,97,110,111,110,112,111,117,110,100,0,48,46,48,48,48,54,54,54,
+32,85,83,36,0,115,114,105,108,97,110,107,97,114,117,112,101,101,0,48,
+46,48,48,56,55,49,53,32,85,83,36,0,108,105,98,101,114,105,97,100,
+111,108,108,97,114,0,48,46,48,49,52,48,53,32,85,83,36,0,108,101,
+115,111,116,104,111,109,97,108,111,116,105,0,48,46,49,50,57,55,32,85,
+83,36,0,108,105,116,104,117,97,110,105,97,108,105,116,97,105,0,48,46,
+51,57,57,32,85,83,36,0,108,97,116,118,105,97,108,97,116,97,115,0,
+49,46,57,52,50,49,32,85,83,36,0,108,105,98,121,97,100,105,110,97,
+114,0,48,46,55,57,55,55,32,85,83,36,0,109,111,114,111,99,99,111,
+100,105,114,104,97,109,0,48,46,49,50,50,54,32,85,83,36,0,109,111,
+108,100,111,118,97,108,101,117,0,48,46,48,55,56,48,51,32,85,83,36,
+0,109,97,100,97,103,97,115,99,97,114,97,114,105,97,114,121,0,48,46,
+48,48,48,52,54,56,32,85,83,36,0,109,97,99,101,100,111,110,105,97,
+100,101,110,97,114,0,48,46,48,50,50,51,49,32,85,83,36,0,109,121,
+97,110,109,97,114,107,121,97,116,0,48,46,49,53,51,54,32,85,83,36,
+0,109,111,110,103,111,108,105,97,116,117,103,114,105,107,0,48,46,48,48,
+48,54,57,51,32,85,83,36,0,109,97,99,97,117,112,97,116,97,99,97,
+0,48,46,49,50,53,32,85,83,36,0,109,97,117,114,105,116,97,110,105,
+97,111,117,103,117,105,121,97,0,48,46,48,48,51,56,50,52,32,85,83,
+36,0,109,97,117,114,105,116,105,117,115,114,117,112,101,101,0,48,46,48,
+51,50,55,57,32,85,83,36,0,109,97,108,100,105,118,101,115,114,117,102,
+105,121,97,97,0,48,46,48,55,56,49,51,32,85,83,36,0,109,97,108,
+97,119,105,107,119,97,99,104,97,0,48,46,48,48,54,54,51,50,32,85,
+83,36,0,109,101,120,105,99,111,112,101,115,111,0,48,46,48,55,54,51,
+57,32,85,83,36,0,109,97,108,97,121,115,105,97,114,105,110,103,103,105,
+116,0,48,46,50,57,50,49,32,85,83,36,0,109,111,122,97,109,98,105,
+113,117,101,109,101,116,105,99,97,105,0,48,46,48,51,49,54,32,85,83,
+36,0,110,97,109,105,98,105,97,100,111,108,108,97,114,0,48,46,49,50,
+57,54,32,85,83,36,0,110,105,103,101,114,105,97,110,97,105,114,97,0,
+48,46,48,48,54,54,51,49,32,85,83,36,0,110,105,99,97,114,97,103,
+117,97,99,111,114,100,111,98,97,0,48,46,48,52,55,55,32,85,83,36,
+0,110,111,114,119,97,121,107,114,111,110,101,0,48,46,49,54,57,53,32,
+85,83,36,0,110,101,112,97,108,110,101,112,97,108,114,117,112,101,101,0,
+48,46,48,49,51,52,50,32,85,83,36,0,110,101,119,122,101,97,108,97,
+110,100,100,111,108,108,97,114,0,48,46,54,57,54,55,32,85,83,36,0,
+111,109,97,110,114,105,97,108,0,50,46,53,57,55,49,32,85,83,36,0,
+112,97,110,97,109,97,98,97,108,98,111,97,0,49,32,85,83,36,0,112,
+101,114,117,115,111,108,0,48,46,51,52,56,54,32,85,83,36,0,112,97,
+112,117,97,110,101,119,103,117,105,110,101,97,107,105,110,97,0,48,46,51,
+55,53,52,32,85,83,36,0,112,104,105,108,105,112,112,105,110,101,115,112,
+101,115,111,0,48,46,48,50,49,53,55,32,85,83,36,0,112,97,107,105,
+115,116,97,110,114,117,112,101,101,0,48,46,48,49,49,55,57,32,85,83,
+36,0,112,111,108,97,110,100,122,108,111,116,121,0,48,46,51,51,56,57,
+32,85,83,36,0,112,97,114,97,103,117,97,121,103,117,97,114,97,110,105,
+0,48,46,48,48,48,50,49,51,32,85,83,36,0,113,97,116,97,114,114,
+105,97,108,0,48,46,50,55,52,55,32,85,83,36,0,114,111,109,97,110,
+105,97,108,101,117,0,48,46,51,51,51,56,32,85,83,36,0,115,101,114,
+98,105,97,100,105,110,97,114,0,48,46,48,49,51,57,51,32,85,83,36,
+0,114,117,115,115,105,97,114,117,98,108,101,0,48,46,48,51,51,48,52,
+32,85,83,36,0,114,119,97,110,100,97,102,114,97,110,99,0,48,46,48,
+48,49,55,52,53,32,85,83,36,0,115,97,117,100,105,97,114,97,98,105,
+97,114,105,121,97,108,0,48,46,50,54,54,55,32,85,83,36,0,115,111,
+108,111,109,111,110,105,115,108,97,110,100,115,100,111,108,108,97,114,0,48,
+46,49,50,55,51,32,85,83,36,0,115,101,121,99,104,101,108,108,101,115,
+114,117,112,101,101,0,48,46,48,56,55,53,51,32,85,83,36,0,115,117,
+100,97,110,112,111,117,110,100,0,48,46,52,52,54,52,32,85,83,36,0,
+115,119,101,100,101,110,107,114,111,110,111,114,0,49,51,46,55,49,57,32,
+85,83,36,0,115,105,110,103,97,112,111,114,101,100,111,108,108,97,114,0,
+48,46,55,48,54,53,32,85,83,36,0,115,97,105,110,116,104,101,108,101,
+110,97,112,111,117,110,100,0,49,46,53,54,50,55,32,85,83,36,0,115,
+105,101,114,114,97,108,101,111,110,101,108,101,111,110,101,0,48,46,48,48,
+48,50,53,53,32,85,83,36,0,115,111,109,97,108,105,97,115,104,105,108,
+108,105,110,103,0,48,46,48,48,48,54,54,57,32,85,83,36,0,115,117,
+114,105,110,97,109,101,100,111,108,108,97,114,0,48,46,51,54,51,53,32,
+85,83,36,0,115,97,111,116,111,109,101,100,111,98,114,97,0,54,46,52,
+50,55,101,45,48,53,32,85,83,36,0,101,108,115,97,108,118,97,100,111,
+114,99,111,108,111,110,0,48,46,49,49,52,51,32,85,83,36,0,115,121,
+114,105,97,112,111,117,110,100,0,48,46,48,50,49,55,57,32,85,83,36,
+0,115,119,97,122,105,108,97,110,100,101,109,97,108,97,110,103,101,110,105,
+0,48,46,49,50,57,55,32,85,83,36,0,116,104,97,105,108,97,110,100,
+98,97,104,116,0,48,46,48,51,48,49,54,32,85,83,36,0,116,97,106,
+105,107,105,115,116,97,110,115,111,109,111,110,105,0,48,46,50,50,57,32,
+85,83,36,0,116,117,110,105,115,105,97,100,105,110,97,114,0,48,46,55,
+50,55,53,32,85,83,36,0,116,111,110,103,97,112,97,39,97,110,103,97,
+0,48,46,53,49,55,32,85,83,36,0,116,117,114,107,101,121,110,101,119,
+108,105,114,97,0,48,46,54,53,57,55,32,85,83,36,0,116,114,105,110,
+105,100,97,100,97,110,100,116,111,98,97,103,111,100,111,108,108,97,114,0,
+48,46,49,53,55,57,32,85,83,36,0,116,97,105,119,97,110,100,111,108,
+108,97,114,115,0,48,46,48,51,49,49,57,32,85,83,36,0,116,97,110,
+122,97,110,105,97,115,104,105,108,108,105,110,103,0,48,46,48,48,48,55,
+52,49,32,85,83,36,0,117,107,114,97,105,110,101,104,114,121,118,110,105,
+97,0,48,46,49,50,51,57,32,85,83,36,0,117,103,97,110,100,97,115,
+104,105,108,108,105,110,103,0,48,46,48,48,48,53,48,53,32,85,83,36,
+0,117,110,105,116,101,100,115,116,97,116,101,115,100,111,108,108,97,114,0,
+49,32,85,83,36,0,117,114,117,103,117,97,121,112,101,115,111,0,48,46,
+48,53,48,55,57,32,85,83,36,0,117,122,98,101,107,105,115,116,97,110,
+115,117,109,0,48,46,48,48,48,54,53,51,32,85,83,36,0,118,101,110,
+101,122,117,101,108,97,98,111,108,105,118,97,114,0,48,46,50,51,51,32,
+85,83,36,0,118,105,101,116,110,97,109,100,111,110,103,0,53,46,52,101,
+45,48,53,32,85,83,36,0,118,97,110,117,97,116,117,118,97,116,117,0,
+48,46,48,49,48,48,56,32,85,83,36,0,115,97,109,111,97,116,97,108,
+97,0,48,46,51,56,56,53,32,85,83,36,0,115,105,108,118,101,114,111,
+117,110,99,101,0,49,51,46,51,52,52,32,85,83,36,0,103,111,108,100,
+111,117,110,99,101,0,49,48,55,54,46,54,32,85,83,36,0,101,97,115,
+116,99,97,114,105,98,98,101,97,110,100,111,108,108,97,114,0,48,46,51,
+56,50,52,32,85,83,36,0,112,97,108,108,97,100,105,117,109,111,117,110,
+99,101,0,50,48,55,46,52,32,85,83,36,0,112,108,97,116,105,110,117,
+109,111,117,110,99,101,0,49,49,49,55,46,55,32,85,83,36,0,121,101,
+109,101,110,114,105,97,108,0,48,46,48,48,52,56,53,53,32,85,83,36,
+0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,0,48,46,49,
+50,57,55,32,85,83,36,0,122,97,109,98,105,97,107,119,97,99,104,97,
+0,48,46,48,48,48,50,49,52,32,85,83,36,0,122,105,109,98,97,98,
+119,101,100,111,108,108,97,114,0,48,46,48,48,50,54,52,49,32,85,83,
+36,0,65,69,68,0,117,110,105,116,101,100,97,114,97,98,101,109,105,114,
+97,116,101,115,100,105,114,104,97,109,0,65,70,78,0,97,102,103,104,97,
+110,105,115,116,97,110,97,102,103,104,97,110,105,0,65,76,76,0,97,108,
+98,97,110,105,97,108,101,107,0,65,77,68,0,97,114,109,101,110,105,97,
+100,114,97,109,0,65,78,71,0,110,101,116,104,101,114,108,97,110,100,115,
+97,110,116,105,108,108,101,115,103,117,105,108,100,101,114,0,65,79,65,0,
+97,110,103,111,108,97,107,119,97,110,122,97,0,65,82,83,0,97,114,103,
+101,110,116,105,110,97,112,101,115,111,0,65,85,68,0,97,117,115,116,114,
+97,108,105,97,100,111,108,108,97,114,0,65,87,71,0,97,114,117,98,97,
+103,117,105,108,100,101,114,115,0,65,90,78,0,97,122,101,114,98,97,105,
+106,97,110,110,101,119,109,97,110,97,116,0,66,65,77,0,98,111,115,110,
+105,97,109,97,114,107,97,0,66,66,68,0,98,97,114,98,97,100,111,115,
+100,111,108,108,97,114,0,66,68,84,0,98,97,110,103,108,97,100,101,115,
+104,116,97,107,97,0,66,71,78,0,98,117,108,103,97,114,105,97,108,101,
+118,0,66,72,68,0,98,97,104,114,97,105,110,100,105,110,97,114,0,66,
+73,70,0,98,117,114,117,110,100,105,102,114,97,110,99,0,66,77,68,0,
+98,101,114,109,117,100,97,100,111,108,108,97,114,0,66,78,68,0,98,114,
+117,110,101,105,100,111,108,108,97,114,0,66,79,66,0,98,111,108,105,118,
+105,97,98,111,108,105,118,105,97,110,111,0,66,82,76,0,98,114,97,122,
+105,108,114,101,97,108,0,66,83,68,0,98,97,104,97,109,97,115,100,111,
+108,108,97,114,0,66,84,78,0,98,104,117,116,97,110,110,103,117,108,116,
+114,117,109,0,66,87,80,0,98,111,116,115,119,97,110,97,112,117,108,97,
+0,66,89,82,0,98,101,108,97,114,117,115,114,117,98,108,101,0,66,90,
+68,0,98,101,108,105,122,101,100,111,108,108,97,114,0,67,65,68,0,99,
+97,110,97,100,97,100,111,108,108,97,114,0,67,68,70,0,99,111,110,103,
+111,102,114,97,110,99,0,67,72,70,0,115,119,105,116,122,101,114,108,97,
+110,100,102,114,97,110,99,0,67,76,80,0,99,104,105,108,101,112,101,115,
+111,0,67,78,89,0,99,104,105,110,97,121,117,97,110,0,67,79,80,0,
+99,111,108,111,109,98,105,97,112,101,115,111,0,67,82,67,0,99,111,115,
+116,97,114,105,99,97,99,111,108,111,110,0,67,85,80,0,99,117,98,97,
+112,101,115,111,0,67,86,69,0,99,97,112,101,118,101,114,100,101,101,115,
+99,117,100,111,0,67,90,75,0,99,122,101,99,104,107,111,114,117,110,121,
+0,68,74,70,0,100,106,105,98,111,117,116,105,102,114,97,110,99,0,68,
+75,75,0,100,101,110,109,97,114,107,107,114,111,110,101,114,0,68,79,80,
+0,100,111,109,105,110,105,99,97,110,114,101,112,117,98,108,105,99,112,101,
+115,111,0,68,90,68,0,97,108,103,101,114,105,97,100,105,110,97,114,0,
+69,69,75,0,101,115,116,111,110,105,97,107,114,111,111,110,0,69,71,80,
+0,101,103,121,112,116,112,111,117,110,100,0,69,82,78,0,101,114,105,116,
+114,101,97,110,97,107,102,97,0,69,84,66,0,101,116,104,105,111,112,105,
+97,98,105,114,114,0,69,85,82,0,101,117,114,111,0,70,74,68,0,102,
+105,106,105,100,111,108,108,97,114,0,70,75,80,0,102,97,108,107,108,97,
+110,100,105,115,108,97,110,100,115,112,111,117,110,100,0,71,66,80,0,103,
+114,101,97,116,98,114,105,116,97,105,110,112,111,117,110,100,0,71,69,76,
+0,103,101,111,114,103,105,97,108,97,114,105,0,71,72,83,0,103,104,97,
+110,97,99,101,100,105,0,71,73,80,0,103,105,98,114,97,108,116,97,114,
+112,111,117,110,100,0,71,77,68,0,103,97,109,98,105,97,100,97,108,97,
+115,105,0,71,78,70,0,103,117,105,110,101,97,102,114,97,110,99,0,71,
+84,81,0,103,117,97,116,101,109,97,108,97,113,117,101,116,122,97,108,0,
+71,89,68,0,103,117,121,97,110,97,100,111,108,108,97,114,0,72,75,68,
+0,104,111,110,103,107,111,110,103,100,111,108,108,97,114,0,72,78,76,0,
+104,111,110,100,117,114,97,115,108,101,109,112,105,114,97,0,72,82,75,0,
+99,114,111,97,116,105,97,107,117,110,97,0,72,84,71,0,104,97,105,116,
+105,103,111,117,114,100,101,115,0,72,85,70,0,104,117,110,103,97,114,121,
+102,111,114,105,110,116,0,73,68,82,0,105,110,100,111,110,101,115,105,97,
+114,117,112,105,97,104,0,73,76,83,0,105,115,114,97,101,108,110,101,119,
+115,104,101,107,101,108,0,73,78,82,0,105,110,100,105,97,114,117,112,101,
+101,0,73,81,68,0,105,114,97,113,100,105,110,97,114,0,73,82,82,0,
+105,114,97,110,114,105,97,108,0,73,83,75,0,105,99,101,108,97,110,100,
+107,114,111,110,97,0,74,77,68,0,106,97,109,97,105,99,97,100,111,108,
+108,97,114,0,74,79,68,0,106,111,114,100,97,110,100,105,110,97,114,0,
+74,80,89,0,106,97,112,97,110,121,101,110,0,75,69,83,0,107,101,110,
+121,97,115,104,105,108,108,105,110,103,0,75,71,83,0,107,121,114,103,121,
+122,115,116,97,110,115,111,109,0,75,72,82,0,99,97,109,98,111,100,105,
+97,114,105,101,108,0,75,77,70,0,99,111,109,111,114,111,115,102,114,97,
+110,99,0,75,80,87,0,110,111,114,116,104,107,111,114,101,97,119,111,110,
+0,75,87,68,0,107,117,119,97,105,116,100,105,110,97,114,0,75,89,68,
+0,99,97,121,109,97,110,105,115,108,97,110,100,115,100,111,108,108,97,114,
+0,75,90,84,0,107,97,122,97,107,104,115,116,97,110,116,101,110,103,101,
+0,76,65,75,0,108,97,111,115,107,105,112,0,76,66,80,0,108,101,98,
+97,110,111,110,112,111,117,110,100,0,76,75,82,0,115,114,105,108,97,110,
+107,97,114,117,112,101,101,0,76,82,68,0,108,105,98,101,114,105,97,100,
+111,108,108,97,114,0,76,83,76,0,108,101,115,111,116,104,111,109,97,108,
+111,116,105,0,76,84,76,0,108,105,116,104,117,97,110,105,97,108,105,116,
+97,105,0,76,86,76,0,108,97,116,118,105,97,108,97,116,97,115,0,76,
+89,68,0,108,105,98,121,97,100,105,110,97,114,0,77,65,68,0,109,111,
+114,111,99,99,111,100,105,114,104,97,109,0,77,68,76,0,109,111,108,100,
+111,118,97,108,101,117,0,77,71,65,0,109,97,100,97,103,97,115,99,97,
+114,97,114,105,97,114,121,0,77,75,68,0,109,97,99,101,100,111,110,105,
+97,100,101,110,97,114,0,77,77,75,0,109,121,97,110,109,97,114,107,121,
+97,116,0,77,78,84,0,109,111,110,103,111,108,105,97,116,117,103,114,105,
+107,0,77,79,80,0,109,97,99,97,117,112,97,116,97,99,97,0,77,82,
+79,0,109,97,117,114,105,116,97,110,105,97,111,117,103,117,105,121,97,0,
+77,85,82,0,109,97,117,114,105,116,105,117,115,114,117,112,101,101,0,77,
+86,82,0,109,97,108,100,105,118,101,115,114,117,102,105,121,97,97,0,77,
+87,75,0,109,97,108,97,119,105,107,119,97,99,104,97,0,77,88,78,0,
+109,101,120,105,99,111,112,101,115,111,0,77,89,82,0,109,97,108,97,121,
+115,105,97,114,105,110,103,103,105,116,0,77,90,78,0,109,111,122,97,109,
+98,105,113,117,101,109,101,116,105,99,97,105,0,78,65,68,0,110,97,109,
+105,98,105,97,100,111,108,108,97,114,0,78,71,78,0,110,105,103,101,114,
+105,97,110,97,105,114,97,0,78,73,79,0,110,105,99,97,114,97,103,117,
+97,99,111,114,100,111,98,97,0,78,79,75,0,110,111,114,119,97,121,107,
+114,111,110,101,0,78,80,82,0,110,101,112,97,108,110,101,112,97,108,114,
+117,112,101,101,0,78,90,68,0,110,101,119,122,101,97,108,97,110,100,100,
+111,108,108,97,114,0,79,77,82,0,111,109,97,110,114,105,97,108,0,80,
+65,66,0,112,97,110,97,109,97,98,97,108,98,111,97,0,80,69,78,0,
+112,101,114,117,115,111,108,0,80,71,75,0,112,97,112,117,97,110,101,119,
+103,117,105,110,101,97,107,105,110,97,0,80,72,80,0,112,104,105,108,105,
+112,112,105,110,101,115,112,101,115,111,0,80,75,82,0,112,97,107,105,115,
+116,97,110,114,117,112,101,101,0,80,76,78,0,112,111,108,97,110,100,122,
+108,111,116,121,0,80,89,71,0,112,97,114,97,103,117,97,121,103,117,97,
+114,97,110,105,0,81,65,82,0,113,97,116,97,114,114,105,97,108,0,82,
+79,78,0,114,111,109,97,110,105,97,108,101,117,0,82,83,68,0,115,101,
+114,98,105,97,100,105,110,97,114,0,82,85,66,0,114,117,115,115,105,97,
+114,117,98,108,101,0,82,87,70,0,114,119,97,110,100,97,102,114,97,110,
+99,0,83,65,82,0,115,97,117,100,105,97,114,97,98,105,97,114,105,121,
+97,108,0,83,66,68,0,115,111,108,111,109,111,110,105,115,108,97,110,100,
+115,100,111,108,108,97,114,0,83,67,82,0,115,101,121,99,104,101,108,108,
+101,115,114,117,112,101,101,0,83,68,71,0,115,117,100,97,110,112,111,117,
+110,100,0,83,69,75,0,115,119,101,100,101,110,107,114,111,110,111,114,0,
+83,71,68,0,115,105,110,103,97,112,111,114,101,100,111,108,108,97,114,0,
+83,72,80,0,115,97,105,110,116,104,101,108,101,110,97,112,111,117,110,100,
+0,83,76,76,0,115,105,101,114,114,97,108,101,111,110,101,108,101,111,110,
+101,0,83,79,83,0,115,111,109,97,108,105,97,115,104,105,108,108,105,110,
+103,0,83,82,68,0,115,117,114,105,110,97,109,101,100,111,108,108,97,114,
+0,83,84,68,0,115,97,111,116,111,109,101,100,111,98,114,97,0,83,86,
+67,0,101,108,115,97,108,118,97,100,111,114,99,111,108,111,110,0,83,89,
+80,0,115,121,114,105,97,112,111,117,110,100,0,83,90,76,0,115,119,97,
+122,105,108,97,110,100,101,109,97,108,97,110,103,101,110,105,0,84,72,66,
+0,116,104,97,105,108,97,110,100,98,97,104,116,0,84,74,83,0,116,97,
+106,105,107,105,115,116,97,110,115,111,109,111,110,105,0,84,78,68,0,116,
+117,110,105,115,105,97,100,105,110,97,114,0,84,79,80,0,116,111,110,103,
+97,112,97,39,97,110,103,97,0,84,82,89,0,116,117,114,107,101,121,110,
+101,119,108,105,114,97,0,84,84,68,0,116,114,105,110,105,100,97,100,97,
+110,100,116,111,98,97,103,111,100,111,108,108,97,114,0,84,87,68,0,116,
+97,105,119,97,110,100,111,108,108,97,114,115,0,84,90,83,0,116,97,110,
+122,97,110,105,97,115,104,105,108,108,105,110,103,0,85,65,72,0,117,107,
+114,97,105,110,101,104,114,121,118,110,105,97,0,85,71,88,0,117,103,97,
+110,100,97,115,104,105,108,108,105,110,103,0,85,83,68,0,117,110,105,116,
+101,100,115,116,97,116,101,115,100,111,108,108,97,114,0,85,89,85,0,117,
+114,117,103,117,97,121,112,101,115,111,0,85,90,83,0,117,122,98,101,107,
+105,115,116,97,110,115,117,109,0,86,69,70,0,118,101,110,101,122,117,101,
+108,97,98,111,108,105,118,97,114,0,86,78,68,0,118,105,101,116,110,97,
+109,100,111,110,103,0,86,85,86,0,118,97,110,117,97,116,117,118,97,116,
+117,0,87,83,84,0,115,97,109,111,97,116,97,108,97,0,88,65,71,0,
+115,105,108,118,101,114,111,117,110,99,101,0,88,65,85,0,103,111,108,100,
+111,117,110,99,101,0,88,67,68,0,101,97,115,116,99,97,114,105,98,98,
+101,97,110,100,111,108,108,97,114,0,88,80,68,0,112,97,108,108,97,100,
+105,117,109,111,117,110,99,101,0,88,80,84,0,112,108,97,116,105,110,117,
+109,111,117,110,99,101,0,89,69,82,0,121,101,109,101,110,114,105,97,108,
+0,90,65,82,0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,
+0,90,77,75,0,122,97,109,98,105,97,107,119,97,99,104,97,0,90,87,
+68,0,122,105,109,98,97,98,119,101,100,111,108,108,97,114,0,115,105,108,
+118,101,114,112,114,105,99,101,0,115,105,108,118,101,114,111,117,110,99,101,
+32,47,32,116,114,111,121,111,117,110,99,101,0,103,111,108,100,112,114,105,
+99,101,0,103,111,108,100,111,117,110,99,101,32,47,32,116,114,111,121,111,
+117,110,99,101,0,112,97,108,108,97,100,105,117,109,112,114,105,99,101,0,
+112,97,108,108,97,100,105,117,109,111,117,110,99,101,32,47,32,116,114,111,
+121,111,117,110,99,101,0,112,108,97,116,105,110,117,109,112,114,105,99,101,
+0,112,108,97,116,105,110,117,109,111,117,110,99,101,32,47,32,116,114,111,
+121,111,117,110,99,101,0,85,75,80,0,71,66,80,0,86,69,66,0,49,
+124,49,48,48,48,32,86,69,70,0,111,108,100,100,111,108,108,97,114,103,
+111,108,100,0,50,51,46,50,50,32,103,114,97,105,110,115,32,103,111,108,
+100,112,114,105,99,101,0,110,101,119,100,111,108,108,97,114,103,111,108,100,
+0,57,54,124,55,32,103,114,97,105,110,115,32,103,111,108,100,112,114,105,
+99,101,0,100,111,108,108,97,114,103,111,108,100,0,110,101,119,100,111,108,
+108,97,114,103,111,108,100,0,112,111,117,110,100,103,111,108,100,0,49,49,
+51,32,103,114,97,105,110,115,32,103,111,108,100,112,114,105,99,101,0,85,
+83,112,101,110,110,121,119,101,105,103,104,116,0,50,46,53,32,103,114,97,
+109,115,0,85,83,110,105,99,107,101,108,119,101,105,103,104,116,0,53,32,
+103,114,97,109,115,0,85,83,100,105,109,101,119,101,105,103,104,116,0,49,
+48,32,99,101,110,116,115,32,47,32,40,50,48,32,85,83,36,32,47,32,
+108,98,41,0,85,83,113,117,97,114,116,101,114,119,101,105,103,104,116,0,
+50,53,32,99,101,110,116,115,32,47,32,40,50,48,32,85,83,36,32,47,
+32,108,98,41,0,85,83,104,97,108,102,100,111,108,108,97,114,119,101,105,
+103,104,116,0,53,48,32,99,101,110,116,115,32,47,32,40,50,48,32,85,
+83,36,32,47,32,108,98,41,0,85,83,100,111,108,108,97,114,109,97,115,
+115,0,56,46,49,32,103,114,97,109,115,0,113,117,105,100,0,98,114,105,
+116,97,105,110,112,111,117,110,100,0,102,105,118,101,114,0,53,32,113,117,
+105,100,0,116,101,110,110,101,114,0,49,48,32,113,117,105,100,0,109,111,
+110,107,101,121,0,53,48,48,32,113,117,105,100,0,98,114,103,114,97,110,
+100,0,49,48,48,48,32,113,117,105,100,0,98,111,98,0,115,104,105,108,
+108,105,110,103,0,115,104,105,108,108,105,110,103,0,49,124,50,48,32,98,
+114,105,116,97,105,110,112,111,117,110,100,0,111,108,100,112,101,110,99,101,
+0,49,124,49,50,32,115,104,105,108,108,105,110,103,0,102,97,114,116,104,
+105,110,103,0,49,124,52,32,111,108,100,112,101,110,99,101,0,103,117,105,
+110,101,97,0,50,49,32,115,104,105,108,108,105,110,103,0,99,114,111,119,
+110,0,53,32,115,104,105,108,108,105,110,103,0,102,108,111,114,105,110,0,
+50,32,115,104,105,108,108,105,110,103,0,103,114,111,97,116,0,52,32,111,
+108,100,112,101,110,99,101,0,116,97,110,110,101,114,0,54,32,111,108,100,
+112,101,110,99,101,0,98,114,112,101,110,110,121,0,48,46,48,49,32,98,
+114,105,116,97,105,110,112,111,117,110,100,0,112,101,110,99,101,0,98,114,
+112,101,110,110,121,0,116,117,112,112,101,110,99,101,0,50,32,112,101,110,
+99,101,0,116,117,112,112,101,110,110,121,0,116,117,112,112,101,110,99,101,
+0,104,97,39,112,101,110,110,121,0,104,97,108,102,98,114,112,101,110,110,
+121,0,104,97,112,101,110,110,121,0,104,97,39,112,101,110,110,121,0,111,
+108,100,112,101,110,110,121,0,111,108,100,112,101,110,99,101,0,111,108,100,
+116,117,112,112,101,110,99,101,0,50,32,111,108,100,112,101,110,99,101,0,
+111,108,100,116,117,112,112,101,110,110,121,0,111,108,100,116,117,112,112,101,
+110,99,101,0,116,104,114,101,101,112,101,110,99,101,0,51,32,111,108,100,
+112,101,110,99,101,0,116,104,114,101,101,112,101,110,110,121,0,116,104,114,
+101,101,112,101,110,99,101,0,111,108,100,116,104,114,101,101,112,101,110,99,
+101,0,116,104,114,101,101,112,101,110,99,101,0,111,108,100,116,104,114,101,
+101,112,101,110,110,121,0,116,104,114,101,101,112,101,110,99,101,0,111,108,
+100,104,97,108,102,112,101,110,110,121,0,104,97,108,102,111,108,100,112,101,
+110,110,121,0,111,108,100,104,97,39,112,101,110,110,121,0,111,108,100,104,
+97,108,102,112,101,110,110,121,0,111,108,100,104,97,112,101,110,110,121,0,
+111,108,100,104,97,39,112,101,110,110,121,0,98,114,112,111,110,121,0,50,
+53,32,98,114,105,116,97,105,110,112,111,117,110,100,0,108,111,111,110,121,
+0,49,32,99,97,110,97,100,97,100,111,108,108,97,114,0,116,111,111,110,
+121,0,50,32,99,97,110,97,100,97,100,111,108,108,97,114,0,99,111,114,
+100,0,52,42,52,42,56,32,102,116,94,51,0,102,97,99,101,99,111,114,
+100,0,49,124,50,32,99,111,114,100,0,99,111,114,100,102,111,111,116,0,
+49,124,56,32,99,111,114,100,0,99,111,114,100,102,101,101,116,0,99,111,
+114,100,102,111,111,116,0,104,111,117,115,101,99,111,114,100,0,49,124,51,
+32,99,111,114,100,0,98,111,97,114,100,102,111,111,116,0,102,116,94,50,
+32,105,110,99,104,0,98,111,97,114,100,102,101,101,116,0,98,111,97,114,
+100,102,111,111,116,0,102,98,109,0,98,111,97,114,100,102,111,111,116,0,
+115,116,97,99,107,0,52,32,121,97,114,100,94,51,0,114,105,99,107,0,
+52,32,102,116,32,56,32,102,116,32,49,54,32,105,110,99,104,101,115,0,
+115,116,101,114,101,0,109,94,51,0,116,105,109,98,101,114,102,111,111,116,
+0,102,116,94,51,0,115,116,97,110,100,97,114,100,0,49,50,48,32,49,
+50,32,102,116,32,49,49,32,105,110,32,49,46,53,32,105,110,0,100,101,
+97,108,0,49,50,32,102,116,32,49,49,32,105,110,32,50,46,53,32,105,
+110,0,119,104,111,108,101,100,101,97,108,0,49,50,32,102,116,32,49,49,
+32,105,110,32,49,46,50,53,32,105,110,0,115,112,108,105,116,100,101,97,
+108,0,49,50,32,102,116,32,49,49,32,105,110,32,53,124,56,32,105,110,
+0,70,76,85,73,68,95,70,76,79,87,0,86,79,76,85,77,69,32,47,
+32,84,73,77,69,0,99,117,109,101,99,0,109,94,51,47,115,0,99,117,
+115,101,99,0,102,116,94,51,47,115,0,103,112,104,0,103,97,108,47,104,
+114,0,103,112,109,0,103,97,108,47,109,105,110,0,109,103,100,0,109,101,
+103,97,103,97,108,47,100,97,121,0,99,102,115,0,102,116,94,51,47,115,
+0,99,102,104,0,102,116,94,51,47,104,111,117,114,0,99,102,109,0,102,
+116,94,51,47,109,105,110,0,108,112,109,0,108,105,116,101,114,47,109,105,
+110,0,108,102,109,0,102,116,47,109,105,110,0,112,114,117,0,109,109,72,
+103,32,47,32,40,109,108,47,109,105,110,41,0,109,105,110,101,114,115,105,
+110,99,104,65,90,0,49,46,53,32,102,116,94,51,47,109,105,110,0,109,
+105,110,101,114,115,105,110,99,104,67,65,0,49,46,53,32,102,116,94,51,
+47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,77,84,0,49,46,
+53,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,
+104,78,86,0,49,46,53,32,102,116,94,51,47,109,105,110,0,109,105,110,
+101,114,115,105,110,99,104,79,82,0,49,46,53,32,102,116,94,51,47,109,
+105,110,0,109,105,110,101,114,115,105,110,99,104,73,68,0,49,46,50,32,
+102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,75,
+83,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,
+115,105,110,99,104,78,69,0,49,46,50,32,102,116,94,51,47,109,105,110,
+0,109,105,110,101,114,115,105,110,99,104,78,77,0,49,46,50,32,102,116,
+94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,78,68,0,
+49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,
+110,99,104,83,68,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,
+105,110,101,114,115,105,110,99,104,85,84,0,49,46,50,32,102,116,94,51,
+47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,67,79,0,49,32,
+102,116,94,51,47,115,101,99,32,47,32,51,56,46,52,0,109,105,110,101,
+114,115,105,110,99,104,66,67,0,49,46,54,56,32,102,116,94,51,47,109,
+105,110,0,115,118,101,114,100,114,117,112,0,49,101,54,32,109,94,51,32,
+47,32,115,101,99,0,71,65,83,95,70,76,79,87,0,80,82,69,83,83,
+85,82,69,32,70,76,85,73,68,95,70,76,79,87,0,115,99,99,109,0,
+97,116,109,32,99,99,47,109,105,110,0,115,99,99,115,0,97,116,109,32,
+99,99,47,115,101,99,0,115,99,102,104,0,97,116,109,32,102,116,94,51,
+47,104,111,117,114,0,115,99,102,109,0,97,116,109,32,102,116,94,51,47,
+109,105,110,0,115,108,112,109,0,97,116,109,32,108,105,116,101,114,47,109,
+105,110,0,115,108,112,104,0,97,116,109,32,108,105,116,101,114,47,104,111,
+117,114,0,108,117,115,101,99,0,108,105,116,101,114,32,109,105,99,114,111,
+110,32,72,103,32,47,32,115,0,103,48,48,0,40,45,49,41,0,103,48,
+48,48,0,40,45,50,41,0,103,48,48,48,48,0,40,45,51,41,0,103,
+48,48,48,48,48,0,40,45,52,41,0,103,48,48,48,48,48,48,0,40,
+45,53,41,0,103,48,48,48,48,48,48,48,0,40,45,54,41,0,100,109,
+116,120,120,99,111,97,114,115,101,0,49,50,48,32,109,105,99,114,111,110,
+0,100,109,116,115,105,108,118,101,114,0,100,109,116,120,120,99,111,97,114,
+115,101,0,100,109,116,120,120,0,100,109,116,120,120,99,111,97,114,115,101,
+0,100,109,116,120,99,111,97,114,115,101,0,54,48,32,109,105,99,114,111,
+110,0,100,109,116,120,0,100,109,116,120,99,111,97,114,115,101,0,100,109,
+116,98,108,97,99,107,0,100,109,116,120,99,111,97,114,115,101,0,100,109,
+116,99,111,97,114,115,101,0,52,53,32,109,105,99,114,111,110,0,100,109,
+116,99,0,100,109,116,99,111,97,114,115,101,0,100,109,116,98,108,117,101,
+0,100,109,116,99,111,97,114,115,101,0,100,109,116,102,105,110,101,0,50,
+53,32,109,105,99,114,111,110,0,100,109,116,114,101,100,0,100,109,116,102,
+105,110,101,0,100,109,116,102,0,100,109,116,102,105,110,101,0,100,109,116,
+101,102,105,110,101,0,57,32,109,105,99,114,111,110,0,100,109,116,101,0,
+100,109,116,101,102,105,110,101,0,100,109,116,103,114,101,101,110,0,100,109,
+116,101,102,105,110,101,0,100,109,116,99,101,114,97,109,105,99,0,55,32,
+109,105,99,114,111,110,0,100,109,116,99,101,114,0,100,109,116,99,101,114,
+97,109,105,99,0,100,109,116,119,104,105,116,101,0,100,109,116,99,101,114,
+97,109,105,99,0,100,109,116,101,101,102,105,110,101,0,51,32,109,105,99,
+114,111,110,0,100,109,116,116,97,110,0,100,109,116,101,101,102,105,110,101,
+0,100,109,116,101,101,0,100,109,116,101,101,102,105,110,101,0,104,97,114,
+100,116,114,97,110,115,108,117,99,101,110,116,97,114,107,97,110,115,97,115,
+0,54,32,109,105,99,114,111,110,0,115,111,102,116,97,114,107,97,110,115,
+97,115,0,50,50,32,109,105,99,114,111,110,0,101,120,116,114,97,102,105,
+110,101,105,110,100,105,97,0,50,50,32,109,105,99,114,111,110,0,102,105,
+110,101,105,110,100,105,97,0,51,53,32,109,105,99,114,111,110,0,109,101,
+100,105,117,109,105,110,100,105,97,0,53,51,46,53,32,109,105,99,114,111,
+110,0,99,111,97,114,115,101,105,110,100,105,97,0,57,55,32,109,105,99,
+114,111,110,0,102,105,110,101,99,114,121,115,116,111,108,111,110,0,52,53,
+32,109,105,99,114,111,110,0,109,101,100,105,117,109,99,114,121,115,116,97,
+108,111,110,0,55,56,32,109,105,99,114,111,110,0,99,111,97,114,115,101,
+99,114,121,115,116,97,108,111,110,0,49,50,55,32,109,105,99,114,111,110,
+0,104,97,114,100,98,108,97,99,107,97,114,107,97,110,115,97,115,0,54,
+32,109,105,99,114,111,110,0,104,97,114,100,119,104,105,116,101,97,114,107,
+97,110,115,97,115,0,49,49,32,109,105,99,114,111,110,0,119,97,115,104,
+105,116,97,0,51,53,32,109,105,99,114,111,110,0,115,105,122,101,65,114,
+105,110,103,0,51,55,46,53,48,32,109,109,0,115,105,122,101,66,114,105,
+110,103,0,51,56,46,55,53,32,109,109,0,115,105,122,101,67,114,105,110,
+103,0,52,48,46,48,48,32,109,109,0,115,105,122,101,68,114,105,110,103,
+0,52,49,46,50,53,32,109,109,0,115,105,122,101,69,114,105,110,103,0,
+52,50,46,53,48,32,109,109,0,115,105,122,101,70,114,105,110,103,0,52,
+51,46,55,53,32,109,109,0,115,105,122,101,71,114,105,110,103,0,52,53,
+46,48,48,32,109,109,0,115,105,122,101,72,114,105,110,103,0,52,54,46,
+50,53,32,109,109,0,115,105,122,101,73,114,105,110,103,0,52,55,46,53,
+48,32,109,109,0,115,105,122,101,74,114,105,110,103,0,52,56,46,55,53,
+32,109,109,0,115,105,122,101,75,114,105,110,103,0,53,48,46,48,48,32,
+109,109,0,115,105,122,101,76,114,105,110,103,0,53,49,46,50,53,32,109,
+109,0,115,105,122,101,77,114,105,110,103,0,53,50,46,53,48,32,109,109,
+0,115,105,122,101,78,114,105,110,103,0,53,51,46,55,53,32,109,109,0,
+115,105,122,101,79,114,105,110,103,0,53,53,46,48,48,32,109,109,0,115,
+105,122,101,80,114,105,110,103,0,53,54,46,50,53,32,109,109,0,115,105,
+122,101,81,114,105,110,103,0,53,55,46,53,48,32,109,109,0,115,105,122,
+101,82,114,105,110,103,0,53,56,46,55,53,32,109,109,0,115,105,122,101,
+83,114,105,110,103,0,54,48,46,48,48,32,109,109,0,115,105,122,101,84,
+114,105,110,103,0,54,49,46,50,53,32,109,109,0,115,105,122,101,85,114,
+105,110,103,0,54,50,46,53,48,32,109,109,0,115,105,122,101,86,114,105,
+110,103,0,54,51,46,55,53,32,109,109,0,115,105,122,101,87,114,105,110,
+103,0,54,53,46,48,48,32,109,109,0,115,105,122,101,88,114,105,110,103,
+0,54,54,46,50,53,32,109,109,0,115,105,122,101,89,114,105,110,103,0,
+54,55,46,53,48,32,109,109,0,115,105,122,101,90,114,105,110,103,0,54,
+56,46,55,53,32,109,109,0,109,112,104,0,109,105,108,101,47,104,114,0,
+109,112,103,0,109,105,108,101,47,103,97,108,0,107,112,104,0,107,109,47,
+104,114,0,102,76,0,102,111,111,116,108,97,109,98,101,114,116,0,102,112,
+109,0,102,116,47,109,105,110,0,102,112,115,0,102,116,47,115,0,114,112,
+109,0,114,101,118,47,109,105,110,0,114,112,115,0,114,101,118,47,115,101,
+99,0,109,105,0,109,105,108,101,0,115,109,105,0,109,105,108,101,0,110,
+109,105,0,110,97,117,116,105,99,97,108,109,105,108,101,0,109,98,104,0,
+49,101,51,32,98,116,117,47,104,111,117,114,0,109,99,109,0,49,101,51,
+32,99,105,114,99,117,108,97,114,109,105,108,0,105,112,121,0,105,110,99,
+104,47,121,101,97,114,0,99,99,102,0,49,48,48,32,102,116,94,51,0,
+77,99,102,0,49,48,48,48,32,102,116,94,51,0,107,112,0,107,105,108,
+111,112,111,110,100,0,107,112,109,0,107,112,32,109,101,116,101,114,0,87,
+104,0,87,32,104,111,117,114,0,104,112,104,0,104,112,32,104,111,117,114,
+0,112,108,102,0,108,98,32,47,32,102,111,111,116,0,112,97,0,80,97,
+0,101,118,0,101,86,0,104,103,0,72,103,0,111,101,0,79,101,0,109,
+104,0,109,72,0,114,100,0,114,111,100,0,112,102,0,112,70,0,103,114,
+0,103,114,97,105,110,0,110,116,0,78,0,104,122,0,72,122,0,104,100,
+0,104,111,103,115,104,101,97,100,0,100,114,121,0,100,114,121,103,97,108,
+108,111,110,47,103,97,108,108,111,110,0,105,109,112,101,114,105,97,108,0,
+98,114,103,97,108,108,111,110,47,103,97,108,108,111,110,0,110,109,105,108,
+101,0,110,97,117,116,105,99,97,108,109,105,108,101,0,98,101,86,0,71,
+101,86,0,98,101,118,0,98,101,86,0,99,111,117,108,0,67,0,98,101,
+99,113,117,101,114,101,108,0,47,115,0,66,113,0,98,101,99,113,117,101,
+114,101,108,0,99,117,114,105,101,0,51,46,55,101,49,48,32,66,113,0,
+67,105,0,99,117,114,105,101,0,114,117,116,104,101,114,102,111,114,100,0,
+49,101,54,32,66,113,0,82,65,68,73,65,84,73,79,78,95,68,79,83,
+69,0,103,114,97,121,0,103,114,97,121,0,74,47,107,103,0,71,121,0,
+103,114,97,121,0,114,97,100,0,49,101,45,50,32,71,121,0,114,101,112,
+0,56,46,51,56,32,109,71,121,0,115,105,101,118,101,114,116,0,74,47,
+107,103,0,83,118,0,115,105,101,118,101,114,116,0,114,101,109,0,49,101,
+45,50,32,83,118,0,114,111,101,110,116,103,101,110,0,50,46,53,56,101,
+45,52,32,67,32,47,32,107,103,0,114,111,110,116,103,101,110,0,114,111,
+101,110,116,103,101,110,0,115,105,101,118,101,114,116,117,110,105,116,0,56,
+46,51,56,32,114,111,110,116,103,101,110,0,101,109,97,110,0,49,101,45,
+55,32,67,105,47,109,94,51,0,109,97,99,104,101,0,51,46,55,101,45,
+55,32,67,105,47,109,94,51,0,97,99,116,105,110,105,117,109,0,50,50,
+55,46,48,50,55,56,0,97,108,117,109,105,110,117,109,0,50,54,46,57,
+56,49,53,51,57,0,97,109,101,114,105,99,105,117,109,0,50,52,51,46,
+48,54,49,52,0,97,110,116,105,109,111,110,121,0,49,50,49,46,55,54,
+48,0,97,114,103,111,110,0,51,57,46,57,52,56,0,97,114,115,101,110,
+105,99,0,55,52,46,57,50,49,53,57,0,97,115,116,97,116,105,110,101,
+0,50,48,57,46,57,56,55,49,0,98,97,114,105,117,109,0,49,51,55,
+46,51,50,55,0,98,101,114,107,101,108,105,117,109,0,50,52,55,46,48,
+55,48,51,0,98,101,114,121,108,108,105,117,109,0,57,46,48,49,50,49,
+56,50,0,98,105,115,109,117,116,104,0,50,48,56,46,57,56,48,51,55,
+0,98,111,114,111,110,0,49,48,46,56,49,49,0,98,114,111,109,105,110,
+101,0,55,57,46,57,48,52,0,99,97,100,109,105,117,109,0,49,49,50,
+46,52,49,49,0,99,97,108,99,105,117,109,0,52,48,46,48,55,56,0,
+99,97,108,105,102,111,114,110,105,117,109,0,50,53,49,46,48,55,57,54,
+0,99,97,114,98,111,110,0,49,50,46,48,49,49,0,99,101,114,105,117,
+109,0,49,52,48,46,49,49,53,0,99,101,115,105,117,109,0,49,51,50,
+46,57,48,53,52,51,0,99,104,108,111,114,105,110,101,0,51,53,46,52,
+53,50,55,0,99,104,114,111,109,105,117,109,0,53,49,46,57,57,54,49,
+0,99,111,98,97,108,116,0,53,56,46,57,51,51,50,48,0,99,111,112,
+112,101,114,0,54,51,46,53,52,54,0,99,117,114,105,117,109,0,50,52,
+55,46,48,55,48,51,0,100,121,115,112,114,111,115,105,117,109,0,49,54,
+50,46,53,48,0,101,105,110,115,116,101,105,110,105,117,109,0,50,53,50,
+46,48,56,51,0,101,114,98,105,117,109,0,49,54,55,46,50,54,0,101,
+117,114,111,112,105,117,109,0,49,53,49,46,57,54,53,0,102,101,114,109,
+105,117,109,0,50,53,55,46,48,57,53,49,0,102,108,117,111,114,105,110,
+101,0,49,56,46,57,57,56,52,48,51,50,0,102,114,97,110,99,105,117,
+109,0,50,50,51,46,48,49,57,55,0,103,97,100,111,108,105,110,105,117,
+109,0,49,53,55,46,50,53,0,103,97,108,108,105,117,109,0,54,57,46,
+55,50,51,0,103,101,114,109,97,110,105,117,109,0,55,50,46,54,49,0,
+103,111,108,100,0,49,57,54,46,57,54,54,53,52,0,104,97,102,110,105,
+117,109,0,49,55,56,46,52,57,0,104,101,108,105,117,109,0,52,46,48,
+48,50,54,48,50,0,104,111,108,109,105,117,109,0,49,54,52,46,57,51,
+48,51,50,0,104,121,100,114,111,103,101,110,0,49,46,48,48,55,57,52,
+0,105,110,100,105,117,109,0,49,49,52,46,56,49,56,0,105,111,100,105,
+110,101,0,49,50,54,46,57,48,52,52,55,0,105,114,105,100,105,117,109,
+0,49,57,50,46,50,49,55,0,105,114,111,110,0,53,53,46,56,52,53,
+0,107,114,121,112,116,111,110,0,56,51,46,56,48,0,108,97,110,116,104,
+97,110,117,109,0,49,51,56,46,57,48,53,53,0,108,97,119,114,101,110,
+99,105,117,109,0,50,54,50,46,49,49,0,108,101,97,100,0,50,48,55,
+46,50,0,108,105,116,104,105,117,109,0,54,46,57,52,49,0,108,117,116,
+101,116,105,117,109,0,49,55,52,46,57,54,55,0,109,97,103,110,101,115,
+105,117,109,0,50,52,46,51,48,53,48,0,109,97,110,103,97,110,101,115,
+101,0,53,52,46,57,51,56,48,53,0,109,101,110,100,101,108,101,118,105,
+117,109,0,50,53,56,46,49,48,0,109,101,114,99,117,114,121,0,50,48,
+48,46,53,57,0,109,111,108,121,98,100,101,110,117,109,0,57,53,46,57,
+52,0,110,101,111,100,121,109,105,117,109,0,49,52,52,46,50,52,0,110,
+101,111,110,0,50,48,46,49,55,57,55,0,110,101,112,116,117,110,105,117,
+109,0,50,51,55,46,48,52,56,50,0,110,105,99,107,101,108,0,53,56,
+46,54,57,51,52,0,110,105,111,98,105,117,109,0,57,50,46,57,48,54,
+51,56,0,110,105,116,114,111,103,101,110,0,49,52,46,48,48,54,55,52,
+0,110,111,98,101,108,105,117,109,0,50,53,57,46,49,48,48,57,0,111,
+115,109,105,117,109,0,49,57,48,46,50,51,0,111,120,121,103,101,110,0,
+49,53,46,57,57,57,52,0,112,97,108,108,97,100,105,117,109,0,49,48,
+54,46,52,50,0,112,104,111,115,112,104,111,114,117,115,0,51,48,46,57,
+55,51,55,54,50,0,112,108,97,116,105,110,117,109,0,49,57,53,46,48,
+56,0,112,108,117,116,111,110,105,117,109,0,50,52,52,46,48,54,52,50,
+0,112,111,108,111,110,105,117,109,0,50,48,56,46,57,56,50,52,0,112,
+111,116,97,115,115,105,117,109,0,51,57,46,48,57,56,51,0,112,114,97,
+115,101,111,100,121,109,105,117,109,0,49,52,48,46,57,48,55,54,53,0,
+112,114,111,109,101,116,104,105,117,109,0,49,52,52,46,57,49,50,55,0,
+112,114,111,116,97,99,116,105,110,105,117,109,0,50,51,49,46,48,51,53,
+56,56,0,114,97,100,105,117,109,0,50,50,54,46,48,50,53,52,0,114,
+97,100,111,110,0,50,50,50,46,48,49,55,54,0,114,104,101,110,105,117,
+109,0,49,56,54,46,50,48,55,0,114,104,111,100,105,117,109,0,49,48,
+50,46,57,48,53,53,48,0,114,117,98,105,100,105,117,109,0,56,53,46,
+52,54,55,56,0,114,117,116,104,101,110,105,117,109,0,49,48,49,46,48,
+55,0,115,97,109,97,114,105,117,109,0,49,53,48,46,51,54,0,115,99,
+97,110,100,105,117,109,0,52,52,46,57,53,53,57,49,48,0,115,101,108,
+101,110,105,117,109,0,55,56,46,57,54,0,115,105,108,105,99,111,110,0,
+50,56,46,48,56,53,53,0,115,105,108,118,101,114,0,49,48,55,46,56,
+54,56,50,0,115,111,100,105,117,109,0,50,50,46,57,56,57,55,54,56,
+0,115,116,114,111,110,116,105,117,109,0,56,55,46,54,50,0,115,117,108,
+102,117,114,0,51,50,46,48,54,54,0,116,97,110,116,97,108,117,109,0,
+49,56,48,46,57,52,55,57,0,116,101,99,104,110,101,116,105,117,109,0,
+57,55,46,57,48,55,50,0,116,101,108,108,117,114,105,117,109,0,49,50,
+55,46,54,48,0,116,101,114,98,105,117,109,0,49,53,56,46,57,50,53,
+51,52,0,116,104,97,108,108,105,117,109,0,50,48,52,46,51,56,51,51,
+0,116,104,111,114,105,117,109,0,50,51,50,46,48,51,56,49,0,116,104,
+117,108,108,105,117,109,0,49,54,56,46,57,51,52,50,49,0,116,105,110,
+0,49,49,56,46,55,49,48,0,116,105,116,97,110,105,117,109,0,52,55,
+46,56,54,55,0,116,117,110,103,115,116,101,110,0,49,56,51,46,56,52,
+0,117,114,97,110,105,117,109,0,50,51,56,46,48,50,56,57,0,118,97,
+110,97,100,105,117,109,0,53,48,46,57,52,49,53,0,120,101,110,111,110,
+0,49,51,49,46,50,57,0,121,116,116,101,114,98,105,117,109,0,49,55,
+51,46,48,52,0,121,116,116,114,105,117,109,0,56,56,46,57,48,53,56,
+53,0,122,105,110,99,0,54,53,46,51,57,0,122,105,114,99,111,110,105,
+117,109,0,57,49,46,50,50,52,0,112,101,111,112,108,101,0,49,0,112,
+101,114,115,111,110,0,112,101,111,112,108,101,0,100,101,97,116,104,0,112,
+101,111,112,108,101,0,99,97,112,105,116,97,0,112,101,111,112,108,101,0,
+112,101,114,99,97,112,105,116,97,0,112,101,114,32,99,97,112,105,116,97,
+0,119,97,114,105,95,112,114,111,112,111,114,116,105,111,110,0,49,124,49,
+48,0,119,97,114,105,0,119,97,114,105,95,112,114,111,112,111,114,116,105,
+111,110,0,98,117,95,112,114,111,112,111,114,116,105,111,110,0,49,124,49,
+48,48,0,114,105,110,95,112,114,111,112,111,114,116,105,111,110,0,49,124,
+49,48,48,48,0,109,111,117,95,112,114,111,112,111,114,116,105,111,110,0,
+49,124,49,48,48,48,48,0,115,104,97,107,117,0,49,124,51,46,51,32,
+109,0,109,111,117,0,49,124,49,48,48,48,48,32,115,104,97,107,117,0,
+114,105,110,0,49,124,49,48,48,48,32,115,104,97,107,117,0,98,117,95,
+100,105,115,116,97,110,99,101,0,49,124,49,48,48,32,115,104,97,107,117,
+0,115,117,110,0,49,124,49,48,32,115,104,97,107,117,0,106,111,117,95,
+100,105,115,116,97,110,99,101,0,49,48,32,115,104,97,107,117,0,106,111,
+117,0,106,111,117,95,100,105,115,116,97,110,99,101,0,107,97,110,101,106,
+97,107,117,115,117,110,0,115,117,110,0,107,97,110,101,106,97,107,117,0,
+115,104,97,107,117,0,107,97,110,101,106,97,107,117,106,111,117,0,106,111,
+117,0,107,117,106,105,114,97,106,97,107,117,0,49,48,124,56,32,115,104,
+97,107,117,0,107,117,106,105,114,97,106,97,107,117,115,117,110,0,49,124,
+49,48,32,107,117,106,105,114,97,106,97,107,117,0,107,117,106,105,114,97,
+106,97,107,117,98,117,0,49,124,49,48,48,32,107,117,106,105,114,97,106,
+97,107,117,0,107,117,106,105,114,97,106,97,107,117,106,111,117,0,49,48,
+32,107,117,106,105,114,97,106,97,107,117,0,116,97,110,95,100,105,115,116,
+97,110,99,101,0,51,32,107,117,106,105,114,97,106,97,107,117,106,111,117,
+0,107,101,110,0,54,32,115,104,97,107,117,0,99,104,111,117,95,100,105,
+115,116,97,110,99,101,0,54,48,32,107,101,110,0,99,104,111,117,0,99,
+104,111,117,95,100,105,115,116,97,110,99,101,0,114,105,0,51,54,32,99,
+104,111,117,0,103,111,117,95,97,114,101,97,0,49,124,49,48,32,116,115,
+117,98,111,0,116,115,117,98,111,0,51,54,32,115,104,97,107,117,94,50,
+0,115,101,0,51,48,32,116,115,117,98,111,0,116,97,110,95,97,114,101,
+97,0,49,48,32,115,101,0,99,104,111,117,95,97,114,101,97,0,49,48,
+32,116,97,110,95,97,114,101,97,0,101,100,111,109,97,0,40,53,46,56,
+42,50,46,57,41,32,115,104,97,107,117,94,50,0,107,121,111,117,109,97,
+0,40,54,46,51,42,51,46,49,53,41,32,115,104,97,107,117,94,50,0,
+99,104,117,117,107,121,111,117,109,97,0,40,54,42,51,41,32,115,104,97,
+107,117,94,50,0,106,111,117,95,97,114,101,97,0,101,100,111,109,97,0,
+116,97,116,97,109,105,0,106,111,117,95,97,114,101,97,0,115,104,97,107,
+117,95,118,111,108,117,109,101,0,49,124,49,48,32,103,111,117,95,118,111,
+108,117,109,101,0,103,111,117,95,118,111,108,117,109,101,0,49,124,49,48,
+32,115,104,111,117,0,103,111,117,0,103,111,117,95,118,111,108,117,109,101,
+0,115,104,111,117,0,40,52,46,57,42,52,46,57,42,50,46,55,41,32,
+115,117,110,94,51,0,116,111,0,49,48,32,115,104,111,117,0,107,111,107,
+117,0,49,48,32,116,111,0,114,105,110,95,119,101,105,103,104,116,0,49,
+124,49,48,32,98,117,0,98,117,95,119,101,105,103,104,116,0,49,124,49,
+48,32,109,111,110,109,101,0,102,117,110,0,49,124,49,48,32,109,111,110,
+109,101,0,109,111,110,109,101,0,49,53,124,52,32,103,0,107,105,110,0,
+49,54,48,32,109,111,110,109,101,0,107,97,110,0,49,48,48,48,32,109,
+111,110,109,101,0,107,119,97,110,0,107,97,110,0,97,117,115,116,114,97,
+108,105,97,115,113,117,97,114,101,0,40,49,48,32,102,116,41,94,50,0,
+122,101,110,116,110,101,114,0,53,48,32,107,103,0,100,111,112,112,101,108,
+122,101,110,116,110,101,114,0,50,32,122,101,110,116,110,101,114,0,112,102,
+117,110,100,0,53,48,48,32,103,0,102,114,101,110,99,104,102,111,111,116,
+0,49,52,52,124,52,52,51,46,50,57,54,32,109,0,112,105,101,100,0,
+102,114,101,110,99,104,102,111,111,116,0,102,114,101,110,99,104,102,101,101,
+116,0,102,114,101,110,99,104,102,111,111,116,0,102,114,101,110,99,104,105,
+110,99,104,0,49,124,49,50,32,102,114,101,110,99,104,102,111,111,116,0,
+102,114,101,110,99,104,116,104,117,109,98,0,102,114,101,110,99,104,105,110,
+99,104,0,112,111,117,99,101,0,102,114,101,110,99,104,116,104,117,109,98,
+0,102,114,101,110,99,104,108,105,110,101,0,49,124,49,50,32,102,114,101,
+110,99,104,105,110,99,104,0,108,105,103,110,101,0,102,114,101,110,99,104,
+108,105,110,101,0,102,114,101,110,99,104,112,111,105,110,116,0,49,124,49,
+50,32,102,114,101,110,99,104,108,105,110,101,0,116,111,105,115,101,0,54,
+32,102,114,101,110,99,104,102,101,101,116,0,97,114,112,101,110,116,0,49,
+56,48,94,50,32,112,105,101,100,94,50,0,102,114,101,110,99,104,103,114,
+97,105,110,0,49,124,49,56,56,50,55,46,49,53,32,107,103,0,102,114,
+101,110,99,104,112,111,117,110,100,0,57,50,49,54,32,102,114,101,110,99,
+104,103,114,97,105,110,0,115,99,111,116,115,105,110,99,104,0,49,46,48,
+48,53,52,48,48,53,52,32,85,75,105,110,99,104,0,115,99,111,116,115,
+108,105,110,107,0,49,124,49,48,48,32,115,99,111,116,115,99,104,97,105,
+110,0,115,99,111,116,115,102,111,111,116,0,49,50,32,115,99,111,116,115,
+105,110,99,104,0,115,99,111,116,115,102,101,101,116,0,115,99,111,116,115,
+102,111,111,116,0,115,99,111,116,115,101,108,108,0,51,55,32,115,99,111,
+116,115,105,110,99,104,0,115,99,111,116,115,102,97,108,108,0,54,32,115,
+99,111,116,115,101,108,108,0,115,99,111,116,115,99,104,97,105,110,0,52,
+32,115,99,111,116,115,102,97,108,108,0,115,99,111,116,115,102,117,114,108,
+111,110,103,0,49,48,32,115,99,111,116,115,99,104,97,105,110,0,115,99,
+111,116,115,109,105,108,101,0,56,32,115,99,111,116,115,102,117,114,108,111,
+110,103,0,115,99,111,116,115,114,111,111,100,0,52,48,32,115,99,111,116,
+115,102,97,108,108,94,50,0,115,99,111,116,115,97,99,114,101,0,52,32,
+115,99,111,116,115,114,111,111,100,0,110,111,111,107,0,50,48,32,97,99,
+114,101,115,0,105,114,105,115,104,105,110,99,104,0,85,75,105,110,99,104,
+0,105,114,105,115,104,112,97,108,109,0,51,32,105,114,105,115,104,105,110,
+99,104,0,105,114,105,115,104,115,112,97,110,0,51,32,105,114,105,115,104,
+112,97,108,109,0,105,114,105,115,104,102,111,111,116,0,49,50,32,105,114,
+105,115,104,105,110,99,104,0,105,114,105,115,104,102,101,101,116,0,105,114,
+105,115,104,102,111,111,116,0,105,114,105,115,104,99,117,98,105,116,0,49,
+56,32,105,114,105,115,104,105,110,99,104,0,105,114,105,115,104,121,97,114,
+100,0,51,32,105,114,105,115,104,102,101,101,116,0,105,114,105,115,104,112,
+97,99,101,0,53,32,105,114,105,115,104,102,101,101,116,0,105,114,105,115,
+104,102,97,116,104,111,109,0,54,32,105,114,105,115,104,102,101,101,116,0,
+105,114,105,115,104,112,111,108,101,0,55,32,105,114,105,115,104,121,97,114,
+100,0,105,114,105,115,104,112,101,114,99,104,0,105,114,105,115,104,112,111,
+108,101,0,105,114,105,115,104,99,104,97,105,110,0,52,32,105,114,105,115,
+104,112,101,114,99,104,0,105,114,105,115,104,108,105,110,107,0,49,124,49,
+48,48,32,105,114,105,115,104,99,104,97,105,110,0,105,114,105,115,104,102,
+117,114,108,111,110,103,0,49,48,32,105,114,105,115,104,99,104,97,105,110,
+0,105,114,105,115,104,109,105,108,101,0,56,32,105,114,105,115,104,102,117,
+114,108,111,110,103,0,105,114,105,115,104,114,111,111,100,0,52,48,32,105,
+114,105,115,104,112,111,108,101,94,50,0,105,114,105,115,104,97,99,114,101,
+0,52,32,105,114,105,115,104,114,111,111,100,0,119,105,110,101,112,105,110,
+116,0,49,124,50,32,119,105,110,101,113,117,97,114,116,0,119,105,110,101,
+113,117,97,114,116,0,49,124,52,32,119,105,110,101,103,97,108,108,111,110,
+0,119,105,110,101,103,97,108,108,111,110,0,50,51,49,32,85,75,105,110,
+99,104,94,51,0,119,105,110,101,114,117,110,100,108,101,116,0,49,56,32,
+119,105,110,101,103,97,108,108,111,110,0,119,105,110,101,98,97,114,114,101,
+108,0,51,49,46,53,32,119,105,110,101,103,97,108,108,111,110,0,119,105,
+110,101,116,105,101,114,99,101,0,52,50,32,119,105,110,101,103,97,108,108,
+111,110,0,119,105,110,101,104,111,103,115,104,101,97,100,0,50,32,119,105,
+110,101,98,97,114,114,101,108,0,119,105,110,101,112,117,110,99,104,101,111,
+110,0,50,32,119,105,110,101,116,105,101,114,99,101,0,119,105,110,101,98,
+117,116,116,0,50,32,119,105,110,101,104,111,103,115,104,101,97,100,0,119,
+105,110,101,112,105,112,101,0,119,105,110,101,98,117,116,116,0,119,105,110,
+101,116,117,110,0,50,32,119,105,110,101,98,117,116,116,0,98,101,101,114,
+112,105,110,116,0,49,124,50,32,98,101,101,114,113,117,97,114,116,0,98,
+101,101,114,113,117,97,114,116,0,49,124,52,32,98,101,101,114,103,97,108,
+108,111,110,0,98,101,101,114,103,97,108,108,111,110,0,50,56,50,32,85,
+75,105,110,99,104,94,51,0,98,101,101,114,98,97,114,114,101,108,0,51,
+54,32,98,101,101,114,103,97,108,108,111,110,0,98,101,101,114,104,111,103,
+115,104,101,97,100,0,49,46,53,32,98,101,101,114,98,97,114,114,101,108,
+0,97,108,101,112,105,110,116,0,49,124,50,32,97,108,101,113,117,97,114,
+116,0,97,108,101,113,117,97,114,116,0,49,124,52,32,97,108,101,103,97,
+108,108,111,110,0,97,108,101,103,97,108,108,111,110,0,98,101,101,114,103,
+97,108,108,111,110,0,97,108,101,98,97,114,114,101,108,0,51,52,32,97,
+108,101,103,97,108,108,111,110,0,97,108,101,104,111,103,115,104,101,97,100,
+0,49,46,53,32,97,108,101,98,97,114,114,101,108,0,115,99,111,116,115,
+103,105,108,108,0,49,124,52,32,109,117,116,99,104,107,105,110,0,109,117,
+116,99,104,107,105,110,0,49,124,50,32,99,104,111,112,112,105,110,0,99,
+104,111,112,112,105,110,0,49,124,50,32,115,99,111,116,115,112,105,110,116,
+0,115,99,111,116,115,112,105,110,116,0,49,124,50,32,115,99,111,116,115,
+113,117,97,114,116,0,115,99,111,116,115,113,117,97,114,116,0,49,124,52,
+32,115,99,111,116,115,103,97,108,108,111,110,0,115,99,111,116,115,103,97,
+108,108,111,110,0,56,50,55,46,50,51,50,32,85,75,105,110,99,104,94,
+51,0,115,99,111,116,115,98,97,114,114,101,108,0,56,32,115,99,111,116,
+115,103,97,108,108,111,110,0,106,117,103,0,115,99,111,116,115,112,105,110,
+116,0,115,99,111,116,115,119,104,101,97,116,108,105,112,112,121,0,49,51,
+55,46,51,51,51,32,85,75,105,110,99,104,94,51,0,115,99,111,116,115,
+119,104,101,97,116,108,105,112,112,105,101,115,0,115,99,111,116,115,119,104,
+101,97,116,108,105,112,112,121,0,115,99,111,116,115,119,104,101,97,116,112,
+101,99,107,0,52,32,115,99,111,116,115,119,104,101,97,116,108,105,112,112,
+121,0,115,99,111,116,115,119,104,101,97,116,102,105,114,108,111,116,0,52,
+32,115,99,111,116,115,119,104,101,97,116,112,101,99,107,0,115,99,111,116,
+115,119,104,101,97,116,98,111,108,108,0,52,32,115,99,111,116,115,119,104,
+101,97,116,102,105,114,108,111,116,0,115,99,111,116,115,119,104,101,97,116,
+99,104,97,108,100,101,114,0,49,54,32,115,99,111,116,115,119,104,101,97,
+116,98,111,108,108,0,115,99,111,116,115,111,97,116,108,105,112,112,121,0,
+50,48,48,46,51,52,53,32,85,75,105,110,99,104,94,51,0,115,99,111,
+116,115,111,97,116,108,105,112,112,105,101,115,0,115,99,111,116,115,111,97,
+116,108,105,112,112,121,0,115,99,111,116,115,111,97,116,112,101,99,107,0,
+52,32,115,99,111,116,115,111,97,116,108,105,112,112,121,0,115,99,111,116,
+115,111,97,116,102,105,114,108,111,116,0,52,32,115,99,111,116,115,111,97,
+116,112,101,99,107,0,115,99,111,116,115,111,97,116,98,111,108,108,0,52,
+32,115,99,111,116,115,111,97,116,102,105,114,108,111,116,0,115,99,111,116,
+115,111,97,116,99,104,97,108,100,101,114,0,49,54,32,115,99,111,116,115,
+111,97,116,98,111,108,108,0,116,114,111,110,100,114,111,112,0,49,124,49,
+54,32,116,114,111,110,111,117,110,99,101,0,116,114,111,110,111,117,110,99,
+101,0,49,124,50,48,32,116,114,111,110,112,111,117,110,100,0,116,114,111,
+110,112,111,117,110,100,0,57,53,50,48,32,103,114,97,105,110,0,116,114,
+111,110,115,116,111,110,101,0,49,54,32,116,114,111,110,112,111,117,110,100,
+0,105,114,105,115,104,110,111,103,103,105,110,0,49,124,52,32,105,114,105,
+115,104,112,105,110,116,0,105,114,105,115,104,112,105,110,116,0,49,124,50,
+32,105,114,105,115,104,113,117,97,114,116,0,105,114,105,115,104,113,117,97,
+114,116,0,49,124,50,32,105,114,105,115,104,112,111,116,116,108,101,0,105,
+114,105,115,104,112,111,116,116,108,101,0,49,124,50,32,105,114,105,115,104,
+103,97,108,108,111,110,0,105,114,105,115,104,103,97,108,108,111,110,0,50,
+49,55,46,54,32,85,75,105,110,99,104,94,51,0,105,114,105,115,104,114,
+117,110,100,108,101,116,0,49,56,32,105,114,105,115,104,103,97,108,108,111,
+110,0,105,114,105,115,104,98,97,114,114,101,108,0,51,49,46,53,32,105,
+114,105,115,104,103,97,108,108,111,110,0,105,114,105,115,104,116,105,101,114,
+99,101,0,52,50,32,105,114,105,115,104,103,97,108,108,111,110,0,105,114,
+105,115,104,104,111,103,115,104,101,97,100,0,50,32,105,114,105,115,104,98,
+97,114,114,101,108,0,105,114,105,115,104,112,117,110,99,104,101,111,110,0,
+50,32,105,114,105,115,104,116,105,101,114,99,101,0,105,114,105,115,104,112,
+105,112,101,0,50,32,105,114,105,115,104,104,111,103,115,104,101,97,100,0,
+105,114,105,115,104,116,117,110,0,50,32,105,114,105,115,104,112,105,112,101,
+0,105,114,105,115,104,112,101,99,107,0,50,32,105,114,105,115,104,103,97,
+108,108,111,110,0,105,114,105,115,104,98,117,115,104,101,108,0,52,32,105,
+114,105,115,104,112,101,99,107,0,105,114,105,115,104,115,116,114,105,107,101,
+0,50,32,105,114,105,115,104,98,117,115,104,101,108,0,105,114,105,115,104,
+100,114,121,98,97,114,114,101,108,0,50,32,105,114,105,115,104,115,116,114,
+105,107,101,0,105,114,105,115,104,113,117,97,114,116,101,114,0,50,32,105,
+114,105,115,104,98,97,114,114,101,108,0,116,111,119,101,114,112,111,117,110,
+100,0,53,52,48,48,32,103,114,97,105,110,0,116,111,119,101,114,111,117,
+110,99,101,0,49,124,49,50,32,116,111,119,101,114,112,111,117,110,100,0,
+116,111,119,101,114,112,101,110,110,121,119,101,105,103,104,116,0,49,124,50,
+48,32,116,111,119,101,114,111,117,110,99,101,0,116,111,119,101,114,103,114,
+97,105,110,0,49,124,51,50,32,116,111,119,101,114,112,101,110,110,121,119,
+101,105,103,104,116,0,109,101,114,99,112,111,117,110,100,0,54,55,53,48,
+32,103,114,97,105,110,0,109,101,114,99,111,117,110,99,101,0,49,124,49,
+53,32,109,101,114,99,112,111,117,110,100,0,109,101,114,99,112,101,110,110,
+121,119,101,105,103,104,116,0,49,124,50,48,32,109,101,114,99,111,117,110,
+99,101,0,108,101,97,100,115,116,111,110,101,0,49,50,46,53,32,108,98,
+0,102,111,116,109,97,108,0,55,48,32,108,98,0,108,101,97,100,119,101,
+121,0,49,52,32,108,101,97,100,115,116,111,110,101,0,102,111,116,104,101,
+114,115,0,49,50,32,108,101,97,100,119,101,121,0,110,101,119,104,97,121,
+116,114,117,115,115,0,54,48,32,108,98,0,110,101,119,104,97,121,108,111,
+97,100,0,51,54,32,110,101,119,104,97,121,116,114,117,115,115,0,111,108,
+100,104,97,121,116,114,117,115,115,0,53,54,32,108,98,0,111,108,100,104,
+97,121,108,111,97,100,0,51,54,32,111,108,100,104,97,121,116,114,117,115,
+115,0,119,111,111,108,99,108,111,118,101,0,55,32,108,98,0,119,111,111,
+108,115,116,111,110,101,0,50,32,119,111,111,108,99,108,111,118,101,0,119,
+111,111,108,116,111,100,0,50,32,119,111,111,108,115,116,111,110,101,0,119,
+111,111,108,119,101,121,0,49,51,32,119,111,111,108,115,116,111,110,101,0,
+119,111,111,108,115,97,99,107,0,50,32,119,111,111,108,119,101,121,0,119,
+111,111,108,115,97,114,112,108,101,114,0,50,32,119,111,111,108,115,97,99,
+107,0,119,111,111,108,108,97,115,116,0,54,32,119,111,111,108,115,97,114,
+112,108,101,114,0,114,111,109,97,110,102,111,111,116,0,50,57,54,32,109,
+109,0,114,111,109,97,110,102,101,101,116,0,114,111,109,97,110,102,111,111,
+116,0,112,101,115,0,114,111,109,97,110,102,111,111,116,0,112,101,100,101,
+115,0,114,111,109,97,110,102,111,111,116,0,114,111,109,97,110,105,110,99,
+104,0,49,124,49,50,32,114,111,109,97,110,102,111,111,116,0,114,111,109,
+97,110,100,105,103,105,116,0,49,124,49,54,32,114,111,109,97,110,102,111,
+111,116,0,114,111,109,97,110,112,97,108,109,0,49,124,52,32,114,111,109,
+97,110,102,111,111,116,0,114,111,109,97,110,99,117,98,105,116,0,49,56,
+32,114,111,109,97,110,105,110,99,104,0,114,111,109,97,110,112,97,99,101,
+0,53,32,114,111,109,97,110,102,101,101,116,0,112,97,115,115,117,115,0,
+114,111,109,97,110,112,97,99,101,0,114,111,109,97,110,112,101,114,99,104,
+0,49,48,32,114,111,109,97,110,102,101,101,116,0,115,116,97,100,101,0,
+49,50,53,32,114,111,109,97,110,112,97,99,101,115,0,115,116,97,100,105,
+97,0,115,116,97,100,101,0,115,116,97,100,105,117,109,0,115,116,97,100,
+101,0,114,111,109,97,110,109,105,108,101,0,56,32,115,116,97,100,105,97,
+0,114,111,109,97,110,108,101,97,103,117,101,0,49,46,53,32,114,111,109,
+97,110,109,105,108,101,0,115,99,104,111,101,110,117,115,0,52,32,114,111,
+109,97,110,109,105,108,101,0,101,97,114,108,121,114,111,109,97,110,102,111,
+111,116,0,50,57,46,55,51,32,99,109,0,112,101,115,100,114,117,115,105,
+97,110,117,115,0,51,51,46,51,32,99,109,0,108,97,116,101,114,111,109,
+97,110,102,111,111,116,0,50,57,46,52,50,32,99,109,0,97,99,116,117,
+115,108,101,110,103,116,104,0,49,50,48,32,114,111,109,97,110,102,101,101,
+116,0,97,99,116,117,115,0,49,50,48,42,52,32,114,111,109,97,110,102,
+101,101,116,94,50,0,115,113,117,97,114,101,97,99,116,117,115,0,49,50,
+48,94,50,32,114,111,109,97,110,102,101,101,116,94,50,0,97,99,110,117,
+97,0,115,113,117,97,114,101,97,99,116,117,115,0,105,117,103,101,114,117,
+109,0,50,32,115,113,117,97,114,101,97,99,116,117,115,0,105,117,103,101,
+114,97,0,105,117,103,101,114,117,109,0,106,117,103,101,114,117,109,0,105,
+117,103,101,114,117,109,0,106,117,103,101,114,97,0,105,117,103,101,114,117,
+109,0,104,101,114,101,100,105,117,109,0,50,32,105,117,103,101,114,97,0,
+104,101,114,101,100,105,97,0,104,101,114,101,100,105,117,109,0,99,101,110,
+116,117,114,105,97,0,49,48,48,32,104,101,114,101,100,105,97,0,99,101,
+110,116,117,114,105,117,109,0,99,101,110,116,117,114,105,97,0,115,101,120,
+116,97,114,105,117,115,0,51,53,46,52,32,105,110,94,51,0,115,101,120,
+116,97,114,105,105,0,115,101,120,116,97,114,105,117,115,0,99,111,99,104,
+108,101,97,114,105,97,0,49,124,52,56,32,115,101,120,116,97,114,105,117,
+115,0,99,121,97,116,104,105,0,49,124,49,50,32,115,101,120,116,97,114,
+105,117,115,0,97,99,101,116,97,98,117,108,97,0,49,124,56,32,115,101,
+120,116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,97,0,49,124,
+52,32,115,101,120,116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,
+117,115,0,113,117,97,114,116,97,114,105,97,0,104,101,109,105,110,97,101,
+0,49,124,50,32,115,101,120,116,97,114,105,117,115,0,104,101,109,105,110,
+97,0,104,101,109,105,110,97,101,0,99,104,101,111,110,105,120,0,49,46,
+53,32,115,101,120,116,97,114,105,105,0,115,101,109,111,100,105,117,115,0,
+56,32,115,101,120,116,97,114,105,117,115,0,115,101,109,111,100,105,105,0,
+115,101,109,111,100,105,117,115,0,109,111,100,105,117,115,0,49,54,32,115,
+101,120,116,97,114,105,117,115,0,109,111,100,105,105,0,109,111,100,105,117,
+115,0,99,111,110,103,105,117,115,0,49,50,32,104,101,109,105,110,97,101,
+0,99,111,110,103,105,105,0,99,111,110,103,105,117,115,0,97,109,112,104,
+111,114,97,0,56,32,99,111,110,103,105,105,0,97,109,112,104,111,114,97,
+101,0,97,109,112,104,111,114,97,0,99,117,108,108,101,117,115,0,50,48,
+32,97,109,112,104,111,114,97,101,0,113,117,97,100,114,97,110,116,97,108,
+0,97,109,112,104,111,114,97,0,108,105,98,114,97,0,53,48,53,50,32,
+103,114,97,105,110,0,108,105,98,114,97,101,0,108,105,98,114,97,0,114,
+111,109,97,110,112,111,117,110,100,0,108,105,98,114,97,0,117,110,99,105,
+97,0,49,124,49,50,32,108,105,98,114,97,0,117,110,99,105,97,101,0,
+117,110,99,105,97,0,114,111,109,97,110,111,117,110,99,101,0,117,110,99,
+105,97,0,100,101,117,110,120,0,49,49,32,117,110,99,105,97,0,100,101,
+120,116,97,110,115,0,49,48,32,117,110,99,105,97,0,100,111,100,114,97,
+110,115,0,57,32,117,110,99,105,97,0,98,101,115,0,56,32,117,110,99,
+105,97,0,115,101,112,114,117,110,120,0,55,32,117,110,99,105,97,0,115,
+101,109,105,115,0,54,32,117,110,99,105,97,0,113,117,105,110,99,117,110,
+120,0,53,32,117,110,99,105,97,0,116,114,105,101,110,115,0,52,32,117,
+110,99,105,97,0,113,117,97,100,114,97,110,115,0,51,32,117,110,99,105,
+97,0,115,101,120,116,97,110,115,0,50,32,117,110,99,105,97,0,115,101,
+115,99,117,110,99,105,97,0,49,46,53,32,117,110,99,105,97,0,115,101,
+109,117,110,99,105,97,0,49,124,50,32,117,110,99,105,97,0,115,105,115,
+99,105,108,105,117,115,0,49,124,52,32,117,110,99,105,97,0,115,101,120,
+116,117,108,97,0,49,124,54,32,117,110,99,105,97,0,115,101,109,105,115,
+101,120,116,117,108,97,0,49,124,49,50,32,117,110,99,105,97,0,115,99,
+114,105,112,116,117,108,117,109,0,49,124,50,52,32,117,110,99,105,97,0,
+115,99,114,117,112,117,108,97,0,115,99,114,105,112,116,117,108,117,109,0,
+114,111,109,97,110,111,98,111,108,0,49,124,50,32,115,99,114,117,112,117,
+108,97,0,114,111,109,97,110,97,115,112,111,117,110,100,0,52,50,49,48,
+32,103,114,97,105,110,0,101,103,121,112,116,105,97,110,114,111,121,97,108,
+99,117,98,105,116,0,50,48,46,54,51,32,105,110,0,101,103,121,112,116,
+105,97,110,112,97,108,109,0,49,124,55,32,101,103,121,112,116,105,97,110,
+114,111,121,97,108,99,117,98,105,116,0,101,103,121,112,116,105,97,110,100,
+105,103,105,116,0,49,124,52,32,101,103,121,112,116,105,97,110,112,97,108,
+109,0,101,103,121,112,116,105,97,110,115,104,111,114,116,99,117,98,105,116,
+0,54,32,101,103,121,112,116,105,97,110,112,97,108,109,0,100,111,117,98,
+108,101,114,101,109,101,110,0,50,57,46,49,54,32,105,110,0,114,101,109,
+101,110,100,105,103,105,116,0,49,124,52,48,32,100,111,117,98,108,101,114,
+101,109,101,110,0,103,114,101,101,107,102,111,111,116,0,49,50,46,52,53,
+32,105,110,0,103,114,101,101,107,102,101,101,116,0,103,114,101,101,107,102,
+111,111,116,0,103,114,101,101,107,99,117,98,105,116,0,49,46,53,32,103,
+114,101,101,107,102,111,111,116,0,112,111,117,115,0,103,114,101,101,107,102,
+111,111,116,0,112,111,100,101,115,0,103,114,101,101,107,102,111,111,116,0,
+111,114,103,117,105,97,0,54,32,103,114,101,101,107,102,111,111,116,0,103,
+114,101,101,107,102,97,116,104,111,109,0,111,114,103,117,105,97,0,115,116,
+97,100,105,111,110,0,49,48,48,32,111,114,103,117,105,97,0,97,107,97,
+105,110,97,0,49,48,32,103,114,101,101,107,102,101,101,116,0,112,108,101,
+116,104,114,111,110,0,49,48,32,97,107,97,105,110,97,0,103,114,101,101,
+107,102,105,110,103,101,114,0,49,124,49,54,32,103,114,101,101,107,102,111,
+111,116,0,104,111,109,101,114,105,99,99,117,98,105,116,0,50,48,32,103,
+114,101,101,107,102,105,110,103,101,114,115,0,115,104,111,114,116,103,114,101,
+101,107,99,117,98,105,116,0,49,56,32,103,114,101,101,107,102,105,110,103,
+101,114,115,0,105,111,110,105,99,102,111,111,116,0,50,57,54,32,109,109,
+0,100,111,114,105,99,102,111,111,116,0,51,50,54,32,109,109,0,111,108,
+121,109,112,105,99,99,117,98,105,116,0,50,53,32,114,101,109,101,110,100,
+105,103,105,116,0,111,108,121,109,112,105,99,102,111,111,116,0,50,124,51,
+32,111,108,121,109,112,105,99,99,117,98,105,116,0,111,108,121,109,112,105,
+99,102,105,110,103,101,114,0,49,124,49,54,32,111,108,121,109,112,105,99,
+102,111,111,116,0,111,108,121,109,112,105,99,102,101,101,116,0,111,108,121,
+109,112,105,99,102,111,111,116,0,111,108,121,109,112,105,99,100,97,107,121,
+108,111,115,0,111,108,121,109,112,105,99,102,105,110,103,101,114,0,111,108,
+121,109,112,105,99,112,97,108,109,0,49,124,52,32,111,108,121,109,112,105,
+99,102,111,111,116,0,111,108,121,109,112,105,99,112,97,108,101,115,116,114,
+97,0,111,108,121,109,112,105,99,112,97,108,109,0,111,108,121,109,112,105,
+99,115,112,105,116,104,97,109,101,0,51,124,52,32,102,111,111,116,0,111,
+108,121,109,112,105,99,115,112,97,110,0,111,108,121,109,112,105,99,115,112,
+105,116,104,97,109,101,0,111,108,121,109,112,105,99,98,101,109,97,0,50,
+46,53,32,111,108,121,109,112,105,99,102,101,101,116,0,111,108,121,109,112,
+105,99,112,97,99,101,0,111,108,121,109,112,105,99,98,101,109,97,0,111,
+108,121,109,112,105,99,111,114,103,117,105,97,0,54,32,111,108,121,109,112,
+105,99,102,101,101,116,0,111,108,121,109,112,105,99,102,97,116,104,111,109,
+0,111,108,121,109,112,105,99,111,114,103,117,105,97,0,111,108,121,109,112,
+105,99,99,111,114,100,0,54,48,32,111,108,121,109,112,105,99,102,101,101,
+116,0,111,108,121,109,112,105,99,97,109,109,97,0,111,108,121,109,112,105,
+99,99,111,114,100,0,111,108,121,109,112,105,99,112,108,101,116,104,114,111,
+110,0,49,48,48,32,111,108,121,109,112,105,99,102,101,101,116,0,111,108,
+121,109,112,105,99,115,116,97,100,105,111,110,0,54,48,48,32,111,108,121,
+109,112,105,99,102,101,101,116,0,103,114,101,101,107,107,111,116,121,108,101,
+0,50,55,48,32,109,108,0,120,101,115,116,101,115,0,50,32,103,114,101,
+101,107,107,111,116,121,108,101,0,107,104,111,117,115,0,49,50,32,103,114,
+101,101,107,107,111,116,121,108,101,0,109,101,116,114,101,116,101,115,0,49,
+50,32,107,104,111,117,115,0,99,104,111,105,110,105,120,0,52,32,103,114,
+101,101,107,107,111,116,121,108,101,0,104,101,107,116,101,111,115,0,56,32,
+99,104,111,105,110,105,120,0,109,101,100,105,109,110,111,115,0,54,32,104,
+101,107,116,101,111,115,0,97,101,103,105,110,97,115,116,97,116,101,114,0,
+49,57,50,32,103,114,97,105,110,0,97,101,103,105,110,97,100,114,97,99,
+104,109,97,101,0,49,124,50,32,97,101,103,105,110,97,115,116,97,116,101,
+114,0,97,101,103,105,110,97,111,98,111,108,0,49,124,54,32,97,101,103,
+105,110,97,100,114,97,99,104,109,97,101,0,97,101,103,105,110,97,109,105,
+110,97,0,53,48,32,97,101,103,105,110,97,115,116,97,116,101,114,115,0,
+97,101,103,105,110,97,116,97,108,101,110,116,0,54,48,32,97,101,103,105,
+110,97,109,105,110,97,0,97,116,116,105,99,115,116,97,116,101,114,0,49,
+51,53,32,103,114,97,105,110,0,97,116,116,105,99,100,114,97,99,104,109,
+97,101,0,49,124,50,32,97,116,116,105,99,115,116,97,116,101,114,0,97,
+116,116,105,99,111,98,111,108,0,49,124,54,32,97,116,116,105,99,100,114,
+97,99,104,109,97,101,0,97,116,116,105,99,109,105,110,97,0,53,48,32,
+97,116,116,105,99,115,116,97,116,101,114,115,0,97,116,116,105,99,116,97,
+108,101,110,116,0,54,48,32,97,116,116,105,99,109,105,110,97,0,110,111,
+114,116,104,101,114,110,99,117,98,105,116,0,50,54,46,54,32,105,110,0,
+110,111,114,116,104,101,114,110,102,111,111,116,0,49,124,50,32,110,111,114,
+116,104,101,114,110,99,117,98,105,116,0,115,117,109,101,114,105,97,110,99,
+117,98,105,116,0,52,57,53,32,109,109,0,107,117,115,0,115,117,109,101,
+114,105,97,110,99,117,98,105,116,0,115,117,109,101,114,105,97,110,102,111,
+111,116,0,50,124,51,32,115,117,109,101,114,105,97,110,99,117,98,105,116,
+0,97,115,115,121,114,105,97,110,99,117,98,105,116,0,50,49,46,54,32,
+105,110,0,97,115,115,121,114,105,97,110,102,111,111,116,0,49,124,50,32,
+97,115,115,121,114,105,97,110,99,117,98,105,116,0,97,115,115,121,114,105,
+97,110,112,97,108,109,0,49,124,51,32,97,115,115,121,114,105,97,110,102,
+111,111,116,0,97,115,115,121,114,105,97,110,115,117,115,105,0,49,124,50,
+48,32,97,115,115,121,114,105,97,110,112,97,108,109,0,115,117,115,105,0,
+97,115,115,121,114,105,97,110,115,117,115,105,0,112,101,114,115,105,97,110,
+114,111,121,97,108,99,117,98,105,116,0,55,32,97,115,115,121,114,105,97,
+110,112,97,108,109,0,104,97,115,104,105,109,105,99,117,98,105,116,0,50,
+53,46,53,54,32,105,110,0,98,108,97,99,107,99,117,98,105,116,0,50,
+49,46,50,56,32,105,110,0,97,114,97,98,105,99,102,101,101,116,0,49,
+124,50,32,98,108,97,99,107,99,117,98,105,116,0,97,114,97,98,105,99,
+102,111,111,116,0,97,114,97,98,105,99,102,101,101,116,0,97,114,97,98,
+105,99,105,110,99,104,0,49,124,49,50,32,97,114,97,98,105,99,102,111,
+111,116,0,97,114,97,98,105,99,109,105,108,101,0,52,48,48,48,32,98,
+108,97,99,107,99,117,98,105,116,0,115,105,108,118,101,114,100,105,114,104,
+101,109,0,52,53,32,103,114,97,105,110,0,116,114,97,100,101,100,105,114,
+104,101,109,0,52,56,32,103,114,97,105,110,0,115,105,108,118,101,114,107,
+105,114,97,116,0,49,124,49,54,32,115,105,108,118,101,114,100,105,114,104,
+101,109,0,115,105,108,118,101,114,119,117,107,105,121,101,104,0,49,48,32,
+115,105,108,118,101,114,100,105,114,104,101,109,0,115,105,108,118,101,114,114,
+111,116,108,0,49,50,32,115,105,108,118,101,114,119,117,107,105,121,101,104,
+0,97,114,97,98,105,99,115,105,108,118,101,114,112,111,117,110,100,0,115,
+105,108,118,101,114,114,111,116,108,0,116,114,97,100,101,107,105,114,97,116,
+0,49,124,49,54,32,116,114,97,100,101,100,105,114,104,101,109,0,116,114,
+97,100,101,119,117,107,105,121,101,104,0,49,48,32,116,114,97,100,101,100,
+105,114,104,101,109,0,116,114,97,100,101,114,111,116,108,0,49,50,32,116,
+114,97,100,101,119,117,107,105,121,101,104,0,97,114,97,98,105,99,116,114,
+97,100,101,112,111,117,110,100,0,116,114,97,100,101,114,111,116,108,0,112,
+97,114,97,115,97,110,103,0,51,46,53,32,109,105,108,101,0,98,105,98,
+108,105,99,97,108,99,117,98,105,116,0,50,49,46,56,32,105,110,0,104,
+101,98,114,101,119,99,117,98,105,116,0,49,55,46,53,56,32,105,110,0,
+108,105,0,49,48,124,50,55,46,56,32,109,105,108,101,0,108,105,97,110,
+103,0,49,49,124,51,32,111,122,0,116,105,109,101,112,111,105,110,116,0,
+49,124,53,32,104,111,117,114,0,116,105,109,101,109,105,110,117,116,101,0,
+49,124,49,48,32,104,111,117,114,0,116,105,109,101,111,115,116,101,110,116,
+0,49,124,54,48,32,104,111,117,114,0,116,105,109,101,111,117,110,99,101,
+0,49,124,56,32,116,105,109,101,111,115,116,101,110,116,0,116,105,109,101,
+97,116,111,109,0,49,124,52,55,32,116,105,109,101,111,117,110,99,101,0,
+109,105,116,101,0,49,124,50,48,32,103,114,97,105,110,0,100,114,111,105,
+116,0,49,124,50,52,32,109,105,116,101,0,112,101,114,105,111,116,0,49,
+124,50,48,32,100,114,111,105,116,0,98,108,97,110,99,0,49,124,50,52,
+32,112,101,114,105,111,116,0,162,0,99,101,110,116,0,163,0,98,114,105,
+116,97,105,110,112,111,117,110,100,0,165,0,106,97,112,97,110,121,101,110,
+0,229,110,103,115,116,114,246,109,0,97,110,103,115,116,114,111,109,0,197,
+0,97,110,103,115,116,114,111,109,0,114,246,110,116,103,101,110,0,114,111,
+101,110,116,103,101,110,0,176,67,0,100,101,103,67,0,176,70,0,100,101,
+103,70,0,176,75,0,75,0,176,82,0,100,101,103,82,0,176,0,100,101,
+103,114,101,101,0,121,111,116,116,97,0,49,101,50,52,0,122,101,116,116,
+97,0,49,101,50,49,0,101,120,97,0,49,101,49,56,0,112,101,116,97,
+0,49,101,49,53,0,116,101,114,97,0,49,101,49,50,0,103,105,103,97,
+0,49,101,57,0,109,101,103,97,0,49,101,54,0,109,121,114,105,97,0,
+49,101,52,0,107,105,108,111,0,49,101,51,0,104,101,99,116,111,0,49,
+101,50,0,100,101,99,97,0,49,101,49,0,100,101,107,97,0,100,101,99,
+97,0,100,101,99,105,0,49,101,45,49,0,99,101,110,116,105,0,49,101,
+45,50,0,109,105,108,108,105,0,49,101,45,51,0,109,105,99,114,111,0,
+49,101,45,54,0,110,97,110,111,0,49,101,45,57,0,112,105,99,111,0,
+49,101,45,49,50,0,102,101,109,116,111,0,49,101,45,49,53,0,97,116,
+116,111,0,49,101,45,49,56,0,122,101,112,116,111,0,49,101,45,50,49,
+0,121,111,99,116,111,0,49,101,45,50,52,0,113,117,97,114,116,101,114,
+0,49,124,52,0,115,101,109,105,0,48,46,53,0,100,101,109,105,0,48,
+46,53,0,104,101,109,105,0,48,46,53,0,104,97,108,102,0,48,46,53,
+0,100,111,117,98,108,101,0,50,0,116,114,105,112,108,101,0,51,0,116,
+114,101,98,108,101,0,51,0,107,105,98,105,0,50,94,49,48,0,109,101,
+98,105,0,50,94,50,48,0,103,105,98,105,0,50,94,51,48,0,116,101,
+98,105,0,50,94,52,48,0,112,101,98,105,0,50,94,53,48,0,101,120,
+98,105,0,50,94,54,48,0,75,105,0,107,105,98,105,0,77,105,0,109,
+101,98,105,0,71,105,0,103,105,98,105,0,84,105,0,116,101,98,105,0,
+80,105,0,112,101,98,105,0,69,105,0,101,120,98,105,0,89,0,121,111,
+116,116,97,0,90,0,122,101,116,116,97,0,69,0,101,120,97,0,80,0,
+112,101,116,97,0,84,0,116,101,114,97,0,71,0,103,105,103,97,0,77,
+0,109,101,103,97,0,107,0,107,105,108,111,0,104,0,104,101,99,116,111,
+0,100,97,0,100,101,107,97,0,100,0,100,101,99,105,0,99,0,99,101,
+110,116,105,0,109,0,109,105,108,108,105,0,117,0,109,105,99,114,111,0,
+110,0,110,97,110,111,0,112,0,112,105,99,111,0,102,0,102,101,109,116,
+111,0,97,0,97,116,116,111,0,122,0,122,101,112,116,111,0,121,0,121,
+111,99,116,111,0,85,83,0,85,83,0,115,117,114,118,101,121,0,85,83,
+0,103,101,111,100,101,116,105,99,0,85,83,0,105,110,116,0,105,110,116,
+0,85,75,0,85,75,0,98,114,105,116,105,115,104,0,85,75,0,188,0,
+49,124,52,0,189,0,49,124,50,0,190,0,51,124,52,0,181,0,109,105,
+99,114,111,0,99,105,114,99,108,101,97,114,101,97,0,114,0,112,105,32,
+114,94,50,0,109,0,115,113,114,116,40,99,105,114,99,108,101,97,114,101,
+97,47,112,105,41,0,109,94,50,0,99,105,114,99,108,101,97,114,101,97,
+0,115,112,104,101,114,101,118,111,108,117,109,101,0,114,0,52,124,51,32,
+112,105,32,114,94,51,0,109,0,99,117,98,101,114,111,111,116,40,115,112,
+104,101,114,101,118,111,108,117,109,101,47,52,124,51,32,112,105,41,0,109,
+94,51,0,115,112,104,101,114,101,118,111,108,117,109,101,0,115,112,104,101,
+114,101,118,111,108,0,114,0,115,112,104,101,114,101,118,111,108,117,109,101,
+40,114,41,0,109,0,126,115,112,104,101,114,101,118,111,108,117,109,101,40,
+115,112,104,101,114,101,118,111,108,41,0,109,94,51,0,115,112,104,101,114,
+101,118,111,108,0,115,113,117,97,114,101,0,120,0,120,94,50,0,115,113,
+114,116,40,115,113,117,97,114,101,41,0,115,113,117,97,114,101,0,112,72,
+0,120,0,49,48,94,40,45,120,41,32,109,111,108,47,108,105,116,101,114,
+0,0,40,45,108,111,103,40,112,72,32,108,105,116,101,114,115,47,109,111,
+108,41,41,0,109,111,108,47,108,105,116,101,114,0,112,72,0,116,101,109,
+112,67,0,120,0,120,32,75,32,43,32,115,116,100,116,101,109,112,0,0,
+40,116,101,109,112,67,32,43,40,45,115,116,100,116,101,109,112,41,41,47,
+75,0,75,0,116,101,109,112,67,0,116,101,109,112,99,101,108,115,105,117,
+115,0,120,0,116,101,109,112,67,40,120,41,0,0,126,116,101,109,112,67,
+40,116,101,109,112,99,101,108,115,105,117,115,41,0,75,0,116,101,109,112,
+99,101,108,115,105,117,115,0,116,101,109,112,70,0,120,0,40,120,43,40,
+45,51,50,41,41,32,100,101,103,70,32,43,32,115,116,100,116,101,109,112,
+0,0,40,116,101,109,112,70,43,40,45,115,116,100,116,101,109,112,41,41,
+47,100,101,103,70,32,43,32,51,50,0,75,0,116,101,109,112,70,0,116,
+101,109,112,102,97,104,114,101,110,104,101,105,116,0,120,0,116,101,109,112,
+70,40,120,41,0,0,126,116,101,109,112,70,40,116,101,109,112,102,97,104,
+114,101,110,104,101,105,116,41,0,75,0,116,101,109,112,102,97,104,114,101,
+110,104,101,105,116,0,116,101,109,112,114,101,97,117,109,117,114,0,120,0,
+120,32,100,101,103,114,101,97,117,109,117,114,43,115,116,100,116,101,109,112,
+0,0,40,116,101,109,112,114,101,97,117,109,117,114,43,40,45,115,116,100,
+116,101,109,112,41,41,47,100,101,103,114,101,97,117,109,117,114,0,75,0,
+116,101,109,112,114,101,97,117,109,117,114,0,103,97,115,109,97,114,107,0,
+100,101,103,82,0,98,114,105,108,0,120,0,50,94,40,120,43,45,49,48,
+48,41,32,108,97,109,98,101,114,116,115,0,0,108,111,103,50,40,98,114,
+105,108,47,108,97,109,98,101,114,116,41,43,49,48,48,0,108,97,109,98,
+101,114,116,0,98,114,105,108,0,101,118,49,48,48,0,120,0,50,94,120,
+32,107,49,50,53,48,32,47,32,115,49,48,48,0,0,108,111,103,50,40,
+101,118,49,48,48,32,115,49,48,48,32,47,32,107,49,50,53,48,41,0,
+99,100,47,109,94,50,0,101,118,49,48,48,0,105,118,49,48,48,0,120,
+0,50,94,120,32,99,50,53,48,32,47,32,115,49,48,48,0,49,0,108,
+111,103,50,40,105,118,49,48,48,32,115,49,48,48,32,47,32,99,50,53,
+48,41,0,108,120,0,105,118,49,48,48,0,115,104,111,101,115,105,122,101,
+95,109,101,110,0,110,0,115,104,111,101,95,109,101,110,48,32,43,32,110,
+32,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,0,40,115,104,
+111,101,115,105,122,101,95,109,101,110,43,40,45,115,104,111,101,95,109,101,
+110,48,41,41,47,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,
+105,110,99,104,0,115,104,111,101,115,105,122,101,95,109,101,110,0,115,104,
+111,101,115,105,122,101,95,119,111,109,101,110,0,110,0,115,104,111,101,95,
+119,111,109,101,110,48,32,43,32,110,32,115,104,111,101,115,105,122,101,95,
+100,101,108,116,97,0,0,40,115,104,111,101,115,105,122,101,95,119,111,109,
+101,110,43,40,45,115,104,111,101,95,119,111,109,101,110,48,41,41,47,115,
+104,111,101,115,105,122,101,95,100,101,108,116,97,0,105,110,99,104,0,115,
+104,111,101,115,105,122,101,95,119,111,109,101,110,0,115,104,111,101,115,105,
+122,101,95,98,111,121,115,0,110,0,115,104,111,101,95,98,111,121,115,48,
+32,43,32,110,32,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,
+0,40,115,104,111,101,115,105,122,101,95,98,111,121,115,43,40,45,115,104,
+111,101,95,98,111,121,115,48,41,41,47,115,104,111,101,115,105,122,101,95,
+100,101,108,116,97,0,105,110,99,104,0,115,104,111,101,115,105,122,101,95,
+98,111,121,115,0,115,104,111,101,115,105,122,101,95,103,105,114,108,115,0,
+110,0,115,104,111,101,95,103,105,114,108,115,48,32,43,32,110,32,115,104,
+111,101,115,105,122,101,95,100,101,108,116,97,0,0,40,115,104,111,101,115,
+105,122,101,95,103,105,114,108,115,43,40,45,115,104,111,101,95,103,105,114,
+108,115,48,41,41,47,115,104,111,101,115,105,122,101,95,100,101,108,116,97,
+0,105,110,99,104,0,115,104,111,101,115,105,122,101,95,103,105,114,108,115,
+0,98,97,117,109,101,0,100,0,40,98,97,117,109,101,99,111,110,115,116,
+47,40,98,97,117,109,101,99,111,110,115,116,43,45,100,41,41,32,103,47,
+99,109,94,51,0,49,0,40,98,97,117,109,101,43,40,40,45,103,41,47,
+99,109,94,51,41,41,32,98,97,117,109,101,99,111,110,115,116,32,47,32,
+98,97,117,109,101,0,103,47,99,109,94,51,0,98,97,117,109,101,0,116,
+119,97,100,100,101,108,108,0,120,0,40,49,32,43,32,48,46,48,48,53,
+32,120,41,32,103,32,47,32,99,109,94,51,0,49,0,50,48,48,32,40,
+116,119,97,100,100,101,108,108,32,47,32,40,103,47,99,109,94,51,41,32,
+43,45,32,49,41,0,103,47,99,109,94,51,0,116,119,97,100,100,101,108,
+108,0,113,117,101,118,101,110,110,101,0,120,0,40,49,32,43,32,48,46,
+48,48,49,32,120,41,32,103,32,47,32,99,109,94,51,0,49,0,49,48,
+48,48,32,40,113,117,101,118,101,110,110,101,32,47,32,40,103,47,99,109,
+94,51,41,32,43,45,32,49,41,0,103,47,99,109,94,51,0,113,117,101,
+118,101,110,110,101,0,98,114,105,120,0,103,47,99,109,94,51,0,97,112,
+105,100,101,103,114,101,101,0,120,0,49,52,49,46,53,32,103,47,99,109,
+94,51,32,47,32,40,120,43,49,51,49,46,53,41,0,49,0,49,52,49,
+46,53,32,40,103,47,99,109,94,51,41,32,47,32,97,112,105,100,101,103,
+114,101,101,32,43,32,40,45,49,51,49,46,53,41,0,103,47,99,109,94,
+51,0,97,112,105,100,101,103,114,101,101,0,98,101,108,0,120,0,49,48,
+94,40,120,41,0,49,0,108,111,103,40,98,101,108,41,0,49,0,98,101,
+108,0,100,101,99,105,98,101,108,0,120,0,49,48,94,40,120,47,49,48,
+41,0,49,0,49,48,32,108,111,103,40,100,101,99,105,98,101,108,41,0,
+49,0,100,101,99,105,98,101,108,0,100,66,0,120,0,49,48,94,40,120,
+47,49,48,41,0,49,0,49,48,32,108,111,103,40,100,66,41,0,49,0,
+100,66,0,100,66,87,0,120,0,100,66,40,120,41,32,87,0,49,0,126,
+100,66,40,100,66,87,47,87,41,0,87,0,100,66,87,0,100,66,107,0,
+120,0,100,66,40,120,41,32,107,87,0,49,0,126,100,66,40,100,66,107,
+47,107,87,41,0,87,0,100,66,107,0,100,66,102,0,120,0,100,66,40,
+120,41,32,102,87,0,49,0,126,100,66,40,100,66,102,47,102,87,41,0,
+87,0,100,66,102,0,100,66,109,0,120,0,100,66,40,120,41,32,109,87,
+0,49,0,126,100,66,40,100,66,109,47,109,87,41,0,87,0,100,66,109,
+0,100,66,109,87,0,120,0,100,66,109,40,120,41,0,49,0,126,100,66,
+109,40,100,66,109,87,41,0,87,0,100,66,109,87,0,100,66,74,0,120,
+0,100,66,40,120,41,32,74,0,49,0,126,100,66,40,100,66,74,47,74,
+41,0,74,0,100,66,74,0,100,66,86,0,120,0,100,66,40,48,46,53,
+32,120,41,32,86,0,49,0,126,100,66,40,100,66,86,94,50,32,47,32,
+86,94,50,41,0,86,0,100,66,86,0,100,66,109,86,0,120,0,100,66,
+40,48,46,53,32,120,41,32,109,86,0,49,0,126,100,66,40,100,66,109,
+86,94,50,32,47,32,109,86,94,50,41,0,86,0,100,66,109,86,0,100,
+66,117,86,0,120,0,100,66,40,48,46,53,32,120,41,32,109,105,99,114,
+111,86,0,49,0,126,100,66,40,100,66,117,86,94,50,32,47,32,109,105,
+99,114,111,86,94,50,41,0,86,0,100,66,117,86,0,100,66,117,0,120,
+0,100,66,40,48,46,53,32,120,41,32,115,113,114,116,40,109,87,32,54,
+48,48,32,111,104,109,41,0,49,0,126,100,66,40,100,66,117,94,50,32,
+47,32,109,87,32,54,48,48,32,111,104,109,41,0,86,0,100,66,117,0,
+100,66,118,0,120,0,100,66,117,40,120,41,0,49,0,126,100,66,117,40,
+100,66,118,41,0,86,0,100,66,118,0,100,66,83,80,76,0,120,0,100,
+66,40,48,46,53,32,120,41,32,50,48,32,109,105,99,114,111,80,97,0,
+49,0,126,100,66,40,100,66,83,80,76,94,50,32,47,32,40,50,48,32,
+109,105,99,114,111,80,97,41,94,50,41,0,80,97,0,100,66,83,80,76,
+0,100,66,83,73,76,0,120,0,100,66,40,120,41,32,49,101,45,49,50,
+32,87,47,109,94,50,0,49,0,126,100,66,40,100,66,83,73,76,32,47,
+32,40,49,101,45,49,50,32,87,47,109,94,50,41,41,0,87,47,109,94,
+50,0,100,66,83,73,76,0,100,66,83,87,76,0,120,0,100,66,40,120,
+41,32,49,101,45,49,50,32,87,0,49,0,126,100,66,40,100,66,83,87,
+76,47,49,101,45,49,50,32,87,41,0,87,0,100,66,83,87,76,0,109,
+117,115,105,99,97,108,99,101,110,116,0,120,0,115,101,109,105,116,111,110,
+101,94,40,120,47,49,48,48,41,0,49,0,49,48,48,32,108,111,103,40,
+109,117,115,105,99,97,108,99,101,110,116,41,47,108,111,103,40,115,101,109,
+105,116,111,110,101,41,0,49,0,109,117,115,105,99,97,108,99,101,110,116,
+0,119,105,114,101,103,97,117,103,101,0,103,0,49,124,50,48,48,32,57,
+50,94,40,40,51,54,43,40,45,103,41,41,47,51,57,41,32,105,110,0,
+0,51,54,43,40,45,51,57,41,108,110,40,50,48,48,32,119,105,114,101,
+103,97,117,103,101,47,105,110,41,47,108,110,40,57,50,41,0,109,0,119,
+105,114,101,103,97,117,103,101,0,98,114,119,105,114,101,103,97,117,103,101,
+0,105,110,0,112,108,97,116,101,103,97,117,103,101,0,40,111,122,47,102,
+116,94,50,41,47,40,52,56,48,42,108,98,47,102,116,94,51,41,0,115,
+116,100,103,97,117,103,101,0,40,111,122,47,102,116,94,50,41,47,40,53,
+48,49,46,56,52,42,108,98,47,102,116,94,51,41,0,122,105,110,99,103,
+97,117,103,101,0,105,110,0,115,99,114,101,119,103,97,117,103,101,0,103,
+0,40,46,48,54,32,43,32,46,48,49,51,32,103,41,32,105,110,0,0,
+40,115,99,114,101,119,103,97,117,103,101,47,105,110,32,43,32,40,45,46,
+48,54,41,41,32,47,32,46,48,49,51,0,109,0,115,99,114,101,119,103,
+97,117,103,101,0,103,114,105,116,95,80,0,109,105,99,114,111,110,0,103,
+114,105,116,95,70,0,109,105,99,114,111,110,0,103,114,105,116,95,97,110,
+115,105,98,111,110,100,101,100,0,109,105,99,114,111,110,0,97,110,115,105,
+99,111,97,116,101,100,0,109,105,99,114,111,110,0,106,105,115,103,114,105,
+116,0,109,105,99,114,111,110,0,103,114,105,116,95,65,0,109,105,99,114,
+111,110,0,114,105,110,103,115,105,122,101,0,110,0,40,49,46,52,50,49,
+54,43,46,49,48,49,56,32,110,41,32,105,110,0,0,40,114,105,110,103,
+115,105,122,101,47,105,110,32,43,32,40,45,49,46,52,50,49,54,41,41,
+47,46,49,48,49,56,0,105,110,0,114,105,110,103,115,105,122,101,0,106,
+112,114,105,110,103,115,105,122,101,0,110,0,40,51,56,124,51,32,43,32,
+110,47,51,41,32,112,105,32,109,109,0,0,51,32,106,112,114,105,110,103,
+115,105,122,101,47,32,112,105,32,109,109,32,43,32,40,45,51,56,41,0,
+109,109,0,106,112,114,105,110,103,115,105,122,101,0,101,117,114,105,110,103,
+115,105,122,101,0,110,0,40,110,43,52,48,41,32,109,109,0,0,101,117,
+114,105,110,103,115,105,122,101,47,109,109,32,43,32,40,45,52,48,41,0,
+109,109,0,101,117,114,105,110,103,115,105,122,101,0,101,110,95,85,83,0,
+107,103,0,33,0,107,105,108,111,103,114,97,109,0,107,103,0,115,0,33,
+0,115,101,99,111,110,100,0,115,0,109,0,33,0,109,101,116,101,114,0,
+109,0,65,0,33,0,97,109,112,101,114,101,0,65,0,97,109,112,0,97,
+109,112,101,114,101,0,99,100,0,33,0,99,97,110,100,101,108,97,0,99,
+100,0,109,111,108,0,33,0,109,111,108,101,0,109,111,108,0,75,0,33,
+0,107,101,108,118,105,110,0,75,0,114,97,100,105,97,110,0,33,100,105,
+109,101,110,115,105,111,110,108,101,115,115,0,115,114,0,33,100,105,109,101,
+110,115,105,111,110,108,101,115,115,0,115,116,101,114,97,100,105,97,110,0,
+115,114,0,85,83,36,0,33,0,98,105,116,0,33,0,111,110,101,0,49,
+0,116,119,111,0,50,0,100,111,117,98,108,101,0,50,0,99,111,117,112,
+108,101,0,50,0,116,104,114,101,101,0,51,0,116,114,105,112,108,101,0,
+51,0,102,111,117,114,0,52,0,113,117,97,100,114,117,112,108,101,0,52,
+0,102,105,118,101,0,53,0,113,117,105,110,116,117,112,108,101,0,53,0,
+115,105,120,0,54,0,115,101,118,101,110,0,55,0,101,105,103,104,116,0,
+56,0,110,105,110,101,0,57,0,116,101,110,0,49,48,0,101,108,101,118,
+101,110,0,49,49,0,116,119,101,108,118,101,0,49,50,0,116,104,105,114,
+116,101,101,110,0,49,51,0,102,111,117,114,116,101,101,110,0,49,52,0,
+102,105,102,116,101,101,110,0,49,53,0,115,105,120,116,101,101,110,0,49,
+54,0,115,101,118,101,110,116,101,101,110,0,49,55,0,101,105,103,104,116,
+101,101,110,0,49,56,0,110,105,110,101,116,101,101,110,0,49,57,0,116,
+119,101,110,116,121,0,50,48,0,116,104,105,114,116,121,0,51,48,0,102,
+111,114,116,121,0,52,48,0,102,105,102,116,121,0,53,48,0,115,105,120,
+116,121,0,54,48,0,115,101,118,101,110,116,121,0,55,48,0,101,105,103,
+104,116,121,0,56,48,0,110,105,110,101,116,121,0,57,48,0,104,117,110,
+100,114,101,100,0,49,48,48,0,116,104,111,117,115,97,110,100,0,49,48,
+48,48,0,109,105,108,108,105,111,110,0,49,101,54,0,115,104,111,114,116,
+98,105,108,108,105,111,110,0,49,101,57,0,115,104,111,114,116,116,114,105,
+108,108,105,111,110,0,49,101,49,50,0,115,104,111,114,116,113,117,97,100,
+114,105,108,108,105,111,110,0,49,101,49,53,0,115,104,111,114,116,113,117,
+105,110,116,105,108,108,105,111,110,0,49,101,49,56,0,115,104,111,114,116,
+115,101,120,116,105,108,108,105,111,110,0,49,101,50,49,0,115,104,111,114,
+116,115,101,112,116,105,108,108,105,111,110,0,49,101,50,52,0,115,104,111,
+114,116,111,99,116,105,108,108,105,111,110,0,49,101,50,55,0,115,104,111,
+114,116,110,111,110,105,108,108,105,111,110,0,49,101,51,48,0,115,104,111,
+114,116,110,111,118,101,110,116,105,108,108,105,111,110,0,115,104,111,114,116,
+110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,100,101,99,105,108,
+108,105,111,110,0,49,101,51,51,0,115,104,111,114,116,117,110,100,101,99,
+105,108,108,105,111,110,0,49,101,51,54,0,115,104,111,114,116,100,117,111,
+100,101,99,105,108,108,105,111,110,0,49,101,51,57,0,115,104,111,114,116,
+116,114,101,100,101,99,105,108,108,105,111,110,0,49,101,52,50,0,115,104,
+111,114,116,113,117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,
+0,49,101,52,53,0,115,104,111,114,116,113,117,105,110,100,101,99,105,108,
+108,105,111,110,0,49,101,52,56,0,115,104,111,114,116,115,101,120,100,101,
+99,105,108,108,105,111,110,0,49,101,53,49,0,115,104,111,114,116,115,101,
+112,116,101,110,100,101,99,105,108,108,105,111,110,0,49,101,53,52,0,115,
+104,111,114,116,111,99,116,111,100,101,99,105,108,108,105,111,110,0,49,101,
+53,55,0,115,104,111,114,116,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,49,101,54,48,0,115,104,111,114,116,118,105,103,105,110,116,105,
+108,108,105,111,110,0,49,101,54,51,0,99,101,110,116,105,108,108,105,111,
+110,0,49,101,51,48,51,0,103,111,111,103,111,108,0,49,101,49,48,48,
+0,108,111,110,103,98,105,108,108,105,111,110,0,109,105,108,108,105,111,110,
+94,50,0,108,111,110,103,116,114,105,108,108,105,111,110,0,109,105,108,108,
+105,111,110,94,51,0,108,111,110,103,113,117,97,100,114,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,52,0,108,111,110,103,113,117,105,110,
+116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,53,0,108,111,
+110,103,115,101,120,116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,
+94,54,0,108,111,110,103,115,101,112,116,105,108,108,105,111,110,0,109,105,
+108,108,105,111,110,94,55,0,108,111,110,103,111,99,116,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,56,0,108,111,110,103,110,111,110,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,57,0,108,111,110,103,
+110,111,118,101,110,116,105,108,108,105,111,110,0,108,111,110,103,110,111,110,
+105,108,108,105,111,110,0,108,111,110,103,100,101,99,105,108,108,105,111,110,
+0,109,105,108,108,105,111,110,94,49,48,0,108,111,110,103,117,110,100,101,
+99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,49,0,108,
+111,110,103,100,117,111,100,101,99,105,108,108,105,111,110,0,109,105,108,108,
+105,111,110,94,49,50,0,108,111,110,103,116,114,101,100,101,99,105,108,108,
+105,111,110,0,109,105,108,108,105,111,110,94,49,51,0,108,111,110,103,113,
+117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,0,109,105,108,
+108,105,111,110,94,49,52,0,108,111,110,103,113,117,105,110,100,101,99,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,53,0,108,111,110,
+103,115,101,120,100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,
+110,94,49,54,0,108,111,110,103,115,101,112,116,100,101,99,105,108,108,105,
+111,110,0,109,105,108,108,105,111,110,94,49,55,0,108,111,110,103,111,99,
+116,111,100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,
+49,56,0,108,111,110,103,110,111,118,101,109,100,101,99,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,49,57,0,108,111,110,103,118,105,103,
+105,110,116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,50,48,
+0,109,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,
+111,110,0,98,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,
+108,105,111,110,94,50,0,116,114,105,108,108,105,97,114,100,0,49,48,48,
+48,32,109,105,108,108,105,111,110,94,51,0,113,117,97,100,114,105,108,108,
+105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,52,0,
+113,117,105,110,116,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,
+108,108,105,111,110,94,53,0,115,101,120,116,105,108,108,105,97,114,100,0,
+49,48,48,48,32,109,105,108,108,105,111,110,94,54,0,115,101,112,116,105,
+108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,
+55,0,111,99,116,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,
+108,108,105,111,110,94,56,0,110,111,110,105,108,108,105,97,114,100,0,49,
+48,48,48,32,109,105,108,108,105,111,110,94,57,0,110,111,118,101,110,116,
+105,108,108,105,97,114,100,0,110,111,110,105,108,108,105,97,114,100,0,100,
+101,99,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,
+111,110,94,49,48,0,108,111,110,103,109,105,108,108,105,97,114,100,0,109,
+105,108,108,105,97,114,100,0,108,111,110,103,98,105,108,108,105,97,114,100,
+0,98,105,108,108,105,97,114,100,0,108,111,110,103,116,114,105,108,108,105,
+97,114,100,0,116,114,105,108,108,105,97,114,100,0,108,111,110,103,113,117,
+97,100,114,105,108,108,105,97,114,100,0,113,117,97,100,114,105,108,108,105,
+97,114,100,0,108,111,110,103,113,117,105,110,116,105,108,108,105,97,114,100,
+0,113,117,105,110,116,105,108,108,105,97,114,100,0,108,111,110,103,115,101,
+120,116,105,108,108,105,97,114,100,0,115,101,120,116,105,108,108,105,97,114,
+100,0,108,111,110,103,115,101,112,116,105,108,108,105,97,114,100,0,115,101,
+112,116,105,108,108,105,97,114,100,0,108,111,110,103,111,99,116,105,108,108,
+105,97,114,100,0,111,99,116,105,108,108,105,97,114,100,0,108,111,110,103,
+110,111,110,105,108,108,105,97,114,100,0,110,111,110,105,108,108,105,97,114,
+100,0,108,111,110,103,110,111,118,101,110,116,105,108,108,105,97,114,100,0,
+110,111,118,101,110,116,105,108,108,105,97,114,100,0,108,111,110,103,100,101,
+99,105,108,108,105,97,114,100,0,100,101,99,105,108,108,105,97,114,100,0,
+98,105,108,108,105,111,110,0,115,104,111,114,116,98,105,108,108,105,111,110,
+0,116,114,105,108,108,105,111,110,0,115,104,111,114,116,116,114,105,108,108,
+105,111,110,0,113,117,97,100,114,105,108,108,105,111,110,0,115,104,111,114,
+116,113,117,97,100,114,105,108,108,105,111,110,0,113,117,105,110,116,105,108,
+108,105,111,110,0,115,104,111,114,116,113,117,105,110,116,105,108,108,105,111,
+110,0,115,101,120,116,105,108,108,105,111,110,0,115,104,111,114,116,115,101,
+120,116,105,108,108,105,111,110,0,115,101,112,116,105,108,108,105,111,110,0,
+115,104,111,114,116,115,101,112,116,105,108,108,105,111,110,0,111,99,116,105,
+108,108,105,111,110,0,115,104,111,114,116,111,99,116,105,108,108,105,111,110,
+0,110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,110,111,110,105,
+108,108,105,111,110,0,110,111,118,101,110,116,105,108,108,105,111,110,0,115,
+104,111,114,116,110,111,118,101,110,116,105,108,108,105,111,110,0,100,101,99,
+105,108,108,105,111,110,0,115,104,111,114,116,100,101,99,105,108,108,105,111,
+110,0,117,110,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,117,
+110,100,101,99,105,108,108,105,111,110,0,100,117,111,100,101,99,105,108,108,
+105,111,110,0,115,104,111,114,116,100,117,111,100,101,99,105,108,108,105,111,
+110,0,116,114,101,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,
+116,114,101,100,101,99,105,108,108,105,111,110,0,113,117,97,116,116,117,111,
+114,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,113,117,97,116,
+116,117,111,114,100,101,99,105,108,108,105,111,110,0,113,117,105,110,100,101,
+99,105,108,108,105,111,110,0,115,104,111,114,116,113,117,105,110,100,101,99,
+105,108,108,105,111,110,0,115,101,120,100,101,99,105,108,108,105,111,110,0,
+115,104,111,114,116,115,101,120,100,101,99,105,108,108,105,111,110,0,115,101,
+112,116,101,110,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,115,
+101,112,116,101,110,100,101,99,105,108,108,105,111,110,0,111,99,116,111,100,
+101,99,105,108,108,105,111,110,0,115,104,111,114,116,111,99,116,111,100,101,
+99,105,108,108,105,111,110,0,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,115,104,111,114,116,110,111,118,101,109,100,101,99,105,108,108,105,
+111,110,0,118,105,103,105,110,116,105,108,108,105,111,110,0,115,104,111,114,
+116,118,105,103,105,110,116,105,108,108,105,111,110,0,110,101,119,116,111,110,
+0,107,103,32,109,32,47,32,115,94,50,0,78,0,110,101,119,116,111,110,
+0,112,97,115,99,97,108,0,78,47,109,94,50,0,80,97,0,112,97,115,
+99,97,108,0,106,111,117,108,101,0,78,32,109,0,74,0,106,111,117,108,
+101,0,119,97,116,116,0,74,47,115,0,87,0,119,97,116,116,0,99,111,
+117,108,111,109,98,0,65,32,115,0,67,0,99,111,117,108,111,109,98,0,
+118,111,108,116,0,87,47,65,0,86,0,118,111,108,116,0,111,104,109,0,
+86,47,65,0,115,105,101,109,101,110,115,0,65,47,86,0,83,0,115,105,
+101,109,101,110,115,0,102,97,114,97,100,0,67,47,86,0,70,0,102,97,
+114,97,100,0,119,101,98,101,114,0,86,32,115,0,87,98,0,119,101,98,
+101,114,0,104,101,110,114,121,0,87,98,47,65,0,72,0,104,101,110,114,
+121,0,116,101,115,108,97,0,87,98,47,109,94,50,0,84,0,116,101,115,
+108,97,0,104,101,114,116,122,0,47,115,0,72,122,0,104,101,114,116,122,
+0,76,69,78,71,84,72,0,109,101,116,101,114,0,65,82,69,65,0,76,
+69,78,71,84,72,94,50,0,86,79,76,85,77,69,0,76,69,78,71,84,
+72,94,51,0,77,65,83,83,0,107,105,108,111,103,114,97,109,0,67,85,
+82,82,69,78,84,0,97,109,112,101,114,101,0,65,77,79,85,78,84,0,
+109,111,108,101,0,65,78,71,76,69,0,114,97,100,105,97,110,0,83,79,
+76,73,68,95,65,78,71,76,69,0,115,116,101,114,97,100,105,97,110,0,
+77,79,78,69,89,0,85,83,36,0,70,79,82,67,69,0,110,101,119,116,
+111,110,0,80,82,69,83,83,85,82,69,0,70,79,82,67,69,32,47,32,
+65,82,69,65,0,83,84,82,69,83,83,0,70,79,82,67,69,32,47,32,
+65,82,69,65,0,67,72,65,82,71,69,0,99,111,117,108,111,109,98,0,
+67,65,80,65,67,73,84,65,78,67,69,0,102,97,114,97,100,0,82,69,
+83,73,83,84,65,78,67,69,0,111,104,109,0,67,79,78,68,85,67,84,
+65,78,67,69,0,115,105,101,109,101,110,115,0,73,78,68,85,67,84,65,
+78,67,69,0,104,101,110,114,121,0,70,82,69,81,85,69,78,67,89,0,
+104,101,114,116,122,0,86,69,76,79,67,73,84,89,0,76,69,78,71,84,
+72,32,47,32,84,73,77,69,0,65,67,67,69,76,69,82,65,84,73,79,
+78,0,86,69,76,79,67,73,84,89,32,47,32,84,73,77,69,0,68,69,
+78,83,73,84,89,0,77,65,83,83,32,47,32,86,79,76,85,77,69,0,
+76,73,78,69,65,82,95,68,69,78,83,73,84,89,0,77,65,83,83,32,
+47,32,76,69,78,71,84,72,0,86,73,83,67,79,83,73,84,89,0,70,
+79,82,67,69,32,84,73,77,69,32,47,32,65,82,69,65,0,75,73,78,
+69,77,65,84,73,67,95,86,73,83,67,79,83,73,84,89,0,86,73,83,
+67,79,83,73,84,89,32,47,32,68,69,78,83,73,84,89,0,103,114,97,
+109,0,109,105,108,108,105,107,103,0,103,109,0,103,114,97,109,0,103,0,
+103,114,97,109,0,116,111,110,110,101,0,49,48,48,48,32,107,103,0,116,
+0,116,111,110,110,101,0,109,101,116,114,105,99,116,111,110,0,116,111,110,
+110,101,0,115,116,104,101,110,101,0,116,111,110,110,101,32,109,32,47,32,
+115,94,50,0,102,117,110,97,108,0,115,116,104,101,110,101,0,112,105,101,
+122,101,0,115,116,104,101,110,101,32,47,32,109,94,50,0,113,117,105,110,
+116,97,108,0,49,48,48,32,107,103,0,98,97,114,0,49,101,53,32,80,
+97,0,118,97,99,0,109,105,108,108,105,98,97,114,0,109,105,99,114,111,
+110,0,109,105,99,114,111,109,101,116,101,114,0,98,105,99,114,111,110,0,
+112,105,99,111,109,101,116,101,114,0,99,99,0,99,109,94,51,0,97,114,
+101,0,49,48,48,32,109,94,50,0,108,105,116,101,114,0,49,48,48,48,
+32,99,99,0,111,108,100,108,105,116,101,114,0,49,46,48,48,48,48,50,
+56,32,100,109,94,51,0,108,0,108,105,116,101,114,0,76,0,108,105,116,
+101,114,0,109,104,111,0,115,105,101,109,101,110,115,0,103,97,108,118,97,
+116,0,97,109,112,101,114,101,0,97,110,103,115,116,114,111,109,0,49,101,
+45,49,48,32,109,0,120,117,110,105,116,0,49,46,48,48,50,48,50,101,
+45,49,51,32,109,101,116,101,114,0,115,105,101,103,98,97,104,110,0,120,
+117,110,105,116,0,102,101,114,109,105,0,49,101,45,49,53,32,109,0,98,
+97,114,110,0,49,101,45,50,56,32,109,94,50,0,115,104,101,100,0,49,
+101,45,50,52,32,98,97,114,110,0,98,114,101,119,115,116,101,114,0,109,
+105,99,114,111,110,94,50,47,78,0,100,105,111,112,116,101,114,0,47,109,
+0,102,114,101,115,110,101,108,0,49,101,49,50,32,72,122,0,115,104,97,
+107,101,0,49,101,45,56,32,115,101,99,0,115,118,101,100,98,101,114,103,
+0,49,101,45,49,51,32,115,0,103,97,109,109,97,0,109,105,99,114,111,
+103,114,97,109,0,108,97,109,98,100,97,0,109,105,99,114,111,108,105,116,
+101,114,0,115,112,97,116,0,49,101,49,50,32,109,0,112,114,101,101,99,
+101,0,49,101,49,51,32,111,104,109,32,109,0,112,108,97,110,99,107,0,
+74,32,115,0,115,116,117,114,103,101,111,110,0,47,104,101,110,114,121,0,
+100,97,114,97,102,0,49,47,102,97,114,97,100,0,108,101,111,0,49,48,
+32,109,47,115,94,50,0,112,111,105,115,101,117,105,108,108,101,0,78,32,
+115,32,47,32,109,94,50,0,109,97,121,101,114,0,74,47,103,32,75,0,
+109,105,114,101,100,0,47,32,109,105,99,114,111,75,0,99,114,111,99,111,
+100,105,108,101,0,109,101,103,97,118,111,108,116,0,109,101,116,114,105,99,
+111,117,110,99,101,0,50,53,32,103,0,109,111,117,110,99,101,0,109,101,
+116,114,105,99,111,117,110,99,101,0,102,105,110,115,101,110,117,110,105,116,
+0,49,101,53,32,87,47,109,94,50,0,102,108,117,120,117,110,105,116,0,
+49,101,45,50,54,32,87,47,109,94,50,32,72,122,0,106,97,110,115,107,
+121,0,102,108,117,120,117,110,105,116,0,74,121,0,106,97,110,115,107,121,
+0,112,102,117,0,47,32,99,109,94,50,32,115,114,32,115,0,112,121,114,
+111,110,0,99,97,108,95,73,84,32,47,32,99,109,94,50,32,109,105,110,
+0,107,97,116,97,108,0,109,111,108,47,115,101,99,0,107,97,116,0,107,
+97,116,97,108,0,115,101,99,0,115,0,109,105,110,117,116,101,0,54,48,
+32,115,0,109,105,110,0,109,105,110,117,116,101,0,104,111,117,114,0,54,
+48,32,109,105,110,0,104,114,0,104,111,117,114,0,100,97,121,0,50,52,
+32,104,114,0,100,0,100,97,121,0,100,97,0,100,97,121,0,119,101,101,
+107,0,55,32,100,97,121,0,119,107,0,119,101,101,107,0,115,101,110,110,
+105,103,104,116,0,55,32,100,97,121,0,102,111,114,116,110,105,103,104,116,
+0,49,52,32,100,97,121,0,98,108,105,110,107,0,49,101,45,53,32,100,
+97,121,0,99,101,0,49,101,45,50,32,100,97,121,0,99,114,111,110,0,
+49,101,54,32,121,101,97,114,115,0,119,97,116,99,104,0,52,32,104,111,
+117,114,115,0,98,101,108,108,0,49,124,56,32,119,97,116,99,104,0,99,
+105,114,99,108,101,0,50,32,112,105,32,114,97,100,105,97,110,0,100,101,
+103,114,101,101,0,49,124,51,54,48,32,99,105,114,99,108,101,0,100,101,
+103,0,100,101,103,114,101,101,0,97,114,99,100,101,103,0,100,101,103,114,
+101,101,0,97,114,99,109,105,110,0,49,124,54,48,32,100,101,103,114,101,
+101,0,97,114,99,109,105,110,117,116,101,0,97,114,99,109,105,110,0,39,
+0,97,114,99,109,105,110,0,97,114,99,115,101,99,0,49,124,54,48,32,
+97,114,99,109,105,110,0,97,114,99,115,101,99,111,110,100,0,97,114,99,
+115,101,99,0,34,0,97,114,99,115,101,99,0,39,39,0,34,0,114,105,
+103,104,116,97,110,103,108,101,0,57,48,32,100,101,103,114,101,101,115,0,
+113,117,97,100,114,97,110,116,0,49,124,52,32,99,105,114,99,108,101,0,
+113,117,105,110,116,97,110,116,0,49,124,53,32,99,105,114,99,108,101,0,
+115,101,120,116,97,110,116,0,49,124,54,32,99,105,114,99,108,101,0,115,
+105,103,110,0,49,124,49,50,32,99,105,114,99,108,101,0,116,117,114,110,
+0,99,105,114,99,108,101,0,114,101,118,111,108,117,116,105,111,110,0,116,
+117,114,110,0,114,101,118,0,116,117,114,110,0,112,117,108,115,97,116,97,
+110,99,101,0,114,97,100,105,97,110,32,47,32,115,101,99,0,103,111,110,
+0,49,124,49,48,48,32,114,105,103,104,116,97,110,103,108,101,0,103,114,
+97,100,101,0,103,111,110,0,99,101,110,116,101,115,105,109,97,108,109,105,
+110,117,116,101,0,49,124,49,48,48,32,103,114,97,100,101,0,99,101,110,
+116,101,115,105,109,97,108,115,101,99,111,110,100,0,49,124,49,48,48,32,
+99,101,110,116,101,115,105,109,97,108,109,105,110,117,116,101,0,109,105,108,
+97,110,103,108,101,0,49,124,54,52,48,48,32,99,105,114,99,108,101,0,
+112,111,105,110,116,97,110,103,108,101,0,49,124,51,50,32,99,105,114,99,
+108,101,0,99,101,110,116,114,97,100,0,48,46,48,49,32,114,97,100,105,
+97,110,0,109,97,115,0,109,105,108,108,105,32,97,114,99,115,101,99,0,
+115,101,99,108,111,110,103,105,116,117,100,101,0,99,105,114,99,108,101,32,
+40,115,101,99,111,110,100,115,47,100,97,121,41,0,115,112,104,101,114,101,
+0,52,32,112,105,32,115,114,0,115,113,117,97,114,101,100,101,103,114,101,
+101,0,49,124,49,56,48,94,50,32,112,105,94,50,32,115,114,0,115,113,
+117,97,114,101,109,105,110,117,116,101,0,49,124,54,48,94,50,32,115,113,
+117,97,114,101,100,101,103,114,101,101,0,115,113,117,97,114,101,115,101,99,
+111,110,100,0,49,124,54,48,94,50,32,115,113,117,97,114,101,109,105,110,
+117,116,101,0,115,113,117,97,114,101,97,114,99,109,105,110,0,115,113,117,
+97,114,101,109,105,110,117,116,101,0,115,113,117,97,114,101,97,114,99,115,
+101,99,0,115,113,117,97,114,101,115,101,99,111,110,100,0,115,112,104,101,
+114,105,99,97,108,114,105,103,104,116,97,110,103,108,101,0,48,46,53,32,
+112,105,32,115,114,0,111,99,116,97,110,116,0,48,46,53,32,112,105,32,
+115,114,0,112,101,114,99,101,110,116,0,48,46,48,49,0,37,0,112,101,
+114,99,101,110,116,0,109,105,108,108,0,48,46,48,48,49,0,112,114,111,
+111,102,0,49,124,50,48,48,0,112,112,109,0,49,101,45,54,0,112,97,
+114,116,115,112,101,114,109,105,108,108,105,111,110,0,112,112,109,0,112,112,
+98,0,49,101,45,57,0,112,97,114,116,115,112,101,114,98,105,108,108,105,
+111,110,0,112,112,98,0,112,112,116,0,49,101,45,49,50,0,112,97,114,
+116,115,112,101,114,116,114,105,108,108,105,111,110,0,112,112,116,0,107,97,
+114,97,116,0,49,124,50,52,0,99,97,114,97,116,103,111,108,100,0,107,
+97,114,97,116,0,103,97,109,109,105,108,0,109,103,47,108,0,98,97,115,
+105,115,112,111,105,110,116,0,48,46,48,49,32,37,0,102,105,110,101,0,
+49,124,49,48,48,48,0,84,69,77,80,69,82,65,84,85,82,69,0,107,
+101,108,118,105,110,0,84,69,77,80,69,82,65,84,85,82,69,95,68,73,
+70,70,69,82,69,78,67,69,0,107,101,108,118,105,110,0,100,101,103,99,
+101,108,115,105,117,115,0,75,0,100,101,103,67,0,75,0,100,101,103,102,
+97,104,114,101,110,104,101,105,116,0,53,124,57,32,100,101,103,67,0,100,
+101,103,70,0,53,124,57,32,100,101,103,67,0,100,101,103,114,101,101,115,
+114,97,110,107,105,110,101,0,100,101,103,70,0,100,101,103,114,97,110,107,
+105,110,101,0,100,101,103,114,101,101,115,114,97,110,107,105,110,101,0,100,
+101,103,114,101,101,114,97,110,107,105,110,101,0,100,101,103,70,0,100,101,
+103,82,0,100,101,103,114,97,110,107,105,110,101,0,116,101,109,112,82,0,
+100,101,103,114,97,110,107,105,110,101,0,116,101,109,112,114,97,110,107,105,
+110,101,0,100,101,103,114,97,110,107,105,110,101,0,100,101,103,114,101,97,
+117,109,117,114,0,49,48,124,56,32,100,101,103,67,0,100,101,103,75,0,
+75,0,116,101,109,112,75,0,75,0,112,105,0,51,46,49,52,49,53,57,
+50,54,53,51,53,56,57,55,57,51,50,51,56,52,54,0,99,0,50,46,
+57,57,55,57,50,52,53,56,101,56,32,109,47,115,0,108,105,103,104,116,
+0,99,0,109,117,48,0,52,32,112,105,32,49,101,45,55,32,72,47,109,
+0,101,112,115,105,108,111,110,48,0,49,47,109,117,48,32,99,94,50,0,
+101,110,101,114,103,121,0,99,94,50,0,101,0,49,46,54,48,50,49,55,
+54,52,56,55,101,45,49,57,32,67,0,104,0,54,46,54,50,54,48,54,
+56,57,54,101,45,51,52,32,74,32,115,0,104,98,97,114,0,104,32,47,
+32,50,32,112,105,0,115,112,105,110,0,104,98,97,114,0,71,0,54,46,
+54,55,52,50,56,101,45,49,49,32,78,32,109,94,50,32,47,32,107,103,
+94,50,0,99,111,117,108,111,109,98,99,111,110,115,116,0,49,47,52,32,
+112,105,32,101,112,115,105,108,111,110,48,0,97,116,111,109,105,99,109,97,
+115,115,117,110,105,116,0,49,46,54,54,48,53,51,56,55,56,50,101,45,
+50,55,32,107,103,0,117,0,97,116,111,109,105,99,109,97,115,115,117,110,
+105,116,0,97,109,117,0,97,116,111,109,105,99,109,97,115,115,117,110,105,
+116,0,97,109,117,95,99,104,101,109,0,49,46,54,54,48,50,54,101,45,
+50,55,32,107,103,0,97,109,117,95,112,104,121,115,0,49,46,54,53,57,
+56,49,101,45,50,55,32,107,103,0,100,97,108,116,111,110,0,117,0,97,
+118,111,103,97,100,114,111,0,103,114,97,109,115,47,97,109,117,32,109,111,
+108,0,78,95,65,0,97,118,111,103,97,100,114,111,0,103,97,115,99,111,
+110,115,116,97,110,116,0,56,46,51,49,52,52,55,50,32,74,32,47,32,
+109,111,108,32,75,0,82,0,103,97,115,99,111,110,115,116,97,110,116,0,
+98,111,108,116,122,109,97,110,110,0,82,32,47,32,78,95,65,0,107,0,
+98,111,108,116,122,109,97,110,110,0,107,98,111,108,116,122,109,97,110,110,
+0,98,111,108,116,122,109,97,110,110,0,109,111,108,97,114,118,111,108,117,
+109,101,0,109,111,108,32,82,32,115,116,100,116,101,109,112,32,47,32,97,
+116,109,0,108,111,115,99,104,109,105,100,116,0,97,118,111,103,97,100,114,
+111,32,109,111,108,32,47,32,109,111,108,97,114,118,111,108,117,109,101,0,
+115,116,101,102,97,110,98,111,108,116,122,109,97,110,110,0,112,105,94,50,
+32,107,94,52,32,47,32,54,48,32,104,98,97,114,94,51,32,99,94,50,
+0,115,105,103,109,97,0,115,116,101,102,97,110,98,111,108,116,122,109,97,
+110,110,0,119,105,101,110,100,105,115,112,108,97,99,101,109,101,110,116,0,
+50,46,56,57,55,55,54,56,53,101,45,51,32,109,32,75,0,75,95,74,
+0,52,56,51,53,57,55,46,57,32,71,72,122,47,86,0,82,95,75,0,
+50,53,56,49,50,46,56,48,55,32,111,104,109,0,103,114,97,118,105,116,
+121,0,57,46,56,48,54,54,53,32,109,47,115,94,50,0,102,111,114,99,
+101,0,103,114,97,118,105,116,121,0,97,116,109,0,49,48,49,51,50,53,
+32,80,97,0,97,116,109,111,115,112,104,101,114,101,0,97,116,109,0,72,
+103,0,49,51,46,53,57,53,49,32,103,114,97,109,32,102,111,114,99,101,
+32,47,32,99,109,94,51,0,119,97,116,101,114,0,103,114,97,109,32,102,
+111,114,99,101,47,99,109,94,51,0,119,97,116,101,114,100,101,110,115,105,
+116,121,0,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,0,119,
+97,116,101,114,0,119,99,0,119,97,116,101,114,0,109,97,99,104,0,51,
+51,49,46,52,54,32,109,47,115,0,115,116,97,110,100,97,114,100,116,101,
+109,112,0,50,55,51,46,49,53,32,75,0,115,116,100,116,101,109,112,0,
+115,116,97,110,100,97,114,100,116,101,109,112,0,72,103,49,48,67,0,49,
+51,46,53,55,48,56,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,103,50,48,67,0,49,51,46,53,52,54,50,32,102,
+111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,50,
+51,67,0,49,51,46,53,51,56,54,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,103,51,48,67,0,49,51,46,53,50,
+49,55,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,103,52,48,67,0,49,51,46,52,57,55,51,32,102,111,114,99,101,
+32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,54,48,70,0,49,
+51,46,53,53,55,52,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,50,79,48,67,0,48,46,57,57,57,56,55,32,102,
+111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,
+53,67,0,48,46,57,57,57,57,57,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,50,79,49,48,67,0,48,46,57,57,
+57,55,51,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,
+51,0,72,50,79,49,53,67,0,48,46,57,57,57,49,51,32,102,111,114,
+99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,49,56,
+67,0,48,46,57,57,56,54,50,32,102,111,114,99,101,32,103,114,97,109,
+32,47,32,99,109,94,51,0,72,50,79,50,48,67,0,48,46,57,57,56,
+50,51,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,50,79,50,53,67,0,48,46,57,57,55,48,55,32,102,111,114,99,
+101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,53,48,67,
+0,48,46,57,56,56,48,55,32,102,111,114,99,101,32,103,114,97,109,32,
+47,32,99,109,94,51,0,72,50,79,49,48,48,67,0,48,46,57,53,56,
+51,56,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,82,105,110,102,105,110,105,116,121,0,49,48,57,55,51,55,51,49,46,
+53,54,56,53,50,55,32,47,109,0,82,95,72,0,49,48,57,54,55,55,
+54,48,32,47,109,0,97,108,112,104,97,0,55,46,50,57,55,51,53,50,
+53,51,55,54,101,45,51,0,98,111,104,114,114,97,100,105,117,115,0,97,
+108,112,104,97,32,47,32,52,32,112,105,32,82,105,110,102,105,110,105,116,
+121,0,112,114,111,117,116,0,49,56,53,46,53,32,107,101,86,0,112,108,
+97,110,99,107,109,97,115,115,0,50,46,49,55,54,52,52,101,45,56,32,
+107,103,0,109,95,80,0,112,108,97,110,99,107,109,97,115,115,0,112,108,
+97,110,99,107,116,105,109,101,0,104,98,97,114,32,47,32,112,108,97,110,
+99,107,109,97,115,115,32,99,94,50,0,116,95,80,0,112,108,97,110,99,
+107,116,105,109,101,0,112,108,97,110,99,107,108,101,110,103,116,104,0,112,
+108,97,110,99,107,116,105,109,101,32,99,0,108,95,80,0,112,108,97,110,
+99,107,108,101,110,103,116,104,0,101,108,101,99,116,114,111,110,109,97,115,
+115,0,53,46,52,56,53,55,57,57,48,57,52,51,101,45,52,32,117,0,
+109,95,101,0,101,108,101,99,116,114,111,110,109,97,115,115,0,112,114,111,
+116,111,110,109,97,115,115,0,49,46,48,48,55,50,55,54,52,54,54,55,
+55,32,117,0,109,95,112,0,112,114,111,116,111,110,109,97,115,115,0,110,
+101,117,116,114,111,110,109,97,115,115,0,49,46,48,48,56,54,54,52,57,
+49,53,57,55,32,117,0,109,95,110,0,110,101,117,116,114,111,110,109,97,
+115,115,0,109,117,111,110,109,97,115,115,0,48,46,49,49,51,52,50,56,
+57,50,53,54,32,117,0,109,95,109,117,0,109,117,111,110,109,97,115,115,
+0,100,101,117,116,101,114,111,110,109,97,115,115,0,50,46,48,49,51,53,
+53,51,50,49,50,55,50,52,32,117,0,109,95,100,0,100,101,117,116,101,
+114,111,110,109,97,115,115,0,97,108,112,104,97,112,97,114,116,105,99,108,
+101,109,97,115,115,0,52,46,48,48,49,53,48,54,49,55,57,49,50,55,
+32,117,0,109,95,97,108,112,104,97,0,97,108,112,104,97,112,97,114,116,
+105,99,108,101,109,97,115,115,0,101,108,101,99,116,114,111,110,119,97,118,
+101,108,101,110,103,116,104,0,104,32,47,32,109,95,101,32,99,0,108,97,
+109,98,100,97,95,67,0,101,108,101,99,116,114,111,110,119,97,118,101,108,
+101,110,103,116,104,0,112,114,111,116,111,110,119,97,118,101,108,101,110,103,
+116,104,0,104,32,47,32,109,95,112,32,99,0,108,97,109,98,100,97,95,
+67,44,112,0,112,114,111,116,111,110,119,97,118,101,108,101,110,103,116,104,
+0,110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,116,104,0,104,
+32,47,32,109,95,110,32,99,0,108,97,109,98,100,97,95,67,44,110,0,
+110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,116,104,0,98,111,
+104,114,109,97,103,110,101,116,111,110,0,101,32,104,98,97,114,32,47,32,
+50,32,101,108,101,99,116,114,111,110,109,97,115,115,0,109,117,95,66,0,
+98,111,104,114,109,97,103,110,101,116,111,110,0,110,117,99,108,101,97,114,
+109,97,103,110,101,116,111,110,0,101,32,104,98,97,114,32,47,32,32,50,
+32,112,114,111,116,111,110,109,97,115,115,0,109,117,95,78,0,110,117,99,
+108,101,97,114,109,97,103,110,101,116,111,110,0,109,117,95,109,117,0,52,
+46,52,57,48,52,52,55,56,54,101,45,50,54,32,74,47,84,0,109,117,
+95,112,0,49,46,52,49,48,54,48,54,54,54,50,101,45,50,54,32,74,
+47,84,0,109,117,95,101,0,57,50,56,46,52,55,54,51,55,55,101,45,
+50,54,32,74,47,84,0,109,117,95,110,0,48,46,57,54,54,50,51,54,
+52,49,101,45,50,54,32,74,47,84,0,109,117,95,100,0,48,46,52,51,
+51,48,55,51,52,54,53,101,45,50,54,32,74,47,84,0,107,103,102,0,
+107,103,32,102,111,114,99,101,0,116,101,99,104,110,105,99,97,108,97,116,
+109,111,115,112,104,101,114,101,0,107,103,102,32,47,32,99,109,94,50,0,
+97,116,0,116,101,99,104,110,105,99,97,108,97,116,109,111,115,112,104,101,
+114,101,0,104,121,108,0,107,103,102,32,115,94,50,32,47,32,109,0,109,
+109,72,103,0,109,109,32,72,103,0,116,111,114,114,0,109,109,72,103,0,
+116,111,114,0,80,97,0,105,110,72,103,0,105,110,99,104,32,72,103,0,
+105,110,72,50,79,0,105,110,99,104,32,119,97,116,101,114,0,109,109,72,
+50,79,0,109,109,32,119,97,116,101,114,0,101,86,0,101,32,86,0,101,
+108,101,99,116,114,111,110,118,111,108,116,0,101,86,0,108,105,103,104,116,
+121,101,97,114,0,99,32,106,117,108,105,97,110,121,101,97,114,0,108,121,
+0,108,105,103,104,116,121,101,97,114,0,108,105,103,104,116,115,101,99,111,
+110,100,0,99,32,115,0,108,105,103,104,116,109,105,110,117,116,101,0,99,
+32,109,105,110,0,112,97,114,115,101,99,0,97,117,32,47,32,116,97,110,
+40,97,114,99,115,101,99,41,0,112,99,0,112,97,114,115,101,99,0,114,
+121,100,98,101,114,103,0,104,32,99,32,82,105,110,102,105,110,105,116,121,
+0,99,114,105,116,104,0,48,46,48,56,57,56,56,53,32,103,114,97,109,
+0,97,109,97,103,97,116,118,111,108,117,109,101,0,109,111,108,97,114,118,
+111,108,117,109,101,0,97,109,97,103,97,116,0,109,111,108,47,97,109,97,
+103,97,116,118,111,108,117,109,101,0,108,111,114,101,110,116,122,0,98,111,
+104,114,109,97,103,110,101,116,111,110,32,47,32,104,32,99,0,99,109,105,
+110,118,0,104,32,99,32,47,32,99,109,0,105,110,118,99,109,0,99,109,
+105,110,118,0,119,97,118,101,110,117,109,98,101,114,0,99,109,105,110,118,
+0,107,99,97,108,95,109,111,108,0,107,99,97,108,95,116,104,32,47,32,
+109,111,108,32,78,95,65,0,100,121,110,101,0,99,109,32,103,114,97,109,
+32,47,32,115,94,50,0,100,121,110,0,100,121,110,101,0,101,114,103,0,
+99,109,32,100,121,110,101,0,112,111,105,115,101,0,103,114,97,109,32,47,
+32,99,109,32,115,0,80,0,112,111,105,115,101,0,114,104,101,0,47,112,
+111,105,115,101,0,115,116,111,107,101,115,0,99,109,94,50,32,47,32,115,
+0,83,116,0,115,116,111,107,101,115,0,115,116,111,107,101,0,115,116,111,
+107,101,115,0,108,101,110,116,111,114,0,115,116,111,107,101,115,0,71,97,
+108,0,99,109,32,47,32,115,94,50,0,103,97,108,105,108,101,111,0,71,
+97,108,0,98,97,114,121,101,0,100,121,110,101,47,99,109,94,50,0,98,
+97,114,97,100,0,98,97,114,121,101,0,107,97,121,115,101,114,0,49,47,
+99,109,0,98,97,108,109,101,114,0,107,97,121,115,101,114,0,107,105,110,
+101,0,99,109,47,115,0,98,111,108,101,0,103,32,99,109,32,47,32,115,
+0,112,111,110,100,0,103,114,97,109,32,102,111,114,99,101,0,103,108,117,
+103,0,103,114,97,109,32,102,111,114,99,101,32,115,94,50,32,47,32,99,
+109,0,100,97,114,99,121,0,99,101,110,116,105,112,111,105,115,101,32,99,
+109,94,50,32,47,32,115,32,97,116,109,0,109,111,104,109,0,99,109,32,
+47,32,100,121,110,32,115,0,109,111,98,105,108,101,111,104,109,0,109,111,
+104,109,0,109,101,99,104,97,110,105,99,97,108,111,104,109,0,100,121,110,
+32,115,32,47,32,99,109,0,97,99,111,117,115,116,105,99,97,108,111,104,
+109,0,100,121,110,32,115,32,47,32,99,109,94,53,0,114,97,121,0,97,
+99,111,117,115,116,105,99,97,108,111,104,109,0,114,97,121,108,0,100,121,
+110,32,115,32,47,32,99,109,94,51,0,101,111,116,118,111,115,0,49,101,
+45,57,32,71,97,108,47,99,109,0,97,98,97,109,112,101,114,101,0,49,
+48,32,65,0,97,98,97,109,112,0,97,98,97,109,112,101,114,101,0,97,
+65,0,97,98,97,109,112,101,114,101,0,98,105,111,116,0,97,65,0,66,
+105,0,98,105,111,116,0,97,98,99,111,117,108,111,109,98,0,97,98,97,
+109,112,32,115,101,99,0,97,98,99,111,117,108,0,97,98,99,111,117,108,
+111,109,98,0,97,98,102,97,114,97,100,0,97,98,97,109,112,101,114,101,
+32,115,101,99,32,47,32,97,98,118,111,108,116,0,97,98,104,101,110,114,
+121,0,97,98,118,111,108,116,32,115,101,99,32,47,32,97,98,97,109,112,
+0,97,98,118,111,108,116,0,100,121,110,101,32,99,109,32,32,47,32,97,
+98,97,109,112,32,115,101,99,0,97,98,111,104,109,0,97,98,118,111,108,
+116,32,47,32,97,98,97,109,112,0,97,98,109,104,111,0,47,97,98,111,
+104,109,0,103,97,117,115,115,0,97,98,118,111,108,116,32,115,101,99,32,
+47,32,99,109,94,50,0,71,115,0,103,97,117,115,115,0,109,97,120,119,
+101,108,108,0,97,98,118,111,108,116,32,115,101,99,0,77,120,0,109,97,
+120,119,101,108,108,0,111,101,114,115,116,101,100,0,103,97,117,115,115,32,
+47,32,109,117,48,0,79,101,0,111,101,114,115,116,101,100,0,103,105,108,
+98,101,114,116,0,103,97,117,115,115,32,99,109,32,47,32,109,117,48,0,
+71,98,0,103,105,108,98,101,114,116,0,71,105,0,103,105,108,98,101,114,
+116,0,117,110,105,116,112,111,108,101,0,52,32,112,105,32,109,97,120,119,
+101,108,108,0,101,109,117,0,101,114,103,47,103,97,117,115,115,0,115,116,
+97,116,97,109,112,101,114,101,0,49,48,32,65,32,99,109,32,47,32,115,
+32,99,0,115,116,97,116,97,109,112,0,115,116,97,116,97,109,112,101,114,
+101,0,115,116,97,116,118,111,108,116,0,100,121,110,101,32,99,109,32,47,
+32,115,116,97,116,97,109,112,32,115,101,99,0,115,116,97,116,99,111,117,
+108,111,109,98,0,115,116,97,116,97,109,112,32,115,0,101,115,117,0,115,
+116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,99,111,117,108,0,
+115,116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,102,97,114,97,
+100,0,115,116,97,116,97,109,112,32,115,101,99,32,47,32,115,116,97,116,
+118,111,108,116,0,99,109,99,97,112,97,99,105,116,97,110,99,101,0,115,
+116,97,116,102,97,114,97,100,0,115,116,97,116,104,101,110,114,121,0,115,
+116,97,116,118,111,108,116,32,115,101,99,32,47,32,115,116,97,116,97,109,
+112,0,115,116,97,116,111,104,109,0,115,116,97,116,118,111,108,116,32,47,
+32,115,116,97,116,97,109,112,0,115,116,97,116,109,104,111,0,47,115,116,
+97,116,111,104,109,0,115,116,97,116,109,97,120,119,101,108,108,0,115,116,
+97,116,118,111,108,116,32,115,101,99,0,102,114,97,110,107,108,105,110,0,
+115,116,97,116,99,111,117,108,111,109,98,0,100,101,98,121,101,0,49,101,
+45,49,56,32,115,116,97,116,99,111,117,108,32,99,109,0,104,101,108,109,
+104,111,108,116,122,0,100,101,98,121,101,47,97,110,103,115,116,114,111,109,
+94,50,0,106,97,114,0,49,48,48,48,32,115,116,97,116,102,97,114,97,
+100,0,105,110,116,97,109,112,101,114,101,0,48,46,57,57,57,56,51,53,
+32,65,0,105,110,116,97,109,112,0,105,110,116,97,109,112,101,114,101,0,
+105,110,116,102,97,114,97,100,0,48,46,57,57,57,53,48,53,32,70,0,
+105,110,116,118,111,108,116,0,49,46,48,48,48,51,51,32,86,0,105,110,
+116,111,104,109,0,49,46,48,48,48,52,57,53,32,111,104,109,0,100,97,
+110,105,101,108,108,0,49,46,48,52,50,32,86,0,102,97,114,97,100,97,
+121,0,78,95,65,32,101,32,109,111,108,0,102,97,114,97,100,97,121,95,
+112,104,121,115,0,57,54,53,50,49,46,57,32,67,0,102,97,114,97,100,
+97,121,95,99,104,101,109,0,57,54,52,57,53,46,55,32,67,0,107,97,
+112,112,108,105,110,101,0,54,48,48,48,32,109,97,120,119,101,108,108,0,
+115,105,101,109,101,110,115,117,110,105,116,0,48,46,57,53,51,52,32,111,
+104,109,0,76,85,77,73,78,79,85,83,95,73,78,84,69,78,83,73,84,
+89,0,99,97,110,100,101,108,97,0,76,85,77,73,78,79,85,83,95,70,
+76,85,88,0,108,117,109,101,110,0,76,85,77,73,78,79,85,83,95,69,
+78,69,82,71,89,0,116,97,108,98,111,116,0,73,76,76,85,77,73,78,
+65,78,67,69,0,108,117,120,0,69,88,73,84,65,78,67,69,0,108,117,
+120,0,99,97,110,100,108,101,0,49,46,48,50,32,99,97,110,100,101,108,
+97,0,104,101,102,110,101,114,117,110,105,116,0,48,46,57,32,99,97,110,
+100,108,101,0,104,101,102,110,101,114,99,97,110,100,108,101,0,104,101,102,
+110,101,114,117,110,105,116,0,118,105,111,108,108,101,0,50,48,46,49,55,
+32,99,100,0,108,117,109,101,110,0,99,100,32,115,114,0,108,109,0,108,
+117,109,101,110,0,116,97,108,98,111,116,0,108,117,109,101,110,32,115,0,
+108,117,109,98,101,114,103,0,116,97,108,98,111,116,0,108,117,109,101,114,
+103,0,116,97,108,98,111,116,0,108,117,120,0,108,109,47,109,94,50,0,
+108,120,0,108,117,120,0,112,104,111,116,0,108,117,109,101,110,32,47,32,
+99,109,94,50,0,112,104,0,112,104,111,116,0,102,111,111,116,99,97,110,
+100,108,101,0,108,117,109,101,110,47,102,116,94,50,0,109,101,116,101,114,
+99,97,110,100,108,101,0,108,117,109,101,110,47,109,94,50,0,109,99,115,
+0,109,101,116,101,114,99,97,110,100,108,101,32,115,0,110,111,120,0,49,
+101,45,51,32,108,117,120,0,115,107,111,116,0,49,101,45,51,32,97,112,
+111,115,116,105,108,98,0,76,85,77,73,78,65,78,67,69,0,110,105,116,
+0,110,105,116,0,99,100,47,109,94,50,0,115,116,105,108,98,0,99,100,
+32,47,32,99,109,94,50,0,115,98,0,115,116,105,108,98,0,97,112,111,
+115,116,105,108,98,0,99,100,47,112,105,32,109,94,50,0,97,115,98,0,
+97,112,111,115,116,105,108,98,0,98,108,111,110,100,101,108,0,97,112,111,
+115,116,105,108,98,0,101,113,117,105,118,97,108,101,110,116,108,117,120,0,
+99,100,32,47,32,112,105,32,109,94,50,0,101,113,117,105,118,97,108,101,
+110,116,112,104,111,116,0,99,100,32,47,32,112,105,32,99,109,94,50,0,
+108,97,109,98,101,114,116,0,99,100,32,47,32,112,105,32,99,109,94,50,
+0,102,111,111,116,108,97,109,98,101,114,116,0,99,100,32,47,32,112,105,
+32,102,116,94,50,0,115,117,110,108,117,109,0,49,46,54,101,57,32,99,
+100,47,109,94,50,0,115,117,110,105,108,108,117,109,0,49,48,48,101,51,
+32,108,117,120,0,115,117,110,105,108,108,117,109,95,111,0,49,48,101,51,
+32,108,117,120,0,115,117,110,108,117,109,95,104,0,54,101,54,32,99,100,
+47,109,94,50,0,115,107,121,108,117,109,0,56,48,48,48,32,99,100,47,
+109,94,50,0,115,107,121,108,117,109,95,111,0,50,48,48,48,32,99,100,
+47,109,94,50,0,109,111,111,110,108,117,109,0,50,53,48,48,32,99,100,
+47,109,94,50,0,115,49,48,48,0,54,52,32,42,32,50,94,40,50,124,
+51,41,32,47,32,108,120,32,115,0,107,49,50,53,48,0,49,50,46,53,
+32,40,99,100,47,109,50,41,32,47,32,108,120,32,115,0,107,49,52,48,
+48,0,49,52,32,32,32,40,99,100,47,109,50,41,32,47,32,108,120,32,
+115,0,99,50,53,48,0,50,53,48,32,108,120,32,47,32,108,120,32,115,
+0,84,73,77,69,0,115,101,99,111,110,100,0,97,110,111,109,97,108,105,
+115,116,105,99,121,101,97,114,0,51,54,53,46,50,53,57,54,32,100,97,
+121,115,0,115,105,100,101,114,101,97,108,121,101,97,114,0,51,54,53,46,
+50,53,54,51,54,48,52,49,55,32,100,97,121,0,116,114,111,112,105,99,
+97,108,121,101,97,114,0,51,54,53,46,50,52,50,49,57,56,55,56,49,
+32,100,97,121,0,101,99,108,105,112,115,101,121,101,97,114,0,51,52,54,
+46,54,50,32,100,97,121,115,0,115,97,114,111,115,0,50,50,51,32,115,
+121,110,111,100,105,99,109,111,110,116,104,0,115,105,100,101,114,101,97,108,
+100,97,121,0,56,54,49,54,52,46,48,57,48,53,52,32,115,0,115,105,
+100,101,114,101,97,108,104,111,117,114,0,49,124,50,52,32,115,105,100,101,
+114,101,97,108,100,97,121,0,115,105,100,101,114,101,97,108,109,105,110,117,
+116,101,0,49,124,54,48,32,115,105,100,101,114,101,97,108,104,111,117,114,
+0,115,105,100,101,114,101,97,108,115,101,99,111,110,100,0,49,124,54,48,
+32,115,105,100,101,114,101,97,108,109,105,110,117,116,101,0,97,110,111,109,
+97,108,105,115,116,105,99,109,111,110,116,104,0,50,55,46,53,53,52,53,
+52,57,55,55,32,100,97,121,0,110,111,100,105,99,97,108,109,111,110,116,
+104,0,50,55,46,50,49,50,50,49,57,57,32,100,97,121,0,100,114,97,
+99,111,110,105,99,109,111,110,116,104,0,110,111,100,105,99,97,108,109,111,
+110,116,104,0,100,114,97,99,111,110,105,116,105,99,109,111,110,116,104,0,
+110,111,100,105,99,97,108,109,111,110,116,104,0,115,105,100,101,114,101,97,
+108,109,111,110,116,104,0,50,55,46,51,50,49,54,54,49,32,100,97,121,
+0,108,117,110,97,114,109,111,110,116,104,0,50,57,32,100,97,121,115,32,
+43,32,49,50,32,104,111,117,114,115,32,43,32,52,52,32,109,105,110,117,
+116,101,115,32,43,32,50,46,56,32,115,101,99,111,110,100,115,0,115,121,
+110,111,100,105,99,109,111,110,116,104,0,108,117,110,97,114,109,111,110,116,
+104,0,108,117,110,97,116,105,111,110,0,115,121,110,111,100,105,99,109,111,
+110,116,104,0,108,117,110,101,0,49,124,51,48,32,108,117,110,97,116,105,
+111,110,0,108,117,110,111,117,114,0,49,124,50,52,32,108,117,110,101,0,
+121,101,97,114,0,116,114,111,112,105,99,97,108,121,101,97,114,0,121,114,
+0,121,101,97,114,0,109,111,110,116,104,0,49,124,49,50,32,121,101,97,
+114,0,109,111,0,109,111,110,116,104,0,108,117,115,116,114,117,109,0,53,
+32,121,101,97,114,115,0,100,101,99,97,100,101,0,49,48,32,121,101,97,
+114,115,0,99,101,110,116,117,114,121,0,49,48,48,32,121,101,97,114,115,
+0,109,105,108,108,101,110,110,105,117,109,0,49,48,48,48,32,121,101,97,
+114,115,0,109,105,108,108,101,110,110,105,97,0,109,105,108,108,101,110,110,
+105,117,109,0,115,111,108,97,114,121,101,97,114,0,121,101,97,114,0,108,
+117,110,97,114,121,101,97,114,0,49,50,32,108,117,110,97,114,109,111,110,
+116,104,0,99,97,108,101,110,100,97,114,121,101,97,114,0,51,54,53,32,
+100,97,121,0,99,111,109,109,111,110,121,101,97,114,0,51,54,53,32,100,
+97,121,0,108,101,97,112,121,101,97,114,0,51,54,54,32,100,97,121,0,
+106,117,108,105,97,110,121,101,97,114,0,51,54,53,46,50,53,32,100,97,
+121,0,103,114,101,103,111,114,105,97,110,121,101,97,114,0,51,54,53,46,
+50,52,50,53,32,100,97,121,0,105,115,108,97,109,105,99,121,101,97,114,
+0,51,53,52,32,100,97,121,0,105,115,108,97,109,105,99,108,101,97,112,
+121,101,97,114,0,51,53,53,32,100,97,121,0,105,115,108,97,109,105,99,
+109,111,110,116,104,0,49,124,49,50,32,105,115,108,97,109,105,99,121,101,
+97,114,0,109,101,114,99,117,114,121,100,97,121,0,53,56,46,54,52,54,
+50,32,100,97,121,0,118,101,110,117,115,100,97,121,0,50,52,51,46,48,
+49,32,100,97,121,0,101,97,114,116,104,100,97,121,0,115,105,100,101,114,
+101,97,108,100,97,121,0,109,97,114,115,100,97,121,0,49,46,48,50,53,
+57,53,54,55,53,32,100,97,121,0,106,117,112,105,116,101,114,100,97,121,
+0,48,46,52,49,51,53,52,32,100,97,121,0,115,97,116,117,114,110,100,
+97,121,0,48,46,52,51,55,53,32,100,97,121,0,117,114,97,110,117,115,
+100,97,121,0,48,46,54,53,32,100,97,121,0,110,101,112,116,117,110,101,
+100,97,121,0,48,46,55,54,56,32,100,97,121,0,112,108,117,116,111,100,
+97,121,0,54,46,51,56,54,55,32,100,97,121,0,109,101,114,99,117,114,
+121,121,101,97,114,0,48,46,50,52,48,56,52,54,55,32,106,117,108,105,
+97,110,121,101,97,114,0,118,101,110,117,115,121,101,97,114,0,48,46,54,
+49,53,49,57,55,50,54,32,106,117,108,105,97,110,121,101,97,114,0,101,
+97,114,116,104,121,101,97,114,0,115,105,100,101,114,101,97,108,121,101,97,
+114,0,109,97,114,115,121,101,97,114,0,49,46,56,56,48,56,52,55,54,
+32,106,117,108,105,97,110,121,101,97,114,0,106,117,112,105,116,101,114,121,
+101,97,114,0,49,49,46,56,54,50,54,49,53,32,106,117,108,105,97,110,
+121,101,97,114,0,115,97,116,117,114,110,121,101,97,114,0,50,57,46,52,
+52,55,52,57,56,32,106,117,108,105,97,110,121,101,97,114,0,117,114,97,
+110,117,115,121,101,97,114,0,56,52,46,48,49,54,56,52,54,32,106,117,
+108,105,97,110,121,101,97,114,0,110,101,112,116,117,110,101,121,101,97,114,
+0,49,54,52,46,55,57,49,51,50,32,106,117,108,105,97,110,121,101,97,
+114,0,112,108,117,116,111,121,101,97,114,0,50,52,55,46,57,50,48,54,
+53,32,106,117,108,105,97,110,121,101,97,114,0,101,97,114,116,104,102,108,
+97,116,116,101,110,105,110,103,0,49,124,50,57,56,46,50,53,54,52,50,
+0,101,97,114,116,104,114,97,100,105,117,115,95,101,113,117,97,116,111,114,
+105,97,108,0,54,51,55,56,49,51,54,46,52,57,32,109,0,101,97,114,
+116,104,114,97,100,105,117,115,95,112,111,108,97,114,0,40,45,101,97,114,
+116,104,102,108,97,116,116,101,110,105,110,103,43,49,41,32,101,97,114,116,
+104,114,97,100,105,117,115,95,101,113,117,97,116,111,114,105,97,108,0,108,
+97,110,100,97,114,101,97,0,49,52,56,46,56,52,55,101,54,32,107,109,
+94,50,0,111,99,101,97,110,97,114,101,97,0,51,54,49,46,50,53,52,
+101,54,32,107,109,94,50,0,109,111,111,110,114,97,100,105,117,115,0,49,
+55,51,56,32,107,109,0,115,117,110,114,97,100,105,117,115,0,54,46,57,
+54,101,56,32,109,0,103,97,117,115,115,95,107,0,48,46,48,49,55,50,
+48,50,48,57,56,57,53,0,103,97,117,115,115,105,97,110,121,101,97,114,
+0,40,50,32,112,105,32,47,32,103,97,117,115,115,95,107,41,32,100,97,
+121,115,0,97,115,116,114,111,110,111,109,105,99,97,108,117,110,105,116,0,
+52,57,57,46,48,48,52,55,56,51,56,48,54,32,108,105,103,104,116,32,
+115,101,99,111,110,100,0,97,117,0,97,115,116,114,111,110,111,109,105,99,
+97,108,117,110,105,116,0,115,111,108,97,114,109,97,115,115,0,49,46,57,
+56,57,49,101,51,48,32,107,103,0,115,117,110,109,97,115,115,0,115,111,
+108,97,114,109,97,115,115,0,115,117,110,100,105,115,116,0,49,46,48,48,
+48,48,48,49,48,49,55,56,32,97,117,0,109,111,111,110,100,105,115,116,
+0,51,46,56,52,52,101,56,32,109,0,115,117,110,100,105,115,116,95,110,
+101,97,114,0,49,46,52,55,49,101,49,49,32,109,0,115,117,110,100,105,
+115,116,95,102,97,114,0,49,46,53,50,49,101,49,49,32,109,0,109,101,
+114,99,117,114,121,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,
+47,32,54,48,50,51,54,48,48,0,118,101,110,117,115,109,97,115,115,0,
+115,111,108,97,114,109,97,115,115,32,47,32,52,48,56,53,50,51,46,55,
+49,0,101,97,114,116,104,109,111,111,110,109,97,115,115,0,115,111,108,97,
+114,109,97,115,115,32,47,32,51,50,56,57,48,48,46,53,54,0,109,97,
+114,115,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,51,
+48,57,56,55,48,56,0,106,117,112,105,116,101,114,109,97,115,115,0,115,
+111,108,97,114,109,97,115,115,32,47,32,49,48,52,55,46,51,52,56,54,
+0,115,97,116,117,114,110,109,97,115,115,0,115,111,108,97,114,109,97,115,
+115,32,47,32,51,52,57,55,46,56,57,56,0,117,114,97,110,117,115,109,
+97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,50,50,57,48,
+50,46,57,56,0,110,101,112,116,117,110,101,109,97,115,115,0,115,111,108,
+97,114,109,97,115,115,32,47,32,49,57,52,49,50,46,50,52,0,112,108,
+117,116,111,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,
+49,46,51,53,101,56,0,109,111,111,110,101,97,114,116,104,109,97,115,115,
+114,97,116,105,111,0,48,46,48,49,50,51,48,48,48,51,52,0,101,97,
+114,116,104,109,97,115,115,0,101,97,114,116,104,109,111,111,110,109,97,115,
+115,32,47,32,40,32,49,32,43,32,109,111,111,110,101,97,114,116,104,109,
+97,115,115,114,97,116,105,111,41,0,109,111,111,110,109,97,115,115,0,109,
+111,111,110,101,97,114,116,104,109,97,115,115,114,97,116,105,111,32,101,97,
+114,116,104,109,97,115,115,0,111,108,100,109,101,114,99,117,114,121,109,97,
+115,115,0,48,46,51,51,48,50,50,101,50,52,32,107,103,0,111,108,100,
+118,101,110,117,115,109,97,115,115,0,52,46,56,54,57,48,101,50,52,32,
+107,103,0,111,108,100,109,97,114,115,109,97,115,115,0,48,46,54,52,49,
+57,49,101,50,52,32,107,103,0,111,108,100,106,117,112,105,116,101,114,109,
+97,115,115,0,49,56,57,56,46,56,101,50,52,32,107,103,0,111,108,100,
+115,97,116,117,114,110,109,97,115,115,0,53,54,56,46,53,101,50,52,32,
+107,103,0,111,108,100,117,114,97,110,117,115,109,97,115,115,0,56,54,46,
+54,50,53,101,50,52,32,107,103,0,111,108,100,110,101,112,116,117,110,101,
+109,97,115,115,0,49,48,50,46,55,56,101,50,52,32,107,103,0,111,108,
+100,112,108,117,116,111,109,97,115,115,0,48,46,48,49,53,101,50,52,32,
+107,103,0,109,101,114,99,117,114,121,114,97,100,105,117,115,0,50,52,52,
+48,32,107,109,0,118,101,110,117,115,114,97,100,105,117,115,0,54,48,53,
+49,46,56,52,32,107,109,0,101,97,114,116,104,114,97,100,105,117,115,0,
+54,51,55,49,46,48,49,32,107,109,0,109,97,114,115,114,97,100,105,117,
+115,0,51,51,56,57,46,57,50,32,107,109,0,106,117,112,105,116,101,114,
+114,97,100,105,117,115,0,54,57,57,49,49,32,107,109,0,115,97,116,117,
+114,110,114,97,100,105,117,115,0,53,56,50,51,50,32,107,109,0,117,114,
+97,110,117,115,114,97,100,105,117,115,0,50,53,51,54,50,32,107,109,0,
+110,101,112,116,117,110,101,114,97,100,105,117,115,0,50,52,54,50,52,32,
+107,109,0,112,108,117,116,111,114,97,100,105,117,115,0,49,49,53,49,32,
+107,109,0,109,111,111,110,103,114,97,118,105,116,121,0,49,46,54,50,32,
+109,47,115,94,50,0,97,116,111,109,105,99,109,97,115,115,0,101,108,101,
+99,116,114,111,110,109,97,115,115,0,97,116,111,109,105,99,99,104,97,114,
+103,101,0,101,0,97,116,111,109,105,99,97,99,116,105,111,110,0,104,98,
+97,114,0,97,116,111,109,105,99,108,101,110,103,116,104,0,98,111,104,114,
+114,97,100,105,117,115,0,97,116,111,109,105,99,116,105,109,101,0,104,98,
+97,114,94,51,47,99,111,117,108,111,109,98,99,111,110,115,116,94,50,32,
+97,116,111,109,105,99,109,97,115,115,32,101,94,52,0,97,116,111,109,105,
+99,118,101,108,111,99,105,116,121,0,97,116,111,109,105,99,108,101,110,103,
+116,104,32,47,32,97,116,111,109,105,99,116,105,109,101,0,97,116,111,109,
+105,99,101,110,101,114,103,121,0,104,98,97,114,32,47,32,97,116,111,109,
+105,99,116,105,109,101,0,104,97,114,116,114,101,101,0,97,116,111,109,105,
+99,101,110,101,114,103,121,0,72,97,114,116,114,101,101,0,104,97,114,116,
+114,101,101,0,116,104,101,114,109,97,108,99,111,117,108,111,109,98,0,74,
+47,75,0,116,104,101,114,109,97,108,97,109,112,101,114,101,0,87,47,75,
+0,116,104,101,114,109,97,108,102,97,114,97,100,0,74,47,75,94,50,0,
+116,104,101,114,109,97,108,111,104,109,0,75,94,50,47,87,0,102,111,117,
+114,105,101,114,0,116,104,101,114,109,97,108,111,104,109,0,116,104,101,114,
+109,97,108,104,101,110,114,121,0,74,32,75,94,50,47,87,94,50,0,116,
+104,101,114,109,97,108,118,111,108,116,0,75,0,85,83,0,49,50,48,48,
+124,51,57,51,55,32,109,47,102,116,0,105,110,116,0,51,57,51,55,124,
+49,50,48,48,32,102,116,47,109,0,105,110,99,104,0,50,46,53,52,32,
+99,109,0,105,110,0,105,110,99,104,0,102,111,111,116,0,49,50,32,105,
+110,99,104,0,102,101,101,116,0,102,111,111,116,0,102,116,0,102,111,111,
+116,0,121,97,114,100,0,51,32,102,116,0,121,100,0,121,97,114,100,0,
+109,105,108,101,0,53,50,56,48,32,102,116,0,108,105,110,101,0,49,124,
+49,50,32,105,110,99,104,0,114,111,100,0,53,46,53,32,121,97,114,100,
+0,112,101,114,99,104,0,114,111,100,0,102,117,114,108,111,110,103,0,52,
+48,32,114,111,100,0,115,116,97,116,117,116,101,109,105,108,101,0,109,105,
+108,101,0,108,101,97,103,117,101,0,51,32,109,105,108,101,0,115,117,114,
+118,101,121,111,114,115,99,104,97,105,110,0,54,54,32,115,117,114,118,101,
+121,102,116,0,115,117,114,118,101,121,99,104,97,105,110,0,115,117,114,118,
+101,121,111,114,115,99,104,97,105,110,0,115,117,114,118,101,121,111,114,115,
+112,111,108,101,0,49,124,52,32,115,117,114,118,101,121,111,114,115,99,104,
+97,105,110,0,115,117,114,118,101,121,111,114,115,108,105,110,107,0,49,124,
+49,48,48,32,115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,99,
+104,97,105,110,0,54,54,32,102,116,0,108,105,110,107,0,49,124,49,48,
+48,32,99,104,97,105,110,0,99,104,0,99,104,97,105,110,0,117,115,97,
+99,114,101,0,49,48,32,115,117,114,118,101,121,99,104,97,105,110,94,50,
+0,105,110,116,97,99,114,101,0,49,48,32,99,104,97,105,110,94,50,0,
+105,110,116,97,99,114,101,102,111,111,116,0,97,99,114,101,32,115,117,114,
+118,101,121,102,111,111,116,0,117,115,97,99,114,101,102,111,111,116,0,117,
+115,97,99,114,101,32,115,117,114,118,101,121,102,111,111,116,0,115,101,99,
+116,105,111,110,0,109,105,108,101,94,50,0,116,111,119,110,115,104,105,112,
+0,51,54,32,115,101,99,116,105,111,110,0,104,111,109,101,115,116,101,97,
+100,0,49,54,48,32,97,99,114,101,0,103,117,110,116,101,114,115,99,104,
+97,105,110,0,115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,101,
+110,103,105,110,101,101,114,115,99,104,97,105,110,0,49,48,48,32,102,116,
+0,101,110,103,105,110,101,101,114,115,108,105,110,107,0,49,124,49,48,48,
+32,101,110,103,105,110,101,101,114,115,99,104,97,105,110,0,114,97,109,115,
+100,101,110,115,99,104,97,105,110,0,101,110,103,105,110,101,101,114,115,99,
+104,97,105,110,0,114,97,109,115,100,101,110,115,108,105,110,107,0,101,110,
+103,105,110,101,101,114,115,108,105,110,107,0,103,117,114,108,101,121,99,104,
+97,105,110,0,51,51,32,102,101,101,116,0,103,117,114,108,101,121,108,105,
+110,107,0,49,124,53,48,32,103,117,114,108,101,121,99,104,97,105,110,0,
+119,105,110,103,99,104,97,105,110,0,54,54,32,102,101,101,116,0,119,105,
+110,103,108,105,110,107,0,49,124,56,48,32,119,105,110,103,99,104,97,105,
+110,0,102,97,116,104,111,109,0,54,32,102,116,0,110,97,117,116,105,99,
+97,108,109,105,108,101,0,49,56,53,50,32,109,0,99,97,98,108,101,0,
+49,124,49,48,32,110,97,117,116,105,99,97,108,109,105,108,101,0,105,110,
+116,99,97,98,108,101,0,99,97,98,108,101,0,99,97,98,108,101,108,101,
+110,103,116,104,0,99,97,98,108,101,0,85,83,99,97,98,108,101,0,49,
+48,48,32,85,83,102,97,116,104,111,109,0,110,97,118,121,99,97,98,108,
+101,108,101,110,103,116,104,0,55,50,48,32,85,83,102,116,0,109,97,114,
+105,110,101,108,101,97,103,117,101,0,51,32,110,97,117,116,105,99,97,108,
+109,105,108,101,0,103,101,111,103,114,97,112,104,105,99,97,108,109,105,108,
+101,0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,0,107,110,111,
+116,0,110,97,117,116,105,99,97,108,109,105,108,101,32,47,32,104,114,0,
+99,108,105,99,107,0,107,109,0,107,108,105,99,107,0,99,108,105,99,107,
+0,112,111,117,110,100,0,48,46,52,53,51,53,57,50,51,55,32,107,103,
+0,108,98,0,112,111,117,110,100,0,103,114,97,105,110,0,49,124,55,48,
+48,48,32,112,111,117,110,100,0,111,117,110,99,101,0,49,124,49,54,32,
+112,111,117,110,100,0,111,122,0,111,117,110,99,101,0,100,114,97,109,0,
+49,124,49,54,32,111,117,110,99,101,0,100,114,0,100,114,97,109,0,117,
+115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,49,48,48,32,112,
+111,117,110,100,115,0,99,119,116,0,104,117,110,100,114,101,100,119,101,105,
+103,104,116,0,115,104,111,114,116,104,117,110,100,114,101,100,119,101,105,103,
+104,116,0,117,115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,117,
+115,116,111,110,0,115,104,111,114,116,116,111,110,0,115,104,111,114,116,116,
+111,110,0,50,48,48,48,32,108,98,0,113,117,97,114,116,101,114,119,101,
+105,103,104,116,0,49,124,52,32,117,115,116,111,110,0,115,104,111,114,116,
+113,117,97,114,116,101,114,119,101,105,103,104,116,0,49,124,52,32,115,104,
+111,114,116,116,111,110,0,115,104,111,114,116,113,117,97,114,116,101,114,0,
+115,104,111,114,116,113,117,97,114,116,101,114,119,101,105,103,104,116,0,116,
+114,111,121,112,111,117,110,100,0,53,55,54,48,32,103,114,97,105,110,0,
+116,114,111,121,111,117,110,99,101,0,49,124,49,50,32,116,114,111,121,112,
+111,117,110,100,0,111,122,116,0,116,114,111,121,111,117,110,99,101,0,112,
+101,110,110,121,119,101,105,103,104,116,0,49,124,50,48,32,116,114,111,121,
+111,117,110,99,101,0,100,119,116,0,112,101,110,110,121,119,101,105,103,104,
+116,0,97,115,115,97,121,116,111,110,0,109,103,32,116,111,110,32,47,32,
+116,114,111,121,111,117,110,99,101,0,117,115,97,115,115,97,121,116,111,110,
+0,109,103,32,117,115,116,111,110,32,47,32,116,114,111,121,111,117,110,99,
+101,0,98,114,97,115,115,97,121,116,111,110,0,109,103,32,98,114,116,111,
+110,32,47,32,116,114,111,121,111,117,110,99,101,0,102,105,110,101,111,117,
+110,99,101,0,116,114,111,121,111,117,110,99,101,0,109,101,116,114,105,99,
+99,97,114,97,116,0,48,46,50,32,103,114,97,109,0,109,101,116,114,105,
+99,103,114,97,105,110,0,53,48,32,109,103,0,99,97,114,97,116,0,109,
+101,116,114,105,99,99,97,114,97,116,0,99,116,0,99,97,114,97,116,0,
+106,101,119,101,108,101,114,115,112,111,105,110,116,0,49,124,49,48,48,32,
+99,97,114,97,116,0,115,105,108,118,101,114,115,109,105,116,104,112,111,105,
+110,116,0,49,124,52,48,48,48,32,105,110,99,104,0,109,111,109,109,101,
+0,51,46,55,53,32,103,114,97,109,115,0,97,112,112,111,117,110,100,0,
+116,114,111,121,112,111,117,110,100,0,97,112,111,117,110,99,101,0,116,114,
+111,121,111,117,110,99,101,0,97,112,100,114,97,109,0,49,124,56,32,97,
+112,111,117,110,99,101,0,97,112,115,99,114,117,112,108,101,0,49,124,51,
+32,97,112,100,114,97,109,0,117,115,103,97,108,108,111,110,0,50,51,49,
+32,105,110,94,51,0,103,97,108,0,103,97,108,108,111,110,0,113,117,97,
+114,116,0,49,124,52,32,103,97,108,108,111,110,0,112,105,110,116,0,49,
+124,50,32,113,117,97,114,116,0,103,105,108,108,0,49,124,52,32,112,105,
+110,116,0,117,115,113,117,97,114,116,0,49,124,52,32,117,115,103,97,108,
+108,111,110,0,117,115,112,105,110,116,0,49,124,50,32,117,115,113,117,97,
+114,116,0,117,115,103,105,108,108,0,49,124,52,32,117,115,112,105,110,116,
+0,117,115,102,108,117,105,100,111,117,110,99,101,0,49,124,49,54,32,117,
+115,112,105,110,116,0,102,108,117,105,100,100,114,97,109,0,49,124,56,32,
+117,115,102,108,111,122,0,109,105,110,105,109,118,111,108,117,109,101,0,49,
+124,54,48,32,102,108,117,105,100,100,114,97,109,0,113,116,0,113,117,97,
+114,116,0,112,116,0,112,105,110,116,0,102,108,111,122,0,102,108,117,105,
+100,111,117,110,99,101,0,117,115,102,108,111,122,0,117,115,102,108,117,105,
+100,111,117,110,99,101,0,102,108,100,114,0,102,108,117,105,100,100,114,97,
+109,0,108,105,113,117,105,100,98,97,114,114,101,108,0,51,49,46,53,32,
+117,115,103,97,108,108,111,110,0,117,115,98,101,101,114,98,97,114,114,101,
+108,0,50,32,98,101,101,114,107,101,103,115,0,98,101,101,114,107,101,103,
+0,49,53,46,53,32,117,115,103,97,108,108,111,110,0,112,111,110,121,107,
+101,103,0,49,124,50,32,98,101,101,114,107,101,103,0,119,105,110,101,107,
+101,103,0,49,50,32,117,115,103,97,108,108,111,110,0,112,101,116,114,111,
+108,101,117,109,98,97,114,114,101,108,0,52,50,32,117,115,103,97,108,108,
+111,110,0,98,97,114,114,101,108,0,112,101,116,114,111,108,101,117,109,98,
+97,114,114,101,108,0,98,98,108,0,98,97,114,114,101,108,0,117,115,104,
+111,103,115,104,101,97,100,0,50,32,108,105,113,117,105,100,98,97,114,114,
+101,108,0,117,115,102,105,114,107,105,110,0,57,32,103,97,108,108,111,110,
+0,117,115,98,117,115,104,101,108,0,50,49,53,48,46,52,50,32,105,110,
+94,51,0,98,117,0,98,117,115,104,101,108,0,112,101,99,107,0,49,124,
+52,32,98,117,115,104,101,108,0,117,115,112,101,99,107,0,49,124,52,32,
+117,115,98,117,115,104,101,108,0,98,114,112,101,99,107,0,49,124,52,32,
+98,114,98,117,115,104,101,108,0,112,107,0,112,101,99,107,0,100,114,121,
+103,97,108,108,111,110,0,49,124,50,32,117,115,112,101,99,107,0,100,114,
+121,113,117,97,114,116,0,49,124,52,32,100,114,121,103,97,108,108,111,110,
+0,100,114,121,112,105,110,116,0,49,124,50,32,100,114,121,113,117,97,114,
+116,0,100,114,121,98,97,114,114,101,108,0,55,48,53,54,32,105,110,94,
+51,0,99,114,97,110,98,101,114,114,121,98,97,114,114,101,108,0,53,56,
+50,54,32,105,110,94,51,0,104,101,97,112,101,100,98,117,115,104,101,108,
+0,49,46,50,55,56,32,117,115,98,117,115,104,101,108,0,119,104,101,97,
+116,98,117,115,104,101,108,0,54,48,32,108,98,0,115,111,121,98,101,97,
+110,98,117,115,104,101,108,0,54,48,32,108,98,0,99,111,114,110,98,117,
+115,104,101,108,0,53,54,32,108,98,0,114,121,101,98,117,115,104,101,108,
+0,53,54,32,108,98,0,98,97,114,108,101,121,98,117,115,104,101,108,0,
+52,56,32,108,98,0,111,97,116,98,117,115,104,101,108,0,51,50,32,108,
+98,0,114,105,99,101,98,117,115,104,101,108,0,52,53,32,108,98,0,99,
+97,110,97,100,97,95,111,97,116,98,117,115,104,101,108,0,51,52,32,108,
+98,0,112,111,110,121,118,111,108,117,109,101,0,49,32,117,115,102,108,111,
+122,0,106,105,103,103,101,114,0,49,46,53,32,117,115,102,108,111,122,0,
+115,104,111,116,0,106,105,103,103,101,114,0,101,117,115,104,111,116,0,50,
+53,32,109,108,0,102,105,102,116,104,0,49,124,53,32,117,115,103,97,108,
+108,111,110,0,119,105,110,101,98,111,116,116,108,101,0,55,53,48,32,109,
+108,0,119,105,110,101,115,112,108,105,116,0,49,124,52,32,119,105,110,101,
+98,111,116,116,108,101,0,119,105,110,101,103,108,97,115,115,0,52,32,117,
+115,102,108,111,122,0,109,97,103,110,117,109,0,49,46,53,32,108,105,116,
+101,114,0,109,101,116,114,105,99,116,101,110,116,104,0,51,55,53,32,109,
+108,0,109,101,116,114,105,99,102,105,102,116,104,0,55,53,48,32,109,108,
+0,109,101,116,114,105,99,113,117,97,114,116,0,49,32,108,105,116,101,114,
+0,114,101,112,117,116,101,100,113,117,97,114,116,0,49,124,54,32,98,114,
+103,97,108,108,111,110,0,114,101,112,117,116,101,100,112,105,110,116,0,49,
+124,50,32,114,101,112,117,116,101,100,113,117,97,114,116,0,98,114,119,105,
+110,101,98,111,116,116,108,101,0,114,101,112,117,116,101,100,113,117,97,114,
+116,0,115,112,108,105,116,0,50,48,48,32,109,108,0,106,101,114,111,98,
+111,97,109,0,50,32,109,97,103,110,117,109,0,114,101,104,111,98,111,97,
+109,0,51,32,109,97,103,110,117,109,0,109,101,116,104,117,115,101,108,97,
+104,0,52,32,109,97,103,110,117,109,0,115,97,108,109,97,110,97,122,97,
+114,0,54,32,109,97,103,110,117,109,0,98,97,108,116,104,97,122,97,114,
+0,56,32,109,97,103,110,117,109,0,110,101,98,117,99,104,97,100,110,101,
+122,122,97,114,0,49,48,32,109,97,103,110,117,109,0,99,108,97,114,107,
+100,101,103,114,101,101,0,49,124,55,48,48,48,48,0,103,112,103,0,103,
+114,97,105,110,115,47,103,97,108,108,111,110,0,115,104,111,101,105,114,111,
+110,0,49,124,52,56,32,105,110,99,104,0,115,104,111,101,111,117,110,99,
+101,0,49,124,54,52,32,105,110,99,104,0,115,104,111,101,115,105,122,101,
+95,100,101,108,116,97,0,49,124,51,32,105,110,99,104,0,115,104,111,101,
+95,109,101,110,48,0,56,46,50,53,32,105,110,99,104,0,115,104,111,101,
+95,119,111,109,101,110,48,0,40,55,43,49,49,124,49,50,41,32,105,110,
+99,104,0,115,104,111,101,95,98,111,121,115,48,0,40,51,43,49,49,124,
+49,50,41,32,105,110,99,104,0,115,104,111,101,95,103,105,114,108,115,48,
+0,40,51,43,55,124,49,50,41,32,105,110,99,104,0,101,117,114,111,112,
+101,115,104,111,101,115,105,122,101,0,50,124,51,32,99,109,0,98,117,99,
+107,0,85,83,36,0,102,105,110,0,53,32,85,83,36,0,115,97,119,98,
+117,99,107,0,49,48,32,85,83,36,0,117,115,103,114,97,110,100,0,49,
+48,48,48,32,85,83,36,0,103,114,101,101,110,98,97,99,107,0,85,83,
+36,0,107,101,121,0,107,103,0,108,105,100,0,49,32,111,122,0,102,111,
+111,116,98,97,108,108,102,105,101,108,100,0,117,115,102,111,111,116,98,97,
+108,108,102,105,101,108,100,0,117,115,102,111,111,116,98,97,108,108,102,105,
+101,108,100,0,49,48,48,32,121,97,114,100,115,0,99,97,110,97,100,97,
+102,111,111,116,98,97,108,108,102,105,101,108,100,0,49,49,48,32,121,97,
+114,100,115,0,109,97,114,97,116,104,111,110,0,50,54,32,109,105,108,101,
+115,32,43,32,51,56,53,32,121,97,114,100,115,0,85,75,0,85,75,108,
+101,110,103,116,104,95,83,74,74,0,85,75,108,101,110,103,116,104,95,66,
+0,48,46,57,49,52,51,57,57,50,32,109,101,116,101,114,32,47,32,121,
+97,114,100,0,85,75,108,101,110,103,116,104,95,83,74,74,0,48,46,57,
+49,52,51,57,56,52,49,32,109,101,116,101,114,32,47,32,121,97,114,100,
+0,85,75,108,101,110,103,116,104,95,75,0,109,101,116,101,114,32,47,32,
+51,57,46,51,55,48,55,57,32,105,110,99,104,0,85,75,108,101,110,103,
+116,104,95,67,0,109,101,116,101,114,32,47,32,49,46,48,57,51,54,50,
+51,49,49,32,121,97,114,100,0,98,114,110,97,117,116,105,99,97,108,109,
+105,108,101,0,54,48,56,48,32,102,116,0,98,114,107,110,111,116,0,98,
+114,110,97,117,116,105,99,97,108,109,105,108,101,32,47,32,104,114,0,98,
+114,99,97,98,108,101,0,49,124,49,48,32,98,114,110,97,117,116,105,99,
+97,108,109,105,108,101,0,97,100,109,105,114,97,108,116,121,109,105,108,101,
+0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,0,97,100,109,105,
+114,97,108,116,121,107,110,111,116,0,98,114,107,110,111,116,0,97,100,109,
+105,114,97,108,116,121,99,97,98,108,101,0,98,114,99,97,98,108,101,0,
+115,101,97,109,105,108,101,0,54,48,48,48,32,102,116,0,115,104,97,99,
+107,108,101,0,49,53,32,102,97,116,104,111,109,115,0,99,108,111,118,101,
+0,55,32,108,98,0,115,116,111,110,101,0,49,52,32,108,98,0,116,111,
+100,0,50,56,32,108,98,0,98,114,113,117,97,114,116,101,114,119,101,105,
+103,104,116,0,49,124,52,32,98,114,104,117,110,100,114,101,100,119,101,105,
+103,104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,103,104,116,0,
+56,32,115,116,111,110,101,0,108,111,110,103,104,117,110,100,114,101,100,119,
+101,105,103,104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,103,104,
+116,0,108,111,110,103,116,111,110,0,50,48,32,98,114,104,117,110,100,114,
+101,100,119,101,105,103,104,116,0,98,114,116,111,110,0,108,111,110,103,116,
+111,110,0,98,114,109,105,110,105,109,0,49,124,54,48,32,98,114,100,114,
+97,109,0,98,114,115,99,114,117,112,108,101,0,49,124,51,32,98,114,100,
+114,97,109,0,102,108,117,105,100,115,99,114,117,112,108,101,0,98,114,115,
+99,114,117,112,108,101,0,98,114,100,114,97,109,0,49,124,56,32,98,114,
+102,108,111,122,0,98,114,102,108,117,105,100,111,117,110,99,101,0,49,124,
+50,48,32,98,114,112,105,110,116,0,98,114,102,108,111,122,0,98,114,102,
+108,117,105,100,111,117,110,99,101,0,98,114,103,105,108,108,0,49,124,52,
+32,98,114,112,105,110,116,0,98,114,112,105,110,116,0,49,124,50,32,98,
+114,113,117,97,114,116,0,98,114,113,117,97,114,116,0,49,124,52,32,98,
+114,103,97,108,108,111,110,0,98,114,103,97,108,108,111,110,0,52,46,53,
+52,54,48,57,32,108,0,98,114,98,97,114,114,101,108,0,51,54,32,98,
+114,103,97,108,108,111,110,0,98,114,98,117,115,104,101,108,0,56,32,98,
+114,103,97,108,108,111,110,0,98,114,104,101,97,112,101,100,98,117,115,104,
+101,108,0,49,46,50,55,56,32,98,114,98,117,115,104,101,108,0,98,114,
+113,117,97,114,116,101,114,0,56,32,98,114,98,117,115,104,101,108,0,98,
+114,99,104,97,108,100,114,111,110,0,51,54,32,98,114,98,117,115,104,101,
+108,0,98,97,103,0,52,32,98,114,98,117,115,104,101,108,0,98,117,99,
+107,101,116,0,52,32,98,114,103,97,108,108,111,110,0,107,105,108,100,101,
+114,107,105,110,0,50,32,98,114,102,105,114,107,105,110,0,108,97,115,116,
+0,52,48,32,98,114,98,117,115,104,101,108,0,110,111,103,103,105,110,0,
+98,114,103,105,108,108,0,112,111,116,116,108,101,0,48,46,53,32,98,114,
+103,97,108,108,111,110,0,112,105,110,0,52,46,53,32,98,114,103,97,108,
+108,111,110,0,112,117,110,99,104,101,111,110,0,55,50,32,98,114,103,97,
+108,108,111,110,0,115,101,97,109,0,56,32,98,114,98,117,115,104,101,108,
+0,99,111,111,109,98,0,52,32,98,114,98,117,115,104,101,108,0,98,111,
+108,108,0,54,32,98,114,98,117,115,104,101,108,0,102,105,114,108,111,116,
+0,49,124,52,32,98,111,108,108,0,98,114,102,105,114,107,105,110,0,57,
+32,98,114,103,97,108,108,111,110,0,99,114,97,110,0,51,55,46,53,32,
+98,114,103,97,108,108,111,110,0,98,114,119,105,110,101,104,111,103,115,104,
+101,97,100,0,53,50,46,53,32,98,114,103,97,108,108,111,110,0,98,114,
+104,111,103,115,104,101,97,100,0,98,114,119,105,110,101,104,111,103,115,104,
+101,97,100,0,98,114,98,101,101,114,104,111,103,115,104,101,97,100,0,53,
+52,32,98,114,103,97,108,108,111,110,0,98,114,98,101,101,114,98,117,116,
+116,0,50,32,98,114,98,101,101,114,104,111,103,115,104,101,97,100,0,114,
+101,103,105,115,116,101,114,116,111,110,0,49,48,48,32,102,116,94,51,0,
+115,104,105,112,112,105,110,103,116,111,110,0,52,48,32,102,116,94,51,0,
+98,114,115,104,105,112,112,105,110,103,116,111,110,0,52,50,32,102,116,94,
+51,0,102,114,101,105,103,104,116,116,111,110,0,115,104,105,112,112,105,110,
+103,116,111,110,0,100,105,115,112,108,97,99,101,109,101,110,116,116,111,110,
+0,51,53,32,102,116,94,51,0,119,97,116,101,114,116,111,110,0,50,50,
+52,32,98,114,103,97,108,108,111,110,0,115,116,114,105,107,101,0,55,48,
+46,53,32,108,0,97,109,98,101,114,0,52,32,98,114,98,117,115,104,101,
+108,0,98,97,114,108,101,121,99,111,114,110,0,49,124,51,32,85,75,105,
+110,99,104,0,110,97,105,108,0,49,124,49,54,32,85,75,121,97,114,100,
+0,112,111,108,101,0,49,54,46,53,32,85,75,102,116,0,114,111,112,101,
+0,50,48,32,85,75,102,116,0,101,110,103,108,105,115,104,101,108,108,0,
+52,53,32,85,75,105,110,99,104,0,102,108,101,109,105,115,104,101,108,108,
+0,50,55,32,85,75,105,110,99,104,0,101,108,108,0,101,110,103,108,105,
+115,104,101,108,108,0,115,112,97,110,0,57,32,85,75,105,110,99,104,0,
+103,111,97,100,0,52,46,53,32,85,75,102,116,0,114,111,111,100,0,49,
+124,52,32,97,99,114,101,0,101,110,103,108,105,115,104,99,97,114,97,116,
+0,116,114,111,121,111,117,110,99,101,47,49,53,49,46,53,0,109,97,110,
+99,117,115,0,50,32,111,122,0,109,97,115,116,0,50,46,53,32,108,98,
+0,110,97,105,108,107,101,103,0,49,48,48,32,108,98,115,0,98,97,115,
+101,98,111,120,0,51,49,51,54,48,32,105,110,94,50,0,109,101,116,114,
+101,0,109,101,116,101,114,0,103,114,97,109,109,101,0,103,114,97,109,0,
+108,105,116,114,101,0,108,105,116,101,114,0,100,105,111,112,116,114,101,0,
+100,105,111,112,116,101,114,0,97,108,117,109,105,110,105,117,109,0,97,108,
+117,109,105,110,117,109,0,115,117,108,112,104,117,114,0,115,117,108,102,117,
+114,0,103,101,111,109,101,116,114,105,99,112,97,99,101,0,53,32,102,116,
+0,112,97,99,101,0,50,46,53,32,102,116,0,85,83,109,105,108,105,116,
+97,114,121,112,97,99,101,0,51,48,32,105,110,0,85,83,100,111,117,98,
+108,101,116,105,109,101,112,97,99,101,0,51,54,32,105,110,0,102,105,110,
+103,101,114,98,114,101,97,100,116,104,0,55,124,56,32,105,110,0,102,105,
+110,103,101,114,108,101,110,103,116,104,0,52,46,53,32,105,110,0,102,105,
+110,103,101,114,0,102,105,110,103,101,114,98,114,101,97,100,116,104,0,112,
+97,108,109,119,105,100,116,104,0,104,97,110,100,0,112,97,108,109,108,101,
+110,103,116,104,0,56,32,105,110,0,104,97,110,100,0,52,32,105,110,99,
+104,0,115,104,97,102,116,109,101,110,116,0,54,32,105,110,99,104,0,115,
+109,111,111,116,0,53,32,102,116,32,43,32,55,32,105,110,0,116,98,108,
+0,116,97,98,108,101,115,112,111,111,110,0,116,98,115,112,0,116,97,98,
+108,101,115,112,111,111,110,0,116,98,108,115,112,0,116,97,98,108,101,115,
+112,111,111,110,0,84,98,0,116,97,98,108,101,115,112,111,111,110,0,116,
+115,112,0,116,101,97,115,112,111,111,110,0,115,97,108,116,115,112,111,111,
+110,0,49,124,52,32,116,115,112,0,117,115,99,117,112,0,56,32,117,115,
+102,108,111,122,0,117,115,116,97,98,108,101,115,112,111,111,110,0,49,124,
+49,54,32,117,115,99,117,112,0,117,115,116,101,97,115,112,111,111,110,0,
+49,124,51,32,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,
+98,108,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,98,
+115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,98,
+108,115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,0,117,115,116,
+115,112,0,117,115,116,101,97,115,112,111,111,110,0,109,101,116,114,105,99,
+99,117,112,0,50,53,48,32,109,108,0,115,116,105,99,107,98,117,116,116,
+101,114,0,49,124,52,32,108,98,0,110,117,109,98,101,114,49,99,97,110,
+0,49,48,32,117,115,102,108,111,122,0,110,117,109,98,101,114,50,99,97,
+110,0,49,57,32,117,115,102,108,111,122,0,110,117,109,98,101,114,50,46,
+53,99,97,110,0,51,46,53,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,51,99,97,110,0,52,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,53,99,97,110,0,55,32,117,115,99,117,112,115,0,110,117,109,98,
+101,114,49,48,99,97,110,0,49,48,53,32,117,115,102,108,111,122,0,98,
+114,99,117,112,0,49,124,50,32,98,114,112,105,110,116,0,98,114,116,101,
+97,99,117,112,0,49,124,51,32,98,114,112,105,110,116,0,98,114,116,97,
+98,108,101,115,112,111,111,110,0,49,53,32,109,108,0,98,114,116,101,97,
+115,112,111,111,110,0,49,124,51,32,98,114,116,97,98,108,101,115,112,111,
+111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,111,110,0,50,32,
+98,114,116,101,97,115,112,111,111,110,0,100,101,115,115,101,114,116,115,112,
+111,111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,111,110,0,100,
+115,112,0,100,101,115,115,101,114,116,115,112,111,111,110,0,98,114,116,115,
+112,0,98,114,116,101,97,115,112,111,111,110,0,98,114,116,98,108,0,98,
+114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,115,112,0,98,
+114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,108,115,112,0,
+98,114,116,97,98,108,101,115,112,111,111,110,0,97,117,115,116,114,97,108,
+105,97,116,97,98,108,101,115,112,111,111,110,0,50,48,32,109,108,0,97,
+117,115,116,98,108,0,97,117,115,116,114,97,108,105,97,116,97,98,108,101,
+115,112,111,111,110,0,97,117,115,116,98,115,112,0,97,117,115,116,114,97,
+108,105,97,116,97,98,108,101,115,112,111,111,110,0,97,117,115,116,98,108,
+115,112,0,97,117,115,116,114,97,108,105,97,116,97,98,108,101,115,112,111,
+111,110,0,97,117,115,116,114,97,108,105,97,116,101,97,115,112,111,111,110,
+0,49,124,52,32,97,117,115,116,114,97,108,105,97,116,97,98,108,101,115,
+112,111,111,110,0,97,117,115,116,115,112,0,97,117,115,116,114,97,108,105,
+97,116,101,97,115,112,111,111,110,0,99,97,116,116,121,0,48,46,53,32,
+107,103,0,111,108,100,99,97,116,116,121,0,52,124,51,32,108,98,115,0,
+116,97,101,108,0,49,124,49,54,32,111,108,100,99,97,116,116,121,0,109,
+97,99,101,0,48,46,49,32,116,97,101,108,0,111,108,100,112,105,99,117,
+108,0,49,48,48,32,111,108,100,99,97,116,116,121,0,112,105,99,117,108,
+0,49,48,48,32,99,97,116,116,121,0,115,101,101,114,0,49,52,52,48,
+48,32,103,114,97,105,110,0,115,101,114,0,115,101,101,114,0,109,97,117,
+110,100,0,52,48,32,115,101,101,114,0,112,97,107,105,115,116,97,110,115,
+101,101,114,0,49,32,107,103,0,112,97,107,105,115,116,97,110,109,97,117,
+110,100,0,52,48,32,112,97,107,105,115,116,97,110,115,101,101,114,0,99,
+104,105,116,116,97,107,0,49,124,49,54,32,115,101,101,114,0,116,111,108,
+97,0,49,124,53,32,99,104,105,116,116,97,107,0,111,108,108,111,99,107,
+0,49,124,52,32,108,105,116,101,114,0,106,97,112,97,110,99,117,112,0,
+50,48,48,32,109,108,0,98,117,116,116,101,114,0,56,32,111,122,47,117,
+115,99,117,112,0,98,117,116,116,101,114,95,99,108,97,114,105,102,105,101,
+100,0,54,46,56,32,111,122,47,117,115,99,117,112,0,99,111,99,111,97,
+95,98,117,116,116,101,114,0,57,32,111,122,47,117,115,99,117,112,0,115,
+104,111,114,116,101,110,105,110,103,0,54,46,55,53,32,111,122,47,117,115,
+99,117,112,0,111,105,108,0,55,46,53,32,111,122,47,117,115,99,117,112,
+0,99,97,107,101,102,108,111,117,114,95,115,105,102,116,101,100,0,51,46,
+53,32,111,122,47,117,115,99,117,112,0,99,97,107,101,102,108,111,117,114,
+95,115,112,111,111,110,101,100,0,52,32,111,122,47,117,115,99,117,112,0,
+99,97,107,101,102,108,111,117,114,95,115,99,111,111,112,101,100,0,52,46,
+53,32,111,122,47,117,115,99,117,112,0,102,108,111,117,114,95,115,105,102,
+116,101,100,0,52,32,111,122,47,117,115,99,117,112,0,102,108,111,117,114,
+95,115,112,111,111,110,101,100,0,52,46,50,53,32,111,122,47,117,115,99,
+117,112,0,102,108,111,117,114,95,115,99,111,111,112,101,100,0,53,32,111,
+122,47,117,115,99,117,112,0,98,114,101,97,100,102,108,111,117,114,95,115,
+105,102,116,101,100,0,52,46,50,53,32,111,122,47,117,115,99,117,112,0,
+98,114,101,97,100,102,108,111,117,114,95,115,112,111,111,110,101,100,0,52,
+46,53,32,111,122,47,117,115,99,117,112,0,98,114,101,97,100,102,108,111,
+117,114,95,115,99,111,111,112,101,100,0,53,46,53,32,111,122,47,117,115,
+99,117,112,0,99,111,114,110,115,116,97,114,99,104,0,49,50,48,32,103,
+114,97,109,115,47,117,115,99,117,112,0,100,117,116,99,104,99,111,99,111,
+97,95,115,105,102,116,101,100,0,55,53,32,103,47,117,115,99,117,112,0,
+100,117,116,99,104,99,111,99,111,97,95,115,112,111,111,110,101,100,0,57,
+50,32,103,47,117,115,99,117,112,0,100,117,116,99,104,99,111,99,111,97,
+95,115,99,111,111,112,101,100,0,57,53,32,103,47,117,115,99,117,112,0,
+99,111,99,111,97,95,115,105,102,116,101,100,0,55,53,32,103,47,117,115,
+99,117,112,0,99,111,99,111,97,95,115,112,111,111,110,101,100,0,56,50,
+32,103,47,117,115,99,117,112,0,99,111,99,111,97,95,115,99,111,111,112,
+101,100,0,57,53,32,103,47,117,115,99,117,112,0,104,101,97,118,121,99,
+114,101,97,109,0,50,51,50,32,103,47,117,115,99,117,112,0,109,105,108,
+107,0,50,52,50,32,103,47,117,115,99,117,112,0,115,111,117,114,99,114,
+101,97,109,0,50,52,50,32,103,47,117,115,99,117,112,0,109,111,108,97,
+115,115,101,115,0,49,49,46,50,53,32,111,122,47,117,115,99,117,112,0,
+99,111,114,110,115,121,114,117,112,0,49,49,46,53,32,111,122,47,117,115,
+99,117,112,0,104,111,110,101,121,0,49,49,46,55,53,32,111,122,47,117,
+115,99,117,112,0,115,117,103,97,114,0,50,48,48,32,103,47,117,115,99,
+117,112,0,112,111,119,100,101,114,101,100,95,115,117,103,97,114,0,52,32,
+111,122,47,117,115,99,117,112,0,98,114,111,119,110,115,117,103,97,114,95,
+108,105,103,104,116,0,50,49,55,32,103,47,117,115,99,117,112,0,98,114,
+111,119,110,115,117,103,97,114,95,100,97,114,107,0,50,51,57,32,103,47,
+117,115,99,117,112,0,98,97,107,105,110,103,95,112,111,119,100,101,114,0,
+52,46,54,32,103,114,97,109,115,32,47,32,117,115,116,115,112,0,115,97,
+108,116,0,54,32,103,32,47,32,117,115,116,115,112,0,107,111,115,104,101,
+114,115,97,108,116,0,50,46,56,32,103,32,47,32,117,115,116,115,112,0,
+107,111,115,104,101,114,115,97,108,116,95,109,111,114,116,111,110,0,52,46,
+56,32,103,32,47,32,117,115,116,115,112,0,101,103,103,0,53,48,32,103,
+114,97,109,115,0,101,103,103,119,104,105,116,101,0,51,48,32,103,114,97,
+109,115,0,101,103,103,121,111,108,107,0,49,56,46,54,32,103,114,97,109,
+115,0,101,103,103,118,111,108,117,109,101,0,51,32,117,115,116,97,98,108,
+101,115,112,111,111,110,115,32,43,32,49,124,50,32,117,115,116,115,112,0,
+101,103,103,119,104,105,116,101,118,111,108,117,109,101,0,50,32,117,115,116,
+97,98,108,101,115,112,111,111,110,115,0,101,103,103,121,111,108,107,118,111,
+108,117,109,101,0,51,46,53,32,117,115,116,115,112,0,98,97,117,109,101,
+99,111,110,115,116,0,49,52,52,0,111,117,110,99,101,100,97,108,0,111,
+122,32,102,116,32,47,32,115,94,50,0,112,111,117,110,100,97,108,0,108,
+98,32,102,116,32,47,32,115,94,50,0,116,111,110,100,97,108,0,116,111,
+110,32,102,116,32,47,32,115,94,50,0,112,100,108,0,112,111,117,110,100,
+97,108,0,111,115,105,0,111,117,110,99,101,32,102,111,114,99,101,32,47,
+32,105,110,99,104,94,50,0,112,115,105,0,112,111,117,110,100,32,102,111,
+114,99,101,32,47,32,105,110,99,104,94,50,0,112,115,105,97,0,112,115,
+105,0,116,115,105,0,116,111,110,32,102,111,114,99,101,32,47,32,105,110,
+99,104,94,50,0,114,101,121,110,0,112,115,105,32,115,101,99,0,115,108,
+117,103,0,108,98,102,32,115,94,50,32,47,32,102,116,0,115,108,117,103,
+102,0,115,108,117,103,32,102,111,114,99,101,0,115,108,105,110,99,104,0,
+108,98,102,32,115,94,50,32,47,32,105,110,99,104,0,115,108,105,110,99,
+104,102,0,115,108,105,110,99,104,32,102,111,114,99,101,0,103,101,101,112,
+111,117,110,100,0,115,108,117,103,0,108,98,102,0,108,98,32,102,111,114,
+99,101,0,116,111,110,102,0,116,111,110,32,102,111,114,99,101,0,108,98,
+109,0,108,98,0,107,105,112,0,49,48,48,48,32,108,98,102,0,107,115,
+105,0,107,105,112,32,47,32,105,110,94,50,0,109,105,108,0,48,46,48,
+48,49,32,105,110,99,104,0,116,104,111,117,0,48,46,48,48,49,32,105,
+110,99,104,0,99,105,114,99,117,108,97,114,105,110,99,104,0,49,124,52,
+32,112,105,32,105,110,94,50,0,99,105,114,99,108,101,105,110,99,104,0,
+99,105,114,99,117,108,97,114,105,110,99,104,0,99,121,108,105,110,100,101,
+114,105,110,99,104,0,99,105,114,99,108,101,105,110,99,104,32,105,110,99,
+104,0,99,105,114,99,117,108,97,114,109,105,108,0,49,124,52,32,112,105,
+32,109,105,108,94,50,0,99,109,105,108,0,99,105,114,99,117,108,97,114,
+109,105,108,0,99,101,110,116,97,108,0,49,48,48,32,112,111,117,110,100,
+0,99,101,110,116,110,101,114,0,99,101,110,116,97,108,0,99,97,108,105,
+98,101,114,0,48,46,48,49,32,105,110,99,104,0,100,117,116,121,0,102,
+116,32,108,98,102,0,99,101,108,111,0,102,116,32,47,32,115,94,50,0,
+106,101,114,107,0,102,116,32,47,32,115,94,51,0,97,117,115,116,114,97,
+108,105,97,112,111,105,110,116,0,48,46,48,49,32,105,110,99,104,0,115,
+97,98,105,110,0,102,116,94,50,0,115,116,97,110,100,97,114,100,103,97,
+117,103,101,0,52,32,102,116,32,43,32,56,46,53,32,105,110,0,102,108,
+97,103,0,53,32,102,116,94,50,0,114,111,108,108,119,97,108,108,112,97,
+112,101,114,0,51,48,32,102,116,94,50,0,102,105,108,108,112,111,119,101,
+114,0,105,110,94,51,32,47,32,111,117,110,99,101,0,112,105,110,108,101,
+110,103,116,104,0,49,124,49,54,32,105,110,99,104,0,98,117,116,116,111,
+110,108,105,110,101,0,49,124,52,48,32,105,110,99,104,0,115,99,111,111,
+112,110,117,109,98,101,114,0,47,113,117,97,114,116,0,98,101,101,115,112,
+97,99,101,0,49,124,52,32,105,110,99,104,0,100,105,97,109,111,110,100,
+0,56,124,53,32,102,116,0,114,101,116,109,97,117,110,105,116,0,49,46,
+55,53,32,105,110,0,85,0,114,101,116,109,97,117,110,105,116,0,82,85,
+0,85,0,69,78,69,82,71,89,0,106,111,117,108,101,0,87,79,82,75,
+0,106,111,117,108,101,0,99,97,108,95,73,84,0,52,46,49,56,54,56,
+32,74,0,99,97,108,95,116,104,0,52,46,49,56,52,32,74,0,99,97,
+108,95,102,105,102,116,101,101,110,0,52,46,49,56,53,56,48,32,74,0,
+99,97,108,95,116,119,101,110,116,121,0,52,46,49,56,49,57,48,32,74,
+0,99,97,108,95,109,101,97,110,0,52,46,49,57,48,48,50,32,74,0,
+99,97,108,111,114,105,101,0,99,97,108,95,73,84,0,99,97,108,0,99,
+97,108,111,114,105,101,0,99,97,108,111,114,105,101,95,73,84,0,99,97,
+108,95,73,84,0,116,104,101,114,109,99,97,108,111,114,105,101,0,99,97,
+108,95,116,104,0,99,97,108,111,114,105,101,95,116,104,0,116,104,101,114,
+109,99,97,108,111,114,105,101,0,67,97,108,111,114,105,101,0,107,105,108,
+111,99,97,108,111,114,105,101,0,116,104,101,114,109,105,101,0,49,101,54,
+32,99,97,108,95,102,105,102,116,101,101,110,0,98,116,117,0,99,97,108,
+32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,75,0,98,114,
+105,116,105,115,104,116,104,101,114,109,97,108,117,110,105,116,0,98,116,117,
+0,98,116,117,95,73,84,0,98,116,117,0,98,116,117,95,116,104,0,99,
+97,108,95,116,104,32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,
+32,75,0,98,116,117,95,109,101,97,110,0,99,97,108,95,109,101,97,110,
+32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,75,0,113,117,
+97,100,0,113,117,97,100,114,105,108,108,105,111,110,32,98,116,117,0,69,
+67,116,104,101,114,109,0,49,46,48,53,53,48,54,101,56,32,74,0,85,
+83,116,104,101,114,109,0,49,46,48,53,52,56,48,52,101,56,32,74,0,
+116,104,101,114,109,0,85,83,116,104,101,114,109,0,116,111,110,111,105,108,
+0,49,101,49,48,32,99,97,108,95,73,84,0,116,111,101,0,116,111,110,
+111,105,108,0,116,111,110,99,111,97,108,0,55,101,57,32,99,97,108,95,
+73,84,0,98,97,114,114,101,108,111,105,108,0,53,46,56,32,77,98,116,
+117,0,110,97,116,117,114,97,108,103,97,115,95,72,72,86,0,49,48,50,
+55,32,98,116,117,47,102,116,51,0,110,97,116,117,114,97,108,103,97,115,
+95,76,72,86,0,57,51,48,32,98,116,117,47,102,116,51,0,110,97,116,
+117,114,97,108,103,97,115,0,110,97,116,117,114,97,108,103,97,115,95,72,
+72,86,0,99,104,97,114,99,111,97,108,0,51,48,32,71,74,47,116,111,
+110,110,101,0,119,111,111,100,101,110,101,114,103,121,95,100,114,121,0,50,
+48,32,71,74,47,116,111,110,110,101,0,119,111,111,100,101,110,101,114,103,
+121,95,97,105,114,100,114,121,0,49,53,32,71,74,47,116,111,110,110,101,
+0,99,111,97,108,95,98,105,116,117,109,105,110,111,117,115,0,50,55,32,
+71,74,32,47,32,116,111,110,110,101,0,99,111,97,108,95,108,105,103,110,
+105,116,101,0,49,53,32,71,74,32,47,32,116,111,110,110,101,0,99,111,
+97,108,95,85,83,0,50,50,32,71,74,32,47,32,116,111,110,0,101,116,
+104,97,110,111,108,95,72,72,86,0,56,52,48,48,48,32,98,116,117,47,
+117,115,103,97,108,108,111,110,0,101,116,104,97,110,111,108,95,76,72,86,
+0,55,53,55,48,48,32,98,116,117,47,117,115,103,97,108,108,111,110,0,
+100,105,101,115,101,108,0,49,51,48,53,48,48,32,98,116,117,47,117,115,
+103,97,108,108,111,110,0,103,97,115,111,108,105,110,101,95,76,72,86,0,
+49,49,53,48,48,48,32,98,116,117,47,117,115,103,97,108,108,111,110,0,
+103,97,115,111,108,105,110,101,95,72,72,86,0,49,50,53,48,48,48,32,
+98,116,117,47,117,115,103,97,108,108,111,110,0,103,97,115,111,108,105,110,
+101,0,103,97,115,111,108,105,110,101,95,72,72,86,0,104,101,97,116,105,
+110,103,0,51,55,46,51,32,77,74,47,108,105,116,101,114,0,102,117,101,
+108,111,105,108,0,51,57,46,55,32,77,74,47,108,105,116,101,114,0,112,
+114,111,112,97,110,101,0,57,51,46,51,32,77,74,47,109,94,51,0,98,
+117,116,97,110,101,0,49,50,52,32,77,74,47,109,94,51,0,117,114,97,
+110,105,117,109,95,112,117,114,101,0,50,48,48,32,77,101,86,32,97,118,
+111,103,97,100,114,111,32,47,32,40,50,51,53,46,48,52,51,57,50,57,
+57,32,103,47,109,111,108,41,0,117,114,97,110,105,117,109,95,110,97,116,
+117,114,97,108,0,48,46,55,37,32,117,114,97,110,105,117,109,95,112,117,
+114,101,0,99,101,108,115,105,117,115,104,101,97,116,117,110,105,116,0,99,
+97,108,32,108,98,32,100,101,103,67,32,47,32,103,114,97,109,32,75,0,
+99,104,117,0,99,101,108,115,105,117,115,104,101,97,116,117,110,105,116,0,
+80,79,87,69,82,0,119,97,116,116,0,117,115,104,111,114,115,101,112,111,
+119,101,114,0,53,53,48,32,102,111,111,116,32,112,111,117,110,100,32,102,
+111,114,99,101,32,47,32,115,101,99,0,104,112,0,104,111,114,115,101,112,
+111,119,101,114,0,109,101,116,114,105,99,104,111,114,115,101,112,111,119,101,
+114,0,55,53,32,107,105,108,111,103,114,97,109,32,102,111,114,99,101,32,
+109,101,116,101,114,32,47,32,115,101,99,0,101,108,101,99,116,114,105,99,
+104,111,114,115,101,112,111,119,101,114,0,55,52,54,32,87,0,98,111,105,
+108,101,114,104,111,114,115,101,112,111,119,101,114,0,57,56,48,57,46,53,
+48,32,87,0,119,97,116,101,114,104,111,114,115,101,112,111,119,101,114,0,
+55,52,54,46,48,52,51,32,87,0,98,114,104,111,114,115,101,112,111,119,
+101,114,0,55,52,53,46,55,48,32,87,0,100,111,110,107,101,121,112,111,
+119,101,114,0,50,53,48,32,87,0,99,104,101,118,97,108,118,97,112,101,
+117,114,0,109,101,116,114,105,99,104,111,114,115,101,112,111,119,101,114,0,
+84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,78,67,69,0,
+80,79,87,69,82,47,65,82,69,65,32,40,84,69,77,80,69,82,65,84,
+85,82,69,95,68,73,70,70,69,82,69,78,67,69,47,76,69,78,71,84,
+72,41,0,84,72,69,82,77,65,76,95,73,78,83,85,76,65,78,67,69,
+0,49,47,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,78,
+67,69,0,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,73,86,
+73,84,89,0,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,
+78,67,69,32,47,32,76,69,78,71,84,72,0,84,72,69,82,77,65,76,
+95,73,78,83,85,76,65,84,73,79,78,0,84,72,69,82,77,65,76,95,
+73,78,83,85,76,65,78,67,69,32,76,69,78,71,84,72,0,82,118,97,
+108,117,101,0,100,101,103,70,32,102,116,94,50,32,104,114,32,47,32,98,
+116,117,0,85,118,97,108,117,101,0,49,47,82,118,97,108,117,101,0,101,
+117,114,111,112,101,97,110,85,118,97,108,117,101,0,119,97,116,116,32,47,
+32,109,94,50,32,75,0,82,83,73,0,100,101,103,67,32,109,94,50,32,
+47,32,87,0,99,108,111,0,48,46,49,53,53,32,100,101,103,67,32,109,
+94,50,32,47,32,87,0,116,111,103,0,48,46,49,32,100,101,103,67,32,
+109,94,50,32,47,32,87,0,69,78,84,82,79,80,89,0,69,78,69,82,
+71,89,32,47,32,84,69,77,80,69,82,65,84,85,82,69,0,99,108,97,
+117,115,105,117,115,0,49,101,51,32,99,97,108,47,75,0,108,97,110,103,
+108,101,121,0,116,104,101,114,109,99,97,108,111,114,105,101,47,99,109,94,
+50,0,112,111,110,99,101,108,101,116,0,49,48,48,32,107,103,32,102,111,
+114,99,101,32,109,32,47,32,115,0,116,111,110,114,101,102,114,105,103,101,
+114,97,116,105,111,110,0,116,111,110,32,49,52,52,32,98,116,117,32,47,
+32,108,98,32,100,97,121,0,116,111,110,114,101,102,0,116,111,110,114,101,
+102,114,105,103,101,114,97,116,105,111,110,0,114,101,102,114,105,103,101,114,
+97,116,105,111,110,0,116,111,110,114,101,102,32,47,32,116,111,110,0,102,
+114,105,103,111,114,105,101,0,49,48,48,48,32,99,97,108,95,102,105,102,
+116,101,101,110,0,116,110,116,0,49,101,57,32,99,97,108,95,116,104,32,
+47,32,116,111,110,0,97,105,114,119,97,116,116,0,56,46,53,32,40,102,
+116,94,51,47,109,105,110,41,32,105,110,72,50,79,0,112,101,114,109,95,
+48,67,0,103,114,97,105,110,32,47,32,104,114,32,102,116,94,50,32,105,
+110,72,103,0,112,101,114,109,95,122,101,114,111,0,112,101,114,109,95,48,
+67,0,112,101,114,109,95,48,0,112,101,114,109,95,48,67,0,112,101,114,
+109,0,112,101,114,109,95,48,67,0,112,101,114,109,95,50,51,67,0,103,
+114,97,105,110,32,47,32,104,114,32,102,116,94,50,32,105,110,32,72,103,
+50,51,67,0,112,101,114,109,95,116,119,101,110,116,121,116,104,114,101,101,
+0,112,101,114,109,95,50,51,67,0,112,97,105,114,0,50,0,98,114,97,
+99,101,0,50,0,110,101,115,116,0,51,0,104,97,116,116,114,105,99,107,
+0,51,0,100,105,99,107,101,114,0,49,48,0,100,111,122,101,110,0,49,
+50,0,98,97,107,101,114,115,100,111,122,101,110,0,49,51,0,115,99,111,
+114,101,0,50,48,0,102,108,111,99,107,0,52,48,0,116,105,109,101,114,
+0,52,48,0,115,104,111,99,107,0,54,48,0,116,111,110,99,111,117,110,
+116,0,49,48,48,0,108,111,110,103,104,117,110,100,114,101,100,0,49,50,
+48,0,103,114,111,115,115,0,49,52,52,0,103,114,101,97,116,103,114,111,
+115,115,0,49,50,32,103,114,111,115,115,0,116,105,116,104,101,0,49,124,
+49,48,0,115,104,111,114,116,113,117,105,114,101,0,50,52,0,113,117,105,
+114,101,0,50,53,0,115,104,111,114,116,114,101,97,109,0,52,56,48,0,
+114,101,97,109,0,53,48,48,0,112,101,114,102,101,99,116,114,101,97,109,
+0,53,49,54,0,98,117,110,100,108,101,0,50,32,114,101,97,109,115,0,
+98,97,108,101,0,53,32,98,117,110,100,108,101,115,0,108,101,116,116,101,
+114,115,105,122,101,0,56,46,53,32,105,110,99,104,32,49,49,32,105,110,
+99,104,0,108,101,103,97,108,115,105,122,101,0,56,46,53,32,105,110,99,
+104,32,49,52,32,105,110,99,104,0,108,101,100,103,101,114,115,105,122,101,
+0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,104,0,101,120,101,
+99,117,116,105,118,101,115,105,122,101,0,55,46,50,53,32,105,110,99,104,
+32,49,48,46,53,32,105,110,99,104,0,65,112,97,112,101,114,0,56,46,
+53,32,105,110,99,104,32,49,49,32,105,110,99,104,0,66,112,97,112,101,
+114,0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,104,0,67,112,
+97,112,101,114,0,49,55,32,105,110,99,104,32,50,50,32,105,110,99,104,
+0,68,112,97,112,101,114,0,50,50,32,105,110,99,104,32,51,52,32,105,
+110,99,104,0,69,112,97,112,101,114,0,51,52,32,105,110,99,104,32,52,
+52,32,105,110,99,104,0,112,111,105,110,116,116,104,105,99,107,110,101,115,
+115,0,109,105,108,0,65,48,112,97,112,101,114,0,56,52,49,32,109,109,
+32,49,49,56,57,32,109,109,0,65,49,112,97,112,101,114,0,53,57,52,
+32,109,109,32,32,56,52,49,32,109,109,0,65,50,112,97,112,101,114,0,
+52,50,48,32,109,109,32,32,53,57,52,32,109,109,0,65,51,112,97,112,
+101,114,0,50,57,55,32,109,109,32,32,52,50,48,32,109,109,0,65,52,
+112,97,112,101,114,0,50,49,48,32,109,109,32,32,50,57,55,32,109,109,
+0,65,53,112,97,112,101,114,0,49,52,56,32,109,109,32,32,50,49,48,
+32,109,109,0,65,54,112,97,112,101,114,0,49,48,53,32,109,109,32,32,
+49,52,56,32,109,109,0,65,55,112,97,112,101,114,0,55,52,32,109,109,
+32,32,49,48,53,32,109,109,0,65,56,112,97,112,101,114,0,53,50,32,
+109,109,32,32,32,55,52,32,109,109,0,65,57,112,97,112,101,114,0,51,
+55,32,109,109,32,32,32,53,50,32,109,109,0,65,49,48,112,97,112,101,
+114,0,50,54,32,109,109,32,32,32,51,55,32,109,109,0,66,48,112,97,
+112,101,114,0,49,48,48,48,32,109,109,32,49,52,49,52,32,109,109,0,
+66,49,112,97,112,101,114,0,55,48,55,32,109,109,32,49,48,48,48,32,
+109,109,0,66,50,112,97,112,101,114,0,53,48,48,32,109,109,32,32,55,
+48,55,32,109,109,0,66,51,112,97,112,101,114,0,51,53,51,32,109,109,
+32,32,53,48,48,32,109,109,0,66,52,112,97,112,101,114,0,50,53,48,
+32,109,109,32,32,51,53,51,32,109,109,0,66,53,112,97,112,101,114,0,
+49,55,54,32,109,109,32,32,50,53,48,32,109,109,0,66,54,112,97,112,
+101,114,0,49,50,53,32,109,109,32,32,49,55,54,32,109,109,0,66,55,
+112,97,112,101,114,0,56,56,32,109,109,32,32,49,50,53,32,109,109,0,
+66,56,112,97,112,101,114,0,54,50,32,109,109,32,32,32,56,56,32,109,
+109,0,66,57,112,97,112,101,114,0,52,52,32,109,109,32,32,32,54,50,
+32,109,109,0,66,49,48,112,97,112,101,114,0,51,49,32,109,109,32,32,
+32,52,52,32,109,109,0,67,48,112,97,112,101,114,0,57,49,55,32,109,
+109,32,49,50,57,55,32,109,109,0,67,49,112,97,112,101,114,0,54,52,
+56,32,109,109,32,32,57,49,55,32,109,109,0,67,50,112,97,112,101,114,
+0,52,53,56,32,109,109,32,32,54,52,56,32,109,109,0,67,51,112,97,
+112,101,114,0,51,50,52,32,109,109,32,32,52,53,56,32,109,109,0,67,
+52,112,97,112,101,114,0,50,50,57,32,109,109,32,32,51,50,52,32,109,
+109,0,67,53,112,97,112,101,114,0,49,54,50,32,109,109,32,32,50,50,
+57,32,109,109,0,67,54,112,97,112,101,114,0,49,49,52,32,109,109,32,
+32,49,54,50,32,109,109,0,67,55,112,97,112,101,114,0,56,49,32,109,
+109,32,32,49,49,52,32,109,109,0,67,56,112,97,112,101,114,0,53,55,
+32,109,109,32,32,32,56,49,32,109,109,0,67,57,112,97,112,101,114,0,
+52,48,32,109,109,32,32,32,53,55,32,109,109,0,67,49,48,112,97,112,
+101,114,0,50,56,32,109,109,32,32,32,52,48,32,109,109,0,103,115,109,
+0,103,114,97,109,115,32,47,32,109,101,116,101,114,94,50,0,112,111,117,
+110,100,98,111,111,107,112,97,112,101,114,0,108,98,32,47,32,50,53,32,
+105,110,99,104,32,51,56,32,105,110,99,104,32,114,101,97,109,0,108,98,
+98,111,111,107,0,112,111,117,110,100,98,111,111,107,112,97,112,101,114,0,
+112,111,117,110,100,116,101,120,116,112,97,112,101,114,0,112,111,117,110,100,
+98,111,111,107,112,97,112,101,114,0,108,98,116,101,120,116,0,112,111,117,
+110,100,116,101,120,116,112,97,112,101,114,0,112,111,117,110,100,111,102,102,
+115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,111,111,107,112,97,
+112,101,114,0,108,98,111,102,102,115,101,116,0,112,111,117,110,100,111,102,
+102,115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,105,98,108,101,
+112,97,112,101,114,0,112,111,117,110,100,98,111,111,107,112,97,112,101,114,
+0,108,98,98,105,98,108,101,0,112,111,117,110,100,98,105,98,108,101,112,
+97,112,101,114,0,112,111,117,110,100,116,97,103,112,97,112,101,114,0,108,
+98,32,47,32,50,52,32,105,110,99,104,32,51,54,32,105,110,99,104,32,
+114,101,97,109,0,108,98,116,97,103,0,112,111,117,110,100,116,97,103,112,
+97,112,101,114,0,112,111,117,110,100,98,97,103,112,97,112,101,114,0,112,
+111,117,110,100,116,97,103,112,97,112,101,114,0,108,98,98,97,103,0,112,
+111,117,110,100,98,97,103,112,97,112,101,114,0,112,111,117,110,100,110,101,
+119,115,112,114,105,110,116,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,110,101,119,115,112,114,105,110,116,0,112,
+111,117,110,100,110,101,119,115,112,114,105,110,116,112,97,112,101,114,0,112,
+111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,112,111,117,110,
+100,116,97,103,112,97,112,101,114,0,108,98,112,111,115,116,101,114,0,112,
+111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,112,111,117,110,
+100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,116,105,115,115,117,101,0,112,111,117,110,
+100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,110,100,119,114,
+97,112,112,105,110,103,112,97,112,101,114,0,112,111,117,110,100,116,97,103,
+112,97,112,101,114,0,108,98,119,114,97,112,112,105,110,103,0,112,111,117,
+110,100,119,114,97,112,112,105,110,103,112,97,112,101,114,0,112,111,117,110,
+100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,110,100,116,97,
+103,112,97,112,101,114,0,108,98,119,97,120,105,110,103,0,112,111,117,110,
+100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,110,100,103,108,
+97,115,115,105,110,101,112,97,112,101,114,0,112,111,117,110,100,116,97,103,
+112,97,112,101,114,0,108,98,103,108,97,115,115,105,110,101,0,112,111,117,
+110,100,103,108,97,115,115,105,110,101,112,97,112,101,114,0,112,111,117,110,
+100,99,111,118,101,114,112,97,112,101,114,0,108,98,32,47,32,50,48,32,
+105,110,99,104,32,50,54,32,105,110,99,104,32,114,101,97,109,0,108,98,
+99,111,118,101,114,0,112,111,117,110,100,99,111,118,101,114,112,97,112,101,
+114,0,112,111,117,110,100,105,110,100,101,120,112,97,112,101,114,0,108,98,
+32,47,32,50,53,46,53,32,105,110,99,104,32,51,48,46,53,32,105,110,
+99,104,32,114,101,97,109,0,108,98,105,110,100,101,120,0,112,111,117,110,
+100,105,110,100,101,120,112,97,112,101,114,0,112,111,117,110,100,105,110,100,
+101,120,98,114,105,115,116,111,108,112,97,112,101,114,0,112,111,117,110,100,
+105,110,100,101,120,112,97,112,101,114,0,108,98,105,110,100,101,120,98,114,
+105,115,116,111,108,0,112,111,117,110,100,105,110,100,101,120,112,97,112,101,
+114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,32,
+47,32,49,55,32,105,110,99,104,32,50,50,32,105,110,99,104,32,114,101,
+97,109,0,108,98,98,111,110,100,0,112,111,117,110,100,98,111,110,100,112,
+97,112,101,114,0,112,111,117,110,100,119,114,105,116,105,110,103,112,97,112,
+101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,
+119,114,105,116,105,110,103,0,112,111,117,110,100,119,114,105,116,105,110,103,
+112,97,112,101,114,0,112,111,117,110,100,108,101,100,103,101,114,112,97,112,
+101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,
+108,101,100,103,101,114,0,112,111,117,110,100,108,101,100,103,101,114,112,97,
+112,101,114,0,112,111,117,110,100,99,111,112,121,112,97,112,101,114,0,112,
+111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,99,111,112,121,
+0,112,111,117,110,100,99,111,112,121,112,97,112,101,114,0,112,111,117,110,
+100,98,108,111,116,116,105,110,103,112,97,112,101,114,0,108,98,32,47,32,
+49,57,32,105,110,99,104,32,50,52,32,105,110,99,104,32,114,101,97,109,
+0,108,98,98,108,111,116,116,105,110,103,0,112,111,117,110,100,98,108,111,
+116,116,105,110,103,112,97,112,101,114,0,112,111,117,110,100,98,108,97,110,
+107,115,112,97,112,101,114,0,108,98,32,47,32,50,50,32,105,110,99,104,
+32,50,56,32,105,110,99,104,32,114,101,97,109,0,108,98,98,108,97,110,
+107,115,0,112,111,117,110,100,98,108,97,110,107,115,112,97,112,101,114,0,
+112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,108,
+98,32,47,32,50,50,46,53,32,105,110,99,104,32,50,56,46,53,32,105,
+110,99,104,32,114,101,97,109,0,108,98,112,111,115,116,99,97,114,100,0,
+112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,112,
+111,117,110,100,119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,
+111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,114,0,108,98,
+119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,111,117,110,100,
+119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,111,117,110,100,
+98,114,105,115,116,111,108,112,97,112,101,114,0,112,111,117,110,100,119,101,
+100,100,105,110,103,98,114,105,115,116,111,108,0,108,98,98,114,105,115,116,
+111,108,0,112,111,117,110,100,98,114,105,115,116,111,108,112,97,112,101,114,
+0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,108,98,32,47,32,
+49,48,48,48,32,102,116,94,50,0,108,98,98,111,120,98,111,97,114,100,
+0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,112,111,117,110,100,
+112,97,112,101,114,98,111,97,114,100,0,112,111,117,110,100,98,111,120,98,
+111,97,114,100,0,108,98,112,97,112,101,114,98,111,97,114,100,0,112,111,
+117,110,100,112,97,112,101,114,98,111,97,114,100,0,112,97,112,101,114,77,
+0,108,98,32,47,32,49,48,48,48,0,112,97,112,101,114,100,101,110,115,
+105,116,121,0,48,46,56,32,103,47,99,109,94,51,0,112,97,112,101,114,
+99,97,108,105,112,101,114,0,105,110,32,112,97,112,101,114,100,101,110,115,
+105,116,121,0,112,97,112,101,114,112,111,105,110,116,0,48,46,48,48,49,
+32,105,110,32,112,97,112,101,114,100,101,110,115,105,116,121,0,102,111,117,
+114,110,105,101,114,112,111,105,110,116,0,48,46,49,54,52,56,32,105,110,
+99,104,32,47,32,49,50,0,111,108,100,100,105,100,111,116,112,111,105,110,
+116,0,49,124,55,50,32,102,114,101,110,99,104,105,110,99,104,0,98,101,
+114,116,104,111,108,100,112,111,105,110,116,0,49,124,50,54,54,48,32,109,
+0,73,78,112,111,105,110,116,0,48,46,52,32,109,109,0,103,101,114,109,
+97,110,100,105,100,111,116,112,111,105,110,116,0,48,46,51,55,54,48,54,
+53,32,109,109,0,109,101,116,114,105,99,112,111,105,110,116,0,51,124,56,
+32,109,109,0,111,108,100,112,111,105,110,116,0,49,124,55,50,46,50,55,
+32,105,110,99,104,0,112,114,105,110,116,101,114,115,112,111,105,110,116,0,
+111,108,100,112,111,105,110,116,0,116,101,120,112,111,105,110,116,0,111,108,
+100,112,111,105,110,116,0,116,101,120,115,99,97,108,101,100,112,111,105,110,
+116,0,49,124,54,53,53,51,54,32,116,101,120,112,111,105,110,116,0,116,
+101,120,115,112,0,116,101,120,115,99,97,108,101,100,112,111,105,110,116,0,
+99,111,109,112,117,116,101,114,112,111,105,110,116,0,49,124,55,50,32,105,
+110,99,104,0,112,111,105,110,116,0,99,111,109,112,117,116,101,114,112,111,
+105,110,116,0,99,111,109,112,117,116,101,114,112,105,99,97,0,49,50,32,
+99,111,109,112,117,116,101,114,112,111,105,110,116,0,112,111,115,116,115,99,
+114,105,112,116,112,111,105,110,116,0,99,111,109,112,117,116,101,114,112,111,
+105,110,116,0,112,115,112,111,105,110,116,0,112,111,115,116,115,99,114,105,
+112,116,112,111,105,110,116,0,116,119,105,112,0,49,124,50,48,32,112,111,
+105,110,116,0,81,0,49,124,52,32,109,109,0,102,114,101,110,99,104,112,
+114,105,110,116,101,114,115,112,111,105,110,116,0,111,108,100,100,105,100,111,
+116,112,111,105,110,116,0,100,105,100,111,116,112,111,105,110,116,0,103,101,
+114,109,97,110,100,105,100,111,116,112,111,105,110,116,0,101,117,114,111,112,
+101,97,110,112,111,105,110,116,0,100,105,100,111,116,112,111,105,110,116,0,
+99,105,99,101,114,111,0,49,50,32,100,105,100,111,116,112,111,105,110,116,
+0,115,116,105,99,107,0,50,32,105,110,99,104,101,115,0,101,120,99,101,
+108,115,105,111,114,0,51,32,111,108,100,112,111,105,110,116,0,98,114,105,
+108,108,105,97,110,116,0,51,46,53,32,111,108,100,112,111,105,110,116,0,
+100,105,97,109,111,110,100,116,121,112,101,0,52,32,111,108,100,112,111,105,
+110,116,0,112,101,97,114,108,0,53,32,111,108,100,112,111,105,110,116,0,
+97,103,97,116,101,0,53,46,53,32,111,108,100,112,111,105,110,116,0,114,
+117,98,121,0,97,103,97,116,101,0,110,111,110,112,97,114,101,105,108,0,
+54,32,111,108,100,112,111,105,110,116,0,109,105,103,110,111,110,101,116,116,
+101,0,54,46,53,32,111,108,100,112,111,105,110,116,0,101,109,101,114,97,
+108,100,0,109,105,103,110,111,110,101,116,116,101,0,109,105,110,105,111,110,
+0,55,32,111,108,100,112,111,105,110,116,0,98,114,101,118,105,101,114,0,
+56,32,111,108,100,112,111,105,110,116,0,98,111,117,114,103,101,111,105,115,
+0,57,32,111,108,100,112,111,105,110,116,0,108,111,110,103,112,114,105,109,
+101,114,0,49,48,32,111,108,100,112,111,105,110,116,0,115,109,97,108,108,
+112,105,99,97,0,49,49,32,111,108,100,112,111,105,110,116,0,112,105,99,
+97,0,49,50,32,111,108,100,112,111,105,110,116,0,101,110,103,108,105,115,
+104,0,49,52,32,111,108,100,112,111,105,110,116,0,99,111,108,117,109,98,
+105,97,110,0,49,54,32,111,108,100,112,111,105,110,116,0,103,114,101,97,
+116,112,114,105,109,101,114,0,49,56,32,111,108,100,112,111,105,110,116,0,
+112,97,114,97,103,111,110,0,50,48,32,111,108,100,112,111,105,110,116,0,
+109,101,114,105,100,105,97,110,0,52,52,32,111,108,100,112,111,105,110,116,
+0,99,97,110,111,110,0,52,56,32,111,108,100,112,111,105,110,116,0,110,
+111,110,112,108,117,115,117,108,116,114,97,0,50,32,100,105,100,111,116,112,
+111,105,110,116,0,98,114,105,108,108,97,110,116,0,51,32,100,105,100,111,
+116,112,111,105,110,116,0,100,105,97,109,97,110,116,0,52,32,100,105,100,
+111,116,112,111,105,110,116,0,112,101,114,108,0,53,32,100,105,100,111,116,
+112,111,105,110,116,0,110,111,110,112,97,114,101,105,108,108,101,0,54,32,
+100,105,100,111,116,112,111,105,110,116,0,107,111,108,111,110,101,108,0,55,
+32,100,105,100,111,116,112,111,105,110,116,0,112,101,116,105,116,0,56,32,
+100,105,100,111,116,112,111,105,110,116,0,98,111,114,103,105,115,0,57,32,
+100,105,100,111,116,112,111,105,110,116,0,107,111,114,112,117,115,0,49,48,
+32,100,105,100,111,116,112,111,105,110,116,0,99,111,114,112,117,115,0,107,
+111,114,112,117,115,0,103,97,114,97,109,111,110,100,0,107,111,114,112,117,
+115,0,109,105,116,116,101,108,0,49,52,32,100,105,100,111,116,112,111,105,
+110,116,0,116,101,114,116,105,97,0,49,54,32,100,105,100,111,116,112,111,
+105,110,116,0,116,101,120,116,0,49,56,32,100,105,100,111,116,112,111,105,
+110,116,0,107,108,101,105,110,101,95,107,97,110,111,110,0,51,50,32,100,
+105,100,111,116,112,111,105,110,116,0,107,97,110,111,110,0,51,54,32,100,
+105,100,111,116,112,111,105,110,116,0,103,114,111,98,101,95,107,97,110,111,
+110,0,52,50,32,100,105,100,111,116,112,111,105,110,116,0,109,105,115,115,
+97,108,0,52,56,32,100,105,100,111,116,112,111,105,110,116,0,107,108,101,
+105,110,101,95,115,97,98,111,110,0,55,50,32,100,105,100,111,116,112,111,
+105,110,116,0,103,114,111,98,101,95,115,97,98,111,110,0,56,52,32,100,
+105,100,111,116,112,111,105,110,116,0,73,78,70,79,82,77,65,84,73,79,
+78,0,98,105,116,0,110,97,116,0,108,110,40,50,41,32,98,105,116,115,
+0,104,97,114,116,108,101,121,0,108,111,103,50,40,49,48,41,32,98,105,
+116,115,0,98,112,115,0,98,105,116,47,115,101,99,0,98,121,116,101,0,
+56,32,98,105,116,0,66,0,98,121,116,101,0,111,99,116,101,116,0,56,
+32,98,105,116,115,0,110,121,98,98,108,101,0,52,32,98,105,116,115,0,
+110,105,98,98,108,101,0,110,121,98,98,108,101,0,110,121,112,0,50,32,
+98,105,116,115,0,109,101,103,0,109,101,103,97,98,121,116,101,0,103,105,
+103,0,103,105,103,97,98,121,116,101,0,106,105,102,102,121,0,48,46,48,
+49,32,115,101,99,0,106,105,102,102,105,101,115,0,106,105,102,102,121,0,
+99,100,97,117,100,105,111,115,112,101,101,100,0,52,52,46,49,32,107,72,
+122,32,50,42,49,54,32,98,105,116,115,0,99,100,114,111,109,115,112,101,
+101,100,0,55,53,32,50,48,52,56,32,98,121,116,101,115,32,47,32,115,
+101,99,0,100,118,100,115,112,101,101,100,0,49,51,56,53,32,107,66,47,
+115,0,111,99,116,97,118,101,0,50,0,109,97,106,111,114,115,101,99,111,
+110,100,0,109,117,115,105,99,97,108,102,105,102,116,104,94,50,32,47,32,
+111,99,116,97,118,101,0,109,97,106,111,114,116,104,105,114,100,0,53,124,
+52,0,109,105,110,111,114,116,104,105,114,100,0,54,124,53,0,109,117,115,
+105,99,97,108,102,111,117,114,116,104,0,52,124,51,0,109,117,115,105,99,
+97,108,102,105,102,116,104,0,51,124,50,0,109,97,106,111,114,115,105,120,
+116,104,0,109,117,115,105,99,97,108,102,111,117,114,116,104,32,109,97,106,
+111,114,116,104,105,114,100,0,109,105,110,111,114,115,105,120,116,104,0,109,
+117,115,105,99,97,108,102,111,117,114,116,104,32,109,105,110,111,114,116,104,
+105,114,100,0,109,97,106,111,114,115,101,118,101,110,116,104,0,109,117,115,
+105,99,97,108,102,105,102,116,104,32,109,97,106,111,114,116,104,105,114,100,
+0,109,105,110,111,114,115,101,118,101,110,116,104,0,109,117,115,105,99,97,
+108,102,105,102,116,104,32,109,105,110,111,114,116,104,105,114,100,0,112,121,
+116,104,97,103,111,114,101,97,110,116,104,105,114,100,0,109,97,106,111,114,
+115,101,99,111,110,100,32,109,117,115,105,99,97,108,102,105,102,116,104,94,
+50,32,47,32,111,99,116,97,118,101,0,115,121,110,116,111,110,105,99,99,
+111,109,109,97,0,112,121,116,104,97,103,111,114,101,97,110,116,104,105,114,
+100,32,47,32,109,97,106,111,114,116,104,105,114,100,0,112,121,116,104,97,
+103,111,114,101,97,110,99,111,109,109,97,0,109,117,115,105,99,97,108,102,
+105,102,116,104,94,49,50,32,47,32,111,99,116,97,118,101,94,55,0,115,
+101,109,105,116,111,110,101,0,111,99,116,97,118,101,94,40,49,124,49,50,
+41,0,119,104,111,108,101,110,111,116,101,0,33,0,77,85,83,73,67,65,
+76,95,78,79,84,69,95,76,69,78,71,84,72,0,119,104,111,108,101,110,
+111,116,101,0,104,97,108,102,110,111,116,101,0,49,124,50,32,119,104,111,
+108,101,110,111,116,101,0,113,117,97,114,116,101,114,110,111,116,101,0,49,
+124,52,32,119,104,111,108,101,110,111,116,101,0,101,105,103,104,116,104,110,
+111,116,101,0,49,124,56,32,119,104,111,108,101,110,111,116,101,0,115,105,
+120,116,101,101,110,116,104,110,111,116,101,0,49,124,49,54,32,119,104,111,
+108,101,110,111,116,101,0,116,104,105,114,116,121,115,101,99,111,110,100,110,
+111,116,101,0,49,124,51,50,32,119,104,111,108,101,110,111,116,101,0,115,
+105,120,116,121,102,111,117,114,116,104,110,111,116,101,0,49,124,54,52,32,
+119,104,111,108,101,110,111,116,101,0,100,111,116,116,101,100,0,51,124,50,
+0,100,111,117,98,108,101,100,111,116,116,101,100,0,55,124,52,0,98,114,
+101,118,101,0,100,111,117,98,108,101,119,104,111,108,101,110,111,116,101,0,
+115,101,109,105,98,114,101,118,101,0,119,104,111,108,101,110,111,116,101,0,
+109,105,110,105,109,110,111,116,101,0,104,97,108,102,110,111,116,101,0,99,
+114,111,116,99,104,101,116,0,113,117,97,114,116,101,114,110,111,116,101,0,
+113,117,97,118,101,114,0,101,105,103,104,116,104,110,111,116,101,0,115,101,
+109,105,113,117,97,118,101,114,0,115,105,120,116,101,101,110,116,104,110,111,
+116,101,0,100,101,109,105,115,101,109,105,113,117,97,118,101,114,0,116,104,
+105,114,116,121,115,101,99,111,110,100,110,111,116,101,0,104,101,109,105,100,
+101,109,105,115,101,109,105,113,117,97,118,101,114,0,115,105,120,116,121,102,
+111,117,114,116,104,110,111,116,101,0,115,101,109,105,100,101,109,105,115,101,
+109,105,113,117,97,118,101,114,0,104,101,109,105,100,101,109,105,115,101,109,
+105,113,117,97,118,101,114,0,119,111,111,108,121,97,114,110,114,117,110,0,
+49,54,48,48,32,121,97,114,100,47,112,111,117,110,100,0,121,97,114,110,
+99,117,116,0,51,48,48,32,121,97,114,100,47,112,111,117,110,100,0,99,
+111,116,116,111,110,121,97,114,110,99,111,117,110,116,0,56,52,48,32,121,
+97,114,100,47,112,111,117,110,100,0,108,105,110,101,110,121,97,114,110,99,
+111,117,110,116,0,51,48,48,32,121,97,114,100,47,112,111,117,110,100,0,
+119,111,114,115,116,101,100,121,97,114,110,99,111,117,110,116,0,49,54,56,
+48,32,102,116,47,112,111,117,110,100,0,109,101,116,114,105,99,121,97,114,
+110,99,111,117,110,116,0,109,101,116,101,114,47,103,114,97,109,0,100,101,
+110,105,101,114,0,49,124,57,32,116,101,120,0,109,97,110,99,104,101,115,
+116,101,114,121,97,114,110,110,117,109,98,101,114,0,100,114,97,109,115,47,
+49,48,48,48,32,121,97,114,100,115,0,112,108,105,0,108,98,47,105,110,
+0,116,121,112,112,0,49,48,48,48,32,121,100,47,108,98,0,97,115,98,
+101,115,116,111,115,99,117,116,0,49,48,48,32,121,100,47,108,98,0,116,
+101,120,0,103,114,97,109,32,47,32,107,109,0,100,114,101,120,0,48,46,
+49,32,116,101,120,0,112,111,117,109,97,114,0,108,98,32,47,32,49,101,
+54,32,121,97,114,100,0,115,107,101,105,110,99,111,116,116,111,110,0,56,
+48,42,53,52,32,105,110,99,104,0,99,111,116,116,111,110,98,111,108,116,
+0,49,50,48,32,102,116,0,119,111,111,108,98,111,108,116,0,50,49,48,
+32,102,116,0,98,111,108,116,0,99,111,116,116,111,110,98,111,108,116,0,
+104,101,101,114,0,54,48,48,32,121,97,114,100,115,0,99,117,116,0,51,
+48,48,32,121,97,114,100,115,0,108,101,97,0,51,48,48,32,121,97,114,
+100,115,0,115,97,105,108,109,97,107,101,114,115,121,97,114,100,0,50,56,
+46,53,32,105,110,0,115,97,105,108,109,97,107,101,114,115,111,117,110,99,
+101,0,111,122,32,47,32,115,97,105,108,109,97,107,101,114,115,121,97,114,
+100,32,51,54,32,105,110,99,104,0,115,105,108,107,109,111,109,109,101,0,
+109,111,109,109,101,32,47,32,50,53,32,121,97,114,100,115,32,49,46,52,
+57,32,105,110,99,104,0,115,105,108,107,109,109,0,115,105,108,107,109,111,
+109,109,101,0,109,99,103,0,109,105,99,114,111,103,114,97,109,0,105,117,
+100,105,112,116,104,101,114,105,97,0,54,50,46,56,32,109,105,99,114,111,
+103,114,97,109,0,105,117,112,101,110,105,99,105,108,108,105,110,0,48,46,
+54,32,109,105,99,114,111,103,114,97,109,0,105,117,105,110,115,117,108,105,
+110,0,52,49,46,54,55,32,109,105,99,114,111,103,114,97,109,0,100,114,
+111,112,0,49,124,50,48,32,109,108,0,98,108,111,111,100,117,110,105,116,
+0,52,53,48,32,109,108,0,102,114,101,110,99,104,99,97,116,104,101,116,
+101,114,115,105,122,101,0,49,124,51,32,109,109,0,104,101,99,116,97,114,
+101,0,104,101,99,116,111,97,114,101,0,109,101,103,111,104,109,0,109,101,
+103,97,111,104,109,0,107,105,108,111,104,109,0,107,105,108,111,111,104,109,
+0,109,105,99,114,111,104,109,0,109,105,99,114,111,111,104,109,0,109,101,
+103,97,108,101,114,103,0,109,101,103,97,101,114,103,0,36,0,100,111,108,
+108,97,114,0,109,97,114,107,0,103,101,114,109,97,110,121,109,97,114,107,
+0,98,111,108,105,118,97,114,0,118,101,110,101,122,117,101,108,97,98,111,
+108,105,118,97,114,0,98,111,108,105,118,97,114,102,117,101,114,116,101,0,
+98,111,108,105,118,97,114,0,111,108,100,98,111,108,105,118,97,114,0,49,
+124,49,48,48,48,32,98,111,108,105,118,97,114,0,112,101,115,101,116,97,
+0,115,112,97,105,110,112,101,115,101,116,97,0,114,97,110,100,0,115,111,
+117,116,104,97,102,114,105,99,97,114,97,110,100,0,101,115,99,117,100,111,
+0,112,111,114,116,117,103,97,108,101,115,99,117,100,111,0,103,117,105,108,
+100,101,114,0,110,101,116,104,101,114,108,97,110,100,115,103,117,105,108,100,
+101,114,0,104,111,108,108,97,110,100,103,117,105,108,100,101,114,0,110,101,
+116,104,101,114,108,97,110,100,115,103,117,105,108,100,101,114,0,112,101,115,
+111,0,109,101,120,105,99,111,112,101,115,111,0,121,101,110,0,106,97,112,
+97,110,121,101,110,0,108,105,114,97,0,105,116,97,108,121,108,105,114,97,
+0,114,117,112,101,101,0,105,110,100,105,97,114,117,112,101,101,0,100,114,
+97,99,104,109,97,0,103,114,101,101,99,101,100,114,97,99,104,109,97,0,
+102,114,97,110,99,0,102,114,97,110,99,101,102,114,97,110,99,0,109,97,
+114,107,107,97,0,102,105,110,108,97,110,100,109,97,114,107,107,97,0,98,
+114,105,116,97,105,110,112,111,117,110,100,0,103,114,101,97,116,98,114,105,
+116,97,105,110,112,111,117,110,100,0,112,111,117,110,100,115,116,101,114,108,
+105,110,103,0,98,114,105,116,97,105,110,112,111,117,110,100,0,121,117,97,
+110,0,99,104,105,110,97,121,117,97,110,0,97,117,115,116,114,105,97,115,
+99,104,105,108,108,105,110,103,0,49,124,49,51,46,55,54,48,51,32,101,
+117,114,111,0,98,101,108,103,105,117,109,102,114,97,110,99,0,49,124,52,
+48,46,51,51,57,57,32,101,117,114,111,0,101,115,116,111,110,105,97,107,
+114,111,111,110,0,49,124,49,53,46,54,52,54,54,32,101,117,114,111,0,
+102,105,110,108,97,110,100,109,97,114,107,107,97,0,49,124,53,46,57,52,
+53,55,51,32,101,117,114,111,0,102,114,97,110,99,101,102,114,97,110,99,
+0,49,124,54,46,53,53,57,53,55,32,101,117,114,111,0,103,101,114,109,
+97,110,121,109,97,114,107,0,49,124,49,46,57,53,53,56,51,32,101,117,
+114,111,0,103,114,101,101,99,101,100,114,97,99,104,109,97,0,49,124,51,
+52,48,46,55,53,32,101,117,114,111,0,105,114,101,108,97,110,100,112,117,
+110,116,0,49,124,48,46,55,56,55,53,54,52,32,101,117,114,111,0,105,
+116,97,108,121,108,105,114,97,0,49,124,49,57,51,54,46,50,55,32,101,
+117,114,111,0,108,117,120,101,109,98,111,117,114,103,102,114,97,110,99,0,
+49,124,52,48,46,51,51,57,57,32,101,117,114,111,0,110,101,116,104,101,
+114,108,97,110,100,115,103,117,105,108,100,101,114,0,49,124,50,46,50,48,
+51,55,49,32,101,117,114,111,0,112,111,114,116,117,103,97,108,101,115,99,
+117,100,111,0,49,124,50,48,48,46,52,56,50,32,101,117,114,111,0,115,
+112,97,105,110,112,101,115,101,116,97,0,49,124,49,54,54,46,51,56,54,
+32,101,117,114,111,0,99,121,112,114,117,115,112,111,117,110,100,0,49,124,
+48,46,53,56,53,50,55,52,32,101,117,114,111,0,109,97,108,116,97,108,
+105,114,97,0,49,124,48,46,52,50,57,51,48,48,32,101,117,114,111,0,
+115,108,111,118,101,110,105,97,116,111,108,97,114,0,49,124,50,51,57,46,
+54,52,48,32,101,117,114,111,0,115,108,111,118,97,107,105,97,107,111,114,
+117,110,97,0,49,124,51,48,46,49,50,54,48,32,101,117,114,111,0,117,
+110,105,116,101,100,97,114,97,98,101,109,105,114,97,116,101,115,100,105,114,
+104,97,109,0,48,46,50,55,50,50,32,85,83,36,0,97,102,103,104,97,
+110,105,115,116,97,110,97,102,103,104,97,110,105,0,48,46,48,50,50,50,
+52,32,85,83,36,0,97,108,98,97,110,105,97,108,101,107,0,48,46,48,
+48,57,57,48,50,32,85,83,36,0,97,114,109,101,110,105,97,100,114,97,
+109,0,48,46,48,48,50,54,52,32,85,83,36,0,110,101,116,104,101,114,
+108,97,110,100,115,97,110,116,105,108,108,101,115,103,117,105,108,100,101,114,
+0,48,46,53,53,56,55,32,85,83,36,0,97,110,103,111,108,97,107,119,
+97,110,122,97,0,48,46,48,49,49,48,56,32,85,83,36,0,97,114,103,
+101,110,116,105,110,97,112,101,115,111,0,48,46,50,54,48,51,32,85,83,
+36,0,97,117,115,116,114,97,108,105,97,100,111,108,108,97,114,0,48,46,
+56,56,53,53,32,85,83,36,0,97,114,117,98,97,103,117,105,108,100,101,
+114,115,0,48,46,53,53,56,55,32,85,83,36,0,97,122,101,114,98,97,
+105,106,97,110,110,101,119,109,97,110,97,116,0,49,46,50,52,52,57,32,
+85,83,36,0,98,111,115,110,105,97,109,97,114,107,97,0,48,46,55,48,
+50,56,32,85,83,36,0,98,97,114,98,97,100,111,115,100,111,108,108,97,
+114,0,48,46,52,57,56,56,32,85,83,36,0,98,97,110,103,108,97,100,
+101,115,104,116,97,107,97,0,48,46,48,49,52,52,53,32,85,83,36,0,
+98,117,108,103,97,114,105,97,108,101,118,0,48,46,55,32,85,83,36,0,
+98,97,104,114,97,105,110,100,105,110,97,114,0,50,46,54,53,50,32,85,
+83,36,0,98,117,114,117,110,100,105,102,114,97,110,99,0,48,46,48,48,
+48,56,50,51,32,85,83,36,0,98,101,114,109,117,100,97,100,111,108,108,
+97,114,0,49,32,85,83,36,0,98,114,117,110,101,105,100,111,108,108,97,
+114,0,48,46,55,48,54,54,32,85,83,36,0,98,111,108,105,118,105,97,
+98,111,108,105,118,105,97,110,111,0,48,46,49,52,50,53,32,85,83,36,
+0,98,114,97,122,105,108,114,101,97,108,0,48,46,53,52,48,52,32,85,
+83,36,0,98,97,104,97,109,97,115,100,111,108,108,97,114,0,49,32,85,
+83,36,0,98,104,117,116,97,110,110,103,117,108,116,114,117,109,0,48,46,
+48,50,49,53,49,32,85,83,36,0,98,111,116,115,119,97,110,97,112,117,
+108,97,0,48,46,49,52,53,53,32,85,83,36,0,98,101,108,97,114,117,
+115,114,117,98,108,101,0,48,46,48,48,48,51,52,53,32,85,83,36,0,
+98,101,108,105,122,101,100,111,108,108,97,114,0,48,46,53,49,50,56,32,
+85,83,36,0,99,97,110,97,100,97,100,111,108,108,97,114,0,48,46,57,
+52,52,52,32,85,83,36,0,99,111,110,103,111,102,114,97,110,99,0,48,
+46,48,48,49,48,57,57,32,85,83,36,0,115,119,105,116,122,101,114,108,
+97,110,100,102,114,97,110,99,0,48,46,57,51,57,49,32,85,83,36,0,
+99,104,105,108,101,112,101,115,111,0,48,46,48,48,49,56,55,49,32,85,
+83,36,0,99,104,105,110,97,121,117,97,110,0,48,46,49,52,54,53,32,
+85,83,36,0,99,111,108,111,109,98,105,97,112,101,115,111,0,48,46,48,
+48,48,53,49,49,32,85,83,36,0,99,111,115,116,97,114,105,99,97,99,
+111,108,111,110,0,48,46,48,48,49,56,48,51,32,85,83,36,0,99,117,
+98,97,112,101,115,111,0,49,32,85,83,36,0,99,97,112,101,118,101,114,
+100,101,101,115,99,117,100,111,0,48,46,48,49,51,53,49,32,85,83,36,
+0,99,122,101,99,104,107,111,114,117,110,121,0,53,46,50,55,55,50,32,
+85,83,36,0,100,106,105,98,111,117,116,105,102,114,97,110,99,0,48,46,
+48,48,53,53,57,53,32,85,83,36,0,100,101,110,109,97,114,107,107,114,
+111,110,101,114,0,49,56,46,52,57,56,32,85,83,36,0,100,111,109,105,
+110,105,99,97,110,114,101,112,117,98,108,105,99,112,101,115,111,0,48,46,
+48,50,55,53,53,32,85,83,36,0,97,108,103,101,114,105,97,100,105,110,
+97,114,0,48,46,48,49,51,55,49,32,85,83,36,0,101,103,121,112,116,
+112,111,117,110,100,0,48,46,49,56,50,50,32,85,83,36,0,101,114,105,
+116,114,101,97,110,97,107,102,97,0,48,46,48,54,54,50,50,32,85,83,
+36,0,101,116,104,105,111,112,105,97,98,105,114,114,0,48,46,48,55,52,
+54,57,32,85,83,36,0,101,117,114,111,0,49,46,51,55,55,52,32,85,
+83,36,0,102,105,106,105,100,111,108,108,97,114,0,48,46,53,48,57,57,
+32,85,83,36,0,102,97,108,107,108,97,110,100,105,115,108,97,110,100,115,
+112,111,117,110,100,0,49,46,53,54,50,56,32,85,83,36,0,103,114,101,
+97,116,98,114,105,116,97,105,110,112,111,117,110,100,0,49,46,53,54,50,
+54,32,85,83,36,0,103,101,111,114,103,105,97,108,97,114,105,0,48,46,
+53,56,53,54,32,85,83,36,0,103,104,97,110,97,99,101,100,105,0,48,
+46,55,48,51,32,85,83,36,0,103,105,98,114,97,108,116,97,114,112,111,
+117,110,100,0,49,46,53,54,50,56,32,85,83,36,0,103,97,109,98,105,
+97,100,97,108,97,115,105,0,48,46,48,51,55,51,55,32,85,83,36,0,
+103,117,105,110,101,97,102,114,97,110,99,0,48,46,48,48,48,49,57,57,
+32,85,83,36,0,103,117,97,116,101,109,97,108,97,113,117,101,116,122,97,
+108,0,48,46,49,50,50,49,32,85,83,36,0,103,117,121,97,110,97,100,
+111,108,108,97,114,0,48,46,48,48,52,56,54,50,32,85,83,36,0,104,
+111,110,103,107,111,110,103,100,111,108,108,97,114,0,48,46,49,50,56,55,
+32,85,83,36,0,104,111,110,100,117,114,97,115,108,101,109,112,105,114,97,
+0,48,46,48,53,50,57,50,32,85,83,36,0,99,114,111,97,116,105,97,
+107,117,110,97,0,48,46,49,56,56,51,32,85,83,36,0,104,97,105,116,
+105,103,111,117,114,100,101,115,0,48,46,48,50,53,49,54,32,85,83,36,
+0,104,117,110,103,97,114,121,102,111,114,105,110,116,0,48,46,48,48,53,
+48,55,53,32,85,83,36,0,105,110,100,111,110,101,115,105,97,114,117,112,
+105,97,104,0,48,46,48,49,48,54,56,32,85,83,36,0,105,115,114,97,
+101,108,110,101,119,115,104,101,107,101,108,0,48,46,50,54,54,55,32,85,
+83,36,0,105,110,100,105,97,114,117,112,101,101,0,48,46,48,50,49,53,
+55,32,85,83,36,0,105,114,97,113,100,105,110,97,114,0,48,46,48,48,
+48,56,53,56,32,85,83,36,0,105,114,97,110,114,105,97,108,0,48,46,
+48,48,48,49,48,50,32,85,83,36,0,105,99,101,108,97,110,100,107,114,
+111,110,97,0,48,46,48,48,55,56,50,50,32,85,83,36,0,106,97,109,
+97,105,99,97,100,111,108,108,97,114,0,48,46,48,49,49,50,50,32,85,
+83,36,0,106,111,114,100,97,110,100,105,110,97,114,0,49,46,52,48,56,
+53,32,85,83,36,0,106,97,112,97,110,121,101,110,0,48,46,48,49,49,
+49,32,85,83,36,0,107,101,110,121,97,115,104,105,108,108,105,110,103,0,
+48,46,48,49,51,49,32,85,83,36,0,107,121,114,103,121,122,115,116,97,
+110,115,111,109,0,48,46,48,50,50,51,57,32,85,83,36,0,99,97,109,
+98,111,100,105,97,114,105,101,108,0,48,46,48,48,48,50,52,32,85,83,
+36,0,99,111,109,111,114,111,115,102,114,97,110,99,0,48,46,48,48,50,
+55,57,57,32,85,83,36,0,110,111,114,116,104,107,111,114,101,97,119,111,
+110,0,48,46,48,48,49,49,49,49,32,85,83,36,0,107,117,119,97,105,
+116,100,105,110,97,114,0,51,46,52,54,57,55,32,85,83,36,0,99,97,
+121,109,97,110,105,115,108,97,110,100,115,100,111,108,108,97,114,0,49,46,
+50,49,56,51,32,85,83,36,0,107,97,122,97,107,104,115,116,97,110,116,
+101,110,103,101,0,48,46,48,48,54,55,52,55,32,85,83,36,0,108,97,
+111,115,107,105,112,0,48,46,48,48,48,49,49,56,32,85,83,36,0,108,
+101,98,97,110,111,110,112,111,117,110,100,0,48,46,48,48,48,54,54,54,
+32,85,83,36,0,115,114,105,108,97,110,107,97,114,117,112,101,101,0,48,
+46,48,48,56,55,49,53,32,85,83,36,0,108,105,98,101,114,105,97,100,
+111,108,108,97,114,0,48,46,48,49,52,48,53,32,85,83,36,0,108,101,
+115,111,116,104,111,109,97,108,111,116,105,0,48,46,49,50,57,55,32,85,
+83,36,0,108,105,116,104,117,97,110,105,97,108,105,116,97,105,0,48,46,
+51,57,57,32,85,83,36,0,108,97,116,118,105,97,108,97,116,97,115,0,
+49,46,57,52,50,49,32,85,83,36,0,108,105,98,121,97,100,105,110,97,
+114,0,48,46,55,57,55,55,32,85,83,36,0,109,111,114,111,99,99,111,
+100,105,114,104,97,109,0,48,46,49,50,50,54,32,85,83,36,0,109,111,
+108,100,111,118,97,108,101,117,0,48,46,48,55,56,48,51,32,85,83,36,
+0,109,97,100,97,103,97,115,99,97,114,97,114,105,97,114,121,0,48,46,
+48,48,48,52,54,56,32,85,83,36,0,109,97,99,101,100,111,110,105,97,
+100,101,110,97,114,0,48,46,48,50,50,51,49,32,85,83,36,0,109,121,
+97,110,109,97,114,107,121,97,116,0,48,46,49,53,51,54,32,85,83,36,
+0,109,111,110,103,111,108,105,97,116,117,103,114,105,107,0,48,46,48,48,
+48,54,57,51,32,85,83,36,0,109,97,99,97,117,112,97,116,97,99,97,
+0,48,46,49,50,53,32,85,83,36,0,109,97,117,114,105,116,97,110,105,
+97,111,117,103,117,105,121,97,0,48,46,48,48,51,56,50,52,32,85,83,
+36,0,109,97,117,114,105,116,105,117,115,114,117,112,101,101,0,48,46,48,
+51,50,55,57,32,85,83,36,0,109,97,108,100,105,118,101,115,114,117,102,
+105,121,97,97,0,48,46,48,55,56,49,51,32,85,83,36,0,109,97,108,
+97,119,105,107,119,97,99,104,97,0,48,46,48,48,54,54,51,50,32,85,
+83,36,0,109,101,120,105,99,111,112,101,115,111,0,48,46,48,55,54,51,
+57,32,85,83,36,0,109,97,108,97,121,115,105,97,114,105,110,103,103,105,
+116,0,48,46,50,57,50,49,32,85,83,36,0,109,111,122,97,109,98,105,
+113,117,101,109,101,116,105,99,97,105,0,48,46,48,51,49,54,32,85,83,
+36,0,110,97,109,105,98,105,97,100,111,108,108,97,114,0,48,46,49,50,
+57,54,32,85,83,36,0,110,105,103,101,114,105,97,110,97,105,114,97,0,
+48,46,48,48,54,54,51,49,32,85,83,36,0,110,105,99,97,114,97,103,
+117,97,99,111,114,100,111,98,97,0,48,46,48,52,55,55,32,85,83,36,
+0,110,111,114,119,97,121,107,114,111,110,101,0,48,46,49,54,57,53,32,
+85,83,36,0,110,101,112,97,108,110,101,112,97,108,114,117,112,101,101,0,
+48,46,48,49,51,52,50,32,85,83,36,0,110,101,119,122,101,97,108,97,
+110,100,100,111,108,108,97,114,0,48,46,54,57,54,55,32,85,83,36,0,
+111,109,97,110,114,105,97,108,0,50,46,53,57,55,49,32,85,83,36,0,
+112,97,110,97,109,97,98,97,108,98,111,97,0,49,32,85,83,36,0,112,
+101,114,117,115,111,108,0,48,46,51,52,56,54,32,85,83,36,0,112,97,
+112,117,97,110,101,119,103,117,105,110,101,97,107,105,110,97,0,48,46,51,
+55,53,52,32,85,83,36,0,112,104,105,108,105,112,112,105,110,101,115,112,
+101,115,111,0,48,46,48,50,49,53,55,32,85,83,36,0,112,97,107,105,
+115,116,97,110,114,117,112,101,101,0,48,46,48,49,49,55,57,32,85,83,
+36,0,112,111,108,97,110,100,122,108,111,116,121,0,48,46,51,51,56,57,
+32,85,83,36,0,112,97,114,97,103,117,97,121,103,117,97,114,97,110,105,
+0,48,46,48,48,48,50,49,51,32,85,83,36,0,113,97,116,97,114,114,
+105,97,108,0,48,46,50,55,52,55,32,85,83,36,0,114,111,109,97,110,
+105,97,108,101,117,0,48,46,51,51,51,56,32,85,83,36,0,115,101,114,
+98,105,97,100,105,110,97,114,0,48,46,48,49,51,57,51,32,85,83,36,
+0,114,117,115,115,105,97,114,117,98,108,101,0,48,46,48,51,51,48,52,
+32,85,83,36,0,114,119,97,110,100,97,102,114,97,110,99,0,48,46,48,
+48,49,55,52,53,32,85,83,36,0,115,97,117,100,105,97,114,97,98,105,
+97,114,105,121,97,108,0,48,46,50,54,54,55,32,85,83,36,0,115,111,
+108,111,109,111,110,105,115,108,97,110,100,115,100,111,108,108,97,114,0,48,
+46,49,50,55,51,32,85,83,36,0,115,101,121,99,104,101,108,108,101,115,
+114,117,112,101,101,0,48,46,48,56,55,53,51,32,85,83,36,0,115,117,
+100,97,110,112,111,117,110,100,0,48,46,52,52,54,52,32,85,83,36,0,
+115,119,101,100,101,110,107,114,111,110,111,114,0,49,51,46,55,49,57,32,
+85,83,36,0,115,105,110,103,97,112,111,114,101,100,111,108,108,97,114,0,
+48,46,55,48,54,53,32,85,83,36,0,115,97,105,110,116,104,101,108,101,
+110,97,112,111,117,110,100,0,49,46,53,54,50,55,32,85,83,36,0,115,
+105,101,114,114,97,108,101,111,110,101,108,101,111,110,101,0,48,46,48,48,
+48,50,53,53,32,85,83,36,0,115,111,109,97,108,105,97,115,104,105,108,
+108,105,110,103,0,48,46,48,48,48,54,54,57,32,85,83,36,0,115,117,
+114,105,110,97,109,101,100,111,108,108,97,114,0,48,46,51,54,51,53,32,
+85,83,36,0,115,97,111,116,111,109,101,100,111,98,114,97,0,54,46,52,
+50,55,101,45,48,53,32,85,83,36,0,101,108,115,97,108,118,97,100,111,
+114,99,111,108,111,110,0,48,46,49,49,52,51,32,85,83,36,0,115,121,
+114,105,97,112,111,117,110,100,0,48,46,48,50,49,55,57,32,85,83,36,
+0,115,119,97,122,105,108,97,110,100,101,109,97,108,97,110,103,101,110,105,
+0,48,46,49,50,57,55,32,85,83,36,0,116,104,97,105,108,97,110,100,
+98,97,104,116,0,48,46,48,51,48,49,54,32,85,83,36,0,116,97,106,
+105,107,105,115,116,97,110,115,111,109,111,110,105,0,48,46,50,50,57,32,
+85,83,36,0,116,117,110,105,115,105,97,100,105,110,97,114,0,48,46,55,
+50,55,53,32,85,83,36,0,116,111,110,103,97,112,97,39,97,110,103,97,
+0,48,46,53,49,55,32,85,83,36,0,116,117,114,107,101,121,110,101,119,
+108,105,114,97,0,48,46,54,53,57,55,32,85,83,36,0,116,114,105,110,
+105,100,97,100,97,110,100,116,111,98,97,103,111,100,111,108,108,97,114,0,
+48,46,49,53,55,57,32,85,83,36,0,116,97,105,119,97,110,100,111,108,
+108,97,114,115,0,48,46,48,51,49,49,57,32,85,83,36,0,116,97,110,
+122,97,110,105,97,115,104,105,108,108,105,110,103,0,48,46,48,48,48,55,
+52,49,32,85,83,36,0,117,107,114,97,105,110,101,104,114,121,118,110,105,
+97,0,48,46,49,50,51,57,32,85,83,36,0,117,103,97,110,100,97,115,
+104,105,108,108,105,110,103,0,48,46,48,48,48,53,48,53,32,85,83,36,
+0,117,110,105,116,101,100,115,116,97,116,101,115,100,111,108,108,97,114,0,
+49,32,85,83,36,0,117,114,117,103,117,97,121,112,101,115,111,0,48,46,
+48,53,48,55,57,32,85,83,36,0,117,122,98,101,107,105,115,116,97,110,
+115,117,109,0,48,46,48,48,48,54,53,51,32,85,83,36,0,118,101,110,
+101,122,117,101,108,97,98,111,108,105,118,97,114,0,48,46,50,51,51,32,
+85,83,36,0,118,105,101,116,110,97,109,100,111,110,103,0,53,46,52,101,
+45,48,53,32,85,83,36,0,118,97,110,117,97,116,117,118,97,116,117,0,
+48,46,48,49,48,48,56,32,85,83,36,0,115,97,109,111,97,116,97,108,
+97,0,48,46,51,56,56,53,32,85,83,36,0,115,105,108,118,101,114,111,
+117,110,99,101,0,49,51,46,51,52,52,32,85,83,36,0,103,111,108,100,
+111,117,110,99,101,0,49,48,55,54,46,54,32,85,83,36,0,101,97,115,
+116,99,97,114,105,98,98,101,97,110,100,111,108,108,97,114,0,48,46,51,
+56,50,52,32,85,83,36,0,112,97,108,108,97,100,105,117,109,111,117,110,
+99,101,0,50,48,55,46,52,32,85,83,36,0,112,108,97,116,105,110,117,
+109,111,117,110,99,101,0,49,49,49,55,46,55,32,85,83,36,0,121,101,
+109,101,110,114,105,97,108,0,48,46,48,48,52,56,53,53,32,85,83,36,
+0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,0,48,46,49,
+50,57,55,32,85,83,36,0,122,97,109,98,105,97,107,119,97,99,104,97,
+0,48,46,48,48,48,50,49,52,32,85,83,36,0,122,105,109,98,97,98,
+119,101,100,111,108,108,97,114,0,48,46,48,48,50,54,52,49,32,85,83,
+36,0,65,69,68,0,117,110,105,116,101,100,97,114,97,98,101,109,105,114,
+97,116,101,115,100,105,114,104,97,109,0,65,70,78,0,97,102,103,104,97,
+110,105,115,116,97,110,97,102,103,104,97,110,105,0,65,76,76,0,97,108,
+98,97,110,105,97,108,101,107,0,65,77,68,0,97,114,109,101,110,105,97,
+100,114,97,109,0,65,78,71,0,110,101,116,104,101,114,108,97,110,100,115,
+97,110,116,105,108,108,101,115,103,117,105,108,100,101,114,0,65,79,65,0,
+97,110,103,111,108,97,107,119,97,110,122,97,0,65,82,83,0,97,114,103,
+101,110,116,105,110,97,112,101,115,111,0,65,85,68,0,97,117,115,116,114,
+97,108,105,97,100,111,108,108,97,114,0,65,87,71,0,97,114,117,98,97,
+103,117,105,108,100,101,114,115,0,65,90,78,0,97,122,101,114,98,97,105,
+106,97,110,110,101,119,109,97,110,97,116,0,66,65,77,0,98,111,115,110,
+105,97,109,97,114,107,97,0,66,66,68,0,98,97,114,98,97,100,111,115,
+100,111,108,108,97,114,0,66,68,84,0,98,97,110,103,108,97,100,101,115,
+104,116,97,107,97,0,66,71,78,0,98,117,108,103,97,114,105,97,108,101,
+118,0,66,72,68,0,98,97,104,114,97,105,110,100,105,110,97,114,0,66,
+73,70,0,98,117,114,117,110,100,105,102,114,97,110,99,0,66,77,68,0,
+98,101,114,109,117,100,97,100,111,108,108,97,114,0,66,78,68,0,98,114,
+117,110,101,105,100,111,108,108,97,114,0,66,79,66,0,98,111,108,105,118,
+105,97,98,111,108,105,118,105,97,110,111,0,66,82,76,0,98,114,97,122,
+105,108,114,101,97,108,0,66,83,68,0,98,97,104,97,109,97,115,100,111,
+108,108,97,114,0,66,84,78,0,98,104,117,116,97,110,110,103,117,108,116,
+114,117,109,0,66,87,80,0,98,111,116,115,119,97,110,97,112,117,108,97,
+0,66,89,82,0,98,101,108,97,114,117,115,114,117,98,108,101,0,66,90,
+68,0,98,101,108,105,122,101,100,111,108,108,97,114,0,67,65,68,0,99,
+97,110,97,100,97,100,111,108,108,97,114,0,67,68,70,0,99,111,110,103,
+111,102,114,97,110,99,0,67,72,70,0,115,119,105,116,122,101,114,108,97,
+110,100,102,114,97,110,99,0,67,76,80,0,99,104,105,108,101,112,101,115,
+111,0,67,78,89,0,99,104,105,110,97,121,117,97,110,0,67,79,80,0,
+99,111,108,111,109,98,105,97,112,101,115,111,0,67,82,67,0,99,111,115,
+116,97,114,105,99,97,99,111,108,111,110,0,67,85,80,0,99,117,98,97,
+112,101,115,111,0,67,86,69,0,99,97,112,101,118,101,114,100,101,101,115,
+99,117,100,111,0,67,90,75,0,99,122,101,99,104,107,111,114,117,110,121,
+0,68,74,70,0,100,106,105,98,111,117,116,105,102,114,97,110,99,0,68,
+75,75,0,100,101,110,109,97,114,107,107,114,111,110,101,114,0,68,79,80,
+0,100,111,109,105,110,105,99,97,110,114,101,112,117,98,108,105,99,112,101,
+115,111,0,68,90,68,0,97,108,103,101,114,105,97,100,105,110,97,114,0,
+69,69,75,0,101,115,116,111,110,105,97,107,114,111,111,110,0,69,71,80,
+0,101,103,121,112,116,112,111,117,110,100,0,69,82,78,0,101,114,105,116,
+114,101,97,110,97,107,102,97,0,69,84,66,0,101,116,104,105,111,112,105,
+97,98,105,114,114,0,69,85,82,0,101,117,114,111,0,70,74,68,0,102,
+105,106,105,100,111,108,108,97,114,0,70,75,80,0,102,97,108,107,108,97,
+110,100,105,115,108,97,110,100,115,112,111,117,110,100,0,71,66,80,0,103,
+114,101,97,116,98,114,105,116,97,105,110,112,111,117,110,100,0,71,69,76,
+0,103,101,111,114,103,105,97,108,97,114,105,0,71,72,83,0,103,104,97,
+110,97,99,101,100,105,0,71,73,80,0,103,105,98,114,97,108,116,97,114,
+112,111,117,110,100,0,71,77,68,0,103,97,109,98,105,97,100,97,108,97,
+115,105,0,71,78,70,0,103,117,105,110,101,97,102,114,97,110,99,0,71,
+84,81,0,103,117,97,116,101,109,97,108,97,113,117,101,116,122,97,108,0,
+71,89,68,0,103,117,121,97,110,97,100,111,108,108,97,114,0,72,75,68,
+0,104,111,110,103,107,111,110,103,100,111,108,108,97,114,0,72,78,76,0,
+104,111,110,100,117,114,97,115,108,101,109,112,105,114,97,0,72,82,75,0,
+99,114,111,97,116,105,97,107,117,110,97,0,72,84,71,0,104,97,105,116,
+105,103,111,117,114,100,101,115,0,72,85,70,0,104,117,110,103,97,114,121,
+102,111,114,105,110,116,0,73,68,82,0,105,110,100,111,110,101,115,105,97,
+114,117,112,105,97,104,0,73,76,83,0,105,115,114,97,101,108,110,101,119,
+115,104,101,107,101,108,0,73,78,82,0,105,110,100,105,97,114,117,112,101,
+101,0,73,81,68,0,105,114,97,113,100,105,110,97,114,0,73,82,82,0,
+105,114,97,110,114,105,97,108,0,73,83,75,0,105,99,101,108,97,110,100,
+107,114,111,110,97,0,74,77,68,0,106,97,109,97,105,99,97,100,111,108,
+108,97,114,0,74,79,68,0,106,111,114,100,97,110,100,105,110,97,114,0,
+74,80,89,0,106,97,112,97,110,121,101,110,0,75,69,83,0,107,101,110,
+121,97,115,104,105,108,108,105,110,103,0,75,71,83,0,107,121,114,103,121,
+122,115,116,97,110,115,111,109,0,75,72,82,0,99,97,109,98,111,100,105,
+97,114,105,101,108,0,75,77,70,0,99,111,109,111,114,111,115,102,114,97,
+110,99,0,75,80,87,0,110,111,114,116,104,107,111,114,101,97,119,111,110,
+0,75,87,68,0,107,117,119,97,105,116,100,105,110,97,114,0,75,89,68,
+0,99,97,121,109,97,110,105,115,108,97,110,100,115,100,111,108,108,97,114,
+0,75,90,84,0,107,97,122,97,107,104,115,116,97,110,116,101,110,103,101,
+0,76,65,75,0,108,97,111,115,107,105,112,0,76,66,80,0,108,101,98,
+97,110,111,110,112,111,117,110,100,0,76,75,82,0,115,114,105,108,97,110,
+107,97,114,117,112,101,101,0,76,82,68,0,108,105,98,101,114,105,97,100,
+111,108,108,97,114,0,76,83,76,0,108,101,115,111,116,104,111,109,97,108,
+111,116,105,0,76,84,76,0,108,105,116,104,117,97,110,105,97,108,105,116,
+97,105,0,76,86,76,0,108,97,116,118,105,97,108,97,116,97,115,0,76,
+89,68,0,108,105,98,121,97,100,105,110,97,114,0,77,65,68,0,109,111,
+114,111,99,99,111,100,105,114,104,97,109,0,77,68,76,0,109,111,108,100,
+111,118,97,108,101,117,0,77,71,65,0,109,97,100,97,103,97,115,99,97,
+114,97,114,105,97,114,121,0,77,75,68,0,109,97,99,101,100,111,110,105,
+97,100,101,110,97,114,0,77,77,75,0,109,121,97,110,109,97,114,107,121,
+97,116,0,77,78,84,0,109,111,110,103,111,108,105,97,116,117,103,114,105,
+107,0,77,79,80,0,109,97,99,97,117,112,97,116,97,99,97,0,77,82,
+79,0,109,97,117,114,105,116,97,110,105,97,111,117,103,117,105,121,97,0,
+77,85,82,0,109,97,117,114,105,116,105,117,115,114,117,112,101,101,0,77,
+86,82,0,109,97,108,100,105,118,101,115,114,117,102,105,121,97,97,0,77,
+87,75,0,109,97,108,97,119,105,107,119,97,99,104,97,0,77,88,78,0,
+109,101,120,105,99,111,112,101,115,111,0,77,89,82,0,109,97,108,97,121,
+115,105,97,114,105,110,103,103,105,116,0,77,90,78,0,109,111,122,97,109,
+98,105,113,117,101,109,101,116,105,99,97,105,0,78,65,68,0,110,97,109,
+105,98,105,97,100,111,108,108,97,114,0,78,71,78,0,110,105,103,101,114,
+105,97,110,97,105,114,97,0,78,73,79,0,110,105,99,97,114,97,103,117,
+97,99,111,114,100,111,98,97,0,78,79,75,0,110,111,114,119,97,121,107,
+114,111,110,101,0,78,80,82,0,110,101,112,97,108,110,101,112,97,108,114,
+117,112,101,101,0,78,90,68,0,110,101,119,122,101,97,108,97,110,100,100,
+111,108,108,97,114,0,79,77,82,0,111,109,97,110,114,105,97,108,0,80,
+65,66,0,112,97,110,97,109,97,98,97,108,98,111,97,0,80,69,78,0,
+112,101,114,117,115,111,108,0,80,71,75,0,112,97,112,117,97,110,101,119,
+103,117,105,110,101,97,107,105,110,97,0,80,72,80,0,112,104,105,108,105,
+112,112,105,110,101,115,112,101,115,111,0,80,75,82,0,112,97,107,105,115,
+116,97,110,114,117,112,101,101,0,80,76,78,0,112,111,108,97,110,100,122,
+108,111,116,121,0,80,89,71,0,112,97,114,97,103,117,97,121,103,117,97,
+114,97,110,105,0,81,65,82,0,113,97,116,97,114,114,105,97,108,0,82,
+79,78,0,114,111,109,97,110,105,97,108,101,117,0,82,83,68,0,115,101,
+114,98,105,97,100,105,110,97,114,0,82,85,66,0,114,117,115,115,105,97,
+114,117,98,108,101,0,82,87,70,0,114,119,97,110,100,97,102,114,97,110,
+99,0,83,65,82,0,115,97,117,100,105,97,114,97,98,105,97,114,105,121,
+97,108,0,83,66,68,0,115,111,108,111,109,111,110,105,115,108,97,110,100,
+115,100,111,108,108,97,114,0,83,67,82,0,115,101,121,99,104,101,108,108,
+101,115,114,117,112,101,101,0,83,68,71,0,115,117,100,97,110,112,111,117,
+110,100,0,83,69,75,0,115,119,101,100,101,110,107,114,111,110,111,114,0,
+83,71,68,0,115,105,110,103,97,112,111,114,101,100,111,108,108,97,114,0,
+83,72,80,0,115,97,105,110,116,104,101,108,101,110,97,112,111,117,110,100,
+0,83,76,76,0,115,105,101,114,114,97,108,101,111,110,101,108,101,111,110,
+101,0,83,79,83,0,115,111,109,97,108,105,97,115,104,105,108,108,105,110,
+103,0,83,82,68,0,115,117,114,105,110,97,109,101,100,111,108,108,97,114,
+0,83,84,68,0,115,97,111,116,111,109,101,100,111,98,114,97,0,83,86,
+67,0,101,108,115,97,108,118,97,100,111,114,99,111,108,111,110,0,83,89,
+80,0,115,121,114,105,97,112,111,117,110,100,0,83,90,76,0,115,119,97,
+122,105,108,97,110,100,101,109,97,108,97,110,103,101,110,105,0,84,72,66,
+0,116,104,97,105,108,97,110,100,98,97,104,116,0,84,74,83,0,116,97,
+106,105,107,105,115,116,97,110,115,111,109,111,110,105,0,84,78,68,0,116,
+117,110,105,115,105,97,100,105,110,97,114,0,84,79,80,0,116,111,110,103,
+97,112,97,39,97,110,103,97,0,84,82,89,0,116,117,114,107,101,121,110,
+101,119,108,105,114,97,0,84,84,68,0,116,114,105,110,105,100,97,100,97,
+110,100,116,111,98,97,103,111,100,111,108,108,97,114,0,84,87,68,0,116,
+97,105,119,97,110,100,111,108,108,97,114,115,0,84,90,83,0,116,97,110,
+122,97,110,105,97,115,104,105,108,108,105,110,103,0,85,65,72,0,117,107,
+114,97,105,110,101,104,114,121,118,110,105,97,0,85,71,88,0,117,103,97,
+110,100,97,115,104,105,108,108,105,110,103,0,85,83,68,0,117,110,105,116,
+101,100,115,116,97,116,101,115,100,111,108,108,97,114,0,85,89,85,0,117,
+114,117,103,117,97,121,112,101,115,111,0,85,90,83,0,117,122,98,101,107,
+105,115,116,97,110,115,117,109,0,86,69,70,0,118,101,110,101,122,117,101,
+108,97,98,111,108,105,118,97,114,0,86,78,68,0,118,105,101,116,110,97,
+109,100,111,110,103,0,86,85,86,0,118,97,110,117,97,116,117,118,97,116,
+117,0,87,83,84,0,115,97,109,111,97,116,97,108,97,0,88,65,71,0,
+115,105,108,118,101,114,111,117,110,99,101,0,88,65,85,0,103,111,108,100,
+111,117,110,99,101,0,88,67,68,0,101,97,115,116,99,97,114,105,98,98,
+101,97,110,100,111,108,108,97,114,0,88,80,68,0,112,97,108,108,97,100,
+105,117,109,111,117,110,99,101,0,88,80,84,0,112,108,97,116,105,110,117,
+109,111,117,110,99,101,0,89,69,82,0,121,101,109,101,110,114,105,97,108,
+0,90,65,82,0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,
+0,90,77,75,0,122,97,109,98,105,97,107,119,97,99,104,97,0,90,87,
+68,0,122,105,109,98,97,98,119,101,100,111,108,108,97,114,0,115,105,108,
+118,101,114,112,114,105,99,101,0,115,105,108,118,101,114,111,117,110,99,101,
+32,47,32,116,114,111,121,111,117,110,99,101,0,103,111,108,100,112,114,105,
+99,101,0,103,111,108,100,111,117,110,99,101,32,47,32,116,114,111,121,111,
+117,110,99,101,0,112,97,108,108,97,100,105,117,109,112,114,105,99,101,0,
+112,97,108,108,97,100,105,117,109,111,117,110,99,101,32,47,32,116,114,111,
+121,111,117,110,99,101,0,112,108,97,116,105,110,117,109,112,114,105,99,101,
+0,112,108,97,116,105,110,117,109,111,117,110,99,101,32,47,32,116,114,111,
+121,111,117,110,99,101,0,85,75,80,0,71,66,80,0,86,69,66,0,49,
+124,49,48,48,48,32,86,69,70,0,111,108,100,100,111,108,108,97,114,103,
+111,108,100,0,50,51,46,50,50,32,103,114,97,105,110,115,32,103,111,108,
+100,112,114,105,99,101,0,110,101,119,100,111,108,108,97,114,103,111,108,100,
+0,57,54,124,55,32,103,114,97,105,110,115,32,103,111,108,100,112,114,105,
+99,101,0,100,111,108,108,97,114,103,111,108,100,0,110,101,119,100,111,108,
+108,97,114,103,111,108,100,0,112,111,117,110,100,103,111,108,100,0,49,49,
+51,32,103,114,97,105,110,115,32,103,111,108,100,112,114,105,99,101,0,85,
+83,112,101,110,110,121,119,101,105,103,104,116,0,50,46,53,32,103,114,97,
+109,115,0,85,83,110,105,99,107,101,108,119,101,105,103,104,116,0,53,32,
+103,114,97,109,115,0,85,83,100,105,109,101,119,101,105,103,104,116,0,49,
+48,32,99,101,110,116,115,32,47,32,40,50,48,32,85,83,36,32,47,32,
+108,98,41,0,85,83,113,117,97,114,116,101,114,119,101,105,103,104,116,0,
+50,53,32,99,101,110,116,115,32,47,32,40,50,48,32,85,83,36,32,47,
+32,108,98,41,0,85,83,104,97,108,102,100,111,108,108,97,114,119,101,105,
+103,104,116,0,53,48,32,99,101,110,116,115,32,47,32,40,50,48,32,85,
+83,36,32,47,32,108,98,41,0,85,83,100,111,108,108,97,114,109,97,115,
+115,0,56,46,49,32,103,114,97,109,115,0,113,117,105,100,0,98,114,105,
+116,97,105,110,112,111,117,110,100,0,102,105,118,101,114,0,53,32,113,117,
+105,100,0,116,101,110,110,101,114,0,49,48,32,113,117,105,100,0,109,111,
+110,107,101,121,0,53,48,48,32,113,117,105,100,0,98,114,103,114,97,110,
+100,0,49,48,48,48,32,113,117,105,100,0,98,111,98,0,115,104,105,108,
+108,105,110,103,0,115,104,105,108,108,105,110,103,0,49,124,50,48,32,98,
+114,105,116,97,105,110,112,111,117,110,100,0,111,108,100,112,101,110,99,101,
+0,49,124,49,50,32,115,104,105,108,108,105,110,103,0,102,97,114,116,104,
+105,110,103,0,49,124,52,32,111,108,100,112,101,110,99,101,0,103,117,105,
+110,101,97,0,50,49,32,115,104,105,108,108,105,110,103,0,99,114,111,119,
+110,0,53,32,115,104,105,108,108,105,110,103,0,102,108,111,114,105,110,0,
+50,32,115,104,105,108,108,105,110,103,0,103,114,111,97,116,0,52,32,111,
+108,100,112,101,110,99,101,0,116,97,110,110,101,114,0,54,32,111,108,100,
+112,101,110,99,101,0,98,114,112,101,110,110,121,0,48,46,48,49,32,98,
+114,105,116,97,105,110,112,111,117,110,100,0,112,101,110,99,101,0,98,114,
+112,101,110,110,121,0,116,117,112,112,101,110,99,101,0,50,32,112,101,110,
+99,101,0,116,117,112,112,101,110,110,121,0,116,117,112,112,101,110,99,101,
+0,104,97,39,112,101,110,110,121,0,104,97,108,102,98,114,112,101,110,110,
+121,0,104,97,112,101,110,110,121,0,104,97,39,112,101,110,110,121,0,111,
+108,100,112,101,110,110,121,0,111,108,100,112,101,110,99,101,0,111,108,100,
+116,117,112,112,101,110,99,101,0,50,32,111,108,100,112,101,110,99,101,0,
+111,108,100,116,117,112,112,101,110,110,121,0,111,108,100,116,117,112,112,101,
+110,99,101,0,116,104,114,101,101,112,101,110,99,101,0,51,32,111,108,100,
+112,101,110,99,101,0,116,104,114,101,101,112,101,110,110,121,0,116,104,114,
+101,101,112,101,110,99,101,0,111,108,100,116,104,114,101,101,112,101,110,99,
+101,0,116,104,114,101,101,112,101,110,99,101,0,111,108,100,116,104,114,101,
+101,112,101,110,110,121,0,116,104,114,101,101,112,101,110,99,101,0,111,108,
+100,104,97,108,102,112,101,110,110,121,0,104,97,108,102,111,108,100,112,101,
+110,110,121,0,111,108,100,104,97,39,112,101,110,110,121,0,111,108,100,104,
+97,108,102,112,101,110,110,121,0,111,108,100,104,97,112,101,110,110,121,0,
+111,108,100,104,97,39,112,101,110,110,121,0,98,114,112,111,110,121,0,50,
+53,32,98,114,105,116,97,105,110,112,111,117,110,100,0,108,111,111,110,121,
+0,49,32,99,97,110,97,100,97,100,111,108,108,97,114,0,116,111,111,110,
+121,0,50,32,99,97,110,97,100,97,100,111,108,108,97,114,0,99,111,114,
+100,0,52,42,52,42,56,32,102,116,94,51,0,102,97,99,101,99,111,114,
+100,0,49,124,50,32,99,111,114,100,0,99,111,114,100,102,111,111,116,0,
+49,124,56,32,99,111,114,100,0,99,111,114,100,102,101,101,116,0,99,111,
+114,100,102,111,111,116,0,104,111,117,115,101,99,111,114,100,0,49,124,51,
+32,99,111,114,100,0,98,111,97,114,100,102,111,111,116,0,102,116,94,50,
+32,105,110,99,104,0,98,111,97,114,100,102,101,101,116,0,98,111,97,114,
+100,102,111,111,116,0,102,98,109,0,98,111,97,114,100,102,111,111,116,0,
+115,116,97,99,107,0,52,32,121,97,114,100,94,51,0,114,105,99,107,0,
+52,32,102,116,32,56,32,102,116,32,49,54,32,105,110,99,104,101,115,0,
+115,116,101,114,101,0,109,94,51,0,116,105,109,98,101,114,102,111,111,116,
+0,102,116,94,51,0,115,116,97,110,100,97,114,100,0,49,50,48,32,49,
+50,32,102,116,32,49,49,32,105,110,32,49,46,53,32,105,110,0,100,101,
+97,108,0,49,50,32,102,116,32,49,49,32,105,110,32,50,46,53,32,105,
+110,0,119,104,111,108,101,100,101,97,108,0,49,50,32,102,116,32,49,49,
+32,105,110,32,49,46,50,53,32,105,110,0,115,112,108,105,116,100,101,97,
+108,0,49,50,32,102,116,32,49,49,32,105,110,32,53,124,56,32,105,110,
+0,70,76,85,73,68,95,70,76,79,87,0,86,79,76,85,77,69,32,47,
+32,84,73,77,69,0,99,117,109,101,99,0,109,94,51,47,115,0,99,117,
+115,101,99,0,102,116,94,51,47,115,0,103,112,104,0,103,97,108,47,104,
+114,0,103,112,109,0,103,97,108,47,109,105,110,0,109,103,100,0,109,101,
+103,97,103,97,108,47,100,97,121,0,99,102,115,0,102,116,94,51,47,115,
+0,99,102,104,0,102,116,94,51,47,104,111,117,114,0,99,102,109,0,102,
+116,94,51,47,109,105,110,0,108,112,109,0,108,105,116,101,114,47,109,105,
+110,0,108,102,109,0,102,116,47,109,105,110,0,112,114,117,0,109,109,72,
+103,32,47,32,40,109,108,47,109,105,110,41,0,109,105,110,101,114,115,105,
+110,99,104,65,90,0,49,46,53,32,102,116,94,51,47,109,105,110,0,109,
+105,110,101,114,115,105,110,99,104,67,65,0,49,46,53,32,102,116,94,51,
+47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,77,84,0,49,46,
+53,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,
+104,78,86,0,49,46,53,32,102,116,94,51,47,109,105,110,0,109,105,110,
+101,114,115,105,110,99,104,79,82,0,49,46,53,32,102,116,94,51,47,109,
+105,110,0,109,105,110,101,114,115,105,110,99,104,73,68,0,49,46,50,32,
+102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,75,
+83,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,
+115,105,110,99,104,78,69,0,49,46,50,32,102,116,94,51,47,109,105,110,
+0,109,105,110,101,114,115,105,110,99,104,78,77,0,49,46,50,32,102,116,
+94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,78,68,0,
+49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,
+110,99,104,83,68,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,
+105,110,101,114,115,105,110,99,104,85,84,0,49,46,50,32,102,116,94,51,
+47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,67,79,0,49,32,
+102,116,94,51,47,115,101,99,32,47,32,51,56,46,52,0,109,105,110,101,
+114,115,105,110,99,104,66,67,0,49,46,54,56,32,102,116,94,51,47,109,
+105,110,0,115,118,101,114,100,114,117,112,0,49,101,54,32,109,94,51,32,
+47,32,115,101,99,0,71,65,83,95,70,76,79,87,0,80,82,69,83,83,
+85,82,69,32,70,76,85,73,68,95,70,76,79,87,0,115,99,99,109,0,
+97,116,109,32,99,99,47,109,105,110,0,115,99,99,115,0,97,116,109,32,
+99,99,47,115,101,99,0,115,99,102,104,0,97,116,109,32,102,116,94,51,
+47,104,111,117,114,0,115,99,102,109,0,97,116,109,32,102,116,94,51,47,
+109,105,110,0,115,108,112,109,0,97,116,109,32,108,105,116,101,114,47,109,
+105,110,0,115,108,112,104,0,97,116,109,32,108,105,116,101,114,47,104,111,
+117,114,0,108,117,115,101,99,0,108,105,116,101,114,32,109,105,99,114,111,
+110,32,72,103,32,47,32,115,0,103,48,48,0,40,45,49,41,0,103,48,
+48,48,0,40,45,50,41,0,103,48,48,48,48,0,40,45,51,41,0,103,
+48,48,48,48,48,0,40,45,52,41,0,103,48,48,48,48,48,48,0,40,
+45,53,41,0,103,48,48,48,48,48,48,48,0,40,45,54,41,0,100,109,
+116,120,120,99,111,97,114,115,101,0,49,50,48,32,109,105,99,114,111,110,
+0,100,109,116,115,105,108,118,101,114,0,100,109,116,120,120,99,111,97,114,
+115,101,0,100,109,116,120,120,0,100,109,116,120,120,99,111,97,114,115,101,
+0,100,109,116,120,99,111,97,114,115,101,0,54,48,32,109,105,99,114,111,
+110,0,100,109,116,120,0,100,109,116,120,99,111,97,114,115,101,0,100,109,
+116,98,108,97,99,107,0,100,109,116,120,99,111,97,114,115,101,0,100,109,
+116,99,111,97,114,115,101,0,52,53,32,109,105,99,114,111,110,0,100,109,
+116,99,0,100,109,116,99,111,97,114,115,101,0,100,109,116,98,108,117,101,
+0,100,109,116,99,111,97,114,115,101,0,100,109,116,102,105,110,101,0,50,
+53,32,109,105,99,114,111,110,0,100,109,116,114,101,100,0,100,109,116,102,
+105,110,101,0,100,109,116,102,0,100,109,116,102,105,110,101,0,100,109,116,
+101,102,105,110,101,0,57,32,109,105,99,114,111,110,0,100,109,116,101,0,
+100,109,116,101,102,105,110,101,0,100,109,116,103,114,101,101,110,0,100,109,
+116,101,102,105,110,101,0,100,109,116,99,101,114,97,109,105,99,0,55,32,
+109,105,99,114,111,110,0,100,109,116,99,101,114,0,100,109,116,99,101,114,
+97,109,105,99,0,100,109,116,119,104,105,116,101,0,100,109,116,99,101,114,
+97,109,105,99,0,100,109,116,101,101,102,105,110,101,0,51,32,109,105,99,
+114,111,110,0,100,109,116,116,97,110,0,100,109,116,101,101,102,105,110,101,
+0,100,109,116,101,101,0,100,109,116,101,101,102,105,110,101,0,104,97,114,
+100,116,114,97,110,115,108,117,99,101,110,116,97,114,107,97,110,115,97,115,
+0,54,32,109,105,99,114,111,110,0,115,111,102,116,97,114,107,97,110,115,
+97,115,0,50,50,32,109,105,99,114,111,110,0,101,120,116,114,97,102,105,
+110,101,105,110,100,105,97,0,50,50,32,109,105,99,114,111,110,0,102,105,
+110,101,105,110,100,105,97,0,51,53,32,109,105,99,114,111,110,0,109,101,
+100,105,117,109,105,110,100,105,97,0,53,51,46,53,32,109,105,99,114,111,
+110,0,99,111,97,114,115,101,105,110,100,105,97,0,57,55,32,109,105,99,
+114,111,110,0,102,105,110,101,99,114,121,115,116,111,108,111,110,0,52,53,
+32,109,105,99,114,111,110,0,109,101,100,105,117,109,99,114,121,115,116,97,
+108,111,110,0,55,56,32,109,105,99,114,111,110,0,99,111,97,114,115,101,
+99,114,121,115,116,97,108,111,110,0,49,50,55,32,109,105,99,114,111,110,
+0,104,97,114,100,98,108,97,99,107,97,114,107,97,110,115,97,115,0,54,
+32,109,105,99,114,111,110,0,104,97,114,100,119,104,105,116,101,97,114,107,
+97,110,115,97,115,0,49,49,32,109,105,99,114,111,110,0,119,97,115,104,
+105,116,97,0,51,53,32,109,105,99,114,111,110,0,115,105,122,101,65,114,
+105,110,103,0,51,55,46,53,48,32,109,109,0,115,105,122,101,66,114,105,
+110,103,0,51,56,46,55,53,32,109,109,0,115,105,122,101,67,114,105,110,
+103,0,52,48,46,48,48,32,109,109,0,115,105,122,101,68,114,105,110,103,
+0,52,49,46,50,53,32,109,109,0,115,105,122,101,69,114,105,110,103,0,
+52,50,46,53,48,32,109,109,0,115,105,122,101,70,114,105,110,103,0,52,
+51,46,55,53,32,109,109,0,115,105,122,101,71,114,105,110,103,0,52,53,
+46,48,48,32,109,109,0,115,105,122,101,72,114,105,110,103,0,52,54,46,
+50,53,32,109,109,0,115,105,122,101,73,114,105,110,103,0,52,55,46,53,
+48,32,109,109,0,115,105,122,101,74,114,105,110,103,0,52,56,46,55,53,
+32,109,109,0,115,105,122,101,75,114,105,110,103,0,53,48,46,48,48,32,
+109,109,0,115,105,122,101,76,114,105,110,103,0,53,49,46,50,53,32,109,
+109,0,115,105,122,101,77,114,105,110,103,0,53,50,46,53,48,32,109,109,
+0,115,105,122,101,78,114,105,110,103,0,53,51,46,55,53,32,109,109,0,
+115,105,122,101,79,114,105,110,103,0,53,53,46,48,48,32,109,109,0,115,
+105,122,101,80,114,105,110,103,0,53,54,46,50,53,32,109,109,0,115,105,
+122,101,81,114,105,110,103,0,53,55,46,53,48,32,109,109,0,115,105,122,
+101,82,114,105,110,103,0,53,56,46,55,53,32,109,109,0,115,105,122,101,
+83,114,105,110,103,0,54,48,46,48,48,32,109,109,0,115,105,122,101,84,
+114,105,110,103,0,54,49,46,50,53,32,109,109,0,115,105,122,101,85,114,
+105,110,103,0,54,50,46,53,48,32,109,109,0,115,105,122,101,86,114,105,
+110,103,0,54,51,46,55,53,32,109,109,0,115,105,122,101,87,114,105,110,
+103,0,54,53,46,48,48,32,109,109,0,115,105,122,101,88,114,105,110,103,
+0,54,54,46,50,53,32,109,109,0,115,105,122,101,89,114,105,110,103,0,
+54,55,46,53,48,32,109,109,0,115,105,122,101,90,114,105,110,103,0,54,
+56,46,55,53,32,109,109,0,109,112,104,0,109,105,108,101,47,104,114,0,
+109,112,103,0,109,105,108,101,47,103,97,108,0,107,112,104,0,107,109,47,
+104,114,0,102,76,0,102,111,111,116,108,97,109,98,101,114,116,0,102,112,
+109,0,102,116,47,109,105,110,0,102,112,115,0,102,116,47,115,0,114,112,
+109,0,114,101,118,47,109,105,110,0,114,112,115,0,114,101,118,47,115,101,
+99,0,109,105,0,109,105,108,101,0,115,109,105,0,109,105,108,101,0,110,
+109,105,0,110,97,117,116,105,99,97,108,109,105,108,101,0,109,98,104,0,
+49,101,51,32,98,116,117,47,104,111,117,114,0,109,99,109,0,49,101,51,
+32,99,105,114,99,117,108,97,114,109,105,108,0,105,112,121,0,105,110,99,
+104,47,121,101,97,114,0,99,99,102,0,49,48,48,32,102,116,94,51,0,
+77,99,102,0,49,48,48,48,32,102,116,94,51,0,107,112,0,107,105,108,
+111,112,111,110,100,0,107,112,109,0,107,112,32,109,101,116,101,114,0,87,
+104,0,87,32,104,111,117,114,0,104,112,104,0,104,112,32,104,111,117,114,
+0,112,108,102,0,108,98,32,47,32,102,111,111,116,0,112,97,0,80,97,
+0,101,118,0,101,86,0,104,103,0,72,103,0,111,101,0,79,101,0,109,
+104,0,109,72,0,114,100,0,114,111,100,0,112,102,0,112,70,0,103,114,
+0,103,114,97,105,110,0,110,116,0,78,0,104,122,0,72,122,0,104,100,
+0,104,111,103,115,104,101,97,100,0,100,114,121,0,100,114,121,103,97,108,
+108,111,110,47,103,97,108,108,111,110,0,105,109,112,101,114,105,97,108,0,
+98,114,103,97,108,108,111,110,47,103,97,108,108,111,110,0,110,109,105,108,
+101,0,110,97,117,116,105,99,97,108,109,105,108,101,0,98,101,86,0,71,
+101,86,0,98,101,118,0,98,101,86,0,99,111,117,108,0,67,0,98,101,
+99,113,117,101,114,101,108,0,47,115,0,66,113,0,98,101,99,113,117,101,
+114,101,108,0,99,117,114,105,101,0,51,46,55,101,49,48,32,66,113,0,
+67,105,0,99,117,114,105,101,0,114,117,116,104,101,114,102,111,114,100,0,
+49,101,54,32,66,113,0,82,65,68,73,65,84,73,79,78,95,68,79,83,
+69,0,103,114,97,121,0,103,114,97,121,0,74,47,107,103,0,71,121,0,
+103,114,97,121,0,114,97,100,0,49,101,45,50,32,71,121,0,114,101,112,
+0,56,46,51,56,32,109,71,121,0,115,105,101,118,101,114,116,0,74,47,
+107,103,0,83,118,0,115,105,101,118,101,114,116,0,114,101,109,0,49,101,
+45,50,32,83,118,0,114,111,101,110,116,103,101,110,0,50,46,53,56,101,
+45,52,32,67,32,47,32,107,103,0,114,111,110,116,103,101,110,0,114,111,
+101,110,116,103,101,110,0,115,105,101,118,101,114,116,117,110,105,116,0,56,
+46,51,56,32,114,111,110,116,103,101,110,0,101,109,97,110,0,49,101,45,
+55,32,67,105,47,109,94,51,0,109,97,99,104,101,0,51,46,55,101,45,
+55,32,67,105,47,109,94,51,0,97,99,116,105,110,105,117,109,0,50,50,
+55,46,48,50,55,56,0,97,108,117,109,105,110,117,109,0,50,54,46,57,
+56,49,53,51,57,0,97,109,101,114,105,99,105,117,109,0,50,52,51,46,
+48,54,49,52,0,97,110,116,105,109,111,110,121,0,49,50,49,46,55,54,
+48,0,97,114,103,111,110,0,51,57,46,57,52,56,0,97,114,115,101,110,
+105,99,0,55,52,46,57,50,49,53,57,0,97,115,116,97,116,105,110,101,
+0,50,48,57,46,57,56,55,49,0,98,97,114,105,117,109,0,49,51,55,
+46,51,50,55,0,98,101,114,107,101,108,105,117,109,0,50,52,55,46,48,
+55,48,51,0,98,101,114,121,108,108,105,117,109,0,57,46,48,49,50,49,
+56,50,0,98,105,115,109,117,116,104,0,50,48,56,46,57,56,48,51,55,
+0,98,111,114,111,110,0,49,48,46,56,49,49,0,98,114,111,109,105,110,
+101,0,55,57,46,57,48,52,0,99,97,100,109,105,117,109,0,49,49,50,
+46,52,49,49,0,99,97,108,99,105,117,109,0,52,48,46,48,55,56,0,
+99,97,108,105,102,111,114,110,105,117,109,0,50,53,49,46,48,55,57,54,
+0,99,97,114,98,111,110,0,49,50,46,48,49,49,0,99,101,114,105,117,
+109,0,49,52,48,46,49,49,53,0,99,101,115,105,117,109,0,49,51,50,
+46,57,48,53,52,51,0,99,104,108,111,114,105,110,101,0,51,53,46,52,
+53,50,55,0,99,104,114,111,109,105,117,109,0,53,49,46,57,57,54,49,
+0,99,111,98,97,108,116,0,53,56,46,57,51,51,50,48,0,99,111,112,
+112,101,114,0,54,51,46,53,52,54,0,99,117,114,105,117,109,0,50,52,
+55,46,48,55,48,51,0,100,121,115,112,114,111,115,105,117,109,0,49,54,
+50,46,53,48,0,101,105,110,115,116,101,105,110,105,117,109,0,50,53,50,
+46,48,56,51,0,101,114,98,105,117,109,0,49,54,55,46,50,54,0,101,
+117,114,111,112,105,117,109,0,49,53,49,46,57,54,53,0,102,101,114,109,
+105,117,109,0,50,53,55,46,48,57,53,49,0,102,108,117,111,114,105,110,
+101,0,49,56,46,57,57,56,52,48,51,50,0,102,114,97,110,99,105,117,
+109,0,50,50,51,46,48,49,57,55,0,103,97,100,111,108,105,110,105,117,
+109,0,49,53,55,46,50,53,0,103,97,108,108,105,117,109,0,54,57,46,
+55,50,51,0,103,101,114,109,97,110,105,117,109,0,55,50,46,54,49,0,
+103,111,108,100,0,49,57,54,46,57,54,54,53,52,0,104,97,102,110,105,
+117,109,0,49,55,56,46,52,57,0,104,101,108,105,117,109,0,52,46,48,
+48,50,54,48,50,0,104,111,108,109,105,117,109,0,49,54,52,46,57,51,
+48,51,50,0,104,121,100,114,111,103,101,110,0,49,46,48,48,55,57,52,
+0,105,110,100,105,117,109,0,49,49,52,46,56,49,56,0,105,111,100,105,
+110,101,0,49,50,54,46,57,48,52,52,55,0,105,114,105,100,105,117,109,
+0,49,57,50,46,50,49,55,0,105,114,111,110,0,53,53,46,56,52,53,
+0,107,114,121,112,116,111,110,0,56,51,46,56,48,0,108,97,110,116,104,
+97,110,117,109,0,49,51,56,46,57,48,53,53,0,108,97,119,114,101,110,
+99,105,117,109,0,50,54,50,46,49,49,0,108,101,97,100,0,50,48,55,
+46,50,0,108,105,116,104,105,117,109,0,54,46,57,52,49,0,108,117,116,
+101,116,105,117,109,0,49,55,52,46,57,54,55,0,109,97,103,110,101,115,
+105,117,109,0,50,52,46,51,48,53,48,0,109,97,110,103,97,110,101,115,
+101,0,53,52,46,57,51,56,48,53,0,109,101,110,100,101,108,101,118,105,
+117,109,0,50,53,56,46,49,48,0,109,101,114,99,117,114,121,0,50,48,
+48,46,53,57,0,109,111,108,121,98,100,101,110,117,109,0,57,53,46,57,
+52,0,110,101,111,100,121,109,105,117,109,0,49,52,52,46,50,52,0,110,
+101,111,110,0,50,48,46,49,55,57,55,0,110,101,112,116,117,110,105,117,
+109,0,50,51,55,46,48,52,56,50,0,110,105,99,107,101,108,0,53,56,
+46,54,57,51,52,0,110,105,111,98,105,117,109,0,57,50,46,57,48,54,
+51,56,0,110,105,116,114,111,103,101,110,0,49,52,46,48,48,54,55,52,
+0,110,111,98,101,108,105,117,109,0,50,53,57,46,49,48,48,57,0,111,
+115,109,105,117,109,0,49,57,48,46,50,51,0,111,120,121,103,101,110,0,
+49,53,46,57,57,57,52,0,112,97,108,108,97,100,105,117,109,0,49,48,
+54,46,52,50,0,112,104,111,115,112,104,111,114,117,115,0,51,48,46,57,
+55,51,55,54,50,0,112,108,97,116,105,110,117,109,0,49,57,53,46,48,
+56,0,112,108,117,116,111,110,105,117,109,0,50,52,52,46,48,54,52,50,
+0,112,111,108,111,110,105,117,109,0,50,48,56,46,57,56,50,52,0,112,
+111,116,97,115,115,105,117,109,0,51,57,46,48,57,56,51,0,112,114,97,
+115,101,111,100,121,109,105,117,109,0,49,52,48,46,57,48,55,54,53,0,
+112,114,111,109,101,116,104,105,117,109,0,49,52,52,46,57,49,50,55,0,
+112,114,111,116,97,99,116,105,110,105,117,109,0,50,51,49,46,48,51,53,
+56,56,0,114,97,100,105,117,109,0,50,50,54,46,48,50,53,52,0,114,
+97,100,111,110,0,50,50,50,46,48,49,55,54,0,114,104,101,110,105,117,
+109,0,49,56,54,46,50,48,55,0,114,104,111,100,105,117,109,0,49,48,
+50,46,57,48,53,53,48,0,114,117,98,105,100,105,117,109,0,56,53,46,
+52,54,55,56,0,114,117,116,104,101,110,105,117,109,0,49,48,49,46,48,
+55,0,115,97,109,97,114,105,117,109,0,49,53,48,46,51,54,0,115,99,
+97,110,100,105,117,109,0,52,52,46,57,53,53,57,49,48,0,115,101,108,
+101,110,105,117,109,0,55,56,46,57,54,0,115,105,108,105,99,111,110,0,
+50,56,46,48,56,53,53,0,115,105,108,118,101,114,0,49,48,55,46,56,
+54,56,50,0,115,111,100,105,117,109,0,50,50,46,57,56,57,55,54,56,
+0,115,116,114,111,110,116,105,117,109,0,56,55,46,54,50,0,115,117,108,
+102,117,114,0,51,50,46,48,54,54,0,116,97,110,116,97,108,117,109,0,
+49,56,48,46,57,52,55,57,0,116,101,99,104,110,101,116,105,117,109,0,
+57,55,46,57,48,55,50,0,116,101,108,108,117,114,105,117,109,0,49,50,
+55,46,54,48,0,116,101,114,98,105,117,109,0,49,53,56,46,57,50,53,
+51,52,0,116,104,97,108,108,105,117,109,0,50,48,52,46,51,56,51,51,
+0,116,104,111,114,105,117,109,0,50,51,50,46,48,51,56,49,0,116,104,
+117,108,108,105,117,109,0,49,54,56,46,57,51,52,50,49,0,116,105,110,
+0,49,49,56,46,55,49,48,0,116,105,116,97,110,105,117,109,0,52,55,
+46,56,54,55,0,116,117,110,103,115,116,101,110,0,49,56,51,46,56,52,
+0,117,114,97,110,105,117,109,0,50,51,56,46,48,50,56,57,0,118,97,
+110,97,100,105,117,109,0,53,48,46,57,52,49,53,0,120,101,110,111,110,
+0,49,51,49,46,50,57,0,121,116,116,101,114,98,105,117,109,0,49,55,
+51,46,48,52,0,121,116,116,114,105,117,109,0,56,56,46,57,48,53,56,
+53,0,122,105,110,99,0,54,53,46,51,57,0,122,105,114,99,111,110,105,
+117,109,0,57,49,46,50,50,52,0,112,101,111,112,108,101,0,49,0,112,
+101,114,115,111,110,0,112,101,111,112,108,101,0,100,101,97,116,104,0,112,
+101,111,112,108,101,0,99,97,112,105,116,97,0,112,101,111,112,108,101,0,
+112,101,114,99,97,112,105,116,97,0,112,101,114,32,99,97,112,105,116,97,
+0,119,97,114,105,95,112,114,111,112,111,114,116,105,111,110,0,49,124,49,
+48,0,119,97,114,105,0,119,97,114,105,95,112,114,111,112,111,114,116,105,
+111,110,0,98,117,95,112,114,111,112,111,114,116,105,111,110,0,49,124,49,
+48,48,0,114,105,110,95,112,114,111,112,111,114,116,105,111,110,0,49,124,
+49,48,48,48,0,109,111,117,95,112,114,111,112,111,114,116,105,111,110,0,
+49,124,49,48,48,48,48,0,115,104,97,107,117,0,49,124,51,46,51,32,
+109,0,109,111,117,0,49,124,49,48,48,48,48,32,115,104,97,107,117,0,
+114,105,110,0,49,124,49,48,48,48,32,115,104,97,107,117,0,98,117,95,
+100,105,115,116,97,110,99,101,0,49,124,49,48,48,32,115,104,97,107,117,
+0,115,117,110,0,49,124,49,48,32,115,104,97,107,117,0,106,111,117,95,
+100,105,115,116,97,110,99,101,0,49,48,32,115,104,97,107,117,0,106,111,
+117,0,106,111,117,95,100,105,115,116,97,110,99,101,0,107,97,110,101,106,
+97,107,117,115,117,110,0,115,117,110,0,107,97,110,101,106,97,107,117,0,
+115,104,97,107,117,0,107,97,110,101,106,97,107,117,106,111,117,0,106,111,
+117,0,107,117,106,105,114,97,106,97,107,117,0,49,48,124,56,32,115,104,
+97,107,117,0,107,117,106,105,114,97,106,97,107,117,115,117,110,0,49,124,
+49,48,32,107,117,106,105,114,97,106,97,107,117,0,107,117,106,105,114,97,
+106,97,107,117,98,117,0,49,124,49,48,48,32,107,117,106,105,114,97,106,
+97,107,117,0,107,117,106,105,114,97,106,97,107,117,106,111,117,0,49,48,
+32,107,117,106,105,114,97,106,97,107,117,0,116,97,110,95,100,105,115,116,
+97,110,99,101,0,51,32,107,117,106,105,114,97,106,97,107,117,106,111,117,
+0,107,101,110,0,54,32,115,104,97,107,117,0,99,104,111,117,95,100,105,
+115,116,97,110,99,101,0,54,48,32,107,101,110,0,99,104,111,117,0,99,
+104,111,117,95,100,105,115,116,97,110,99,101,0,114,105,0,51,54,32,99,
+104,111,117,0,103,111,117,95,97,114,101,97,0,49,124,49,48,32,116,115,
+117,98,111,0,116,115,117,98,111,0,51,54,32,115,104,97,107,117,94,50,
+0,115,101,0,51,48,32,116,115,117,98,111,0,116,97,110,95,97,114,101,
+97,0,49,48,32,115,101,0,99,104,111,117,95,97,114,101,97,0,49,48,
+32,116,97,110,95,97,114,101,97,0,101,100,111,109,97,0,40,53,46,56,
+42,50,46,57,41,32,115,104,97,107,117,94,50,0,107,121,111,117,109,97,
+0,40,54,46,51,42,51,46,49,53,41,32,115,104,97,107,117,94,50,0,
+99,104,117,117,107,121,111,117,109,97,0,40,54,42,51,41,32,115,104,97,
+107,117,94,50,0,106,111,117,95,97,114,101,97,0,101,100,111,109,97,0,
+116,97,116,97,109,105,0,106,111,117,95,97,114,101,97,0,115,104,97,107,
+117,95,118,111,108,117,109,101,0,49,124,49,48,32,103,111,117,95,118,111,
+108,117,109,101,0,103,111,117,95,118,111,108,117,109,101,0,49,124,49,48,
+32,115,104,111,117,0,103,111,117,0,103,111,117,95,118,111,108,117,109,101,
+0,115,104,111,117,0,40,52,46,57,42,52,46,57,42,50,46,55,41,32,
+115,117,110,94,51,0,116,111,0,49,48,32,115,104,111,117,0,107,111,107,
+117,0,49,48,32,116,111,0,114,105,110,95,119,101,105,103,104,116,0,49,
+124,49,48,32,98,117,0,98,117,95,119,101,105,103,104,116,0,49,124,49,
+48,32,109,111,110,109,101,0,102,117,110,0,49,124,49,48,32,109,111,110,
+109,101,0,109,111,110,109,101,0,49,53,124,52,32,103,0,107,105,110,0,
+49,54,48,32,109,111,110,109,101,0,107,97,110,0,49,48,48,48,32,109,
+111,110,109,101,0,107,119,97,110,0,107,97,110,0,97,117,115,116,114,97,
+108,105,97,115,113,117,97,114,101,0,40,49,48,32,102,116,41,94,50,0,
+122,101,110,116,110,101,114,0,53,48,32,107,103,0,100,111,112,112,101,108,
+122,101,110,116,110,101,114,0,50,32,122,101,110,116,110,101,114,0,112,102,
+117,110,100,0,53,48,48,32,103,0,102,114,101,110,99,104,102,111,111,116,
+0,49,52,52,124,52,52,51,46,50,57,54,32,109,0,112,105,101,100,0,
+102,114,101,110,99,104,102,111,111,116,0,102,114,101,110,99,104,102,101,101,
+116,0,102,114,101,110,99,104,102,111,111,116,0,102,114,101,110,99,104,105,
+110,99,104,0,49,124,49,50,32,102,114,101,110,99,104,102,111,111,116,0,
+102,114,101,110,99,104,116,104,117,109,98,0,102,114,101,110,99,104,105,110,
+99,104,0,112,111,117,99,101,0,102,114,101,110,99,104,116,104,117,109,98,
+0,102,114,101,110,99,104,108,105,110,101,0,49,124,49,50,32,102,114,101,
+110,99,104,105,110,99,104,0,108,105,103,110,101,0,102,114,101,110,99,104,
+108,105,110,101,0,102,114,101,110,99,104,112,111,105,110,116,0,49,124,49,
+50,32,102,114,101,110,99,104,108,105,110,101,0,116,111,105,115,101,0,54,
+32,102,114,101,110,99,104,102,101,101,116,0,97,114,112,101,110,116,0,49,
+56,48,94,50,32,112,105,101,100,94,50,0,102,114,101,110,99,104,103,114,
+97,105,110,0,49,124,49,56,56,50,55,46,49,53,32,107,103,0,102,114,
+101,110,99,104,112,111,117,110,100,0,57,50,49,54,32,102,114,101,110,99,
+104,103,114,97,105,110,0,115,99,111,116,115,105,110,99,104,0,49,46,48,
+48,53,52,48,48,53,52,32,85,75,105,110,99,104,0,115,99,111,116,115,
+108,105,110,107,0,49,124,49,48,48,32,115,99,111,116,115,99,104,97,105,
+110,0,115,99,111,116,115,102,111,111,116,0,49,50,32,115,99,111,116,115,
+105,110,99,104,0,115,99,111,116,115,102,101,101,116,0,115,99,111,116,115,
+102,111,111,116,0,115,99,111,116,115,101,108,108,0,51,55,32,115,99,111,
+116,115,105,110,99,104,0,115,99,111,116,115,102,97,108,108,0,54,32,115,
+99,111,116,115,101,108,108,0,115,99,111,116,115,99,104,97,105,110,0,52,
+32,115,99,111,116,115,102,97,108,108,0,115,99,111,116,115,102,117,114,108,
+111,110,103,0,49,48,32,115,99,111,116,115,99,104,97,105,110,0,115,99,
+111,116,115,109,105,108,101,0,56,32,115,99,111,116,115,102,117,114,108,111,
+110,103,0,115,99,111,116,115,114,111,111,100,0,52,48,32,115,99,111,116,
+115,102,97,108,108,94,50,0,115,99,111,116,115,97,99,114,101,0,52,32,
+115,99,111,116,115,114,111,111,100,0,110,111,111,107,0,50,48,32,97,99,
+114,101,115,0,105,114,105,115,104,105,110,99,104,0,85,75,105,110,99,104,
+0,105,114,105,115,104,112,97,108,109,0,51,32,105,114,105,115,104,105,110,
+99,104,0,105,114,105,115,104,115,112,97,110,0,51,32,105,114,105,115,104,
+112,97,108,109,0,105,114,105,115,104,102,111,111,116,0,49,50,32,105,114,
+105,115,104,105,110,99,104,0,105,114,105,115,104,102,101,101,116,0,105,114,
+105,115,104,102,111,111,116,0,105,114,105,115,104,99,117,98,105,116,0,49,
+56,32,105,114,105,115,104,105,110,99,104,0,105,114,105,115,104,121,97,114,
+100,0,51,32,105,114,105,115,104,102,101,101,116,0,105,114,105,115,104,112,
+97,99,101,0,53,32,105,114,105,115,104,102,101,101,116,0,105,114,105,115,
+104,102,97,116,104,111,109,0,54,32,105,114,105,115,104,102,101,101,116,0,
+105,114,105,115,104,112,111,108,101,0,55,32,105,114,105,115,104,121,97,114,
+100,0,105,114,105,115,104,112,101,114,99,104,0,105,114,105,115,104,112,111,
+108,101,0,105,114,105,115,104,99,104,97,105,110,0,52,32,105,114,105,115,
+104,112,101,114,99,104,0,105,114,105,115,104,108,105,110,107,0,49,124,49,
+48,48,32,105,114,105,115,104,99,104,97,105,110,0,105,114,105,115,104,102,
+117,114,108,111,110,103,0,49,48,32,105,114,105,115,104,99,104,97,105,110,
+0,105,114,105,115,104,109,105,108,101,0,56,32,105,114,105,115,104,102,117,
+114,108,111,110,103,0,105,114,105,115,104,114,111,111,100,0,52,48,32,105,
+114,105,115,104,112,111,108,101,94,50,0,105,114,105,115,104,97,99,114,101,
+0,52,32,105,114,105,115,104,114,111,111,100,0,119,105,110,101,112,105,110,
+116,0,49,124,50,32,119,105,110,101,113,117,97,114,116,0,119,105,110,101,
+113,117,97,114,116,0,49,124,52,32,119,105,110,101,103,97,108,108,111,110,
+0,119,105,110,101,103,97,108,108,111,110,0,50,51,49,32,85,75,105,110,
+99,104,94,51,0,119,105,110,101,114,117,110,100,108,101,116,0,49,56,32,
+119,105,110,101,103,97,108,108,111,110,0,119,105,110,101,98,97,114,114,101,
+108,0,51,49,46,53,32,119,105,110,101,103,97,108,108,111,110,0,119,105,
+110,101,116,105,101,114,99,101,0,52,50,32,119,105,110,101,103,97,108,108,
+111,110,0,119,105,110,101,104,111,103,115,104,101,97,100,0,50,32,119,105,
+110,101,98,97,114,114,101,108,0,119,105,110,101,112,117,110,99,104,101,111,
+110,0,50,32,119,105,110,101,116,105,101,114,99,101,0,119,105,110,101,98,
+117,116,116,0,50,32,119,105,110,101,104,111,103,115,104,101,97,100,0,119,
+105,110,101,112,105,112,101,0,119,105,110,101,98,117,116,116,0,119,105,110,
+101,116,117,110,0,50,32,119,105,110,101,98,117,116,116,0,98,101,101,114,
+112,105,110,116,0,49,124,50,32,98,101,101,114,113,117,97,114,116,0,98,
+101,101,114,113,117,97,114,116,0,49,124,52,32,98,101,101,114,103,97,108,
+108,111,110,0,98,101,101,114,103,97,108,108,111,110,0,50,56,50,32,85,
+75,105,110,99,104,94,51,0,98,101,101,114,98,97,114,114,101,108,0,51,
+54,32,98,101,101,114,103,97,108,108,111,110,0,98,101,101,114,104,111,103,
+115,104,101,97,100,0,49,46,53,32,98,101,101,114,98,97,114,114,101,108,
+0,97,108,101,112,105,110,116,0,49,124,50,32,97,108,101,113,117,97,114,
+116,0,97,108,101,113,117,97,114,116,0,49,124,52,32,97,108,101,103,97,
+108,108,111,110,0,97,108,101,103,97,108,108,111,110,0,98,101,101,114,103,
+97,108,108,111,110,0,97,108,101,98,97,114,114,101,108,0,51,52,32,97,
+108,101,103,97,108,108,111,110,0,97,108,101,104,111,103,115,104,101,97,100,
+0,49,46,53,32,97,108,101,98,97,114,114,101,108,0,115,99,111,116,115,
+103,105,108,108,0,49,124,52,32,109,117,116,99,104,107,105,110,0,109,117,
+116,99,104,107,105,110,0,49,124,50,32,99,104,111,112,112,105,110,0,99,
+104,111,112,112,105,110,0,49,124,50,32,115,99,111,116,115,112,105,110,116,
+0,115,99,111,116,115,112,105,110,116,0,49,124,50,32,115,99,111,116,115,
+113,117,97,114,116,0,115,99,111,116,115,113,117,97,114,116,0,49,124,52,
+32,115,99,111,116,115,103,97,108,108,111,110,0,115,99,111,116,115,103,97,
+108,108,111,110,0,56,50,55,46,50,51,50,32,85,75,105,110,99,104,94,
+51,0,115,99,111,116,115,98,97,114,114,101,108,0,56,32,115,99,111,116,
+115,103,97,108,108,111,110,0,106,117,103,0,115,99,111,116,115,112,105,110,
+116,0,115,99,111,116,115,119,104,101,97,116,108,105,112,112,121,0,49,51,
+55,46,51,51,51,32,85,75,105,110,99,104,94,51,0,115,99,111,116,115,
+119,104,101,97,116,108,105,112,112,105,101,115,0,115,99,111,116,115,119,104,
+101,97,116,108,105,112,112,121,0,115,99,111,116,115,119,104,101,97,116,112,
+101,99,107,0,52,32,115,99,111,116,115,119,104,101,97,116,108,105,112,112,
+121,0,115,99,111,116,115,119,104,101,97,116,102,105,114,108,111,116,0,52,
+32,115,99,111,116,115,119,104,101,97,116,112,101,99,107,0,115,99,111,116,
+115,119,104,101,97,116,98,111,108,108,0,52,32,115,99,111,116,115,119,104,
+101,97,116,102,105,114,108,111,116,0,115,99,111,116,115,119,104,101,97,116,
+99,104,97,108,100,101,114,0,49,54,32,115,99,111,116,115,119,104,101,97,
+116,98,111,108,108,0,115,99,111,116,115,111,97,116,108,105,112,112,121,0,
+50,48,48,46,51,52,53,32,85,75,105,110,99,104,94,51,0,115,99,111,
+116,115,111,97,116,108,105,112,112,105,101,115,0,115,99,111,116,115,111,97,
+116,108,105,112,112,121,0,115,99,111,116,115,111,97,116,112,101,99,107,0,
+52,32,115,99,111,116,115,111,97,116,108,105,112,112,121,0,115,99,111,116,
+115,111,97,116,102,105,114,108,111,116,0,52,32,115,99,111,116,115,111,97,
+116,112,101,99,107,0,115,99,111,116,115,111,97,116,98,111,108,108,0,52,
+32,115,99,111,116,115,111,97,116,102,105,114,108,111,116,0,115,99,111,116,
+115,111,97,116,99,104,97,108,100,101,114,0,49,54,32,115,99,111,116,115,
+111,97,116,98,111,108,108,0,116,114,111,110,100,114,111,112,0,49,124,49,
+54,32,116,114,111,110,111,117,110,99,101,0,116,114,111,110,111,117,110,99,
+101,0,49,124,50,48,32,116,114,111,110,112,111,117,110,100,0,116,114,111,
+110,112,111,117,110,100,0,57,53,50,48,32,103,114,97,105,110,0,116,114,
+111,110,115,116,111,110,101,0,49,54,32,116,114,111,110,112,111,117,110,100,
+0,105,114,105,115,104,110,111,103,103,105,110,0,49,124,52,32,105,114,105,
+115,104,112,105,110,116,0,105,114,105,115,104,112,105,110,116,0,49,124,50,
+32,105,114,105,115,104,113,117,97,114,116,0,105,114,105,115,104,113,117,97,
+114,116,0,49,124,50,32,105,114,105,115,104,112,111,116,116,108,101,0,105,
+114,105,115,104,112,111,116,116,108,101,0,49,124,50,32,105,114,105,115,104,
+103,97,108,108,111,110,0,105,114,105,115,104,103,97,108,108,111,110,0,50,
+49,55,46,54,32,85,75,105,110,99,104,94,51,0,105,114,105,115,104,114,
+117,110,100,108,101,116,0,49,56,32,105,114,105,115,104,103,97,108,108,111,
+110,0,105,114,105,115,104,98,97,114,114,101,108,0,51,49,46,53,32,105,
+114,105,115,104,103,97,108,108,111,110,0,105,114,105,115,104,116,105,101,114,
+99,101,0,52,50,32,105,114,105,115,104,103,97,108,108,111,110,0,105,114,
+105,115,104,104,111,103,115,104,101,97,100,0,50,32,105,114,105,115,104,98,
+97,114,114,101,108,0,105,114,105,115,104,112,117,110,99,104,101,111,110,0,
+50,32,105,114,105,115,104,116,105,101,114,99,101,0,105,114,105,115,104,112,
+105,112,101,0,50,32,105,114,105,115,104,104,111,103,115,104,101,97,100,0,
+105,114,105,115,104,116,117,110,0,50,32,105,114,105,115,104,112,105,112,101,
+0,105,114,105,115,104,112,101,99,107,0,50,32,105,114,105,115,104,103,97,
+108,108,111,110,0,105,114,105,115,104,98,117,115,104,101,108,0,52,32,105,
+114,105,115,104,112,101,99,107,0,105,114,105,115,104,115,116,114,105,107,101,
+0,50,32,105,114,105,115,104,98,117,115,104,101,108,0,105,114,105,115,104,
+100,114,121,98,97,114,114,101,108,0,50,32,105,114,105,115,104,115,116,114,
+105,107,101,0,105,114,105,115,104,113,117,97,114,116,101,114,0,50,32,105,
+114,105,115,104,98,97,114,114,101,108,0,116,111,119,101,114,112,111,117,110,
+100,0,53,52,48,48,32,103,114,97,105,110,0,116,111,119,101,114,111,117,
+110,99,101,0,49,124,49,50,32,116,111,119,101,114,112,111,117,110,100,0,
+116,111,119,101,114,112,101,110,110,121,119,101,105,103,104,116,0,49,124,50,
+48,32,116,111,119,101,114,111,117,110,99,101,0,116,111,119,101,114,103,114,
+97,105,110,0,49,124,51,50,32,116,111,119,101,114,112,101,110,110,121,119,
+101,105,103,104,116,0,109,101,114,99,112,111,117,110,100,0,54,55,53,48,
+32,103,114,97,105,110,0,109,101,114,99,111,117,110,99,101,0,49,124,49,
+53,32,109,101,114,99,112,111,117,110,100,0,109,101,114,99,112,101,110,110,
+121,119,101,105,103,104,116,0,49,124,50,48,32,109,101,114,99,111,117,110,
+99,101,0,108,101,97,100,115,116,111,110,101,0,49,50,46,53,32,108,98,
+0,102,111,116,109,97,108,0,55,48,32,108,98,0,108,101,97,100,119,101,
+121,0,49,52,32,108,101,97,100,115,116,111,110,101,0,102,111,116,104,101,
+114,115,0,49,50,32,108,101,97,100,119,101,121,0,110,101,119,104,97,121,
+116,114,117,115,115,0,54,48,32,108,98,0,110,101,119,104,97,121,108,111,
+97,100,0,51,54,32,110,101,119,104,97,121,116,114,117,115,115,0,111,108,
+100,104,97,121,116,114,117,115,115,0,53,54,32,108,98,0,111,108,100,104,
+97,121,108,111,97,100,0,51,54,32,111,108,100,104,97,121,116,114,117,115,
+115,0,119,111,111,108,99,108,111,118,101,0,55,32,108,98,0,119,111,111,
+108,115,116,111,110,101,0,50,32,119,111,111,108,99,108,111,118,101,0,119,
+111,111,108,116,111,100,0,50,32,119,111,111,108,115,116,111,110,101,0,119,
+111,111,108,119,101,121,0,49,51,32,119,111,111,108,115,116,111,110,101,0,
+119,111,111,108,115,97,99,107,0,50,32,119,111,111,108,119,101,121,0,119,
+111,111,108,115,97,114,112,108,101,114,0,50,32,119,111,111,108,115,97,99,
+107,0,119,111,111,108,108,97,115,116,0,54,32,119,111,111,108,115,97,114,
+112,108,101,114,0,114,111,109,97,110,102,111,111,116,0,50,57,54,32,109,
+109,0,114,111,109,97,110,102,101,101,116,0,114,111,109,97,110,102,111,111,
+116,0,112,101,115,0,114,111,109,97,110,102,111,111,116,0,112,101,100,101,
+115,0,114,111,109,97,110,102,111,111,116,0,114,111,109,97,110,105,110,99,
+104,0,49,124,49,50,32,114,111,109,97,110,102,111,111,116,0,114,111,109,
+97,110,100,105,103,105,116,0,49,124,49,54,32,114,111,109,97,110,102,111,
+111,116,0,114,111,109,97,110,112,97,108,109,0,49,124,52,32,114,111,109,
+97,110,102,111,111,116,0,114,111,109,97,110,99,117,98,105,116,0,49,56,
+32,114,111,109,97,110,105,110,99,104,0,114,111,109,97,110,112,97,99,101,
+0,53,32,114,111,109,97,110,102,101,101,116,0,112,97,115,115,117,115,0,
+114,111,109,97,110,112,97,99,101,0,114,111,109,97,110,112,101,114,99,104,
+0,49,48,32,114,111,109,97,110,102,101,101,116,0,115,116,97,100,101,0,
+49,50,53,32,114,111,109,97,110,112,97,99,101,115,0,115,116,97,100,105,
+97,0,115,116,97,100,101,0,115,116,97,100,105,117,109,0,115,116,97,100,
+101,0,114,111,109,97,110,109,105,108,101,0,56,32,115,116,97,100,105,97,
+0,114,111,109,97,110,108,101,97,103,117,101,0,49,46,53,32,114,111,109,
+97,110,109,105,108,101,0,115,99,104,111,101,110,117,115,0,52,32,114,111,
+109,97,110,109,105,108,101,0,101,97,114,108,121,114,111,109,97,110,102,111,
+111,116,0,50,57,46,55,51,32,99,109,0,112,101,115,100,114,117,115,105,
+97,110,117,115,0,51,51,46,51,32,99,109,0,108,97,116,101,114,111,109,
+97,110,102,111,111,116,0,50,57,46,52,50,32,99,109,0,97,99,116,117,
+115,108,101,110,103,116,104,0,49,50,48,32,114,111,109,97,110,102,101,101,
+116,0,97,99,116,117,115,0,49,50,48,42,52,32,114,111,109,97,110,102,
+101,101,116,94,50,0,115,113,117,97,114,101,97,99,116,117,115,0,49,50,
+48,94,50,32,114,111,109,97,110,102,101,101,116,94,50,0,97,99,110,117,
+97,0,115,113,117,97,114,101,97,99,116,117,115,0,105,117,103,101,114,117,
+109,0,50,32,115,113,117,97,114,101,97,99,116,117,115,0,105,117,103,101,
+114,97,0,105,117,103,101,114,117,109,0,106,117,103,101,114,117,109,0,105,
+117,103,101,114,117,109,0,106,117,103,101,114,97,0,105,117,103,101,114,117,
+109,0,104,101,114,101,100,105,117,109,0,50,32,105,117,103,101,114,97,0,
+104,101,114,101,100,105,97,0,104,101,114,101,100,105,117,109,0,99,101,110,
+116,117,114,105,97,0,49,48,48,32,104,101,114,101,100,105,97,0,99,101,
+110,116,117,114,105,117,109,0,99,101,110,116,117,114,105,97,0,115,101,120,
+116,97,114,105,117,115,0,51,53,46,52,32,105,110,94,51,0,115,101,120,
+116,97,114,105,105,0,115,101,120,116,97,114,105,117,115,0,99,111,99,104,
+108,101,97,114,105,97,0,49,124,52,56,32,115,101,120,116,97,114,105,117,
+115,0,99,121,97,116,104,105,0,49,124,49,50,32,115,101,120,116,97,114,
+105,117,115,0,97,99,101,116,97,98,117,108,97,0,49,124,56,32,115,101,
+120,116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,97,0,49,124,
+52,32,115,101,120,116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,
+117,115,0,113,117,97,114,116,97,114,105,97,0,104,101,109,105,110,97,101,
+0,49,124,50,32,115,101,120,116,97,114,105,117,115,0,104,101,109,105,110,
+97,0,104,101,109,105,110,97,101,0,99,104,101,111,110,105,120,0,49,46,
+53,32,115,101,120,116,97,114,105,105,0,115,101,109,111,100,105,117,115,0,
+56,32,115,101,120,116,97,114,105,117,115,0,115,101,109,111,100,105,105,0,
+115,101,109,111,100,105,117,115,0,109,111,100,105,117,115,0,49,54,32,115,
+101,120,116,97,114,105,117,115,0,109,111,100,105,105,0,109,111,100,105,117,
+115,0,99,111,110,103,105,117,115,0,49,50,32,104,101,109,105,110,97,101,
+0,99,111,110,103,105,105,0,99,111,110,103,105,117,115,0,97,109,112,104,
+111,114,97,0,56,32,99,111,110,103,105,105,0,97,109,112,104,111,114,97,
+101,0,97,109,112,104,111,114,97,0,99,117,108,108,101,117,115,0,50,48,
+32,97,109,112,104,111,114,97,101,0,113,117,97,100,114,97,110,116,97,108,
+0,97,109,112,104,111,114,97,0,108,105,98,114,97,0,53,48,53,50,32,
+103,114,97,105,110,0,108,105,98,114,97,101,0,108,105,98,114,97,0,114,
+111,109,97,110,112,111,117,110,100,0,108,105,98,114,97,0,117,110,99,105,
+97,0,49,124,49,50,32,108,105,98,114,97,0,117,110,99,105,97,101,0,
+117,110,99,105,97,0,114,111,109,97,110,111,117,110,99,101,0,117,110,99,
+105,97,0,100,101,117,110,120,0,49,49,32,117,110,99,105,97,0,100,101,
+120,116,97,110,115,0,49,48,32,117,110,99,105,97,0,100,111,100,114,97,
+110,115,0,57,32,117,110,99,105,97,0,98,101,115,0,56,32,117,110,99,
+105,97,0,115,101,112,114,117,110,120,0,55,32,117,110,99,105,97,0,115,
+101,109,105,115,0,54,32,117,110,99,105,97,0,113,117,105,110,99,117,110,
+120,0,53,32,117,110,99,105,97,0,116,114,105,101,110,115,0,52,32,117,
+110,99,105,97,0,113,117,97,100,114,97,110,115,0,51,32,117,110,99,105,
+97,0,115,101,120,116,97,110,115,0,50,32,117,110,99,105,97,0,115,101,
+115,99,117,110,99,105,97,0,49,46,53,32,117,110,99,105,97,0,115,101,
+109,117,110,99,105,97,0,49,124,50,32,117,110,99,105,97,0,115,105,115,
+99,105,108,105,117,115,0,49,124,52,32,117,110,99,105,97,0,115,101,120,
+116,117,108,97,0,49,124,54,32,117,110,99,105,97,0,115,101,109,105,115,
+101,120,116,117,108,97,0,49,124,49,50,32,117,110,99,105,97,0,115,99,
+114,105,112,116,117,108,117,109,0,49,124,50,52,32,117,110,99,105,97,0,
+115,99,114,117,112,117,108,97,0,115,99,114,105,112,116,117,108,117,109,0,
+114,111,109,97,110,111,98,111,108,0,49,124,50,32,115,99,114,117,112,117,
+108,97,0,114,111,109,97,110,97,115,112,111,117,110,100,0,52,50,49,48,
+32,103,114,97,105,110,0,101,103,121,112,116,105,97,110,114,111,121,97,108,
+99,117,98,105,116,0,50,48,46,54,51,32,105,110,0,101,103,121,112,116,
+105,97,110,112,97,108,109,0,49,124,55,32,101,103,121,112,116,105,97,110,
+114,111,121,97,108,99,117,98,105,116,0,101,103,121,112,116,105,97,110,100,
+105,103,105,116,0,49,124,52,32,101,103,121,112,116,105,97,110,112,97,108,
+109,0,101,103,121,112,116,105,97,110,115,104,111,114,116,99,117,98,105,116,
+0,54,32,101,103,121,112,116,105,97,110,112,97,108,109,0,100,111,117,98,
+108,101,114,101,109,101,110,0,50,57,46,49,54,32,105,110,0,114,101,109,
+101,110,100,105,103,105,116,0,49,124,52,48,32,100,111,117,98,108,101,114,
+101,109,101,110,0,103,114,101,101,107,102,111,111,116,0,49,50,46,52,53,
+32,105,110,0,103,114,101,101,107,102,101,101,116,0,103,114,101,101,107,102,
+111,111,116,0,103,114,101,101,107,99,117,98,105,116,0,49,46,53,32,103,
+114,101,101,107,102,111,111,116,0,112,111,117,115,0,103,114,101,101,107,102,
+111,111,116,0,112,111,100,101,115,0,103,114,101,101,107,102,111,111,116,0,
+111,114,103,117,105,97,0,54,32,103,114,101,101,107,102,111,111,116,0,103,
+114,101,101,107,102,97,116,104,111,109,0,111,114,103,117,105,97,0,115,116,
+97,100,105,111,110,0,49,48,48,32,111,114,103,117,105,97,0,97,107,97,
+105,110,97,0,49,48,32,103,114,101,101,107,102,101,101,116,0,112,108,101,
+116,104,114,111,110,0,49,48,32,97,107,97,105,110,97,0,103,114,101,101,
+107,102,105,110,103,101,114,0,49,124,49,54,32,103,114,101,101,107,102,111,
+111,116,0,104,111,109,101,114,105,99,99,117,98,105,116,0,50,48,32,103,
+114,101,101,107,102,105,110,103,101,114,115,0,115,104,111,114,116,103,114,101,
+101,107,99,117,98,105,116,0,49,56,32,103,114,101,101,107,102,105,110,103,
+101,114,115,0,105,111,110,105,99,102,111,111,116,0,50,57,54,32,109,109,
+0,100,111,114,105,99,102,111,111,116,0,51,50,54,32,109,109,0,111,108,
+121,109,112,105,99,99,117,98,105,116,0,50,53,32,114,101,109,101,110,100,
+105,103,105,116,0,111,108,121,109,112,105,99,102,111,111,116,0,50,124,51,
+32,111,108,121,109,112,105,99,99,117,98,105,116,0,111,108,121,109,112,105,
+99,102,105,110,103,101,114,0,49,124,49,54,32,111,108,121,109,112,105,99,
+102,111,111,116,0,111,108,121,109,112,105,99,102,101,101,116,0,111,108,121,
+109,112,105,99,102,111,111,116,0,111,108,121,109,112,105,99,100,97,107,121,
+108,111,115,0,111,108,121,109,112,105,99,102,105,110,103,101,114,0,111,108,
+121,109,112,105,99,112,97,108,109,0,49,124,52,32,111,108,121,109,112,105,
+99,102,111,111,116,0,111,108,121,109,112,105,99,112,97,108,101,115,116,114,
+97,0,111,108,121,109,112,105,99,112,97,108,109,0,111,108,121,109,112,105,
+99,115,112,105,116,104,97,109,101,0,51,124,52,32,102,111,111,116,0,111,
+108,121,109,112,105,99,115,112,97,110,0,111,108,121,109,112,105,99,115,112,
+105,116,104,97,109,101,0,111,108,121,109,112,105,99,98,101,109,97,0,50,
+46,53,32,111,108,121,109,112,105,99,102,101,101,116,0,111,108,121,109,112,
+105,99,112,97,99,101,0,111,108,121,109,112,105,99,98,101,109,97,0,111,
+108,121,109,112,105,99,111,114,103,117,105,97,0,54,32,111,108,121,109,112,
+105,99,102,101,101,116,0,111,108,121,109,112,105,99,102,97,116,104,111,109,
+0,111,108,121,109,112,105,99,111,114,103,117,105,97,0,111,108,121,109,112,
+105,99,99,111,114,100,0,54,48,32,111,108,121,109,112,105,99,102,101,101,
+116,0,111,108,121,109,112,105,99,97,109,109,97,0,111,108,121,109,112,105,
+99,99,111,114,100,0,111,108,121,109,112,105,99,112,108,101,116,104,114,111,
+110,0,49,48,48,32,111,108,121,109,112,105,99,102,101,101,116,0,111,108,
+121,109,112,105,99,115,116,97,100,105,111,110,0,54,48,48,32,111,108,121,
+109,112,105,99,102,101,101,116,0,103,114,101,101,107,107,111,116,121,108,101,
+0,50,55,48,32,109,108,0,120,101,115,116,101,115,0,50,32,103,114,101,
+101,107,107,111,116,121,108,101,0,107,104,111,117,115,0,49,50,32,103,114,
+101,101,107,107,111,116,121,108,101,0,109,101,116,114,101,116,101,115,0,49,
+50,32,107,104,111,117,115,0,99,104,111,105,110,105,120,0,52,32,103,114,
+101,101,107,107,111,116,121,108,101,0,104,101,107,116,101,111,115,0,56,32,
+99,104,111,105,110,105,120,0,109,101,100,105,109,110,111,115,0,54,32,104,
+101,107,116,101,111,115,0,97,101,103,105,110,97,115,116,97,116,101,114,0,
+49,57,50,32,103,114,97,105,110,0,97,101,103,105,110,97,100,114,97,99,
+104,109,97,101,0,49,124,50,32,97,101,103,105,110,97,115,116,97,116,101,
+114,0,97,101,103,105,110,97,111,98,111,108,0,49,124,54,32,97,101,103,
+105,110,97,100,114,97,99,104,109,97,101,0,97,101,103,105,110,97,109,105,
+110,97,0,53,48,32,97,101,103,105,110,97,115,116,97,116,101,114,115,0,
+97,101,103,105,110,97,116,97,108,101,110,116,0,54,48,32,97,101,103,105,
+110,97,109,105,110,97,0,97,116,116,105,99,115,116,97,116,101,114,0,49,
+51,53,32,103,114,97,105,110,0,97,116,116,105,99,100,114,97,99,104,109,
+97,101,0,49,124,50,32,97,116,116,105,99,115,116,97,116,101,114,0,97,
+116,116,105,99,111,98,111,108,0,49,124,54,32,97,116,116,105,99,100,114,
+97,99,104,109,97,101,0,97,116,116,105,99,109,105,110,97,0,53,48,32,
+97,116,116,105,99,115,116,97,116,101,114,115,0,97,116,116,105,99,116,97,
+108,101,110,116,0,54,48,32,97,116,116,105,99,109,105,110,97,0,110,111,
+114,116,104,101,114,110,99,117,98,105,116,0,50,54,46,54,32,105,110,0,
+110,111,114,116,104,101,114,110,102,111,111,116,0,49,124,50,32,110,111,114,
+116,104,101,114,110,99,117,98,105,116,0,115,117,109,101,114,105,97,110,99,
+117,98,105,116,0,52,57,53,32,109,109,0,107,117,115,0,115,117,109,101,
+114,105,97,110,99,117,98,105,116,0,115,117,109,101,114,105,97,110,102,111,
+111,116,0,50,124,51,32,115,117,109,101,114,105,97,110,99,117,98,105,116,
+0,97,115,115,121,114,105,97,110,99,117,98,105,116,0,50,49,46,54,32,
+105,110,0,97,115,115,121,114,105,97,110,102,111,111,116,0,49,124,50,32,
+97,115,115,121,114,105,97,110,99,117,98,105,116,0,97,115,115,121,114,105,
+97,110,112,97,108,109,0,49,124,51,32,97,115,115,121,114,105,97,110,102,
+111,111,116,0,97,115,115,121,114,105,97,110,115,117,115,105,0,49,124,50,
+48,32,97,115,115,121,114,105,97,110,112,97,108,109,0,115,117,115,105,0,
+97,115,115,121,114,105,97,110,115,117,115,105,0,112,101,114,115,105,97,110,
+114,111,121,97,108,99,117,98,105,116,0,55,32,97,115,115,121,114,105,97,
+110,112,97,108,109,0,104,97,115,104,105,109,105,99,117,98,105,116,0,50,
+53,46,53,54,32,105,110,0,98,108,97,99,107,99,117,98,105,116,0,50,
+49,46,50,56,32,105,110,0,97,114,97,98,105,99,102,101,101,116,0,49,
+124,50,32,98,108,97,99,107,99,117,98,105,116,0,97,114,97,98,105,99,
+102,111,111,116,0,97,114,97,98,105,99,102,101,101,116,0,97,114,97,98,
+105,99,105,110,99,104,0,49,124,49,50,32,97,114,97,98,105,99,102,111,
+111,116,0,97,114,97,98,105,99,109,105,108,101,0,52,48,48,48,32,98,
+108,97,99,107,99,117,98,105,116,0,115,105,108,118,101,114,100,105,114,104,
+101,109,0,52,53,32,103,114,97,105,110,0,116,114,97,100,101,100,105,114,
+104,101,109,0,52,56,32,103,114,97,105,110,0,115,105,108,118,101,114,107,
+105,114,97,116,0,49,124,49,54,32,115,105,108,118,101,114,100,105,114,104,
+101,109,0,115,105,108,118,101,114,119,117,107,105,121,101,104,0,49,48,32,
+115,105,108,118,101,114,100,105,114,104,101,109,0,115,105,108,118,101,114,114,
+111,116,108,0,49,50,32,115,105,108,118,101,114,119,117,107,105,121,101,104,
+0,97,114,97,98,105,99,115,105,108,118,101,114,112,111,117,110,100,0,115,
+105,108,118,101,114,114,111,116,108,0,116,114,97,100,101,107,105,114,97,116,
+0,49,124,49,54,32,116,114,97,100,101,100,105,114,104,101,109,0,116,114,
+97,100,101,119,117,107,105,121,101,104,0,49,48,32,116,114,97,100,101,100,
+105,114,104,101,109,0,116,114,97,100,101,114,111,116,108,0,49,50,32,116,
+114,97,100,101,119,117,107,105,121,101,104,0,97,114,97,98,105,99,116,114,
+97,100,101,112,111,117,110,100,0,116,114,97,100,101,114,111,116,108,0,112,
+97,114,97,115,97,110,103,0,51,46,53,32,109,105,108,101,0,98,105,98,
+108,105,99,97,108,99,117,98,105,116,0,50,49,46,56,32,105,110,0,104,
+101,98,114,101,119,99,117,98,105,116,0,49,55,46,53,56,32,105,110,0,
+108,105,0,49,48,124,50,55,46,56,32,109,105,108,101,0,108,105,97,110,
+103,0,49,49,124,51,32,111,122,0,116,105,109,101,112,111,105,110,116,0,
+49,124,53,32,104,111,117,114,0,116,105,109,101,109,105,110,117,116,101,0,
+49,124,49,48,32,104,111,117,114,0,116,105,109,101,111,115,116,101,110,116,
+0,49,124,54,48,32,104,111,117,114,0,116,105,109,101,111,117,110,99,101,
+0,49,124,56,32,116,105,109,101,111,115,116,101,110,116,0,116,105,109,101,
+97,116,111,109,0,49,124,52,55,32,116,105,109,101,111,117,110,99,101,0,
+109,105,116,101,0,49,124,50,48,32,103,114,97,105,110,0,100,114,111,105,
+116,0,49,124,50,52,32,109,105,116,101,0,112,101,114,105,111,116,0,49,
+124,50,48,32,100,114,111,105,116,0,98,108,97,110,99,0,49,124,50,52,
+32,112,101,114,105,111,116,0,162,0,99,101,110,116,0,163,0,98,114,105,
+116,97,105,110,112,111,117,110,100,0,165,0,106,97,112,97,110,121,101,110,
+0,229,110,103,115,116,114,246,109,0,97,110,103,115,116,114,111,109,0,197,
+0,97,110,103,115,116,114,111,109,0,114,246,110,116,103,101,110,0,114,111,
+101,110,116,103,101,110,0,176,67,0,100,101,103,67,0,176,70,0,100,101,
+103,70,0,176,75,0,75,0,176,82,0,100,101,103,82,0,176,0,100,101,
+103,114,101,101,0,104,117,110,100,114,101,100,119,101,105,103,104,116,0,117,
+115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,116,111,110,0,117,
+115,116,111,110,0,115,99,114,117,112,108,101,0,97,112,115,99,114,117,112,
+108,101,0,102,108,117,105,100,111,117,110,99,101,0,117,115,102,108,117,105,
+100,111,117,110,99,101,0,103,97,108,108,111,110,0,117,115,103,97,108,108,
+111,110,0,98,117,115,104,101,108,0,117,115,98,117,115,104,101,108,0,113,
+117,97,114,116,101,114,0,113,117,97,114,116,101,114,119,101,105,103,104,116,
+0,99,117,112,0,117,115,99,117,112,0,116,97,98,108,101,115,112,111,111,
+110,0,117,115,116,97,98,108,101,115,112,111,111,110,0,116,101,97,115,112,
+111,111,110,0,117,115,116,101,97,115,112,111,111,110,0,104,111,114,115,101,
+112,111,119,101,114,0,117,115,104,111,114,115,101,112,111,119,101,114,0,100,
+111,108,108,97,114,0,85,83,36,0,99,101,110,116,0,36,32,48,46,48,
+49,0,112,101,110,110,121,0,99,101,110,116,0,109,105,110,105,109,0,109,
+105,110,105,109,118,111,108,117,109,101,0,112,111,110,121,0,112,111,110,121,
+118,111,108,117,109,101,0,103,114,97,110,100,0,117,115,103,114,97,110,100,
+0,102,105,114,107,105,110,0,117,115,102,105,114,107,105,110,0,104,111,103,
+115,104,101,97,100,0,117,115,104,111,103,115,104,101,97,100,0,97,99,114,
+101,0,117,115,97,99,114,101,0,97,99,114,101,102,111,111,116,0,117,115,
+97,99,114,101,102,111,111,116,0,121,111,116,116,97,0,49,101,50,52,0,
+122,101,116,116,97,0,49,101,50,49,0,101,120,97,0,49,101,49,56,0,
+112,101,116,97,0,49,101,49,53,0,116,101,114,97,0,49,101,49,50,0,
+103,105,103,97,0,49,101,57,0,109,101,103,97,0,49,101,54,0,109,121,
+114,105,97,0,49,101,52,0,107,105,108,111,0,49,101,51,0,104,101,99,
+116,111,0,49,101,50,0,100,101,99,97,0,49,101,49,0,100,101,107,97,
+0,100,101,99,97,0,100,101,99,105,0,49,101,45,49,0,99,101,110,116,
+105,0,49,101,45,50,0,109,105,108,108,105,0,49,101,45,51,0,109,105,
+99,114,111,0,49,101,45,54,0,110,97,110,111,0,49,101,45,57,0,112,
+105,99,111,0,49,101,45,49,50,0,102,101,109,116,111,0,49,101,45,49,
+53,0,97,116,116,111,0,49,101,45,49,56,0,122,101,112,116,111,0,49,
+101,45,50,49,0,121,111,99,116,111,0,49,101,45,50,52,0,113,117,97,
+114,116,101,114,0,49,124,52,0,115,101,109,105,0,48,46,53,0,100,101,
+109,105,0,48,46,53,0,104,101,109,105,0,48,46,53,0,104,97,108,102,
+0,48,46,53,0,100,111,117,98,108,101,0,50,0,116,114,105,112,108,101,
+0,51,0,116,114,101,98,108,101,0,51,0,107,105,98,105,0,50,94,49,
+48,0,109,101,98,105,0,50,94,50,48,0,103,105,98,105,0,50,94,51,
+48,0,116,101,98,105,0,50,94,52,48,0,112,101,98,105,0,50,94,53,
+48,0,101,120,98,105,0,50,94,54,48,0,75,105,0,107,105,98,105,0,
+77,105,0,109,101,98,105,0,71,105,0,103,105,98,105,0,84,105,0,116,
+101,98,105,0,80,105,0,112,101,98,105,0,69,105,0,101,120,98,105,0,
+89,0,121,111,116,116,97,0,90,0,122,101,116,116,97,0,69,0,101,120,
+97,0,80,0,112,101,116,97,0,84,0,116,101,114,97,0,71,0,103,105,
+103,97,0,77,0,109,101,103,97,0,107,0,107,105,108,111,0,104,0,104,
+101,99,116,111,0,100,97,0,100,101,107,97,0,100,0,100,101,99,105,0,
+99,0,99,101,110,116,105,0,109,0,109,105,108,108,105,0,117,0,109,105,
+99,114,111,0,110,0,110,97,110,111,0,112,0,112,105,99,111,0,102,0,
+102,101,109,116,111,0,97,0,97,116,116,111,0,122,0,122,101,112,116,111,
+0,121,0,121,111,99,116,111,0,85,83,0,85,83,0,115,117,114,118,101,
+121,0,85,83,0,103,101,111,100,101,116,105,99,0,85,83,0,105,110,116,
+0,105,110,116,0,85,75,0,85,75,0,98,114,105,116,105,115,104,0,85,
+75,0,188,0,49,124,52,0,189,0,49,124,50,0,190,0,51,124,52,0,
+181,0,109,105,99,114,111,0,99,105,114,99,108,101,97,114,101,97,0,114,
+0,112,105,32,114,94,50,0,109,0,115,113,114,116,40,99,105,114,99,108,
+101,97,114,101,97,47,112,105,41,0,109,94,50,0,99,105,114,99,108,101,
+97,114,101,97,0,115,112,104,101,114,101,118,111,108,117,109,101,0,114,0,
+52,124,51,32,112,105,32,114,94,51,0,109,0,99,117,98,101,114,111,111,
+116,40,115,112,104,101,114,101,118,111,108,117,109,101,47,52,124,51,32,112,
+105,41,0,109,94,51,0,115,112,104,101,114,101,118,111,108,117,109,101,0,
+115,112,104,101,114,101,118,111,108,0,114,0,115,112,104,101,114,101,118,111,
+108,117,109,101,40,114,41,0,109,0,126,115,112,104,101,114,101,118,111,108,
+117,109,101,40,115,112,104,101,114,101,118,111,108,41,0,109,94,51,0,115,
+112,104,101,114,101,118,111,108,0,115,113,117,97,114,101,0,120,0,120,94,
+50,0,115,113,114,116,40,115,113,117,97,114,101,41,0,115,113,117,97,114,
+101,0,112,72,0,120,0,49,48,94,40,45,120,41,32,109,111,108,47,108,
+105,116,101,114,0,0,40,45,108,111,103,40,112,72,32,108,105,116,101,114,
+115,47,109,111,108,41,41,0,109,111,108,47,108,105,116,101,114,0,112,72,
+0,116,101,109,112,67,0,120,0,120,32,75,32,43,32,115,116,100,116,101,
+109,112,0,0,40,116,101,109,112,67,32,43,40,45,115,116,100,116,101,109,
+112,41,41,47,75,0,75,0,116,101,109,112,67,0,116,101,109,112,99,101,
+108,115,105,117,115,0,120,0,116,101,109,112,67,40,120,41,0,0,126,116,
+101,109,112,67,40,116,101,109,112,99,101,108,115,105,117,115,41,0,75,0,
+116,101,109,112,99,101,108,115,105,117,115,0,116,101,109,112,70,0,120,0,
+40,120,43,40,45,51,50,41,41,32,100,101,103,70,32,43,32,115,116,100,
+116,101,109,112,0,0,40,116,101,109,112,70,43,40,45,115,116,100,116,101,
+109,112,41,41,47,100,101,103,70,32,43,32,51,50,0,75,0,116,101,109,
+112,70,0,116,101,109,112,102,97,104,114,101,110,104,101,105,116,0,120,0,
+116,101,109,112,70,40,120,41,0,0,126,116,101,109,112,70,40,116,101,109,
+112,102,97,104,114,101,110,104,101,105,116,41,0,75,0,116,101,109,112,102,
+97,104,114,101,110,104,101,105,116,0,116,101,109,112,114,101,97,117,109,117,
+114,0,120,0,120,32,100,101,103,114,101,97,117,109,117,114,43,115,116,100,
+116,101,109,112,0,0,40,116,101,109,112,114,101,97,117,109,117,114,43,40,
+45,115,116,100,116,101,109,112,41,41,47,100,101,103,114,101,97,117,109,117,
+114,0,75,0,116,101,109,112,114,101,97,117,109,117,114,0,103,97,115,109,
+97,114,107,0,100,101,103,82,0,98,114,105,108,0,120,0,50,94,40,120,
+43,45,49,48,48,41,32,108,97,109,98,101,114,116,115,0,0,108,111,103,
+50,40,98,114,105,108,47,108,97,109,98,101,114,116,41,43,49,48,48,0,
+108,97,109,98,101,114,116,0,98,114,105,108,0,101,118,49,48,48,0,120,
+0,50,94,120,32,107,49,50,53,48,32,47,32,115,49,48,48,0,0,108,
+111,103,50,40,101,118,49,48,48,32,115,49,48,48,32,47,32,107,49,50,
+53,48,41,0,99,100,47,109,94,50,0,101,118,49,48,48,0,105,118,49,
+48,48,0,120,0,50,94,120,32,99,50,53,48,32,47,32,115,49,48,48,
+0,49,0,108,111,103,50,40,105,118,49,48,48,32,115,49,48,48,32,47,
+32,99,50,53,48,41,0,108,120,0,105,118,49,48,48,0,115,104,111,101,
+115,105,122,101,95,109,101,110,0,110,0,115,104,111,101,95,109,101,110,48,
+32,43,32,110,32,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,
+0,40,115,104,111,101,115,105,122,101,95,109,101,110,43,40,45,115,104,111,
+101,95,109,101,110,48,41,41,47,115,104,111,101,115,105,122,101,95,100,101,
+108,116,97,0,105,110,99,104,0,115,104,111,101,115,105,122,101,95,109,101,
+110,0,115,104,111,101,115,105,122,101,95,119,111,109,101,110,0,110,0,115,
+104,111,101,95,119,111,109,101,110,48,32,43,32,110,32,115,104,111,101,115,
+105,122,101,95,100,101,108,116,97,0,0,40,115,104,111,101,115,105,122,101,
+95,119,111,109,101,110,43,40,45,115,104,111,101,95,119,111,109,101,110,48,
+41,41,47,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,105,110,
+99,104,0,115,104,111,101,115,105,122,101,95,119,111,109,101,110,0,115,104,
+111,101,115,105,122,101,95,98,111,121,115,0,110,0,115,104,111,101,95,98,
+111,121,115,48,32,43,32,110,32,115,104,111,101,115,105,122,101,95,100,101,
+108,116,97,0,0,40,115,104,111,101,115,105,122,101,95,98,111,121,115,43,
+40,45,115,104,111,101,95,98,111,121,115,48,41,41,47,115,104,111,101,115,
+105,122,101,95,100,101,108,116,97,0,105,110,99,104,0,115,104,111,101,115,
+105,122,101,95,98,111,121,115,0,115,104,111,101,115,105,122,101,95,103,105,
+114,108,115,0,110,0,115,104,111,101,95,103,105,114,108,115,48,32,43,32,
+110,32,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,0,40,115,
+104,111,101,115,105,122,101,95,103,105,114,108,115,43,40,45,115,104,111,101,
+95,103,105,114,108,115,48,41,41,47,115,104,111,101,115,105,122,101,95,100,
+101,108,116,97,0,105,110,99,104,0,115,104,111,101,115,105,122,101,95,103,
+105,114,108,115,0,98,97,117,109,101,0,100,0,40,98,97,117,109,101,99,
+111,110,115,116,47,40,98,97,117,109,101,99,111,110,115,116,43,45,100,41,
+41,32,103,47,99,109,94,51,0,49,0,40,98,97,117,109,101,43,40,40,
+45,103,41,47,99,109,94,51,41,41,32,98,97,117,109,101,99,111,110,115,
+116,32,47,32,98,97,117,109,101,0,103,47,99,109,94,51,0,98,97,117,
+109,101,0,116,119,97,100,100,101,108,108,0,120,0,40,49,32,43,32,48,
+46,48,48,53,32,120,41,32,103,32,47,32,99,109,94,51,0,49,0,50,
+48,48,32,40,116,119,97,100,100,101,108,108,32,47,32,40,103,47,99,109,
+94,51,41,32,43,45,32,49,41,0,103,47,99,109,94,51,0,116,119,97,
+100,100,101,108,108,0,113,117,101,118,101,110,110,101,0,120,0,40,49,32,
+43,32,48,46,48,48,49,32,120,41,32,103,32,47,32,99,109,94,51,0,
+49,0,49,48,48,48,32,40,113,117,101,118,101,110,110,101,32,47,32,40,
+103,47,99,109,94,51,41,32,43,45,32,49,41,0,103,47,99,109,94,51,
+0,113,117,101,118,101,110,110,101,0,98,114,105,120,0,103,47,99,109,94,
+51,0,97,112,105,100,101,103,114,101,101,0,120,0,49,52,49,46,53,32,
+103,47,99,109,94,51,32,47,32,40,120,43,49,51,49,46,53,41,0,49,
+0,49,52,49,46,53,32,40,103,47,99,109,94,51,41,32,47,32,97,112,
+105,100,101,103,114,101,101,32,43,32,40,45,49,51,49,46,53,41,0,103,
+47,99,109,94,51,0,97,112,105,100,101,103,114,101,101,0,98,101,108,0,
+120,0,49,48,94,40,120,41,0,49,0,108,111,103,40,98,101,108,41,0,
+49,0,98,101,108,0,100,101,99,105,98,101,108,0,120,0,49,48,94,40,
+120,47,49,48,41,0,49,0,49,48,32,108,111,103,40,100,101,99,105,98,
+101,108,41,0,49,0,100,101,99,105,98,101,108,0,100,66,0,120,0,49,
+48,94,40,120,47,49,48,41,0,49,0,49,48,32,108,111,103,40,100,66,
+41,0,49,0,100,66,0,100,66,87,0,120,0,100,66,40,120,41,32,87,
+0,49,0,126,100,66,40,100,66,87,47,87,41,0,87,0,100,66,87,0,
+100,66,107,0,120,0,100,66,40,120,41,32,107,87,0,49,0,126,100,66,
+40,100,66,107,47,107,87,41,0,87,0,100,66,107,0,100,66,102,0,120,
+0,100,66,40,120,41,32,102,87,0,49,0,126,100,66,40,100,66,102,47,
+102,87,41,0,87,0,100,66,102,0,100,66,109,0,120,0,100,66,40,120,
+41,32,109,87,0,49,0,126,100,66,40,100,66,109,47,109,87,41,0,87,
+0,100,66,109,0,100,66,109,87,0,120,0,100,66,109,40,120,41,0,49,
+0,126,100,66,109,40,100,66,109,87,41,0,87,0,100,66,109,87,0,100,
+66,74,0,120,0,100,66,40,120,41,32,74,0,49,0,126,100,66,40,100,
+66,74,47,74,41,0,74,0,100,66,74,0,100,66,86,0,120,0,100,66,
+40,48,46,53,32,120,41,32,86,0,49,0,126,100,66,40,100,66,86,94,
+50,32,47,32,86,94,50,41,0,86,0,100,66,86,0,100,66,109,86,0,
+120,0,100,66,40,48,46,53,32,120,41,32,109,86,0,49,0,126,100,66,
+40,100,66,109,86,94,50,32,47,32,109,86,94,50,41,0,86,0,100,66,
+109,86,0,100,66,117,86,0,120,0,100,66,40,48,46,53,32,120,41,32,
+109,105,99,114,111,86,0,49,0,126,100,66,40,100,66,117,86,94,50,32,
+47,32,109,105,99,114,111,86,94,50,41,0,86,0,100,66,117,86,0,100,
+66,117,0,120,0,100,66,40,48,46,53,32,120,41,32,115,113,114,116,40,
+109,87,32,54,48,48,32,111,104,109,41,0,49,0,126,100,66,40,100,66,
+117,94,50,32,47,32,109,87,32,54,48,48,32,111,104,109,41,0,86,0,
+100,66,117,0,100,66,118,0,120,0,100,66,117,40,120,41,0,49,0,126,
+100,66,117,40,100,66,118,41,0,86,0,100,66,118,0,100,66,83,80,76,
+0,120,0,100,66,40,48,46,53,32,120,41,32,50,48,32,109,105,99,114,
+111,80,97,0,49,0,126,100,66,40,100,66,83,80,76,94,50,32,47,32,
+40,50,48,32,109,105,99,114,111,80,97,41,94,50,41,0,80,97,0,100,
+66,83,80,76,0,100,66,83,73,76,0,120,0,100,66,40,120,41,32,49,
+101,45,49,50,32,87,47,109,94,50,0,49,0,126,100,66,40,100,66,83,
+73,76,32,47,32,40,49,101,45,49,50,32,87,47,109,94,50,41,41,0,
+87,47,109,94,50,0,100,66,83,73,76,0,100,66,83,87,76,0,120,0,
+100,66,40,120,41,32,49,101,45,49,50,32,87,0,49,0,126,100,66,40,
+100,66,83,87,76,47,49,101,45,49,50,32,87,41,0,87,0,100,66,83,
+87,76,0,109,117,115,105,99,97,108,99,101,110,116,0,120,0,115,101,109,
+105,116,111,110,101,94,40,120,47,49,48,48,41,0,49,0,49,48,48,32,
+108,111,103,40,109,117,115,105,99,97,108,99,101,110,116,41,47,108,111,103,
+40,115,101,109,105,116,111,110,101,41,0,49,0,109,117,115,105,99,97,108,
+99,101,110,116,0,119,105,114,101,103,97,117,103,101,0,103,0,49,124,50,
+48,48,32,57,50,94,40,40,51,54,43,40,45,103,41,41,47,51,57,41,
+32,105,110,0,0,51,54,43,40,45,51,57,41,108,110,40,50,48,48,32,
+119,105,114,101,103,97,117,103,101,47,105,110,41,47,108,110,40,57,50,41,
+0,109,0,119,105,114,101,103,97,117,103,101,0,98,114,119,105,114,101,103,
+97,117,103,101,0,105,110,0,112,108,97,116,101,103,97,117,103,101,0,40,
+111,122,47,102,116,94,50,41,47,40,52,56,48,42,108,98,47,102,116,94,
+51,41,0,115,116,100,103,97,117,103,101,0,40,111,122,47,102,116,94,50,
+41,47,40,53,48,49,46,56,52,42,108,98,47,102,116,94,51,41,0,122,
+105,110,99,103,97,117,103,101,0,105,110,0,115,99,114,101,119,103,97,117,
+103,101,0,103,0,40,46,48,54,32,43,32,46,48,49,51,32,103,41,32,
+105,110,0,0,40,115,99,114,101,119,103,97,117,103,101,47,105,110,32,43,
+32,40,45,46,48,54,41,41,32,47,32,46,48,49,51,0,109,0,115,99,
+114,101,119,103,97,117,103,101,0,103,114,105,116,95,80,0,109,105,99,114,
+111,110,0,103,114,105,116,95,70,0,109,105,99,114,111,110,0,103,114,105,
+116,95,97,110,115,105,98,111,110,100,101,100,0,109,105,99,114,111,110,0,
+97,110,115,105,99,111,97,116,101,100,0,109,105,99,114,111,110,0,106,105,
+115,103,114,105,116,0,109,105,99,114,111,110,0,103,114,105,116,95,65,0,
+109,105,99,114,111,110,0,114,105,110,103,115,105,122,101,0,110,0,40,49,
+46,52,50,49,54,43,46,49,48,49,56,32,110,41,32,105,110,0,0,40,
+114,105,110,103,115,105,122,101,47,105,110,32,43,32,40,45,49,46,52,50,
+49,54,41,41,47,46,49,48,49,56,0,105,110,0,114,105,110,103,115,105,
+122,101,0,106,112,114,105,110,103,115,105,122,101,0,110,0,40,51,56,124,
+51,32,43,32,110,47,51,41,32,112,105,32,109,109,0,0,51,32,106,112,
+114,105,110,103,115,105,122,101,47,32,112,105,32,109,109,32,43,32,40,45,
+51,56,41,0,109,109,0,106,112,114,105,110,103,115,105,122,101,0,101,117,
+114,105,110,103,115,105,122,101,0,110,0,40,110,43,52,48,41,32,109,109,
+0,0,101,117,114,105,110,103,115,105,122,101,47,109,109,32,43,32,40,45,
+52,48,41,0,109,109,0,101,117,114,105,110,103,115,105,122,101,0,101,110,
+95,71,66,0,107,103,0,33,0,107,105,108,111,103,114,97,109,0,107,103,
+0,115,0,33,0,115,101,99,111,110,100,0,115,0,109,0,33,0,109,101,
+116,101,114,0,109,0,65,0,33,0,97,109,112,101,114,101,0,65,0,97,
+109,112,0,97,109,112,101,114,101,0,99,100,0,33,0,99,97,110,100,101,
+108,97,0,99,100,0,109,111,108,0,33,0,109,111,108,101,0,109,111,108,
+0,75,0,33,0,107,101,108,118,105,110,0,75,0,114,97,100,105,97,110,
+0,33,100,105,109,101,110,115,105,111,110,108,101,115,115,0,115,114,0,33,
+100,105,109,101,110,115,105,111,110,108,101,115,115,0,115,116,101,114,97,100,
+105,97,110,0,115,114,0,85,83,36,0,33,0,98,105,116,0,33,0,111,
+110,101,0,49,0,116,119,111,0,50,0,100,111,117,98,108,101,0,50,0,
+99,111,117,112,108,101,0,50,0,116,104,114,101,101,0,51,0,116,114,105,
+112,108,101,0,51,0,102,111,117,114,0,52,0,113,117,97,100,114,117,112,
+108,101,0,52,0,102,105,118,101,0,53,0,113,117,105,110,116,117,112,108,
+101,0,53,0,115,105,120,0,54,0,115,101,118,101,110,0,55,0,101,105,
+103,104,116,0,56,0,110,105,110,101,0,57,0,116,101,110,0,49,48,0,
+101,108,101,118,101,110,0,49,49,0,116,119,101,108,118,101,0,49,50,0,
+116,104,105,114,116,101,101,110,0,49,51,0,102,111,117,114,116,101,101,110,
+0,49,52,0,102,105,102,116,101,101,110,0,49,53,0,115,105,120,116,101,
+101,110,0,49,54,0,115,101,118,101,110,116,101,101,110,0,49,55,0,101,
+105,103,104,116,101,101,110,0,49,56,0,110,105,110,101,116,101,101,110,0,
+49,57,0,116,119,101,110,116,121,0,50,48,0,116,104,105,114,116,121,0,
+51,48,0,102,111,114,116,121,0,52,48,0,102,105,102,116,121,0,53,48,
+0,115,105,120,116,121,0,54,48,0,115,101,118,101,110,116,121,0,55,48,
+0,101,105,103,104,116,121,0,56,48,0,110,105,110,101,116,121,0,57,48,
+0,104,117,110,100,114,101,100,0,49,48,48,0,116,104,111,117,115,97,110,
+100,0,49,48,48,48,0,109,105,108,108,105,111,110,0,49,101,54,0,115,
+104,111,114,116,98,105,108,108,105,111,110,0,49,101,57,0,115,104,111,114,
+116,116,114,105,108,108,105,111,110,0,49,101,49,50,0,115,104,111,114,116,
+113,117,97,100,114,105,108,108,105,111,110,0,49,101,49,53,0,115,104,111,
+114,116,113,117,105,110,116,105,108,108,105,111,110,0,49,101,49,56,0,115,
+104,111,114,116,115,101,120,116,105,108,108,105,111,110,0,49,101,50,49,0,
+115,104,111,114,116,115,101,112,116,105,108,108,105,111,110,0,49,101,50,52,
+0,115,104,111,114,116,111,99,116,105,108,108,105,111,110,0,49,101,50,55,
+0,115,104,111,114,116,110,111,110,105,108,108,105,111,110,0,49,101,51,48,
+0,115,104,111,114,116,110,111,118,101,110,116,105,108,108,105,111,110,0,115,
+104,111,114,116,110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,100,
+101,99,105,108,108,105,111,110,0,49,101,51,51,0,115,104,111,114,116,117,
+110,100,101,99,105,108,108,105,111,110,0,49,101,51,54,0,115,104,111,114,
+116,100,117,111,100,101,99,105,108,108,105,111,110,0,49,101,51,57,0,115,
+104,111,114,116,116,114,101,100,101,99,105,108,108,105,111,110,0,49,101,52,
+50,0,115,104,111,114,116,113,117,97,116,116,117,111,114,100,101,99,105,108,
+108,105,111,110,0,49,101,52,53,0,115,104,111,114,116,113,117,105,110,100,
+101,99,105,108,108,105,111,110,0,49,101,52,56,0,115,104,111,114,116,115,
+101,120,100,101,99,105,108,108,105,111,110,0,49,101,53,49,0,115,104,111,
+114,116,115,101,112,116,101,110,100,101,99,105,108,108,105,111,110,0,49,101,
+53,52,0,115,104,111,114,116,111,99,116,111,100,101,99,105,108,108,105,111,
+110,0,49,101,53,55,0,115,104,111,114,116,110,111,118,101,109,100,101,99,
+105,108,108,105,111,110,0,49,101,54,48,0,115,104,111,114,116,118,105,103,
+105,110,116,105,108,108,105,111,110,0,49,101,54,51,0,99,101,110,116,105,
+108,108,105,111,110,0,49,101,51,48,51,0,103,111,111,103,111,108,0,49,
+101,49,48,48,0,108,111,110,103,98,105,108,108,105,111,110,0,109,105,108,
+108,105,111,110,94,50,0,108,111,110,103,116,114,105,108,108,105,111,110,0,
+109,105,108,108,105,111,110,94,51,0,108,111,110,103,113,117,97,100,114,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,52,0,108,111,110,103,
+113,117,105,110,116,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,
+53,0,108,111,110,103,115,101,120,116,105,108,108,105,111,110,0,109,105,108,
+108,105,111,110,94,54,0,108,111,110,103,115,101,112,116,105,108,108,105,111,
+110,0,109,105,108,108,105,111,110,94,55,0,108,111,110,103,111,99,116,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,56,0,108,111,110,103,
+110,111,110,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,57,0,
+108,111,110,103,110,111,118,101,110,116,105,108,108,105,111,110,0,108,111,110,
+103,110,111,110,105,108,108,105,111,110,0,108,111,110,103,100,101,99,105,108,
+108,105,111,110,0,109,105,108,108,105,111,110,94,49,48,0,108,111,110,103,
+117,110,100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,
+49,49,0,108,111,110,103,100,117,111,100,101,99,105,108,108,105,111,110,0,
+109,105,108,108,105,111,110,94,49,50,0,108,111,110,103,116,114,101,100,101,
+99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,51,0,108,
+111,110,103,113,117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,
+0,109,105,108,108,105,111,110,94,49,52,0,108,111,110,103,113,117,105,110,
+100,101,99,105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,53,
+0,108,111,110,103,115,101,120,100,101,99,105,108,108,105,111,110,0,109,105,
+108,108,105,111,110,94,49,54,0,108,111,110,103,115,101,112,116,100,101,99,
+105,108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,55,0,108,111,
+110,103,111,99,116,111,100,101,99,105,108,108,105,111,110,0,109,105,108,108,
+105,111,110,94,49,56,0,108,111,110,103,110,111,118,101,109,100,101,99,105,
+108,108,105,111,110,0,109,105,108,108,105,111,110,94,49,57,0,108,111,110,
+103,118,105,103,105,110,116,105,108,108,105,111,110,0,109,105,108,108,105,111,
+110,94,50,48,0,109,105,108,108,105,97,114,100,0,49,48,48,48,32,109,
+105,108,108,105,111,110,0,98,105,108,108,105,97,114,100,0,49,48,48,48,
+32,109,105,108,108,105,111,110,94,50,0,116,114,105,108,108,105,97,114,100,
+0,49,48,48,48,32,109,105,108,108,105,111,110,94,51,0,113,117,97,100,
+114,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,
+110,94,52,0,113,117,105,110,116,105,108,108,105,97,114,100,0,49,48,48,
+48,32,109,105,108,108,105,111,110,94,53,0,115,101,120,116,105,108,108,105,
+97,114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,54,0,115,
+101,112,116,105,108,108,105,97,114,100,0,49,48,48,48,32,109,105,108,108,
+105,111,110,94,55,0,111,99,116,105,108,108,105,97,114,100,0,49,48,48,
+48,32,109,105,108,108,105,111,110,94,56,0,110,111,110,105,108,108,105,97,
+114,100,0,49,48,48,48,32,109,105,108,108,105,111,110,94,57,0,110,111,
+118,101,110,116,105,108,108,105,97,114,100,0,110,111,110,105,108,108,105,97,
+114,100,0,100,101,99,105,108,108,105,97,114,100,0,49,48,48,48,32,109,
+105,108,108,105,111,110,94,49,48,0,108,111,110,103,109,105,108,108,105,97,
+114,100,0,109,105,108,108,105,97,114,100,0,108,111,110,103,98,105,108,108,
+105,97,114,100,0,98,105,108,108,105,97,114,100,0,108,111,110,103,116,114,
+105,108,108,105,97,114,100,0,116,114,105,108,108,105,97,114,100,0,108,111,
+110,103,113,117,97,100,114,105,108,108,105,97,114,100,0,113,117,97,100,114,
+105,108,108,105,97,114,100,0,108,111,110,103,113,117,105,110,116,105,108,108,
+105,97,114,100,0,113,117,105,110,116,105,108,108,105,97,114,100,0,108,111,
+110,103,115,101,120,116,105,108,108,105,97,114,100,0,115,101,120,116,105,108,
+108,105,97,114,100,0,108,111,110,103,115,101,112,116,105,108,108,105,97,114,
+100,0,115,101,112,116,105,108,108,105,97,114,100,0,108,111,110,103,111,99,
+116,105,108,108,105,97,114,100,0,111,99,116,105,108,108,105,97,114,100,0,
+108,111,110,103,110,111,110,105,108,108,105,97,114,100,0,110,111,110,105,108,
+108,105,97,114,100,0,108,111,110,103,110,111,118,101,110,116,105,108,108,105,
+97,114,100,0,110,111,118,101,110,116,105,108,108,105,97,114,100,0,108,111,
+110,103,100,101,99,105,108,108,105,97,114,100,0,100,101,99,105,108,108,105,
+97,114,100,0,98,105,108,108,105,111,110,0,115,104,111,114,116,98,105,108,
+108,105,111,110,0,116,114,105,108,108,105,111,110,0,115,104,111,114,116,116,
+114,105,108,108,105,111,110,0,113,117,97,100,114,105,108,108,105,111,110,0,
+115,104,111,114,116,113,117,97,100,114,105,108,108,105,111,110,0,113,117,105,
+110,116,105,108,108,105,111,110,0,115,104,111,114,116,113,117,105,110,116,105,
+108,108,105,111,110,0,115,101,120,116,105,108,108,105,111,110,0,115,104,111,
+114,116,115,101,120,116,105,108,108,105,111,110,0,115,101,112,116,105,108,108,
+105,111,110,0,115,104,111,114,116,115,101,112,116,105,108,108,105,111,110,0,
+111,99,116,105,108,108,105,111,110,0,115,104,111,114,116,111,99,116,105,108,
+108,105,111,110,0,110,111,110,105,108,108,105,111,110,0,115,104,111,114,116,
+110,111,110,105,108,108,105,111,110,0,110,111,118,101,110,116,105,108,108,105,
+111,110,0,115,104,111,114,116,110,111,118,101,110,116,105,108,108,105,111,110,
+0,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,100,101,99,105,
+108,108,105,111,110,0,117,110,100,101,99,105,108,108,105,111,110,0,115,104,
+111,114,116,117,110,100,101,99,105,108,108,105,111,110,0,100,117,111,100,101,
+99,105,108,108,105,111,110,0,115,104,111,114,116,100,117,111,100,101,99,105,
+108,108,105,111,110,0,116,114,101,100,101,99,105,108,108,105,111,110,0,115,
+104,111,114,116,116,114,101,100,101,99,105,108,108,105,111,110,0,113,117,97,
+116,116,117,111,114,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,
+113,117,97,116,116,117,111,114,100,101,99,105,108,108,105,111,110,0,113,117,
+105,110,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,113,117,105,
+110,100,101,99,105,108,108,105,111,110,0,115,101,120,100,101,99,105,108,108,
+105,111,110,0,115,104,111,114,116,115,101,120,100,101,99,105,108,108,105,111,
+110,0,115,101,112,116,101,110,100,101,99,105,108,108,105,111,110,0,115,104,
+111,114,116,115,101,112,116,101,110,100,101,99,105,108,108,105,111,110,0,111,
+99,116,111,100,101,99,105,108,108,105,111,110,0,115,104,111,114,116,111,99,
+116,111,100,101,99,105,108,108,105,111,110,0,110,111,118,101,109,100,101,99,
+105,108,108,105,111,110,0,115,104,111,114,116,110,111,118,101,109,100,101,99,
+105,108,108,105,111,110,0,118,105,103,105,110,116,105,108,108,105,111,110,0,
+115,104,111,114,116,118,105,103,105,110,116,105,108,108,105,111,110,0,110,101,
+119,116,111,110,0,107,103,32,109,32,47,32,115,94,50,0,78,0,110,101,
+119,116,111,110,0,112,97,115,99,97,108,0,78,47,109,94,50,0,80,97,
+0,112,97,115,99,97,108,0,106,111,117,108,101,0,78,32,109,0,74,0,
+106,111,117,108,101,0,119,97,116,116,0,74,47,115,0,87,0,119,97,116,
+116,0,99,111,117,108,111,109,98,0,65,32,115,0,67,0,99,111,117,108,
+111,109,98,0,118,111,108,116,0,87,47,65,0,86,0,118,111,108,116,0,
+111,104,109,0,86,47,65,0,115,105,101,109,101,110,115,0,65,47,86,0,
+83,0,115,105,101,109,101,110,115,0,102,97,114,97,100,0,67,47,86,0,
+70,0,102,97,114,97,100,0,119,101,98,101,114,0,86,32,115,0,87,98,
+0,119,101,98,101,114,0,104,101,110,114,121,0,87,98,47,65,0,72,0,
+104,101,110,114,121,0,116,101,115,108,97,0,87,98,47,109,94,50,0,84,
+0,116,101,115,108,97,0,104,101,114,116,122,0,47,115,0,72,122,0,104,
+101,114,116,122,0,76,69,78,71,84,72,0,109,101,116,101,114,0,65,82,
+69,65,0,76,69,78,71,84,72,94,50,0,86,79,76,85,77,69,0,76,
+69,78,71,84,72,94,51,0,77,65,83,83,0,107,105,108,111,103,114,97,
+109,0,67,85,82,82,69,78,84,0,97,109,112,101,114,101,0,65,77,79,
+85,78,84,0,109,111,108,101,0,65,78,71,76,69,0,114,97,100,105,97,
+110,0,83,79,76,73,68,95,65,78,71,76,69,0,115,116,101,114,97,100,
+105,97,110,0,77,79,78,69,89,0,85,83,36,0,70,79,82,67,69,0,
+110,101,119,116,111,110,0,80,82,69,83,83,85,82,69,0,70,79,82,67,
+69,32,47,32,65,82,69,65,0,83,84,82,69,83,83,0,70,79,82,67,
+69,32,47,32,65,82,69,65,0,67,72,65,82,71,69,0,99,111,117,108,
+111,109,98,0,67,65,80,65,67,73,84,65,78,67,69,0,102,97,114,97,
+100,0,82,69,83,73,83,84,65,78,67,69,0,111,104,109,0,67,79,78,
+68,85,67,84,65,78,67,69,0,115,105,101,109,101,110,115,0,73,78,68,
+85,67,84,65,78,67,69,0,104,101,110,114,121,0,70,82,69,81,85,69,
+78,67,89,0,104,101,114,116,122,0,86,69,76,79,67,73,84,89,0,76,
+69,78,71,84,72,32,47,32,84,73,77,69,0,65,67,67,69,76,69,82,
+65,84,73,79,78,0,86,69,76,79,67,73,84,89,32,47,32,84,73,77,
+69,0,68,69,78,83,73,84,89,0,77,65,83,83,32,47,32,86,79,76,
+85,77,69,0,76,73,78,69,65,82,95,68,69,78,83,73,84,89,0,77,
+65,83,83,32,47,32,76,69,78,71,84,72,0,86,73,83,67,79,83,73,
+84,89,0,70,79,82,67,69,32,84,73,77,69,32,47,32,65,82,69,65,
+0,75,73,78,69,77,65,84,73,67,95,86,73,83,67,79,83,73,84,89,
+0,86,73,83,67,79,83,73,84,89,32,47,32,68,69,78,83,73,84,89,
+0,103,114,97,109,0,109,105,108,108,105,107,103,0,103,109,0,103,114,97,
+109,0,103,0,103,114,97,109,0,116,111,110,110,101,0,49,48,48,48,32,
+107,103,0,116,0,116,111,110,110,101,0,109,101,116,114,105,99,116,111,110,
+0,116,111,110,110,101,0,115,116,104,101,110,101,0,116,111,110,110,101,32,
+109,32,47,32,115,94,50,0,102,117,110,97,108,0,115,116,104,101,110,101,
+0,112,105,101,122,101,0,115,116,104,101,110,101,32,47,32,109,94,50,0,
+113,117,105,110,116,97,108,0,49,48,48,32,107,103,0,98,97,114,0,49,
+101,53,32,80,97,0,118,97,99,0,109,105,108,108,105,98,97,114,0,109,
+105,99,114,111,110,0,109,105,99,114,111,109,101,116,101,114,0,98,105,99,
+114,111,110,0,112,105,99,111,109,101,116,101,114,0,99,99,0,99,109,94,
+51,0,97,114,101,0,49,48,48,32,109,94,50,0,108,105,116,101,114,0,
+49,48,48,48,32,99,99,0,111,108,100,108,105,116,101,114,0,49,46,48,
+48,48,48,50,56,32,100,109,94,51,0,108,0,108,105,116,101,114,0,76,
+0,108,105,116,101,114,0,109,104,111,0,115,105,101,109,101,110,115,0,103,
+97,108,118,97,116,0,97,109,112,101,114,101,0,97,110,103,115,116,114,111,
+109,0,49,101,45,49,48,32,109,0,120,117,110,105,116,0,49,46,48,48,
+50,48,50,101,45,49,51,32,109,101,116,101,114,0,115,105,101,103,98,97,
+104,110,0,120,117,110,105,116,0,102,101,114,109,105,0,49,101,45,49,53,
+32,109,0,98,97,114,110,0,49,101,45,50,56,32,109,94,50,0,115,104,
+101,100,0,49,101,45,50,52,32,98,97,114,110,0,98,114,101,119,115,116,
+101,114,0,109,105,99,114,111,110,94,50,47,78,0,100,105,111,112,116,101,
+114,0,47,109,0,102,114,101,115,110,101,108,0,49,101,49,50,32,72,122,
+0,115,104,97,107,101,0,49,101,45,56,32,115,101,99,0,115,118,101,100,
+98,101,114,103,0,49,101,45,49,51,32,115,0,103,97,109,109,97,0,109,
+105,99,114,111,103,114,97,109,0,108,97,109,98,100,97,0,109,105,99,114,
+111,108,105,116,101,114,0,115,112,97,116,0,49,101,49,50,32,109,0,112,
+114,101,101,99,101,0,49,101,49,51,32,111,104,109,32,109,0,112,108,97,
+110,99,107,0,74,32,115,0,115,116,117,114,103,101,111,110,0,47,104,101,
+110,114,121,0,100,97,114,97,102,0,49,47,102,97,114,97,100,0,108,101,
+111,0,49,48,32,109,47,115,94,50,0,112,111,105,115,101,117,105,108,108,
+101,0,78,32,115,32,47,32,109,94,50,0,109,97,121,101,114,0,74,47,
+103,32,75,0,109,105,114,101,100,0,47,32,109,105,99,114,111,75,0,99,
+114,111,99,111,100,105,108,101,0,109,101,103,97,118,111,108,116,0,109,101,
+116,114,105,99,111,117,110,99,101,0,50,53,32,103,0,109,111,117,110,99,
+101,0,109,101,116,114,105,99,111,117,110,99,101,0,102,105,110,115,101,110,
+117,110,105,116,0,49,101,53,32,87,47,109,94,50,0,102,108,117,120,117,
+110,105,116,0,49,101,45,50,54,32,87,47,109,94,50,32,72,122,0,106,
+97,110,115,107,121,0,102,108,117,120,117,110,105,116,0,74,121,0,106,97,
+110,115,107,121,0,112,102,117,0,47,32,99,109,94,50,32,115,114,32,115,
+0,112,121,114,111,110,0,99,97,108,95,73,84,32,47,32,99,109,94,50,
+32,109,105,110,0,107,97,116,97,108,0,109,111,108,47,115,101,99,0,107,
+97,116,0,107,97,116,97,108,0,115,101,99,0,115,0,109,105,110,117,116,
+101,0,54,48,32,115,0,109,105,110,0,109,105,110,117,116,101,0,104,111,
+117,114,0,54,48,32,109,105,110,0,104,114,0,104,111,117,114,0,100,97,
+121,0,50,52,32,104,114,0,100,0,100,97,121,0,100,97,0,100,97,121,
+0,119,101,101,107,0,55,32,100,97,121,0,119,107,0,119,101,101,107,0,
+115,101,110,110,105,103,104,116,0,55,32,100,97,121,0,102,111,114,116,110,
+105,103,104,116,0,49,52,32,100,97,121,0,98,108,105,110,107,0,49,101,
+45,53,32,100,97,121,0,99,101,0,49,101,45,50,32,100,97,121,0,99,
+114,111,110,0,49,101,54,32,121,101,97,114,115,0,119,97,116,99,104,0,
+52,32,104,111,117,114,115,0,98,101,108,108,0,49,124,56,32,119,97,116,
+99,104,0,99,105,114,99,108,101,0,50,32,112,105,32,114,97,100,105,97,
+110,0,100,101,103,114,101,101,0,49,124,51,54,48,32,99,105,114,99,108,
+101,0,100,101,103,0,100,101,103,114,101,101,0,97,114,99,100,101,103,0,
+100,101,103,114,101,101,0,97,114,99,109,105,110,0,49,124,54,48,32,100,
+101,103,114,101,101,0,97,114,99,109,105,110,117,116,101,0,97,114,99,109,
+105,110,0,39,0,97,114,99,109,105,110,0,97,114,99,115,101,99,0,49,
+124,54,48,32,97,114,99,109,105,110,0,97,114,99,115,101,99,111,110,100,
+0,97,114,99,115,101,99,0,34,0,97,114,99,115,101,99,0,39,39,0,
+34,0,114,105,103,104,116,97,110,103,108,101,0,57,48,32,100,101,103,114,
+101,101,115,0,113,117,97,100,114,97,110,116,0,49,124,52,32,99,105,114,
+99,108,101,0,113,117,105,110,116,97,110,116,0,49,124,53,32,99,105,114,
+99,108,101,0,115,101,120,116,97,110,116,0,49,124,54,32,99,105,114,99,
+108,101,0,115,105,103,110,0,49,124,49,50,32,99,105,114,99,108,101,0,
+116,117,114,110,0,99,105,114,99,108,101,0,114,101,118,111,108,117,116,105,
+111,110,0,116,117,114,110,0,114,101,118,0,116,117,114,110,0,112,117,108,
+115,97,116,97,110,99,101,0,114,97,100,105,97,110,32,47,32,115,101,99,
+0,103,111,110,0,49,124,49,48,48,32,114,105,103,104,116,97,110,103,108,
+101,0,103,114,97,100,101,0,103,111,110,0,99,101,110,116,101,115,105,109,
+97,108,109,105,110,117,116,101,0,49,124,49,48,48,32,103,114,97,100,101,
+0,99,101,110,116,101,115,105,109,97,108,115,101,99,111,110,100,0,49,124,
+49,48,48,32,99,101,110,116,101,115,105,109,97,108,109,105,110,117,116,101,
+0,109,105,108,97,110,103,108,101,0,49,124,54,52,48,48,32,99,105,114,
+99,108,101,0,112,111,105,110,116,97,110,103,108,101,0,49,124,51,50,32,
+99,105,114,99,108,101,0,99,101,110,116,114,97,100,0,48,46,48,49,32,
+114,97,100,105,97,110,0,109,97,115,0,109,105,108,108,105,32,97,114,99,
+115,101,99,0,115,101,99,108,111,110,103,105,116,117,100,101,0,99,105,114,
+99,108,101,32,40,115,101,99,111,110,100,115,47,100,97,121,41,0,115,112,
+104,101,114,101,0,52,32,112,105,32,115,114,0,115,113,117,97,114,101,100,
+101,103,114,101,101,0,49,124,49,56,48,94,50,32,112,105,94,50,32,115,
+114,0,115,113,117,97,114,101,109,105,110,117,116,101,0,49,124,54,48,94,
+50,32,115,113,117,97,114,101,100,101,103,114,101,101,0,115,113,117,97,114,
+101,115,101,99,111,110,100,0,49,124,54,48,94,50,32,115,113,117,97,114,
+101,109,105,110,117,116,101,0,115,113,117,97,114,101,97,114,99,109,105,110,
+0,115,113,117,97,114,101,109,105,110,117,116,101,0,115,113,117,97,114,101,
+97,114,99,115,101,99,0,115,113,117,97,114,101,115,101,99,111,110,100,0,
+115,112,104,101,114,105,99,97,108,114,105,103,104,116,97,110,103,108,101,0,
+48,46,53,32,112,105,32,115,114,0,111,99,116,97,110,116,0,48,46,53,
+32,112,105,32,115,114,0,112,101,114,99,101,110,116,0,48,46,48,49,0,
+37,0,112,101,114,99,101,110,116,0,109,105,108,108,0,48,46,48,48,49,
+0,112,114,111,111,102,0,49,124,50,48,48,0,112,112,109,0,49,101,45,
+54,0,112,97,114,116,115,112,101,114,109,105,108,108,105,111,110,0,112,112,
+109,0,112,112,98,0,49,101,45,57,0,112,97,114,116,115,112,101,114,98,
+105,108,108,105,111,110,0,112,112,98,0,112,112,116,0,49,101,45,49,50,
+0,112,97,114,116,115,112,101,114,116,114,105,108,108,105,111,110,0,112,112,
+116,0,107,97,114,97,116,0,49,124,50,52,0,99,97,114,97,116,103,111,
+108,100,0,107,97,114,97,116,0,103,97,109,109,105,108,0,109,103,47,108,
+0,98,97,115,105,115,112,111,105,110,116,0,48,46,48,49,32,37,0,102,
+105,110,101,0,49,124,49,48,48,48,0,84,69,77,80,69,82,65,84,85,
+82,69,0,107,101,108,118,105,110,0,84,69,77,80,69,82,65,84,85,82,
+69,95,68,73,70,70,69,82,69,78,67,69,0,107,101,108,118,105,110,0,
+100,101,103,99,101,108,115,105,117,115,0,75,0,100,101,103,67,0,75,0,
+100,101,103,102,97,104,114,101,110,104,101,105,116,0,53,124,57,32,100,101,
+103,67,0,100,101,103,70,0,53,124,57,32,100,101,103,67,0,100,101,103,
+114,101,101,115,114,97,110,107,105,110,101,0,100,101,103,70,0,100,101,103,
+114,97,110,107,105,110,101,0,100,101,103,114,101,101,115,114,97,110,107,105,
+110,101,0,100,101,103,114,101,101,114,97,110,107,105,110,101,0,100,101,103,
+70,0,100,101,103,82,0,100,101,103,114,97,110,107,105,110,101,0,116,101,
+109,112,82,0,100,101,103,114,97,110,107,105,110,101,0,116,101,109,112,114,
+97,110,107,105,110,101,0,100,101,103,114,97,110,107,105,110,101,0,100,101,
+103,114,101,97,117,109,117,114,0,49,48,124,56,32,100,101,103,67,0,100,
+101,103,75,0,75,0,116,101,109,112,75,0,75,0,112,105,0,51,46,49,
+52,49,53,57,50,54,53,51,53,56,57,55,57,51,50,51,56,52,54,0,
+99,0,50,46,57,57,55,57,50,52,53,56,101,56,32,109,47,115,0,108,
+105,103,104,116,0,99,0,109,117,48,0,52,32,112,105,32,49,101,45,55,
+32,72,47,109,0,101,112,115,105,108,111,110,48,0,49,47,109,117,48,32,
+99,94,50,0,101,110,101,114,103,121,0,99,94,50,0,101,0,49,46,54,
+48,50,49,55,54,52,56,55,101,45,49,57,32,67,0,104,0,54,46,54,
+50,54,48,54,56,57,54,101,45,51,52,32,74,32,115,0,104,98,97,114,
+0,104,32,47,32,50,32,112,105,0,115,112,105,110,0,104,98,97,114,0,
+71,0,54,46,54,55,52,50,56,101,45,49,49,32,78,32,109,94,50,32,
+47,32,107,103,94,50,0,99,111,117,108,111,109,98,99,111,110,115,116,0,
+49,47,52,32,112,105,32,101,112,115,105,108,111,110,48,0,97,116,111,109,
+105,99,109,97,115,115,117,110,105,116,0,49,46,54,54,48,53,51,56,55,
+56,50,101,45,50,55,32,107,103,0,117,0,97,116,111,109,105,99,109,97,
+115,115,117,110,105,116,0,97,109,117,0,97,116,111,109,105,99,109,97,115,
+115,117,110,105,116,0,97,109,117,95,99,104,101,109,0,49,46,54,54,48,
+50,54,101,45,50,55,32,107,103,0,97,109,117,95,112,104,121,115,0,49,
+46,54,53,57,56,49,101,45,50,55,32,107,103,0,100,97,108,116,111,110,
+0,117,0,97,118,111,103,97,100,114,111,0,103,114,97,109,115,47,97,109,
+117,32,109,111,108,0,78,95,65,0,97,118,111,103,97,100,114,111,0,103,
+97,115,99,111,110,115,116,97,110,116,0,56,46,51,49,52,52,55,50,32,
+74,32,47,32,109,111,108,32,75,0,82,0,103,97,115,99,111,110,115,116,
+97,110,116,0,98,111,108,116,122,109,97,110,110,0,82,32,47,32,78,95,
+65,0,107,0,98,111,108,116,122,109,97,110,110,0,107,98,111,108,116,122,
+109,97,110,110,0,98,111,108,116,122,109,97,110,110,0,109,111,108,97,114,
+118,111,108,117,109,101,0,109,111,108,32,82,32,115,116,100,116,101,109,112,
+32,47,32,97,116,109,0,108,111,115,99,104,109,105,100,116,0,97,118,111,
+103,97,100,114,111,32,109,111,108,32,47,32,109,111,108,97,114,118,111,108,
+117,109,101,0,115,116,101,102,97,110,98,111,108,116,122,109,97,110,110,0,
+112,105,94,50,32,107,94,52,32,47,32,54,48,32,104,98,97,114,94,51,
+32,99,94,50,0,115,105,103,109,97,0,115,116,101,102,97,110,98,111,108,
+116,122,109,97,110,110,0,119,105,101,110,100,105,115,112,108,97,99,101,109,
+101,110,116,0,50,46,56,57,55,55,54,56,53,101,45,51,32,109,32,75,
+0,75,95,74,0,52,56,51,53,57,55,46,57,32,71,72,122,47,86,0,
+82,95,75,0,50,53,56,49,50,46,56,48,55,32,111,104,109,0,103,114,
+97,118,105,116,121,0,57,46,56,48,54,54,53,32,109,47,115,94,50,0,
+102,111,114,99,101,0,103,114,97,118,105,116,121,0,97,116,109,0,49,48,
+49,51,50,53,32,80,97,0,97,116,109,111,115,112,104,101,114,101,0,97,
+116,109,0,72,103,0,49,51,46,53,57,53,49,32,103,114,97,109,32,102,
+111,114,99,101,32,47,32,99,109,94,51,0,119,97,116,101,114,0,103,114,
+97,109,32,102,111,114,99,101,47,99,109,94,51,0,119,97,116,101,114,100,
+101,110,115,105,116,121,0,103,114,97,109,32,47,32,99,109,94,51,0,72,
+50,79,0,119,97,116,101,114,0,119,99,0,119,97,116,101,114,0,109,97,
+99,104,0,51,51,49,46,52,54,32,109,47,115,0,115,116,97,110,100,97,
+114,100,116,101,109,112,0,50,55,51,46,49,53,32,75,0,115,116,100,116,
+101,109,112,0,115,116,97,110,100,97,114,100,116,101,109,112,0,72,103,49,
+48,67,0,49,51,46,53,55,48,56,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,103,50,48,67,0,49,51,46,53,52,
+54,50,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,103,50,51,67,0,49,51,46,53,51,56,54,32,102,111,114,99,101,
+32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,51,48,67,0,49,
+51,46,53,50,49,55,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,103,52,48,67,0,49,51,46,52,57,55,51,32,102,
+111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,103,54,
+48,70,0,49,51,46,53,53,55,52,32,102,111,114,99,101,32,103,114,97,
+109,32,47,32,99,109,94,51,0,72,50,79,48,67,0,48,46,57,57,57,
+56,55,32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,
+0,72,50,79,53,67,0,48,46,57,57,57,57,57,32,102,111,114,99,101,
+32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,49,48,67,0,
+48,46,57,57,57,55,51,32,102,111,114,99,101,32,103,114,97,109,32,47,
+32,99,109,94,51,0,72,50,79,49,53,67,0,48,46,57,57,57,49,51,
+32,102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,
+50,79,49,56,67,0,48,46,57,57,56,54,50,32,102,111,114,99,101,32,
+103,114,97,109,32,47,32,99,109,94,51,0,72,50,79,50,48,67,0,48,
+46,57,57,56,50,51,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,72,50,79,50,53,67,0,48,46,57,57,55,48,55,32,
+102,111,114,99,101,32,103,114,97,109,32,47,32,99,109,94,51,0,72,50,
+79,53,48,67,0,48,46,57,56,56,48,55,32,102,111,114,99,101,32,103,
+114,97,109,32,47,32,99,109,94,51,0,72,50,79,49,48,48,67,0,48,
+46,57,53,56,51,56,32,102,111,114,99,101,32,103,114,97,109,32,47,32,
+99,109,94,51,0,82,105,110,102,105,110,105,116,121,0,49,48,57,55,51,
+55,51,49,46,53,54,56,53,50,55,32,47,109,0,82,95,72,0,49,48,
+57,54,55,55,54,48,32,47,109,0,97,108,112,104,97,0,55,46,50,57,
+55,51,53,50,53,51,55,54,101,45,51,0,98,111,104,114,114,97,100,105,
+117,115,0,97,108,112,104,97,32,47,32,52,32,112,105,32,82,105,110,102,
+105,110,105,116,121,0,112,114,111,117,116,0,49,56,53,46,53,32,107,101,
+86,0,112,108,97,110,99,107,109,97,115,115,0,50,46,49,55,54,52,52,
+101,45,56,32,107,103,0,109,95,80,0,112,108,97,110,99,107,109,97,115,
+115,0,112,108,97,110,99,107,116,105,109,101,0,104,98,97,114,32,47,32,
+112,108,97,110,99,107,109,97,115,115,32,99,94,50,0,116,95,80,0,112,
+108,97,110,99,107,116,105,109,101,0,112,108,97,110,99,107,108,101,110,103,
+116,104,0,112,108,97,110,99,107,116,105,109,101,32,99,0,108,95,80,0,
+112,108,97,110,99,107,108,101,110,103,116,104,0,101,108,101,99,116,114,111,
+110,109,97,115,115,0,53,46,52,56,53,55,57,57,48,57,52,51,101,45,
+52,32,117,0,109,95,101,0,101,108,101,99,116,114,111,110,109,97,115,115,
+0,112,114,111,116,111,110,109,97,115,115,0,49,46,48,48,55,50,55,54,
+52,54,54,55,55,32,117,0,109,95,112,0,112,114,111,116,111,110,109,97,
+115,115,0,110,101,117,116,114,111,110,109,97,115,115,0,49,46,48,48,56,
+54,54,52,57,49,53,57,55,32,117,0,109,95,110,0,110,101,117,116,114,
+111,110,109,97,115,115,0,109,117,111,110,109,97,115,115,0,48,46,49,49,
+51,52,50,56,57,50,53,54,32,117,0,109,95,109,117,0,109,117,111,110,
+109,97,115,115,0,100,101,117,116,101,114,111,110,109,97,115,115,0,50,46,
+48,49,51,53,53,51,50,49,50,55,50,52,32,117,0,109,95,100,0,100,
+101,117,116,101,114,111,110,109,97,115,115,0,97,108,112,104,97,112,97,114,
+116,105,99,108,101,109,97,115,115,0,52,46,48,48,49,53,48,54,49,55,
+57,49,50,55,32,117,0,109,95,97,108,112,104,97,0,97,108,112,104,97,
+112,97,114,116,105,99,108,101,109,97,115,115,0,101,108,101,99,116,114,111,
+110,119,97,118,101,108,101,110,103,116,104,0,104,32,47,32,109,95,101,32,
+99,0,108,97,109,98,100,97,95,67,0,101,108,101,99,116,114,111,110,119,
+97,118,101,108,101,110,103,116,104,0,112,114,111,116,111,110,119,97,118,101,
+108,101,110,103,116,104,0,104,32,47,32,109,95,112,32,99,0,108,97,109,
+98,100,97,95,67,44,112,0,112,114,111,116,111,110,119,97,118,101,108,101,
+110,103,116,104,0,110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,
+116,104,0,104,32,47,32,109,95,110,32,99,0,108,97,109,98,100,97,95,
+67,44,110,0,110,101,117,116,114,111,110,119,97,118,101,108,101,110,103,116,
+104,0,98,111,104,114,109,97,103,110,101,116,111,110,0,101,32,104,98,97,
+114,32,47,32,50,32,101,108,101,99,116,114,111,110,109,97,115,115,0,109,
+117,95,66,0,98,111,104,114,109,97,103,110,101,116,111,110,0,110,117,99,
+108,101,97,114,109,97,103,110,101,116,111,110,0,101,32,104,98,97,114,32,
+47,32,32,50,32,112,114,111,116,111,110,109,97,115,115,0,109,117,95,78,
+0,110,117,99,108,101,97,114,109,97,103,110,101,116,111,110,0,109,117,95,
+109,117,0,52,46,52,57,48,52,52,55,56,54,101,45,50,54,32,74,47,
+84,0,109,117,95,112,0,49,46,52,49,48,54,48,54,54,54,50,101,45,
+50,54,32,74,47,84,0,109,117,95,101,0,57,50,56,46,52,55,54,51,
+55,55,101,45,50,54,32,74,47,84,0,109,117,95,110,0,48,46,57,54,
+54,50,51,54,52,49,101,45,50,54,32,74,47,84,0,109,117,95,100,0,
+48,46,52,51,51,48,55,51,52,54,53,101,45,50,54,32,74,47,84,0,
+107,103,102,0,107,103,32,102,111,114,99,101,0,116,101,99,104,110,105,99,
+97,108,97,116,109,111,115,112,104,101,114,101,0,107,103,102,32,47,32,99,
+109,94,50,0,97,116,0,116,101,99,104,110,105,99,97,108,97,116,109,111,
+115,112,104,101,114,101,0,104,121,108,0,107,103,102,32,115,94,50,32,47,
+32,109,0,109,109,72,103,0,109,109,32,72,103,0,116,111,114,114,0,109,
+109,72,103,0,116,111,114,0,80,97,0,105,110,72,103,0,105,110,99,104,
+32,72,103,0,105,110,72,50,79,0,105,110,99,104,32,119,97,116,101,114,
+0,109,109,72,50,79,0,109,109,32,119,97,116,101,114,0,101,86,0,101,
+32,86,0,101,108,101,99,116,114,111,110,118,111,108,116,0,101,86,0,108,
+105,103,104,116,121,101,97,114,0,99,32,106,117,108,105,97,110,121,101,97,
+114,0,108,121,0,108,105,103,104,116,121,101,97,114,0,108,105,103,104,116,
+115,101,99,111,110,100,0,99,32,115,0,108,105,103,104,116,109,105,110,117,
+116,101,0,99,32,109,105,110,0,112,97,114,115,101,99,0,97,117,32,47,
+32,116,97,110,40,97,114,99,115,101,99,41,0,112,99,0,112,97,114,115,
+101,99,0,114,121,100,98,101,114,103,0,104,32,99,32,82,105,110,102,105,
+110,105,116,121,0,99,114,105,116,104,0,48,46,48,56,57,56,56,53,32,
+103,114,97,109,0,97,109,97,103,97,116,118,111,108,117,109,101,0,109,111,
+108,97,114,118,111,108,117,109,101,0,97,109,97,103,97,116,0,109,111,108,
+47,97,109,97,103,97,116,118,111,108,117,109,101,0,108,111,114,101,110,116,
+122,0,98,111,104,114,109,97,103,110,101,116,111,110,32,47,32,104,32,99,
+0,99,109,105,110,118,0,104,32,99,32,47,32,99,109,0,105,110,118,99,
+109,0,99,109,105,110,118,0,119,97,118,101,110,117,109,98,101,114,0,99,
+109,105,110,118,0,107,99,97,108,95,109,111,108,0,107,99,97,108,95,116,
+104,32,47,32,109,111,108,32,78,95,65,0,100,121,110,101,0,99,109,32,
+103,114,97,109,32,47,32,115,94,50,0,100,121,110,0,100,121,110,101,0,
+101,114,103,0,99,109,32,100,121,110,101,0,112,111,105,115,101,0,103,114,
+97,109,32,47,32,99,109,32,115,0,80,0,112,111,105,115,101,0,114,104,
+101,0,47,112,111,105,115,101,0,115,116,111,107,101,115,0,99,109,94,50,
+32,47,32,115,0,83,116,0,115,116,111,107,101,115,0,115,116,111,107,101,
+0,115,116,111,107,101,115,0,108,101,110,116,111,114,0,115,116,111,107,101,
+115,0,71,97,108,0,99,109,32,47,32,115,94,50,0,103,97,108,105,108,
+101,111,0,71,97,108,0,98,97,114,121,101,0,100,121,110,101,47,99,109,
+94,50,0,98,97,114,97,100,0,98,97,114,121,101,0,107,97,121,115,101,
+114,0,49,47,99,109,0,98,97,108,109,101,114,0,107,97,121,115,101,114,
+0,107,105,110,101,0,99,109,47,115,0,98,111,108,101,0,103,32,99,109,
+32,47,32,115,0,112,111,110,100,0,103,114,97,109,32,102,111,114,99,101,
+0,103,108,117,103,0,103,114,97,109,32,102,111,114,99,101,32,115,94,50,
+32,47,32,99,109,0,100,97,114,99,121,0,99,101,110,116,105,112,111,105,
+115,101,32,99,109,94,50,32,47,32,115,32,97,116,109,0,109,111,104,109,
+0,99,109,32,47,32,100,121,110,32,115,0,109,111,98,105,108,101,111,104,
+109,0,109,111,104,109,0,109,101,99,104,97,110,105,99,97,108,111,104,109,
+0,100,121,110,32,115,32,47,32,99,109,0,97,99,111,117,115,116,105,99,
+97,108,111,104,109,0,100,121,110,32,115,32,47,32,99,109,94,53,0,114,
+97,121,0,97,99,111,117,115,116,105,99,97,108,111,104,109,0,114,97,121,
+108,0,100,121,110,32,115,32,47,32,99,109,94,51,0,101,111,116,118,111,
+115,0,49,101,45,57,32,71,97,108,47,99,109,0,97,98,97,109,112,101,
+114,101,0,49,48,32,65,0,97,98,97,109,112,0,97,98,97,109,112,101,
+114,101,0,97,65,0,97,98,97,109,112,101,114,101,0,98,105,111,116,0,
+97,65,0,66,105,0,98,105,111,116,0,97,98,99,111,117,108,111,109,98,
+0,97,98,97,109,112,32,115,101,99,0,97,98,99,111,117,108,0,97,98,
+99,111,117,108,111,109,98,0,97,98,102,97,114,97,100,0,97,98,97,109,
+112,101,114,101,32,115,101,99,32,47,32,97,98,118,111,108,116,0,97,98,
+104,101,110,114,121,0,97,98,118,111,108,116,32,115,101,99,32,47,32,97,
+98,97,109,112,0,97,98,118,111,108,116,0,100,121,110,101,32,99,109,32,
+32,47,32,97,98,97,109,112,32,115,101,99,0,97,98,111,104,109,0,97,
+98,118,111,108,116,32,47,32,97,98,97,109,112,0,97,98,109,104,111,0,
+47,97,98,111,104,109,0,103,97,117,115,115,0,97,98,118,111,108,116,32,
+115,101,99,32,47,32,99,109,94,50,0,71,115,0,103,97,117,115,115,0,
+109,97,120,119,101,108,108,0,97,98,118,111,108,116,32,115,101,99,0,77,
+120,0,109,97,120,119,101,108,108,0,111,101,114,115,116,101,100,0,103,97,
+117,115,115,32,47,32,109,117,48,0,79,101,0,111,101,114,115,116,101,100,
+0,103,105,108,98,101,114,116,0,103,97,117,115,115,32,99,109,32,47,32,
+109,117,48,0,71,98,0,103,105,108,98,101,114,116,0,71,105,0,103,105,
+108,98,101,114,116,0,117,110,105,116,112,111,108,101,0,52,32,112,105,32,
+109,97,120,119,101,108,108,0,101,109,117,0,101,114,103,47,103,97,117,115,
+115,0,115,116,97,116,97,109,112,101,114,101,0,49,48,32,65,32,99,109,
+32,47,32,115,32,99,0,115,116,97,116,97,109,112,0,115,116,97,116,97,
+109,112,101,114,101,0,115,116,97,116,118,111,108,116,0,100,121,110,101,32,
+99,109,32,47,32,115,116,97,116,97,109,112,32,115,101,99,0,115,116,97,
+116,99,111,117,108,111,109,98,0,115,116,97,116,97,109,112,32,115,0,101,
+115,117,0,115,116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,99,
+111,117,108,0,115,116,97,116,99,111,117,108,111,109,98,0,115,116,97,116,
+102,97,114,97,100,0,115,116,97,116,97,109,112,32,115,101,99,32,47,32,
+115,116,97,116,118,111,108,116,0,99,109,99,97,112,97,99,105,116,97,110,
+99,101,0,115,116,97,116,102,97,114,97,100,0,115,116,97,116,104,101,110,
+114,121,0,115,116,97,116,118,111,108,116,32,115,101,99,32,47,32,115,116,
+97,116,97,109,112,0,115,116,97,116,111,104,109,0,115,116,97,116,118,111,
+108,116,32,47,32,115,116,97,116,97,109,112,0,115,116,97,116,109,104,111,
+0,47,115,116,97,116,111,104,109,0,115,116,97,116,109,97,120,119,101,108,
+108,0,115,116,97,116,118,111,108,116,32,115,101,99,0,102,114,97,110,107,
+108,105,110,0,115,116,97,116,99,111,117,108,111,109,98,0,100,101,98,121,
+101,0,49,101,45,49,56,32,115,116,97,116,99,111,117,108,32,99,109,0,
+104,101,108,109,104,111,108,116,122,0,100,101,98,121,101,47,97,110,103,115,
+116,114,111,109,94,50,0,106,97,114,0,49,48,48,48,32,115,116,97,116,
+102,97,114,97,100,0,105,110,116,97,109,112,101,114,101,0,48,46,57,57,
+57,56,51,53,32,65,0,105,110,116,97,109,112,0,105,110,116,97,109,112,
+101,114,101,0,105,110,116,102,97,114,97,100,0,48,46,57,57,57,53,48,
+53,32,70,0,105,110,116,118,111,108,116,0,49,46,48,48,48,51,51,32,
+86,0,105,110,116,111,104,109,0,49,46,48,48,48,52,57,53,32,111,104,
+109,0,100,97,110,105,101,108,108,0,49,46,48,52,50,32,86,0,102,97,
+114,97,100,97,121,0,78,95,65,32,101,32,109,111,108,0,102,97,114,97,
+100,97,121,95,112,104,121,115,0,57,54,53,50,49,46,57,32,67,0,102,
+97,114,97,100,97,121,95,99,104,101,109,0,57,54,52,57,53,46,55,32,
+67,0,107,97,112,112,108,105,110,101,0,54,48,48,48,32,109,97,120,119,
+101,108,108,0,115,105,101,109,101,110,115,117,110,105,116,0,48,46,57,53,
+51,52,32,111,104,109,0,76,85,77,73,78,79,85,83,95,73,78,84,69,
+78,83,73,84,89,0,99,97,110,100,101,108,97,0,76,85,77,73,78,79,
+85,83,95,70,76,85,88,0,108,117,109,101,110,0,76,85,77,73,78,79,
+85,83,95,69,78,69,82,71,89,0,116,97,108,98,111,116,0,73,76,76,
+85,77,73,78,65,78,67,69,0,108,117,120,0,69,88,73,84,65,78,67,
+69,0,108,117,120,0,99,97,110,100,108,101,0,49,46,48,50,32,99,97,
+110,100,101,108,97,0,104,101,102,110,101,114,117,110,105,116,0,48,46,57,
+32,99,97,110,100,108,101,0,104,101,102,110,101,114,99,97,110,100,108,101,
+0,104,101,102,110,101,114,117,110,105,116,0,118,105,111,108,108,101,0,50,
+48,46,49,55,32,99,100,0,108,117,109,101,110,0,99,100,32,115,114,0,
+108,109,0,108,117,109,101,110,0,116,97,108,98,111,116,0,108,117,109,101,
+110,32,115,0,108,117,109,98,101,114,103,0,116,97,108,98,111,116,0,108,
+117,109,101,114,103,0,116,97,108,98,111,116,0,108,117,120,0,108,109,47,
+109,94,50,0,108,120,0,108,117,120,0,112,104,111,116,0,108,117,109,101,
+110,32,47,32,99,109,94,50,0,112,104,0,112,104,111,116,0,102,111,111,
+116,99,97,110,100,108,101,0,108,117,109,101,110,47,102,116,94,50,0,109,
+101,116,101,114,99,97,110,100,108,101,0,108,117,109,101,110,47,109,94,50,
+0,109,99,115,0,109,101,116,101,114,99,97,110,100,108,101,32,115,0,110,
+111,120,0,49,101,45,51,32,108,117,120,0,115,107,111,116,0,49,101,45,
+51,32,97,112,111,115,116,105,108,98,0,76,85,77,73,78,65,78,67,69,
+0,110,105,116,0,110,105,116,0,99,100,47,109,94,50,0,115,116,105,108,
+98,0,99,100,32,47,32,99,109,94,50,0,115,98,0,115,116,105,108,98,
+0,97,112,111,115,116,105,108,98,0,99,100,47,112,105,32,109,94,50,0,
+97,115,98,0,97,112,111,115,116,105,108,98,0,98,108,111,110,100,101,108,
+0,97,112,111,115,116,105,108,98,0,101,113,117,105,118,97,108,101,110,116,
+108,117,120,0,99,100,32,47,32,112,105,32,109,94,50,0,101,113,117,105,
+118,97,108,101,110,116,112,104,111,116,0,99,100,32,47,32,112,105,32,99,
+109,94,50,0,108,97,109,98,101,114,116,0,99,100,32,47,32,112,105,32,
+99,109,94,50,0,102,111,111,116,108,97,109,98,101,114,116,0,99,100,32,
+47,32,112,105,32,102,116,94,50,0,115,117,110,108,117,109,0,49,46,54,
+101,57,32,99,100,47,109,94,50,0,115,117,110,105,108,108,117,109,0,49,
+48,48,101,51,32,108,117,120,0,115,117,110,105,108,108,117,109,95,111,0,
+49,48,101,51,32,108,117,120,0,115,117,110,108,117,109,95,104,0,54,101,
+54,32,99,100,47,109,94,50,0,115,107,121,108,117,109,0,56,48,48,48,
+32,99,100,47,109,94,50,0,115,107,121,108,117,109,95,111,0,50,48,48,
+48,32,99,100,47,109,94,50,0,109,111,111,110,108,117,109,0,50,53,48,
+48,32,99,100,47,109,94,50,0,115,49,48,48,0,54,52,32,42,32,50,
+94,40,50,124,51,41,32,47,32,108,120,32,115,0,107,49,50,53,48,0,
+49,50,46,53,32,40,99,100,47,109,50,41,32,47,32,108,120,32,115,0,
+107,49,52,48,48,0,49,52,32,32,32,40,99,100,47,109,50,41,32,47,
+32,108,120,32,115,0,99,50,53,48,0,50,53,48,32,108,120,32,47,32,
+108,120,32,115,0,84,73,77,69,0,115,101,99,111,110,100,0,97,110,111,
+109,97,108,105,115,116,105,99,121,101,97,114,0,51,54,53,46,50,53,57,
+54,32,100,97,121,115,0,115,105,100,101,114,101,97,108,121,101,97,114,0,
+51,54,53,46,50,53,54,51,54,48,52,49,55,32,100,97,121,0,116,114,
+111,112,105,99,97,108,121,101,97,114,0,51,54,53,46,50,52,50,49,57,
+56,55,56,49,32,100,97,121,0,101,99,108,105,112,115,101,121,101,97,114,
+0,51,52,54,46,54,50,32,100,97,121,115,0,115,97,114,111,115,0,50,
+50,51,32,115,121,110,111,100,105,99,109,111,110,116,104,0,115,105,100,101,
+114,101,97,108,100,97,121,0,56,54,49,54,52,46,48,57,48,53,52,32,
+115,0,115,105,100,101,114,101,97,108,104,111,117,114,0,49,124,50,52,32,
+115,105,100,101,114,101,97,108,100,97,121,0,115,105,100,101,114,101,97,108,
+109,105,110,117,116,101,0,49,124,54,48,32,115,105,100,101,114,101,97,108,
+104,111,117,114,0,115,105,100,101,114,101,97,108,115,101,99,111,110,100,0,
+49,124,54,48,32,115,105,100,101,114,101,97,108,109,105,110,117,116,101,0,
+97,110,111,109,97,108,105,115,116,105,99,109,111,110,116,104,0,50,55,46,
+53,53,52,53,52,57,55,55,32,100,97,121,0,110,111,100,105,99,97,108,
+109,111,110,116,104,0,50,55,46,50,49,50,50,49,57,57,32,100,97,121,
+0,100,114,97,99,111,110,105,99,109,111,110,116,104,0,110,111,100,105,99,
+97,108,109,111,110,116,104,0,100,114,97,99,111,110,105,116,105,99,109,111,
+110,116,104,0,110,111,100,105,99,97,108,109,111,110,116,104,0,115,105,100,
+101,114,101,97,108,109,111,110,116,104,0,50,55,46,51,50,49,54,54,49,
+32,100,97,121,0,108,117,110,97,114,109,111,110,116,104,0,50,57,32,100,
+97,121,115,32,43,32,49,50,32,104,111,117,114,115,32,43,32,52,52,32,
+109,105,110,117,116,101,115,32,43,32,50,46,56,32,115,101,99,111,110,100,
+115,0,115,121,110,111,100,105,99,109,111,110,116,104,0,108,117,110,97,114,
+109,111,110,116,104,0,108,117,110,97,116,105,111,110,0,115,121,110,111,100,
+105,99,109,111,110,116,104,0,108,117,110,101,0,49,124,51,48,32,108,117,
+110,97,116,105,111,110,0,108,117,110,111,117,114,0,49,124,50,52,32,108,
+117,110,101,0,121,101,97,114,0,116,114,111,112,105,99,97,108,121,101,97,
+114,0,121,114,0,121,101,97,114,0,109,111,110,116,104,0,49,124,49,50,
+32,121,101,97,114,0,109,111,0,109,111,110,116,104,0,108,117,115,116,114,
+117,109,0,53,32,121,101,97,114,115,0,100,101,99,97,100,101,0,49,48,
+32,121,101,97,114,115,0,99,101,110,116,117,114,121,0,49,48,48,32,121,
+101,97,114,115,0,109,105,108,108,101,110,110,105,117,109,0,49,48,48,48,
+32,121,101,97,114,115,0,109,105,108,108,101,110,110,105,97,0,109,105,108,
+108,101,110,110,105,117,109,0,115,111,108,97,114,121,101,97,114,0,121,101,
+97,114,0,108,117,110,97,114,121,101,97,114,0,49,50,32,108,117,110,97,
+114,109,111,110,116,104,0,99,97,108,101,110,100,97,114,121,101,97,114,0,
+51,54,53,32,100,97,121,0,99,111,109,109,111,110,121,101,97,114,0,51,
+54,53,32,100,97,121,0,108,101,97,112,121,101,97,114,0,51,54,54,32,
+100,97,121,0,106,117,108,105,97,110,121,101,97,114,0,51,54,53,46,50,
+53,32,100,97,121,0,103,114,101,103,111,114,105,97,110,121,101,97,114,0,
+51,54,53,46,50,52,50,53,32,100,97,121,0,105,115,108,97,109,105,99,
+121,101,97,114,0,51,53,52,32,100,97,121,0,105,115,108,97,109,105,99,
+108,101,97,112,121,101,97,114,0,51,53,53,32,100,97,121,0,105,115,108,
+97,109,105,99,109,111,110,116,104,0,49,124,49,50,32,105,115,108,97,109,
+105,99,121,101,97,114,0,109,101,114,99,117,114,121,100,97,121,0,53,56,
+46,54,52,54,50,32,100,97,121,0,118,101,110,117,115,100,97,121,0,50,
+52,51,46,48,49,32,100,97,121,0,101,97,114,116,104,100,97,121,0,115,
+105,100,101,114,101,97,108,100,97,121,0,109,97,114,115,100,97,121,0,49,
+46,48,50,53,57,53,54,55,53,32,100,97,121,0,106,117,112,105,116,101,
+114,100,97,121,0,48,46,52,49,51,53,52,32,100,97,121,0,115,97,116,
+117,114,110,100,97,121,0,48,46,52,51,55,53,32,100,97,121,0,117,114,
+97,110,117,115,100,97,121,0,48,46,54,53,32,100,97,121,0,110,101,112,
+116,117,110,101,100,97,121,0,48,46,55,54,56,32,100,97,121,0,112,108,
+117,116,111,100,97,121,0,54,46,51,56,54,55,32,100,97,121,0,109,101,
+114,99,117,114,121,121,101,97,114,0,48,46,50,52,48,56,52,54,55,32,
+106,117,108,105,97,110,121,101,97,114,0,118,101,110,117,115,121,101,97,114,
+0,48,46,54,49,53,49,57,55,50,54,32,106,117,108,105,97,110,121,101,
+97,114,0,101,97,114,116,104,121,101,97,114,0,115,105,100,101,114,101,97,
+108,121,101,97,114,0,109,97,114,115,121,101,97,114,0,49,46,56,56,48,
+56,52,55,54,32,106,117,108,105,97,110,121,101,97,114,0,106,117,112,105,
+116,101,114,121,101,97,114,0,49,49,46,56,54,50,54,49,53,32,106,117,
+108,105,97,110,121,101,97,114,0,115,97,116,117,114,110,121,101,97,114,0,
+50,57,46,52,52,55,52,57,56,32,106,117,108,105,97,110,121,101,97,114,
+0,117,114,97,110,117,115,121,101,97,114,0,56,52,46,48,49,54,56,52,
+54,32,106,117,108,105,97,110,121,101,97,114,0,110,101,112,116,117,110,101,
+121,101,97,114,0,49,54,52,46,55,57,49,51,50,32,106,117,108,105,97,
+110,121,101,97,114,0,112,108,117,116,111,121,101,97,114,0,50,52,55,46,
+57,50,48,54,53,32,106,117,108,105,97,110,121,101,97,114,0,101,97,114,
+116,104,102,108,97,116,116,101,110,105,110,103,0,49,124,50,57,56,46,50,
+53,54,52,50,0,101,97,114,116,104,114,97,100,105,117,115,95,101,113,117,
+97,116,111,114,105,97,108,0,54,51,55,56,49,51,54,46,52,57,32,109,
+0,101,97,114,116,104,114,97,100,105,117,115,95,112,111,108,97,114,0,40,
+45,101,97,114,116,104,102,108,97,116,116,101,110,105,110,103,43,49,41,32,
+101,97,114,116,104,114,97,100,105,117,115,95,101,113,117,97,116,111,114,105,
+97,108,0,108,97,110,100,97,114,101,97,0,49,52,56,46,56,52,55,101,
+54,32,107,109,94,50,0,111,99,101,97,110,97,114,101,97,0,51,54,49,
+46,50,53,52,101,54,32,107,109,94,50,0,109,111,111,110,114,97,100,105,
+117,115,0,49,55,51,56,32,107,109,0,115,117,110,114,97,100,105,117,115,
+0,54,46,57,54,101,56,32,109,0,103,97,117,115,115,95,107,0,48,46,
+48,49,55,50,48,50,48,57,56,57,53,0,103,97,117,115,115,105,97,110,
+121,101,97,114,0,40,50,32,112,105,32,47,32,103,97,117,115,115,95,107,
+41,32,100,97,121,115,0,97,115,116,114,111,110,111,109,105,99,97,108,117,
+110,105,116,0,52,57,57,46,48,48,52,55,56,51,56,48,54,32,108,105,
+103,104,116,32,115,101,99,111,110,100,0,97,117,0,97,115,116,114,111,110,
+111,109,105,99,97,108,117,110,105,116,0,115,111,108,97,114,109,97,115,115,
+0,49,46,57,56,57,49,101,51,48,32,107,103,0,115,117,110,109,97,115,
+115,0,115,111,108,97,114,109,97,115,115,0,115,117,110,100,105,115,116,0,
+49,46,48,48,48,48,48,49,48,49,55,56,32,97,117,0,109,111,111,110,
+100,105,115,116,0,51,46,56,52,52,101,56,32,109,0,115,117,110,100,105,
+115,116,95,110,101,97,114,0,49,46,52,55,49,101,49,49,32,109,0,115,
+117,110,100,105,115,116,95,102,97,114,0,49,46,53,50,49,101,49,49,32,
+109,0,109,101,114,99,117,114,121,109,97,115,115,0,115,111,108,97,114,109,
+97,115,115,32,47,32,54,48,50,51,54,48,48,0,118,101,110,117,115,109,
+97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,52,48,56,53,
+50,51,46,55,49,0,101,97,114,116,104,109,111,111,110,109,97,115,115,0,
+115,111,108,97,114,109,97,115,115,32,47,32,51,50,56,57,48,48,46,53,
+54,0,109,97,114,115,109,97,115,115,0,115,111,108,97,114,109,97,115,115,
+32,47,32,51,48,57,56,55,48,56,0,106,117,112,105,116,101,114,109,97,
+115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,49,48,52,55,46,
+51,52,56,54,0,115,97,116,117,114,110,109,97,115,115,0,115,111,108,97,
+114,109,97,115,115,32,47,32,51,52,57,55,46,56,57,56,0,117,114,97,
+110,117,115,109,97,115,115,0,115,111,108,97,114,109,97,115,115,32,47,32,
+50,50,57,48,50,46,57,56,0,110,101,112,116,117,110,101,109,97,115,115,
+0,115,111,108,97,114,109,97,115,115,32,47,32,49,57,52,49,50,46,50,
+52,0,112,108,117,116,111,109,97,115,115,0,115,111,108,97,114,109,97,115,
+115,32,47,32,49,46,51,53,101,56,0,109,111,111,110,101,97,114,116,104,
+109,97,115,115,114,97,116,105,111,0,48,46,48,49,50,51,48,48,48,51,
+52,0,101,97,114,116,104,109,97,115,115,0,101,97,114,116,104,109,111,111,
+110,109,97,115,115,32,47,32,40,32,49,32,43,32,109,111,111,110,101,97,
+114,116,104,109,97,115,115,114,97,116,105,111,41,0,109,111,111,110,109,97,
+115,115,0,109,111,111,110,101,97,114,116,104,109,97,115,115,114,97,116,105,
+111,32,101,97,114,116,104,109,97,115,115,0,111,108,100,109,101,114,99,117,
+114,121,109,97,115,115,0,48,46,51,51,48,50,50,101,50,52,32,107,103,
+0,111,108,100,118,101,110,117,115,109,97,115,115,0,52,46,56,54,57,48,
+101,50,52,32,107,103,0,111,108,100,109,97,114,115,109,97,115,115,0,48,
+46,54,52,49,57,49,101,50,52,32,107,103,0,111,108,100,106,117,112,105,
+116,101,114,109,97,115,115,0,49,56,57,56,46,56,101,50,52,32,107,103,
+0,111,108,100,115,97,116,117,114,110,109,97,115,115,0,53,54,56,46,53,
+101,50,52,32,107,103,0,111,108,100,117,114,97,110,117,115,109,97,115,115,
+0,56,54,46,54,50,53,101,50,52,32,107,103,0,111,108,100,110,101,112,
+116,117,110,101,109,97,115,115,0,49,48,50,46,55,56,101,50,52,32,107,
+103,0,111,108,100,112,108,117,116,111,109,97,115,115,0,48,46,48,49,53,
+101,50,52,32,107,103,0,109,101,114,99,117,114,121,114,97,100,105,117,115,
+0,50,52,52,48,32,107,109,0,118,101,110,117,115,114,97,100,105,117,115,
+0,54,48,53,49,46,56,52,32,107,109,0,101,97,114,116,104,114,97,100,
+105,117,115,0,54,51,55,49,46,48,49,32,107,109,0,109,97,114,115,114,
+97,100,105,117,115,0,51,51,56,57,46,57,50,32,107,109,0,106,117,112,
+105,116,101,114,114,97,100,105,117,115,0,54,57,57,49,49,32,107,109,0,
+115,97,116,117,114,110,114,97,100,105,117,115,0,53,56,50,51,50,32,107,
+109,0,117,114,97,110,117,115,114,97,100,105,117,115,0,50,53,51,54,50,
+32,107,109,0,110,101,112,116,117,110,101,114,97,100,105,117,115,0,50,52,
+54,50,52,32,107,109,0,112,108,117,116,111,114,97,100,105,117,115,0,49,
+49,53,49,32,107,109,0,109,111,111,110,103,114,97,118,105,116,121,0,49,
+46,54,50,32,109,47,115,94,50,0,97,116,111,109,105,99,109,97,115,115,
+0,101,108,101,99,116,114,111,110,109,97,115,115,0,97,116,111,109,105,99,
+99,104,97,114,103,101,0,101,0,97,116,111,109,105,99,97,99,116,105,111,
+110,0,104,98,97,114,0,97,116,111,109,105,99,108,101,110,103,116,104,0,
+98,111,104,114,114,97,100,105,117,115,0,97,116,111,109,105,99,116,105,109,
+101,0,104,98,97,114,94,51,47,99,111,117,108,111,109,98,99,111,110,115,
+116,94,50,32,97,116,111,109,105,99,109,97,115,115,32,101,94,52,0,97,
+116,111,109,105,99,118,101,108,111,99,105,116,121,0,97,116,111,109,105,99,
+108,101,110,103,116,104,32,47,32,97,116,111,109,105,99,116,105,109,101,0,
+97,116,111,109,105,99,101,110,101,114,103,121,0,104,98,97,114,32,47,32,
+97,116,111,109,105,99,116,105,109,101,0,104,97,114,116,114,101,101,0,97,
+116,111,109,105,99,101,110,101,114,103,121,0,72,97,114,116,114,101,101,0,
+104,97,114,116,114,101,101,0,116,104,101,114,109,97,108,99,111,117,108,111,
+109,98,0,74,47,75,0,116,104,101,114,109,97,108,97,109,112,101,114,101,
+0,87,47,75,0,116,104,101,114,109,97,108,102,97,114,97,100,0,74,47,
+75,94,50,0,116,104,101,114,109,97,108,111,104,109,0,75,94,50,47,87,
+0,102,111,117,114,105,101,114,0,116,104,101,114,109,97,108,111,104,109,0,
+116,104,101,114,109,97,108,104,101,110,114,121,0,74,32,75,94,50,47,87,
+94,50,0,116,104,101,114,109,97,108,118,111,108,116,0,75,0,85,83,0,
+49,50,48,48,124,51,57,51,55,32,109,47,102,116,0,105,110,116,0,51,
+57,51,55,124,49,50,48,48,32,102,116,47,109,0,105,110,99,104,0,50,
+46,53,52,32,99,109,0,105,110,0,105,110,99,104,0,102,111,111,116,0,
+49,50,32,105,110,99,104,0,102,101,101,116,0,102,111,111,116,0,102,116,
+0,102,111,111,116,0,121,97,114,100,0,51,32,102,116,0,121,100,0,121,
+97,114,100,0,109,105,108,101,0,53,50,56,48,32,102,116,0,108,105,110,
+101,0,49,124,49,50,32,105,110,99,104,0,114,111,100,0,53,46,53,32,
+121,97,114,100,0,112,101,114,99,104,0,114,111,100,0,102,117,114,108,111,
+110,103,0,52,48,32,114,111,100,0,115,116,97,116,117,116,101,109,105,108,
+101,0,109,105,108,101,0,108,101,97,103,117,101,0,51,32,109,105,108,101,
+0,115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,54,54,32,115,
+117,114,118,101,121,102,116,0,115,117,114,118,101,121,99,104,97,105,110,0,
+115,117,114,118,101,121,111,114,115,99,104,97,105,110,0,115,117,114,118,101,
+121,111,114,115,112,111,108,101,0,49,124,52,32,115,117,114,118,101,121,111,
+114,115,99,104,97,105,110,0,115,117,114,118,101,121,111,114,115,108,105,110,
+107,0,49,124,49,48,48,32,115,117,114,118,101,121,111,114,115,99,104,97,
+105,110,0,99,104,97,105,110,0,54,54,32,102,116,0,108,105,110,107,0,
+49,124,49,48,48,32,99,104,97,105,110,0,99,104,0,99,104,97,105,110,
+0,117,115,97,99,114,101,0,49,48,32,115,117,114,118,101,121,99,104,97,
+105,110,94,50,0,105,110,116,97,99,114,101,0,49,48,32,99,104,97,105,
+110,94,50,0,105,110,116,97,99,114,101,102,111,111,116,0,97,99,114,101,
+32,115,117,114,118,101,121,102,111,111,116,0,117,115,97,99,114,101,102,111,
+111,116,0,117,115,97,99,114,101,32,115,117,114,118,101,121,102,111,111,116,
+0,115,101,99,116,105,111,110,0,109,105,108,101,94,50,0,116,111,119,110,
+115,104,105,112,0,51,54,32,115,101,99,116,105,111,110,0,104,111,109,101,
+115,116,101,97,100,0,49,54,48,32,97,99,114,101,0,103,117,110,116,101,
+114,115,99,104,97,105,110,0,115,117,114,118,101,121,111,114,115,99,104,97,
+105,110,0,101,110,103,105,110,101,101,114,115,99,104,97,105,110,0,49,48,
+48,32,102,116,0,101,110,103,105,110,101,101,114,115,108,105,110,107,0,49,
+124,49,48,48,32,101,110,103,105,110,101,101,114,115,99,104,97,105,110,0,
+114,97,109,115,100,101,110,115,99,104,97,105,110,0,101,110,103,105,110,101,
+101,114,115,99,104,97,105,110,0,114,97,109,115,100,101,110,115,108,105,110,
+107,0,101,110,103,105,110,101,101,114,115,108,105,110,107,0,103,117,114,108,
+101,121,99,104,97,105,110,0,51,51,32,102,101,101,116,0,103,117,114,108,
+101,121,108,105,110,107,0,49,124,53,48,32,103,117,114,108,101,121,99,104,
+97,105,110,0,119,105,110,103,99,104,97,105,110,0,54,54,32,102,101,101,
+116,0,119,105,110,103,108,105,110,107,0,49,124,56,48,32,119,105,110,103,
+99,104,97,105,110,0,102,97,116,104,111,109,0,54,32,102,116,0,110,97,
+117,116,105,99,97,108,109,105,108,101,0,49,56,53,50,32,109,0,99,97,
+98,108,101,0,49,124,49,48,32,110,97,117,116,105,99,97,108,109,105,108,
+101,0,105,110,116,99,97,98,108,101,0,99,97,98,108,101,0,99,97,98,
+108,101,108,101,110,103,116,104,0,99,97,98,108,101,0,85,83,99,97,98,
+108,101,0,49,48,48,32,85,83,102,97,116,104,111,109,0,110,97,118,121,
+99,97,98,108,101,108,101,110,103,116,104,0,55,50,48,32,85,83,102,116,
+0,109,97,114,105,110,101,108,101,97,103,117,101,0,51,32,110,97,117,116,
+105,99,97,108,109,105,108,101,0,103,101,111,103,114,97,112,104,105,99,97,
+108,109,105,108,101,0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,
+0,107,110,111,116,0,110,97,117,116,105,99,97,108,109,105,108,101,32,47,
+32,104,114,0,99,108,105,99,107,0,107,109,0,107,108,105,99,107,0,99,
+108,105,99,107,0,112,111,117,110,100,0,48,46,52,53,51,53,57,50,51,
+55,32,107,103,0,108,98,0,112,111,117,110,100,0,103,114,97,105,110,0,
+49,124,55,48,48,48,32,112,111,117,110,100,0,111,117,110,99,101,0,49,
+124,49,54,32,112,111,117,110,100,0,111,122,0,111,117,110,99,101,0,100,
+114,97,109,0,49,124,49,54,32,111,117,110,99,101,0,100,114,0,100,114,
+97,109,0,117,115,104,117,110,100,114,101,100,119,101,105,103,104,116,0,49,
+48,48,32,112,111,117,110,100,115,0,99,119,116,0,104,117,110,100,114,101,
+100,119,101,105,103,104,116,0,115,104,111,114,116,104,117,110,100,114,101,100,
+119,101,105,103,104,116,0,117,115,104,117,110,100,114,101,100,119,101,105,103,
+104,116,0,117,115,116,111,110,0,115,104,111,114,116,116,111,110,0,115,104,
+111,114,116,116,111,110,0,50,48,48,48,32,108,98,0,113,117,97,114,116,
+101,114,119,101,105,103,104,116,0,49,124,52,32,117,115,116,111,110,0,115,
+104,111,114,116,113,117,97,114,116,101,114,119,101,105,103,104,116,0,49,124,
+52,32,115,104,111,114,116,116,111,110,0,115,104,111,114,116,113,117,97,114,
+116,101,114,0,115,104,111,114,116,113,117,97,114,116,101,114,119,101,105,103,
+104,116,0,116,114,111,121,112,111,117,110,100,0,53,55,54,48,32,103,114,
+97,105,110,0,116,114,111,121,111,117,110,99,101,0,49,124,49,50,32,116,
+114,111,121,112,111,117,110,100,0,111,122,116,0,116,114,111,121,111,117,110,
+99,101,0,112,101,110,110,121,119,101,105,103,104,116,0,49,124,50,48,32,
+116,114,111,121,111,117,110,99,101,0,100,119,116,0,112,101,110,110,121,119,
+101,105,103,104,116,0,97,115,115,97,121,116,111,110,0,109,103,32,116,111,
+110,32,47,32,116,114,111,121,111,117,110,99,101,0,117,115,97,115,115,97,
+121,116,111,110,0,109,103,32,117,115,116,111,110,32,47,32,116,114,111,121,
+111,117,110,99,101,0,98,114,97,115,115,97,121,116,111,110,0,109,103,32,
+98,114,116,111,110,32,47,32,116,114,111,121,111,117,110,99,101,0,102,105,
+110,101,111,117,110,99,101,0,116,114,111,121,111,117,110,99,101,0,109,101,
+116,114,105,99,99,97,114,97,116,0,48,46,50,32,103,114,97,109,0,109,
+101,116,114,105,99,103,114,97,105,110,0,53,48,32,109,103,0,99,97,114,
+97,116,0,109,101,116,114,105,99,99,97,114,97,116,0,99,116,0,99,97,
+114,97,116,0,106,101,119,101,108,101,114,115,112,111,105,110,116,0,49,124,
+49,48,48,32,99,97,114,97,116,0,115,105,108,118,101,114,115,109,105,116,
+104,112,111,105,110,116,0,49,124,52,48,48,48,32,105,110,99,104,0,109,
+111,109,109,101,0,51,46,55,53,32,103,114,97,109,115,0,97,112,112,111,
+117,110,100,0,116,114,111,121,112,111,117,110,100,0,97,112,111,117,110,99,
+101,0,116,114,111,121,111,117,110,99,101,0,97,112,100,114,97,109,0,49,
+124,56,32,97,112,111,117,110,99,101,0,97,112,115,99,114,117,112,108,101,
+0,49,124,51,32,97,112,100,114,97,109,0,117,115,103,97,108,108,111,110,
+0,50,51,49,32,105,110,94,51,0,103,97,108,0,103,97,108,108,111,110,
+0,113,117,97,114,116,0,49,124,52,32,103,97,108,108,111,110,0,112,105,
+110,116,0,49,124,50,32,113,117,97,114,116,0,103,105,108,108,0,49,124,
+52,32,112,105,110,116,0,117,115,113,117,97,114,116,0,49,124,52,32,117,
+115,103,97,108,108,111,110,0,117,115,112,105,110,116,0,49,124,50,32,117,
+115,113,117,97,114,116,0,117,115,103,105,108,108,0,49,124,52,32,117,115,
+112,105,110,116,0,117,115,102,108,117,105,100,111,117,110,99,101,0,49,124,
+49,54,32,117,115,112,105,110,116,0,102,108,117,105,100,100,114,97,109,0,
+49,124,56,32,117,115,102,108,111,122,0,109,105,110,105,109,118,111,108,117,
+109,101,0,49,124,54,48,32,102,108,117,105,100,100,114,97,109,0,113,116,
+0,113,117,97,114,116,0,112,116,0,112,105,110,116,0,102,108,111,122,0,
+102,108,117,105,100,111,117,110,99,101,0,117,115,102,108,111,122,0,117,115,
+102,108,117,105,100,111,117,110,99,101,0,102,108,100,114,0,102,108,117,105,
+100,100,114,97,109,0,108,105,113,117,105,100,98,97,114,114,101,108,0,51,
+49,46,53,32,117,115,103,97,108,108,111,110,0,117,115,98,101,101,114,98,
+97,114,114,101,108,0,50,32,98,101,101,114,107,101,103,115,0,98,101,101,
+114,107,101,103,0,49,53,46,53,32,117,115,103,97,108,108,111,110,0,112,
+111,110,121,107,101,103,0,49,124,50,32,98,101,101,114,107,101,103,0,119,
+105,110,101,107,101,103,0,49,50,32,117,115,103,97,108,108,111,110,0,112,
+101,116,114,111,108,101,117,109,98,97,114,114,101,108,0,52,50,32,117,115,
+103,97,108,108,111,110,0,98,97,114,114,101,108,0,112,101,116,114,111,108,
+101,117,109,98,97,114,114,101,108,0,98,98,108,0,98,97,114,114,101,108,
+0,117,115,104,111,103,115,104,101,97,100,0,50,32,108,105,113,117,105,100,
+98,97,114,114,101,108,0,117,115,102,105,114,107,105,110,0,57,32,103,97,
+108,108,111,110,0,117,115,98,117,115,104,101,108,0,50,49,53,48,46,52,
+50,32,105,110,94,51,0,98,117,0,98,117,115,104,101,108,0,112,101,99,
+107,0,49,124,52,32,98,117,115,104,101,108,0,117,115,112,101,99,107,0,
+49,124,52,32,117,115,98,117,115,104,101,108,0,98,114,112,101,99,107,0,
+49,124,52,32,98,114,98,117,115,104,101,108,0,112,107,0,112,101,99,107,
+0,100,114,121,103,97,108,108,111,110,0,49,124,50,32,117,115,112,101,99,
+107,0,100,114,121,113,117,97,114,116,0,49,124,52,32,100,114,121,103,97,
+108,108,111,110,0,100,114,121,112,105,110,116,0,49,124,50,32,100,114,121,
+113,117,97,114,116,0,100,114,121,98,97,114,114,101,108,0,55,48,53,54,
+32,105,110,94,51,0,99,114,97,110,98,101,114,114,121,98,97,114,114,101,
+108,0,53,56,50,54,32,105,110,94,51,0,104,101,97,112,101,100,98,117,
+115,104,101,108,0,49,46,50,55,56,32,117,115,98,117,115,104,101,108,0,
+119,104,101,97,116,98,117,115,104,101,108,0,54,48,32,108,98,0,115,111,
+121,98,101,97,110,98,117,115,104,101,108,0,54,48,32,108,98,0,99,111,
+114,110,98,117,115,104,101,108,0,53,54,32,108,98,0,114,121,101,98,117,
+115,104,101,108,0,53,54,32,108,98,0,98,97,114,108,101,121,98,117,115,
+104,101,108,0,52,56,32,108,98,0,111,97,116,98,117,115,104,101,108,0,
+51,50,32,108,98,0,114,105,99,101,98,117,115,104,101,108,0,52,53,32,
+108,98,0,99,97,110,97,100,97,95,111,97,116,98,117,115,104,101,108,0,
+51,52,32,108,98,0,112,111,110,121,118,111,108,117,109,101,0,49,32,117,
+115,102,108,111,122,0,106,105,103,103,101,114,0,49,46,53,32,117,115,102,
+108,111,122,0,115,104,111,116,0,106,105,103,103,101,114,0,101,117,115,104,
+111,116,0,50,53,32,109,108,0,102,105,102,116,104,0,49,124,53,32,117,
+115,103,97,108,108,111,110,0,119,105,110,101,98,111,116,116,108,101,0,55,
+53,48,32,109,108,0,119,105,110,101,115,112,108,105,116,0,49,124,52,32,
+119,105,110,101,98,111,116,116,108,101,0,119,105,110,101,103,108,97,115,115,
+0,52,32,117,115,102,108,111,122,0,109,97,103,110,117,109,0,49,46,53,
+32,108,105,116,101,114,0,109,101,116,114,105,99,116,101,110,116,104,0,51,
+55,53,32,109,108,0,109,101,116,114,105,99,102,105,102,116,104,0,55,53,
+48,32,109,108,0,109,101,116,114,105,99,113,117,97,114,116,0,49,32,108,
+105,116,101,114,0,114,101,112,117,116,101,100,113,117,97,114,116,0,49,124,
+54,32,98,114,103,97,108,108,111,110,0,114,101,112,117,116,101,100,112,105,
+110,116,0,49,124,50,32,114,101,112,117,116,101,100,113,117,97,114,116,0,
+98,114,119,105,110,101,98,111,116,116,108,101,0,114,101,112,117,116,101,100,
+113,117,97,114,116,0,115,112,108,105,116,0,50,48,48,32,109,108,0,106,
+101,114,111,98,111,97,109,0,50,32,109,97,103,110,117,109,0,114,101,104,
+111,98,111,97,109,0,51,32,109,97,103,110,117,109,0,109,101,116,104,117,
+115,101,108,97,104,0,52,32,109,97,103,110,117,109,0,115,97,108,109,97,
+110,97,122,97,114,0,54,32,109,97,103,110,117,109,0,98,97,108,116,104,
+97,122,97,114,0,56,32,109,97,103,110,117,109,0,110,101,98,117,99,104,
+97,100,110,101,122,122,97,114,0,49,48,32,109,97,103,110,117,109,0,99,
+108,97,114,107,100,101,103,114,101,101,0,49,124,55,48,48,48,48,0,103,
+112,103,0,103,114,97,105,110,115,47,103,97,108,108,111,110,0,115,104,111,
+101,105,114,111,110,0,49,124,52,56,32,105,110,99,104,0,115,104,111,101,
+111,117,110,99,101,0,49,124,54,52,32,105,110,99,104,0,115,104,111,101,
+115,105,122,101,95,100,101,108,116,97,0,49,124,51,32,105,110,99,104,0,
+115,104,111,101,95,109,101,110,48,0,56,46,50,53,32,105,110,99,104,0,
+115,104,111,101,95,119,111,109,101,110,48,0,40,55,43,49,49,124,49,50,
+41,32,105,110,99,104,0,115,104,111,101,95,98,111,121,115,48,0,40,51,
+43,49,49,124,49,50,41,32,105,110,99,104,0,115,104,111,101,95,103,105,
+114,108,115,48,0,40,51,43,55,124,49,50,41,32,105,110,99,104,0,101,
+117,114,111,112,101,115,104,111,101,115,105,122,101,0,50,124,51,32,99,109,
+0,98,117,99,107,0,85,83,36,0,102,105,110,0,53,32,85,83,36,0,
+115,97,119,98,117,99,107,0,49,48,32,85,83,36,0,117,115,103,114,97,
+110,100,0,49,48,48,48,32,85,83,36,0,103,114,101,101,110,98,97,99,
+107,0,85,83,36,0,107,101,121,0,107,103,0,108,105,100,0,49,32,111,
+122,0,102,111,111,116,98,97,108,108,102,105,101,108,100,0,117,115,102,111,
+111,116,98,97,108,108,102,105,101,108,100,0,117,115,102,111,111,116,98,97,
+108,108,102,105,101,108,100,0,49,48,48,32,121,97,114,100,115,0,99,97,
+110,97,100,97,102,111,111,116,98,97,108,108,102,105,101,108,100,0,49,49,
+48,32,121,97,114,100,115,0,109,97,114,97,116,104,111,110,0,50,54,32,
+109,105,108,101,115,32,43,32,51,56,53,32,121,97,114,100,115,0,85,75,
+0,85,75,108,101,110,103,116,104,95,83,74,74,0,85,75,108,101,110,103,
+116,104,95,66,0,48,46,57,49,52,51,57,57,50,32,109,101,116,101,114,
+32,47,32,121,97,114,100,0,85,75,108,101,110,103,116,104,95,83,74,74,
+0,48,46,57,49,52,51,57,56,52,49,32,109,101,116,101,114,32,47,32,
+121,97,114,100,0,85,75,108,101,110,103,116,104,95,75,0,109,101,116,101,
+114,32,47,32,51,57,46,51,55,48,55,57,32,105,110,99,104,0,85,75,
+108,101,110,103,116,104,95,67,0,109,101,116,101,114,32,47,32,49,46,48,
+57,51,54,50,51,49,49,32,121,97,114,100,0,98,114,110,97,117,116,105,
+99,97,108,109,105,108,101,0,54,48,56,48,32,102,116,0,98,114,107,110,
+111,116,0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,32,47,32,
+104,114,0,98,114,99,97,98,108,101,0,49,124,49,48,32,98,114,110,97,
+117,116,105,99,97,108,109,105,108,101,0,97,100,109,105,114,97,108,116,121,
+109,105,108,101,0,98,114,110,97,117,116,105,99,97,108,109,105,108,101,0,
+97,100,109,105,114,97,108,116,121,107,110,111,116,0,98,114,107,110,111,116,
+0,97,100,109,105,114,97,108,116,121,99,97,98,108,101,0,98,114,99,97,
+98,108,101,0,115,101,97,109,105,108,101,0,54,48,48,48,32,102,116,0,
+115,104,97,99,107,108,101,0,49,53,32,102,97,116,104,111,109,115,0,99,
+108,111,118,101,0,55,32,108,98,0,115,116,111,110,101,0,49,52,32,108,
+98,0,116,111,100,0,50,56,32,108,98,0,98,114,113,117,97,114,116,101,
+114,119,101,105,103,104,116,0,49,124,52,32,98,114,104,117,110,100,114,101,
+100,119,101,105,103,104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,
+103,104,116,0,56,32,115,116,111,110,101,0,108,111,110,103,104,117,110,100,
+114,101,100,119,101,105,103,104,116,0,98,114,104,117,110,100,114,101,100,119,
+101,105,103,104,116,0,108,111,110,103,116,111,110,0,50,48,32,98,114,104,
+117,110,100,114,101,100,119,101,105,103,104,116,0,98,114,116,111,110,0,108,
+111,110,103,116,111,110,0,98,114,109,105,110,105,109,0,49,124,54,48,32,
+98,114,100,114,97,109,0,98,114,115,99,114,117,112,108,101,0,49,124,51,
+32,98,114,100,114,97,109,0,102,108,117,105,100,115,99,114,117,112,108,101,
+0,98,114,115,99,114,117,112,108,101,0,98,114,100,114,97,109,0,49,124,
+56,32,98,114,102,108,111,122,0,98,114,102,108,117,105,100,111,117,110,99,
+101,0,49,124,50,48,32,98,114,112,105,110,116,0,98,114,102,108,111,122,
+0,98,114,102,108,117,105,100,111,117,110,99,101,0,98,114,103,105,108,108,
+0,49,124,52,32,98,114,112,105,110,116,0,98,114,112,105,110,116,0,49,
+124,50,32,98,114,113,117,97,114,116,0,98,114,113,117,97,114,116,0,49,
+124,52,32,98,114,103,97,108,108,111,110,0,98,114,103,97,108,108,111,110,
+0,52,46,53,52,54,48,57,32,108,0,98,114,98,97,114,114,101,108,0,
+51,54,32,98,114,103,97,108,108,111,110,0,98,114,98,117,115,104,101,108,
+0,56,32,98,114,103,97,108,108,111,110,0,98,114,104,101,97,112,101,100,
+98,117,115,104,101,108,0,49,46,50,55,56,32,98,114,98,117,115,104,101,
+108,0,98,114,113,117,97,114,116,101,114,0,56,32,98,114,98,117,115,104,
+101,108,0,98,114,99,104,97,108,100,114,111,110,0,51,54,32,98,114,98,
+117,115,104,101,108,0,98,97,103,0,52,32,98,114,98,117,115,104,101,108,
+0,98,117,99,107,101,116,0,52,32,98,114,103,97,108,108,111,110,0,107,
+105,108,100,101,114,107,105,110,0,50,32,98,114,102,105,114,107,105,110,0,
+108,97,115,116,0,52,48,32,98,114,98,117,115,104,101,108,0,110,111,103,
+103,105,110,0,98,114,103,105,108,108,0,112,111,116,116,108,101,0,48,46,
+53,32,98,114,103,97,108,108,111,110,0,112,105,110,0,52,46,53,32,98,
+114,103,97,108,108,111,110,0,112,117,110,99,104,101,111,110,0,55,50,32,
+98,114,103,97,108,108,111,110,0,115,101,97,109,0,56,32,98,114,98,117,
+115,104,101,108,0,99,111,111,109,98,0,52,32,98,114,98,117,115,104,101,
+108,0,98,111,108,108,0,54,32,98,114,98,117,115,104,101,108,0,102,105,
+114,108,111,116,0,49,124,52,32,98,111,108,108,0,98,114,102,105,114,107,
+105,110,0,57,32,98,114,103,97,108,108,111,110,0,99,114,97,110,0,51,
+55,46,53,32,98,114,103,97,108,108,111,110,0,98,114,119,105,110,101,104,
+111,103,115,104,101,97,100,0,53,50,46,53,32,98,114,103,97,108,108,111,
+110,0,98,114,104,111,103,115,104,101,97,100,0,98,114,119,105,110,101,104,
+111,103,115,104,101,97,100,0,98,114,98,101,101,114,104,111,103,115,104,101,
+97,100,0,53,52,32,98,114,103,97,108,108,111,110,0,98,114,98,101,101,
+114,98,117,116,116,0,50,32,98,114,98,101,101,114,104,111,103,115,104,101,
+97,100,0,114,101,103,105,115,116,101,114,116,111,110,0,49,48,48,32,102,
+116,94,51,0,115,104,105,112,112,105,110,103,116,111,110,0,52,48,32,102,
+116,94,51,0,98,114,115,104,105,112,112,105,110,103,116,111,110,0,52,50,
+32,102,116,94,51,0,102,114,101,105,103,104,116,116,111,110,0,115,104,105,
+112,112,105,110,103,116,111,110,0,100,105,115,112,108,97,99,101,109,101,110,
+116,116,111,110,0,51,53,32,102,116,94,51,0,119,97,116,101,114,116,111,
+110,0,50,50,52,32,98,114,103,97,108,108,111,110,0,115,116,114,105,107,
+101,0,55,48,46,53,32,108,0,97,109,98,101,114,0,52,32,98,114,98,
+117,115,104,101,108,0,98,97,114,108,101,121,99,111,114,110,0,49,124,51,
+32,85,75,105,110,99,104,0,110,97,105,108,0,49,124,49,54,32,85,75,
+121,97,114,100,0,112,111,108,101,0,49,54,46,53,32,85,75,102,116,0,
+114,111,112,101,0,50,48,32,85,75,102,116,0,101,110,103,108,105,115,104,
+101,108,108,0,52,53,32,85,75,105,110,99,104,0,102,108,101,109,105,115,
+104,101,108,108,0,50,55,32,85,75,105,110,99,104,0,101,108,108,0,101,
+110,103,108,105,115,104,101,108,108,0,115,112,97,110,0,57,32,85,75,105,
+110,99,104,0,103,111,97,100,0,52,46,53,32,85,75,102,116,0,114,111,
+111,100,0,49,124,52,32,97,99,114,101,0,101,110,103,108,105,115,104,99,
+97,114,97,116,0,116,114,111,121,111,117,110,99,101,47,49,53,49,46,53,
+0,109,97,110,99,117,115,0,50,32,111,122,0,109,97,115,116,0,50,46,
+53,32,108,98,0,110,97,105,108,107,101,103,0,49,48,48,32,108,98,115,
+0,98,97,115,101,98,111,120,0,51,49,51,54,48,32,105,110,94,50,0,
+109,101,116,114,101,0,109,101,116,101,114,0,103,114,97,109,109,101,0,103,
+114,97,109,0,108,105,116,114,101,0,108,105,116,101,114,0,100,105,111,112,
+116,114,101,0,100,105,111,112,116,101,114,0,97,108,117,109,105,110,105,117,
+109,0,97,108,117,109,105,110,117,109,0,115,117,108,112,104,117,114,0,115,
+117,108,102,117,114,0,103,101,111,109,101,116,114,105,99,112,97,99,101,0,
+53,32,102,116,0,112,97,99,101,0,50,46,53,32,102,116,0,85,83,109,
+105,108,105,116,97,114,121,112,97,99,101,0,51,48,32,105,110,0,85,83,
+100,111,117,98,108,101,116,105,109,101,112,97,99,101,0,51,54,32,105,110,
+0,102,105,110,103,101,114,98,114,101,97,100,116,104,0,55,124,56,32,105,
+110,0,102,105,110,103,101,114,108,101,110,103,116,104,0,52,46,53,32,105,
+110,0,102,105,110,103,101,114,0,102,105,110,103,101,114,98,114,101,97,100,
+116,104,0,112,97,108,109,119,105,100,116,104,0,104,97,110,100,0,112,97,
+108,109,108,101,110,103,116,104,0,56,32,105,110,0,104,97,110,100,0,52,
+32,105,110,99,104,0,115,104,97,102,116,109,101,110,116,0,54,32,105,110,
+99,104,0,115,109,111,111,116,0,53,32,102,116,32,43,32,55,32,105,110,
+0,116,98,108,0,116,97,98,108,101,115,112,111,111,110,0,116,98,115,112,
+0,116,97,98,108,101,115,112,111,111,110,0,116,98,108,115,112,0,116,97,
+98,108,101,115,112,111,111,110,0,84,98,0,116,97,98,108,101,115,112,111,
+111,110,0,116,115,112,0,116,101,97,115,112,111,111,110,0,115,97,108,116,
+115,112,111,111,110,0,49,124,52,32,116,115,112,0,117,115,99,117,112,0,
+56,32,117,115,102,108,111,122,0,117,115,116,97,98,108,101,115,112,111,111,
+110,0,49,124,49,54,32,117,115,99,117,112,0,117,115,116,101,97,115,112,
+111,111,110,0,49,124,51,32,117,115,116,97,98,108,101,115,112,111,111,110,
+0,117,115,116,98,108,0,117,115,116,97,98,108,101,115,112,111,111,110,0,
+117,115,116,98,115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,0,
+117,115,116,98,108,115,112,0,117,115,116,97,98,108,101,115,112,111,111,110,
+0,117,115,116,115,112,0,117,115,116,101,97,115,112,111,111,110,0,109,101,
+116,114,105,99,99,117,112,0,50,53,48,32,109,108,0,115,116,105,99,107,
+98,117,116,116,101,114,0,49,124,52,32,108,98,0,110,117,109,98,101,114,
+49,99,97,110,0,49,48,32,117,115,102,108,111,122,0,110,117,109,98,101,
+114,50,99,97,110,0,49,57,32,117,115,102,108,111,122,0,110,117,109,98,
+101,114,50,46,53,99,97,110,0,51,46,53,32,117,115,99,117,112,115,0,
+110,117,109,98,101,114,51,99,97,110,0,52,32,117,115,99,117,112,115,0,
+110,117,109,98,101,114,53,99,97,110,0,55,32,117,115,99,117,112,115,0,
+110,117,109,98,101,114,49,48,99,97,110,0,49,48,53,32,117,115,102,108,
+111,122,0,98,114,99,117,112,0,49,124,50,32,98,114,112,105,110,116,0,
+98,114,116,101,97,99,117,112,0,49,124,51,32,98,114,112,105,110,116,0,
+98,114,116,97,98,108,101,115,112,111,111,110,0,49,53,32,109,108,0,98,
+114,116,101,97,115,112,111,111,110,0,49,124,51,32,98,114,116,97,98,108,
+101,115,112,111,111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,111,
+110,0,50,32,98,114,116,101,97,115,112,111,111,110,0,100,101,115,115,101,
+114,116,115,112,111,111,110,0,98,114,100,101,115,115,101,114,116,115,112,111,
+111,110,0,100,115,112,0,100,101,115,115,101,114,116,115,112,111,111,110,0,
+98,114,116,115,112,0,98,114,116,101,97,115,112,111,111,110,0,98,114,116,
+98,108,0,98,114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,
+115,112,0,98,114,116,97,98,108,101,115,112,111,111,110,0,98,114,116,98,
+108,115,112,0,98,114,116,97,98,108,101,115,112,111,111,110,0,97,117,115,
+116,114,97,108,105,97,116,97,98,108,101,115,112,111,111,110,0,50,48,32,
+109,108,0,97,117,115,116,98,108,0,97,117,115,116,114,97,108,105,97,116,
+97,98,108,101,115,112,111,111,110,0,97,117,115,116,98,115,112,0,97,117,
+115,116,114,97,108,105,97,116,97,98,108,101,115,112,111,111,110,0,97,117,
+115,116,98,108,115,112,0,97,117,115,116,114,97,108,105,97,116,97,98,108,
+101,115,112,111,111,110,0,97,117,115,116,114,97,108,105,97,116,101,97,115,
+112,111,111,110,0,49,124,52,32,97,117,115,116,114,97,108,105,97,116,97,
+98,108,101,115,112,111,111,110,0,97,117,115,116,115,112,0,97,117,115,116,
+114,97,108,105,97,116,101,97,115,112,111,111,110,0,99,97,116,116,121,0,
+48,46,53,32,107,103,0,111,108,100,99,97,116,116,121,0,52,124,51,32,
+108,98,115,0,116,97,101,108,0,49,124,49,54,32,111,108,100,99,97,116,
+116,121,0,109,97,99,101,0,48,46,49,32,116,97,101,108,0,111,108,100,
+112,105,99,117,108,0,49,48,48,32,111,108,100,99,97,116,116,121,0,112,
+105,99,117,108,0,49,48,48,32,99,97,116,116,121,0,115,101,101,114,0,
+49,52,52,48,48,32,103,114,97,105,110,0,115,101,114,0,115,101,101,114,
+0,109,97,117,110,100,0,52,48,32,115,101,101,114,0,112,97,107,105,115,
+116,97,110,115,101,101,114,0,49,32,107,103,0,112,97,107,105,115,116,97,
+110,109,97,117,110,100,0,52,48,32,112,97,107,105,115,116,97,110,115,101,
+101,114,0,99,104,105,116,116,97,107,0,49,124,49,54,32,115,101,101,114,
+0,116,111,108,97,0,49,124,53,32,99,104,105,116,116,97,107,0,111,108,
+108,111,99,107,0,49,124,52,32,108,105,116,101,114,0,106,97,112,97,110,
+99,117,112,0,50,48,48,32,109,108,0,98,117,116,116,101,114,0,56,32,
+111,122,47,117,115,99,117,112,0,98,117,116,116,101,114,95,99,108,97,114,
+105,102,105,101,100,0,54,46,56,32,111,122,47,117,115,99,117,112,0,99,
+111,99,111,97,95,98,117,116,116,101,114,0,57,32,111,122,47,117,115,99,
+117,112,0,115,104,111,114,116,101,110,105,110,103,0,54,46,55,53,32,111,
+122,47,117,115,99,117,112,0,111,105,108,0,55,46,53,32,111,122,47,117,
+115,99,117,112,0,99,97,107,101,102,108,111,117,114,95,115,105,102,116,101,
+100,0,51,46,53,32,111,122,47,117,115,99,117,112,0,99,97,107,101,102,
+108,111,117,114,95,115,112,111,111,110,101,100,0,52,32,111,122,47,117,115,
+99,117,112,0,99,97,107,101,102,108,111,117,114,95,115,99,111,111,112,101,
+100,0,52,46,53,32,111,122,47,117,115,99,117,112,0,102,108,111,117,114,
+95,115,105,102,116,101,100,0,52,32,111,122,47,117,115,99,117,112,0,102,
+108,111,117,114,95,115,112,111,111,110,101,100,0,52,46,50,53,32,111,122,
+47,117,115,99,117,112,0,102,108,111,117,114,95,115,99,111,111,112,101,100,
+0,53,32,111,122,47,117,115,99,117,112,0,98,114,101,97,100,102,108,111,
+117,114,95,115,105,102,116,101,100,0,52,46,50,53,32,111,122,47,117,115,
+99,117,112,0,98,114,101,97,100,102,108,111,117,114,95,115,112,111,111,110,
+101,100,0,52,46,53,32,111,122,47,117,115,99,117,112,0,98,114,101,97,
+100,102,108,111,117,114,95,115,99,111,111,112,101,100,0,53,46,53,32,111,
+122,47,117,115,99,117,112,0,99,111,114,110,115,116,97,114,99,104,0,49,
+50,48,32,103,114,97,109,115,47,117,115,99,117,112,0,100,117,116,99,104,
+99,111,99,111,97,95,115,105,102,116,101,100,0,55,53,32,103,47,117,115,
+99,117,112,0,100,117,116,99,104,99,111,99,111,97,95,115,112,111,111,110,
+101,100,0,57,50,32,103,47,117,115,99,117,112,0,100,117,116,99,104,99,
+111,99,111,97,95,115,99,111,111,112,101,100,0,57,53,32,103,47,117,115,
+99,117,112,0,99,111,99,111,97,95,115,105,102,116,101,100,0,55,53,32,
+103,47,117,115,99,117,112,0,99,111,99,111,97,95,115,112,111,111,110,101,
+100,0,56,50,32,103,47,117,115,99,117,112,0,99,111,99,111,97,95,115,
+99,111,111,112,101,100,0,57,53,32,103,47,117,115,99,117,112,0,104,101,
+97,118,121,99,114,101,97,109,0,50,51,50,32,103,47,117,115,99,117,112,
+0,109,105,108,107,0,50,52,50,32,103,47,117,115,99,117,112,0,115,111,
+117,114,99,114,101,97,109,0,50,52,50,32,103,47,117,115,99,117,112,0,
+109,111,108,97,115,115,101,115,0,49,49,46,50,53,32,111,122,47,117,115,
+99,117,112,0,99,111,114,110,115,121,114,117,112,0,49,49,46,53,32,111,
+122,47,117,115,99,117,112,0,104,111,110,101,121,0,49,49,46,55,53,32,
+111,122,47,117,115,99,117,112,0,115,117,103,97,114,0,50,48,48,32,103,
+47,117,115,99,117,112,0,112,111,119,100,101,114,101,100,95,115,117,103,97,
+114,0,52,32,111,122,47,117,115,99,117,112,0,98,114,111,119,110,115,117,
+103,97,114,95,108,105,103,104,116,0,50,49,55,32,103,47,117,115,99,117,
+112,0,98,114,111,119,110,115,117,103,97,114,95,100,97,114,107,0,50,51,
+57,32,103,47,117,115,99,117,112,0,98,97,107,105,110,103,95,112,111,119,
+100,101,114,0,52,46,54,32,103,114,97,109,115,32,47,32,117,115,116,115,
+112,0,115,97,108,116,0,54,32,103,32,47,32,117,115,116,115,112,0,107,
+111,115,104,101,114,115,97,108,116,0,50,46,56,32,103,32,47,32,117,115,
+116,115,112,0,107,111,115,104,101,114,115,97,108,116,95,109,111,114,116,111,
+110,0,52,46,56,32,103,32,47,32,117,115,116,115,112,0,101,103,103,0,
+53,48,32,103,114,97,109,115,0,101,103,103,119,104,105,116,101,0,51,48,
+32,103,114,97,109,115,0,101,103,103,121,111,108,107,0,49,56,46,54,32,
+103,114,97,109,115,0,101,103,103,118,111,108,117,109,101,0,51,32,117,115,
+116,97,98,108,101,115,112,111,111,110,115,32,43,32,49,124,50,32,117,115,
+116,115,112,0,101,103,103,119,104,105,116,101,118,111,108,117,109,101,0,50,
+32,117,115,116,97,98,108,101,115,112,111,111,110,115,0,101,103,103,121,111,
+108,107,118,111,108,117,109,101,0,51,46,53,32,117,115,116,115,112,0,98,
+97,117,109,101,99,111,110,115,116,0,49,52,52,0,111,117,110,99,101,100,
+97,108,0,111,122,32,102,116,32,47,32,115,94,50,0,112,111,117,110,100,
+97,108,0,108,98,32,102,116,32,47,32,115,94,50,0,116,111,110,100,97,
+108,0,116,111,110,32,102,116,32,47,32,115,94,50,0,112,100,108,0,112,
+111,117,110,100,97,108,0,111,115,105,0,111,117,110,99,101,32,102,111,114,
+99,101,32,47,32,105,110,99,104,94,50,0,112,115,105,0,112,111,117,110,
+100,32,102,111,114,99,101,32,47,32,105,110,99,104,94,50,0,112,115,105,
+97,0,112,115,105,0,116,115,105,0,116,111,110,32,102,111,114,99,101,32,
+47,32,105,110,99,104,94,50,0,114,101,121,110,0,112,115,105,32,115,101,
+99,0,115,108,117,103,0,108,98,102,32,115,94,50,32,47,32,102,116,0,
+115,108,117,103,102,0,115,108,117,103,32,102,111,114,99,101,0,115,108,105,
+110,99,104,0,108,98,102,32,115,94,50,32,47,32,105,110,99,104,0,115,
+108,105,110,99,104,102,0,115,108,105,110,99,104,32,102,111,114,99,101,0,
+103,101,101,112,111,117,110,100,0,115,108,117,103,0,108,98,102,0,108,98,
+32,102,111,114,99,101,0,116,111,110,102,0,116,111,110,32,102,111,114,99,
+101,0,108,98,109,0,108,98,0,107,105,112,0,49,48,48,48,32,108,98,
+102,0,107,115,105,0,107,105,112,32,47,32,105,110,94,50,0,109,105,108,
+0,48,46,48,48,49,32,105,110,99,104,0,116,104,111,117,0,48,46,48,
+48,49,32,105,110,99,104,0,99,105,114,99,117,108,97,114,105,110,99,104,
+0,49,124,52,32,112,105,32,105,110,94,50,0,99,105,114,99,108,101,105,
+110,99,104,0,99,105,114,99,117,108,97,114,105,110,99,104,0,99,121,108,
+105,110,100,101,114,105,110,99,104,0,99,105,114,99,108,101,105,110,99,104,
+32,105,110,99,104,0,99,105,114,99,117,108,97,114,109,105,108,0,49,124,
+52,32,112,105,32,109,105,108,94,50,0,99,109,105,108,0,99,105,114,99,
+117,108,97,114,109,105,108,0,99,101,110,116,97,108,0,49,48,48,32,112,
+111,117,110,100,0,99,101,110,116,110,101,114,0,99,101,110,116,97,108,0,
+99,97,108,105,98,101,114,0,48,46,48,49,32,105,110,99,104,0,100,117,
+116,121,0,102,116,32,108,98,102,0,99,101,108,111,0,102,116,32,47,32,
+115,94,50,0,106,101,114,107,0,102,116,32,47,32,115,94,51,0,97,117,
+115,116,114,97,108,105,97,112,111,105,110,116,0,48,46,48,49,32,105,110,
+99,104,0,115,97,98,105,110,0,102,116,94,50,0,115,116,97,110,100,97,
+114,100,103,97,117,103,101,0,52,32,102,116,32,43,32,56,46,53,32,105,
+110,0,102,108,97,103,0,53,32,102,116,94,50,0,114,111,108,108,119,97,
+108,108,112,97,112,101,114,0,51,48,32,102,116,94,50,0,102,105,108,108,
+112,111,119,101,114,0,105,110,94,51,32,47,32,111,117,110,99,101,0,112,
+105,110,108,101,110,103,116,104,0,49,124,49,54,32,105,110,99,104,0,98,
+117,116,116,111,110,108,105,110,101,0,49,124,52,48,32,105,110,99,104,0,
+115,99,111,111,112,110,117,109,98,101,114,0,47,113,117,97,114,116,0,98,
+101,101,115,112,97,99,101,0,49,124,52,32,105,110,99,104,0,100,105,97,
+109,111,110,100,0,56,124,53,32,102,116,0,114,101,116,109,97,117,110,105,
+116,0,49,46,55,53,32,105,110,0,85,0,114,101,116,109,97,117,110,105,
+116,0,82,85,0,85,0,69,78,69,82,71,89,0,106,111,117,108,101,0,
+87,79,82,75,0,106,111,117,108,101,0,99,97,108,95,73,84,0,52,46,
+49,56,54,56,32,74,0,99,97,108,95,116,104,0,52,46,49,56,52,32,
+74,0,99,97,108,95,102,105,102,116,101,101,110,0,52,46,49,56,53,56,
+48,32,74,0,99,97,108,95,116,119,101,110,116,121,0,52,46,49,56,49,
+57,48,32,74,0,99,97,108,95,109,101,97,110,0,52,46,49,57,48,48,
+50,32,74,0,99,97,108,111,114,105,101,0,99,97,108,95,73,84,0,99,
+97,108,0,99,97,108,111,114,105,101,0,99,97,108,111,114,105,101,95,73,
+84,0,99,97,108,95,73,84,0,116,104,101,114,109,99,97,108,111,114,105,
+101,0,99,97,108,95,116,104,0,99,97,108,111,114,105,101,95,116,104,0,
+116,104,101,114,109,99,97,108,111,114,105,101,0,67,97,108,111,114,105,101,
+0,107,105,108,111,99,97,108,111,114,105,101,0,116,104,101,114,109,105,101,
+0,49,101,54,32,99,97,108,95,102,105,102,116,101,101,110,0,98,116,117,
+0,99,97,108,32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,
+75,0,98,114,105,116,105,115,104,116,104,101,114,109,97,108,117,110,105,116,
+0,98,116,117,0,98,116,117,95,73,84,0,98,116,117,0,98,116,117,95,
+116,104,0,99,97,108,95,116,104,32,108,98,32,100,101,103,70,32,47,32,
+103,114,97,109,32,75,0,98,116,117,95,109,101,97,110,0,99,97,108,95,
+109,101,97,110,32,108,98,32,100,101,103,70,32,47,32,103,114,97,109,32,
+75,0,113,117,97,100,0,113,117,97,100,114,105,108,108,105,111,110,32,98,
+116,117,0,69,67,116,104,101,114,109,0,49,46,48,53,53,48,54,101,56,
+32,74,0,85,83,116,104,101,114,109,0,49,46,48,53,52,56,48,52,101,
+56,32,74,0,116,104,101,114,109,0,85,83,116,104,101,114,109,0,116,111,
+110,111,105,108,0,49,101,49,48,32,99,97,108,95,73,84,0,116,111,101,
+0,116,111,110,111,105,108,0,116,111,110,99,111,97,108,0,55,101,57,32,
+99,97,108,95,73,84,0,98,97,114,114,101,108,111,105,108,0,53,46,56,
+32,77,98,116,117,0,110,97,116,117,114,97,108,103,97,115,95,72,72,86,
+0,49,48,50,55,32,98,116,117,47,102,116,51,0,110,97,116,117,114,97,
+108,103,97,115,95,76,72,86,0,57,51,48,32,98,116,117,47,102,116,51,
+0,110,97,116,117,114,97,108,103,97,115,0,110,97,116,117,114,97,108,103,
+97,115,95,72,72,86,0,99,104,97,114,99,111,97,108,0,51,48,32,71,
+74,47,116,111,110,110,101,0,119,111,111,100,101,110,101,114,103,121,95,100,
+114,121,0,50,48,32,71,74,47,116,111,110,110,101,0,119,111,111,100,101,
+110,101,114,103,121,95,97,105,114,100,114,121,0,49,53,32,71,74,47,116,
+111,110,110,101,0,99,111,97,108,95,98,105,116,117,109,105,110,111,117,115,
+0,50,55,32,71,74,32,47,32,116,111,110,110,101,0,99,111,97,108,95,
+108,105,103,110,105,116,101,0,49,53,32,71,74,32,47,32,116,111,110,110,
+101,0,99,111,97,108,95,85,83,0,50,50,32,71,74,32,47,32,116,111,
+110,0,101,116,104,97,110,111,108,95,72,72,86,0,56,52,48,48,48,32,
+98,116,117,47,117,115,103,97,108,108,111,110,0,101,116,104,97,110,111,108,
+95,76,72,86,0,55,53,55,48,48,32,98,116,117,47,117,115,103,97,108,
+108,111,110,0,100,105,101,115,101,108,0,49,51,48,53,48,48,32,98,116,
+117,47,117,115,103,97,108,108,111,110,0,103,97,115,111,108,105,110,101,95,
+76,72,86,0,49,49,53,48,48,48,32,98,116,117,47,117,115,103,97,108,
+108,111,110,0,103,97,115,111,108,105,110,101,95,72,72,86,0,49,50,53,
+48,48,48,32,98,116,117,47,117,115,103,97,108,108,111,110,0,103,97,115,
+111,108,105,110,101,0,103,97,115,111,108,105,110,101,95,72,72,86,0,104,
+101,97,116,105,110,103,0,51,55,46,51,32,77,74,47,108,105,116,101,114,
+0,102,117,101,108,111,105,108,0,51,57,46,55,32,77,74,47,108,105,116,
+101,114,0,112,114,111,112,97,110,101,0,57,51,46,51,32,77,74,47,109,
+94,51,0,98,117,116,97,110,101,0,49,50,52,32,77,74,47,109,94,51,
+0,117,114,97,110,105,117,109,95,112,117,114,101,0,50,48,48,32,77,101,
+86,32,97,118,111,103,97,100,114,111,32,47,32,40,50,51,53,46,48,52,
+51,57,50,57,57,32,103,47,109,111,108,41,0,117,114,97,110,105,117,109,
+95,110,97,116,117,114,97,108,0,48,46,55,37,32,117,114,97,110,105,117,
+109,95,112,117,114,101,0,99,101,108,115,105,117,115,104,101,97,116,117,110,
+105,116,0,99,97,108,32,108,98,32,100,101,103,67,32,47,32,103,114,97,
+109,32,75,0,99,104,117,0,99,101,108,115,105,117,115,104,101,97,116,117,
+110,105,116,0,80,79,87,69,82,0,119,97,116,116,0,117,115,104,111,114,
+115,101,112,111,119,101,114,0,53,53,48,32,102,111,111,116,32,112,111,117,
+110,100,32,102,111,114,99,101,32,47,32,115,101,99,0,104,112,0,104,111,
+114,115,101,112,111,119,101,114,0,109,101,116,114,105,99,104,111,114,115,101,
+112,111,119,101,114,0,55,53,32,107,105,108,111,103,114,97,109,32,102,111,
+114,99,101,32,109,101,116,101,114,32,47,32,115,101,99,0,101,108,101,99,
+116,114,105,99,104,111,114,115,101,112,111,119,101,114,0,55,52,54,32,87,
+0,98,111,105,108,101,114,104,111,114,115,101,112,111,119,101,114,0,57,56,
+48,57,46,53,48,32,87,0,119,97,116,101,114,104,111,114,115,101,112,111,
+119,101,114,0,55,52,54,46,48,52,51,32,87,0,98,114,104,111,114,115,
+101,112,111,119,101,114,0,55,52,53,46,55,48,32,87,0,100,111,110,107,
+101,121,112,111,119,101,114,0,50,53,48,32,87,0,99,104,101,118,97,108,
+118,97,112,101,117,114,0,109,101,116,114,105,99,104,111,114,115,101,112,111,
+119,101,114,0,84,72,69,82,77,65,76,95,67,79,78,68,85,67,84,65,
+78,67,69,0,80,79,87,69,82,47,65,82,69,65,32,40,84,69,77,80,
+69,82,65,84,85,82,69,95,68,73,70,70,69,82,69,78,67,69,47,76,
+69,78,71,84,72,41,0,84,72,69,82,77,65,76,95,73,78,83,85,76,
+65,78,67,69,0,49,47,84,72,69,82,77,65,76,95,67,79,78,68,85,
+67,84,65,78,67,69,0,84,72,69,82,77,65,76,95,67,79,78,68,85,
+67,84,73,86,73,84,89,0,84,72,69,82,77,65,76,95,67,79,78,68,
+85,67,84,65,78,67,69,32,47,32,76,69,78,71,84,72,0,84,72,69,
+82,77,65,76,95,73,78,83,85,76,65,84,73,79,78,0,84,72,69,82,
+77,65,76,95,73,78,83,85,76,65,78,67,69,32,76,69,78,71,84,72,
+0,82,118,97,108,117,101,0,100,101,103,70,32,102,116,94,50,32,104,114,
+32,47,32,98,116,117,0,85,118,97,108,117,101,0,49,47,82,118,97,108,
+117,101,0,101,117,114,111,112,101,97,110,85,118,97,108,117,101,0,119,97,
+116,116,32,47,32,109,94,50,32,75,0,82,83,73,0,100,101,103,67,32,
+109,94,50,32,47,32,87,0,99,108,111,0,48,46,49,53,53,32,100,101,
+103,67,32,109,94,50,32,47,32,87,0,116,111,103,0,48,46,49,32,100,
+101,103,67,32,109,94,50,32,47,32,87,0,69,78,84,82,79,80,89,0,
+69,78,69,82,71,89,32,47,32,84,69,77,80,69,82,65,84,85,82,69,
+0,99,108,97,117,115,105,117,115,0,49,101,51,32,99,97,108,47,75,0,
+108,97,110,103,108,101,121,0,116,104,101,114,109,99,97,108,111,114,105,101,
+47,99,109,94,50,0,112,111,110,99,101,108,101,116,0,49,48,48,32,107,
+103,32,102,111,114,99,101,32,109,32,47,32,115,0,116,111,110,114,101,102,
+114,105,103,101,114,97,116,105,111,110,0,116,111,110,32,49,52,52,32,98,
+116,117,32,47,32,108,98,32,100,97,121,0,116,111,110,114,101,102,0,116,
+111,110,114,101,102,114,105,103,101,114,97,116,105,111,110,0,114,101,102,114,
+105,103,101,114,97,116,105,111,110,0,116,111,110,114,101,102,32,47,32,116,
+111,110,0,102,114,105,103,111,114,105,101,0,49,48,48,48,32,99,97,108,
+95,102,105,102,116,101,101,110,0,116,110,116,0,49,101,57,32,99,97,108,
+95,116,104,32,47,32,116,111,110,0,97,105,114,119,97,116,116,0,56,46,
+53,32,40,102,116,94,51,47,109,105,110,41,32,105,110,72,50,79,0,112,
+101,114,109,95,48,67,0,103,114,97,105,110,32,47,32,104,114,32,102,116,
+94,50,32,105,110,72,103,0,112,101,114,109,95,122,101,114,111,0,112,101,
+114,109,95,48,67,0,112,101,114,109,95,48,0,112,101,114,109,95,48,67,
+0,112,101,114,109,0,112,101,114,109,95,48,67,0,112,101,114,109,95,50,
+51,67,0,103,114,97,105,110,32,47,32,104,114,32,102,116,94,50,32,105,
+110,32,72,103,50,51,67,0,112,101,114,109,95,116,119,101,110,116,121,116,
+104,114,101,101,0,112,101,114,109,95,50,51,67,0,112,97,105,114,0,50,
+0,98,114,97,99,101,0,50,0,110,101,115,116,0,51,0,104,97,116,116,
+114,105,99,107,0,51,0,100,105,99,107,101,114,0,49,48,0,100,111,122,
+101,110,0,49,50,0,98,97,107,101,114,115,100,111,122,101,110,0,49,51,
+0,115,99,111,114,101,0,50,48,0,102,108,111,99,107,0,52,48,0,116,
+105,109,101,114,0,52,48,0,115,104,111,99,107,0,54,48,0,116,111,110,
+99,111,117,110,116,0,49,48,48,0,108,111,110,103,104,117,110,100,114,101,
+100,0,49,50,48,0,103,114,111,115,115,0,49,52,52,0,103,114,101,97,
+116,103,114,111,115,115,0,49,50,32,103,114,111,115,115,0,116,105,116,104,
+101,0,49,124,49,48,0,115,104,111,114,116,113,117,105,114,101,0,50,52,
+0,113,117,105,114,101,0,50,53,0,115,104,111,114,116,114,101,97,109,0,
+52,56,48,0,114,101,97,109,0,53,48,48,0,112,101,114,102,101,99,116,
+114,101,97,109,0,53,49,54,0,98,117,110,100,108,101,0,50,32,114,101,
+97,109,115,0,98,97,108,101,0,53,32,98,117,110,100,108,101,115,0,108,
+101,116,116,101,114,115,105,122,101,0,56,46,53,32,105,110,99,104,32,49,
+49,32,105,110,99,104,0,108,101,103,97,108,115,105,122,101,0,56,46,53,
+32,105,110,99,104,32,49,52,32,105,110,99,104,0,108,101,100,103,101,114,
+115,105,122,101,0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,104,
+0,101,120,101,99,117,116,105,118,101,115,105,122,101,0,55,46,50,53,32,
+105,110,99,104,32,49,48,46,53,32,105,110,99,104,0,65,112,97,112,101,
+114,0,56,46,53,32,105,110,99,104,32,49,49,32,105,110,99,104,0,66,
+112,97,112,101,114,0,49,49,32,105,110,99,104,32,49,55,32,105,110,99,
+104,0,67,112,97,112,101,114,0,49,55,32,105,110,99,104,32,50,50,32,
+105,110,99,104,0,68,112,97,112,101,114,0,50,50,32,105,110,99,104,32,
+51,52,32,105,110,99,104,0,69,112,97,112,101,114,0,51,52,32,105,110,
+99,104,32,52,52,32,105,110,99,104,0,112,111,105,110,116,116,104,105,99,
+107,110,101,115,115,0,109,105,108,0,65,48,112,97,112,101,114,0,56,52,
+49,32,109,109,32,49,49,56,57,32,109,109,0,65,49,112,97,112,101,114,
+0,53,57,52,32,109,109,32,32,56,52,49,32,109,109,0,65,50,112,97,
+112,101,114,0,52,50,48,32,109,109,32,32,53,57,52,32,109,109,0,65,
+51,112,97,112,101,114,0,50,57,55,32,109,109,32,32,52,50,48,32,109,
+109,0,65,52,112,97,112,101,114,0,50,49,48,32,109,109,32,32,50,57,
+55,32,109,109,0,65,53,112,97,112,101,114,0,49,52,56,32,109,109,32,
+32,50,49,48,32,109,109,0,65,54,112,97,112,101,114,0,49,48,53,32,
+109,109,32,32,49,52,56,32,109,109,0,65,55,112,97,112,101,114,0,55,
+52,32,109,109,32,32,49,48,53,32,109,109,0,65,56,112,97,112,101,114,
+0,53,50,32,109,109,32,32,32,55,52,32,109,109,0,65,57,112,97,112,
+101,114,0,51,55,32,109,109,32,32,32,53,50,32,109,109,0,65,49,48,
+112,97,112,101,114,0,50,54,32,109,109,32,32,32,51,55,32,109,109,0,
+66,48,112,97,112,101,114,0,49,48,48,48,32,109,109,32,49,52,49,52,
+32,109,109,0,66,49,112,97,112,101,114,0,55,48,55,32,109,109,32,49,
+48,48,48,32,109,109,0,66,50,112,97,112,101,114,0,53,48,48,32,109,
+109,32,32,55,48,55,32,109,109,0,66,51,112,97,112,101,114,0,51,53,
+51,32,109,109,32,32,53,48,48,32,109,109,0,66,52,112,97,112,101,114,
+0,50,53,48,32,109,109,32,32,51,53,51,32,109,109,0,66,53,112,97,
+112,101,114,0,49,55,54,32,109,109,32,32,50,53,48,32,109,109,0,66,
+54,112,97,112,101,114,0,49,50,53,32,109,109,32,32,49,55,54,32,109,
+109,0,66,55,112,97,112,101,114,0,56,56,32,109,109,32,32,49,50,53,
+32,109,109,0,66,56,112,97,112,101,114,0,54,50,32,109,109,32,32,32,
+56,56,32,109,109,0,66,57,112,97,112,101,114,0,52,52,32,109,109,32,
+32,32,54,50,32,109,109,0,66,49,48,112,97,112,101,114,0,51,49,32,
+109,109,32,32,32,52,52,32,109,109,0,67,48,112,97,112,101,114,0,57,
+49,55,32,109,109,32,49,50,57,55,32,109,109,0,67,49,112,97,112,101,
+114,0,54,52,56,32,109,109,32,32,57,49,55,32,109,109,0,67,50,112,
+97,112,101,114,0,52,53,56,32,109,109,32,32,54,52,56,32,109,109,0,
+67,51,112,97,112,101,114,0,51,50,52,32,109,109,32,32,52,53,56,32,
+109,109,0,67,52,112,97,112,101,114,0,50,50,57,32,109,109,32,32,51,
+50,52,32,109,109,0,67,53,112,97,112,101,114,0,49,54,50,32,109,109,
+32,32,50,50,57,32,109,109,0,67,54,112,97,112,101,114,0,49,49,52,
+32,109,109,32,32,49,54,50,32,109,109,0,67,55,112,97,112,101,114,0,
+56,49,32,109,109,32,32,49,49,52,32,109,109,0,67,56,112,97,112,101,
+114,0,53,55,32,109,109,32,32,32,56,49,32,109,109,0,67,57,112,97,
+112,101,114,0,52,48,32,109,109,32,32,32,53,55,32,109,109,0,67,49,
+48,112,97,112,101,114,0,50,56,32,109,109,32,32,32,52,48,32,109,109,
+0,103,115,109,0,103,114,97,109,115,32,47,32,109,101,116,101,114,94,50,
+0,112,111,117,110,100,98,111,111,107,112,97,112,101,114,0,108,98,32,47,
+32,50,53,32,105,110,99,104,32,51,56,32,105,110,99,104,32,114,101,97,
+109,0,108,98,98,111,111,107,0,112,111,117,110,100,98,111,111,107,112,97,
+112,101,114,0,112,111,117,110,100,116,101,120,116,112,97,112,101,114,0,112,
+111,117,110,100,98,111,111,107,112,97,112,101,114,0,108,98,116,101,120,116,
+0,112,111,117,110,100,116,101,120,116,112,97,112,101,114,0,112,111,117,110,
+100,111,102,102,115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,111,
+111,107,112,97,112,101,114,0,108,98,111,102,102,115,101,116,0,112,111,117,
+110,100,111,102,102,115,101,116,112,97,112,101,114,0,112,111,117,110,100,98,
+105,98,108,101,112,97,112,101,114,0,112,111,117,110,100,98,111,111,107,112,
+97,112,101,114,0,108,98,98,105,98,108,101,0,112,111,117,110,100,98,105,
+98,108,101,112,97,112,101,114,0,112,111,117,110,100,116,97,103,112,97,112,
+101,114,0,108,98,32,47,32,50,52,32,105,110,99,104,32,51,54,32,105,
+110,99,104,32,114,101,97,109,0,108,98,116,97,103,0,112,111,117,110,100,
+116,97,103,112,97,112,101,114,0,112,111,117,110,100,98,97,103,112,97,112,
+101,114,0,112,111,117,110,100,116,97,103,112,97,112,101,114,0,108,98,98,
+97,103,0,112,111,117,110,100,98,97,103,112,97,112,101,114,0,112,111,117,
+110,100,110,101,119,115,112,114,105,110,116,112,97,112,101,114,0,112,111,117,
+110,100,116,97,103,112,97,112,101,114,0,108,98,110,101,119,115,112,114,105,
+110,116,0,112,111,117,110,100,110,101,119,115,112,114,105,110,116,112,97,112,
+101,114,0,112,111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,
+112,111,117,110,100,116,97,103,112,97,112,101,114,0,108,98,112,111,115,116,
+101,114,0,112,111,117,110,100,112,111,115,116,101,114,112,97,112,101,114,0,
+112,111,117,110,100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,
+110,100,116,97,103,112,97,112,101,114,0,108,98,116,105,115,115,117,101,0,
+112,111,117,110,100,116,105,115,115,117,101,112,97,112,101,114,0,112,111,117,
+110,100,119,114,97,112,112,105,110,103,112,97,112,101,114,0,112,111,117,110,
+100,116,97,103,112,97,112,101,114,0,108,98,119,114,97,112,112,105,110,103,
+0,112,111,117,110,100,119,114,97,112,112,105,110,103,112,97,112,101,114,0,
+112,111,117,110,100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,
+110,100,116,97,103,112,97,112,101,114,0,108,98,119,97,120,105,110,103,0,
+112,111,117,110,100,119,97,120,105,110,103,112,97,112,101,114,0,112,111,117,
+110,100,103,108,97,115,115,105,110,101,112,97,112,101,114,0,112,111,117,110,
+100,116,97,103,112,97,112,101,114,0,108,98,103,108,97,115,115,105,110,101,
+0,112,111,117,110,100,103,108,97,115,115,105,110,101,112,97,112,101,114,0,
+112,111,117,110,100,99,111,118,101,114,112,97,112,101,114,0,108,98,32,47,
+32,50,48,32,105,110,99,104,32,50,54,32,105,110,99,104,32,114,101,97,
+109,0,108,98,99,111,118,101,114,0,112,111,117,110,100,99,111,118,101,114,
+112,97,112,101,114,0,112,111,117,110,100,105,110,100,101,120,112,97,112,101,
+114,0,108,98,32,47,32,50,53,46,53,32,105,110,99,104,32,51,48,46,
+53,32,105,110,99,104,32,114,101,97,109,0,108,98,105,110,100,101,120,0,
+112,111,117,110,100,105,110,100,101,120,112,97,112,101,114,0,112,111,117,110,
+100,105,110,100,101,120,98,114,105,115,116,111,108,112,97,112,101,114,0,112,
+111,117,110,100,105,110,100,101,120,112,97,112,101,114,0,108,98,105,110,100,
+101,120,98,114,105,115,116,111,108,0,112,111,117,110,100,105,110,100,101,120,
+112,97,112,101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,
+0,108,98,32,47,32,49,55,32,105,110,99,104,32,50,50,32,105,110,99,
+104,32,114,101,97,109,0,108,98,98,111,110,100,0,112,111,117,110,100,98,
+111,110,100,112,97,112,101,114,0,112,111,117,110,100,119,114,105,116,105,110,
+103,112,97,112,101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,
+114,0,108,98,119,114,105,116,105,110,103,0,112,111,117,110,100,119,114,105,
+116,105,110,103,112,97,112,101,114,0,112,111,117,110,100,108,101,100,103,101,
+114,112,97,112,101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,
+114,0,108,98,108,101,100,103,101,114,0,112,111,117,110,100,108,101,100,103,
+101,114,112,97,112,101,114,0,112,111,117,110,100,99,111,112,121,112,97,112,
+101,114,0,112,111,117,110,100,98,111,110,100,112,97,112,101,114,0,108,98,
+99,111,112,121,0,112,111,117,110,100,99,111,112,121,112,97,112,101,114,0,
+112,111,117,110,100,98,108,111,116,116,105,110,103,112,97,112,101,114,0,108,
+98,32,47,32,49,57,32,105,110,99,104,32,50,52,32,105,110,99,104,32,
+114,101,97,109,0,108,98,98,108,111,116,116,105,110,103,0,112,111,117,110,
+100,98,108,111,116,116,105,110,103,112,97,112,101,114,0,112,111,117,110,100,
+98,108,97,110,107,115,112,97,112,101,114,0,108,98,32,47,32,50,50,32,
+105,110,99,104,32,50,56,32,105,110,99,104,32,114,101,97,109,0,108,98,
+98,108,97,110,107,115,0,112,111,117,110,100,98,108,97,110,107,115,112,97,
+112,101,114,0,112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,
+101,114,0,108,98,32,47,32,50,50,46,53,32,105,110,99,104,32,50,56,
+46,53,32,105,110,99,104,32,114,101,97,109,0,108,98,112,111,115,116,99,
+97,114,100,0,112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,
+101,114,0,112,111,117,110,100,119,101,100,100,105,110,103,98,114,105,115,116,
+111,108,0,112,111,117,110,100,112,111,115,116,99,97,114,100,112,97,112,101,
+114,0,108,98,119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,
+111,117,110,100,119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,112,
+111,117,110,100,98,114,105,115,116,111,108,112,97,112,101,114,0,112,111,117,
+110,100,119,101,100,100,105,110,103,98,114,105,115,116,111,108,0,108,98,98,
+114,105,115,116,111,108,0,112,111,117,110,100,98,114,105,115,116,111,108,112,
+97,112,101,114,0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,108,
+98,32,47,32,49,48,48,48,32,102,116,94,50,0,108,98,98,111,120,98,
+111,97,114,100,0,112,111,117,110,100,98,111,120,98,111,97,114,100,0,112,
+111,117,110,100,112,97,112,101,114,98,111,97,114,100,0,112,111,117,110,100,
+98,111,120,98,111,97,114,100,0,108,98,112,97,112,101,114,98,111,97,114,
+100,0,112,111,117,110,100,112,97,112,101,114,98,111,97,114,100,0,112,97,
+112,101,114,77,0,108,98,32,47,32,49,48,48,48,0,112,97,112,101,114,
+100,101,110,115,105,116,121,0,48,46,56,32,103,47,99,109,94,51,0,112,
+97,112,101,114,99,97,108,105,112,101,114,0,105,110,32,112,97,112,101,114,
+100,101,110,115,105,116,121,0,112,97,112,101,114,112,111,105,110,116,0,48,
+46,48,48,49,32,105,110,32,112,97,112,101,114,100,101,110,115,105,116,121,
+0,102,111,117,114,110,105,101,114,112,111,105,110,116,0,48,46,49,54,52,
+56,32,105,110,99,104,32,47,32,49,50,0,111,108,100,100,105,100,111,116,
+112,111,105,110,116,0,49,124,55,50,32,102,114,101,110,99,104,105,110,99,
+104,0,98,101,114,116,104,111,108,100,112,111,105,110,116,0,49,124,50,54,
+54,48,32,109,0,73,78,112,111,105,110,116,0,48,46,52,32,109,109,0,
+103,101,114,109,97,110,100,105,100,111,116,112,111,105,110,116,0,48,46,51,
+55,54,48,54,53,32,109,109,0,109,101,116,114,105,99,112,111,105,110,116,
+0,51,124,56,32,109,109,0,111,108,100,112,111,105,110,116,0,49,124,55,
+50,46,50,55,32,105,110,99,104,0,112,114,105,110,116,101,114,115,112,111,
+105,110,116,0,111,108,100,112,111,105,110,116,0,116,101,120,112,111,105,110,
+116,0,111,108,100,112,111,105,110,116,0,116,101,120,115,99,97,108,101,100,
+112,111,105,110,116,0,49,124,54,53,53,51,54,32,116,101,120,112,111,105,
+110,116,0,116,101,120,115,112,0,116,101,120,115,99,97,108,101,100,112,111,
+105,110,116,0,99,111,109,112,117,116,101,114,112,111,105,110,116,0,49,124,
+55,50,32,105,110,99,104,0,112,111,105,110,116,0,99,111,109,112,117,116,
+101,114,112,111,105,110,116,0,99,111,109,112,117,116,101,114,112,105,99,97,
+0,49,50,32,99,111,109,112,117,116,101,114,112,111,105,110,116,0,112,111,
+115,116,115,99,114,105,112,116,112,111,105,110,116,0,99,111,109,112,117,116,
+101,114,112,111,105,110,116,0,112,115,112,111,105,110,116,0,112,111,115,116,
+115,99,114,105,112,116,112,111,105,110,116,0,116,119,105,112,0,49,124,50,
+48,32,112,111,105,110,116,0,81,0,49,124,52,32,109,109,0,102,114,101,
+110,99,104,112,114,105,110,116,101,114,115,112,111,105,110,116,0,111,108,100,
+100,105,100,111,116,112,111,105,110,116,0,100,105,100,111,116,112,111,105,110,
+116,0,103,101,114,109,97,110,100,105,100,111,116,112,111,105,110,116,0,101,
+117,114,111,112,101,97,110,112,111,105,110,116,0,100,105,100,111,116,112,111,
+105,110,116,0,99,105,99,101,114,111,0,49,50,32,100,105,100,111,116,112,
+111,105,110,116,0,115,116,105,99,107,0,50,32,105,110,99,104,101,115,0,
+101,120,99,101,108,115,105,111,114,0,51,32,111,108,100,112,111,105,110,116,
+0,98,114,105,108,108,105,97,110,116,0,51,46,53,32,111,108,100,112,111,
+105,110,116,0,100,105,97,109,111,110,100,116,121,112,101,0,52,32,111,108,
+100,112,111,105,110,116,0,112,101,97,114,108,0,53,32,111,108,100,112,111,
+105,110,116,0,97,103,97,116,101,0,53,46,53,32,111,108,100,112,111,105,
+110,116,0,114,117,98,121,0,97,103,97,116,101,0,110,111,110,112,97,114,
+101,105,108,0,54,32,111,108,100,112,111,105,110,116,0,109,105,103,110,111,
+110,101,116,116,101,0,54,46,53,32,111,108,100,112,111,105,110,116,0,101,
+109,101,114,97,108,100,0,109,105,103,110,111,110,101,116,116,101,0,109,105,
+110,105,111,110,0,55,32,111,108,100,112,111,105,110,116,0,98,114,101,118,
+105,101,114,0,56,32,111,108,100,112,111,105,110,116,0,98,111,117,114,103,
+101,111,105,115,0,57,32,111,108,100,112,111,105,110,116,0,108,111,110,103,
+112,114,105,109,101,114,0,49,48,32,111,108,100,112,111,105,110,116,0,115,
+109,97,108,108,112,105,99,97,0,49,49,32,111,108,100,112,111,105,110,116,
+0,112,105,99,97,0,49,50,32,111,108,100,112,111,105,110,116,0,101,110,
+103,108,105,115,104,0,49,52,32,111,108,100,112,111,105,110,116,0,99,111,
+108,117,109,98,105,97,110,0,49,54,32,111,108,100,112,111,105,110,116,0,
+103,114,101,97,116,112,114,105,109,101,114,0,49,56,32,111,108,100,112,111,
+105,110,116,0,112,97,114,97,103,111,110,0,50,48,32,111,108,100,112,111,
+105,110,116,0,109,101,114,105,100,105,97,110,0,52,52,32,111,108,100,112,
+111,105,110,116,0,99,97,110,111,110,0,52,56,32,111,108,100,112,111,105,
+110,116,0,110,111,110,112,108,117,115,117,108,116,114,97,0,50,32,100,105,
+100,111,116,112,111,105,110,116,0,98,114,105,108,108,97,110,116,0,51,32,
+100,105,100,111,116,112,111,105,110,116,0,100,105,97,109,97,110,116,0,52,
+32,100,105,100,111,116,112,111,105,110,116,0,112,101,114,108,0,53,32,100,
+105,100,111,116,112,111,105,110,116,0,110,111,110,112,97,114,101,105,108,108,
+101,0,54,32,100,105,100,111,116,112,111,105,110,116,0,107,111,108,111,110,
+101,108,0,55,32,100,105,100,111,116,112,111,105,110,116,0,112,101,116,105,
+116,0,56,32,100,105,100,111,116,112,111,105,110,116,0,98,111,114,103,105,
+115,0,57,32,100,105,100,111,116,112,111,105,110,116,0,107,111,114,112,117,
+115,0,49,48,32,100,105,100,111,116,112,111,105,110,116,0,99,111,114,112,
+117,115,0,107,111,114,112,117,115,0,103,97,114,97,109,111,110,100,0,107,
+111,114,112,117,115,0,109,105,116,116,101,108,0,49,52,32,100,105,100,111,
+116,112,111,105,110,116,0,116,101,114,116,105,97,0,49,54,32,100,105,100,
+111,116,112,111,105,110,116,0,116,101,120,116,0,49,56,32,100,105,100,111,
+116,112,111,105,110,116,0,107,108,101,105,110,101,95,107,97,110,111,110,0,
+51,50,32,100,105,100,111,116,112,111,105,110,116,0,107,97,110,111,110,0,
+51,54,32,100,105,100,111,116,112,111,105,110,116,0,103,114,111,98,101,95,
+107,97,110,111,110,0,52,50,32,100,105,100,111,116,112,111,105,110,116,0,
+109,105,115,115,97,108,0,52,56,32,100,105,100,111,116,112,111,105,110,116,
+0,107,108,101,105,110,101,95,115,97,98,111,110,0,55,50,32,100,105,100,
+111,116,112,111,105,110,116,0,103,114,111,98,101,95,115,97,98,111,110,0,
+56,52,32,100,105,100,111,116,112,111,105,110,116,0,73,78,70,79,82,77,
+65,84,73,79,78,0,98,105,116,0,110,97,116,0,108,110,40,50,41,32,
+98,105,116,115,0,104,97,114,116,108,101,121,0,108,111,103,50,40,49,48,
+41,32,98,105,116,115,0,98,112,115,0,98,105,116,47,115,101,99,0,98,
+121,116,101,0,56,32,98,105,116,0,66,0,98,121,116,101,0,111,99,116,
+101,116,0,56,32,98,105,116,115,0,110,121,98,98,108,101,0,52,32,98,
+105,116,115,0,110,105,98,98,108,101,0,110,121,98,98,108,101,0,110,121,
+112,0,50,32,98,105,116,115,0,109,101,103,0,109,101,103,97,98,121,116,
+101,0,103,105,103,0,103,105,103,97,98,121,116,101,0,106,105,102,102,121,
+0,48,46,48,49,32,115,101,99,0,106,105,102,102,105,101,115,0,106,105,
+102,102,121,0,99,100,97,117,100,105,111,115,112,101,101,100,0,52,52,46,
+49,32,107,72,122,32,50,42,49,54,32,98,105,116,115,0,99,100,114,111,
+109,115,112,101,101,100,0,55,53,32,50,48,52,56,32,98,121,116,101,115,
+32,47,32,115,101,99,0,100,118,100,115,112,101,101,100,0,49,51,56,53,
+32,107,66,47,115,0,111,99,116,97,118,101,0,50,0,109,97,106,111,114,
+115,101,99,111,110,100,0,109,117,115,105,99,97,108,102,105,102,116,104,94,
+50,32,47,32,111,99,116,97,118,101,0,109,97,106,111,114,116,104,105,114,
+100,0,53,124,52,0,109,105,110,111,114,116,104,105,114,100,0,54,124,53,
+0,109,117,115,105,99,97,108,102,111,117,114,116,104,0,52,124,51,0,109,
+117,115,105,99,97,108,102,105,102,116,104,0,51,124,50,0,109,97,106,111,
+114,115,105,120,116,104,0,109,117,115,105,99,97,108,102,111,117,114,116,104,
+32,109,97,106,111,114,116,104,105,114,100,0,109,105,110,111,114,115,105,120,
+116,104,0,109,117,115,105,99,97,108,102,111,117,114,116,104,32,109,105,110,
+111,114,116,104,105,114,100,0,109,97,106,111,114,115,101,118,101,110,116,104,
+0,109,117,115,105,99,97,108,102,105,102,116,104,32,109,97,106,111,114,116,
+104,105,114,100,0,109,105,110,111,114,115,101,118,101,110,116,104,0,109,117,
+115,105,99,97,108,102,105,102,116,104,32,109,105,110,111,114,116,104,105,114,
+100,0,112,121,116,104,97,103,111,114,101,97,110,116,104,105,114,100,0,109,
+97,106,111,114,115,101,99,111,110,100,32,109,117,115,105,99,97,108,102,105,
+102,116,104,94,50,32,47,32,111,99,116,97,118,101,0,115,121,110,116,111,
+110,105,99,99,111,109,109,97,0,112,121,116,104,97,103,111,114,101,97,110,
+116,104,105,114,100,32,47,32,109,97,106,111,114,116,104,105,114,100,0,112,
+121,116,104,97,103,111,114,101,97,110,99,111,109,109,97,0,109,117,115,105,
+99,97,108,102,105,102,116,104,94,49,50,32,47,32,111,99,116,97,118,101,
+94,55,0,115,101,109,105,116,111,110,101,0,111,99,116,97,118,101,94,40,
+49,124,49,50,41,0,119,104,111,108,101,110,111,116,101,0,33,0,77,85,
+83,73,67,65,76,95,78,79,84,69,95,76,69,78,71,84,72,0,119,104,
+111,108,101,110,111,116,101,0,104,97,108,102,110,111,116,101,0,49,124,50,
+32,119,104,111,108,101,110,111,116,101,0,113,117,97,114,116,101,114,110,111,
+116,101,0,49,124,52,32,119,104,111,108,101,110,111,116,101,0,101,105,103,
+104,116,104,110,111,116,101,0,49,124,56,32,119,104,111,108,101,110,111,116,
+101,0,115,105,120,116,101,101,110,116,104,110,111,116,101,0,49,124,49,54,
+32,119,104,111,108,101,110,111,116,101,0,116,104,105,114,116,121,115,101,99,
+111,110,100,110,111,116,101,0,49,124,51,50,32,119,104,111,108,101,110,111,
+116,101,0,115,105,120,116,121,102,111,117,114,116,104,110,111,116,101,0,49,
+124,54,52,32,119,104,111,108,101,110,111,116,101,0,100,111,116,116,101,100,
+0,51,124,50,0,100,111,117,98,108,101,100,111,116,116,101,100,0,55,124,
+52,0,98,114,101,118,101,0,100,111,117,98,108,101,119,104,111,108,101,110,
+111,116,101,0,115,101,109,105,98,114,101,118,101,0,119,104,111,108,101,110,
+111,116,101,0,109,105,110,105,109,110,111,116,101,0,104,97,108,102,110,111,
+116,101,0,99,114,111,116,99,104,101,116,0,113,117,97,114,116,101,114,110,
+111,116,101,0,113,117,97,118,101,114,0,101,105,103,104,116,104,110,111,116,
+101,0,115,101,109,105,113,117,97,118,101,114,0,115,105,120,116,101,101,110,
+116,104,110,111,116,101,0,100,101,109,105,115,101,109,105,113,117,97,118,101,
+114,0,116,104,105,114,116,121,115,101,99,111,110,100,110,111,116,101,0,104,
+101,109,105,100,101,109,105,115,101,109,105,113,117,97,118,101,114,0,115,105,
+120,116,121,102,111,117,114,116,104,110,111,116,101,0,115,101,109,105,100,101,
+109,105,115,101,109,105,113,117,97,118,101,114,0,104,101,109,105,100,101,109,
+105,115,101,109,105,113,117,97,118,101,114,0,119,111,111,108,121,97,114,110,
+114,117,110,0,49,54,48,48,32,121,97,114,100,47,112,111,117,110,100,0,
+121,97,114,110,99,117,116,0,51,48,48,32,121,97,114,100,47,112,111,117,
+110,100,0,99,111,116,116,111,110,121,97,114,110,99,111,117,110,116,0,56,
+52,48,32,121,97,114,100,47,112,111,117,110,100,0,108,105,110,101,110,121,
+97,114,110,99,111,117,110,116,0,51,48,48,32,121,97,114,100,47,112,111,
+117,110,100,0,119,111,114,115,116,101,100,121,97,114,110,99,111,117,110,116,
+0,49,54,56,48,32,102,116,47,112,111,117,110,100,0,109,101,116,114,105,
+99,121,97,114,110,99,111,117,110,116,0,109,101,116,101,114,47,103,114,97,
+109,0,100,101,110,105,101,114,0,49,124,57,32,116,101,120,0,109,97,110,
+99,104,101,115,116,101,114,121,97,114,110,110,117,109,98,101,114,0,100,114,
+97,109,115,47,49,48,48,48,32,121,97,114,100,115,0,112,108,105,0,108,
+98,47,105,110,0,116,121,112,112,0,49,48,48,48,32,121,100,47,108,98,
+0,97,115,98,101,115,116,111,115,99,117,116,0,49,48,48,32,121,100,47,
+108,98,0,116,101,120,0,103,114,97,109,32,47,32,107,109,0,100,114,101,
+120,0,48,46,49,32,116,101,120,0,112,111,117,109,97,114,0,108,98,32,
+47,32,49,101,54,32,121,97,114,100,0,115,107,101,105,110,99,111,116,116,
+111,110,0,56,48,42,53,52,32,105,110,99,104,0,99,111,116,116,111,110,
+98,111,108,116,0,49,50,48,32,102,116,0,119,111,111,108,98,111,108,116,
+0,50,49,48,32,102,116,0,98,111,108,116,0,99,111,116,116,111,110,98,
+111,108,116,0,104,101,101,114,0,54,48,48,32,121,97,114,100,115,0,99,
+117,116,0,51,48,48,32,121,97,114,100,115,0,108,101,97,0,51,48,48,
+32,121,97,114,100,115,0,115,97,105,108,109,97,107,101,114,115,121,97,114,
+100,0,50,56,46,53,32,105,110,0,115,97,105,108,109,97,107,101,114,115,
+111,117,110,99,101,0,111,122,32,47,32,115,97,105,108,109,97,107,101,114,
+115,121,97,114,100,32,51,54,32,105,110,99,104,0,115,105,108,107,109,111,
+109,109,101,0,109,111,109,109,101,32,47,32,50,53,32,121,97,114,100,115,
+32,49,46,52,57,32,105,110,99,104,0,115,105,108,107,109,109,0,115,105,
+108,107,109,111,109,109,101,0,109,99,103,0,109,105,99,114,111,103,114,97,
+109,0,105,117,100,105,112,116,104,101,114,105,97,0,54,50,46,56,32,109,
+105,99,114,111,103,114,97,109,0,105,117,112,101,110,105,99,105,108,108,105,
+110,0,48,46,54,32,109,105,99,114,111,103,114,97,109,0,105,117,105,110,
+115,117,108,105,110,0,52,49,46,54,55,32,109,105,99,114,111,103,114,97,
+109,0,100,114,111,112,0,49,124,50,48,32,109,108,0,98,108,111,111,100,
+117,110,105,116,0,52,53,48,32,109,108,0,102,114,101,110,99,104,99,97,
+116,104,101,116,101,114,115,105,122,101,0,49,124,51,32,109,109,0,104,101,
+99,116,97,114,101,0,104,101,99,116,111,97,114,101,0,109,101,103,111,104,
+109,0,109,101,103,97,111,104,109,0,107,105,108,111,104,109,0,107,105,108,
+111,111,104,109,0,109,105,99,114,111,104,109,0,109,105,99,114,111,111,104,
+109,0,109,101,103,97,108,101,114,103,0,109,101,103,97,101,114,103,0,36,
+0,100,111,108,108,97,114,0,109,97,114,107,0,103,101,114,109,97,110,121,
+109,97,114,107,0,98,111,108,105,118,97,114,0,118,101,110,101,122,117,101,
+108,97,98,111,108,105,118,97,114,0,98,111,108,105,118,97,114,102,117,101,
+114,116,101,0,98,111,108,105,118,97,114,0,111,108,100,98,111,108,105,118,
+97,114,0,49,124,49,48,48,48,32,98,111,108,105,118,97,114,0,112,101,
+115,101,116,97,0,115,112,97,105,110,112,101,115,101,116,97,0,114,97,110,
+100,0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,0,101,115,
+99,117,100,111,0,112,111,114,116,117,103,97,108,101,115,99,117,100,111,0,
+103,117,105,108,100,101,114,0,110,101,116,104,101,114,108,97,110,100,115,103,
+117,105,108,100,101,114,0,104,111,108,108,97,110,100,103,117,105,108,100,101,
+114,0,110,101,116,104,101,114,108,97,110,100,115,103,117,105,108,100,101,114,
+0,112,101,115,111,0,109,101,120,105,99,111,112,101,115,111,0,121,101,110,
+0,106,97,112,97,110,121,101,110,0,108,105,114,97,0,105,116,97,108,121,
+108,105,114,97,0,114,117,112,101,101,0,105,110,100,105,97,114,117,112,101,
+101,0,100,114,97,99,104,109,97,0,103,114,101,101,99,101,100,114,97,99,
+104,109,97,0,102,114,97,110,99,0,102,114,97,110,99,101,102,114,97,110,
+99,0,109,97,114,107,107,97,0,102,105,110,108,97,110,100,109,97,114,107,
+107,97,0,98,114,105,116,97,105,110,112,111,117,110,100,0,103,114,101,97,
+116,98,114,105,116,97,105,110,112,111,117,110,100,0,112,111,117,110,100,115,
+116,101,114,108,105,110,103,0,98,114,105,116,97,105,110,112,111,117,110,100,
+0,121,117,97,110,0,99,104,105,110,97,121,117,97,110,0,97,117,115,116,
+114,105,97,115,99,104,105,108,108,105,110,103,0,49,124,49,51,46,55,54,
+48,51,32,101,117,114,111,0,98,101,108,103,105,117,109,102,114,97,110,99,
+0,49,124,52,48,46,51,51,57,57,32,101,117,114,111,0,101,115,116,111,
+110,105,97,107,114,111,111,110,0,49,124,49,53,46,54,52,54,54,32,101,
+117,114,111,0,102,105,110,108,97,110,100,109,97,114,107,107,97,0,49,124,
+53,46,57,52,53,55,51,32,101,117,114,111,0,102,114,97,110,99,101,102,
+114,97,110,99,0,49,124,54,46,53,53,57,53,55,32,101,117,114,111,0,
+103,101,114,109,97,110,121,109,97,114,107,0,49,124,49,46,57,53,53,56,
+51,32,101,117,114,111,0,103,114,101,101,99,101,100,114,97,99,104,109,97,
+0,49,124,51,52,48,46,55,53,32,101,117,114,111,0,105,114,101,108,97,
+110,100,112,117,110,116,0,49,124,48,46,55,56,55,53,54,52,32,101,117,
+114,111,0,105,116,97,108,121,108,105,114,97,0,49,124,49,57,51,54,46,
+50,55,32,101,117,114,111,0,108,117,120,101,109,98,111,117,114,103,102,114,
+97,110,99,0,49,124,52,48,46,51,51,57,57,32,101,117,114,111,0,110,
+101,116,104,101,114,108,97,110,100,115,103,117,105,108,100,101,114,0,49,124,
+50,46,50,48,51,55,49,32,101,117,114,111,0,112,111,114,116,117,103,97,
+108,101,115,99,117,100,111,0,49,124,50,48,48,46,52,56,50,32,101,117,
+114,111,0,115,112,97,105,110,112,101,115,101,116,97,0,49,124,49,54,54,
+46,51,56,54,32,101,117,114,111,0,99,121,112,114,117,115,112,111,117,110,
+100,0,49,124,48,46,53,56,53,50,55,52,32,101,117,114,111,0,109,97,
+108,116,97,108,105,114,97,0,49,124,48,46,52,50,57,51,48,48,32,101,
+117,114,111,0,115,108,111,118,101,110,105,97,116,111,108,97,114,0,49,124,
+50,51,57,46,54,52,48,32,101,117,114,111,0,115,108,111,118,97,107,105,
+97,107,111,114,117,110,97,0,49,124,51,48,46,49,50,54,48,32,101,117,
+114,111,0,117,110,105,116,101,100,97,114,97,98,101,109,105,114,97,116,101,
+115,100,105,114,104,97,109,0,48,46,50,55,50,50,32,85,83,36,0,97,
+102,103,104,97,110,105,115,116,97,110,97,102,103,104,97,110,105,0,48,46,
+48,50,50,50,52,32,85,83,36,0,97,108,98,97,110,105,97,108,101,107,
+0,48,46,48,48,57,57,48,50,32,85,83,36,0,97,114,109,101,110,105,
+97,100,114,97,109,0,48,46,48,48,50,54,52,32,85,83,36,0,110,101,
+116,104,101,114,108,97,110,100,115,97,110,116,105,108,108,101,115,103,117,105,
+108,100,101,114,0,48,46,53,53,56,55,32,85,83,36,0,97,110,103,111,
+108,97,107,119,97,110,122,97,0,48,46,48,49,49,48,56,32,85,83,36,
+0,97,114,103,101,110,116,105,110,97,112,101,115,111,0,48,46,50,54,48,
+51,32,85,83,36,0,97,117,115,116,114,97,108,105,97,100,111,108,108,97,
+114,0,48,46,56,56,53,53,32,85,83,36,0,97,114,117,98,97,103,117,
+105,108,100,101,114,115,0,48,46,53,53,56,55,32,85,83,36,0,97,122,
+101,114,98,97,105,106,97,110,110,101,119,109,97,110,97,116,0,49,46,50,
+52,52,57,32,85,83,36,0,98,111,115,110,105,97,109,97,114,107,97,0,
+48,46,55,48,50,56,32,85,83,36,0,98,97,114,98,97,100,111,115,100,
+111,108,108,97,114,0,48,46,52,57,56,56,32,85,83,36,0,98,97,110,
+103,108,97,100,101,115,104,116,97,107,97,0,48,46,48,49,52,52,53,32,
+85,83,36,0,98,117,108,103,97,114,105,97,108,101,118,0,48,46,55,32,
+85,83,36,0,98,97,104,114,97,105,110,100,105,110,97,114,0,50,46,54,
+53,50,32,85,83,36,0,98,117,114,117,110,100,105,102,114,97,110,99,0,
+48,46,48,48,48,56,50,51,32,85,83,36,0,98,101,114,109,117,100,97,
+100,111,108,108,97,114,0,49,32,85,83,36,0,98,114,117,110,101,105,100,
+111,108,108,97,114,0,48,46,55,48,54,54,32,85,83,36,0,98,111,108,
+105,118,105,97,98,111,108,105,118,105,97,110,111,0,48,46,49,52,50,53,
+32,85,83,36,0,98,114,97,122,105,108,114,101,97,108,0,48,46,53,52,
+48,52,32,85,83,36,0,98,97,104,97,109,97,115,100,111,108,108,97,114,
+0,49,32,85,83,36,0,98,104,117,116,97,110,110,103,117,108,116,114,117,
+109,0,48,46,48,50,49,53,49,32,85,83,36,0,98,111,116,115,119,97,
+110,97,112,117,108,97,0,48,46,49,52,53,53,32,85,83,36,0,98,101,
+108,97,114,117,115,114,117,98,108,101,0,48,46,48,48,48,51,52,53,32,
+85,83,36,0,98,101,108,105,122,101,100,111,108,108,97,114,0,48,46,53,
+49,50,56,32,85,83,36,0,99,97,110,97,100,97,100,111,108,108,97,114,
+0,48,46,57,52,52,52,32,85,83,36,0,99,111,110,103,111,102,114,97,
+110,99,0,48,46,48,48,49,48,57,57,32,85,83,36,0,115,119,105,116,
+122,101,114,108,97,110,100,102,114,97,110,99,0,48,46,57,51,57,49,32,
+85,83,36,0,99,104,105,108,101,112,101,115,111,0,48,46,48,48,49,56,
+55,49,32,85,83,36,0,99,104,105,110,97,121,117,97,110,0,48,46,49,
+52,54,53,32,85,83,36,0,99,111,108,111,109,98,105,97,112,101,115,111,
+0,48,46,48,48,48,53,49,49,32,85,83,36,0,99,111,115,116,97,114,
+105,99,97,99,111,108,111,110,0,48,46,48,48,49,56,48,51,32,85,83,
+36,0,99,117,98,97,112,101,115,111,0,49,32,85,83,36,0,99,97,112,
+101,118,101,114,100,101,101,115,99,117,100,111,0,48,46,48,49,51,53,49,
+32,85,83,36,0,99,122,101,99,104,107,111,114,117,110,121,0,53,46,50,
+55,55,50,32,85,83,36,0,100,106,105,98,111,117,116,105,102,114,97,110,
+99,0,48,46,48,48,53,53,57,53,32,85,83,36,0,100,101,110,109,97,
+114,107,107,114,111,110,101,114,0,49,56,46,52,57,56,32,85,83,36,0,
+100,111,109,105,110,105,99,97,110,114,101,112,117,98,108,105,99,112,101,115,
+111,0,48,46,48,50,55,53,53,32,85,83,36,0,97,108,103,101,114,105,
+97,100,105,110,97,114,0,48,46,48,49,51,55,49,32,85,83,36,0,101,
+103,121,112,116,112,111,117,110,100,0,48,46,49,56,50,50,32,85,83,36,
+0,101,114,105,116,114,101,97,110,97,107,102,97,0,48,46,48,54,54,50,
+50,32,85,83,36,0,101,116,104,105,111,112,105,97,98,105,114,114,0,48,
+46,48,55,52,54,57,32,85,83,36,0,101,117,114,111,0,49,46,51,55,
+55,52,32,85,83,36,0,102,105,106,105,100,111,108,108,97,114,0,48,46,
+53,48,57,57,32,85,83,36,0,102,97,108,107,108,97,110,100,105,115,108,
+97,110,100,115,112,111,117,110,100,0,49,46,53,54,50,56,32,85,83,36,
+0,103,114,101,97,116,98,114,105,116,97,105,110,112,111,117,110,100,0,49,
+46,53,54,50,54,32,85,83,36,0,103,101,111,114,103,105,97,108,97,114,
+105,0,48,46,53,56,53,54,32,85,83,36,0,103,104,97,110,97,99,101,
+100,105,0,48,46,55,48,51,32,85,83,36,0,103,105,98,114,97,108,116,
+97,114,112,111,117,110,100,0,49,46,53,54,50,56,32,85,83,36,0,103,
+97,109,98,105,97,100,97,108,97,115,105,0,48,46,48,51,55,51,55,32,
+85,83,36,0,103,117,105,110,101,97,102,114,97,110,99,0,48,46,48,48,
+48,49,57,57,32,85,83,36,0,103,117,97,116,101,109,97,108,97,113,117,
+101,116,122,97,108,0,48,46,49,50,50,49,32,85,83,36,0,103,117,121,
+97,110,97,100,111,108,108,97,114,0,48,46,48,48,52,56,54,50,32,85,
+83,36,0,104,111,110,103,107,111,110,103,100,111,108,108,97,114,0,48,46,
+49,50,56,55,32,85,83,36,0,104,111,110,100,117,114,97,115,108,101,109,
+112,105,114,97,0,48,46,48,53,50,57,50,32,85,83,36,0,99,114,111,
+97,116,105,97,107,117,110,97,0,48,46,49,56,56,51,32,85,83,36,0,
+104,97,105,116,105,103,111,117,114,100,101,115,0,48,46,48,50,53,49,54,
+32,85,83,36,0,104,117,110,103,97,114,121,102,111,114,105,110,116,0,48,
+46,48,48,53,48,55,53,32,85,83,36,0,105,110,100,111,110,101,115,105,
+97,114,117,112,105,97,104,0,48,46,48,49,48,54,56,32,85,83,36,0,
+105,115,114,97,101,108,110,101,119,115,104,101,107,101,108,0,48,46,50,54,
+54,55,32,85,83,36,0,105,110,100,105,97,114,117,112,101,101,0,48,46,
+48,50,49,53,55,32,85,83,36,0,105,114,97,113,100,105,110,97,114,0,
+48,46,48,48,48,56,53,56,32,85,83,36,0,105,114,97,110,114,105,97,
+108,0,48,46,48,48,48,49,48,50,32,85,83,36,0,105,99,101,108,97,
+110,100,107,114,111,110,97,0,48,46,48,48,55,56,50,50,32,85,83,36,
+0,106,97,109,97,105,99,97,100,111,108,108,97,114,0,48,46,48,49,49,
+50,50,32,85,83,36,0,106,111,114,100,97,110,100,105,110,97,114,0,49,
+46,52,48,56,53,32,85,83,36,0,106,97,112,97,110,121,101,110,0,48,
+46,48,49,49,49,32,85,83,36,0,107,101,110,121,97,115,104,105,108,108,
+105,110,103,0,48,46,48,49,51,49,32,85,83,36,0,107,121,114,103,121,
+122,115,116,97,110,115,111,109,0,48,46,48,50,50,51,57,32,85,83,36,
+0,99,97,109,98,111,100,105,97,114,105,101,108,0,48,46,48,48,48,50,
+52,32,85,83,36,0,99,111,109,111,114,111,115,102,114,97,110,99,0,48,
+46,48,48,50,55,57,57,32,85,83,36,0,110,111,114,116,104,107,111,114,
+101,97,119,111,110,0,48,46,48,48,49,49,49,49,32,85,83,36,0,107,
+117,119,97,105,116,100,105,110,97,114,0,51,46,52,54,57,55,32,85,83,
+36,0,99,97,121,109,97,110,105,115,108,97,110,100,115,100,111,108,108,97,
+114,0,49,46,50,49,56,51,32,85,83,36,0,107,97,122,97,107,104,115,
+116,97,110,116,101,110,103,101,0,48,46,48,48,54,55,52,55,32,85,83,
+36,0,108,97,111,115,107,105,112,0,48,46,48,48,48,49,49,56,32,85,
+83,36,0,108,101,98,97,110,111,110,112,111,117,110,100,0,48,46,48,48,
+48,54,54,54,32,85,83,36,0,115,114,105,108,97,110,107,97,114,117,112,
+101,101,0,48,46,48,48,56,55,49,53,32,85,83,36,0,108,105,98,101,
+114,105,97,100,111,108,108,97,114,0,48,46,48,49,52,48,53,32,85,83,
+36,0,108,101,115,111,116,104,111,109,97,108,111,116,105,0,48,46,49,50,
+57,55,32,85,83,36,0,108,105,116,104,117,97,110,105,97,108,105,116,97,
+105,0,48,46,51,57,57,32,85,83,36,0,108,97,116,118,105,97,108,97,
+116,97,115,0,49,46,57,52,50,49,32,85,83,36,0,108,105,98,121,97,
+100,105,110,97,114,0,48,46,55,57,55,55,32,85,83,36,0,109,111,114,
+111,99,99,111,100,105,114,104,97,109,0,48,46,49,50,50,54,32,85,83,
+36,0,109,111,108,100,111,118,97,108,101,117,0,48,46,48,55,56,48,51,
+32,85,83,36,0,109,97,100,97,103,97,115,99,97,114,97,114,105,97,114,
+121,0,48,46,48,48,48,52,54,56,32,85,83,36,0,109,97,99,101,100,
+111,110,105,97,100,101,110,97,114,0,48,46,48,50,50,51,49,32,85,83,
+36,0,109,121,97,110,109,97,114,107,121,97,116,0,48,46,49,53,51,54,
+32,85,83,36,0,109,111,110,103,111,108,105,97,116,117,103,114,105,107,0,
+48,46,48,48,48,54,57,51,32,85,83,36,0,109,97,99,97,117,112,97,
+116,97,99,97,0,48,46,49,50,53,32,85,83,36,0,109,97,117,114,105,
+116,97,110,105,97,111,117,103,117,105,121,97,0,48,46,48,48,51,56,50,
+52,32,85,83,36,0,109,97,117,114,105,116,105,117,115,114,117,112,101,101,
+0,48,46,48,51,50,55,57,32,85,83,36,0,109,97,108,100,105,118,101,
+115,114,117,102,105,121,97,97,0,48,46,48,55,56,49,51,32,85,83,36,
+0,109,97,108,97,119,105,107,119,97,99,104,97,0,48,46,48,48,54,54,
+51,50,32,85,83,36,0,109,101,120,105,99,111,112,101,115,111,0,48,46,
+48,55,54,51,57,32,85,83,36,0,109,97,108,97,121,115,105,97,114,105,
+110,103,103,105,116,0,48,46,50,57,50,49,32,85,83,36,0,109,111,122,
+97,109,98,105,113,117,101,109,101,116,105,99,97,105,0,48,46,48,51,49,
+54,32,85,83,36,0,110,97,109,105,98,105,97,100,111,108,108,97,114,0,
+48,46,49,50,57,54,32,85,83,36,0,110,105,103,101,114,105,97,110,97,
+105,114,97,0,48,46,48,48,54,54,51,49,32,85,83,36,0,110,105,99,
+97,114,97,103,117,97,99,111,114,100,111,98,97,0,48,46,48,52,55,55,
+32,85,83,36,0,110,111,114,119,97,121,107,114,111,110,101,0,48,46,49,
+54,57,53,32,85,83,36,0,110,101,112,97,108,110,101,112,97,108,114,117,
+112,101,101,0,48,46,48,49,51,52,50,32,85,83,36,0,110,101,119,122,
+101,97,108,97,110,100,100,111,108,108,97,114,0,48,46,54,57,54,55,32,
+85,83,36,0,111,109,97,110,114,105,97,108,0,50,46,53,57,55,49,32,
+85,83,36,0,112,97,110,97,109,97,98,97,108,98,111,97,0,49,32,85,
+83,36,0,112,101,114,117,115,111,108,0,48,46,51,52,56,54,32,85,83,
+36,0,112,97,112,117,97,110,101,119,103,117,105,110,101,97,107,105,110,97,
+0,48,46,51,55,53,52,32,85,83,36,0,112,104,105,108,105,112,112,105,
+110,101,115,112,101,115,111,0,48,46,48,50,49,53,55,32,85,83,36,0,
+112,97,107,105,115,116,97,110,114,117,112,101,101,0,48,46,48,49,49,55,
+57,32,85,83,36,0,112,111,108,97,110,100,122,108,111,116,121,0,48,46,
+51,51,56,57,32,85,83,36,0,112,97,114,97,103,117,97,121,103,117,97,
+114,97,110,105,0,48,46,48,48,48,50,49,51,32,85,83,36,0,113,97,
+116,97,114,114,105,97,108,0,48,46,50,55,52,55,32,85,83,36,0,114,
+111,109,97,110,105,97,108,101,117,0,48,46,51,51,51,56,32,85,83,36,
+0,115,101,114,98,105,97,100,105,110,97,114,0,48,46,48,49,51,57,51,
+32,85,83,36,0,114,117,115,115,105,97,114,117,98,108,101,0,48,46,48,
+51,51,48,52,32,85,83,36,0,114,119,97,110,100,97,102,114,97,110,99,
+0,48,46,48,48,49,55,52,53,32,85,83,36,0,115,97,117,100,105,97,
+114,97,98,105,97,114,105,121,97,108,0,48,46,50,54,54,55,32,85,83,
+36,0,115,111,108,111,109,111,110,105,115,108,97,110,100,115,100,111,108,108,
+97,114,0,48,46,49,50,55,51,32,85,83,36,0,115,101,121,99,104,101,
+108,108,101,115,114,117,112,101,101,0,48,46,48,56,55,53,51,32,85,83,
+36,0,115,117,100,97,110,112,111,117,110,100,0,48,46,52,52,54,52,32,
+85,83,36,0,115,119,101,100,101,110,107,114,111,110,111,114,0,49,51,46,
+55,49,57,32,85,83,36,0,115,105,110,103,97,112,111,114,101,100,111,108,
+108,97,114,0,48,46,55,48,54,53,32,85,83,36,0,115,97,105,110,116,
+104,101,108,101,110,97,112,111,117,110,100,0,49,46,53,54,50,55,32,85,
+83,36,0,115,105,101,114,114,97,108,101,111,110,101,108,101,111,110,101,0,
+48,46,48,48,48,50,53,53,32,85,83,36,0,115,111,109,97,108,105,97,
+115,104,105,108,108,105,110,103,0,48,46,48,48,48,54,54,57,32,85,83,
+36,0,115,117,114,105,110,97,109,101,100,111,108,108,97,114,0,48,46,51,
+54,51,53,32,85,83,36,0,115,97,111,116,111,109,101,100,111,98,114,97,
+0,54,46,52,50,55,101,45,48,53,32,85,83,36,0,101,108,115,97,108,
+118,97,100,111,114,99,111,108,111,110,0,48,46,49,49,52,51,32,85,83,
+36,0,115,121,114,105,97,112,111,117,110,100,0,48,46,48,50,49,55,57,
+32,85,83,36,0,115,119,97,122,105,108,97,110,100,101,109,97,108,97,110,
+103,101,110,105,0,48,46,49,50,57,55,32,85,83,36,0,116,104,97,105,
+108,97,110,100,98,97,104,116,0,48,46,48,51,48,49,54,32,85,83,36,
+0,116,97,106,105,107,105,115,116,97,110,115,111,109,111,110,105,0,48,46,
+50,50,57,32,85,83,36,0,116,117,110,105,115,105,97,100,105,110,97,114,
+0,48,46,55,50,55,53,32,85,83,36,0,116,111,110,103,97,112,97,39,
+97,110,103,97,0,48,46,53,49,55,32,85,83,36,0,116,117,114,107,101,
+121,110,101,119,108,105,114,97,0,48,46,54,53,57,55,32,85,83,36,0,
+116,114,105,110,105,100,97,100,97,110,100,116,111,98,97,103,111,100,111,108,
+108,97,114,0,48,46,49,53,55,57,32,85,83,36,0,116,97,105,119,97,
+110,100,111,108,108,97,114,115,0,48,46,48,51,49,49,57,32,85,83,36,
+0,116,97,110,122,97,110,105,97,115,104,105,108,108,105,110,103,0,48,46,
+48,48,48,55,52,49,32,85,83,36,0,117,107,114,97,105,110,101,104,114,
+121,118,110,105,97,0,48,46,49,50,51,57,32,85,83,36,0,117,103,97,
+110,100,97,115,104,105,108,108,105,110,103,0,48,46,48,48,48,53,48,53,
+32,85,83,36,0,117,110,105,116,101,100,115,116,97,116,101,115,100,111,108,
+108,97,114,0,49,32,85,83,36,0,117,114,117,103,117,97,121,112,101,115,
+111,0,48,46,48,53,48,55,57,32,85,83,36,0,117,122,98,101,107,105,
+115,116,97,110,115,117,109,0,48,46,48,48,48,54,53,51,32,85,83,36,
+0,118,101,110,101,122,117,101,108,97,98,111,108,105,118,97,114,0,48,46,
+50,51,51,32,85,83,36,0,118,105,101,116,110,97,109,100,111,110,103,0,
+53,46,52,101,45,48,53,32,85,83,36,0,118,97,110,117,97,116,117,118,
+97,116,117,0,48,46,48,49,48,48,56,32,85,83,36,0,115,97,109,111,
+97,116,97,108,97,0,48,46,51,56,56,53,32,85,83,36,0,115,105,108,
+118,101,114,111,117,110,99,101,0,49,51,46,51,52,52,32,85,83,36,0,
+103,111,108,100,111,117,110,99,101,0,49,48,55,54,46,54,32,85,83,36,
+0,101,97,115,116,99,97,114,105,98,98,101,97,110,100,111,108,108,97,114,
+0,48,46,51,56,50,52,32,85,83,36,0,112,97,108,108,97,100,105,117,
+109,111,117,110,99,101,0,50,48,55,46,52,32,85,83,36,0,112,108,97,
+116,105,110,117,109,111,117,110,99,101,0,49,49,49,55,46,55,32,85,83,
+36,0,121,101,109,101,110,114,105,97,108,0,48,46,48,48,52,56,53,53,
+32,85,83,36,0,115,111,117,116,104,97,102,114,105,99,97,114,97,110,100,
+0,48,46,49,50,57,55,32,85,83,36,0,122,97,109,98,105,97,107,119,
+97,99,104,97,0,48,46,48,48,48,50,49,52,32,85,83,36,0,122,105,
+109,98,97,98,119,101,100,111,108,108,97,114,0,48,46,48,48,50,54,52,
+49,32,85,83,36,0,65,69,68,0,117,110,105,116,101,100,97,114,97,98,
+101,109,105,114,97,116,101,115,100,105,114,104,97,109,0,65,70,78,0,97,
+102,103,104,97,110,105,115,116,97,110,97,102,103,104,97,110,105,0,65,76,
+76,0,97,108,98,97,110,105,97,108,101,107,0,65,77,68,0,97,114,109,
+101,110,105,97,100,114,97,109,0,65,78,71,0,110,101,116,104,101,114,108,
+97,110,100,115,97,110,116,105,108,108,101,115,103,117,105,108,100,101,114,0,
+65,79,65,0,97,110,103,111,108,97,107,119,97,110,122,97,0,65,82,83,
+0,97,114,103,101,110,116,105,110,97,112,101,115,111,0,65,85,68,0,97,
+117,115,116,114,97,108,105,97,100,111,108,108,97,114,0,65,87,71,0,97,
+114,117,98,97,103,117,105,108,100,101,114,115,0,65,90,78,0,97,122,101,
+114,98,97,105,106,97,110,110,101,119,109,97,110,97,116,0,66,65,77,0,
+98,111,115,110,105,97,109,97,114,107,97,0,66,66,68,0,98,97,114,98,
+97,100,111,115,100,111,108,108,97,114,0,66,68,84,0,98,97,110,103,108,
+97,100,101,115,104,116,97,107,97,0,66,71,78,0,98,117,108,103,97,114,
+105,97,108,101,118,0,66,72,68,0,98,97,104,114,97,105,110,100,105,110,
+97,114,0,66,73,70,0,98,117,114,117,110,100,105,102,114,97,110,99,0,
+66,77,68,0,98,101,114,109,117,100,97,100,111,108,108,97,114,0,66,78,
+68,0,98,114,117,110,101,105,100,111,108,108,97,114,0,66,79,66,0,98,
+111,108,105,118,105,97,98,111,108,105,118,105,97,110,111,0,66,82,76,0,
+98,114,97,122,105,108,114,101,97,108,0,66,83,68,0,98,97,104,97,109,
+97,115,100,111,108,108,97,114,0,66,84,78,0,98,104,117,116,97,110,110,
+103,117,108,116,114,117,109,0,66,87,80,0,98,111,116,115,119,97,110,97,
+112,117,108,97,0,66,89,82,0,98,101,108,97,114,117,115,114,117,98,108,
+101,0,66,90,68,0,98,101,108,105,122,101,100,111,108,108,97,114,0,67,
+65,68,0,99,97,110,97,100,97,100,111,108,108,97,114,0,67,68,70,0,
+99,111,110,103,111,102,114,97,110,99,0,67,72,70,0,115,119,105,116,122,
+101,114,108,97,110,100,102,114,97,110,99,0,67,76,80,0,99,104,105,108,
+101,112,101,115,111,0,67,78,89,0,99,104,105,110,97,121,117,97,110,0,
+67,79,80,0,99,111,108,111,109,98,105,97,112,101,115,111,0,67,82,67,
+0,99,111,115,116,97,114,105,99,97,99,111,108,111,110,0,67,85,80,0,
+99,117,98,97,112,101,115,111,0,67,86,69,0,99,97,112,101,118,101,114,
+100,101,101,115,99,117,100,111,0,67,90,75,0,99,122,101,99,104,107,111,
+114,117,110,121,0,68,74,70,0,100,106,105,98,111,117,116,105,102,114,97,
+110,99,0,68,75,75,0,100,101,110,109,97,114,107,107,114,111,110,101,114,
+0,68,79,80,0,100,111,109,105,110,105,99,97,110,114,101,112,117,98,108,
+105,99,112,101,115,111,0,68,90,68,0,97,108,103,101,114,105,97,100,105,
+110,97,114,0,69,69,75,0,101,115,116,111,110,105,97,107,114,111,111,110,
+0,69,71,80,0,101,103,121,112,116,112,111,117,110,100,0,69,82,78,0,
+101,114,105,116,114,101,97,110,97,107,102,97,0,69,84,66,0,101,116,104,
+105,111,112,105,97,98,105,114,114,0,69,85,82,0,101,117,114,111,0,70,
+74,68,0,102,105,106,105,100,111,108,108,97,114,0,70,75,80,0,102,97,
+108,107,108,97,110,100,105,115,108,97,110,100,115,112,111,117,110,100,0,71,
+66,80,0,103,114,101,97,116,98,114,105,116,97,105,110,112,111,117,110,100,
+0,71,69,76,0,103,101,111,114,103,105,97,108,97,114,105,0,71,72,83,
+0,103,104,97,110,97,99,101,100,105,0,71,73,80,0,103,105,98,114,97,
+108,116,97,114,112,111,117,110,100,0,71,77,68,0,103,97,109,98,105,97,
+100,97,108,97,115,105,0,71,78,70,0,103,117,105,110,101,97,102,114,97,
+110,99,0,71,84,81,0,103,117,97,116,101,109,97,108,97,113,117,101,116,
+122,97,108,0,71,89,68,0,103,117,121,97,110,97,100,111,108,108,97,114,
+0,72,75,68,0,104,111,110,103,107,111,110,103,100,111,108,108,97,114,0,
+72,78,76,0,104,111,110,100,117,114,97,115,108,101,109,112,105,114,97,0,
+72,82,75,0,99,114,111,97,116,105,97,107,117,110,97,0,72,84,71,0,
+104,97,105,116,105,103,111,117,114,100,101,115,0,72,85,70,0,104,117,110,
+103,97,114,121,102,111,114,105,110,116,0,73,68,82,0,105,110,100,111,110,
+101,115,105,97,114,117,112,105,97,104,0,73,76,83,0,105,115,114,97,101,
+108,110,101,119,115,104,101,107,101,108,0,73,78,82,0,105,110,100,105,97,
+114,117,112,101,101,0,73,81,68,0,105,114,97,113,100,105,110,97,114,0,
+73,82,82,0,105,114,97,110,114,105,97,108,0,73,83,75,0,105,99,101,
+108,97,110,100,107,114,111,110,97,0,74,77,68,0,106,97,109,97,105,99,
+97,100,111,108,108,97,114,0,74,79,68,0,106,111,114,100,97,110,100,105,
+110,97,114,0,74,80,89,0,106,97,112,97,110,121,101,110,0,75,69,83,
+0,107,101,110,121,97,115,104,105,108,108,105,110,103,0,75,71,83,0,107,
+121,114,103,121,122,115,116,97,110,115,111,109,0,75,72,82,0,99,97,109,
+98,111,100,105,97,114,105,101,108,0,75,77,70,0,99,111,109,111,114,111,
+115,102,114,97,110,99,0,75,80,87,0,110,111,114,116,104,107,111,114,101,
+97,119,111,110,0,75,87,68,0,107,117,119,97,105,116,100,105,110,97,114,
+0,75,89,68,0,99,97,121,109,97,110,105,115,108,97,110,100,115,100,111,
+108,108,97,114,0,75,90,84,0,107,97,122,97,107,104,115,116,97,110,116,
+101,110,103,101,0,76,65,75,0,108,97,111,115,107,105,112,0,76,66,80,
+0,108,101,98,97,110,111,110,112,111,117,110,100,0,76,75,82,0,115,114,
+105,108,97,110,107,97,114,117,112,101,101,0,76,82,68,0,108,105,98,101,
+114,105,97,100,111,108,108,97,114,0,76,83,76,0,108,101,115,111,116,104,
+111,109,97,108,111,116,105,0,76,84,76,0,108,105,116,104,117,97,110,105,
+97,108,105,116,97,105,0,76,86,76,0,108,97,116,118,105,97,108,97,116,
+97,115,0,76,89,68,0,108,105,98,121,97,100,105,110,97,114,0,77,65,
+68,0,109,111,114,111,99,99,111,100,105,114,104,97,109,0,77,68,76,0,
+109,111,108,100,111,118,97,108,101,117,0,77,71,65,0,109,97,100,97,103,
+97,115,99,97,114,97,114,105,97,114,121,0,77,75,68,0,109,97,99,101,
+100,111,110,105,97,100,101,110,97,114,0,77,77,75,0,109,121,97,110,109,
+97,114,107,121,97,116,0,77,78,84,0,109,111,110,103,111,108,105,97,116,
+117,103,114,105,107,0,77,79,80,0,109,97,99,97,117,112,97,116,97,99,
+97,0,77,82,79,0,109,97,117,114,105,116,97,110,105,97,111,117,103,117,
+105,121,97,0,77,85,82,0,109,97,117,114,105,116,105,117,115,114,117,112,
+101,101,0,77,86,82,0,109,97,108,100,105,118,101,115,114,117,102,105,121,
+97,97,0,77,87,75,0,109,97,108,97,119,105,107,119,97,99,104,97,0,
+77,88,78,0,109,101,120,105,99,111,112,101,115,111,0,77,89,82,0,109,
+97,108,97,121,115,105,97,114,105,110,103,103,105,116,0,77,90,78,0,109,
+111,122,97,109,98,105,113,117,101,109,101,116,105,99,97,105,0,78,65,68,
+0,110,97,109,105,98,105,97,100,111,108,108,97,114,0,78,71,78,0,110,
+105,103,101,114,105,97,110,97,105,114,97,0,78,73,79,0,110,105,99,97,
+114,97,103,117,97,99,111,114,100,111,98,97,0,78,79,75,0,110,111,114,
+119,97,121,107,114,111,110,101,0,78,80,82,0,110,101,112,97,108,110,101,
+112,97,108,114,117,112,101,101,0,78,90,68,0,110,101,119,122,101,97,108,
+97,110,100,100,111,108,108,97,114,0,79,77,82,0,111,109,97,110,114,105,
+97,108,0,80,65,66,0,112,97,110,97,109,97,98,97,108,98,111,97,0,
+80,69,78,0,112,101,114,117,115,111,108,0,80,71,75,0,112,97,112,117,
+97,110,101,119,103,117,105,110,101,97,107,105,110,97,0,80,72,80,0,112,
+104,105,108,105,112,112,105,110,101,115,112,101,115,111,0,80,75,82,0,112,
+97,107,105,115,116,97,110,114,117,112,101,101,0,80,76,78,0,112,111,108,
+97,110,100,122,108,111,116,121,0,80,89,71,0,112,97,114,97,103,117,97,
+121,103,117,97,114,97,110,105,0,81,65,82,0,113,97,116,97,114,114,105,
+97,108,0,82,79,78,0,114,111,109,97,110,105,97,108,101,117,0,82,83,
+68,0,115,101,114,98,105,97,100,105,110,97,114,0,82,85,66,0,114,117,
+115,115,105,97,114,117,98,108,101,0,82,87,70,0,114,119,97,110,100,97,
+102,114,97,110,99,0,83,65,82,0,115,97,117,100,105,97,114,97,98,105,
+97,114,105,121,97,108,0,83,66,68,0,115,111,108,111,109,111,110,105,115,
+108,97,110,100,115,100,111,108,108,97,114,0,83,67,82,0,115,101,121,99,
+104,101,108,108,101,115,114,117,112,101,101,0,83,68,71,0,115,117,100,97,
+110,112,111,117,110,100,0,83,69,75,0,115,119,101,100,101,110,107,114,111,
+110,111,114,0,83,71,68,0,115,105,110,103,97,112,111,114,101,100,111,108,
+108,97,114,0,83,72,80,0,115,97,105,110,116,104,101,108,101,110,97,112,
+111,117,110,100,0,83,76,76,0,115,105,101,114,114,97,108,101,111,110,101,
+108,101,111,110,101,0,83,79,83,0,115,111,109,97,108,105,97,115,104,105,
+108,108,105,110,103,0,83,82,68,0,115,117,114,105,110,97,109,101,100,111,
+108,108,97,114,0,83,84,68,0,115,97,111,116,111,109,101,100,111,98,114,
+97,0,83,86,67,0,101,108,115,97,108,118,97,100,111,114,99,111,108,111,
+110,0,83,89,80,0,115,121,114,105,97,112,111,117,110,100,0,83,90,76,
+0,115,119,97,122,105,108,97,110,100,101,109,97,108,97,110,103,101,110,105,
+0,84,72,66,0,116,104,97,105,108,97,110,100,98,97,104,116,0,84,74,
+83,0,116,97,106,105,107,105,115,116,97,110,115,111,109,111,110,105,0,84,
+78,68,0,116,117,110,105,115,105,97,100,105,110,97,114,0,84,79,80,0,
+116,111,110,103,97,112,97,39,97,110,103,97,0,84,82,89,0,116,117,114,
+107,101,121,110,101,119,108,105,114,97,0,84,84,68,0,116,114,105,110,105,
+100,97,100,97,110,100,116,111,98,97,103,111,100,111,108,108,97,114,0,84,
+87,68,0,116,97,105,119,97,110,100,111,108,108,97,114,115,0,84,90,83,
+0,116,97,110,122,97,110,105,97,115,104,105,108,108,105,110,103,0,85,65,
+72,0,117,107,114,97,105,110,101,104,114,121,118,110,105,97,0,85,71,88,
+0,117,103,97,110,100,97,115,104,105,108,108,105,110,103,0,85,83,68,0,
+117,110,105,116,101,100,115,116,97,116,101,115,100,111,108,108,97,114,0,85,
+89,85,0,117,114,117,103,117,97,121,112,101,115,111,0,85,90,83,0,117,
+122,98,101,107,105,115,116,97,110,115,117,109,0,86,69,70,0,118,101,110,
+101,122,117,101,108,97,98,111,108,105,118,97,114,0,86,78,68,0,118,105,
+101,116,110,97,109,100,111,110,103,0,86,85,86,0,118,97,110,117,97,116,
+117,118,97,116,117,0,87,83,84,0,115,97,109,111,97,116,97,108,97,0,
+88,65,71,0,115,105,108,118,101,114,111,117,110,99,101,0,88,65,85,0,
+103,111,108,100,111,117,110,99,101,0,88,67,68,0,101,97,115,116,99,97,
+114,105,98,98,101,97,110,100,111,108,108,97,114,0,88,80,68,0,112,97,
+108,108,97,100,105,117,109,111,117,110,99,101,0,88,80,84,0,112,108,97,
+116,105,110,117,109,111,117,110,99,101,0,89,69,82,0,121,101,109,101,110,
+114,105,97,108,0,90,65,82,0,115,111,117,116,104,97,102,114,105,99,97,
+114,97,110,100,0,90,77,75,0,122,97,109,98,105,97,107,119,97,99,104,
+97,0,90,87,68,0,122,105,109,98,97,98,119,101,100,111,108,108,97,114,
+0,115,105,108,118,101,114,112,114,105,99,101,0,115,105,108,118,101,114,111,
+117,110,99,101,32,47,32,116,114,111,121,111,117,110,99,101,0,103,111,108,
+100,112,114,105,99,101,0,103,111,108,100,111,117,110,99,101,32,47,32,116,
+114,111,121,111,117,110,99,101,0,112,97,108,108,97,100,105,117,109,112,114,
+105,99,101,0,112,97,108,108,97,100,105,117,109,111,117,110,99,101,32,47,
+32,116,114,111,121,111,117,110,99,101,0,112,108,97,116,105,110,117,109,112,
+114,105,99,101,0,112,108,97,116,105,110,117,109,111,117,110,99,101,32,47,
+32,116,114,111,121,111,117,110,99,101,0,85,75,80,0,71,66,80,0,86,
+69,66,0,49,124,49,48,48,48,32,86,69,70,0,111,108,100,100,111,108,
+108,97,114,103,111,108,100,0,50,51,46,50,50,32,103,114,97,105,110,115,
+32,103,111,108,100,112,114,105,99,101,0,110,101,119,100,111,108,108,97,114,
+103,111,108,100,0,57,54,124,55,32,103,114,97,105,110,115,32,103,111,108,
+100,112,114,105,99,101,0,100,111,108,108,97,114,103,111,108,100,0,110,101,
+119,100,111,108,108,97,114,103,111,108,100,0,112,111,117,110,100,103,111,108,
+100,0,49,49,51,32,103,114,97,105,110,115,32,103,111,108,100,112,114,105,
+99,101,0,85,83,112,101,110,110,121,119,101,105,103,104,116,0,50,46,53,
+32,103,114,97,109,115,0,85,83,110,105,99,107,101,108,119,101,105,103,104,
+116,0,53,32,103,114,97,109,115,0,85,83,100,105,109,101,119,101,105,103,
+104,116,0,49,48,32,99,101,110,116,115,32,47,32,40,50,48,32,85,83,
+36,32,47,32,108,98,41,0,85,83,113,117,97,114,116,101,114,119,101,105,
+103,104,116,0,50,53,32,99,101,110,116,115,32,47,32,40,50,48,32,85,
+83,36,32,47,32,108,98,41,0,85,83,104,97,108,102,100,111,108,108,97,
+114,119,101,105,103,104,116,0,53,48,32,99,101,110,116,115,32,47,32,40,
+50,48,32,85,83,36,32,47,32,108,98,41,0,85,83,100,111,108,108,97,
+114,109,97,115,115,0,56,46,49,32,103,114,97,109,115,0,113,117,105,100,
+0,98,114,105,116,97,105,110,112,111,117,110,100,0,102,105,118,101,114,0,
+53,32,113,117,105,100,0,116,101,110,110,101,114,0,49,48,32,113,117,105,
+100,0,109,111,110,107,101,121,0,53,48,48,32,113,117,105,100,0,98,114,
+103,114,97,110,100,0,49,48,48,48,32,113,117,105,100,0,98,111,98,0,
+115,104,105,108,108,105,110,103,0,115,104,105,108,108,105,110,103,0,49,124,
+50,48,32,98,114,105,116,97,105,110,112,111,117,110,100,0,111,108,100,112,
+101,110,99,101,0,49,124,49,50,32,115,104,105,108,108,105,110,103,0,102,
+97,114,116,104,105,110,103,0,49,124,52,32,111,108,100,112,101,110,99,101,
+0,103,117,105,110,101,97,0,50,49,32,115,104,105,108,108,105,110,103,0,
+99,114,111,119,110,0,53,32,115,104,105,108,108,105,110,103,0,102,108,111,
+114,105,110,0,50,32,115,104,105,108,108,105,110,103,0,103,114,111,97,116,
+0,52,32,111,108,100,112,101,110,99,101,0,116,97,110,110,101,114,0,54,
+32,111,108,100,112,101,110,99,101,0,98,114,112,101,110,110,121,0,48,46,
+48,49,32,98,114,105,116,97,105,110,112,111,117,110,100,0,112,101,110,99,
+101,0,98,114,112,101,110,110,121,0,116,117,112,112,101,110,99,101,0,50,
+32,112,101,110,99,101,0,116,117,112,112,101,110,110,121,0,116,117,112,112,
+101,110,99,101,0,104,97,39,112,101,110,110,121,0,104,97,108,102,98,114,
+112,101,110,110,121,0,104,97,112,101,110,110,121,0,104,97,39,112,101,110,
+110,121,0,111,108,100,112,101,110,110,121,0,111,108,100,112,101,110,99,101,
+0,111,108,100,116,117,112,112,101,110,99,101,0,50,32,111,108,100,112,101,
+110,99,101,0,111,108,100,116,117,112,112,101,110,110,121,0,111,108,100,116,
+117,112,112,101,110,99,101,0,116,104,114,101,101,112,101,110,99,101,0,51,
+32,111,108,100,112,101,110,99,101,0,116,104,114,101,101,112,101,110,110,121,
+0,116,104,114,101,101,112,101,110,99,101,0,111,108,100,116,104,114,101,101,
+112,101,110,99,101,0,116,104,114,101,101,112,101,110,99,101,0,111,108,100,
+116,104,114,101,101,112,101,110,110,121,0,116,104,114,101,101,112,101,110,99,
+101,0,111,108,100,104,97,108,102,112,101,110,110,121,0,104,97,108,102,111,
+108,100,112,101,110,110,121,0,111,108,100,104,97,39,112,101,110,110,121,0,
+111,108,100,104,97,108,102,112,101,110,110,121,0,111,108,100,104,97,112,101,
+110,110,121,0,111,108,100,104,97,39,112,101,110,110,121,0,98,114,112,111,
+110,121,0,50,53,32,98,114,105,116,97,105,110,112,111,117,110,100,0,108,
+111,111,110,121,0,49,32,99,97,110,97,100,97,100,111,108,108,97,114,0,
+116,111,111,110,121,0,50,32,99,97,110,97,100,97,100,111,108,108,97,114,
+0,99,111,114,100,0,52,42,52,42,56,32,102,116,94,51,0,102,97,99,
+101,99,111,114,100,0,49,124,50,32,99,111,114,100,0,99,111,114,100,102,
+111,111,116,0,49,124,56,32,99,111,114,100,0,99,111,114,100,102,101,101,
+116,0,99,111,114,100,102,111,111,116,0,104,111,117,115,101,99,111,114,100,
+0,49,124,51,32,99,111,114,100,0,98,111,97,114,100,102,111,111,116,0,
+102,116,94,50,32,105,110,99,104,0,98,111,97,114,100,102,101,101,116,0,
+98,111,97,114,100,102,111,111,116,0,102,98,109,0,98,111,97,114,100,102,
+111,111,116,0,115,116,97,99,107,0,52,32,121,97,114,100,94,51,0,114,
+105,99,107,0,52,32,102,116,32,56,32,102,116,32,49,54,32,105,110,99,
+104,101,115,0,115,116,101,114,101,0,109,94,51,0,116,105,109,98,101,114,
+102,111,111,116,0,102,116,94,51,0,115,116,97,110,100,97,114,100,0,49,
+50,48,32,49,50,32,102,116,32,49,49,32,105,110,32,49,46,53,32,105,
+110,0,100,101,97,108,0,49,50,32,102,116,32,49,49,32,105,110,32,50,
+46,53,32,105,110,0,119,104,111,108,101,100,101,97,108,0,49,50,32,102,
+116,32,49,49,32,105,110,32,49,46,50,53,32,105,110,0,115,112,108,105,
+116,100,101,97,108,0,49,50,32,102,116,32,49,49,32,105,110,32,53,124,
+56,32,105,110,0,70,76,85,73,68,95,70,76,79,87,0,86,79,76,85,
+77,69,32,47,32,84,73,77,69,0,99,117,109,101,99,0,109,94,51,47,
+115,0,99,117,115,101,99,0,102,116,94,51,47,115,0,103,112,104,0,103,
+97,108,47,104,114,0,103,112,109,0,103,97,108,47,109,105,110,0,109,103,
+100,0,109,101,103,97,103,97,108,47,100,97,121,0,99,102,115,0,102,116,
+94,51,47,115,0,99,102,104,0,102,116,94,51,47,104,111,117,114,0,99,
+102,109,0,102,116,94,51,47,109,105,110,0,108,112,109,0,108,105,116,101,
+114,47,109,105,110,0,108,102,109,0,102,116,47,109,105,110,0,112,114,117,
+0,109,109,72,103,32,47,32,40,109,108,47,109,105,110,41,0,109,105,110,
+101,114,115,105,110,99,104,65,90,0,49,46,53,32,102,116,94,51,47,109,
+105,110,0,109,105,110,101,114,115,105,110,99,104,67,65,0,49,46,53,32,
+102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,77,
+84,0,49,46,53,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,
+115,105,110,99,104,78,86,0,49,46,53,32,102,116,94,51,47,109,105,110,
+0,109,105,110,101,114,115,105,110,99,104,79,82,0,49,46,53,32,102,116,
+94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,73,68,0,
+49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,
+110,99,104,75,83,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,
+105,110,101,114,115,105,110,99,104,78,69,0,49,46,50,32,102,116,94,51,
+47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,78,77,0,49,46,
+50,32,102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,
+104,78,68,0,49,46,50,32,102,116,94,51,47,109,105,110,0,109,105,110,
+101,114,115,105,110,99,104,83,68,0,49,46,50,32,102,116,94,51,47,109,
+105,110,0,109,105,110,101,114,115,105,110,99,104,85,84,0,49,46,50,32,
+102,116,94,51,47,109,105,110,0,109,105,110,101,114,115,105,110,99,104,67,
+79,0,49,32,102,116,94,51,47,115,101,99,32,47,32,51,56,46,52,0,
+109,105,110,101,114,115,105,110,99,104,66,67,0,49,46,54,56,32,102,116,
+94,51,47,109,105,110,0,115,118,101,114,100,114,117,112,0,49,101,54,32,
+109,94,51,32,47,32,115,101,99,0,71,65,83,95,70,76,79,87,0,80,
+82,69,83,83,85,82,69,32,70,76,85,73,68,95,70,76,79,87,0,115,
+99,99,109,0,97,116,109,32,99,99,47,109,105,110,0,115,99,99,115,0,
+97,116,109,32,99,99,47,115,101,99,0,115,99,102,104,0,97,116,109,32,
+102,116,94,51,47,104,111,117,114,0,115,99,102,109,0,97,116,109,32,102,
+116,94,51,47,109,105,110,0,115,108,112,109,0,97,116,109,32,108,105,116,
+101,114,47,109,105,110,0,115,108,112,104,0,97,116,109,32,108,105,116,101,
+114,47,104,111,117,114,0,108,117,115,101,99,0,108,105,116,101,114,32,109,
+105,99,114,111,110,32,72,103,32,47,32,115,0,103,48,48,0,40,45,49,
+41,0,103,48,48,48,0,40,45,50,41,0,103,48,48,48,48,0,40,45,
+51,41,0,103,48,48,48,48,48,0,40,45,52,41,0,103,48,48,48,48,
+48,48,0,40,45,53,41,0,103,48,48,48,48,48,48,48,0,40,45,54,
+41,0,100,109,116,120,120,99,111,97,114,115,101,0,49,50,48,32,109,105,
+99,114,111,110,0,100,109,116,115,105,108,118,101,114,0,100,109,116,120,120,
+99,111,97,114,115,101,0,100,109,116,120,120,0,100,109,116,120,120,99,111,
+97,114,115,101,0,100,109,116,120,99,111,97,114,115,101,0,54,48,32,109,
+105,99,114,111,110,0,100,109,116,120,0,100,109,116,120,99,111,97,114,115,
+101,0,100,109,116,98,108,97,99,107,0,100,109,116,120,99,111,97,114,115,
+101,0,100,109,116,99,111,97,114,115,101,0,52,53,32,109,105,99,114,111,
+110,0,100,109,116,99,0,100,109,116,99,111,97,114,115,101,0,100,109,116,
+98,108,117,101,0,100,109,116,99,111,97,114,115,101,0,100,109,116,102,105,
+110,101,0,50,53,32,109,105,99,114,111,110,0,100,109,116,114,101,100,0,
+100,109,116,102,105,110,101,0,100,109,116,102,0,100,109,116,102,105,110,101,
+0,100,109,116,101,102,105,110,101,0,57,32,109,105,99,114,111,110,0,100,
+109,116,101,0,100,109,116,101,102,105,110,101,0,100,109,116,103,114,101,101,
+110,0,100,109,116,101,102,105,110,101,0,100,109,116,99,101,114,97,109,105,
+99,0,55,32,109,105,99,114,111,110,0,100,109,116,99,101,114,0,100,109,
+116,99,101,114,97,109,105,99,0,100,109,116,119,104,105,116,101,0,100,109,
+116,99,101,114,97,109,105,99,0,100,109,116,101,101,102,105,110,101,0,51,
+32,109,105,99,114,111,110,0,100,109,116,116,97,110,0,100,109,116,101,101,
+102,105,110,101,0,100,109,116,101,101,0,100,109,116,101,101,102,105,110,101,
+0,104,97,114,100,116,114,97,110,115,108,117,99,101,110,116,97,114,107,97,
+110,115,97,115,0,54,32,109,105,99,114,111,110,0,115,111,102,116,97,114,
+107,97,110,115,97,115,0,50,50,32,109,105,99,114,111,110,0,101,120,116,
+114,97,102,105,110,101,105,110,100,105,97,0,50,50,32,109,105,99,114,111,
+110,0,102,105,110,101,105,110,100,105,97,0,51,53,32,109,105,99,114,111,
+110,0,109,101,100,105,117,109,105,110,100,105,97,0,53,51,46,53,32,109,
+105,99,114,111,110,0,99,111,97,114,115,101,105,110,100,105,97,0,57,55,
+32,109,105,99,114,111,110,0,102,105,110,101,99,114,121,115,116,111,108,111,
+110,0,52,53,32,109,105,99,114,111,110,0,109,101,100,105,117,109,99,114,
+121,115,116,97,108,111,110,0,55,56,32,109,105,99,114,111,110,0,99,111,
+97,114,115,101,99,114,121,115,116,97,108,111,110,0,49,50,55,32,109,105,
+99,114,111,110,0,104,97,114,100,98,108,97,99,107,97,114,107,97,110,115,
+97,115,0,54,32,109,105,99,114,111,110,0,104,97,114,100,119,104,105,116,
+101,97,114,107,97,110,115,97,115,0,49,49,32,109,105,99,114,111,110,0,
+119,97,115,104,105,116,97,0,51,53,32,109,105,99,114,111,110,0,115,105,
+122,101,65,114,105,110,103,0,51,55,46,53,48,32,109,109,0,115,105,122,
+101,66,114,105,110,103,0,51,56,46,55,53,32,109,109,0,115,105,122,101,
+67,114,105,110,103,0,52,48,46,48,48,32,109,109,0,115,105,122,101,68,
+114,105,110,103,0,52,49,46,50,53,32,109,109,0,115,105,122,101,69,114,
+105,110,103,0,52,50,46,53,48,32,109,109,0,115,105,122,101,70,114,105,
+110,103,0,52,51,46,55,53,32,109,109,0,115,105,122,101,71,114,105,110,
+103,0,52,53,46,48,48,32,109,109,0,115,105,122,101,72,114,105,110,103,
+0,52,54,46,50,53,32,109,109,0,115,105,122,101,73,114,105,110,103,0,
+52,55,46,53,48,32,109,109,0,115,105,122,101,74,114,105,110,103,0,52,
+56,46,55,53,32,109,109,0,115,105,122,101,75,114,105,110,103,0,53,48,
+46,48,48,32,109,109,0,115,105,122,101,76,114,105,110,103,0,53,49,46,
+50,53,32,109,109,0,115,105,122,101,77,114,105,110,103,0,53,50,46,53,
+48,32,109,109,0,115,105,122,101,78,114,105,110,103,0,53,51,46,55,53,
+32,109,109,0,115,105,122,101,79,114,105,110,103,0,53,53,46,48,48,32,
+109,109,0,115,105,122,101,80,114,105,110,103,0,53,54,46,50,53,32,109,
+109,0,115,105,122,101,81,114,105,110,103,0,53,55,46,53,48,32,109,109,
+0,115,105,122,101,82,114,105,110,103,0,53,56,46,55,53,32,109,109,0,
+115,105,122,101,83,114,105,110,103,0,54,48,46,48,48,32,109,109,0,115,
+105,122,101,84,114,105,110,103,0,54,49,46,50,53,32,109,109,0,115,105,
+122,101,85,114,105,110,103,0,54,50,46,53,48,32,109,109,0,115,105,122,
+101,86,114,105,110,103,0,54,51,46,55,53,32,109,109,0,115,105,122,101,
+87,114,105,110,103,0,54,53,46,48,48,32,109,109,0,115,105,122,101,88,
+114,105,110,103,0,54,54,46,50,53,32,109,109,0,115,105,122,101,89,114,
+105,110,103,0,54,55,46,53,48,32,109,109,0,115,105,122,101,90,114,105,
+110,103,0,54,56,46,55,53,32,109,109,0,109,112,104,0,109,105,108,101,
+47,104,114,0,109,112,103,0,109,105,108,101,47,103,97,108,0,107,112,104,
+0,107,109,47,104,114,0,102,76,0,102,111,111,116,108,97,109,98,101,114,
+116,0,102,112,109,0,102,116,47,109,105,110,0,102,112,115,0,102,116,47,
+115,0,114,112,109,0,114,101,118,47,109,105,110,0,114,112,115,0,114,101,
+118,47,115,101,99,0,109,105,0,109,105,108,101,0,115,109,105,0,109,105,
+108,101,0,110,109,105,0,110,97,117,116,105,99,97,108,109,105,108,101,0,
+109,98,104,0,49,101,51,32,98,116,117,47,104,111,117,114,0,109,99,109,
+0,49,101,51,32,99,105,114,99,117,108,97,114,109,105,108,0,105,112,121,
+0,105,110,99,104,47,121,101,97,114,0,99,99,102,0,49,48,48,32,102,
+116,94,51,0,77,99,102,0,49,48,48,48,32,102,116,94,51,0,107,112,
+0,107,105,108,111,112,111,110,100,0,107,112,109,0,107,112,32,109,101,116,
+101,114,0,87,104,0,87,32,104,111,117,114,0,104,112,104,0,104,112,32,
+104,111,117,114,0,112,108,102,0,108,98,32,47,32,102,111,111,116,0,112,
+97,0,80,97,0,101,118,0,101,86,0,104,103,0,72,103,0,111,101,0,
+79,101,0,109,104,0,109,72,0,114,100,0,114,111,100,0,112,102,0,112,
+70,0,103,114,0,103,114,97,105,110,0,110,116,0,78,0,104,122,0,72,
+122,0,104,100,0,104,111,103,115,104,101,97,100,0,100,114,121,0,100,114,
+121,103,97,108,108,111,110,47,103,97,108,108,111,110,0,105,109,112,101,114,
+105,97,108,0,98,114,103,97,108,108,111,110,47,103,97,108,108,111,110,0,
+110,109,105,108,101,0,110,97,117,116,105,99,97,108,109,105,108,101,0,98,
+101,86,0,71,101,86,0,98,101,118,0,98,101,86,0,99,111,117,108,0,
+67,0,98,101,99,113,117,101,114,101,108,0,47,115,0,66,113,0,98,101,
+99,113,117,101,114,101,108,0,99,117,114,105,101,0,51,46,55,101,49,48,
+32,66,113,0,67,105,0,99,117,114,105,101,0,114,117,116,104,101,114,102,
+111,114,100,0,49,101,54,32,66,113,0,82,65,68,73,65,84,73,79,78,
+95,68,79,83,69,0,103,114,97,121,0,103,114,97,121,0,74,47,107,103,
+0,71,121,0,103,114,97,121,0,114,97,100,0,49,101,45,50,32,71,121,
+0,114,101,112,0,56,46,51,56,32,109,71,121,0,115,105,101,118,101,114,
+116,0,74,47,107,103,0,83,118,0,115,105,101,118,101,114,116,0,114,101,
+109,0,49,101,45,50,32,83,118,0,114,111,101,110,116,103,101,110,0,50,
+46,53,56,101,45,52,32,67,32,47,32,107,103,0,114,111,110,116,103,101,
+110,0,114,111,101,110,116,103,101,110,0,115,105,101,118,101,114,116,117,110,
+105,116,0,56,46,51,56,32,114,111,110,116,103,101,110,0,101,109,97,110,
+0,49,101,45,55,32,67,105,47,109,94,51,0,109,97,99,104,101,0,51,
+46,55,101,45,55,32,67,105,47,109,94,51,0,97,99,116,105,110,105,117,
+109,0,50,50,55,46,48,50,55,56,0,97,108,117,109,105,110,117,109,0,
+50,54,46,57,56,49,53,51,57,0,97,109,101,114,105,99,105,117,109,0,
+50,52,51,46,48,54,49,52,0,97,110,116,105,109,111,110,121,0,49,50,
+49,46,55,54,48,0,97,114,103,111,110,0,51,57,46,57,52,56,0,97,
+114,115,101,110,105,99,0,55,52,46,57,50,49,53,57,0,97,115,116,97,
+116,105,110,101,0,50,48,57,46,57,56,55,49,0,98,97,114,105,117,109,
+0,49,51,55,46,51,50,55,0,98,101,114,107,101,108,105,117,109,0,50,
+52,55,46,48,55,48,51,0,98,101,114,121,108,108,105,117,109,0,57,46,
+48,49,50,49,56,50,0,98,105,115,109,117,116,104,0,50,48,56,46,57,
+56,48,51,55,0,98,111,114,111,110,0,49,48,46,56,49,49,0,98,114,
+111,109,105,110,101,0,55,57,46,57,48,52,0,99,97,100,109,105,117,109,
+0,49,49,50,46,52,49,49,0,99,97,108,99,105,117,109,0,52,48,46,
+48,55,56,0,99,97,108,105,102,111,114,110,105,117,109,0,50,53,49,46,
+48,55,57,54,0,99,97,114,98,111,110,0,49,50,46,48,49,49,0,99,
+101,114,105,117,109,0,49,52,48,46,49,49,53,0,99,101,115,105,117,109,
+0,49,51,50,46,57,48,53,52,51,0,99,104,108,111,114,105,110,101,0,
+51,53,46,52,53,50,55,0,99,104,114,111,109,105,117,109,0,53,49,46,
+57,57,54,49,0,99,111,98,97,108,116,0,53,56,46,57,51,51,50,48,
+0,99,111,112,112,101,114,0,54,51,46,53,52,54,0,99,117,114,105,117,
+109,0,50,52,55,46,48,55,48,51,0,100,121,115,112,114,111,115,105,117,
+109,0,49,54,50,46,53,48,0,101,105,110,115,116,101,105,110,105,117,109,
+0,50,53,50,46,48,56,51,0,101,114,98,105,117,109,0,49,54,55,46,
+50,54,0,101,117,114,111,112,105,117,109,0,49,53,49,46,57,54,53,0,
+102,101,114,109,105,117,109,0,50,53,55,46,48,57,53,49,0,102,108,117,
+111,114,105,110,101,0,49,56,46,57,57,56,52,48,51,50,0,102,114,97,
+110,99,105,117,109,0,50,50,51,46,48,49,57,55,0,103,97,100,111,108,
+105,110,105,117,109,0,49,53,55,46,50,53,0,103,97,108,108,105,117,109,
+0,54,57,46,55,50,51,0,103,101,114,109,97,110,105,117,109,0,55,50,
+46,54,49,0,103,111,108,100,0,49,57,54,46,57,54,54,53,52,0,104,
+97,102,110,105,117,109,0,49,55,56,46,52,57,0,104,101,108,105,117,109,
+0,52,46,48,48,50,54,48,50,0,104,111,108,109,105,117,109,0,49,54,
+52,46,57,51,48,51,50,0,104,121,100,114,111,103,101,110,0,49,46,48,
+48,55,57,52,0,105,110,100,105,117,109,0,49,49,52,46,56,49,56,0,
+105,111,100,105,110,101,0,49,50,54,46,57,48,52,52,55,0,105,114,105,
+100,105,117,109,0,49,57,50,46,50,49,55,0,105,114,111,110,0,53,53,
+46,56,52,53,0,107,114,121,112,116,111,110,0,56,51,46,56,48,0,108,
+97,110,116,104,97,110,117,109,0,49,51,56,46,57,48,53,53,0,108,97,
+119,114,101,110,99,105,117,109,0,50,54,50,46,49,49,0,108,101,97,100,
+0,50,48,55,46,50,0,108,105,116,104,105,117,109,0,54,46,57,52,49,
+0,108,117,116,101,116,105,117,109,0,49,55,52,46,57,54,55,0,109,97,
+103,110,101,115,105,117,109,0,50,52,46,51,48,53,48,0,109,97,110,103,
+97,110,101,115,101,0,53,52,46,57,51,56,48,53,0,109,101,110,100,101,
+108,101,118,105,117,109,0,50,53,56,46,49,48,0,109,101,114,99,117,114,
+121,0,50,48,48,46,53,57,0,109,111,108,121,98,100,101,110,117,109,0,
+57,53,46,57,52,0,110,101,111,100,121,109,105,117,109,0,49,52,52,46,
+50,52,0,110,101,111,110,0,50,48,46,49,55,57,55,0,110,101,112,116,
+117,110,105,117,109,0,50,51,55,46,48,52,56,50,0,110,105,99,107,101,
+108,0,53,56,46,54,57,51,52,0,110,105,111,98,105,117,109,0,57,50,
+46,57,48,54,51,56,0,110,105,116,114,111,103,101,110,0,49,52,46,48,
+48,54,55,52,0,110,111,98,101,108,105,117,109,0,50,53,57,46,49,48,
+48,57,0,111,115,109,105,117,109,0,49,57,48,46,50,51,0,111,120,121,
+103,101,110,0,49,53,46,57,57,57,52,0,112,97,108,108,97,100,105,117,
+109,0,49,48,54,46,52,50,0,112,104,111,115,112,104,111,114,117,115,0,
+51,48,46,57,55,51,55,54,50,0,112,108,97,116,105,110,117,109,0,49,
+57,53,46,48,56,0,112,108,117,116,111,110,105,117,109,0,50,52,52,46,
+48,54,52,50,0,112,111,108,111,110,105,117,109,0,50,48,56,46,57,56,
+50,52,0,112,111,116,97,115,115,105,117,109,0,51,57,46,48,57,56,51,
+0,112,114,97,115,101,111,100,121,109,105,117,109,0,49,52,48,46,57,48,
+55,54,53,0,112,114,111,109,101,116,104,105,117,109,0,49,52,52,46,57,
+49,50,55,0,112,114,111,116,97,99,116,105,110,105,117,109,0,50,51,49,
+46,48,51,53,56,56,0,114,97,100,105,117,109,0,50,50,54,46,48,50,
+53,52,0,114,97,100,111,110,0,50,50,50,46,48,49,55,54,0,114,104,
+101,110,105,117,109,0,49,56,54,46,50,48,55,0,114,104,111,100,105,117,
+109,0,49,48,50,46,57,48,53,53,48,0,114,117,98,105,100,105,117,109,
+0,56,53,46,52,54,55,56,0,114,117,116,104,101,110,105,117,109,0,49,
+48,49,46,48,55,0,115,97,109,97,114,105,117,109,0,49,53,48,46,51,
+54,0,115,99,97,110,100,105,117,109,0,52,52,46,57,53,53,57,49,48,
+0,115,101,108,101,110,105,117,109,0,55,56,46,57,54,0,115,105,108,105,
+99,111,110,0,50,56,46,48,56,53,53,0,115,105,108,118,101,114,0,49,
+48,55,46,56,54,56,50,0,115,111,100,105,117,109,0,50,50,46,57,56,
+57,55,54,56,0,115,116,114,111,110,116,105,117,109,0,56,55,46,54,50,
+0,115,117,108,102,117,114,0,51,50,46,48,54,54,0,116,97,110,116,97,
+108,117,109,0,49,56,48,46,57,52,55,57,0,116,101,99,104,110,101,116,
+105,117,109,0,57,55,46,57,48,55,50,0,116,101,108,108,117,114,105,117,
+109,0,49,50,55,46,54,48,0,116,101,114,98,105,117,109,0,49,53,56,
+46,57,50,53,51,52,0,116,104,97,108,108,105,117,109,0,50,48,52,46,
+51,56,51,51,0,116,104,111,114,105,117,109,0,50,51,50,46,48,51,56,
+49,0,116,104,117,108,108,105,117,109,0,49,54,56,46,57,51,52,50,49,
+0,116,105,110,0,49,49,56,46,55,49,48,0,116,105,116,97,110,105,117,
+109,0,52,55,46,56,54,55,0,116,117,110,103,115,116,101,110,0,49,56,
+51,46,56,52,0,117,114,97,110,105,117,109,0,50,51,56,46,48,50,56,
+57,0,118,97,110,97,100,105,117,109,0,53,48,46,57,52,49,53,0,120,
+101,110,111,110,0,49,51,49,46,50,57,0,121,116,116,101,114,98,105,117,
+109,0,49,55,51,46,48,52,0,121,116,116,114,105,117,109,0,56,56,46,
+57,48,53,56,53,0,122,105,110,99,0,54,53,46,51,57,0,122,105,114,
+99,111,110,105,117,109,0,57,49,46,50,50,52,0,112,101,111,112,108,101,
+0,49,0,112,101,114,115,111,110,0,112,101,111,112,108,101,0,100,101,97,
+116,104,0,112,101,111,112,108,101,0,99,97,112,105,116,97,0,112,101,111,
+112,108,101,0,112,101,114,99,97,112,105,116,97,0,112,101,114,32,99,97,
+112,105,116,97,0,119,97,114,105,95,112,114,111,112,111,114,116,105,111,110,
+0,49,124,49,48,0,119,97,114,105,0,119,97,114,105,95,112,114,111,112,
+111,114,116,105,111,110,0,98,117,95,112,114,111,112,111,114,116,105,111,110,
+0,49,124,49,48,48,0,114,105,110,95,112,114,111,112,111,114,116,105,111,
+110,0,49,124,49,48,48,48,0,109,111,117,95,112,114,111,112,111,114,116,
+105,111,110,0,49,124,49,48,48,48,48,0,115,104,97,107,117,0,49,124,
+51,46,51,32,109,0,109,111,117,0,49,124,49,48,48,48,48,32,115,104,
+97,107,117,0,114,105,110,0,49,124,49,48,48,48,32,115,104,97,107,117,
+0,98,117,95,100,105,115,116,97,110,99,101,0,49,124,49,48,48,32,115,
+104,97,107,117,0,115,117,110,0,49,124,49,48,32,115,104,97,107,117,0,
+106,111,117,95,100,105,115,116,97,110,99,101,0,49,48,32,115,104,97,107,
+117,0,106,111,117,0,106,111,117,95,100,105,115,116,97,110,99,101,0,107,
+97,110,101,106,97,107,117,115,117,110,0,115,117,110,0,107,97,110,101,106,
+97,107,117,0,115,104,97,107,117,0,107,97,110,101,106,97,107,117,106,111,
+117,0,106,111,117,0,107,117,106,105,114,97,106,97,107,117,0,49,48,124,
+56,32,115,104,97,107,117,0,107,117,106,105,114,97,106,97,107,117,115,117,
+110,0,49,124,49,48,32,107,117,106,105,114,97,106,97,107,117,0,107,117,
+106,105,114,97,106,97,107,117,98,117,0,49,124,49,48,48,32,107,117,106,
+105,114,97,106,97,107,117,0,107,117,106,105,114,97,106,97,107,117,106,111,
+117,0,49,48,32,107,117,106,105,114,97,106,97,107,117,0,116,97,110,95,
+100,105,115,116,97,110,99,101,0,51,32,107,117,106,105,114,97,106,97,107,
+117,106,111,117,0,107,101,110,0,54,32,115,104,97,107,117,0,99,104,111,
+117,95,100,105,115,116,97,110,99,101,0,54,48,32,107,101,110,0,99,104,
+111,117,0,99,104,111,117,95,100,105,115,116,97,110,99,101,0,114,105,0,
+51,54,32,99,104,111,117,0,103,111,117,95,97,114,101,97,0,49,124,49,
+48,32,116,115,117,98,111,0,116,115,117,98,111,0,51,54,32,115,104,97,
+107,117,94,50,0,115,101,0,51,48,32,116,115,117,98,111,0,116,97,110,
+95,97,114,101,97,0,49,48,32,115,101,0,99,104,111,117,95,97,114,101,
+97,0,49,48,32,116,97,110,95,97,114,101,97,0,101,100,111,109,97,0,
+40,53,46,56,42,50,46,57,41,32,115,104,97,107,117,94,50,0,107,121,
+111,117,109,97,0,40,54,46,51,42,51,46,49,53,41,32,115,104,97,107,
+117,94,50,0,99,104,117,117,107,121,111,117,109,97,0,40,54,42,51,41,
+32,115,104,97,107,117,94,50,0,106,111,117,95,97,114,101,97,0,101,100,
+111,109,97,0,116,97,116,97,109,105,0,106,111,117,95,97,114,101,97,0,
+115,104,97,107,117,95,118,111,108,117,109,101,0,49,124,49,48,32,103,111,
+117,95,118,111,108,117,109,101,0,103,111,117,95,118,111,108,117,109,101,0,
+49,124,49,48,32,115,104,111,117,0,103,111,117,0,103,111,117,95,118,111,
+108,117,109,101,0,115,104,111,117,0,40,52,46,57,42,52,46,57,42,50,
+46,55,41,32,115,117,110,94,51,0,116,111,0,49,48,32,115,104,111,117,
+0,107,111,107,117,0,49,48,32,116,111,0,114,105,110,95,119,101,105,103,
+104,116,0,49,124,49,48,32,98,117,0,98,117,95,119,101,105,103,104,116,
+0,49,124,49,48,32,109,111,110,109,101,0,102,117,110,0,49,124,49,48,
+32,109,111,110,109,101,0,109,111,110,109,101,0,49,53,124,52,32,103,0,
+107,105,110,0,49,54,48,32,109,111,110,109,101,0,107,97,110,0,49,48,
+48,48,32,109,111,110,109,101,0,107,119,97,110,0,107,97,110,0,97,117,
+115,116,114,97,108,105,97,115,113,117,97,114,101,0,40,49,48,32,102,116,
+41,94,50,0,122,101,110,116,110,101,114,0,53,48,32,107,103,0,100,111,
+112,112,101,108,122,101,110,116,110,101,114,0,50,32,122,101,110,116,110,101,
+114,0,112,102,117,110,100,0,53,48,48,32,103,0,102,114,101,110,99,104,
+102,111,111,116,0,49,52,52,124,52,52,51,46,50,57,54,32,109,0,112,
+105,101,100,0,102,114,101,110,99,104,102,111,111,116,0,102,114,101,110,99,
+104,102,101,101,116,0,102,114,101,110,99,104,102,111,111,116,0,102,114,101,
+110,99,104,105,110,99,104,0,49,124,49,50,32,102,114,101,110,99,104,102,
+111,111,116,0,102,114,101,110,99,104,116,104,117,109,98,0,102,114,101,110,
+99,104,105,110,99,104,0,112,111,117,99,101,0,102,114,101,110,99,104,116,
+104,117,109,98,0,102,114,101,110,99,104,108,105,110,101,0,49,124,49,50,
+32,102,114,101,110,99,104,105,110,99,104,0,108,105,103,110,101,0,102,114,
+101,110,99,104,108,105,110,101,0,102,114,101,110,99,104,112,111,105,110,116,
+0,49,124,49,50,32,102,114,101,110,99,104,108,105,110,101,0,116,111,105,
+115,101,0,54,32,102,114,101,110,99,104,102,101,101,116,0,97,114,112,101,
+110,116,0,49,56,48,94,50,32,112,105,101,100,94,50,0,102,114,101,110,
+99,104,103,114,97,105,110,0,49,124,49,56,56,50,55,46,49,53,32,107,
+103,0,102,114,101,110,99,104,112,111,117,110,100,0,57,50,49,54,32,102,
+114,101,110,99,104,103,114,97,105,110,0,115,99,111,116,115,105,110,99,104,
+0,49,46,48,48,53,52,48,48,53,52,32,85,75,105,110,99,104,0,115,
+99,111,116,115,108,105,110,107,0,49,124,49,48,48,32,115,99,111,116,115,
+99,104,97,105,110,0,115,99,111,116,115,102,111,111,116,0,49,50,32,115,
+99,111,116,115,105,110,99,104,0,115,99,111,116,115,102,101,101,116,0,115,
+99,111,116,115,102,111,111,116,0,115,99,111,116,115,101,108,108,0,51,55,
+32,115,99,111,116,115,105,110,99,104,0,115,99,111,116,115,102,97,108,108,
+0,54,32,115,99,111,116,115,101,108,108,0,115,99,111,116,115,99,104,97,
+105,110,0,52,32,115,99,111,116,115,102,97,108,108,0,115,99,111,116,115,
+102,117,114,108,111,110,103,0,49,48,32,115,99,111,116,115,99,104,97,105,
+110,0,115,99,111,116,115,109,105,108,101,0,56,32,115,99,111,116,115,102,
+117,114,108,111,110,103,0,115,99,111,116,115,114,111,111,100,0,52,48,32,
+115,99,111,116,115,102,97,108,108,94,50,0,115,99,111,116,115,97,99,114,
+101,0,52,32,115,99,111,116,115,114,111,111,100,0,110,111,111,107,0,50,
+48,32,97,99,114,101,115,0,105,114,105,115,104,105,110,99,104,0,85,75,
+105,110,99,104,0,105,114,105,115,104,112,97,108,109,0,51,32,105,114,105,
+115,104,105,110,99,104,0,105,114,105,115,104,115,112,97,110,0,51,32,105,
+114,105,115,104,112,97,108,109,0,105,114,105,115,104,102,111,111,116,0,49,
+50,32,105,114,105,115,104,105,110,99,104,0,105,114,105,115,104,102,101,101,
+116,0,105,114,105,115,104,102,111,111,116,0,105,114,105,115,104,99,117,98,
+105,116,0,49,56,32,105,114,105,115,104,105,110,99,104,0,105,114,105,115,
+104,121,97,114,100,0,51,32,105,114,105,115,104,102,101,101,116,0,105,114,
+105,115,104,112,97,99,101,0,53,32,105,114,105,115,104,102,101,101,116,0,
+105,114,105,115,104,102,97,116,104,111,109,0,54,32,105,114,105,115,104,102,
+101,101,116,0,105,114,105,115,104,112,111,108,101,0,55,32,105,114,105,115,
+104,121,97,114,100,0,105,114,105,115,104,112,101,114,99,104,0,105,114,105,
+115,104,112,111,108,101,0,105,114,105,115,104,99,104,97,105,110,0,52,32,
+105,114,105,115,104,112,101,114,99,104,0,105,114,105,115,104,108,105,110,107,
+0,49,124,49,48,48,32,105,114,105,115,104,99,104,97,105,110,0,105,114,
+105,115,104,102,117,114,108,111,110,103,0,49,48,32,105,114,105,115,104,99,
+104,97,105,110,0,105,114,105,115,104,109,105,108,101,0,56,32,105,114,105,
+115,104,102,117,114,108,111,110,103,0,105,114,105,115,104,114,111,111,100,0,
+52,48,32,105,114,105,115,104,112,111,108,101,94,50,0,105,114,105,115,104,
+97,99,114,101,0,52,32,105,114,105,115,104,114,111,111,100,0,119,105,110,
+101,112,105,110,116,0,49,124,50,32,119,105,110,101,113,117,97,114,116,0,
+119,105,110,101,113,117,97,114,116,0,49,124,52,32,119,105,110,101,103,97,
+108,108,111,110,0,119,105,110,101,103,97,108,108,111,110,0,50,51,49,32,
+85,75,105,110,99,104,94,51,0,119,105,110,101,114,117,110,100,108,101,116,
+0,49,56,32,119,105,110,101,103,97,108,108,111,110,0,119,105,110,101,98,
+97,114,114,101,108,0,51,49,46,53,32,119,105,110,101,103,97,108,108,111,
+110,0,119,105,110,101,116,105,101,114,99,101,0,52,50,32,119,105,110,101,
+103,97,108,108,111,110,0,119,105,110,101,104,111,103,115,104,101,97,100,0,
+50,32,119,105,110,101,98,97,114,114,101,108,0,119,105,110,101,112,117,110,
+99,104,101,111,110,0,50,32,119,105,110,101,116,105,101,114,99,101,0,119,
+105,110,101,98,117,116,116,0,50,32,119,105,110,101,104,111,103,115,104,101,
+97,100,0,119,105,110,101,112,105,112,101,0,119,105,110,101,98,117,116,116,
+0,119,105,110,101,116,117,110,0,50,32,119,105,110,101,98,117,116,116,0,
+98,101,101,114,112,105,110,116,0,49,124,50,32,98,101,101,114,113,117,97,
+114,116,0,98,101,101,114,113,117,97,114,116,0,49,124,52,32,98,101,101,
+114,103,97,108,108,111,110,0,98,101,101,114,103,97,108,108,111,110,0,50,
+56,50,32,85,75,105,110,99,104,94,51,0,98,101,101,114,98,97,114,114,
+101,108,0,51,54,32,98,101,101,114,103,97,108,108,111,110,0,98,101,101,
+114,104,111,103,115,104,101,97,100,0,49,46,53,32,98,101,101,114,98,97,
+114,114,101,108,0,97,108,101,112,105,110,116,0,49,124,50,32,97,108,101,
+113,117,97,114,116,0,97,108,101,113,117,97,114,116,0,49,124,52,32,97,
+108,101,103,97,108,108,111,110,0,97,108,101,103,97,108,108,111,110,0,98,
+101,101,114,103,97,108,108,111,110,0,97,108,101,98,97,114,114,101,108,0,
+51,52,32,97,108,101,103,97,108,108,111,110,0,97,108,101,104,111,103,115,
+104,101,97,100,0,49,46,53,32,97,108,101,98,97,114,114,101,108,0,115,
+99,111,116,115,103,105,108,108,0,49,124,52,32,109,117,116,99,104,107,105,
+110,0,109,117,116,99,104,107,105,110,0,49,124,50,32,99,104,111,112,112,
+105,110,0,99,104,111,112,112,105,110,0,49,124,50,32,115,99,111,116,115,
+112,105,110,116,0,115,99,111,116,115,112,105,110,116,0,49,124,50,32,115,
+99,111,116,115,113,117,97,114,116,0,115,99,111,116,115,113,117,97,114,116,
+0,49,124,52,32,115,99,111,116,115,103,97,108,108,111,110,0,115,99,111,
+116,115,103,97,108,108,111,110,0,56,50,55,46,50,51,50,32,85,75,105,
+110,99,104,94,51,0,115,99,111,116,115,98,97,114,114,101,108,0,56,32,
+115,99,111,116,115,103,97,108,108,111,110,0,106,117,103,0,115,99,111,116,
+115,112,105,110,116,0,115,99,111,116,115,119,104,101,97,116,108,105,112,112,
+121,0,49,51,55,46,51,51,51,32,85,75,105,110,99,104,94,51,0,115,
+99,111,116,115,119,104,101,97,116,108,105,112,112,105,101,115,0,115,99,111,
+116,115,119,104,101,97,116,108,105,112,112,121,0,115,99,111,116,115,119,104,
+101,97,116,112,101,99,107,0,52,32,115,99,111,116,115,119,104,101,97,116,
+108,105,112,112,121,0,115,99,111,116,115,119,104,101,97,116,102,105,114,108,
+111,116,0,52,32,115,99,111,116,115,119,104,101,97,116,112,101,99,107,0,
+115,99,111,116,115,119,104,101,97,116,98,111,108,108,0,52,32,115,99,111,
+116,115,119,104,101,97,116,102,105,114,108,111,116,0,115,99,111,116,115,119,
+104,101,97,116,99,104,97,108,100,101,114,0,49,54,32,115,99,111,116,115,
+119,104,101,97,116,98,111,108,108,0,115,99,111,116,115,111,97,116,108,105,
+112,112,121,0,50,48,48,46,51,52,53,32,85,75,105,110,99,104,94,51,
+0,115,99,111,116,115,111,97,116,108,105,112,112,105,101,115,0,115,99,111,
+116,115,111,97,116,108,105,112,112,121,0,115,99,111,116,115,111,97,116,112,
+101,99,107,0,52,32,115,99,111,116,115,111,97,116,108,105,112,112,121,0,
+115,99,111,116,115,111,97,116,102,105,114,108,111,116,0,52,32,115,99,111,
+116,115,111,97,116,112,101,99,107,0,115,99,111,116,115,111,97,116,98,111,
+108,108,0,52,32,115,99,111,116,115,111,97,116,102,105,114,108,111,116,0,
+115,99,111,116,115,111,97,116,99,104,97,108,100,101,114,0,49,54,32,115,
+99,111,116,115,111,97,116,98,111,108,108,0,116,114,111,110,100,114,111,112,
+0,49,124,49,54,32,116,114,111,110,111,117,110,99,101,0,116,114,111,110,
+111,117,110,99,101,0,49,124,50,48,32,116,114,111,110,112,111,117,110,100,
+0,116,114,111,110,112,111,117,110,100,0,57,53,50,48,32,103,114,97,105,
+110,0,116,114,111,110,115,116,111,110,101,0,49,54,32,116,114,111,110,112,
+111,117,110,100,0,105,114,105,115,104,110,111,103,103,105,110,0,49,124,52,
+32,105,114,105,115,104,112,105,110,116,0,105,114,105,115,104,112,105,110,116,
+0,49,124,50,32,105,114,105,115,104,113,117,97,114,116,0,105,114,105,115,
+104,113,117,97,114,116,0,49,124,50,32,105,114,105,115,104,112,111,116,116,
+108,101,0,105,114,105,115,104,112,111,116,116,108,101,0,49,124,50,32,105,
+114,105,115,104,103,97,108,108,111,110,0,105,114,105,115,104,103,97,108,108,
+111,110,0,50,49,55,46,54,32,85,75,105,110,99,104,94,51,0,105,114,
+105,115,104,114,117,110,100,108,101,116,0,49,56,32,105,114,105,115,104,103,
+97,108,108,111,110,0,105,114,105,115,104,98,97,114,114,101,108,0,51,49,
+46,53,32,105,114,105,115,104,103,97,108,108,111,110,0,105,114,105,115,104,
+116,105,101,114,99,101,0,52,50,32,105,114,105,115,104,103,97,108,108,111,
+110,0,105,114,105,115,104,104,111,103,115,104,101,97,100,0,50,32,105,114,
+105,115,104,98,97,114,114,101,108,0,105,114,105,115,104,112,117,110,99,104,
+101,111,110,0,50,32,105,114,105,115,104,116,105,101,114,99,101,0,105,114,
+105,115,104,112,105,112,101,0,50,32,105,114,105,115,104,104,111,103,115,104,
+101,97,100,0,105,114,105,115,104,116,117,110,0,50,32,105,114,105,115,104,
+112,105,112,101,0,105,114,105,115,104,112,101,99,107,0,50,32,105,114,105,
+115,104,103,97,108,108,111,110,0,105,114,105,115,104,98,117,115,104,101,108,
+0,52,32,105,114,105,115,104,112,101,99,107,0,105,114,105,115,104,115,116,
+114,105,107,101,0,50,32,105,114,105,115,104,98,117,115,104,101,108,0,105,
+114,105,115,104,100,114,121,98,97,114,114,101,108,0,50,32,105,114,105,115,
+104,115,116,114,105,107,101,0,105,114,105,115,104,113,117,97,114,116,101,114,
+0,50,32,105,114,105,115,104,98,97,114,114,101,108,0,116,111,119,101,114,
+112,111,117,110,100,0,53,52,48,48,32,103,114,97,105,110,0,116,111,119,
+101,114,111,117,110,99,101,0,49,124,49,50,32,116,111,119,101,114,112,111,
+117,110,100,0,116,111,119,101,114,112,101,110,110,121,119,101,105,103,104,116,
+0,49,124,50,48,32,116,111,119,101,114,111,117,110,99,101,0,116,111,119,
+101,114,103,114,97,105,110,0,49,124,51,50,32,116,111,119,101,114,112,101,
+110,110,121,119,101,105,103,104,116,0,109,101,114,99,112,111,117,110,100,0,
+54,55,53,48,32,103,114,97,105,110,0,109,101,114,99,111,117,110,99,101,
+0,49,124,49,53,32,109,101,114,99,112,111,117,110,100,0,109,101,114,99,
+112,101,110,110,121,119,101,105,103,104,116,0,49,124,50,48,32,109,101,114,
+99,111,117,110,99,101,0,108,101,97,100,115,116,111,110,101,0,49,50,46,
+53,32,108,98,0,102,111,116,109,97,108,0,55,48,32,108,98,0,108,101,
+97,100,119,101,121,0,49,52,32,108,101,97,100,115,116,111,110,101,0,102,
+111,116,104,101,114,115,0,49,50,32,108,101,97,100,119,101,121,0,110,101,
+119,104,97,121,116,114,117,115,115,0,54,48,32,108,98,0,110,101,119,104,
+97,121,108,111,97,100,0,51,54,32,110,101,119,104,97,121,116,114,117,115,
+115,0,111,108,100,104,97,121,116,114,117,115,115,0,53,54,32,108,98,0,
+111,108,100,104,97,121,108,111,97,100,0,51,54,32,111,108,100,104,97,121,
+116,114,117,115,115,0,119,111,111,108,99,108,111,118,101,0,55,32,108,98,
+0,119,111,111,108,115,116,111,110,101,0,50,32,119,111,111,108,99,108,111,
+118,101,0,119,111,111,108,116,111,100,0,50,32,119,111,111,108,115,116,111,
+110,101,0,119,111,111,108,119,101,121,0,49,51,32,119,111,111,108,115,116,
+111,110,101,0,119,111,111,108,115,97,99,107,0,50,32,119,111,111,108,119,
+101,121,0,119,111,111,108,115,97,114,112,108,101,114,0,50,32,119,111,111,
+108,115,97,99,107,0,119,111,111,108,108,97,115,116,0,54,32,119,111,111,
+108,115,97,114,112,108,101,114,0,114,111,109,97,110,102,111,111,116,0,50,
+57,54,32,109,109,0,114,111,109,97,110,102,101,101,116,0,114,111,109,97,
+110,102,111,111,116,0,112,101,115,0,114,111,109,97,110,102,111,111,116,0,
+112,101,100,101,115,0,114,111,109,97,110,102,111,111,116,0,114,111,109,97,
+110,105,110,99,104,0,49,124,49,50,32,114,111,109,97,110,102,111,111,116,
+0,114,111,109,97,110,100,105,103,105,116,0,49,124,49,54,32,114,111,109,
+97,110,102,111,111,116,0,114,111,109,97,110,112,97,108,109,0,49,124,52,
+32,114,111,109,97,110,102,111,111,116,0,114,111,109,97,110,99,117,98,105,
+116,0,49,56,32,114,111,109,97,110,105,110,99,104,0,114,111,109,97,110,
+112,97,99,101,0,53,32,114,111,109,97,110,102,101,101,116,0,112,97,115,
+115,117,115,0,114,111,109,97,110,112,97,99,101,0,114,111,109,97,110,112,
+101,114,99,104,0,49,48,32,114,111,109,97,110,102,101,101,116,0,115,116,
+97,100,101,0,49,50,53,32,114,111,109,97,110,112,97,99,101,115,0,115,
+116,97,100,105,97,0,115,116,97,100,101,0,115,116,97,100,105,117,109,0,
+115,116,97,100,101,0,114,111,109,97,110,109,105,108,101,0,56,32,115,116,
+97,100,105,97,0,114,111,109,97,110,108,101,97,103,117,101,0,49,46,53,
+32,114,111,109,97,110,109,105,108,101,0,115,99,104,111,101,110,117,115,0,
+52,32,114,111,109,97,110,109,105,108,101,0,101,97,114,108,121,114,111,109,
+97,110,102,111,111,116,0,50,57,46,55,51,32,99,109,0,112,101,115,100,
+114,117,115,105,97,110,117,115,0,51,51,46,51,32,99,109,0,108,97,116,
+101,114,111,109,97,110,102,111,111,116,0,50,57,46,52,50,32,99,109,0,
+97,99,116,117,115,108,101,110,103,116,104,0,49,50,48,32,114,111,109,97,
+110,102,101,101,116,0,97,99,116,117,115,0,49,50,48,42,52,32,114,111,
+109,97,110,102,101,101,116,94,50,0,115,113,117,97,114,101,97,99,116,117,
+115,0,49,50,48,94,50,32,114,111,109,97,110,102,101,101,116,94,50,0,
+97,99,110,117,97,0,115,113,117,97,114,101,97,99,116,117,115,0,105,117,
+103,101,114,117,109,0,50,32,115,113,117,97,114,101,97,99,116,117,115,0,
+105,117,103,101,114,97,0,105,117,103,101,114,117,109,0,106,117,103,101,114,
+117,109,0,105,117,103,101,114,117,109,0,106,117,103,101,114,97,0,105,117,
+103,101,114,117,109,0,104,101,114,101,100,105,117,109,0,50,32,105,117,103,
+101,114,97,0,104,101,114,101,100,105,97,0,104,101,114,101,100,105,117,109,
+0,99,101,110,116,117,114,105,97,0,49,48,48,32,104,101,114,101,100,105,
+97,0,99,101,110,116,117,114,105,117,109,0,99,101,110,116,117,114,105,97,
+0,115,101,120,116,97,114,105,117,115,0,51,53,46,52,32,105,110,94,51,
+0,115,101,120,116,97,114,105,105,0,115,101,120,116,97,114,105,117,115,0,
+99,111,99,104,108,101,97,114,105,97,0,49,124,52,56,32,115,101,120,116,
+97,114,105,117,115,0,99,121,97,116,104,105,0,49,124,49,50,32,115,101,
+120,116,97,114,105,117,115,0,97,99,101,116,97,98,117,108,97,0,49,124,
+56,32,115,101,120,116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,
+97,0,49,124,52,32,115,101,120,116,97,114,105,117,115,0,113,117,97,114,
+116,97,114,105,117,115,0,113,117,97,114,116,97,114,105,97,0,104,101,109,
+105,110,97,101,0,49,124,50,32,115,101,120,116,97,114,105,117,115,0,104,
+101,109,105,110,97,0,104,101,109,105,110,97,101,0,99,104,101,111,110,105,
+120,0,49,46,53,32,115,101,120,116,97,114,105,105,0,115,101,109,111,100,
+105,117,115,0,56,32,115,101,120,116,97,114,105,117,115,0,115,101,109,111,
+100,105,105,0,115,101,109,111,100,105,117,115,0,109,111,100,105,117,115,0,
+49,54,32,115,101,120,116,97,114,105,117,115,0,109,111,100,105,105,0,109,
+111,100,105,117,115,0,99,111,110,103,105,117,115,0,49,50,32,104,101,109,
+105,110,97,101,0,99,111,110,103,105,105,0,99,111,110,103,105,117,115,0,
+97,109,112,104,111,114,97,0,56,32,99,111,110,103,105,105,0,97,109,112,
+104,111,114,97,101,0,97,109,112,104,111,114,97,0,99,117,108,108,101,117,
+115,0,50,48,32,97,109,112,104,111,114,97,101,0,113,117,97,100,114,97,
+110,116,97,108,0,97,109,112,104,111,114,97,0,108,105,98,114,97,0,53,
+48,53,50,32,103,114,97,105,110,0,108,105,98,114,97,101,0,108,105,98,
+114,97,0,114,111,109,97,110,112,111,117,110,100,0,108,105,98,114,97,0,
+117,110,99,105,97,0,49,124,49,50,32,108,105,98,114,97,0,117,110,99,
+105,97,101,0,117,110,99,105,97,0,114,111,109,97,110,111,117,110,99,101,
+0,117,110,99,105,97,0,100,101,117,110,120,0,49,49,32,117,110,99,105,
+97,0,100,101,120,116,97,110,115,0,49,48,32,117,110,99,105,97,0,100,
+111,100,114,97,110,115,0,57,32,117,110,99,105,97,0,98,101,115,0,56,
+32,117,110,99,105,97,0,115,101,112,114,117,110,120,0,55,32,117,110,99,
+105,97,0,115,101,109,105,115,0,54,32,117,110,99,105,97,0,113,117,105,
+110,99,117,110,120,0,53,32,117,110,99,105,97,0,116,114,105,101,110,115,
+0,52,32,117,110,99,105,97,0,113,117,97,100,114,97,110,115,0,51,32,
+117,110,99,105,97,0,115,101,120,116,97,110,115,0,50,32,117,110,99,105,
+97,0,115,101,115,99,117,110,99,105,97,0,49,46,53,32,117,110,99,105,
+97,0,115,101,109,117,110,99,105,97,0,49,124,50,32,117,110,99,105,97,
+0,115,105,115,99,105,108,105,117,115,0,49,124,52,32,117,110,99,105,97,
+0,115,101,120,116,117,108,97,0,49,124,54,32,117,110,99,105,97,0,115,
+101,109,105,115,101,120,116,117,108,97,0,49,124,49,50,32,117,110,99,105,
+97,0,115,99,114,105,112,116,117,108,117,109,0,49,124,50,52,32,117,110,
+99,105,97,0,115,99,114,117,112,117,108,97,0,115,99,114,105,112,116,117,
+108,117,109,0,114,111,109,97,110,111,98,111,108,0,49,124,50,32,115,99,
+114,117,112,117,108,97,0,114,111,109,97,110,97,115,112,111,117,110,100,0,
+52,50,49,48,32,103,114,97,105,110,0,101,103,121,112,116,105,97,110,114,
+111,121,97,108,99,117,98,105,116,0,50,48,46,54,51,32,105,110,0,101,
+103,121,112,116,105,97,110,112,97,108,109,0,49,124,55,32,101,103,121,112,
+116,105,97,110,114,111,121,97,108,99,117,98,105,116,0,101,103,121,112,116,
+105,97,110,100,105,103,105,116,0,49,124,52,32,101,103,121,112,116,105,97,
+110,112,97,108,109,0,101,103,121,112,116,105,97,110,115,104,111,114,116,99,
+117,98,105,116,0,54,32,101,103,121,112,116,105,97,110,112,97,108,109,0,
+100,111,117,98,108,101,114,101,109,101,110,0,50,57,46,49,54,32,105,110,
+0,114,101,109,101,110,100,105,103,105,116,0,49,124,52,48,32,100,111,117,
+98,108,101,114,101,109,101,110,0,103,114,101,101,107,102,111,111,116,0,49,
+50,46,52,53,32,105,110,0,103,114,101,101,107,102,101,101,116,0,103,114,
+101,101,107,102,111,111,116,0,103,114,101,101,107,99,117,98,105,116,0,49,
+46,53,32,103,114,101,101,107,102,111,111,116,0,112,111,117,115,0,103,114,
+101,101,107,102,111,111,116,0,112,111,100,101,115,0,103,114,101,101,107,102,
+111,111,116,0,111,114,103,117,105,97,0,54,32,103,114,101,101,107,102,111,
+111,116,0,103,114,101,101,107,102,97,116,104,111,109,0,111,114,103,117,105,
+97,0,115,116,97,100,105,111,110,0,49,48,48,32,111,114,103,117,105,97,
+0,97,107,97,105,110,97,0,49,48,32,103,114,101,101,107,102,101,101,116,
+0,112,108,101,116,104,114,111,110,0,49,48,32,97,107,97,105,110,97,0,
+103,114,101,101,107,102,105,110,103,101,114,0,49,124,49,54,32,103,114,101,
+101,107,102,111,111,116,0,104,111,109,101,114,105,99,99,117,98,105,116,0,
+50,48,32,103,114,101,101,107,102,105,110,103,101,114,115,0,115,104,111,114,
+116,103,114,101,101,107,99,117,98,105,116,0,49,56,32,103,114,101,101,107,
+102,105,110,103,101,114,115,0,105,111,110,105,99,102,111,111,116,0,50,57,
+54,32,109,109,0,100,111,114,105,99,102,111,111,116,0,51,50,54,32,109,
+109,0,111,108,121,109,112,105,99,99,117,98,105,116,0,50,53,32,114,101,
+109,101,110,100,105,103,105,116,0,111,108,121,109,112,105,99,102,111,111,116,
+0,50,124,51,32,111,108,121,109,112,105,99,99,117,98,105,116,0,111,108,
+121,109,112,105,99,102,105,110,103,101,114,0,49,124,49,54,32,111,108,121,
+109,112,105,99,102,111,111,116,0,111,108,121,109,112,105,99,102,101,101,116,
+0,111,108,121,109,112,105,99,102,111,111,116,0,111,108,121,109,112,105,99,
+100,97,107,121,108,111,115,0,111,108,121,109,112,105,99,102,105,110,103,101,
+114,0,111,108,121,109,112,105,99,112,97,108,109,0,49,124,52,32,111,108,
+121,109,112,105,99,102,111,111,116,0,111,108,121,109,112,105,99,112,97,108,
+101,115,116,114,97,0,111,108,121,109,112,105,99,112,97,108,109,0,111,108,
+121,109,112,105,99,115,112,105,116,104,97,109,101,0,51,124,52,32,102,111,
+111,116,0,111,108,121,109,112,105,99,115,112,97,110,0,111,108,121,109,112,
+105,99,115,112,105,116,104,97,109,101,0,111,108,121,109,112,105,99,98,101,
+109,97,0,50,46,53,32,111,108,121,109,112,105,99,102,101,101,116,0,111,
+108,121,109,112,105,99,112,97,99,101,0,111,108,121,109,112,105,99,98,101,
+109,97,0,111,108,121,109,112,105,99,111,114,103,117,105,97,0,54,32,111,
+108,121,109,112,105,99,102,101,101,116,0,111,108,121,109,112,105,99,102,97,
+116,104,111,109,0,111,108,121,109,112,105,99,111,114,103,117,105,97,0,111,
+108,121,109,112,105,99,99,111,114,100,0,54,48,32,111,108,121,109,112,105,
+99,102,101,101,116,0,111,108,121,109,112,105,99,97,109,109,97,0,111,108,
+121,109,112,105,99,99,111,114,100,0,111,108,121,109,112,105,99,112,108,101,
+116,104,114,111,110,0,49,48,48,32,111,108,121,109,112,105,99,102,101,101,
+116,0,111,108,121,109,112,105,99,115,116,97,100,105,111,110,0,54,48,48,
+32,111,108,121,109,112,105,99,102,101,101,116,0,103,114,101,101,107,107,111,
+116,121,108,101,0,50,55,48,32,109,108,0,120,101,115,116,101,115,0,50,
+32,103,114,101,101,107,107,111,116,121,108,101,0,107,104,111,117,115,0,49,
+50,32,103,114,101,101,107,107,111,116,121,108,101,0,109,101,116,114,101,116,
+101,115,0,49,50,32,107,104,111,117,115,0,99,104,111,105,110,105,120,0,
+52,32,103,114,101,101,107,107,111,116,121,108,101,0,104,101,107,116,101,111,
+115,0,56,32,99,104,111,105,110,105,120,0,109,101,100,105,109,110,111,115,
+0,54,32,104,101,107,116,101,111,115,0,97,101,103,105,110,97,115,116,97,
+116,101,114,0,49,57,50,32,103,114,97,105,110,0,97,101,103,105,110,97,
+100,114,97,99,104,109,97,101,0,49,124,50,32,97,101,103,105,110,97,115,
+116,97,116,101,114,0,97,101,103,105,110,97,111,98,111,108,0,49,124,54,
+32,97,101,103,105,110,97,100,114,97,99,104,109,97,101,0,97,101,103,105,
+110,97,109,105,110,97,0,53,48,32,97,101,103,105,110,97,115,116,97,116,
+101,114,115,0,97,101,103,105,110,97,116,97,108,101,110,116,0,54,48,32,
+97,101,103,105,110,97,109,105,110,97,0,97,116,116,105,99,115,116,97,116,
+101,114,0,49,51,53,32,103,114,97,105,110,0,97,116,116,105,99,100,114,
+97,99,104,109,97,101,0,49,124,50,32,97,116,116,105,99,115,116,97,116,
+101,114,0,97,116,116,105,99,111,98,111,108,0,49,124,54,32,97,116,116,
+105,99,100,114,97,99,104,109,97,101,0,97,116,116,105,99,109,105,110,97,
+0,53,48,32,97,116,116,105,99,115,116,97,116,101,114,115,0,97,116,116,
+105,99,116,97,108,101,110,116,0,54,48,32,97,116,116,105,99,109,105,110,
+97,0,110,111,114,116,104,101,114,110,99,117,98,105,116,0,50,54,46,54,
+32,105,110,0,110,111,114,116,104,101,114,110,102,111,111,116,0,49,124,50,
+32,110,111,114,116,104,101,114,110,99,117,98,105,116,0,115,117,109,101,114,
+105,97,110,99,117,98,105,116,0,52,57,53,32,109,109,0,107,117,115,0,
+115,117,109,101,114,105,97,110,99,117,98,105,116,0,115,117,109,101,114,105,
+97,110,102,111,111,116,0,50,124,51,32,115,117,109,101,114,105,97,110,99,
+117,98,105,116,0,97,115,115,121,114,105,97,110,99,117,98,105,116,0,50,
+49,46,54,32,105,110,0,97,115,115,121,114,105,97,110,102,111,111,116,0,
+49,124,50,32,97,115,115,121,114,105,97,110,99,117,98,105,116,0,97,115,
+115,121,114,105,97,110,112,97,108,109,0,49,124,51,32,97,115,115,121,114,
+105,97,110,102,111,111,116,0,97,115,115,121,114,105,97,110,115,117,115,105,
+0,49,124,50,48,32,97,115,115,121,114,105,97,110,112,97,108,109,0,115,
+117,115,105,0,97,115,115,121,114,105,97,110,115,117,115,105,0,112,101,114,
+115,105,97,110,114,111,121,97,108,99,117,98,105,116,0,55,32,97,115,115,
+121,114,105,97,110,112,97,108,109,0,104,97,115,104,105,109,105,99,117,98,
+105,116,0,50,53,46,53,54,32,105,110,0,98,108,97,99,107,99,117,98,
+105,116,0,50,49,46,50,56,32,105,110,0,97,114,97,98,105,99,102,101,
+101,116,0,49,124,50,32,98,108,97,99,107,99,117,98,105,116,0,97,114,
+97,98,105,99,102,111,111,116,0,97,114,97,98,105,99,102,101,101,116,0,
+97,114,97,98,105,99,105,110,99,104,0,49,124,49,50,32,97,114,97,98,
+105,99,102,111,111,116,0,97,114,97,98,105,99,109,105,108,101,0,52,48,
+48,48,32,98,108,97,99,107,99,117,98,105,116,0,115,105,108,118,101,114,
+100,105,114,104,101,109,0,52,53,32,103,114,97,105,110,0,116,114,97,100,
+101,100,105,114,104,101,109,0,52,56,32,103,114,97,105,110,0,115,105,108,
+118,101,114,107,105,114,97,116,0,49,124,49,54,32,115,105,108,118,101,114,
+100,105,114,104,101,109,0,115,105,108,118,101,114,119,117,107,105,121,101,104,
+0,49,48,32,115,105,108,118,101,114,100,105,114,104,101,109,0,115,105,108,
+118,101,114,114,111,116,108,0,49,50,32,115,105,108,118,101,114,119,117,107,
+105,121,101,104,0,97,114,97,98,105,99,115,105,108,118,101,114,112,111,117,
+110,100,0,115,105,108,118,101,114,114,111,116,108,0,116,114,97,100,101,107,
+105,114,97,116,0,49,124,49,54,32,116,114,97,100,101,100,105,114,104,101,
+109,0,116,114,97,100,101,119,117,107,105,121,101,104,0,49,48,32,116,114,
+97,100,101,100,105,114,104,101,109,0,116,114,97,100,101,114,111,116,108,0,
+49,50,32,116,114,97,100,101,119,117,107,105,121,101,104,0,97,114,97,98,
+105,99,116,114,97,100,101,112,111,117,110,100,0,116,114,97,100,101,114,111,
+116,108,0,112,97,114,97,115,97,110,103,0,51,46,53,32,109,105,108,101,
+0,98,105,98,108,105,99,97,108,99,117,98,105,116,0,50,49,46,56,32,
+105,110,0,104,101,98,114,101,119,99,117,98,105,116,0,49,55,46,53,56,
+32,105,110,0,108,105,0,49,48,124,50,55,46,56,32,109,105,108,101,0,
+108,105,97,110,103,0,49,49,124,51,32,111,122,0,116,105,109,101,112,111,
+105,110,116,0,49,124,53,32,104,111,117,114,0,116,105,109,101,109,105,110,
+117,116,101,0,49,124,49,48,32,104,111,117,114,0,116,105,109,101,111,115,
+116,101,110,116,0,49,124,54,48,32,104,111,117,114,0,116,105,109,101,111,
+117,110,99,101,0,49,124,56,32,116,105,109,101,111,115,116,101,110,116,0,
+116,105,109,101,97,116,111,109,0,49,124,52,55,32,116,105,109,101,111,117,
+110,99,101,0,109,105,116,101,0,49,124,50,48,32,103,114,97,105,110,0,
+100,114,111,105,116,0,49,124,50,52,32,109,105,116,101,0,112,101,114,105,
+111,116,0,49,124,50,48,32,100,114,111,105,116,0,98,108,97,110,99,0,
+49,124,50,52,32,112,101,114,105,111,116,0,162,0,99,101,110,116,0,163,
+0,98,114,105,116,97,105,110,112,111,117,110,100,0,165,0,106,97,112,97,
+110,121,101,110,0,229,110,103,115,116,114,246,109,0,97,110,103,115,116,114,
+111,109,0,197,0,97,110,103,115,116,114,111,109,0,114,246,110,116,103,101,
+110,0,114,111,101,110,116,103,101,110,0,176,67,0,100,101,103,67,0,176,
+70,0,100,101,103,70,0,176,75,0,75,0,176,82,0,100,101,103,82,0,
+176,0,100,101,103,114,101,101,0,104,117,110,100,114,101,100,119,101,105,103,
+104,116,0,98,114,104,117,110,100,114,101,100,119,101,105,103,104,116,0,116,
+111,110,0,98,114,116,111,110,0,115,99,114,117,112,108,101,0,98,114,115,
+99,114,117,112,108,101,0,102,108,117,105,100,111,117,110,99,101,0,98,114,
+102,108,117,105,100,111,117,110,99,101,0,103,97,108,108,111,110,0,98,114,
+103,97,108,108,111,110,0,98,117,115,104,101,108,0,98,114,98,117,115,104,
+101,108,0,113,117,97,114,116,101,114,0,98,114,113,117,97,114,116,101,114,
+0,99,104,97,108,100,114,111,110,0,98,114,99,104,97,108,100,114,111,110,
+0,99,117,112,0,98,114,99,117,112,0,116,101,97,99,117,112,0,98,114,
+116,101,97,99,117,112,0,116,97,98,108,101,115,112,111,111,110,0,98,114,
+116,97,98,108,101,115,112,111,111,110,0,116,101,97,115,112,111,111,110,0,
+98,114,116,101,97,115,112,111,111,110,0,104,111,114,115,101,112,111,119,101,
+114,0,98,114,104,111,114,115,101,112,111,119,101,114,0,100,111,108,108,97,
+114,0,85,83,36,0,99,101,110,116,0,36,32,48,46,48,49,0,112,101,
+110,110,121,0,98,114,112,101,110,110,121,0,109,105,110,105,109,0,109,105,
+110,105,109,110,111,116,101,0,112,111,110,121,0,98,114,112,111,110,121,0,
+103,114,97,110,100,0,98,114,103,114,97,110,100,0,102,105,114,107,105,110,
+0,98,114,102,105,114,107,105,110,0,104,111,103,115,104,101,97,100,0,98,
+114,104,111,103,115,104,101,97,100,0,97,99,114,101,0,105,110,116,97,99,
+114,101,0,97,99,114,101,102,111,111,116,0,105,110,116,97,99,114,101,102,
+111,111,116,0,121,111,116,116,97,0,49,101,50,52,0,122,101,116,116,97,
+0,49,101,50,49,0,101,120,97,0,49,101,49,56,0,112,101,116,97,0,
+49,101,49,53,0,116,101,114,97,0,49,101,49,50,0,103,105,103,97,0,
+49,101,57,0,109,101,103,97,0,49,101,54,0,109,121,114,105,97,0,49,
+101,52,0,107,105,108,111,0,49,101,51,0,104,101,99,116,111,0,49,101,
+50,0,100,101,99,97,0,49,101,49,0,100,101,107,97,0,100,101,99,97,
+0,100,101,99,105,0,49,101,45,49,0,99,101,110,116,105,0,49,101,45,
+50,0,109,105,108,108,105,0,49,101,45,51,0,109,105,99,114,111,0,49,
+101,45,54,0,110,97,110,111,0,49,101,45,57,0,112,105,99,111,0,49,
+101,45,49,50,0,102,101,109,116,111,0,49,101,45,49,53,0,97,116,116,
+111,0,49,101,45,49,56,0,122,101,112,116,111,0,49,101,45,50,49,0,
+121,111,99,116,111,0,49,101,45,50,52,0,113,117,97,114,116,101,114,0,
+49,124,52,0,115,101,109,105,0,48,46,53,0,100,101,109,105,0,48,46,
+53,0,104,101,109,105,0,48,46,53,0,104,97,108,102,0,48,46,53,0,
+100,111,117,98,108,101,0,50,0,116,114,105,112,108,101,0,51,0,116,114,
+101,98,108,101,0,51,0,107,105,98,105,0,50,94,49,48,0,109,101,98,
+105,0,50,94,50,48,0,103,105,98,105,0,50,94,51,48,0,116,101,98,
+105,0,50,94,52,48,0,112,101,98,105,0,50,94,53,48,0,101,120,98,
+105,0,50,94,54,48,0,75,105,0,107,105,98,105,0,77,105,0,109,101,
+98,105,0,71,105,0,103,105,98,105,0,84,105,0,116,101,98,105,0,80,
+105,0,112,101,98,105,0,69,105,0,101,120,98,105,0,89,0,121,111,116,
+116,97,0,90,0,122,101,116,116,97,0,69,0,101,120,97,0,80,0,112,
+101,116,97,0,84,0,116,101,114,97,0,71,0,103,105,103,97,0,77,0,
+109,101,103,97,0,107,0,107,105,108,111,0,104,0,104,101,99,116,111,0,
+100,97,0,100,101,107,97,0,100,0,100,101,99,105,0,99,0,99,101,110,
+116,105,0,109,0,109,105,108,108,105,0,117,0,109,105,99,114,111,0,110,
+0,110,97,110,111,0,112,0,112,105,99,111,0,102,0,102,101,109,116,111,
+0,97,0,97,116,116,111,0,122,0,122,101,112,116,111,0,121,0,121,111,
+99,116,111,0,85,83,0,85,83,0,115,117,114,118,101,121,0,85,83,0,
+103,101,111,100,101,116,105,99,0,85,83,0,105,110,116,0,105,110,116,0,
+85,75,0,85,75,0,98,114,105,116,105,115,104,0,85,75,0,188,0,49,
+124,52,0,189,0,49,124,50,0,190,0,51,124,52,0,181,0,109,105,99,
+114,111,0,99,105,114,99,108,101,97,114,101,97,0,114,0,112,105,32,114,
+94,50,0,109,0,115,113,114,116,40,99,105,114,99,108,101,97,114,101,97,
+47,112,105,41,0,109,94,50,0,99,105,114,99,108,101,97,114,101,97,0,
+115,112,104,101,114,101,118,111,108,117,109,101,0,114,0,52,124,51,32,112,
+105,32,114,94,51,0,109,0,99,117,98,101,114,111,111,116,40,115,112,104,
+101,114,101,118,111,108,117,109,101,47,52,124,51,32,112,105,41,0,109,94,
+51,0,115,112,104,101,114,101,118,111,108,117,109,101,0,115,112,104,101,114,
+101,118,111,108,0,114,0,115,112,104,101,114,101,118,111,108,117,109,101,40,
+114,41,0,109,0,126,115,112,104,101,114,101,118,111,108,117,109,101,40,115,
+112,104,101,114,101,118,111,108,41,0,109,94,51,0,115,112,104,101,114,101,
+118,111,108,0,115,113,117,97,114,101,0,120,0,120,94,50,0,115,113,114,
+116,40,115,113,117,97,114,101,41,0,115,113,117,97,114,101,0,112,72,0,
+120,0,49,48,94,40,45,120,41,32,109,111,108,47,108,105,116,101,114,0,
+0,40,45,108,111,103,40,112,72,32,108,105,116,101,114,115,47,109,111,108,
+41,41,0,109,111,108,47,108,105,116,101,114,0,112,72,0,116,101,109,112,
+67,0,120,0,120,32,75,32,43,32,115,116,100,116,101,109,112,0,0,40,
+116,101,109,112,67,32,43,40,45,115,116,100,116,101,109,112,41,41,47,75,
+0,75,0,116,101,109,112,67,0,116,101,109,112,99,101,108,115,105,117,115,
+0,120,0,116,101,109,112,67,40,120,41,0,0,126,116,101,109,112,67,40,
+116,101,109,112,99,101,108,115,105,117,115,41,0,75,0,116,101,109,112,99,
+101,108,115,105,117,115,0,116,101,109,112,70,0,120,0,40,120,43,40,45,
+51,50,41,41,32,100,101,103,70,32,43,32,115,116,100,116,101,109,112,0,
+0,40,116,101,109,112,70,43,40,45,115,116,100,116,101,109,112,41,41,47,
+100,101,103,70,32,43,32,51,50,0,75,0,116,101,109,112,70,0,116,101,
+109,112,102,97,104,114,101,110,104,101,105,116,0,120,0,116,101,109,112,70,
+40,120,41,0,0,126,116,101,109,112,70,40,116,101,109,112,102,97,104,114,
+101,110,104,101,105,116,41,0,75,0,116,101,109,112,102,97,104,114,101,110,
+104,101,105,116,0,116,101,109,112,114,101,97,117,109,117,114,0,120,0,120,
+32,100,101,103,114,101,97,117,109,117,114,43,115,116,100,116,101,109,112,0,
+0,40,116,101,109,112,114,101,97,117,109,117,114,43,40,45,115,116,100,116,
+101,109,112,41,41,47,100,101,103,114,101,97,117,109,117,114,0,75,0,116,
+101,109,112,114,101,97,117,109,117,114,0,103,97,115,109,97,114,107,0,100,
+101,103,82,0,98,114,105,108,0,120,0,50,94,40,120,43,45,49,48,48,
+41,32,108,97,109,98,101,114,116,115,0,0,108,111,103,50,40,98,114,105,
+108,47,108,97,109,98,101,114,116,41,43,49,48,48,0,108,97,109,98,101,
+114,116,0,98,114,105,108,0,101,118,49,48,48,0,120,0,50,94,120,32,
+107,49,50,53,48,32,47,32,115,49,48,48,0,0,108,111,103,50,40,101,
+118,49,48,48,32,115,49,48,48,32,47,32,107,49,50,53,48,41,0,99,
+100,47,109,94,50,0,101,118,49,48,48,0,105,118,49,48,48,0,120,0,
+50,94,120,32,99,50,53,48,32,47,32,115,49,48,48,0,49,0,108,111,
+103,50,40,105,118,49,48,48,32,115,49,48,48,32,47,32,99,50,53,48,
+41,0,108,120,0,105,118,49,48,48,0,115,104,111,101,115,105,122,101,95,
+109,101,110,0,110,0,115,104,111,101,95,109,101,110,48,32,43,32,110,32,
+115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,0,40,115,104,111,
+101,115,105,122,101,95,109,101,110,43,40,45,115,104,111,101,95,109,101,110,
+48,41,41,47,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,105,
+110,99,104,0,115,104,111,101,115,105,122,101,95,109,101,110,0,115,104,111,
+101,115,105,122,101,95,119,111,109,101,110,0,110,0,115,104,111,101,95,119,
+111,109,101,110,48,32,43,32,110,32,115,104,111,101,115,105,122,101,95,100,
+101,108,116,97,0,0,40,115,104,111,101,115,105,122,101,95,119,111,109,101,
+110,43,40,45,115,104,111,101,95,119,111,109,101,110,48,41,41,47,115,104,
+111,101,115,105,122,101,95,100,101,108,116,97,0,105,110,99,104,0,115,104,
+111,101,115,105,122,101,95,119,111,109,101,110,0,115,104,111,101,115,105,122,
+101,95,98,111,121,115,0,110,0,115,104,111,101,95,98,111,121,115,48,32,
+43,32,110,32,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,0,
+40,115,104,111,101,115,105,122,101,95,98,111,121,115,43,40,45,115,104,111,
+101,95,98,111,121,115,48,41,41,47,115,104,111,101,115,105,122,101,95,100,
+101,108,116,97,0,105,110,99,104,0,115,104,111,101,115,105,122,101,95,98,
+111,121,115,0,115,104,111,101,115,105,122,101,95,103,105,114,108,115,0,110,
+0,115,104,111,101,95,103,105,114,108,115,48,32,43,32,110,32,115,104,111,
+101,115,105,122,101,95,100,101,108,116,97,0,0,40,115,104,111,101,115,105,
+122,101,95,103,105,114,108,115,43,40,45,115,104,111,101,95,103,105,114,108,
+115,48,41,41,47,115,104,111,101,115,105,122,101,95,100,101,108,116,97,0,
+105,110,99,104,0,115,104,111,101,115,105,122,101,95,103,105,114,108,115,0,
+98,97,117,109,101,0,100,0,40,98,97,117,109,101,99,111,110,115,116,47,
+40,98,97,117,109,101,99,111,110,115,116,43,45,100,41,41,32,103,47,99,
+109,94,51,0,49,0,40,98,97,117,109,101,43,40,40,45,103,41,47,99,
+109,94,51,41,41,32,98,97,117,109,101,99,111,110,115,116,32,47,32,98,
+97,117,109,101,0,103,47,99,109,94,51,0,98,97,117,109,101,0,116,119,
+97,100,100,101,108,108,0,120,0,40,49,32,43,32,48,46,48,48,53,32,
+120,41,32,103,32,47,32,99,109,94,51,0,49,0,50,48,48,32,40,116,
+119,97,100,100,101,108,108,32,47,32,40,103,47,99,109,94,51,41,32,43,
+45,32,49,41,0,103,47,99,109,94,51,0,116,119,97,100,100,101,108,108,
+0,113,117,101,118,101,110,110,101,0,120,0,40,49,32,43,32,48,46,48,
+48,49,32,120,41,32,103,32,47,32,99,109,94,51,0,49,0,49,48,48,
+48,32,40,113,117,101,118,101,110,110,101,32,47,32,40,103,47,99,109,94,
+51,41,32,43,45,32,49,41,0,103,47,99,109,94,51,0,113,117,101,118,
+101,110,110,101,0,98,114,105,120,0,103,47,99,109,94,51,0,97,112,105,
+100,101,103,114,101,101,0,120,0,49,52,49,46,53,32,103,47,99,109,94,
+51,32,47,32,40,120,43,49,51,49,46,53,41,0,49,0,49,52,49,46,
+53,32,40,103,47,99,109,94,51,41,32,47,32,97,112,105,100,101,103,114,
+101,101,32,43,32,40,45,49,51,49,46,53,41,0,103,47,99,109,94,51,
+0,97,112,105,100,101,103,114,101,101,0,98,101,108,0,120,0,49,48,94,
+40,120,41,0,49,0,108,111,103,40,98,101,108,41,0,49,0,98,101,108,
+0,100,101,99,105,98,101,108,0,120,0,49,48,94,40,120,47,49,48,41,
+0,49,0,49,48,32,108,111,103,40,100,101,99,105,98,101,108,41,0,49,
+0,100,101,99,105,98,101,108,0,100,66,0,120,0,49,48,94,40,120,47,
+49,48,41,0,49,0,49,48,32,108,111,103,40,100,66,41,0,49,0,100,
+66,0,100,66,87,0,120,0,100,66,40,120,41,32,87,0,49,0,126,100,
+66,40,100,66,87,47,87,41,0,87,0,100,66,87,0,100,66,107,0,120,
+0,100,66,40,120,41,32,107,87,0,49,0,126,100,66,40,100,66,107,47,
+107,87,41,0,87,0,100,66,107,0,100,66,102,0,120,0,100,66,40,120,
+41,32,102,87,0,49,0,126,100,66,40,100,66,102,47,102,87,41,0,87,
+0,100,66,102,0,100,66,109,0,120,0,100,66,40,120,41,32,109,87,0,
+49,0,126,100,66,40,100,66,109,47,109,87,41,0,87,0,100,66,109,0,
+100,66,109,87,0,120,0,100,66,109,40,120,41,0,49,0,126,100,66,109,
+40,100,66,109,87,41,0,87,0,100,66,109,87,0,100,66,74,0,120,0,
+100,66,40,120,41,32,74,0,49,0,126,100,66,40,100,66,74,47,74,41,
+0,74,0,100,66,74,0,100,66,86,0,120,0,100,66,40,48,46,53,32,
+120,41,32,86,0,49,0,126,100,66,40,100,66,86,94,50,32,47,32,86,
+94,50,41,0,86,0,100,66,86,0,100,66,109,86,0,120,0,100,66,40,
+48,46,53,32,120,41,32,109,86,0,49,0,126,100,66,40,100,66,109,86,
+94,50,32,47,32,109,86,94,50,41,0,86,0,100,66,109,86,0,100,66,
+117,86,0,120,0,100,66,40,48,46,53,32,120,41,32,109,105,99,114,111,
+86,0,49,0,126,100,66,40,100,66,117,86,94,50,32,47,32,109,105,99,
+114,111,86,94,50,41,0,86,0,100,66,117,86,0,100,66,117,0,120,0,
+100,66,40,48,46,53,32,120,41,32,115,113,114,116,40,109,87,32,54,48,
+48,32,111,104,109,41,0,49,0,126,100,66,40,100,66,117,94,50,32,47,
+32,109,87,32,54,48,48,32,111,104,109,41,0,86,0,100,66,117,0,100,
+66,118,0,120,0,100,66,117,40,120,41,0,49,0,126,100,66,117,40,100,
+66,118,41,0,86,0,100,66,118,0,100,66,83,80,76,0,120,0,100,66,
+40,48,46,53,32,120,41,32,50,48,32,109,105,99,114,111,80,97,0,49,
+0,126,100,66,40,100,66,83,80,76,94,50,32,47,32,40,50,48,32,109,
+105,99,114,111,80,97,41,94,50,41,0,80,97,0,100,66,83,80,76,0,
+100,66,83,73,76,0,120,0,100,66,40,120,41,32,49,101,45,49,50,32,
+87,47,109,94,50,0,49,0,126,100,66,40,100,66,83,73,76,32,47,32,
+40,49,101,45,49,50,32,87,47,109,94,50,41,41,0,87,47,109,94,50,
+0,100,66,83,73,76,0,100,66,83,87,76,0,120,0,100,66,40,120,41,
+32,49,101,45,49,50,32,87,0,49,0,126,100,66,40,100,66,83,87,76,
+47,49,101,45,49,50,32,87,41,0,87,0,100,66,83,87,76,0,109,117,
+115,105,99,97,108,99,101,110,116,0,120,0,115,101,109,105,116,111,110,101,
+94,40,120,47,49,48,48,41,0,49,0,49,48,48,32,108,111,103,40,109,
+117,115,105,99,97,108,99,101,110,116,41,47,108,111,103,40,115,101,109,105,
+116,111,110,101,41,0,49,0,109,117,115,105,99,97,108,99,101,110,116,0,
+119,105,114,101,103,97,117,103,101,0,103,0,49,124,50,48,48,32,57,50,
+94,40,40,51,54,43,40,45,103,41,41,47,51,57,41,32,105,110,0,0,
+51,54,43,40,45,51,57,41,108,110,40,50,48,48,32,119,105,114,101,103,
+97,117,103,101,47,105,110,41,47,108,110,40,57,50,41,0,109,0,119,105,
+114,101,103,97,117,103,101,0,98,114,119,105,114,101,103,97,117,103,101,0,
+105,110,0,112,108,97,116,101,103,97,117,103,101,0,40,111,122,47,102,116,
+94,50,41,47,40,52,56,48,42,108,98,47,102,116,94,51,41,0,115,116,
+100,103,97,117,103,101,0,40,111,122,47,102,116,94,50,41,47,40,53,48,
+49,46,56,52,42,108,98,47,102,116,94,51,41,0,122,105,110,99,103,97,
+117,103,101,0,105,110,0,115,99,114,101,119,103,97,117,103,101,0,103,0,
+40,46,48,54,32,43,32,46,48,49,51,32,103,41,32,105,110,0,0,40,
+115,99,114,101,119,103,97,117,103,101,47,105,110,32,43,32,40,45,46,48,
+54,41,41,32,47,32,46,48,49,51,0,109,0,115,99,114,101,119,103,97,
+117,103,101,0,103,114,105,116,95,80,0,109,105,99,114,111,110,0,103,114,
+105,116,95,70,0,109,105,99,114,111,110,0,103,114,105,116,95,97,110,115,
+105,98,111,110,100,101,100,0,109,105,99,114,111,110,0,97,110,115,105,99,
+111,97,116,101,100,0,109,105,99,114,111,110,0,106,105,115,103,114,105,116,
+0,109,105,99,114,111,110,0,103,114,105,116,95,65,0,109,105,99,114,111,
+110,0,114,105,110,103,115,105,122,101,0,110,0,40,49,46,52,50,49,54,
+43,46,49,48,49,56,32,110,41,32,105,110,0,0,40,114,105,110,103,115,
+105,122,101,47,105,110,32,43,32,40,45,49,46,52,50,49,54,41,41,47,
+46,49,48,49,56,0,105,110,0,114,105,110,103,115,105,122,101,0,106,112,
+114,105,110,103,115,105,122,101,0,110,0,40,51,56,124,51,32,43,32,110,
+47,51,41,32,112,105,32,109,109,0,0,51,32,106,112,114,105,110,103,115,
+105,122,101,47,32,112,105,32,109,109,32,43,32,40,45,51,56,41,0,109,
+109,0,106,112,114,105,110,103,115,105,122,101,0,101,117,114,105,110,103,115,
+105,122,101,0,110,0,40,110,43,52,48,41,32,109,109,0,0,101,117,114,
+105,110,103,115,105,122,101,47,109,109,32,43,32,40,45,52,48,41,0,109,
+109,0,101,117,114,105,110,103,115,105,122,101,0,46,47,117,110,105,116,115,
+46,100,97,116,0
+}};